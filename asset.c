@@ -0,0 +1,37 @@
+/* Project:    Shrink, an LSZZ and RLE compression library
+ * Repository: <https://github.com/howerj/shrink>
+ * Maintainer: Richard James Howe
+ * License:    The Unlicense
+ * Email:      howe.r.j.89@gmail.com
+ *
+ * Checks an asset written out by 'shrink -E' decompresses to the file it
+ * was made from. This is linked with the generated C, which must define an
+ * asset called 'asset', and is run by the 'test' target in the makefile. */
+#include "shrink.h"
+#include <stdio.h>
+#include <string.h>
+
+extern shrink_asset_t asset;
+
+int main(int argc, char **argv) {
+	if (argc != 2) {
+		(void)fprintf(stderr, "usage: %s file\n", argv[0]);
+		return 1;
+	}
+	FILE *in = fopen(argv[1], "rb");
+	if (!in) {
+		(void)fprintf(stderr, "could not open '%s' for reading\n", argv[1]);
+		return 1;
+	}
+	const unsigned char *b = shrink_asset(&asset);
+	int r = !b;
+	for (size_t i = 0; !r && i < asset.size; i++)
+		r = fgetc(in) != b[i];
+	if (!r && fgetc(in) != EOF) /* asset is shorter than the file */
+		r = 1;
+	if (fclose(in) < 0)
+		r = 1;
+	if (r)
+		(void)fprintf(stderr, "asset differs from '%s'\n", argv[1]);
+	return r;
+}
@@ -0,0 +1,33 @@
+/* Explicit instantiations of the C++ LZSS CODEC for some common parameters,
+ * exported through the C API, see 'shrink.hpp'. */
+#include "shrink.hpp"
+
+template class shrink::lzss<10, 4, 2>;
+template class shrink::lzss<11, 4, 2>; /* the same as CODEC_LZSS with the defaults */
+template class shrink::lzss<12, 4, 2>;
+template class shrink::lzss<13, 5, 2>;
+
+template <unsigned ei, unsigned ej, unsigned p>
+static int lzss_op(shrink_t *io, const int encode) {
+	shrink::lzss<ei, ej, p> l;
+	io->mark = io->read;
+	io->cancelled = 0;
+	const int r = encode ? l.encode(io) : l.decode(io);
+	return io->cancelled ? SHRINK_CANCELLED : r;
+}
+
+extern "C" int shrink_lzss(shrink_t *io, const int encode, const unsigned ei, const unsigned ej, const unsigned p) {
+	assert(io);
+	if (p != 2)
+		return -1;
+	if (ej == 4) {
+		switch (ei) {
+		case 10: return lzss_op<10, 4, 2>(io, encode);
+		case 11: return lzss_op<11, 4, 2>(io, encode);
+		case 12: return lzss_op<12, 4, 2>(io, encode);
+		}
+	}
+	if (ej == 5 && ei == 13)
+		return lzss_op<13, 5, 2>(io, encode);
+	return -1;
+}
@@ -1,17 +1,70 @@
 /* Shrink library test driver program, see usage() */
+#ifndef USE_LARGE_FILES
+#ifdef _WIN32
+#define USE_LARGE_FILES (0)
+#else
+#define USE_LARGE_FILES (1)
+#endif
+#endif
+
+#if USE_LARGE_FILES /* 64-bit offsets with 'fseeko' and 'ftello' where 'long' is 32 bits */
+#define _FILE_OFFSET_BITS 64
+#define _POSIX_C_SOURCE 200809L
+#endif
+
+#ifndef USE_KERNEL_COPY
+#ifdef __linux__
+#define USE_KERNEL_COPY (1)
+#else
+#define USE_KERNEL_COPY (0)
+#endif
+#endif
+
+#if USE_KERNEL_COPY
+#define _GNU_SOURCE /* copy_file_range */
+#include <sys/sendfile.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
 #include "shrink.h"
 #include <assert.h>
 #include <ctype.h>
 #include <errno.h>
+#include <limits.h>
+#include <math.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
 #include <time.h>
 
+#if USE_LARGE_FILES
+#include <sys/types.h>
+typedef off_t file_offset_t;
+#define file_seek fseeko
+#define file_tell ftello
+#else
+typedef long file_offset_t;
+#define file_seek fseek
+#define file_tell ftell
+#endif
+
 #define UNUSED(X) ((void)(X))
 #define CRC_INIT (0xFFFFu)
 
+#ifndef USE_THREADS
+#ifdef _WIN32
+#define USE_THREADS (0)
+#else
+#define USE_THREADS (1)
+#endif
+#endif
+
+#if USE_THREADS
+#include <pthread.h>
+#endif
+
 #ifdef _WIN32 /* Used to unfuck file mode for "Win"dows. Text mode is for losers. */
 #include <windows.h>
 #include <io.h>
@@ -65,7 +118,7 @@ static int hash_put(const int ch, void *out) {
 }
 
 static const char *codec_name(const int codec) {
-	if (codec < CODEC_RLE || codec > CODEC_LZP)
+	if (codec < CODEC_RLE || codec > CODEC_MTF_ELIAS)
 		return "unknown";
 	const char *names[] = {
 		[CODEC_RLE] = "rle",
@@ -73,6 +126,33 @@ static const char *codec_name(const int codec) {
 		[CODEC_ELIAS] = "elias",
 		[CODEC_MTF] = "mtf",
 		[CODEC_LZP] = "lzp",
+		[CODEC_LZSSX] = "lzssx",
+		[CODEC_LZSSR] = "lzssr",
+		[CODEC_WORDS] = "words",
+		[CODEC_LZW] = "lzw",
+		[CODEC_SERIES] = "series",
+		[CODEC_MTF_RLE] = "mtf+rle",
+		[CODEC_MTF_ELIAS] = "mtf+elias",
+	};
+	return names[codec];
+}
+
+static const char *codec_enum(const int codec) { /* as it is in 'shrink.h', for generated C */
+	if (codec < CODEC_RLE || codec > CODEC_MTF_ELIAS)
+		return NULL;
+	const char *names[] = {
+		[CODEC_RLE] = "CODEC_RLE",
+		[CODEC_LZSS] = "CODEC_LZSS",
+		[CODEC_ELIAS] = "CODEC_ELIAS",
+		[CODEC_MTF] = "CODEC_MTF",
+		[CODEC_LZP] = "CODEC_LZP",
+		[CODEC_LZSSX] = "CODEC_LZSSX",
+		[CODEC_LZSSR] = "CODEC_LZSSR",
+		[CODEC_WORDS] = "CODEC_WORDS",
+		[CODEC_LZW] = "CODEC_LZW",
+		[CODEC_SERIES] = "CODEC_SERIES",
+		[CODEC_MTF_RLE] = "CODEC_MTF_RLE",
+		[CODEC_MTF_ELIAS] = "CODEC_MTF_ELIAS",
 	};
 	return names[codec];
 }
@@ -101,7 +181,21 @@ static int stats(shrink_t *l, const int codec, const int encode, const int hash,
 	return 0;
 }
 
-static int file_op(int codec, int encode, int hash, int verbose, FILE *in, FILE *out) {
+typedef struct {
+	clock_t begin;
+	FILE *out;
+} progress_t;
+
+static int file_progress(void *arg, size_t read, size_t wrote) {
+	assert(arg);
+	progress_t *p = arg;
+	const double time = (double)(clock() - p->begin) / CLOCKS_PER_SEC;
+	const double mib = read / (1024.0 * 1024.0);
+	(void)fprintf(p->out, "\rin %.0f MiB, out %.0f MiB, %.1f MiB/s ", mib, wrote / (1024.0 * 1024.0), time > 0 ? mib / time : 0.0);
+	return 0;
+}
+
+static int file_op(int codec, int encode, unsigned options, const unsigned *lzss, int hash, int verbose, int dry, int report, FILE *in, FILE *out) {
 	assert(in);
 	assert(out);
 	hashed_io_t hobj = {
@@ -109,11 +203,26 @@ static int file_op(int codec, int encode, int hash, int verbose, FILE *in, FILE
 		.in      = in,       .out      = out,
 		.hash_in = CRC_INIT, .hash_out = CRC_INIT,
 	};
-	shrink_t unhashed = { .get = file_get, .put = file_put, .in  = in,   .out = out,   };
-	shrink_t hashed   = { .get = hash_get, .put = hash_put, .in = &hobj, .out = &hobj, };
+	shrink_t unhashed = { .get = file_get, .put = file_put, .in  = in,   .out = out,   .options = options, };
+	shrink_t hashed   = { .get = hash_get, .put = hash_put, .in = &hobj, .out = &hobj, .options = options, };
 	shrink_t *io = hash ? &hashed : &unhashed;
+	if (dry) { /* only count the output */
+		unhashed.put = NULL;
+		io = &unhashed;
+		hash = 0;
+	}
 	const clock_t begin = clock();
-	const int r = shrink(io, codec, encode);
+	progress_t p = { .begin = begin, .out = stderr, };
+	if (report) {
+		io->progress = file_progress;
+		io->progress_arg = &p;
+		io->interval = 1ul << 20;
+	}
+	const int r = lzss ?
+		shrink_lzss(io, encode, lzss[0], lzss[1], lzss[2]) :
+		shrink(io, codec, encode);
+	if (report)
+		(void)fputc('\n', stderr);
 	const clock_t end = clock();
 	const double time = (double)(end - begin) / CLOCKS_PER_SEC;
 	if (!r && verbose)
@@ -122,6 +231,944 @@ static int file_op(int codec, int encode, int hash, int verbose, FILE *in, FILE
 	return r;
 }
 
+/* Framed mode splits the input into blocks which are compressed separately,
+ * and so can be compressed in parallel. Each block is preceded by a header:
+
+	.---------.--------------------------.----------------------------.
+	| 1 byte  | 4 byte length of block   | 4 byte length of encoded   |
+	| flags   | (big endian)             | block (big endian)         |
+	.---------.--------------------------.----------------------------.
+
+ * If FRAME_PRIMED is set in the flags the block was compressed with the
+ * block before it as a preset dictionary, which gets back most of what is
+ * lost by starting each block with an empty dictionary. As the dictionary
+ * is the uncompressed data, which the compressor already has, blocks can
+ * still be compressed in parallel.
+ *
+ * A block that does not get any smaller is stored instead, FRAME_STORED is
+ * set and the block follows the header as is. Unless FRAME_KEEP is also set,
+ * meaning the next block might be primed with it, the decoder does not need
+ * a stored block itself and has the kernel copy it from the input to the
+ * output, see 'kernel_copy'.
+ *
+ * The output only depends on the input and the options given, and not on
+ * the number of threads or the host. Blocks always start at a multiple of
+ * the block size, each block is primed with the one before it whichever
+ * batch it was in, whether a block is stored only depends on its own size,
+ * and blocks are written out in order. */
+
+enum { FRAME_PRIMED = 1u << 0, FRAME_STORED = 1u << 1, FRAME_KEEP = 1u << 2, };
+
+#define FRAME_HEADER (9u)
+#define FRAME_MAX    (1ul << 30) /* largest block */
+#define FRAME_THREADS (256)      /* most blocks compressed at once, the threads are on the stack */
+
+typedef struct {
+	size_t block;   /* block size, framed mode is off if zero */
+	int threads;    /* number of blocks compressed at once */
+	int prime;      /* prime each block with the previous one */
+	int verify;     /* decompress and compare each block */
+} frame_t;
+
+typedef struct {
+	unsigned char *b;
+	size_t used, length;
+} memory_t;
+
+typedef struct {
+	int codec, encode, verify, r;
+	unsigned options, flags;
+	const unsigned char *dictionary;
+	size_t dictionary_length;
+	memory_t in, out;
+} block_t;
+
+static int memory_get(void *in) {
+	assert(in);
+	memory_t *m = in;
+	if (m->used >= m->length)
+		return EOF;
+	return m->b[m->used++];
+}
+
+static int memory_put(const int ch, void *out) {
+	assert(out);
+	memory_t *m = out;
+	if (m->used >= m->length)
+		return EOF;
+	return m->b[m->used++] = ch;
+}
+
+static void *block_op(void *arg) {
+	assert(arg);
+	block_t *b = arg;
+	b->in.used = 0;
+	b->out.used = 0;
+	shrink_t io = {
+		.get = memory_get, .put = memory_put, .in = &b->in, .out = &b->out,
+		.options = b->options,
+		.dictionary = b->dictionary, .dictionary_length = b->dictionary_length,
+	};
+	b->r = shrink(&io, b->codec, b->encode);
+	if (b->r < 0 || !b->encode || !b->verify)
+		return NULL;
+	/* decompress what we just compressed whilst other blocks are still
+	 * being compressed */
+	memory_t coded = { .b = b->out.b, .used = 0, .length = b->out.used, };
+	memory_t check = { .b = malloc(b->in.length + 1), .used = 0, .length = b->in.length, };
+	shrink_t vio = {
+		.get = memory_get, .put = memory_put, .in = &coded, .out = &check,
+		.dictionary = b->dictionary, .dictionary_length = b->dictionary_length,
+	};
+	b->r = -1;
+	if (check.b && shrink(&vio, b->codec, 0) >= 0)
+		if (check.used == b->in.length && !memcmp(check.b, b->in.b, check.used))
+			b->r = 0;
+	free(check.b);
+	return NULL;
+}
+
+/* Blocks are run on their own threads and joined in order, the output does
+ * not depend on the number of threads. */
+static int blocks_op(block_t *bs, const int n) {
+	assert(bs);
+	assert(n <= FRAME_THREADS);
+#if USE_THREADS
+	pthread_t ts[n > 0 ? n : 1];
+	int started[n > 0 ? n : 1];
+	for (int i = 1; i < n; i++)
+		started[i] = pthread_create(&ts[i], NULL, block_op, &bs[i]) == 0;
+	(void)block_op(&bs[0]);
+	for (int i = 1; i < n; i++) {
+		if (started[i])
+			(void)pthread_join(ts[i], NULL);
+		else
+			(void)block_op(&bs[i]);
+	}
+#else
+	for (int i = 0; i < n; i++)
+		(void)block_op(&bs[i]);
+#endif
+	for (int i = 0; i < n; i++)
+		if (bs[i].r < 0)
+			return -1;
+	return 0;
+}
+
+static int put_u32(FILE *out, const unsigned long v) {
+	assert(out);
+	for (int i = 24; i >= 0; i -= 8)
+		if (fputc((v >> i) & 0xFFu, out) < 0)
+			return -1;
+	return 0;
+}
+
+static long get_u32(FILE *in) {
+	assert(in);
+	unsigned long v = 0;
+	for (int i = 0; i < 4; i++) {
+		const int ch = fgetc(in);
+		if (ch < 0)
+			return -1;
+		v = (v << 8) | ch;
+	}
+	return v > FRAME_MAX ? -1 : (long)v;
+}
+
+static int file_seek_to(FILE *f, const unsigned long long offset) {
+	assert(f);
+	const file_offset_t o = (file_offset_t)offset;
+	if (o < 0 || (unsigned long long)o != offset) /* too big for 'file_offset_t' */
+		return -1;
+	return file_seek(f, o, SEEK_SET);
+}
+
+/* Copy 'length' bytes from 'in' to 'out' in bulk, if they are both files,
+ * or just 'in' is, the data is copied by the kernel without passing through
+ * this process at all. Whatever is left over is copied in large blocks. */
+static int kernel_copy(FILE *in, FILE *out, size_t length) {
+	assert(in);
+	assert(out);
+	if (fflush(out) < 0)
+		return -1;
+#if USE_KERNEL_COPY
+	const file_offset_t ipos = file_tell(in), opos = file_tell(out); /* these fail on pipes */
+	if (ipos >= 0) {
+		const int ifd = fileno(in), ofd = fileno(out);
+		off_t ioff = ipos, ooff = opos;
+		size_t left = length;
+		for (int range = opos >= 0; left;) {
+			ssize_t n = -1;
+			if (range && (n = copy_file_range(ifd, &ioff, ofd, &ooff, left, 0)) <= 0)
+				range = 0; /* not supported for these files, try something else */
+			if (n <= 0) {
+				if (opos >= 0 && lseek(ofd, ooff, SEEK_SET) < 0)
+					break;
+				if ((n = sendfile(ofd, ifd, &ioff, left)) <= 0)
+					break;
+				ooff += n;
+			}
+			left -= n;
+		}
+		const unsigned long long done = length - left; /* move the streams past what has been copied */
+		if (file_seek_to(in, (unsigned long long)ipos + done) < 0)
+			return -1;
+		if (opos >= 0 && file_seek_to(out, (unsigned long long)opos + done) < 0)
+			return -1;
+		length = left;
+	}
+#endif
+	unsigned char b[1u << 14];
+	while (length) {
+		const size_t n = length < sizeof b ? length : sizeof b;
+		if (fread(b, 1, n, in) != n || fwrite(b, 1, n, out) != n)
+			return -1;
+		length -= n;
+	}
+	return 0;
+}
+
+static size_t encoded_size_bound(const size_t length) {
+	return (length * 3u) + 64u; /* Elias Gamma can more than double the size */
+}
+
+static int frame_encode(const frame_t *f, const int codec, const unsigned options, shrink_t *total, FILE *in, FILE *out) {
+	assert(f);
+	assert(total);
+	assert(in);
+	assert(out);
+	const int n = f->threads > 0 ? f->threads : 1;
+	const size_t bound = encoded_size_bound(f->block);
+	int r = -1;
+	unsigned char *raw[2] = { calloc(n, f->block), calloc(n, f->block), };
+	unsigned char *coded = calloc(n, bound);
+	block_t *bs = calloc(n, sizeof *bs);
+	const unsigned char *previous = NULL; /* last block of previous batch */
+	size_t previous_length = 0;
+	if (!raw[0] || !raw[1] || !coded || !bs)
+		goto end;
+	for (int batch = 0, eof = 0; !eof; batch ^= 1) {
+		int m = 0;
+		for (; m < n; m++) {
+			block_t *b = &bs[m];
+			unsigned char *data = raw[batch] + (m * f->block);
+			const size_t got = fread(data, 1, f->block, in);
+			if (got < f->block)
+				eof = 1;
+			if (!got)
+				break;
+			*b = (block_t) {
+				.codec = codec, .encode = 1, .options = options, .verify = f->verify,
+				.in  = { .b = data, .length = got, },
+				.out = { .b = coded + (m * bound), .length = bound, },
+			};
+			const unsigned char *d = m ? bs[m - 1].in.b : previous;
+			const size_t dl = m ? bs[m - 1].in.length : previous_length;
+			if (f->prime && d) {
+				b->flags |= FRAME_PRIMED;
+				b->dictionary = d;
+				b->dictionary_length = dl;
+			}
+			if (eof) {
+				m++;
+				break;
+			}
+		}
+		if (blocks_op(bs, m) < 0)
+			goto end;
+		for (int i = 0; i < m; i++) {
+			const block_t *b = &bs[i];
+			const int stored = b->out.used >= b->in.length;
+			const unsigned flags = stored ? (FRAME_STORED | (f->prime ? FRAME_KEEP : 0)) : b->flags;
+			const memory_t *payload = stored ? &b->in : &b->out;
+			const size_t length = stored ? b->in.length : b->out.used;
+			if (fputc(flags, out) < 0 || put_u32(out, b->in.length) < 0 || put_u32(out, length) < 0)
+				goto end;
+			if (fwrite(payload->b, 1, length, out) != length)
+				goto end;
+			total->read  += b->in.length;
+			total->wrote += FRAME_HEADER + length;
+		}
+		if (m) {
+			previous = bs[m - 1].in.b;
+			previous_length = bs[m - 1].in.length;
+		}
+	}
+	r = 0;
+end:
+	free(raw[0]);
+	free(raw[1]);
+	free(coded);
+	free(bs);
+	return r;
+}
+
+static int frame_decode(const frame_t *f, const int codec, shrink_t *total, FILE *in, FILE *out) {
+	assert(f);
+	assert(total);
+	assert(in);
+	assert(out);
+	int r = -1;
+	unsigned char *plain[2] = { NULL, NULL, }, *coded = NULL;
+	size_t plain_length[2] = { 0, 0, };
+	for (int current = 0;; current ^= 1) {
+		const int flags = fgetc(in);
+		if (flags < 0)
+			break;
+		const long length = get_u32(in), encoded = get_u32(in);
+		if (length < 0 || encoded < 0)
+			goto end;
+		if ((flags & FRAME_STORED) && encoded != length)
+			goto end;
+		if ((flags & (FRAME_STORED | FRAME_KEEP)) == FRAME_STORED) {
+			if (kernel_copy(in, out, length) < 0)
+				goto end;
+			plain_length[current] = 0; /* the next block cannot be primed with this one */
+			total->read  += FRAME_HEADER + encoded;
+			total->wrote += length;
+			continue;
+		}
+		unsigned char *p = realloc(plain[current], length + 1);
+		unsigned char *c = realloc(coded, encoded + 1);
+		if (p) plain[current] = p;
+		if (c) coded = c;
+		if (!p || !c)
+			goto end;
+		if (fread((flags & FRAME_STORED) ? plain[current] : coded, 1, encoded, in) != (size_t)encoded)
+			goto end;
+		if (flags & FRAME_STORED) {
+			if (fwrite(plain[current], 1, length, out) != (size_t)length)
+				goto end;
+			plain_length[current] = length;
+			total->read  += FRAME_HEADER + encoded;
+			total->wrote += length;
+			continue;
+		}
+		const int primed = !!(flags & FRAME_PRIMED);
+		block_t b = {
+			.codec = codec, .encode = 0,
+			.in  = { .b = coded, .length = encoded, },
+			.out = { .b = plain[current], .length = length, },
+			.dictionary = primed ? plain[current ^ 1] : NULL,
+			.dictionary_length = primed ? plain_length[current ^ 1] : 0,
+		};
+		if (primed && (!plain[current ^ 1] || !plain_length[current ^ 1]))
+			goto end;
+		(void)block_op(&b);
+		if (b.r < 0 || b.out.used != (size_t)length)
+			goto end;
+		if (fwrite(b.out.b, 1, b.out.used, out) != b.out.used)
+			goto end;
+		plain_length[current] = length;
+		total->read  += FRAME_HEADER + encoded;
+		total->wrote += length;
+	}
+	r = 0;
+end:
+	free(plain[0]);
+	free(plain[1]);
+	free(coded);
+	return r;
+}
+
+static int thread_safe(void) { /* a library built with USE_STATIC is not */
+	unsigned long version = 0;
+	return shrink_version(&version) == 0 && !(version & SHRINK_VERSION_STATIC);
+}
+
+static int frame_op(const frame_t *in_frame, int codec, int encode, unsigned options, int verbose, FILE *in, FILE *out) {
+	assert(in_frame);
+	frame_t frame = *in_frame, *f = &frame;
+	if (!thread_safe())
+		f->threads = 1;
+	shrink_t total = { .read = 0, };
+	const clock_t begin = clock();
+	const int r = encode ?
+		frame_encode(f, codec, options, &total, in, out) :
+		frame_decode(f, codec, &total, in, out);
+	const clock_t end = clock();
+	const double time = (double)(end - begin) / CLOCKS_PER_SEC;
+	if (!r && verbose)
+		if (stats(&total, codec, encode, 0, time, stderr) < 0)
+			return -1;
+	return r;
+}
+
+/* An index of checkpoints into an LZSS stream allows decoding to start part
+ * way through it instead of at the start, see 'shrink_index'. The index is
+ * a file of the form:
+
+	.-----------------.--------------------.-------------------------.
+	| 8 byte magic    | 4 byte window size | Checkpoints ...         |
+	.-----------------.--------------------.-------------------------.
+
+ * With each checkpoint being:
+
+	.----------------.--------------------.--------------.-----------.
+	| 8 byte bit     | 8 byte offset      | 4 byte       | window    |
+	| position       | in output          | position     | bytes     |
+	.----------------.--------------------.--------------.-----------.
+
+ * Numbers are stored big endian. */
+#define INDEX_MAGIC "SHRKIDX1"
+#define INDEX_WINDOW_MAX (1ul << 24)
+
+/* Analysis splits the input into windows and works out, for each, how
+ * well the different CODECs might do on it, to help pick which to use
+ * where. Windows are analysed in parallel as blocks are in framed mode.
+ *
+ * 'entropy' is the order-0 entropy in bits per byte, 'runs' the fraction
+ * of bytes the same as the one before, 'matches' the fraction covered by
+ * matches of three or more bytes no further back than the LZSS window (a
+ * greedy parse with one candidate per hash, so it is an estimate), 'lzp'
+ * the fraction of bytes LZP would predict and 'lzss' the size LZSS would
+ * compress to, over the window size. */
+#define ANALYSE_DISTANCE (2048u) /* LZSS window with the default EI */
+#define ANALYSE_LONGEST  (17u)   /* longest LZSS match with the default EJ and P */
+#define ANALYSE_HASH     (1u << 12)
+
+typedef struct {
+	memory_t in;
+	double entropy, runs, matches, lzp, lzss;
+	int r;
+} analysis_t;
+
+static void *analyse_window(void *arg) {
+	assert(arg);
+	analysis_t *a = arg;
+	const unsigned char *b = a->in.b;
+	const size_t n = a->in.length;
+	a->r = -1;
+	if (!n)
+		return NULL;
+	unsigned long counts[256] = { 0, }, runs = 0, matches = 0, hits = 0;
+	size_t *last = calloc(ANALYSE_HASH, sizeof *last); /* position plus one */
+	unsigned char *predict = calloc(1ul << 16, 1);
+	if (!last || !predict)
+		goto end;
+	for (size_t i = 0; i < n; i++) {
+		counts[b[i]]++;
+		runs += i && b[i] == b[i - 1];
+	}
+	for (size_t i = 0; (i + 2u) < n;) {
+		const unsigned h = ((b[i] << 8) ^ (b[i + 1] << 4) ^ b[i + 2]) & (ANALYSE_HASH - 1u);
+		const size_t c = last[h];
+		last[h] = i + 1u;
+		size_t length = 0;
+		if (c && (i - (c - 1u)) <= ANALYSE_DISTANCE)
+			while ((i + length) < n && length < ANALYSE_LONGEST && b[c - 1u + length] == b[i + length])
+				length++;
+		if (length >= 3u) {
+			matches += length;
+			i += length;
+		} else {
+			i++;
+		}
+	}
+	for (size_t i = 0, h = 0; i < n; i++) { /* as in 'shrink_lzp_encode' */
+		hits += predict[h] == b[i];
+		predict[h] = b[i];
+		h = ((h << 4) ^ b[i]) & 0xFFFFu;
+	}
+	a->entropy = 0;
+	for (size_t i = 0; i < 256u; i++)
+		if (counts[i]) {
+			const double p = (double)counts[i] / n;
+			a->entropy -= p * log2(p);
+		}
+	a->runs = (double)runs / n;
+	a->matches = (double)matches / n;
+	a->lzp = (double)hits / n;
+	memory_t m = a->in;
+	m.used = 0;
+	shrink_t io = { .get = memory_get, .put = NULL, .in = &m, }; /* only count the output */
+	if (shrink(&io, CODEC_LZSS, 1) < 0)
+		goto end;
+	a->lzss = (double)io.wrote / n;
+	a->r = 0;
+end:
+	free(last);
+	free(predict);
+	return NULL;
+}
+
+static const char *analyse_flag(const analysis_t *a) {
+	assert(a);
+	if (a->lzss >= 1.0)
+		return a->entropy >= 7.5 ? "compressed" : "incompressible";
+	if (a->runs >= 0.5 || a->matches >= 0.9)
+		return "repetitive";
+	return "-";
+}
+
+static int analyse_op(const size_t window, int threads, int csv, FILE *in, FILE *out) {
+	assert(in);
+	assert(out);
+	if (!thread_safe())
+		threads = 1;
+	const int n = threads < 1 ? 1 : threads > FRAME_THREADS ? FRAME_THREADS : threads;
+	int r = -1;
+	unsigned char *raw = calloc(n, window);
+	analysis_t *as = calloc(n, sizeof *as);
+	if (!raw || !as)
+		goto end;
+	if (fputs(csv ?
+		"offset,length,entropy,runs,matches,lzp,lzss,flag\n" :
+		"offset       length  entropy  runs matches   lzp  lzss flag           heat\n", out) < 0)
+		goto end;
+	unsigned long long offset = 0;
+	for (int eof = 0; !eof;) {
+		int m = 0;
+		for (; m < n && !eof; m++) {
+			const size_t got = fread(raw + (m * window), 1, window, in);
+			eof = got < window;
+			as[m] = (analysis_t) { .in = { .b = raw + (m * window), .length = got, }, };
+			if (!got)
+				break;
+		}
+#if USE_THREADS
+		pthread_t ts[n];
+		int started[n];
+		for (int i = 1; i < m; i++)
+			started[i] = pthread_create(&ts[i], NULL, analyse_window, &as[i]) == 0;
+		if (m)
+			(void)analyse_window(&as[0]);
+		for (int i = 1; i < m; i++)
+			if (started[i])
+				(void)pthread_join(ts[i], NULL);
+			else
+				(void)analyse_window(&as[i]);
+#else
+		for (int i = 0; i < m; i++)
+			(void)analyse_window(&as[i]);
+#endif
+		for (int i = 0; i < m; i++) {
+			const analysis_t *a = &as[i];
+			if (!a->in.length)
+				continue;
+			if (a->r < 0)
+				goto end;
+			char bar[21] = { 0, }; /* the heat map, the longer the bar the more it compresses */
+			const double saved = a->lzss < 1.0 ? 1.0 - a->lzss : 0.0;
+			for (size_t k = 0; k < (sizeof (bar) - 1); k++)
+				bar[k] = k < (size_t)(saved * (sizeof (bar) - 1) + 0.5) ? '#' : '.';
+			const int w = csv ?
+				fprintf(out, "%llu,%lu,%.3f,%.3f,%.3f,%.3f,%.3f,%s\n", offset, (unsigned long)a->in.length,
+					a->entropy, a->runs, a->matches, a->lzp, a->lzss, analyse_flag(a)) :
+				fprintf(out, "0x%010llx %7lu %8.2f %5.2f %7.2f %5.2f %5.2f %-14s %s\n", offset, (unsigned long)a->in.length,
+					a->entropy, a->runs, a->matches, a->lzp, a->lzss, analyse_flag(a), bar);
+			if (w < 0)
+				goto end;
+			offset += a->in.length;
+		}
+	}
+	r = 0;
+end:
+	free(raw);
+	free(as);
+	return r;
+}
+
+static int put_u64(FILE *out, const unsigned long long v) {
+	assert(out);
+	return -(put_u32(out, v >> 32) < 0 || put_u32(out, v & 0xFFFFFFFFul) < 0);
+}
+
+static int get_u64(FILE *in, unsigned long long *v) {
+	assert(in);
+	assert(v);
+	*v = 0;
+	for (int i = 0; i < 8; i++) {
+		const int ch = fgetc(in);
+		if (ch < 0)
+			return -1;
+		*v = (*v << 8) | ch;
+	}
+	return 0;
+}
+
+typedef struct {
+	FILE *out;
+	int header; /* header written? */
+} index_t;
+
+static int index_checkpoint(void *arg, const shrink_checkpoint_t *c) {
+	assert(arg);
+	assert(c);
+	index_t *x = arg;
+	FILE *out = x->out;
+	if (!x->header) {
+		if (fputs(INDEX_MAGIC, out) < 0 || put_u32(out, c->window_length) < 0)
+			return -1;
+		x->header = 1;
+	}
+	if (put_u64(out, c->bit) < 0 || put_u64(out, c->offset) < 0 || put_u32(out, c->position) < 0)
+		return -1;
+	if (fwrite(c->window, 1, c->window_length, out) != c->window_length)
+		return -1;
+	return 0;
+}
+
+static int null_put(const int ch, void *out) {
+	UNUSED(out);
+	return ch;
+}
+
+static int index_op(const int codec, const unsigned long long interval, FILE *in, FILE *out) {
+	assert(in);
+	assert(out);
+	shrink_t io = { .get = file_get, .put = null_put, .in = in, .out = NULL, };
+	index_t x = { .out = out, .header = 0, };
+	return shrink_index(&io, codec, interval, index_checkpoint, &x);
+}
+
+typedef struct {
+	FILE *out;
+	unsigned long long skip, length; /* bytes to skip, then to write */
+} range_t;
+
+static int range_put(const int ch, void *out) {
+	assert(out);
+	range_t *r = out;
+	if (r->skip) {
+		r->skip--;
+		return ch;
+	}
+	if (!r->length)
+		return EOF; /* stops the decoder, we have everything */
+	r->length--;
+	return fputc(ch, r->out);
+}
+
+/* 'out' has to be opened for update, reading from a stream that has been
+ * written to needs a seek in between, which also flushes it. */
+static int file_fetch(void *out, unsigned long long offset, unsigned char *b, size_t length) {
+	assert(out);
+	assert(b);
+	FILE *f = out;
+	if (file_seek_to(f, offset) < 0)
+		return -1;
+	const size_t n = fread(b, 1, length, f);
+	if (fseek(f, 0, SEEK_END) < 0)
+		return -1;
+	return n == length ? 0 : -1;
+}
+
+static int readback_op(const int codec, int verbose, FILE *in, FILE *out) {
+	assert(in);
+	assert(out);
+	shrink_t io = { .get = file_get, .put = file_put, .in = in, .out = out, };
+	const clock_t begin = clock();
+	const int r = shrink_readback(&io, codec, file_fetch);
+	const double time = (double)(clock() - begin) / CLOCKS_PER_SEC;
+	if (!r && verbose)
+		if (stats(&io, codec, 0, 0, time, stderr) < 0)
+			return -1;
+	return r;
+}
+
+/* 'in' is still being read from, so the position is put back afterwards. */
+static int input_fetch(void *in, unsigned long long offset, unsigned char *b, size_t length) {
+	assert(in);
+	assert(b);
+	FILE *f = in;
+	const file_offset_t here = file_tell(f);
+	if (here < 0 || file_seek_to(f, offset) < 0)
+		return -1;
+	const size_t n = fread(b, 1, length, f);
+	if (file_seek(f, here, SEEK_SET) < 0)
+		return -1;
+	return n == length ? 0 : -1;
+}
+
+/* A pre-stage is a separate pass through a temporary file, done before the
+ * CODEC when compressing and after it when decompressing. Long range
+ * matching reads back from 'in' when compressing and 'out' when
+ * decompressing, so that has to be a file. */
+enum { STAGE_NONE, STAGE_LONG, STAGE_WORDS, };
+
+static int stage(shrink_t *io, const int which, const int encode) {
+	assert(io);
+	if (which == STAGE_WORDS)
+		return shrink(io, CODEC_WORDS, encode);
+	return shrink_long(io, encode, encode ? input_fetch : file_fetch);
+}
+
+static int stage_op(int which, int codec, int encode, unsigned options, int verbose, FILE *in, FILE *out) {
+	assert(in);
+	assert(out);
+	FILE *t = tmpfile();
+	if (!t)
+		return -1;
+	shrink_t first = { .get = file_get, .put = file_put, .in = in, .out = t, .options = options, };
+	shrink_t second = { .get = file_get, .put = file_put, .in = t, .out = out, .options = options, };
+	const clock_t begin = clock();
+	int r = encode ? stage(&first, which, 1) : shrink(&first, codec, 0);
+	if (r >= 0 && (fflush(t) < 0 || fseek(t, 0, SEEK_SET) < 0))
+		r = -1;
+	if (r >= 0)
+		r = encode ? shrink(&second, codec, 1) : stage(&second, which, 0);
+	const double time = (double)(clock() - begin) / CLOCKS_PER_SEC;
+	if (fclose(t) < 0)
+		r = -1;
+	if (!r && verbose) {
+		shrink_t total = { .read = first.read, .wrote = second.wrote, };
+		if (fprintf(stderr, "stage: %u bytes between the stages\n", (unsigned)first.wrote) < 0)
+			return -1;
+		if (stats(&total, codec, encode, 0, time, stderr) < 0)
+			return -1;
+	}
+	return r;
+}
+
+/* An asset is written out as C for 'shrink_asset', with the CODEC given as
+ * its name in upper case, 'name' has to be a valid C identifier. */
+typedef struct {
+	FILE *out;
+	size_t column;
+} asset_t;
+
+static int asset_put(const int ch, void *out) {
+	assert(out);
+	asset_t *a = out;
+	if (fprintf(a->out, "%s0x%02x,", (a->column++ % 12u) ? " " : "\n\t", ch) < 0)
+		return -1;
+	return ch;
+}
+
+static int asset_op(const char *name, int codec, unsigned options, int verbose, FILE *in, FILE *out) {
+	assert(name);
+	assert(in);
+	assert(out);
+	for (size_t k = 0; name[k]; k++)
+		if (!(isalpha((unsigned char)name[k]) || name[k] == '_' || (k && isdigit((unsigned char)name[k]))))
+			return -1;
+	if (!codec_enum(codec))
+		return -1;
+	asset_t a = { .out = out, .column = 0, };
+	shrink_t io = { .get = file_get, .put = asset_put, .in = in, .out = &a, .options = options, };
+	if (fprintf(out, "/* generated by 'shrink -E', do not edit */\n#include \"shrink.h\"\n\nstatic const unsigned char %s_data[] = {", name) < 0)
+		return -1;
+	const clock_t begin = clock();
+	if (shrink(&io, codec, 1) < 0)
+		return -1;
+	const double time = (double)(clock() - begin) / CLOCKS_PER_SEC;
+	if (!io.wrote && fputs("\n\t0x00, /* no empty arrays in C */", out) < 0)
+		return -1;
+	if (fprintf(out, "\n};\n\nstatic unsigned char %s_cache[%lu];\n\n", name, (unsigned long)(io.read ? io.read : 1)) < 0)
+		return -1;
+	if (fprintf(out, "shrink_asset_t %s = {\n\t.codec = %s,\n\t.data = %s_data,\n\t.length = %lu,\n\t.cache = %s_cache,\n\t.size = %lu,\n};\n",
+			name, codec_enum(codec), name, (unsigned long)io.wrote, name, (unsigned long)io.read) < 0)
+		return -1;
+	if (verbose)
+		if (stats(&io, codec, 1, 0, time, stderr) < 0)
+			return -1;
+	return 0;
+}
+
+/* Decode 'length' bytes from 'offset' using the last checkpoint in the index
+ * at or before 'offset'. */
+static int range_op(const int codec, const unsigned long long offset, const unsigned long long length, FILE *idx, FILE *in, FILE *out) {
+	assert(idx);
+	assert(in);
+	assert(out);
+	char magic[sizeof (INDEX_MAGIC) - 1];
+	const long window = (fread(magic, 1, sizeof magic, idx) == sizeof magic && !memcmp(magic, INDEX_MAGIC, sizeof magic)) ?
+		get_u32(idx) : -1;
+	if (window <= 0 || (unsigned long)window > INDEX_WINDOW_MAX)
+		return -1;
+	unsigned char *windows = calloc(2, window);
+	if (!windows)
+		return -1;
+	shrink_checkpoint_t best = { .window = NULL, }, c = { .window = NULL, };
+	for (int i = 0;; i ^= 1) { /* 'best' is in one half of 'windows', we read into the other */
+		if (get_u64(idx, &c.bit) < 0 || get_u64(idx, &c.offset) < 0)
+			break;
+		const long position = get_u32(idx);
+		if (position < 0 || position >= window)
+			break;
+		c.position = position;
+		if (fread(&windows[i * window], 1, window, idx) != (size_t)window)
+			break;
+		if (c.offset > offset)
+			break;
+		c.window = &windows[i * window];
+		c.window_length = window;
+		best = c;
+	}
+	int r = -1;
+	if (!best.window)
+		goto end;
+	if (file_seek_to(in, best.bit / 8ull) < 0)
+		goto end;
+	range_t rng = { .out = out, .skip = offset - best.offset, .length = length, };
+	shrink_t io = { .get = file_get, .put = range_put, .in = in, .out = &rng, };
+	r = shrink_seek(&io, codec, &best);
+	if (r < 0 && !rng.length) /* stopped once the range was written */
+		r = 0;
+	if (rng.skip) /* range starts past the end, a short read is fine otherwise */
+		r = -1;
+end:
+	free(windows);
+	return r;
+}
+
+/* Verify mode decompresses the output as it is being produced, on another
+ * thread, and compares a hash and the length of what comes out with that of
+ * the input. Compressed bytes are handed over through a bounded pipe. */
+#define PIPE_SIZE (1ul << 16)
+#define FNV_INIT  (0xcbf29ce484222325ull)
+
+static unsigned long long fnv_update(const unsigned long long h, const uint8_t b) {
+	return (h ^ b) * 0x100000001b3ull;
+}
+
+#if USE_THREADS
+typedef struct {
+	pthread_mutex_t m;
+	pthread_cond_t c;
+	unsigned char b[PIPE_SIZE];
+	size_t head, count;
+	int closed;
+} pipe_t;
+
+typedef struct {
+	FILE *in, *out;
+	pipe_t *pipe;
+	unsigned char staged[4096]; /* bytes not yet in the pipe, or taken from it */
+	size_t used, length;
+	unsigned long long hash_in, hash_out;
+	size_t read, wrote; /* by the decoder */
+} verify_t;
+
+static void pipe_write(pipe_t *p, const unsigned char *b, size_t n) {
+	assert(p);
+	assert(b);
+	pthread_mutex_lock(&p->m);
+	while (n) {
+		while (p->count == PIPE_SIZE)
+			pthread_cond_wait(&p->c, &p->m);
+		for (; n && p->count < PIPE_SIZE; n--, p->count++)
+			p->b[(p->head + p->count) % PIPE_SIZE] = *b++;
+		pthread_cond_broadcast(&p->c);
+	}
+	pthread_mutex_unlock(&p->m);
+}
+
+static size_t pipe_read(pipe_t *p, unsigned char *b, const size_t n) {
+	assert(p);
+	assert(b);
+	size_t i = 0;
+	pthread_mutex_lock(&p->m);
+	while (!p->count && !p->closed)
+		pthread_cond_wait(&p->c, &p->m);
+	for (; i < n && p->count; i++, p->count--, p->head = (p->head + 1) % PIPE_SIZE)
+		b[i] = p->b[p->head];
+	pthread_cond_broadcast(&p->c);
+	pthread_mutex_unlock(&p->m);
+	return i;
+}
+
+static void pipe_close(pipe_t *p) {
+	assert(p);
+	pthread_mutex_lock(&p->m);
+	p->closed = 1;
+	pthread_cond_broadcast(&p->c);
+	pthread_mutex_unlock(&p->m);
+}
+
+static int verify_get(void *in) { /* encoder input */
+	assert(in);
+	verify_t *v = in;
+	const int ch = fgetc(v->in);
+	if (ch >= 0)
+		v->hash_in = fnv_update(v->hash_in, ch);
+	return ch;
+}
+
+static int verify_put(const int ch, void *out) { /* encoder output */
+	assert(out);
+	verify_t *v = out;
+	if (v->used == sizeof v->staged) {
+		pipe_write(v->pipe, v->staged, v->used);
+		v->used = 0;
+	}
+	v->staged[v->used++] = ch;
+	return fputc(ch, v->out);
+}
+
+static int check_get(void *in) { /* decoder input */
+	assert(in);
+	verify_t *v = in;
+	if (v->used == v->length) {
+		v->used = 0;
+		v->length = pipe_read(v->pipe, v->staged, sizeof v->staged);
+		if (!v->length)
+			return EOF;
+	}
+	return v->staged[v->used++];
+}
+
+static int check_put(const int ch, void *out) { /* decoder output */
+	assert(out);
+	verify_t *v = out;
+	v->hash_out = fnv_update(v->hash_out, ch);
+	return ch;
+}
+
+typedef struct {
+	verify_t *v;
+	int codec, r;
+} checker_t;
+
+static void *check_op(void *arg) {
+	assert(arg);
+	checker_t *c = arg;
+	shrink_t io = { .get = check_get, .put = check_put, .in = c->v, .out = c->v, };
+	c->r = shrink(&io, c->codec, 0);
+	c->v->read = io.read;
+	c->v->wrote = io.wrote;
+	while (c->r < 0 && check_get(c->v) >= 0) /* drain the pipe so the encoder does not block */
+		;
+	return NULL;
+}
+
+static int verify_op(int codec, unsigned options, int verbose, FILE *in, FILE *out) {
+	assert(in);
+	assert(out);
+	static pipe_t pipe = { .m = PTHREAD_MUTEX_INITIALIZER, .c = PTHREAD_COND_INITIALIZER, };
+	verify_t encoder = { .in = in, .out = out, .pipe = &pipe, .hash_in = FNV_INIT, };
+	verify_t decoder = { .pipe = &pipe, .hash_out = FNV_INIT, };
+	checker_t checker = { .v = &decoder, .codec = codec, .r = -1, };
+	pthread_t t;
+	if (pthread_create(&t, NULL, check_op, &checker) != 0)
+		return -1;
+	shrink_t io = { .get = verify_get, .put = verify_put, .in = &encoder, .out = &encoder, .options = options, };
+	const clock_t begin = clock();
+	const int r = shrink(&io, codec, 1);
+	pipe_write(&pipe, encoder.staged, encoder.used);
+	pipe_close(&pipe);
+	pthread_join(t, NULL);
+	const clock_t end = clock();
+	const double time = (double)(end - begin) / CLOCKS_PER_SEC;
+	const int ok = r >= 0 && checker.r >= 0 && decoder.wrote == io.read && encoder.hash_in == decoder.hash_out;
+	if (verbose) {
+		if (fprintf(stderr, "verify: %s (in 0x%016llx / out 0x%016llx)\n", ok ? "ok" : "FAILED", encoder.hash_in, decoder.hash_out) < 0)
+			return -1;
+		if (ok && stats(&io, codec, 1, 0, time, stderr) < 0)
+			return -1;
+	}
+	return ok ? 0 : -1;
+}
+#else
+static int verify_op(int codec, unsigned options, int verbose, FILE *in, FILE *out) {
+	UNUSED(codec); UNUSED(options); UNUSED(in); UNUSED(out);
+	if (verbose)
+		(void)fprintf(stderr, "verify: needs thread support unless used with -B\n");
+	return -1;
+}
+#endif
+
 static int dump_hex(FILE *d, const char *o, const unsigned long long l) {
 	assert(d);
 	assert(o);
@@ -246,7 +1293,7 @@ static int usage(FILE *out, const char *arg0) {
 	const int y = (version >>  8) & 0xff;
 	const int z = (version >>  0) & 0xff;
 	static const char *fmt = "\
-usage: %s -[-htdclrezsH] infile? outfile?\n\n\
+usage: %s -[-htdclrezxouFTIfpVnkgWPCsH] [-w#,#,#] [-B#] [-j#] [-i#] [-a#,#] [-E#] [-A#] infile? outfile?\n\n\
 Repository: <https://github.com/howerj/shrink>\n\
 Maintainer: Richard James Howe\n\
 License:    The Unlicense\n\
@@ -266,8 +1313,30 @@ out. Have fun.\n\n\
 \t-l\tuse LZSS\n\
 \t-r\tuse Run Length Encoding\n\
 \t-e\tuse Elias Gamma Encoding\n\
-\t-m\tuse Move-To-Front Encoding\n\
+\t-m\tuse Move-To-Front Encoding, with -r or -e before them in one pass\n\
 \t-z\tuse LZP\n\
+\t-x\tuse extended LZSS, long matches are encoded as one reference\n\
+\t-o\tuse LZSS with repeat offsets, good for records and tables\n\
+\t-u\tuse LZW\n\
+\t-F\tLZW keeps its dictionary once full instead of starting again\n\
+\t-T\tuse the time series CODEC, 64-bit timestamp and double samples\n\
+\t-I\ttime series values are 64-bit integers instead of doubles\n\
+\t-w #,#,#\tuse LZSS with parameters EI,EJ,P given at run time\n\
+\t-B #\tframed mode, compress blocks of # KiB separately\n\
+\t-j #\tframed mode, compress up to # blocks in parallel, at most 256\n\
+\t-p\tframed mode, use previous block as a dictionary (LZSS only)\n\
+\t-i #\tindex LZSS infile, writing a checkpoint every # KiB to outfile\n\
+\t-a #,#\tdecode # bytes at offset # of LZSS infile, index file is first\n\
+\t-A #\tanalyse infile in windows of # KiB, -j # windows at a time\n\
+\t-C\tanalysis is written as CSV instead of a table\n\
+\t-E #\twrite compressed infile as C, an asset called # for shrink_asset\n\
+\t-V\tverify output by decompressing it as it is being compressed, needs outfile, plain and -B only\n\
+\t-k\tdecompress LZSS without a window, reading back from outfile\n\
+\t-g\tfind repeats any distance apart before the CODEC, needs files\n\
+\t-W\treplace common words with a byte before the CODEC, for text\n\
+\t-P\tprint progress every MiB, plain de/compression only\n\
+\t-f\tLZSS compression favors decompression speed over size\n\
+\t-n\tdry run, print the size the output would be without writing it\n\
 \t-H\tadd hash to output, implies -v\n\
 \t-s #\thex dump encoded string instead of file I/O\n\n";
 
@@ -290,28 +1359,117 @@ int main(int argc, char **argv) {
 	binary(stdout);
 	FILE *in = stdin, *out = stdout;
 	int encode = 1, codec = CODEC_LZSS, i = 1, verbose = 0, string = 0, hash = 0;
+	unsigned options = 0, lzss[3] = { 0, }, templated = 0;
+	frame_t frame = { .block = 0, .threads = 1, .prime = 0, };
+	unsigned long kib = 0;
+	unsigned long long index = 0, range[2] = { 0, 0, };
+	int ranged = 0, verify = 0, dry = 0, readback = 0, report = 0, pre = STAGE_NONE;
+	const char *asset = NULL;
+	unsigned long analyse = 0;
+	int csv = 0;
 	for (i = 1; i < argc; i++) {
 		if (argv[i][0] != '-')
 			break;
 		for (int j = 1, ch = 0; (ch = argv[i][j]); j++)
 			switch (ch) {
 			case '-': i++; goto done;
-			case 't': return -shrink_tests();
+			case 't': { const int r = shrink_tests(); return -(r < 0 ? r : shrink_pool_tests()); }
 			case 'h': usage(stderr, argv[0]); return 0;
 			case 'v': verbose++; break;
 			case 'd': encode = 0; break;
 			case 'c': encode = 1; break;
 			case 'l': codec = CODEC_LZSS; break;
-			case 'r': codec = CODEC_RLE; break;
-			case 'e': codec = CODEC_ELIAS; break;
-			case 'm': codec = CODEC_MTF; break;
+			case 'r': codec = codec == CODEC_MTF ? CODEC_MTF_RLE : CODEC_RLE; break;
+			case 'e': codec = codec == CODEC_MTF ? CODEC_MTF_ELIAS : CODEC_ELIAS; break;
+			case 'm': codec = codec == CODEC_RLE ? CODEC_MTF_RLE : codec == CODEC_ELIAS ? CODEC_MTF_ELIAS : CODEC_MTF; break;
 			case 'z': codec = CODEC_LZP; break;
+			case 'x': codec = CODEC_LZSSX; break;
+			case 'o': codec = CODEC_LZSSR; break;
+			case 'u': codec = CODEC_LZW; break;
+			case 'F': options |= SHRINK_OPT_LZW_FREEZE; break;
+			case 'T': codec = CODEC_SERIES; break;
+			case 'I': options |= SHRINK_OPT_SERIES_INT; break;
+			case 'w':
+				if (sscanf(&argv[i][j + 1], "%u,%u,%u", &lzss[0], &lzss[1], &lzss[2]) != 3) {
+					usage(stderr, argv[0]);
+					return 1;
+				}
+				codec = CODEC_LZSS;
+				templated = 1;
+				argv[i][j + 1] = '\0'; /* rest of argument is consumed */
+				break;
+			case 'f': options |= SHRINK_OPT_DECODE_SPEED; break;
+			case 'B':
+				if (sscanf(&argv[i][j + 1], "%lu", &kib) != 1 || !kib || kib > (FRAME_MAX / 1024ul)) {
+					usage(stderr, argv[0]);
+					return 1;
+				}
+				frame.block = kib * 1024ul;
+				argv[i][j + 1] = '\0'; /* rest of argument is consumed */
+				break;
+			case 'j':
+				if (sscanf(&argv[i][j + 1], "%d", &frame.threads) != 1 || frame.threads < 1 || frame.threads > FRAME_THREADS) {
+					usage(stderr, argv[0]);
+					return 1;
+				}
+				argv[i][j + 1] = '\0'; /* rest of argument is consumed */
+				break;
+			case 'p': frame.prime = 1; break;
+			case 'V': verify = 1; frame.verify = 1; break;
+			case 'n': dry = 1; verbose++; break;
+			case 'k': readback = 1; encode = 0; break;
+			case 'g': pre = STAGE_LONG; break;
+			case 'W': pre = STAGE_WORDS; break;
+			case 'P': report = 1; break;
+			case 'i':
+				if (sscanf(&argv[i][j + 1], "%llu", &index) != 1 || !index) {
+					usage(stderr, argv[0]);
+					return 1;
+				}
+				argv[i][j + 1] = '\0'; /* rest of argument is consumed */
+				break;
+			case 'a':
+				if (sscanf(&argv[i][j + 1], "%llu,%llu", &range[0], &range[1]) != 2) {
+					usage(stderr, argv[0]);
+					return 1;
+				}
+				ranged = 1;
+				argv[i][j + 1] = '\0'; /* rest of argument is consumed */
+				break;
+			case 'A':
+				if (sscanf(&argv[i][j + 1], "%lu", &analyse) != 1 || !analyse || analyse > (FRAME_MAX / 1024ul)) {
+					usage(stderr, argv[0]);
+					return 1;
+				}
+				argv[i][j + 1] = '\0'; /* rest of argument is consumed */
+				break;
+			case 'C': csv = 1; break;
+			case 'E':
+				asset = &argv[i][j + 1];
+				if (!*asset) {
+					usage(stderr, argv[0]);
+					return 1;
+				}
+				j += strlen(asset); /* rest of argument is consumed */
+				break;
 			case 's': string = 1; break;
 			case 'H': hash = 1; verbose++; break;
 			default: goto done;
 			}
 	}
 done:
+	if (templated && frame.block) { /* blocks are always de/compressed with the CODEC given */
+		(void)fprintf(stderr, "-w cannot be used in framed mode\n");
+		return 1;
+	}
+	if (verify && encode && (templated || pre != STAGE_NONE || asset || analyse || index || ranged || readback || dry || hash || string)) {
+		(void)fprintf(stderr, "-V cannot be used with -w, -g, -W, -E, -A, -i, -a, -k, -n, -H or -s\n"); /* they would go unverified */
+		return 1;
+	}
+	if (report && (frame.block || verify || pre != STAGE_NONE || asset || analyse || index || ranged || readback)) {
+		(void)fprintf(stderr, "-P cannot be used with -B, -V, -g, -W, -E, -A, -i, -a or -k\n"); /* progress is only reported by plain de/compression */
+		return 1;
+	}
 	if (string) {
 		if (i < argc) {
 			char *s = duplicate(argv[i]);
@@ -331,8 +1489,39 @@ done:
 		return 1;
 	}
 
-	if (i < argc) {  in = fopen_or_die(argv[i++], "rb"); }
-	if (i < argc) { out = fopen_or_die(argv[i++], "wb"); }
+	FILE *idx = NULL;
+	if (ranged) {
+		if (i >= argc) {
+			usage(stderr, argv[0]);
+			return 1;
+		}
+		idx = fopen_or_die(argv[i++], "rb");
+	}
+	const char *inname = NULL;
+	if (i < argc) {  in = fopen_or_die(inname = argv[i++], "rb"); }
+	const char *outname = NULL;
+	char *staged = NULL; /* verified output is written here, and renamed to 'outname' once it has been */
+	if (verify && encode) {
+		if (i >= argc) { /* output written to stdout could not be taken back */
+			(void)fprintf(stderr, "verify: needs an outfile\n");
+			return 1;
+		}
+		const char *name = argv[i];
+		if (!(staged = malloc(strlen(name) + sizeof ".tmp")))
+			return 1;
+		(void)sprintf(staged, "%s.tmp", name);
+	}
+	if (i < argc) { outname = argv[i++]; out = fopen_or_die(staged ? staged : outname, (readback || (pre == STAGE_LONG && !encode)) ? "wb+" : "wb"); }
+	if ((readback || (pre == STAGE_LONG && !encode)) && !outname) { /* must be able to read back from the output */
+		usage(stderr, argv[0]);
+		return 1;
+	}
+	if (pre == STAGE_LONG && encode && !inname) { /* or from the input */
+		usage(stderr, argv[0]);
+		if (staged)
+			(void)remove(staged);
+		return 1;
+	}
 
 	static char inb[BUFSIZ], outb[BUFSIZ];
 	if (setvbuf(in, inb,  _IOFBF, sizeof inb) < 0)
@@ -340,11 +1529,43 @@ done:
 	if (setvbuf(in, outb, _IOFBF, sizeof outb) < 0)
 		return 1;
 
-	const int r = file_op(codec, encode, hash, verbose, in, out);
+	int r = 0;
+	if (idx) {
+		r = range_op(codec, range[0], range[1], idx, in, out);
+		if (fclose(idx) < 0)
+			return 1;
+	} else if (index) {
+		r = index_op(codec, index * 1024ull, in, out);
+	} else if (readback) {
+		r = readback_op(codec, verbose, in, out);
+	} else if (analyse) {
+		r = analyse_op(analyse * 1024ul, frame.threads, csv, in, out);
+	} else if (asset) {
+		r = asset_op(asset, codec, options, verbose, in, out);
+	} else if (pre != STAGE_NONE) {
+		r = stage_op(pre, codec, encode, options, verbose, in, out);
+	} else if (frame.block) {
+		r = frame_op(&frame, codec, encode, options, verbose, in, out);
+	} else if (verify && encode) {
+		r = verify_op(codec, options, verbose, in, out);
+	} else {
+		r = file_op(codec, encode, options, templated ? lzss : NULL, hash, verbose, dry, report, in, out);
+	}
 	if (fclose(in) < 0)
 		return 1;
 	if (fclose(out) < 0)
 		return 1;
+	if (staged) { /* do not leave unverified output around */
+		if (r) {
+			(void)fprintf(stderr, "verification failed, '%s' not written\n", outname);
+			(void)remove(staged);
+		} else if (rename(staged, outname) < 0) {
+			(void)fprintf(stderr, "could not rename '%s' to '%s'\n", staged, outname);
+			(void)remove(staged);
+			r = 1;
+		}
+		free(staged);
+	}
 	return !!r;
 }
 
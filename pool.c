@@ -0,0 +1,398 @@
+/* Project:    Shrink, an LSZZ and RLE compression library
+ * Repository: <https://github.com/howerj/shrink>
+ * Maintainer: Richard James Howe
+ * License:    The Unlicense
+ * Email:      howe.r.j.89@gmail.com
+ *
+ * A pool of worker threads that jobs can be submitted to, so that a caller
+ * does not have to block whilst something is being de/compressed. Unlike
+ * the rest of the library this needs threads and allocates memory, it is
+ * kept in a file of its own so it is only linked in if used. Jobs are run
+ * highest priority first, and first come first served for jobs of the same
+ * priority. When a job is finished its 'complete' callback is called on the
+ * worker thread that ran it, or if there is none, it is put on a queue that
+ * is read with 'shrink_complete', with a byte written to a pipe so that the
+ * read end ('shrink_pool_fd') can be used with 'poll', 'epoll' and the like. */
+#define _POSIX_C_SOURCE 200809L
+#include "shrink.h"
+#include <assert.h>
+#include <stdlib.h>
+
+#ifndef USE_THREADS
+#ifdef _WIN32
+#define USE_THREADS (0)
+#else
+#define USE_THREADS (1)
+#endif
+#endif
+
+enum { JOB_QUEUED = 1, JOB_RUNNING, JOB_FINISHED, JOB_DONE, }; /* FINISHED is on the queue for 'shrink_complete' */
+
+#if USE_THREADS
+#include <poll.h>
+#include <pthread.h>
+#include <unistd.h>
+
+struct shrink_pool {
+	pthread_mutex_t lock;
+	pthread_cond_t work;         /* signalled when a job is queued or on shutdown */
+	shrink_job_t *queue, *done;  /* jobs waiting, highest priority first, and finished jobs */
+	shrink_job_t **last;         /* end of 'done' */
+	int fd[2];                   /* a byte per job on 'done' */
+	int stop, threads;
+	pthread_t thread[];
+};
+
+static void finish(shrink_pool_t *p, shrink_job_t *job, const int result) {
+	assert(p);
+	assert(job);
+	job->result = result;
+	if (job->complete) { /* the job is the callers once it is marked done */
+		if (pthread_mutex_lock(&p->lock) == 0) {
+			job->state = JOB_DONE;
+			(void)pthread_mutex_unlock(&p->lock);
+		}
+		job->complete(job);
+		return;
+	}
+	if (pthread_mutex_lock(&p->lock) != 0)
+		return;
+	job->next = NULL;
+	job->state = JOB_FINISHED;
+	*p->last = job;
+	p->last = &job->next;
+	(void)pthread_mutex_unlock(&p->lock);
+	const char b = 0;
+	(void)write(p->fd[1], &b, 1);
+}
+
+static void *worker(void *arg) {
+	assert(arg);
+	shrink_pool_t *p = arg;
+	for (;;) {
+		if (pthread_mutex_lock(&p->lock) != 0)
+			return NULL;
+		while (!p->stop && !p->queue)
+			(void)pthread_cond_wait(&p->work, &p->lock);
+		if (p->stop) {
+			(void)pthread_mutex_unlock(&p->lock);
+			return NULL;
+		}
+		shrink_job_t *job = p->queue;
+		p->queue = job->next;
+		job->state = JOB_RUNNING;
+		(void)pthread_mutex_unlock(&p->lock);
+		finish(p, job, shrink(&job->io, job->codec, job->encode));
+	}
+}
+
+shrink_pool_t *shrink_pool_create(int threads) {
+	if (threads < 1)
+		return NULL;
+	unsigned long version = 0;
+	if (shrink_version(&version) < 0 || (version & SHRINK_VERSION_STATIC))
+		threads = 1; /* with USE_STATIC 'shrink' shares its state, only one can run at a time */
+	shrink_pool_t *p = calloc(1, sizeof (*p) + (threads * sizeof (p->thread[0])));
+	if (!p)
+		return NULL;
+	p->last = &p->done;
+	p->fd[0] = -1;
+	p->fd[1] = -1;
+	if (pthread_mutex_init(&p->lock, NULL) != 0) {
+		free(p);
+		return NULL;
+	}
+	if (pthread_cond_init(&p->work, NULL) != 0) {
+		(void)pthread_mutex_destroy(&p->lock);
+		free(p);
+		return NULL;
+	}
+	if (pipe(p->fd) < 0) {
+		shrink_pool_destroy(p);
+		return NULL;
+	}
+	for (; p->threads < threads; p->threads++) {
+		if (pthread_create(&p->thread[p->threads], NULL, worker, p) != 0) {
+			shrink_pool_destroy(p);
+			return NULL;
+		}
+	}
+	return p;
+}
+
+void shrink_pool_destroy(shrink_pool_t *p) {
+	if (!p)
+		return;
+	if (pthread_mutex_lock(&p->lock) == 0) {
+		p->stop = 1;
+		(void)pthread_cond_broadcast(&p->work);
+		(void)pthread_mutex_unlock(&p->lock);
+	}
+	for (int i = 0; i < p->threads; i++)
+		(void)pthread_join(p->thread[i], NULL);
+	for (shrink_job_t *job = p->queue, *next = NULL; job; job = next) {
+		next = job->next;
+		finish(p, job, SHRINK_CANCELLED);
+	}
+	p->queue = NULL;
+	for (shrink_job_t *job = p->done; job; job = job->next) /* never collected, they are the callers again */
+		job->state = JOB_DONE;
+	p->done = NULL;
+	if (p->fd[0] >= 0)
+		(void)close(p->fd[0]);
+	if (p->fd[1] >= 0)
+		(void)close(p->fd[1]);
+	(void)pthread_cond_destroy(&p->work);
+	(void)pthread_mutex_destroy(&p->lock);
+	free(p);
+}
+
+int shrink_submit(shrink_pool_t *p, shrink_job_t *job) {
+	assert(p);
+	assert(job);
+	if (pthread_mutex_lock(&p->lock) != 0)
+		return -1;
+	if (job->state == JOB_QUEUED || job->state == JOB_RUNNING || job->state == JOB_FINISHED) { /* the pool is not finished with it */
+		(void)pthread_mutex_unlock(&p->lock);
+		return -1;
+	}
+	shrink_job_t **j = &p->queue;
+	while (*j && (*j)->priority >= job->priority)
+		j = &(*j)->next;
+	job->next = *j;
+	job->state = JOB_QUEUED;
+	job->result = 0;
+	*j = job;
+	(void)pthread_cond_signal(&p->work);
+	(void)pthread_mutex_unlock(&p->lock);
+	return 0;
+}
+
+int shrink_cancel(shrink_pool_t *p, shrink_job_t *job) {
+	assert(p);
+	assert(job);
+	if (pthread_mutex_lock(&p->lock) != 0)
+		return -1;
+	int found = 0;
+	for (shrink_job_t **j = &p->queue; job->state == JOB_QUEUED && *j; j = &(*j)->next)
+		if (*j == job) {
+			*j = job->next;
+			found = 1;
+			break;
+		}
+	(void)pthread_mutex_unlock(&p->lock);
+	if (!found) /* already running or finished */
+		return -1;
+	finish(p, job, SHRINK_CANCELLED);
+	return 0;
+}
+
+shrink_job_t *shrink_complete(shrink_pool_t *p) {
+	assert(p);
+	if (pthread_mutex_lock(&p->lock) != 0)
+		return NULL;
+	shrink_job_t *job = p->done;
+	if (job) {
+		job->state = JOB_DONE;
+		p->done = job->next;
+		if (!p->done)
+			p->last = &p->done;
+	}
+	(void)pthread_mutex_unlock(&p->lock);
+	char b = 0;
+	if (job)
+		(void)read(p->fd[0], &b, 1);
+	return job;
+}
+
+int shrink_pool_fd(shrink_pool_t *p) {
+	assert(p);
+	return p->fd[0];
+}
+
+#ifdef NDEBUG
+int shrink_pool_tests(void) { return 0; }
+#else
+/* The first job is held up in its 'get' callback until the others have been
+ * submitted, so that the order they are run in and cancelling can be
+ * checked with a single worker. */
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t go;
+	int gated;        /* only the first job, which has 'lock' and 'go' */
+	int held, started; /* read and written with 'lock' held */
+	const char *s;
+	size_t used, length;
+	unsigned char out[64];
+	size_t wrote;
+	int order;
+} test_job_t;
+
+static int test_order = 0;
+
+static int test_get(void *in) {
+	test_job_t *t = in;
+	if (t->gated) {
+		(void)pthread_mutex_lock(&t->lock);
+		t->started = 1;
+		(void)pthread_cond_broadcast(&t->go);
+		while (t->held)
+			(void)pthread_cond_wait(&t->go, &t->lock);
+		t->gated = 0;
+		(void)pthread_mutex_unlock(&t->lock);
+	}
+	if (!t->used)
+		t->order = ++test_order; /* only one worker, so this is safe */
+	return t->used < t->length ? (unsigned char)t->s[t->used++] : -1;
+}
+
+static int test_put(const int ch, void *out) {
+	test_job_t *t = out;
+	if (t->wrote >= sizeof (t->out))
+		return -1;
+	return t->out[t->wrote++] = ch;
+}
+
+static void test_complete(shrink_job_t *job) {
+	test_job_t *t = job->arg;
+	t->started = 2;
+}
+
+/* Jobs that are finished but not collected when a pool is destroyed, here
+ * one that ran and one that was cancelled, can be submitted to another. */
+static int test_destroyed(void) {
+	static const char *s = "abcabcabcabcabcabc";
+	test_job_t t[2];
+	shrink_job_t j[2];
+	int r = -1;
+	for (int i = 0; i < 2; i++) {
+		t[i] = (test_job_t) { .gated = i == 0, .held = i == 0, .s = s, .length = 18, };
+		j[i] = (shrink_job_t) {
+			.io = { .get = test_get, .put = test_put, .in = &t[i], .out = &t[i], },
+			.codec = CODEC_LZSS, .encode = 1, .arg = &t[i],
+		};
+	}
+	(void)pthread_mutex_init(&t[0].lock, NULL);
+	(void)pthread_cond_init(&t[0].go, NULL);
+	shrink_pool_t *p = shrink_pool_create(1);
+	if (!p)
+		goto end;
+	if (shrink_submit(p, &j[0]) < 0)
+		goto end;
+	(void)pthread_mutex_lock(&t[0].lock);
+	while (!t[0].started)
+		(void)pthread_cond_wait(&t[0].go, &t[0].lock);
+	(void)pthread_mutex_unlock(&t[0].lock);
+	if (shrink_submit(p, &j[1]) < 0 || shrink_cancel(p, &j[1]) < 0)
+		goto end;
+	(void)pthread_mutex_lock(&t[0].lock);
+	t[0].held = 0;
+	(void)pthread_cond_broadcast(&t[0].go);
+	(void)pthread_mutex_unlock(&t[0].lock);
+	shrink_pool_destroy(p); /* waits for job 0, neither job is collected */
+	if (!(p = shrink_pool_create(1)))
+		goto end;
+	for (int i = 0; i < 2; i++) {
+		t[i].used = 0;
+		t[i].wrote = 0;
+		if (shrink_submit(p, &j[i]) < 0)
+			goto end;
+	}
+	for (int done = 0; done < 2;) {
+		shrink_job_t *c = shrink_complete(p);
+		if (!c) {
+			struct pollfd fd = { .fd = shrink_pool_fd(p), .events = POLLIN, };
+			(void)poll(&fd, 1, -1);
+			continue;
+		}
+		if (c->result < 0)
+			goto end;
+		done++;
+	}
+	r = 0;
+end:
+	(void)pthread_mutex_lock(&t[0].lock);
+	t[0].held = 0;
+	(void)pthread_cond_broadcast(&t[0].go);
+	(void)pthread_mutex_unlock(&t[0].lock);
+	shrink_pool_destroy(p);
+	(void)pthread_cond_destroy(&t[0].go);
+	(void)pthread_mutex_destroy(&t[0].lock);
+	return r;
+}
+
+int shrink_pool_tests(void) {
+	static const char *s = "aaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaaa";
+	test_job_t t[4];
+	shrink_job_t j[4];
+	int r = -1;
+	shrink_pool_t *p = shrink_pool_create(1);
+	if (!p)
+		return -1;
+	test_order = 0;
+	for (int i = 0; i < 4; i++) {
+		t[i] = (test_job_t) { .gated = i == 0, .held = i == 0, .s = s, .length = 48, };
+		j[i] = (shrink_job_t) {
+			.io = { .get = test_get, .put = test_put, .in = &t[i], .out = &t[i], },
+			.codec = CODEC_LZSS, .encode = 1, .priority = i, .arg = &t[i],
+			.complete = i == 3 ? test_complete : NULL,
+		};
+	}
+	(void)pthread_mutex_init(&t[0].lock, NULL);
+	(void)pthread_cond_init(&t[0].go, NULL);
+	if (shrink_submit(p, &j[0]) < 0)
+		goto end;
+	(void)pthread_mutex_lock(&t[0].lock);
+	while (!t[0].started)
+		(void)pthread_cond_wait(&t[0].go, &t[0].lock);
+	(void)pthread_mutex_unlock(&t[0].lock);
+	for (int i = 1; i < 4; i++)
+		if (shrink_submit(p, &j[i]) < 0)
+			goto end;
+	if (shrink_submit(p, &j[1]) == 0) /* queued already */
+		goto end;
+	if (shrink_cancel(p, &j[0]) == 0) /* running, cannot be cancelled */
+		goto end;
+	if (shrink_cancel(p, &j[2]) < 0 || j[2].result != SHRINK_CANCELLED || shrink_complete(p) != &j[2])
+		goto end;
+	(void)pthread_mutex_lock(&t[0].lock);
+	t[0].held = 0;
+	(void)pthread_cond_broadcast(&t[0].go);
+	(void)pthread_mutex_unlock(&t[0].lock);
+	for (int done = 0; done < 2;) { /* jobs 0 and 1 use the queue */
+		shrink_job_t *c = shrink_complete(p);
+		if (!c) {
+			struct pollfd fd = { .fd = shrink_pool_fd(p), .events = POLLIN, };
+			(void)poll(&fd, 1, -1);
+			continue;
+		}
+		if (c != &j[0] && c != &j[1])
+			goto end;
+		if (c->result < 0)
+			goto end;
+		done++;
+	}
+	if (t[0].order != 1 || t[3].order != 2 || t[1].order != 3) /* by priority */
+		goto end;
+	r = 0;
+end:
+	shrink_pool_destroy(p); /* job 3 has finished by the time job 1 has */
+	if (r == 0 && (t[3].started != 2 || j[3].result < 0))
+		r = -1;
+	for (int i = 0; i < 4 && r == 0; i++)
+		if (i != 2 && (t[i].wrote == 0 || t[i].wrote >= t[i].length))
+			r = -1;
+	(void)pthread_cond_destroy(&t[0].go);
+	(void)pthread_mutex_destroy(&t[0].lock);
+	return r < 0 ? r : test_destroyed();
+}
+#endif
+#else
+shrink_pool_t *shrink_pool_create(const int threads) { (void)threads; return NULL; }
+void shrink_pool_destroy(shrink_pool_t *p) { (void)p; }
+int shrink_submit(shrink_pool_t *p, shrink_job_t *job) { (void)p; (void)job; return -1; }
+int shrink_cancel(shrink_pool_t *p, shrink_job_t *job) { (void)p; (void)job; return -1; }
+shrink_job_t *shrink_complete(shrink_pool_t *p) { (void)p; return NULL; }
+int shrink_pool_fd(shrink_pool_t *p) { (void)p; return -1; }
+int shrink_pool_tests(void) { return 0; }
+#endif
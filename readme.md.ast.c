@@ -0,0 +1,1719 @@
+/* generated by 'shrink -E', do not edit */
+#include "shrink.h"
+
+static const unsigned char asset_data[] = {
+	0x04, 0x80, 0x25, 0x20, 0x73, 0x68, 0x72, 0x69, 0x6e, 0x6b, 0x28, 0x31,
+	0x29, 0x20, 0x7c, 0x20, 0x43, 0x6f, 0x6d, 0x70, 0x72, 0x65, 0x73, 0x73,
+	0x69, 0x6f, 0x6e, 0x20, 0x70, 0x72, 0x6f, 0x67, 0x72, 0x61, 0x6d, 0x0a,
+	0x0a, 0x23, 0x20, 0x4e, 0x41, 0x4d, 0x45, 0x0a, 0x0a, 0x53, 0x48, 0x52,
+	0x49, 0x4e, 0x4b, 0x20, 0x2d, 0x20, 0x41, 0x6e, 0x20, 0x69, 0x6e, 0x74,
+	0x65, 0x72, 0x66, 0x61, 0x63, 0x65, 0x20, 0x74, 0x6f, 0x20, 0x74, 0x68,
+	0x65, 0x20, 0x53, 0x7f, 0x23, 0x7f, 0xcb, 0xa6, 0x5a, 0x6c, 0x57, 0x2b,
+	0x0d, 0xca, 0xf2, 0x02, 0x05, 0x53, 0xac, 0xd3, 0xa9, 0xf5, 0x0a, 0x9d,
+	0x16, 0xa7, 0x0a, 0x85, 0x42, 0x5f, 0xc5, 0x24, 0x12, 0xdb, 0x40, 0x2e,
+	0xc0, 0x0f, 0x00, 0x5b, 0x2d, 0x6c, 0x72, 0x76, 0x65, 0x6d, 0x7a, 0x78,
+	0x6f, 0x66, 0x6e, 0x5d, 0x20, 0x2d, 0x63, 0x20, 0x5b, 0x69, 0x6e, 0x2e,
+	0x66, 0x69, 0x6c, 0x65, 0x5d, 0x20, 0x5b, 0x6f, 0x75, 0x74, 0x08, 0x74,
+	0x06, 0x9f, 0xc0, 0x3f, 0x8d, 0x90, 0x20, 0xff, 0xc6, 0x14, 0xeb, 0x73,
+	0xba, 0x3f, 0x98, 0xd9, 0xc0, 0x40, 0xa8, 0x94, 0x5a, 0x9d, 0x0e, 0xa5,
+	0x49, 0xa8, 0x55, 0x29, 0x34, 0xfa, 0x70, 0x2e, 0x8d, 0x42, 0xe5, 0x6f,
+	0xb5, 0x59, 0x6c, 0x77, 0x49, 0xd0, 0x85, 0x98, 0x1b, 0xa4, 0xea, 0x41,
+	0x53, 0xb6, 0xd8, 0x6d, 0x96, 0xc0, 0x3d, 0xfc, 0xc2, 0x69, 0xb6, 0x10,
+	0x26, 0x11, 0x23, 0x1b, 0x2d, 0xc8, 0x3e, 0x44, 0x06, 0x80, 0x52, 0x69,
+	0x63, 0x68, 0x61, 0x72, 0x64, 0x20, 0x4a, 0x61, 0x6d, 0x65, 0x73, 0x20,
+	0x48, 0x6f, 0x77, 0x65, 0x0a, 0x09, 0x4c, 0x69, 0x63, 0x65, 0x6e, 0x73,
+	0x65, 0x0f, 0x94, 0xaa, 0x01, 0xa0, 0xd5, 0x6d, 0xd6, 0xc1, 0x44, 0x48,
+	0x54, 0x26, 0x8b, 0x6d, 0xb0, 0xda, 0x6d, 0x81, 0xf2, 0x92, 0x09, 0x05,
+	0xa0, 0x4f, 0x86, 0x5d, 0x72, 0x97, 0x5a, 0xa5, 0xd3, 0x89, 0xcd, 0x02,
+	0xce, 0x2c, 0x05, 0x2e, 0xb1, 0xdb, 0xed, 0xb0, 0xa8, 0x4d, 0x5e, 0xcb,
+	0x62, 0xb9, 0xda, 0x6e, 0x82, 0x92, 0xb3, 0xcb, 0x45, 0xd2, 0xe9, 0x70,
+	0xb9, 0xce, 0xa5, 0xf2, 0xfb, 0x3d, 0xa6, 0xe9, 0x68, 0xba, 0xd8, 0x85,
+	0xf4, 0xa5, 0xe2, 0xd8, 0x57, 0x2b, 0x54, 0xbd, 0xfc, 0x52, 0x7d, 0x0a,
+	0x85, 0x42, 0xaa, 0x96, 0x8b, 0x4d, 0xcc, 0x02, 0x08, 0x3d, 0x48, 0x02,
+	0x0a, 0xed, 0x69, 0xb2, 0x09, 0xd0, 0xd6, 0xe9, 0x95, 0xaa, 0x9d, 0x4e,
+	0xbb, 0x5b, 0xae, 0xcb, 0x07, 0x28, 0xaa, 0x03, 0xa0, 0x76, 0x1b, 0x70,
+	0x57, 0x8d, 0x4a, 0x99, 0x45, 0x1d, 0x01, 0x90, 0x0b, 0xf0, 0x80, 0x03,
+	0xdc, 0x82, 0x3c, 0x44, 0xa0, 0x6e, 0x72, 0xc9, 0x05, 0xba, 0xca, 0x33,
+	0x43, 0x65, 0xb9, 0x48, 0x2d, 0xf6, 0x69, 0x04, 0x2a, 0xef, 0x68, 0x13,
+	0x01, 0x90, 0x59, 0x2d, 0xe3, 0xba, 0x37, 0x99, 0x00, 0x84, 0x8d, 0xbe,
+	0xc7, 0x61, 0xba, 0x00, 0x29, 0x01, 0x31, 0xdb, 0x84, 0x24, 0x48, 0x5c,
+	0x6e, 0x16, 0x1b, 0x95, 0xd2, 0x41, 0x66, 0xb9, 0x5b, 0xed, 0xb2, 0x00,
+	0x06, 0x10, 0x33, 0x2b, 0x9d, 0xd2, 0xc3, 0x63, 0xb5, 0xcb, 0xa4, 0x03,
+	0x66, 0x56, 0x51, 0xb9, 0xf8, 0x06, 0x64, 0x3e, 0xcd, 0x20, 0xb0, 0x93,
+	0x50, 0xc8, 0x2d, 0x80, 0x96, 0xa3, 0xbc, 0x44, 0xd8, 0x63, 0xf0, 0x36,
+	0xcb, 0x4d, 0xd2, 0xf2, 0x01, 0x0d, 0x2e, 0x14, 0xf3, 0x27, 0x15, 0x90,
+	0x0d, 0xb8, 0xdc, 0xee, 0xb6, 0x9b, 0xa5, 0x86, 0xc5, 0x6c, 0xb2, 0xc8,
+	0x2c, 0xd6, 0xfb, 0x90, 0x12, 0x8d, 0x8e, 0xd9, 0x75, 0x00, 0x43, 0xb4,
+	0xdb, 0x87, 0x74, 0x61, 0x55, 0xbb, 0x2d, 0xb6, 0xc5, 0x65, 0xb2, 0x59,
+	0x2c, 0xb6, 0x41, 0xe6, 0x21, 0xba, 0x62, 0xac, 0x10, 0x09, 0x1b, 0x25,
+	0xd6, 0xc7, 0x74, 0x97, 0x48, 0x29, 0xe4, 0x06, 0x74, 0x3a, 0x7d, 0x12,
+	0x8b, 0x43, 0xb9, 0xc8, 0x2d, 0x16, 0x1b, 0xb5, 0x96, 0x41, 0x62, 0xb2,
+	0xd9, 0x4a, 0xe8, 0x4b, 0x10, 0xa5, 0x92, 0x0b, 0x9d, 0xbe, 0xdb, 0x65,
+	0x85, 0x59, 0x6f, 0x17, 0x0b, 0x2d, 0xca, 0xd3, 0x6d, 0xb2, 0x89, 0x28,
+	0xdb, 0x0b, 0xf0, 0x6e, 0xa4, 0x1e, 0x24, 0xd8, 0x35, 0xba, 0x6d, 0xbe,
+	0xed, 0x65, 0x96, 0xd5, 0x2d, 0xf2, 0xda, 0x35, 0xca, 0xdf, 0x6e, 0xba,
+	0x0f, 0x31, 0x4a, 0x2d, 0xb6, 0x5b, 0x0d, 0xba, 0xe8, 0x4d, 0x66, 0x57,
+	0x43, 0x69, 0xb2, 0x01, 0x79, 0x5b, 0xcb, 0x86, 0x65, 0x23, 0xba, 0x50,
+	0xaa, 0xdd, 0x16, 0xd9, 0x69, 0xb0, 0xdc, 0xe5, 0xb4, 0x7b, 0x0d, 0xb6,
+	0xdb, 0x61, 0x1e, 0x62, 0xb2, 0xdb, 0xac, 0x76, 0xfb, 0x20, 0x6e, 0x8c,
+	0xb8, 0x04, 0x0a, 0x9e, 0x1d, 0x46, 0x0b, 0x83, 0x46, 0x08, 0x91, 0x90,
+	0x59, 0x2c, 0xb2, 0xf1, 0xea, 0xa2, 0x82, 0x59, 0x61, 0xbd, 0x8d, 0x9a,
+	0xc3, 0x75, 0xb6, 0x5d, 0x0a, 0x78, 0x87, 0xa9, 0xa4, 0x17, 0x71, 0x9a,
+	0x19, 0x00, 0xe6, 0x14, 0xb2, 0x41, 0x63, 0x33, 0x51, 0xba, 0xdc, 0xec,
+	0xb2, 0x01, 0xe3, 0x19, 0x74, 0x82, 0x93, 0x66, 0x85, 0x48, 0x82, 0x3d,
+	0xa4, 0x45, 0x3c, 0x56, 0xeb, 0x7d, 0xd2, 0x41, 0x67, 0xb4, 0xdd, 0x8b,
+	0xd0, 0x42, 0x3c, 0x6e, 0x17, 0x53, 0x9a, 0x3b, 0xbd, 0xca, 0xd3, 0x74,
+	0xba, 0x17, 0xa0, 0x81, 0x80, 0x92, 0x08, 0xdb, 0xac, 0x82, 0x66, 0x41,
+	0x1e, 0x32, 0xc9, 0x05, 0xa6, 0xcd, 0x20, 0x91, 0x04, 0x2a, 0xc8, 0x8d,
+	0x30, 0xcf, 0x0e, 0x6c, 0x37, 0x2b, 0x29, 0xe8, 0x4d, 0xa6, 0xdc, 0x7b,
+	0xcb, 0x74, 0xb0, 0xda, 0xcb, 0xd0, 0x48, 0xd4, 0xcf, 0xc1, 0xca, 0xe4,
+	0xcf, 0xdc, 0xcf, 0x78, 0x8f, 0xb6, 0x61, 0x41, 0x1e, 0x50, 0xa8, 0x54,
+	0xaa, 0x41, 0x2d, 0x96, 0x86, 0xc8, 0xdb, 0xee, 0x00, 0x10, 0x56, 0x30,
+	0x02, 0x2b, 0x75, 0x9d, 0x06, 0x46, 0xcf, 0x75, 0x30, 0x92, 0xb9, 0xa3,
+	0x21, 0x5d, 0x24, 0x17, 0x2b, 0xad, 0xba, 0x41, 0x62, 0xba, 0xda, 0x4e,
+	0x64, 0xad, 0xd2, 0x0b, 0x9d, 0x96, 0xd9, 0x66, 0x90, 0x5d, 0x2c, 0xb7,
+	0x3b, 0xa0, 0xfe, 0x8d, 0xea, 0xcb, 0x72, 0xb7, 0x94, 0xf1, 0x5c, 0x2c,
+	0x37, 0x34, 0x82, 0x3b, 0x40, 0x04, 0x08, 0x13, 0x0c, 0x82, 0xd1, 0x65,
+	0xb6, 0x5c, 0x07, 0x74, 0xec, 0xb7, 0x8b, 0x4d, 0xd1, 0x19, 0x0a, 0xed,
+	0x20, 0xbb, 0x59, 0x6e, 0x56, 0x2b, 0x78, 0xad, 0x8a, 0x32, 0x8d, 0x8c,
+	0x7a, 0x5d, 0x19, 0x0a, 0xc8, 0x6f, 0x62, 0x9b, 0x55, 0x6c, 0x3b, 0x63,
+	0x1c, 0xc2, 0x46, 0x42, 0xb9, 0x1d, 0xb2, 0x24, 0x50, 0xd3, 0x2c, 0xb6,
+	0xeb, 0x39, 0xd5, 0x0d, 0x14, 0xd8, 0x95, 0x19, 0x0a, 0xca, 0x76, 0xc6,
+	0x6a, 0x52, 0xa2, 0x97, 0x7a, 0x4f, 0x75, 0xa8, 0x23, 0x21, 0x5b, 0x4e,
+	0xd8, 0xcc, 0x6a, 0xd4, 0x51, 0xe5, 0x87, 0x4e, 0x8a, 0x06, 0x25, 0x58,
+	0x2a, 0x40, 0x36, 0x2b, 0x29, 0x55, 0x88, 0x17, 0x0d, 0xa2, 0xcb, 0x6d,
+	0x2b, 0x82, 0xb7, 0xdb, 0x89, 0x30, 0x52, 0xad, 0x6f, 0x07, 0x6c, 0x76,
+	0x5b, 0xc1, 0xf4, 0x89, 0x62, 0x89, 0xd6, 0x2d, 0xb2, 0xde, 0x8e, 0xe3,
+	0x6d, 0xb0, 0xdd, 0x2c, 0x76, 0x82, 0x69, 0x24, 0x1b, 0x13, 0x61, 0x35,
+	0x9f, 0x12, 0x6c, 0x15, 0x87, 0x2b, 0x95, 0x96, 0xcd, 0x65, 0xb9, 0x1b,
+	0x08, 0xa6, 0x99, 0xdd, 0x53, 0xdd, 0x6a, 0xe8, 0xc8, 0x54, 0x65, 0xda,
+	0x29, 0x05, 0xae, 0xcb, 0x65, 0xb8, 0x5c, 0xe4, 0x16, 0x9b, 0xa5, 0xce,
+	0x41, 0x64, 0xb4, 0xd8, 0xc8, 0x7c, 0x8a, 0x6c, 0xad, 0xeb, 0x9c, 0x32,
+	0x0b, 0x35, 0xd4, 0x42, 0x86, 0xd3, 0x6e, 0xb9, 0xdd, 0x2c, 0xb6, 0x13,
+	0xf7, 0x1b, 0x31, 0x20, 0x15, 0xc8, 0x7e, 0x45, 0x1e, 0x06, 0xce, 0x24,
+	0x62, 0x8c, 0x85, 0x54, 0x3b, 0x63, 0x03, 0x32, 0xba, 0x18, 0x40, 0xa4,
+	0xa8, 0xdc, 0xad, 0x22, 0x74, 0x25, 0xcc, 0x72, 0xc9, 0x04, 0xda, 0x69,
+	0x2d, 0xb1, 0x5a, 0x51, 0x44, 0x4c, 0x20, 0x49, 0x04, 0x6d, 0xa9, 0x7a,
+	0x96, 0x4b, 0x7d, 0xd4, 0xa9, 0xca, 0xe6, 0xc9, 0xc3, 0x6c, 0xb2, 0xa4,
+	0x11, 0xd2, 0x58, 0xb6, 0xee, 0xd6, 0x1b, 0x65, 0xd5, 0x6c, 0x95, 0x90,
+	0x54, 0x09, 0x8a, 0xcf, 0x65, 0xb9, 0x2f, 0x60, 0xb0, 0x44, 0x32, 0xb2,
+	0x24, 0x11, 0xdb, 0xd3, 0xdd, 0xce, 0x9d, 0x2e, 0x56, 0x5b, 0x85, 0x96,
+	0xc2, 0x5a, 0x43, 0x66, 0xb3, 0x5c, 0xec, 0xa9, 0x3c, 0x56, 0x7b, 0x7d,
+	0xbe, 0xc8, 0x55, 0x47, 0x72, 0x4e, 0x91, 0xb9, 0x59, 0x0c, 0xcc, 0x8c,
+	0xe8, 0x4a, 0x98, 0x92, 0x08, 0xee, 0xf2, 0x09, 0x1c, 0xb1, 0xba, 0x05,
+	0xaa, 0x34, 0x8c, 0x04, 0x4e, 0x04, 0x0a, 0x06, 0xe7, 0x20, 0xa2, 0xd2,
+	0x65, 0x94, 0x5a, 0x54, 0xb2, 0xa0, 0x7a, 0x8a, 0xd7, 0x62, 0x91, 0x24,
+	0xc5, 0xc7, 0x28, 0xb2, 0xd9, 0xe5, 0xcd, 0xc8, 0x33, 0x19, 0x94, 0xb2,
+	0x69, 0x2c, 0x99, 0x4a, 0x51, 0x90, 0xa8, 0x52, 0x09, 0x19, 0x1a, 0x08,
+	0x9c, 0x0d, 0x92, 0x41, 0x6d, 0x5b, 0xc1, 0x3b, 0x11, 0x3a, 0x06, 0xb1,
+	0x10, 0xd8, 0xda, 0xd7, 0x08, 0x6c, 0xce, 0x68, 0x34, 0xbb, 0x4d, 0x09,
+	0x25, 0x45, 0xbf, 0x0a, 0xe9, 0x65, 0x22, 0xc1, 0x72, 0x14, 0xa1, 0x4d,
+	0xa6, 0x8e, 0x5c, 0x76, 0xa7, 0x34, 0xfe, 0x37, 0x5b, 0x80, 0x17, 0x94,
+	0x8d, 0xd3, 0x18, 0xae, 0x45, 0xbf, 0x0a, 0xd9, 0x6c, 0xb2, 0x98, 0x70,
+	0xb5, 0xd8, 0xdb, 0x6d, 0xf7, 0x3b, 0xa4, 0x82, 0x65, 0x35, 0x9b, 0x39,
+	0x02, 0xda, 0xa7, 0x0e, 0x5c, 0x77, 0x07, 0x36, 0xc3, 0xb7, 0x20, 0x00,
+	0x1b, 0xb5, 0xa6, 0xdf, 0x75, 0x74, 0xb5, 0x26, 0xb4, 0x5f, 0x29, 0x94,
+	0x35, 0x69, 0xdb, 0xed, 0xd6, 0xcb, 0xcb, 0x97, 0x1d, 0xa5, 0xcd, 0x06,
+	0xd2, 0xb3, 0xa3, 0x78, 0x6a, 0xc4, 0xb4, 0xdb, 0x82, 0x20, 0x95, 0xa0,
+	0x4f, 0x98, 0x51, 0xd8, 0xe4, 0x0b, 0x60, 0x36, 0x3b, 0x5d, 0xc2, 0xde,
+	0x96, 0xc5, 0x65, 0x4c, 0xd1, 0xbc, 0xba, 0xb2, 0x99, 0xe1, 0x5d, 0x6e,
+	0x81, 0x10, 0x48, 0xc8, 0x56, 0x16, 0xe7, 0x24, 0xe7, 0x3b, 0x25, 0x95,
+	0xe5, 0x4a, 0xf2, 0x93, 0x62, 0xe2, 0x84, 0xd7, 0xc8, 0xe6, 0x82, 0x41,
+	0x02, 0x02, 0x16, 0x01, 0x48, 0x16, 0xa4, 0x53, 0xc5, 0x66, 0xb4, 0xdc,
+	0xae, 0x69, 0x8c, 0x74, 0x57, 0x34, 0x13, 0xe5, 0x2b, 0x28, 0xf4, 0xba,
+	0xcf, 0x88, 0x0a, 0xa1, 0x35, 0x93, 0x1f, 0x09, 0x9a, 0x90, 0x52, 0x0d,
+	0xd0, 0xec, 0x85, 0xe9, 0x86, 0xc8, 0xe6, 0x84, 0x55, 0x82, 0x35, 0x69,
+	0x5c, 0xaf, 0x85, 0xca, 0x39, 0x0a, 0x51, 0x52, 0xe8, 0x9c, 0xb8, 0xe8,
+	0x2e, 0x68, 0x29, 0x68, 0xb6, 0xfb, 0xb8, 0xf4, 0xc1, 0x53, 0x95, 0x96,
+	0xc2, 0x41, 0xe2, 0xea, 0xe8, 0x41, 0x02, 0x15, 0x2b, 0x69, 0x1f, 0xd1,
+	0x77, 0x53, 0xbb, 0x80, 0x50, 0xdb, 0xee, 0xe0, 0xbe, 0x76, 0x16, 0x2d,
+	0x34, 0x64, 0x2a, 0x1a, 0x59, 0xa9, 0x1e, 0x95, 0x84, 0x8a, 0x46, 0xf3,
+	0x73, 0x08, 0x82, 0x23, 0x62, 0x0e, 0x91, 0x0b, 0x02, 0xa9, 0xd5, 0x98,
+	0x1a, 0x84, 0xb8, 0x4a, 0x98, 0x91, 0x90, 0xaa, 0xc9, 0x98, 0x56, 0x9b,
+	0x32, 0xfd, 0x89, 0xee, 0x25, 0x8a, 0xf2, 0x9c, 0xf2, 0x8e, 0xc4, 0xc8,
+	0xa2, 0x4d, 0x82, 0xd0, 0xa4, 0xe9, 0x63, 0x65, 0x47, 0x62, 0x09, 0xe8,
+	0x1f, 0xe2, 0xb2, 0xb6, 0xa8, 0x82, 0x0a, 0xcb, 0x24, 0x17, 0x0b, 0x63,
+	0x0e, 0x88, 0xee, 0x9b, 0x99, 0x0b, 0xfe, 0x92, 0x32, 0x15, 0xad, 0x39,
+	0xe5, 0xab, 0x20, 0x99, 0x04, 0x9b, 0x84, 0x48, 0xd2, 0x58, 0xb8, 0xe3,
+	0x61, 0x36, 0x52, 0x90, 0x58, 0x89, 0x0c, 0x48, 0xd1, 0x41, 0x0a, 0x2c,
+	0xe1, 0x04, 0x24, 0xf4, 0x2d, 0x6e, 0x86, 0x66, 0x43, 0x06, 0x36, 0x93,
+	0xf0, 0x25, 0xff, 0x1b, 0x0b, 0x7e, 0x08, 0xc0, 0x0a, 0xbc, 0xbb, 0x1c,
+	0xb0, 0xd8, 0xa1, 0xe4, 0x12, 0x41, 0x1d, 0x5d, 0xad, 0x8a, 0xd9, 0x61,
+	0x5f, 0xf1, 0x37, 0xf1, 0xb6, 0x95, 0xb0, 0xdd, 0xdb, 0x4c, 0xce, 0xa0,
+	0xec, 0x20, 0xb4, 0x64, 0x6f, 0xf4, 0xaa, 0xca, 0xe8, 0xb3, 0x22, 0x8c,
+	0x85, 0x50, 0x4b, 0x35, 0x2c, 0xc1, 0xb3, 0x9d, 0x19, 0x81, 0x92, 0x53,
+	0x6d, 0x34, 0x21, 0xbe, 0x63, 0x7c, 0xd1, 0xcd, 0x60, 0x6e, 0x53, 0x7f,
+	0xab, 0x35, 0x86, 0xed, 0x6f, 0x68, 0xe1, 0x18, 0x59, 0x38, 0x81, 0xb9,
+	0xdc, 0x06, 0xc8, 0x64, 0x06, 0x36, 0x21, 0x94, 0x36, 0x9b, 0xd2, 0x69,
+	0x99, 0x5d, 0x0a, 0xfd, 0x0a, 0x44, 0x88, 0xdf, 0x08, 0x9d, 0xb9, 0x83,
+	0x13, 0x14, 0x99, 0xed, 0xad, 0xde, 0xdf, 0x75, 0xb6, 0x59, 0x15, 0xdc,
+	0x47, 0x99, 0xc0, 0x75, 0x93, 0x15, 0x29, 0x12, 0x0b, 0x0d, 0x92, 0xc9,
+	0x20, 0xb4, 0x58, 0x6e, 0x76, 0x80, 0x3d, 0x53, 0xde, 0x13, 0xfc, 0x16,
+	0x5f, 0x16, 0x36, 0x29, 0x6d, 0xd9, 0x19, 0x0a, 0xe6, 0xe6, 0x83, 0x68,
+	0x00, 0xd1, 0xb2, 0x5d, 0x59, 0x3c, 0x56, 0xe5, 0xae, 0x77, 0x44, 0xb5,
+	0x11, 0x91, 0x16, 0x08, 0x80, 0x83, 0x3a, 0x4c, 0xbe, 0x9f, 0x0a, 0x85,
+	0x48, 0xe4, 0x15, 0x2a, 0x2d, 0x52, 0xab, 0x52, 0xa7, 0x31, 0xc9, 0xc2,
+	0xa1, 0x55, 0x4b, 0x42, 0x53, 0x91, 0x51, 0x95, 0x86, 0xda, 0xb8, 0xe3,
+	0x74, 0xba, 0xdc, 0xad, 0xd7, 0x34, 0xa1, 0x42, 0xf8, 0x2b, 0xad, 0x8d,
+	0x1c, 0x89, 0x11, 0xce, 0xdd, 0x6f, 0xb7, 0x4b, 0x4f, 0x2d, 0xac, 0xd6,
+	0x1b, 0x4d, 0xb2, 0xeb, 0x72, 0xb2, 0xa3, 0x10, 0xc8, 0xe4, 0x14, 0x2a,
+	0xad, 0x26, 0x99, 0x44, 0xa4, 0xd3, 0xa8, 0xf0, 0xa8, 0x55, 0x66, 0xdf,
+	0x75, 0x56, 0x91, 0x60, 0x41, 0x1b, 0x12, 0x90, 0x56, 0xe8, 0xf4, 0xea,
+	0xac, 0x82, 0x9a, 0x86, 0x43, 0x5d, 0xad, 0xd7, 0x5e, 0xa8, 0x64, 0x15,
+	0xba, 0x1a, 0x0c, 0x0a, 0x6c, 0x98, 0x0c, 0x09, 0x48, 0x0d, 0xa1, 0xae,
+	0xc5, 0x29, 0xc6, 0xc6, 0x46, 0x42, 0xcb, 0x24, 0xc1, 0xe2, 0x84, 0xa8,
+	0xa3, 0x45, 0x5b, 0xa1, 0xce, 0x67, 0x28, 0x42, 0x49, 0x7e, 0x56, 0x19,
+	0x05, 0x0e, 0x57, 0x2b, 0x42, 0x48, 0x43, 0x6f, 0xc2, 0x2c, 0x14, 0xc6,
+	0x69, 0x2e, 0x90, 0x55, 0x2f, 0x37, 0x0b, 0x2c, 0xea, 0x15, 0x0a, 0x84,
+	0xdb, 0x50, 0x54, 0x4e, 0xd1, 0x50, 0x14, 0xec, 0x57, 0x5b, 0x49, 0x9b,
+	0x0d, 0x86, 0x41, 0x6c, 0xb4, 0xd8, 0xae, 0x4f, 0xe6, 0x72, 0x74, 0xa2,
+	0x10, 0xcc, 0x49, 0x75, 0x86, 0x4f, 0x29, 0x45, 0x24, 0xb7, 0x2c, 0xc0,
+	0xd9, 0x6c, 0x77, 0x56, 0xdc, 0x34, 0xa9, 0x10, 0xcc, 0x49, 0x3c, 0xb1,
+	0x5c, 0x46, 0x14, 0x99, 0xab, 0x2e, 0x4c, 0x11, 0x93, 0x9e, 0x79, 0x55,
+	0xc4, 0x91, 0x25, 0x27, 0xe4, 0x35, 0x4b, 0x7a, 0x60, 0x28, 0x57, 0x0b,
+	0x19, 0x33, 0x07, 0x88, 0x2e, 0x8a, 0xf7, 0x8c, 0xa2, 0xe8, 0x92, 0x2f,
+	0x72, 0xb2, 0xdc, 0x6e, 0xb6, 0x95, 0x7c, 0x19, 0x3d, 0x6e, 0xc7, 0x6d,
+	0xb8, 0x20, 0xc0, 0xc9, 0xde, 0x48, 0x8c, 0xe4, 0x58, 0x1c, 0x83, 0x01,
+	0x19, 0x48, 0xad, 0xf6, 0xe8, 0x53, 0x15, 0x15, 0x6e, 0xa1, 0x41, 0xaa,
+	0x52, 0x10, 0x60, 0x65, 0x29, 0x0c, 0xca, 0x16, 0x70, 0xa8, 0x55, 0x5e,
+	0xd1, 0x69, 0x10, 0x71, 0x40, 0x53, 0xb0, 0xdb, 0x2e, 0x6a, 0x60, 0x29,
+	0x36, 0x6c, 0x54, 0x49, 0x44, 0xcc, 0xa4, 0x49, 0xf0, 0xd6, 0x9b, 0x31,
+	0xef, 0x09, 0xb2, 0x8b, 0x29, 0x13, 0xa2, 0x3b, 0x29, 0x0c, 0x28, 0x75,
+	0xe6, 0xe7, 0x6f, 0x63, 0x01, 0x25, 0x03, 0x3f, 0x23, 0xa9, 0x5d, 0x6d,
+	0xd6, 0xe4, 0x47, 0x28, 0x55, 0x19, 0xb3, 0x46, 0xc2, 0xc0, 0x29, 0x6c,
+	0x22, 0xa1, 0x43, 0xd5, 0xb6, 0xb2, 0x90, 0xb6, 0x20, 0xd8, 0x6c, 0xce,
+	0x04, 0x29, 0x32, 0x8c, 0x2e, 0x2e, 0x84, 0x56, 0xeb, 0x9d, 0xd6, 0xd8,
+	0x27, 0xc8, 0x93, 0x48, 0xf3, 0xe2, 0x1c, 0x24, 0x0b, 0x43, 0x0a, 0x70,
+	0xf1, 0x02, 0x12, 0x14, 0x02, 0x93, 0xcb, 0x6d, 0x09, 0xca, 0x37, 0x07,
+	0xef, 0x24, 0x86, 0x29, 0x74, 0xbc, 0x33, 0x12, 0x41, 0x2d, 0xb4, 0x42,
+	0xa1, 0x54, 0x5b, 0xc3, 0x2f, 0x1b, 0xa1, 0x43, 0x0c, 0xa9, 0x5d, 0x10,
+	0xc3, 0xd2, 0xe8, 0x08, 0x0c, 0x0b, 0x16, 0x65, 0x8c, 0x20, 0x8e, 0x5d,
+	0x74, 0xbc, 0x5d, 0x19, 0xe9, 0x2e, 0x76, 0xdb, 0x7d, 0xb1, 0x8b, 0xa9,
+	0xb2, 0x85, 0xa1, 0x59, 0x9e, 0x92, 0xc5, 0x69, 0x5c, 0x91, 0xaa, 0x0a,
+	0x08, 0xae, 0xfa, 0x85, 0xf0, 0xdb, 0x8c, 0xe0, 0x9c, 0x60, 0x9f, 0x9c,
+	0xc0, 0x5c, 0x5c, 0x08, 0x58, 0xb2, 0xe7, 0x8c, 0xf5, 0x13, 0xe6, 0x83,
+	0x96, 0xae, 0x22, 0x3c, 0x10, 0x88, 0x15, 0x93, 0x17, 0x92, 0x1b, 0x7c,
+	0x82, 0xdb, 0x75, 0x10, 0x71, 0x79, 0x31, 0xb4, 0xdd, 0x13, 0xc8, 0x85,
+	0x04, 0x65, 0x52, 0xda, 0x14, 0xa9, 0x89, 0x56, 0x40, 0x78, 0xa8, 0x5c,
+	0x64, 0xef, 0x74, 0x28, 0x05, 0x69, 0xb7, 0x0b, 0xf1, 0x04, 0x40, 0xdc,
+	0xcd, 0xa8, 0x46, 0x68, 0x6d, 0xca, 0x5e, 0x4f, 0x32, 0x88, 0x5c, 0x76,
+	0x1b, 0x95, 0x96, 0x14, 0x13, 0xd3, 0x73, 0xb2, 0xbd, 0x11, 0x5d, 0x2c,
+	0xb6, 0xcb, 0xcc, 0xb0, 0x41, 0x10, 0x9c, 0x16, 0xe7, 0x6d, 0x7a, 0x51,
+	0x37, 0x91, 0xb0, 0xd9, 0x0c, 0x0c, 0x58, 0x59, 0x6d, 0x24, 0x44, 0x26,
+	0x0c, 0x52, 0xc5, 0xb3, 0x14, 0x2d, 0x35, 0x45, 0x2b, 0xcb, 0x5d, 0x30,
+	0x4f, 0x5c, 0x81, 0xdb, 0xc8, 0x30, 0x46, 0xd9, 0x20, 0x94, 0x13, 0x81,
+	0xca, 0xa5, 0xb6, 0xa9, 0x54, 0xa5, 0x20, 0x04, 0xc8, 0x09, 0xcb, 0xc5,
+	0xc5, 0xed, 0x44, 0x86, 0xcb, 0x0a, 0x75, 0x23, 0x32, 0x24, 0xb2, 0x5b,
+	0xc1, 0x78, 0x5b, 0xfc, 0xad, 0xb6, 0x1b, 0xa2, 0xf5, 0x8c, 0xa4, 0xd5,
+	0xc9, 0x4b, 0x95, 0x85, 0x85, 0x95, 0x04, 0x0f, 0x84, 0x61, 0x62, 0x5d,
+	0x20, 0xa1, 0x8c, 0x44, 0x3f, 0xa2, 0x2d, 0x90, 0xbb, 0x73, 0x84, 0xe8,
+	0xa8, 0x71, 0x2d, 0xa1, 0x95, 0xfd, 0x05, 0x80, 0x88, 0x29, 0xbf, 0xaa,
+	0xdd, 0x08, 0xd0, 0x49, 0xb9, 0xad, 0xd0, 0xab, 0x2d, 0xb6, 0xe1, 0x74,
+	0x22, 0x72, 0xb1, 0xb1, 0x41, 0x25, 0x30, 0xcb, 0x1c, 0x5c, 0x6e, 0x12,
+	0xa9, 0x05, 0x9e, 0xca, 0x44, 0x43, 0x6d, 0x04, 0xf1, 0x50, 0x83, 0x42,
+	0xf2, 0x20, 0x13, 0x18, 0x21, 0xba, 0xb2, 0x6b, 0x07, 0x68, 0xd9, 0x6e,
+	0xd6, 0x9b, 0x7d, 0xd4, 0x67, 0x45, 0xd4, 0xca, 0x14, 0xd8, 0xc6, 0x11,
+	0x15, 0x77, 0x56, 0x33, 0x3b, 0x82, 0xb7, 0x87, 0xf2, 0x80, 0x91, 0x35,
+	0x82, 0x0c, 0x51, 0x94, 0x78, 0x80, 0x89, 0x8a, 0x08, 0xdd, 0x4e, 0x10,
+	0x46, 0x9d, 0xa1, 0x56, 0x4b, 0x0d, 0xd1, 0x74, 0x04, 0xa3, 0xc4, 0x1a,
+	0x26, 0xeb, 0x70, 0x14, 0xc2, 0xb7, 0x5d, 0x25, 0xd2, 0x0a, 0x28, 0x34,
+	0xc5, 0xc8, 0x61, 0x84, 0x9b, 0x0e, 0xd1, 0x65, 0x23, 0xf1, 0xb9, 0x0c,
+	0x91, 0x5d, 0xc6, 0x58, 0x44, 0x2e, 0x50, 0xb8, 0xee, 0xf6, 0x17, 0x76,
+	0x15, 0x6f, 0x10, 0x94, 0x36, 0xfc, 0x51, 0xb1, 0x22, 0xfe, 0x10, 0x21,
+	0xb6, 0x2c, 0xca, 0x14, 0xda, 0x69, 0x20, 0x96, 0xda, 0xa7, 0x12, 0x09,
+	0x6d, 0xc1, 0x9d, 0xff, 0xc4, 0x33, 0x86, 0xd3, 0x3f, 0xaa, 0xad, 0xc0,
+	0xd7, 0x0a, 0x65, 0x35, 0x9b, 0x3a, 0x8b, 0x3d, 0x87, 0xc4, 0x30, 0x1b,
+	0x79, 0x17, 0x13, 0xe7, 0xbb, 0xec, 0xa4, 0xaa, 0x5b, 0x77, 0x71, 0xb7,
+	0x6b, 0xb1, 0x59, 0x31, 0x85, 0x19, 0xc8, 0xdd, 0x5e, 0xf9, 0x5c, 0xb6,
+	0x5c, 0x45, 0x4c, 0xb1, 0x4e, 0x68, 0x9c, 0xba, 0x0b, 0x28, 0xca, 0xec,
+	0x6e, 0x16, 0x55, 0xe4, 0x13, 0xcf, 0x27, 0x3a, 0x83, 0xdb, 0x23, 0x28,
+	0x36, 0x27, 0x3b, 0x98, 0x0d, 0x24, 0xb2, 0x14, 0xe9, 0x44, 0x1e, 0x08,
+	0xfb, 0xe7, 0x62, 0xbc, 0xa7, 0xe8, 0x88, 0xd9, 0x15, 0x19, 0xdd, 0xd0,
+	0xbc, 0x6c, 0xa6, 0x04, 0x46, 0x3e, 0x56, 0xeb, 0xad, 0xb6, 0xc4, 0x60,
+	0x62, 0x14, 0x67, 0x72, 0x39, 0x61, 0x51, 0x01, 0x7d, 0x43, 0x5a, 0x43,
+	0x0d, 0xd3, 0x2b, 0x53, 0xb6, 0xbb, 0xd0, 0xda, 0x6d, 0xca, 0x66, 0x28,
+	0x62, 0x6d, 0x84, 0x56, 0xf3, 0x16, 0x15, 0x6f, 0x17, 0x4a, 0x16, 0xbb,
+	0x53, 0x58, 0x23, 0x88, 0x11, 0x1b, 0x23, 0x87, 0x1b, 0xa9, 0xb5, 0x0d,
+	0x8e, 0xc2, 0xc5, 0x04, 0x7e, 0x43, 0x42, 0x75, 0x39, 0xb2, 0x5b, 0xdb,
+	0xf8, 0xc2, 0x64, 0x4f, 0x68, 0x6f, 0x2f, 0x08, 0x96, 0x5b, 0x93, 0xd0,
+	0x8b, 0x84, 0x10, 0x77, 0x9d, 0xbe, 0xe6, 0x87, 0x86, 0x22, 0xc6, 0x85,
+	0xcd, 0x61, 0xb6, 0x16, 0x51, 0x5e, 0x5d, 0x86, 0x50, 0x6c, 0x54, 0x88,
+	0x6e, 0x77, 0x4b, 0x7d, 0xc9, 0x4f, 0x08, 0x3c, 0x0d, 0x60, 0x84, 0xfc,
+	0x06, 0x41, 0x57, 0x65, 0x3f, 0xc1, 0xbe, 0xab, 0xfa, 0xa2, 0x89, 0x0b,
+	0xd4, 0x22, 0x04, 0x8b, 0x40, 0x8b, 0xfa, 0xa3, 0x7e, 0x2d, 0xc2, 0xe5,
+	0x69, 0x73, 0x02, 0x77, 0xe2, 0x94, 0xa1, 0x91, 0xdb, 0xee, 0x16, 0x97,
+	0x6a, 0x2b, 0xa5, 0xca, 0xc3, 0x69, 0xb3, 0xda, 0x1a, 0x08, 0x6e, 0x56,
+	0xfb, 0x6b, 0x9c, 0xca, 0xdc, 0x92, 0x97, 0x0a, 0xa2, 0x99, 0x26, 0xa9,
+	0xff, 0x18, 0x58, 0x0a, 0xa3, 0x15, 0xae, 0xcb, 0x72, 0xb7, 0x3e, 0x58,
+	0x8a, 0x38, 0xb7, 0xc9, 0x17, 0xfb, 0x06, 0xd8, 0xbe, 0x81, 0x9e, 0xf8,
+	0xde, 0x6b, 0x95, 0xf5, 0xb9, 0x2a, 0xe5, 0x7e, 0xe5, 0x61, 0xb7, 0x59,
+	0xec, 0xae, 0x36, 0x37, 0x28, 0x54, 0xaa, 0xe6, 0x4d, 0x62, 0xb7, 0x24,
+	0xe3, 0x63, 0x6e, 0x90, 0x53, 0x2d, 0x36, 0xeb, 0xad, 0xe1, 0x65, 0x91,
+	0x82, 0xc6, 0xd9, 0x61, 0xb9, 0x59, 0xda, 0xc4, 0x6d, 0x17, 0x5b, 0x73,
+	0xab, 0x0d, 0xbc, 0x52, 0x8a, 0xef, 0x69, 0xb9, 0x92, 0x2b, 0x4a, 0xa5,
+	0xb5, 0x67, 0x1b, 0x72, 0xb6, 0x1b, 0x4d, 0x99, 0x41, 0x48, 0x3c, 0xa9,
+	0x4f, 0x04, 0x93, 0x52, 0x58, 0x5d, 0x8a, 0xb5, 0x30, 0x95, 0x65, 0x6e,
+	0x85, 0x58, 0x56, 0x4c, 0x45, 0x2c, 0x8b, 0x21, 0x1b, 0x14, 0x8a, 0x51,
+	0x2c, 0x56, 0x56, 0x19, 0x2b, 0x85, 0xca, 0xdf, 0x64, 0xba, 0xd8, 0xd4,
+	0xf1, 0x6c, 0x26, 0x0e, 0x61, 0x44, 0x8d, 0x80, 0x36, 0x55, 0xfc, 0x33,
+	0xdc, 0x3b, 0x6b, 0xb7, 0x88, 0x89, 0x8b, 0xbf, 0x1b, 0xac, 0x9a, 0x7f,
+	0x2b, 0x9f, 0x1b, 0xd0, 0x9a, 0x4b, 0x21, 0x8d, 0x24, 0x82, 0xe8, 0xab,
+	0x03, 0x73, 0x57, 0xb1, 0xba, 0x5d, 0x03, 0xb0, 0x4e, 0xf8, 0x6e, 0x46,
+	0xb6, 0x27, 0xa2, 0x32, 0xe9, 0x05, 0x25, 0xca, 0xda, 0x14, 0x4b, 0xc6,
+	0x0d, 0x12, 0x97, 0x3c, 0xb3, 0x0c, 0xa2, 0x64, 0x41, 0x08, 0xe9, 0x42,
+	0x02, 0x25, 0x62, 0xb2, 0xb2, 0xa0, 0xbb, 0x14, 0x4b, 0x89, 0x22, 0x9b,
+	0xf0, 0x6e, 0xf7, 0x25, 0x47, 0x10, 0x1e, 0x43, 0x5b, 0x10, 0x82, 0x1b,
+	0x7d, 0xc8, 0x23, 0xc4, 0xff, 0x50, 0xef, 0x4d, 0xc3, 0x05, 0x01, 0xba,
+	0x50, 0xf3, 0x25, 0x6e, 0x72, 0xf1, 0x51, 0x74, 0x91, 0x4b, 0xae, 0x96,
+	0xdb, 0x84, 0x88, 0x9b, 0xd8, 0x9a, 0xc6, 0x52, 0x1b, 0x90, 0x4c, 0x67,
+	0x72, 0xb2, 0xaf, 0xa1, 0x0b, 0xf9, 0xa0, 0x37, 0x2c, 0x82, 0xc2, 0x96,
+	0x61, 0xd2, 0x59, 0x4d, 0xd8, 0x6d, 0x36, 0x65, 0x32, 0xcb, 0x35, 0x86,
+	0xd3, 0x6c, 0x4d, 0xc6, 0xb9, 0x59, 0x6d, 0xb6, 0xfb, 0xb2, 0x78, 0x3d,
+	0xba, 0xdf, 0x6e, 0x96, 0xde, 0xac, 0xb7, 0x25, 0x31, 0x1b, 0x0d, 0xb2,
+	0xeb, 0x65, 0x85, 0x33, 0x71, 0xb9, 0x21, 0x2d, 0x48, 0xc8, 0x28, 0x25,
+	0xea, 0x28, 0x17, 0x20, 0x23, 0xb2, 0xc2, 0x4c, 0x67, 0x0c, 0x10, 0x73,
+	0x1b, 0x75, 0x92, 0xc3, 0x72, 0x4a, 0xc3, 0x22, 0x89, 0x54, 0x02, 0x7b,
+	0x21, 0x0a, 0xc1, 0x97, 0x48, 0x29, 0xe4, 0xc8, 0x57, 0x0b, 0x65, 0x85,
+	0xf0, 0x84, 0x9f, 0x49, 0xcb, 0x54, 0x16, 0x69, 0xec, 0x15, 0x92, 0xe1,
+	0x22, 0x8e, 0xd3, 0x73, 0x85, 0x5c, 0xac, 0xb6, 0x62, 0x33, 0x35, 0x18,
+	0x52, 0x83, 0x87, 0x59, 0x3b, 0x9d, 0x96, 0xd9, 0x65, 0xb1, 0x93, 0xd9,
+	0x26, 0x72, 0x12, 0xf1, 0x96, 0x80, 0xdd, 0xe5, 0x41, 0x24, 0x56, 0x77,
+	0x59, 0x3a, 0xbb, 0xac, 0x9d, 0x16, 0x55, 0x2c, 0x85, 0x4a, 0xa5, 0xb4,
+	0x17, 0x59, 0x3b, 0x4b, 0xac, 0x9d, 0x85, 0xd6, 0x4e, 0xd6, 0xeb, 0x27,
+	0x6e, 0x75, 0x93, 0xa4, 0x4a, 0x89, 0xf0, 0xe5, 0x52, 0xdb, 0x9b, 0xeb,
+	0x8c, 0x2a, 0x15, 0x52, 0x2c, 0xb1, 0x3a, 0x05, 0x33, 0xf2, 0x7c, 0x42,
+	0x17, 0x82, 0xb0, 0x95, 0xc2, 0x13, 0x58, 0x85, 0x11, 0x58, 0x51, 0xb1,
+	0x6b, 0x74, 0xca, 0xd5, 0x4e, 0xa7, 0x5d, 0xad, 0xd7, 0x57, 0x45, 0x6d,
+	0xf7, 0x23, 0x3f, 0x2b, 0xcc, 0x82, 0xdb, 0x65, 0xb0, 0xdb, 0xae, 0x70,
+	0xa0, 0x24, 0x27, 0xa0, 0x32, 0xb5, 0x2b, 0xcd, 0xd0, 0xba, 0x06, 0xce,
+	0x02, 0xe2, 0x23, 0x62, 0x5d, 0x64, 0xaa, 0xe5, 0x73, 0xba, 0x26, 0xb9,
+	0xdb, 0x88, 0xdc, 0x6c, 0x96, 0x5b, 0xc0, 0xf9, 0xb5, 0xb6, 0xc3, 0x64,
+	0x43, 0x21, 0x23, 0x81, 0xb7, 0x97, 0x50, 0xdc, 0x2c, 0x37, 0x3b, 0x9c,
+	0x29, 0x9d, 0x04, 0xae, 0x10, 0x6a, 0x89, 0xae, 0x46, 0xcc, 0x8e, 0x43,
+	0x65, 0xb1, 0xda, 0xee, 0x16, 0xfb, 0x4d, 0xb8, 0x1d, 0xc5, 0x3f, 0x94,
+	0x1c, 0xc4, 0xa9, 0x45, 0x3f, 0x95, 0xf9, 0xcc, 0x53, 0x05, 0xfc, 0x0c,
+	0x5a, 0x8a, 0xdf, 0x66, 0x5b, 0xf1, 0x85, 0x4a, 0x10, 0x94, 0xc1, 0xa9,
+	0x26, 0x34, 0xdb, 0x4d, 0x08, 0x28, 0x88, 0x93, 0x52, 0x52, 0x8c, 0x88,
+	0x46, 0x66, 0x30, 0x2a, 0x4c, 0x03, 0x6a, 0xba, 0xdc, 0xd7, 0x68, 0x54,
+	0x08, 0x91, 0x20, 0x89, 0x4c, 0x8a, 0x8c, 0xae, 0x70, 0xab, 0xbd, 0x86,
+	0xdd, 0x74, 0x17, 0xe1, 0x07, 0x94, 0x9a, 0x4c, 0x27, 0x23, 0xd6, 0x21,
+	0x78, 0x47, 0xdc, 0x96, 0xfb, 0x35, 0x9a, 0xe6, 0x66, 0xe3, 0x31, 0x99,
+	0x4c, 0xe6, 0x93, 0x59, 0xb4, 0xde, 0x71, 0x39, 0x94, 0xb6, 0x21, 0x5c,
+	0xae, 0x87, 0x40, 0x47, 0xde, 0xef, 0x64, 0x56, 0x5b, 0x9d, 0xd2, 0x14,
+	0x08, 0x50, 0xff, 0x50, 0x31, 0xd9, 0x69, 0x98, 0xcc, 0x26, 0x53, 0x41,
+	0xce, 0xeb, 0x4d, 0x92, 0xf0, 0x32, 0x15, 0x61, 0x0e, 0x57, 0x96, 0x06,
+	0x71, 0x89, 0xe3, 0x0e, 0x74, 0xbd, 0x69, 0x0d, 0x71, 0x12, 0x39, 0x2d,
+	0xc1, 0x5b, 0xee, 0x48, 0xee, 0x4d, 0xe2, 0x57, 0x95, 0x4c, 0x1b, 0x4d,
+	0xcc, 0x3d, 0x0d, 0xf2, 0x9e, 0x50, 0x55, 0x22, 0x41, 0xcb, 0x78, 0x75,
+	0x91, 0x3b, 0xe1, 0x26, 0xb1, 0x20, 0x31, 0x7c, 0xa6, 0x94, 0x81, 0xc2,
+	0x1d, 0xc1, 0x80, 0x8a, 0x14, 0xb8, 0xda, 0xec, 0xb7, 0x07, 0x3f, 0x25,
+	0x12, 0x12, 0xb3, 0x1b, 0x65, 0xe6, 0x5d, 0x20, 0xa2, 0xab, 0x49, 0x08,
+	0x54, 0xd8, 0xed, 0xf6, 0xeb, 0xa3, 0x77, 0x89, 0xb1, 0x89, 0xef, 0x15,
+	0xe5, 0x3f, 0x56, 0x15, 0x64, 0xb4, 0xd8, 0xc8, 0x90, 0x97, 0x38, 0x8b,
+	0xec, 0x47, 0x26, 0xec, 0x36, 0x26, 0xce, 0x29, 0x95, 0x2c, 0x21, 0xc6,
+	0xe0, 0x56, 0xe2, 0x08, 0x50, 0x64, 0x03, 0x23, 0x90, 0x50, 0xe4, 0x14,
+	0x1a, 0x85, 0x24, 0x9f, 0x0e, 0xd9, 0x69, 0xb1, 0x2e, 0x69, 0x82, 0x48,
+	0xd9, 0x6c, 0xe3, 0xbe, 0x25, 0x10, 0x29, 0x08, 0x95, 0xba, 0x1b, 0xe7,
+	0x95, 0x6c, 0x92, 0x45, 0xf3, 0xc8, 0xa5, 0xc6, 0xdb, 0x69, 0xb7, 0x5a,
+	0x4c, 0xfc, 0x52, 0xd0, 0xd3, 0xa8, 0x6e, 0xd6, 0x9b, 0x22, 0x4e, 0x08,
+	0x54, 0xad, 0xca, 0xca, 0x06, 0xe3, 0x75, 0xb7, 0x10, 0x81, 0x9b, 0xb8,
+	0xc8, 0x0e, 0x7c, 0x90, 0x00, 0x4d, 0x60, 0xcf, 0x98, 0x6e, 0xb6, 0x36,
+	0x93, 0x1b, 0x2a, 0x65, 0x88, 0x06, 0x1d, 0x96, 0xdd, 0x75, 0xb6, 0xd9,
+	0x49, 0x79, 0x1b, 0x04, 0xdd, 0x09, 0x18, 0x45, 0x2b, 0x74, 0x3a, 0x7d,
+	0x12, 0x8a, 0x4d, 0x66, 0x6c, 0x42, 0xe4, 0xc4, 0xd3, 0x22, 0xf5, 0x42,
+	0x53, 0x6c, 0xd1, 0xed, 0x0a, 0xb7, 0x59, 0x6c, 0xea, 0x74, 0x37, 0x66,
+	0x38, 0x26, 0x64, 0x32, 0xb9, 0x14, 0x65, 0x36, 0x83, 0x34, 0x5c, 0x13,
+	0x47, 0x1b, 0x19, 0xb9, 0x09, 0x78, 0xe1, 0xc1, 0x8d, 0xce, 0xca, 0xf5,
+	0xe2, 0x70, 0xe3, 0x69, 0xb9, 0x1f, 0xba, 0x5c, 0xd4, 0xbc, 0x61, 0x56,
+	0xcb, 0x79, 0xd0, 0x95, 0xce, 0x41, 0x5b, 0xa7, 0x51, 0x28, 0xb4, 0x2a,
+	0xad, 0x1d, 0xf3, 0xca, 0xee, 0x70, 0x82, 0x79, 0x65, 0x64, 0xb2, 0xd9,
+	0xad, 0x2d, 0x2c, 0x28, 0x46, 0x4c, 0x0c, 0x84, 0xa2, 0xc6, 0xd0, 0x49,
+	0x46, 0x47, 0xfe, 0x2b, 0x54, 0x29, 0x0a, 0x66, 0x6a, 0xf2, 0xa1, 0x24,
+	0x49, 0x53, 0x84, 0xb3, 0x93, 0x41, 0xd2, 0xad, 0x72, 0xbf, 0x74, 0x95,
+	0x15, 0x6e, 0xae, 0x11, 0x28, 0xa0, 0xda, 0x6e, 0x4e, 0x88, 0x28, 0x0a,
+	0x69, 0x46, 0xd6, 0xfb, 0x92, 0x6e, 0x0a, 0x95, 0x12, 0x32, 0x9a, 0xd8,
+	0xad, 0x86, 0xe5, 0x62, 0xb4, 0xaa, 0x78, 0xdc, 0xad, 0x23, 0xc6, 0x54,
+	0x9b, 0xa2, 0x82, 0x0d, 0xc6, 0xea, 0x7c, 0x02, 0xe7, 0x4a, 0x93, 0xe4,
+	0xe4, 0xc3, 0x72, 0x85, 0x14, 0x3b, 0x9a, 0x2a, 0x5b, 0xee, 0xf6, 0xe9,
+	0x05, 0x6e, 0xcd, 0x67, 0xb2, 0xdd, 0x2c, 0x6f, 0x9e, 0x48, 0xcc, 0x55,
+	0xbb, 0x32, 0x58, 0x8a, 0x23, 0x1a, 0x0c, 0x13, 0x44, 0x0d, 0x94, 0x44,
+	0x84, 0xbd, 0xe1, 0xaa, 0xc8, 0x82, 0xc4, 0xbd, 0xe0, 0x11, 0xce, 0xca,
+	0x7e, 0x63, 0x2a, 0x44, 0x31, 0x78, 0xf5, 0x4b, 0x11, 0x95, 0x28, 0x21,
+	0x5c, 0x1d, 0x10, 0x5a, 0xd4, 0x47, 0x8c, 0x92, 0x21, 0x1a, 0x45, 0x10,
+	0xd4, 0xe4, 0x17, 0x35, 0x5e, 0x14, 0xda, 0x18, 0x52, 0x20, 0xe2, 0x49,
+	0x32, 0x57, 0x79, 0x13, 0xa1, 0x29, 0x19, 0x43, 0x04, 0x0a, 0xc9, 0x60,
+	0x06, 0xbf, 0x5c, 0x95, 0x5a, 0x6d, 0xd5, 0xf5, 0x82, 0x28, 0x52, 0x49,
+	0x22, 0x7c, 0xda, 0xd8, 0x8d, 0x7c, 0x25, 0x05, 0x86, 0x0a, 0xca, 0x30,
+	0x23, 0x75, 0xb6, 0x59, 0x15, 0x30, 0x52, 0x6c, 0x9e, 0x68, 0x61, 0x37,
+	0x4b, 0xcd, 0xc2, 0xca, 0x6e, 0x02, 0x56, 0x4b, 0x20, 0xbd, 0xc2, 0xa1,
+	0x30, 0x91, 0x11, 0x29, 0x42, 0x44, 0x14, 0xa6, 0x51, 0x76, 0xb7, 0xda,
+	0x5e, 0x4c, 0x6d, 0x36, 0xe9, 0x4c, 0xed, 0x53, 0x9c, 0x24, 0x0a, 0x50,
+	0x3e, 0x67, 0x68, 0x96, 0x48, 0x15, 0x71, 0x16, 0xc4, 0x55, 0x90, 0xd5,
+	0x71, 0x9c, 0x64, 0x56, 0xc4, 0x55, 0x94, 0xae, 0x76, 0x9b, 0xd5, 0x96,
+	0xbe, 0x82, 0xa5, 0x61, 0x65, 0x21, 0xbb, 0xdc, 0xad, 0xf7, 0x4b, 0x2a,
+	0xb2, 0x95, 0xd6, 0xdd, 0x73, 0xb4, 0xd9, 0xcd, 0xd0, 0x9c, 0xd1, 0x55,
+	0x94, 0x87, 0xdc, 0x42, 0xac, 0x56, 0xc9, 0xec, 0x76, 0x87, 0xb4, 0x19,
+	0x51, 0x07, 0x42, 0xcc, 0x49, 0x07, 0x45, 0x7d, 0x17, 0xc6, 0xcf, 0x74,
+	0xb4, 0x2b, 0x2c, 0xdc, 0xad, 0xf6, 0x77, 0x02, 0x25, 0x5a, 0x67, 0xc5,
+	0x19, 0x61, 0x53, 0x0a, 0xcf, 0x4a, 0xce, 0x2a, 0xd4, 0x9a, 0xc2, 0xcb,
+	0x05, 0xb5, 0x7d, 0xf1, 0x45, 0x66, 0x25, 0x20, 0x4d, 0xa2, 0x05, 0x59,
+	0x4a, 0x5f, 0x2a, 0x90, 0x4b, 0xa5, 0xd2, 0xeb, 0x85, 0xc9, 0x17, 0x04,
+	0x16, 0x05, 0xc5, 0x46, 0xd9, 0x64, 0xb9, 0xb3, 0x50, 0xc8, 0x25, 0x52,
+	0xf8, 0x54, 0x26, 0xfb, 0x20, 0x12, 0x44, 0xaf, 0xac, 0xb8, 0xc2, 0x95,
+	0x40, 0xc4, 0x91, 0x25, 0x0d, 0x0a, 0xca, 0xc0, 0x36, 0xf0, 0x22, 0x21,
+	0xf5, 0x27, 0xe7, 0x16, 0xa8, 0x4b, 0x2d, 0xb8, 0x19, 0x09, 0x59, 0x04,
+	0x99, 0x54, 0xb8, 0x9a, 0xef, 0x69, 0x7a, 0xa1, 0x1f, 0x72, 0xb4, 0xdb,
+	0xae, 0xa7, 0xb0, 0x6b, 0x8c, 0x45, 0x8c, 0x27, 0xea, 0xa3, 0x4a, 0x89,
+	0x12, 0x77, 0x56, 0xd8, 0x1b, 0x62, 0x25, 0x25, 0x16, 0x9f, 0x46, 0x27,
+	0x44, 0x72, 0x21, 0x30, 0x32, 0x5b, 0x82, 0x7b, 0x53, 0x7f, 0xf2, 0x1f,
+	0xe1, 0x2c, 0x21, 0xb9, 0x5c, 0x86, 0x88, 0x65, 0x0e, 0x4a, 0xf6, 0x35,
+	0x2f, 0x3b, 0x4d, 0xba, 0xc7, 0x6c, 0xba, 0x85, 0x30, 0xd8, 0xac, 0xaf,
+	0x42, 0x57, 0x5b, 0x75, 0x86, 0xc4, 0xfa, 0xa2, 0x13, 0xe2, 0x80, 0x0d,
+	0x0a, 0x0b, 0xb2, 0x71, 0x82, 0xb4, 0xdb, 0x91, 0x74, 0x55, 0x78, 0x4d,
+	0x2c, 0xde, 0x64, 0x89, 0x98, 0xa5, 0x4b, 0x46, 0x49, 0x18, 0xab, 0x52,
+	0x72, 0xa6, 0x74, 0x51, 0xf6, 0x60, 0xfd, 0x4b, 0xad, 0xb6, 0xc4, 0x06,
+	0x42, 0x17, 0x0c, 0xb4, 0x46, 0x04, 0x65, 0x62, 0xbc, 0xa4, 0x3c, 0x42,
+	0xae, 0xf7, 0x2b, 0x4d, 0xd0, 0x1d, 0x45, 0xee, 0x4d, 0x24, 0xca, 0x58,
+	0x06, 0x85, 0x79, 0x90, 0x59, 0x2d, 0xe6, 0xd6, 0x76, 0xeb, 0x28, 0x4e,
+	0x21, 0xd9, 0x15, 0xc0, 0xab, 0x84, 0x27, 0x05, 0xee, 0x84, 0x0d, 0x48,
+	0x9c, 0x19, 0x0a, 0x49, 0x04, 0x86, 0xcc, 0x92, 0x29, 0x0a, 0x17, 0xf1,
+	0xa7, 0x55, 0x69, 0x94, 0xc0, 0x34, 0x2b, 0x71, 0xb5, 0x95, 0xa0, 0x3d,
+	0x48, 0x5f, 0xc4, 0x23, 0x51, 0xf5, 0xcd, 0xae, 0x14, 0xfc, 0xc6, 0xdf,
+	0x6e, 0xb6, 0x5e, 0x5c, 0xdc, 0x84, 0x48, 0x6d, 0x16, 0xfb, 0xbc, 0x82,
+	0xda, 0x31, 0x64, 0x1a, 0x68, 0xfb, 0x25, 0x0a, 0x52, 0xe4, 0xb4, 0x58,
+	0x4c, 0x38, 0x5f, 0x1d, 0x9e, 0x6c, 0x5e, 0x1d, 0x65, 0xd2, 0x01, 0x7d,
+	0x31, 0x7f, 0x14, 0x19, 0x1b, 0x1d, 0xac, 0x8d, 0x45, 0x08, 0x04, 0xb0,
+	0x89, 0xab, 0x84, 0x09, 0xce, 0xdc, 0x5a, 0x03, 0x61, 0x90, 0x58, 0xae,
+	0xb6, 0x6b, 0x32, 0x15, 0x8a, 0x10, 0x18, 0xbf, 0x88, 0x0f, 0x19, 0x4a,
+	0x8a, 0x1e, 0x95, 0x86, 0xef, 0x61, 0xbc, 0x92, 0x61, 0x93, 0xc1, 0x59,
+	0x6c, 0x28, 0xc2, 0x4e, 0x32, 0x57, 0x2b, 0xc8, 0x7a, 0x91, 0x15, 0x91,
+	0x70, 0x3b, 0x91, 0x92, 0xdc, 0xb9, 0x67, 0x8c, 0x2a, 0xe6, 0x53, 0x02,
+	0x5b, 0x49, 0x64, 0xb7, 0x94, 0x68, 0xd8, 0xac, 0xb7, 0x32, 0x41, 0x27,
+	0x78, 0x35, 0xbb, 0x57, 0x8d, 0x52, 0x25, 0x31, 0xda, 0x1b, 0xa1, 0x03,
+	0x14, 0xaa, 0xa7, 0x48, 0xa9, 0x52, 0x69, 0xd4, 0xba, 0xe5, 0x7e, 0x9f,
+	0x50, 0xaa, 0x57, 0x2b, 0xef, 0x1a, 0x36, 0xcb, 0x0d, 0x9e, 0xe7, 0x2c,
+	0x31, 0xf4, 0x2d, 0x34, 0x46, 0xf4, 0x37, 0x01, 0xb0, 0xdd, 0x6d, 0x97,
+	0x43, 0xb1, 0x10, 0x68, 0x1b, 0x48, 0xd1, 0x09, 0x03, 0x8d, 0x96, 0xed,
+	0x65, 0x21, 0x61, 0x2e, 0x07, 0x4a, 0x41, 0x13, 0x3b, 0x2e, 0x31, 0x2e,
+	0x21, 0xae, 0x57, 0xea, 0x75, 0x0a, 0x2d, 0x16, 0x89, 0x2a, 0x05, 0x11,
+	0xb5, 0xa1, 0xa2, 0x42, 0x86, 0xe5, 0x80, 0xe5, 0xa4, 0x17, 0x00, 0x8b,
+	0x12, 0x1b, 0x31, 0xdd, 0x1b, 0x99, 0xec, 0x08, 0x57, 0x28, 0xf6, 0x0d,
+	0x86, 0xe0, 0x21, 0x82, 0x59, 0xe4, 0xd6, 0x02, 0xd5, 0xe2, 0x43, 0xe3,
+	0x73, 0xba, 0x3d, 0x99, 0x5b, 0xec, 0xd0, 0xa6, 0x0e, 0x13, 0xde, 0x10,
+	0x45, 0x1b, 0xa5, 0x86, 0xd6, 0xe9, 0x04, 0x6f, 0xa6, 0x6a, 0xc2, 0x3a,
+	0x65, 0x6d, 0xb0, 0xdd, 0x0b, 0x74, 0x50, 0x88, 0x6c, 0xb6, 0x12, 0xdd,
+	0x1b, 0x85, 0xbe, 0xe7, 0x69, 0x29, 0xf4, 0x40, 0xb1, 0x09, 0xa3, 0xb0,
+	0x92, 0x80, 0xdd, 0x2e, 0x96, 0xcb, 0x2c, 0x28, 0xfa, 0x98, 0xb3, 0x08,
+	0x97, 0x8d, 0xcb, 0x48, 0xaf, 0xc6, 0x41, 0x73, 0xb6, 0x5b, 0xee, 0xef,
+	0x4c, 0x20, 0x74, 0xb2, 0x90, 0xd2, 0x3b, 0x35, 0x94, 0x93, 0x46, 0x58,
+	0x3f, 0xe8, 0x4c, 0x43, 0x74, 0xb7, 0xda, 0xec, 0xb6, 0xe3, 0x2e, 0x13,
+	0x98, 0x24, 0x00, 0x40, 0x15, 0x2b, 0x09, 0xb5, 0x8d, 0xca, 0xdb, 0x61,
+	0xb6, 0x48, 0x06, 0x99, 0xca, 0xcc, 0x6c, 0xb6, 0x1b, 0x69, 0x39, 0xa5,
+	0xde, 0xcb, 0x69, 0xb3, 0xda, 0x0d, 0x3c, 0x4e, 0xd4, 0xdb, 0x7c, 0xd7,
+	0x24, 0x48, 0x44, 0xc9, 0xb4, 0xce, 0xb5, 0x61, 0x4b, 0xaa, 0x24, 0x04,
+	0x27, 0x70, 0xa6, 0xfa, 0x52, 0xa1, 0xa7, 0x2a, 0xe5, 0x7e, 0x87, 0x4f,
+	0xa9, 0x89, 0xe8, 0xd5, 0x29, 0xf4, 0xba, 0x2d, 0x39, 0x23, 0x14, 0xb6,
+	0xaa, 0x85, 0x49, 0xaa, 0x0c, 0xd1, 0x58, 0xee, 0x56, 0xfb, 0x99, 0xca,
+	0xaa, 0xdd, 0xa1, 0x44, 0x8a, 0xed, 0x48, 0x8f, 0x59, 0xf6, 0x90, 0x96,
+	0x0a, 0xed, 0xc0, 0x69, 0x23, 0x62, 0x10, 0xd3, 0xac, 0x29, 0xb2, 0x0c,
+	0x51, 0x84, 0xdf, 0x4e, 0xc2, 0xb9, 0x22, 0xf5, 0x88, 0xf5, 0x23, 0x69,
+	0x55, 0x31, 0xba, 0xdc, 0x0f, 0x64, 0x92, 0xd0, 0xd6, 0x74, 0x5e, 0xa0,
+	0x8f, 0x98, 0xae, 0xf6, 0x9b, 0x75, 0x92, 0xdf, 0x77, 0x94, 0xa0, 0x30,
+	0x87, 0xf1, 0x21, 0x12, 0x42, 0x8e, 0x21, 0x0f, 0x3c, 0x6c, 0x37, 0x21,
+	0x53, 0x1b, 0x7d, 0x9a, 0xcc, 0xf2, 0xac, 0x13, 0x68, 0x3c, 0x6d, 0x20,
+	0xb9, 0xdc, 0x2c, 0x36, 0x3b, 0x29, 0x39, 0x2a, 0x5c, 0x19, 0x9c, 0x4d,
+	0xa1, 0x1b, 0x8a, 0xdf, 0x0a, 0x7e, 0xd1, 0xb3, 0xa4, 0xf8, 0xdb, 0x83,
+	0xfc, 0x5f, 0x30, 0x47, 0x68, 0xdd, 0x20, 0x41, 0xfe, 0x01, 0x38, 0x90,
+	0x94, 0xac, 0xd7, 0x24, 0xb9, 0x1b, 0x24, 0x82, 0xda, 0x3b, 0xa4, 0x70,
+	0x2a, 0x46, 0x22, 0x0a, 0x43, 0x64, 0x22, 0x91, 0xb7, 0x59, 0x61, 0x57,
+	0x56, 0xfd, 0x1b, 0x4d, 0xd2, 0xf2, 0x66, 0x03, 0x69, 0xb6, 0xbd, 0x78,
+	0x90, 0x89, 0xd8, 0xad, 0x96, 0xf1, 0xb9, 0x12, 0xd0, 0x75, 0x2a, 0x2b,
+	0x15, 0x94, 0x34, 0xc5, 0xba, 0x04, 0x43, 0x98, 0xc4, 0x21, 0x82, 0xda,
+	0x54, 0x58, 0x03, 0x6c, 0xb6, 0x58, 0xac, 0x23, 0x72, 0x23, 0x96, 0x48,
+	0xf8, 0x25, 0x9a, 0xcc, 0x14, 0xf5, 0xc6, 0x4c, 0x27, 0x81, 0x41, 0x56,
+	0x27, 0xa2, 0xfc, 0xb8, 0x09, 0x3e, 0x3b, 0x5c, 0xed, 0xf2, 0x0b, 0x32,
+	0xeb, 0x88, 0xb7, 0x22, 0x82, 0x8b, 0x2e, 0xa4, 0xa8, 0xd9, 0x25, 0xba,
+	0xc9, 0xaa, 0x06, 0xe9, 0x0a, 0x2c, 0x14, 0x2a, 0x87, 0xb9, 0x59, 0x6e,
+	0x16, 0xfb, 0x90, 0x96, 0x8d, 0xb9, 0x01, 0xd5, 0xd2, 0x05, 0xc8, 0xc5,
+	0xc7, 0xc6, 0xcf, 0x6f, 0x74, 0x82, 0x94, 0x0f, 0xe1, 0xda, 0x6c, 0x57,
+	0x23, 0x3f, 0x21, 0x06, 0x37, 0xe1, 0x2b, 0x5d, 0x96, 0xcb, 0x70, 0x85,
+	0x11, 0x00, 0x8d, 0xc8, 0x9c, 0x09, 0x21, 0xd0, 0x81, 0xa2, 0x23, 0xdb,
+	0x96, 0x08, 0xca, 0x40, 0x2c, 0xcd, 0xb8, 0x5c, 0x41, 0x14, 0xd4, 0xad,
+	0xd2, 0xd1, 0x49, 0x34, 0x4f, 0x3b, 0x85, 0x94, 0x8f, 0x4d, 0x32, 0x86,
+	0xe9, 0x6f, 0xb8, 0x5c, 0xe1, 0x47, 0xc4, 0x37, 0x3b, 0x79, 0x1d, 0x09,
+	0xf1, 0x13, 0x62, 0x5d, 0xba, 0xcb, 0x78, 0x75, 0xb1, 0xb9, 0xda, 0xee,
+	0x61, 0xa4, 0x6d, 0xd4, 0x8f, 0x06, 0x62, 0x66, 0xd4, 0x3a, 0x0d, 0x3a,
+	0x87, 0x45, 0xa6, 0x53, 0x06, 0x60, 0x9c, 0x36, 0x65, 0x81, 0xfe, 0xa5,
+	0x82, 0x4f, 0xc2, 0x4f, 0xda, 0x36, 0xdb, 0x49, 0xd2, 0x09, 0x5e, 0x90,
+	0x69, 0x90, 0x29, 0x90, 0x12, 0x09, 0x27, 0x13, 0x94, 0x90, 0x3f, 0xc5,
+	0x86, 0xd8, 0x99, 0x82, 0x81, 0x06, 0x1f, 0x42, 0xb1, 0x02, 0x14, 0x63,
+	0x6a, 0xb7, 0xd8, 0x94, 0x30, 0x8c, 0xbc, 0x6d, 0xf6, 0xfb, 0x60, 0xe2,
+	0xa1, 0xf0, 0x95, 0x86, 0xd8, 0xef, 0xa5, 0x79, 0x3a, 0x34, 0xb2, 0xd9,
+	0x1d, 0xd4, 0x68, 0x28, 0x44, 0x64, 0x74, 0x20, 0x0e, 0x2f, 0x50, 0x40,
+	0xa6, 0x44, 0x63, 0x4a, 0x54, 0xce, 0x44, 0x21, 0x2c, 0xe8, 0x88, 0x62,
+	0x12, 0x2f, 0x5a, 0x6f, 0x36, 0x36, 0xdb, 0x2d, 0xb6, 0xdf, 0x72, 0xbc,
+	0xcb, 0x16, 0x50, 0x61, 0x57, 0x3b, 0xa9, 0x5c, 0x12, 0x10, 0x29, 0x1d,
+	0x0d, 0x96, 0xf1, 0x61, 0xb6, 0xdc, 0x1d, 0x40, 0x5c, 0x88, 0x51, 0xc4,
+	0x6e, 0xd6, 0x9b, 0x23, 0x8b, 0x08, 0x69, 0x91, 0x68, 0x3d, 0x9a, 0xeb,
+	0x6e, 0x31, 0xc3, 0x90, 0x4a, 0xae, 0x76, 0x8b, 0x95, 0xa6, 0xdd, 0x6b,
+	0xae, 0x57, 0xc2, 0x99, 0x25, 0x52, 0xe8, 0x55, 0x25, 0x36, 0xc8, 0xc5,
+	0x44, 0x11, 0x44, 0xdb, 0x84, 0x01, 0xc6, 0xe6, 0xdb, 0x4d, 0x2a, 0x2c,
+	0xf4, 0xb9, 0xdb, 0xcf, 0x4c, 0x53, 0x68, 0xdb, 0xc9, 0x05, 0x68, 0x50,
+	0xb0, 0x6c, 0x88, 0xf4, 0xeb, 0x5c, 0x8f, 0x7a, 0x70, 0xa7, 0x83, 0x37,
+	0xd3, 0x29, 0x74, 0x82, 0x84, 0x8b, 0x09, 0x65, 0xbc, 0x59, 0x6c, 0x68,
+	0x60, 0x24, 0x74, 0x35, 0xfa, 0xe4, 0xa8, 0x0b, 0x86, 0xd9, 0x65, 0xb7,
+	0x59, 0xee, 0x96, 0x8a, 0xfc, 0x82, 0xe7, 0x68, 0x06, 0x33, 0x79, 0x6a,
+	0x75, 0xc4, 0x7a, 0x82, 0x75, 0x64, 0xae, 0x57, 0xdc, 0xe4, 0xec, 0x36,
+	0x64, 0xdc, 0x13, 0x6d, 0x23, 0xaf, 0x55, 0x96, 0x44, 0xab, 0xe7, 0xc7,
+	0x63, 0x75, 0x50, 0x2e, 0x42, 0x42, 0x41, 0x49, 0x3b, 0x4d, 0x9a, 0x14,
+	0xdb, 0x7c, 0xac, 0xea, 0x18, 0xa2, 0xc0, 0xc8, 0xab, 0xe8, 0xeb, 0x04,
+	0xba, 0x04, 0x03, 0x12, 0x08, 0x66, 0x6f, 0x12, 0x15, 0x82, 0xf8, 0x2e,
+	0x10, 0x63, 0x77, 0xb7, 0xdc, 0xad, 0x65, 0x56, 0x21, 0xbc, 0x22, 0x1e,
+	0x30, 0x90, 0x9f, 0x17, 0x63, 0x16, 0xde, 0x26, 0xe3, 0x59, 0x40, 0x1e,
+	0x90, 0xd8, 0x95, 0x8d, 0x3c, 0x84, 0x34, 0x04, 0x6b, 0xd2, 0x58, 0x75,
+	0xc4, 0x3a, 0x82, 0x59, 0x02, 0xe6, 0x43, 0x69, 0xb7, 0x4b, 0x21, 0x50,
+	0x98, 0x49, 0xbe, 0x15, 0x7c, 0x2c, 0x06, 0xdc, 0xeb, 0x88, 0x0c, 0x82,
+	0x0d, 0xa6, 0x1b, 0xc3, 0x2c, 0x37, 0xb3, 0x07, 0xc1, 0x75, 0x88, 0x94,
+	0xce, 0xe1, 0x50, 0xa9, 0x50, 0x29, 0x99, 0x75, 0xa8, 0xd7, 0xa1, 0x75,
+	0x89, 0xc8, 0x8d, 0x89, 0x80, 0x44, 0xaa, 0x11, 0xdc, 0x14, 0xf4, 0x4e,
+	0xef, 0x61, 0xbc, 0xac, 0xa1, 0x38, 0x03, 0x08, 0x78, 0xd1, 0x2c, 0x37,
+	0x4b, 0x0c, 0x82, 0xd0, 0x24, 0x44, 0xc7, 0xa4, 0x0d, 0x64, 0xd2, 0x62,
+	0x96, 0x44, 0xdc, 0xa6, 0x28, 0xc2, 0xd4, 0x26, 0x1e, 0x87, 0x6e, 0xb2,
+	0xdd, 0x00, 0xbc, 0x9a, 0x54, 0x6e, 0x77, 0x3b, 0x0d, 0x9c, 0x18, 0xc9,
+	0x3e, 0x20, 0xe7, 0x06, 0xe8, 0xec, 0xa3, 0x74, 0x62, 0x81, 0x3b, 0x45,
+	0x1d, 0x52, 0x73, 0x51, 0x60, 0x32, 0xb3, 0x5a, 0x6e, 0x43, 0xa8, 0x29,
+	0x1c, 0x8d, 0xb8, 0xd6, 0x9b, 0x7d, 0xd9, 0xd0, 0x84, 0x9d, 0x49, 0x6d,
+	0x10, 0x72, 0xc5, 0x2e, 0xce, 0xcd, 0x72, 0xb7, 0xdb, 0x61, 0x44, 0x22,
+	0x77, 0x3b, 0x2d, 0x9e, 0xdb, 0x65, 0x03, 0xe1, 0x36, 0xb1, 0x4d, 0x91,
+	0x5d, 0x01, 0x77, 0x11, 0x7e, 0xb4, 0x4a, 0x53, 0x02, 0x4a, 0x4c, 0x55,
+	0x30, 0x43, 0x59, 0x64, 0x18, 0x45, 0xb9, 0xc2, 0x86, 0x30, 0x9f, 0xf8,
+	0xa5, 0x86, 0x4a, 0x36, 0xc4, 0x2b, 0x1b, 0x39, 0x08, 0x22, 0x29, 0xcd,
+	0xb5, 0xaf, 0x84, 0x89, 0x44, 0x8e, 0x84, 0xdd, 0x55, 0x69, 0x88, 0x24,
+	0x84, 0xdd, 0x94, 0x70, 0x94, 0xb0, 0x08, 0xf9, 0xc8, 0xb2, 0x45, 0xb0,
+	0x48, 0xa5, 0x46, 0xc2, 0x54, 0x64, 0x55, 0xa5, 0x2a, 0x4c, 0x42, 0xb2,
+	0xdd, 0xa5, 0x52, 0x07, 0x31, 0x2b, 0x9d, 0x96, 0xdd, 0x64, 0xb6, 0xdc,
+	0xec, 0xee, 0x84, 0x34, 0x11, 0x58, 0xbb, 0x2d, 0x8e, 0xb9, 0x5f, 0x00,
+	0x01, 0x3e, 0x13, 0x39, 0xa1, 0x3d, 0x13, 0x69, 0x61, 0x4a, 0xe1, 0x28,
+	0x11, 0x28, 0x12, 0xa8, 0x53, 0xea, 0x74, 0x9a, 0xc3, 0x6d, 0x0d, 0xd2,
+	0xe5, 0x75, 0xb1, 0x81, 0x50, 0x92, 0x81, 0x3a, 0x10, 0xba, 0xb6, 0x19,
+	0x60, 0x99, 0xa1, 0x1b, 0xaa, 0xdd, 0x2d, 0xf7, 0x4b, 0x0d, 0xb1, 0x2a,
+	0xbc, 0x98, 0x8b, 0x3a, 0x03, 0xa1, 0xba, 0x5e, 0x6e, 0x16, 0x57, 0x1e,
+	0x12, 0x20, 0x22, 0x7d, 0x2b, 0xd8, 0x3a, 0x8d, 0xda, 0xdf, 0x69, 0x2e,
+	0xf1, 0x16, 0x21, 0xaf, 0xd8, 0xac, 0x37, 0x3b, 0x2c, 0xec, 0x1d, 0x64,
+	0xb8, 0x05, 0xd7, 0x04, 0xb9, 0xc6, 0xfa, 0x08, 0x0c, 0x49, 0xe7, 0x5f,
+	0xba, 0x05, 0x30, 0x81, 0xe5, 0x0b, 0x10, 0x82, 0x77, 0xf6, 0x2f, 0xec,
+	0x07, 0x0d, 0x3b, 0x51, 0x33, 0x4f, 0xe0, 0x11, 0xf5, 0x6e, 0x08, 0xf2,
+	0x07, 0x58, 0x09, 0xbc, 0xa6, 0xaf, 0xe9, 0x5c, 0xed, 0xa8, 0xf8, 0x27,
+	0x72, 0x36, 0x4b, 0x2d, 0xc0, 0x8e, 0xc4, 0x62, 0x08, 0x47, 0x54, 0x42,
+	0x05, 0x0f, 0xcd, 0x12, 0x8e, 0xd2, 0x42, 0x03, 0x6f, 0xbb, 0x80, 0x70,
+	0xbe, 0x21, 0x89, 0x23, 0xd9, 0x11, 0x4c, 0xad, 0x36, 0xe8, 0x52, 0x29,
+	0x92, 0x3d, 0x90, 0xa9, 0xed, 0x8a, 0xc3, 0x74, 0xb1, 0xda, 0x05, 0x95,
+	0x5e, 0x93, 0xf8, 0x2d, 0x81, 0x21, 0xf9, 0x88, 0xea, 0xc2, 0x9a, 0xe4,
+	0x80, 0xa4, 0x9b, 0x64, 0x5d, 0x71, 0x2e, 0x72, 0xa2, 0xc2, 0x20, 0x3d,
+	0xa3, 0xff, 0x20, 0x4e, 0xfe, 0x00, 0xf0, 0xb6, 0x3b, 0x7d, 0xd6, 0xdc,
+	0x70, 0x66, 0x66, 0xdf, 0xc4, 0xcd, 0x7f, 0x67, 0x03, 0xa8, 0x7c, 0xa1,
+	0x4a, 0x55, 0x33, 0xa3, 0x33, 0xb4, 0x65, 0x1a, 0x3b, 0x25, 0xbe, 0xdb,
+	0x69, 0xb7, 0x58, 0x59, 0x30, 0x5a, 0x30, 0x54, 0x3c, 0xed, 0x96, 0xf1,
+	0x3f, 0x55, 0xf4, 0x15, 0x96, 0x1b, 0x7c, 0x81, 0xcd, 0x45, 0x47, 0x90,
+	0x16, 0x0a, 0x41, 0x70, 0x64, 0xa1, 0xb4, 0xd8, 0xee, 0xb6, 0xcb, 0x0d,
+	0xc8, 0x08, 0x0e, 0xb7, 0x4c, 0xad, 0x54, 0xea, 0x6b, 0x44, 0x57, 0x73,
+	0xa8, 0x16, 0x1c, 0x16, 0x48, 0x33, 0xca, 0x1b, 0x35, 0x99, 0xb4, 0x44,
+	0xe9, 0x45, 0x97, 0xc6, 0xe7, 0x70, 0xb0, 0xd8, 0xce, 0xe8, 0x97, 0x7d,
+	0x2c, 0xb7, 0x6b, 0x2b, 0x3b, 0x8a, 0xa0, 0x98, 0x65, 0xac, 0x29, 0x6d,
+	0x10, 0x31, 0xcd, 0xef, 0x05, 0x7b, 0x45, 0x99, 0x88, 0x2f, 0x85, 0xe3,
+	0x06, 0xce, 0xf3, 0x64, 0x31, 0x42, 0x3c, 0x42, 0xc7, 0x23, 0x61, 0x90,
+	0x5d, 0x2d, 0x36, 0xdb, 0x28, 0xb3, 0x25, 0xce, 0xcb, 0x61, 0xb9, 0x2f,
+	0x10, 0xdb, 0x94, 0xac, 0xad, 0x76, 0x9b, 0x85, 0xcc, 0x08, 0x06, 0xe5,
+	0x6f, 0xba, 0xd9, 0xda, 0x91, 0x04, 0xf0, 0x6e, 0x96, 0x9b, 0x0d, 0xb2,
+	0x41, 0x72, 0xba, 0x87, 0xe9, 0xaa, 0x0a, 0x34, 0x91, 0x0f, 0x09, 0x59,
+	0xed, 0xea, 0x8e, 0xd6, 0xd4, 0xf9, 0x36, 0x66, 0x76, 0x83, 0x19, 0xb4,
+	0xd1, 0xa3, 0x0e, 0x14, 0x9a, 0x4e, 0xcb, 0xe3, 0x74, 0x1f, 0xe1, 0x0b,
+	0xd1, 0x47, 0xa1, 0xb2, 0x48, 0x26, 0x33, 0x75, 0x8c, 0x37, 0x2e, 0x1b,
+	0x0d, 0xcd, 0xe4, 0x08, 0x4c, 0x98, 0x1b, 0x06, 0xdd, 0x67, 0x68, 0x22,
+	0x7b, 0xf8, 0x64, 0xf1, 0x16, 0x82, 0x6d, 0x2f, 0x8d, 0x1e, 0x37, 0x4b,
+	0x9c, 0xa9, 0xd2, 0xd5, 0x36, 0x08, 0x60, 0xc6, 0xe5, 0x69, 0x5f, 0xb4,
+	0xb1, 0x5d, 0x6d, 0x36, 0xc4, 0x38, 0x3b, 0x9d, 0x96, 0xd8, 0xbf, 0xe4,
+	0xca, 0x62, 0xd4, 0xa3, 0x61, 0xba, 0x42, 0xac, 0x76, 0x8b, 0x2b, 0x96,
+	0x13, 0x40, 0x93, 0x52, 0x99, 0x71, 0x8d, 0xa6, 0xc6, 0xda, 0x2f, 0x61,
+	0xb6, 0x5a, 0x6e, 0x97, 0x95, 0xfd, 0x37, 0x74, 0x2b, 0x4d, 0x8a, 0xe5,
+	0x61, 0x55, 0x21, 0x00, 0x31, 0xb1, 0xdb, 0xee, 0x57, 0x2b, 0x2d, 0x8e,
+	0xe8, 0xff, 0x06, 0x4b, 0xa5, 0x5b, 0xa7, 0x51, 0x28, 0xb4, 0x2a, 0xad,
+	0x1d, 0x48, 0xca, 0xda, 0x36, 0xc4, 0x00, 0x44, 0xe3, 0xcc, 0xb1, 0x02,
+	0xd6, 0x2c, 0xae, 0x65, 0x69, 0xb6, 0x15, 0x18, 0xac, 0x70, 0x80, 0x52,
+	0x5d, 0x2d, 0x00, 0x06, 0x2c, 0x7e, 0xd0, 0xab, 0x0d, 0xb0, 0x36, 0x04,
+	0x5c, 0xc9, 0xfa, 0x88, 0xa6, 0x06, 0xeb, 0x63, 0x54, 0x41, 0x0f, 0x51,
+	0x19, 0xd5, 0x65, 0x12, 0x69, 0xbd, 0x7c, 0xa3, 0x77, 0x32, 0xb0, 0xdc,
+	0xee, 0x76, 0xfb, 0x1d, 0xa5, 0x39, 0x0c, 0x14, 0xca, 0x52, 0x00, 0x43,
+	0x0a, 0xb9, 0x59, 0x47, 0xb0, 0x6c, 0xb6, 0x46, 0xc3, 0x66, 0x7a, 0x50,
+	0xbe, 0x26, 0xf3, 0x50, 0xca, 0x67, 0xed, 0x17, 0xe7, 0x6b, 0xb5, 0x86,
+	0xd9, 0x75, 0x01, 0xc2, 0x7c, 0xe5, 0xb7, 0x59, 0x2d, 0x36, 0x34, 0xe4,
+	0x12, 0x5b, 0x46, 0x7b, 0x45, 0x73, 0x2b, 0x65, 0x95, 0x39, 0x49, 0xc8,
+	0x95, 0x4e, 0x4a, 0xf3, 0x2c, 0x0b, 0x03, 0x11, 0x32, 0xb3, 0xd8, 0x6e,
+	0x96, 0x9b, 0xb5, 0x95, 0xe5, 0x55, 0xe9, 0x22, 0xcd, 0x61, 0xb4, 0xdb,
+	0x2e, 0xb7, 0x2b, 0x28, 0x1c, 0xeb, 0x28, 0x9c, 0xa0, 0xb6, 0x48, 0x29,
+	0x49, 0x8e, 0xe8, 0x37, 0x5c, 0x58, 0x04, 0x87, 0x06, 0xf0, 0x15, 0xea,
+	0x2b, 0x4d, 0x73, 0xb2, 0xd9, 0x6d, 0x72, 0xa9, 0x05, 0xc2, 0xe4, 0x3d,
+	0xa3, 0x64, 0x6f, 0xe3, 0x06, 0xb1, 0x68, 0x81, 0xb8, 0x09, 0xd8, 0xdd,
+	0x04, 0xf8, 0x61, 0x41, 0x8e, 0x69, 0xd2, 0x21, 0x9e, 0x52, 0xa9, 0x6d,
+	0xa4, 0x2b, 0xd6, 0x5b, 0x61, 0x23, 0x41, 0xb8, 0x00, 0xd9, 0x84, 0x90,
+	0xd9, 0x54, 0x70, 0x43, 0x81, 0x25, 0xd6, 0x85, 0x23, 0x24, 0x22, 0x2b,
+	0x68, 0xf4, 0x15, 0x92, 0xcb, 0x74, 0x7f, 0x01, 0xb9, 0xa2, 0x36, 0x81,
+	0x51, 0xca, 0x1f, 0xf9, 0x8b, 0x74, 0x8c, 0xa1, 0x0c, 0x8d, 0x6e, 0xb6,
+	0xeb, 0x9d, 0xa6, 0xce, 0xdc, 0x84, 0x9e, 0x06, 0x9e, 0x09, 0x6e, 0x61,
+	0x91, 0x79, 0x61, 0x34, 0xe2, 0x31, 0x02, 0x94, 0x4a, 0x81, 0x42, 0x25,
+	0x20, 0x14, 0x72, 0x09, 0x55, 0x86, 0xe4, 0xa1, 0x22, 0x66, 0xd6, 0x0a,
+	0x10, 0x69, 0x05, 0x63, 0x94, 0xcb, 0x24, 0x02, 0x02, 0xe7, 0x32, 0x26,
+	0x1f, 0x40, 0x7c, 0x41, 0x6d, 0xfc, 0x84, 0x33, 0xf9, 0xd9, 0xae, 0x56,
+	0xfb, 0x69, 0xcc, 0x91, 0x23, 0x3d, 0xca, 0xcb, 0x61, 0xb2, 0x58, 0xac,
+	0x36, 0x30, 0x41, 0x13, 0x25, 0x13, 0x24, 0x17, 0x28, 0x25, 0x1d, 0x84,
+	0x23, 0x2b, 0xc1, 0x5f, 0x89, 0x0e, 0x92, 0x8f, 0x39, 0x10, 0x8d, 0x96,
+	0xc3, 0x6d, 0x61, 0xc7, 0xb0, 0xc2, 0x94, 0x9d, 0x10, 0x11, 0x0a, 0xd5,
+	0x1e, 0x34, 0xac, 0xd6, 0x5b, 0x91, 0x97, 0x0a, 0xb8, 0x95, 0xc1, 0x99,
+	0x89, 0x36, 0xc8, 0x63, 0x49, 0xa5, 0x46, 0xc7, 0x6b, 0x90, 0x0b, 0xe1,
+	0x31, 0x6c, 0xb4, 0x62, 0x12, 0xc8, 0xb8, 0x90, 0x8c, 0x69, 0x5e, 0x4f,
+	0x6c, 0x50, 0x7c, 0x50, 0x69, 0x8f, 0xc1, 0x2c, 0xd6, 0x54, 0x00, 0x29,
+	0x62, 0x10, 0xa5, 0xe2, 0xc2, 0xf7, 0x44, 0x78, 0x49, 0x5b, 0x5e, 0x41,
+	0xb0, 0xd9, 0x06, 0x9c, 0xd5, 0x70, 0xcf, 0x3d, 0x61, 0x56, 0x66, 0xf7,
+	0x19, 0x60, 0xd5, 0x11, 0x02, 0x1d, 0xb5, 0xd8, 0xc5, 0xad, 0x89, 0xaa,
+	0xd0, 0x83, 0x55, 0x0c, 0xc5, 0x41, 0x4c, 0xca, 0x4a, 0xde, 0xb1, 0x43,
+	0x62, 0xba, 0xd9, 0x87, 0x9c, 0x65, 0xd2, 0x0a, 0x7d, 0xba, 0xd8, 0x0c,
+	0x89, 0x6c, 0x61, 0x71, 0x85, 0x4a, 0x94, 0x7c, 0xab, 0x95, 0xfa, 0x95,
+	0x16, 0x87, 0x45, 0xa7, 0x55, 0x25, 0x48, 0x26, 0xa4, 0x1a, 0xaf, 0xa0,
+	0x96, 0x33, 0xbf, 0x17, 0x9a, 0x32, 0xb2, 0x5a, 0x1d, 0x06, 0x87, 0x48,
+	0xa2, 0x95, 0xfb, 0x26, 0xd9, 0x5a, 0xec, 0xb7, 0x00, 0xf1, 0x1b, 0x0c,
+	0x82, 0xcd, 0x65, 0xbb, 0xc2, 0xad, 0x0c, 0x12, 0x2a, 0xf0, 0x43, 0xba,
+	0xa7, 0x4a, 0x37, 0x4b, 0x7d, 0xb2, 0xc8, 0x25, 0x03, 0x77, 0x68, 0x21,
+	0x54, 0xf2, 0x5a, 0xf3, 0x35, 0x22, 0x6a, 0x96, 0x52, 0x74, 0x54, 0x76,
+	0x43, 0x31, 0x31, 0xa2, 0x55, 0xd3, 0x95, 0x4b, 0x41, 0x04, 0x41, 0xe1,
+	0x15, 0x9c, 0x82, 0x87, 0x86, 0x35, 0x82, 0xdb, 0xf8, 0x87, 0x63, 0x91,
+	0xc1, 0x87, 0xfb, 0x25, 0x91, 0x06, 0x7f, 0xe1, 0x4d, 0x46, 0xe7, 0x65,
+	0x47, 0xd3, 0x84, 0x86, 0x83, 0xb1, 0x28, 0xdc, 0xa4, 0x12, 0xab, 0x12,
+	0x38, 0x3a, 0x1f, 0x24, 0xa4, 0x60, 0x2d, 0x3c, 0x0a, 0x55, 0x20, 0x6e,
+	0x21, 0xb2, 0x38, 0xc1, 0x5c, 0x2c, 0xb6, 0x16, 0x7e, 0x54, 0xda, 0x3b,
+	0xa5, 0xbe, 0xde, 0xc2, 0xa3, 0x72, 0x90, 0x58, 0x54, 0x3c, 0x82, 0x44,
+	0xcc, 0xbe, 0x14, 0xf4, 0xac, 0x36, 0xe6, 0xa8, 0x25, 0x19, 0x3a, 0x1d,
+	0x3e, 0x89, 0x45, 0xa1, 0x83, 0xf1, 0x5d, 0x55, 0x30, 0x6c, 0x2e, 0x30,
+	0x36, 0xfb, 0xba, 0xfe, 0x1d, 0x86, 0x41, 0x64, 0xb0, 0xdd, 0x2c, 0x2d,
+	0x2c, 0x29, 0xba, 0x37, 0x5b, 0x6d, 0xc1, 0xa3, 0x15, 0xe4, 0x8a, 0xeb,
+	0x70, 0x57, 0xb4, 0x4d, 0x11, 0xb3, 0xd8, 0x47, 0x74, 0xe1, 0x56, 0xc4,
+	0xe4, 0x12, 0xa1, 0x1a, 0x49, 0x45, 0x1d, 0x84, 0x10, 0xc6, 0xcb, 0x2d,
+	0x52, 0xe1, 0xb3, 0x93, 0x60, 0xda, 0x54, 0xc8, 0x8a, 0x19, 0xed, 0xb6,
+	0x5b, 0x0b, 0xfd, 0x8a, 0xb6, 0xc2, 0xf2, 0x92, 0xbc, 0xb2, 0xa3, 0xaa,
+	0x8c, 0x9c, 0xaa, 0x5a, 0x7e, 0xc2, 0x6a, 0x4b, 0x64, 0xb7, 0xbd, 0x59,
+	0xad, 0x52, 0x2c, 0x58, 0xd9, 0x6d, 0xb7, 0x0b, 0x7b, 0x5a, 0x19, 0x34,
+	0x94, 0xba, 0x41, 0x4c, 0xb4, 0xda, 0xc1, 0xa0, 0x46, 0x17, 0xe2, 0xaf,
+	0x11, 0x3b, 0xaa, 0xb4, 0x1b, 0x83, 0x95, 0xa6, 0xf1, 0x65, 0xb2, 0x4b,
+	0x24, 0x0b, 0x30, 0x36, 0xcb, 0x4b, 0x0d, 0x09, 0x75, 0xc0, 0xfd, 0x41,
+	0x19, 0x54, 0x82, 0x50, 0x40, 0x8d, 0x0a, 0xb4, 0xdb, 0x88, 0x40, 0xae,
+	0xee, 0x02, 0x43, 0xd4, 0x36, 0xfb, 0x22, 0xf4, 0x93, 0x95, 0x31, 0x06,
+	0xaa, 0xb3, 0x18, 0xcb, 0x9a, 0xf4, 0x88, 0x94, 0x08, 0x40, 0x92, 0xd8,
+	0x15, 0x6e, 0x98, 0x1b, 0x45, 0x52, 0x62, 0x71, 0xb2, 0xc2, 0xa9, 0xb6,
+	0x12, 0x3a, 0x15, 0xe9, 0x1a, 0xec, 0xa2, 0x46, 0x1b, 0x25, 0x2d, 0xb9,
+	0x2d, 0x11, 0x4b, 0x6d, 0xab, 0x50, 0xb2, 0x96, 0x62, 0x16, 0x42, 0x30,
+	0xa2, 0xd0, 0xd9, 0x20, 0xb6, 0xfa, 0xad, 0x67, 0x65, 0x38, 0xcf, 0xd8,
+	0x83, 0x98, 0x68, 0x7d, 0x3b, 0xbf, 0xf7, 0xd2, 0x2c, 0xb6, 0xc4, 0x61,
+	0x11, 0xae, 0x19, 0x64, 0x81, 0x15, 0xc6, 0xd8, 0x33, 0x86, 0xea, 0xe5,
+	0x6e, 0xb3, 0x5a, 0x6c, 0xf7, 0x5b, 0x93, 0xec, 0x89, 0x2d, 0x8d, 0x96,
+	0xdb, 0x62, 0xb2, 0xd9, 0x06, 0xcc, 0x9e, 0x14, 0x52, 0x34, 0xad, 0xf6,
+	0x7b, 0x90, 0xe2, 0x0d, 0xd2, 0xc2, 0x9f, 0xa2, 0x8d, 0xa3, 0x73, 0xb8,
+	0x58, 0x47, 0xb0, 0x6d, 0x36, 0xe8, 0x55, 0xa5, 0x59, 0x0d, 0xb2, 0x04,
+	0xc8, 0x4e, 0xf2, 0xee, 0xe6, 0x0b, 0xc6, 0x12, 0x63, 0x6e, 0xb7, 0xdd,
+	0x07, 0x5d, 0x25, 0x52, 0xd2, 0xe8, 0x13, 0x52, 0x54, 0xb4, 0x71, 0xe1,
+	0x22, 0x69, 0x29, 0x01, 0x0b, 0x0d, 0x8a, 0xeb, 0x69, 0xb6, 0x59, 0x21,
+	0x57, 0x4b, 0x4d, 0xb5, 0xd3, 0x05, 0xca, 0xc4, 0x8a, 0x89, 0xea, 0xc5,
+	0xa8, 0xc4, 0x72, 0xce, 0xe7, 0x20, 0xa1, 0xbe, 0x70, 0x81, 0x04, 0x3a,
+	0x70, 0xd9, 0x6e, 0x95, 0xca, 0xfd, 0xd2, 0x54, 0x46, 0x28, 0xe9, 0x45,
+	0x6e, 0xb0, 0xb7, 0x88, 0xd9, 0xdf, 0x6c, 0x53, 0x0c, 0x5f, 0x40, 0x46,
+	0x0e, 0x1c, 0x5c, 0xc6, 0x55, 0x1b, 0x59, 0xda, 0x8c, 0x5d, 0xb8, 0xac,
+	0xd6, 0x9b, 0x90, 0x87, 0x8b, 0x77, 0x9b, 0x51, 0x89, 0x46, 0x0a, 0x8f,
+	0x21, 0x4b, 0x52, 0x1b, 0x09, 0x0b, 0x09, 0x46, 0x0b, 0xcf, 0x93, 0xdf,
+	0x89, 0x3b, 0xac, 0xa1, 0xf4, 0x0a, 0xe7, 0x6f, 0x6b, 0xe2, 0x1b, 0xf1,
+	0x09, 0x71, 0x68, 0x33, 0x04, 0xc2, 0x68, 0xa5, 0x12, 0x81, 0xb9, 0x59,
+	0x51, 0xa0, 0x8a, 0x44, 0x8d, 0x24, 0xae, 0x6e, 0x56, 0x45, 0x38, 0x92,
+	0x0b, 0x0d, 0x98, 0x39, 0x44, 0x84, 0xcc, 0xa8, 0xa5, 0xc5, 0xcd, 0x22,
+	0xd1, 0xa3, 0x10, 0xd6, 0x48, 0x7d, 0x4d, 0xd2, 0xa6, 0xc9, 0x2e, 0x85,
+	0x0e, 0xc9, 0x3a, 0xf2, 0x02, 0xf0, 0x96, 0xc9, 0x59, 0x4b, 0x54, 0x5f,
+	0xa9, 0x0a, 0x2c, 0x9e, 0x80, 0x93, 0x84, 0x47, 0xec, 0xae, 0x76, 0x1b,
+	0x35, 0x94, 0x28, 0x8a, 0x5d, 0x2f, 0x08, 0x64, 0x90, 0x4b, 0x6f, 0x12,
+	0x09, 0x6d, 0x16, 0xd0, 0xcb, 0x24, 0x0a, 0x65, 0x2e, 0xba, 0x5e, 0x08,
+	0x5c, 0x41, 0x64, 0xac, 0x61, 0x46, 0x23, 0x5c, 0x48, 0xd4, 0x21, 0x54,
+	0xae, 0x2e, 0x61, 0x7a, 0x20, 0xa6, 0x42, 0x6a, 0x22, 0x18, 0x87, 0x8d,
+	0xac, 0xba, 0x52, 0x09, 0xe8, 0x38, 0x5c, 0xa2, 0x4c, 0x0a, 0x65, 0x29,
+	0x9d, 0xc8, 0x25, 0xf2, 0xa0, 0x57, 0x43, 0x27, 0x31, 0xdd, 0x49, 0x54,
+	0xbc, 0xd7, 0x84, 0x21, 0xff, 0x21, 0x47, 0x60, 0xe3, 0xb2, 0xab, 0x08,
+	0xc0, 0x15, 0x0d, 0x2d, 0x55, 0x5c, 0x0c, 0xab, 0x06, 0xe5, 0x67, 0x6e,
+	0x41, 0xb6, 0xdb, 0xee, 0xa2, 0x72, 0x25, 0xb4, 0x28, 0xaa, 0x45, 0xa6,
+	0x24, 0xb8, 0x2d, 0x26, 0x56, 0x13, 0x3a, 0x22, 0x6b, 0x21, 0x9f, 0x13,
+	0x1e, 0x11, 0x57, 0x1b, 0x25, 0xc9, 0xcc, 0x09, 0xa2, 0x5a, 0x15, 0x6d,
+	0xb4, 0xd9, 0xed, 0x17, 0x47, 0x9f, 0x3b, 0xba, 0x55, 0x2d, 0xde, 0xc2,
+	0xd4, 0x62, 0x48, 0x05, 0x69, 0x6c, 0x11, 0xa5, 0x5b, 0xec, 0x57, 0x31,
+	0x29, 0x34, 0xb1, 0x1b, 0x9d, 0xd6, 0xc5, 0x6d, 0x22, 0xc2, 0x57, 0x61,
+	0x29, 0x82, 0xb8, 0x5b, 0xed, 0xf6, 0xc2, 0xd9, 0x2b, 0xbd, 0xbe, 0xe5,
+	0x6b, 0x77, 0xf3, 0x1f, 0xa2, 0x6f, 0xd1, 0x08, 0x91, 0x1f, 0xb1, 0x66,
+	0x11, 0x1d, 0xa1, 0xb5, 0x5b, 0xec, 0x4a, 0x44, 0x96, 0xeb, 0x4d, 0xce,
+	0xd0, 0x60, 0xc2, 0x46, 0x46, 0x90, 0x07, 0x20, 0xb2, 0x91, 0x98, 0x99,
+	0x01, 0xa7, 0x1b, 0x58, 0xcc, 0x3c, 0x47, 0xfc, 0xa1, 0x44, 0xb6, 0xa3,
+	0x2c, 0x80, 0x6a, 0xc4, 0x82, 0x36, 0x2b, 0xc8, 0xc6, 0x8d, 0xb2, 0xd8,
+	0xf8, 0x4a, 0xdc, 0x09, 0x64, 0xb2, 0xdc, 0xec, 0x77, 0x2b, 0x4d, 0xc1,
+	0xe9, 0x45, 0x3f, 0xe0, 0x63, 0x8a, 0xb9, 0x5f, 0xb3, 0x59, 0x25, 0x4e,
+	0x6a, 0x77, 0x0b, 0x4d, 0x8e, 0xd6, 0x52, 0x24, 0x37, 0x2e, 0x36, 0x42,
+	0xed, 0xa3, 0x70, 0x54, 0x85, 0x3e, 0xb6, 0x4b, 0x42, 0xb6, 0x59, 0x6e,
+	0x96, 0x59, 0x50, 0xb8, 0xaa, 0xa4, 0x9d, 0x86, 0x41, 0x68, 0x15, 0x51,
+	0x77, 0xf1, 0x95, 0x5c, 0x2e, 0x56, 0x9b, 0x7b, 0x7c, 0x8d, 0xe4, 0x8b,
+	0xc5, 0x4f, 0x0a, 0xeb, 0x6e, 0x75, 0xd5, 0x2c, 0xe4, 0x1b, 0x22, 0x17,
+	0x85, 0x12, 0xa1, 0xb1, 0xd9, 0x6d, 0x96, 0xc5, 0x20, 0x2b, 0x33, 0x7f,
+	0x15, 0xa1, 0x12, 0x05, 0xe8, 0x11, 0x06, 0x84, 0x03, 0xd0, 0xd0, 0x44,
+	0xb1, 0xca, 0xdd, 0x20, 0xad, 0x8c, 0x71, 0x4b, 0xac, 0x75, 0xda, 0xdd,
+	0x75, 0x26, 0x08, 0xd0, 0x09, 0x5e, 0x0d, 0xf8, 0xc9, 0x06, 0x4c, 0xcb,
+	0x16, 0xd9, 0x69, 0xb1, 0x27, 0x81, 0xa0, 0x3a, 0x5b, 0x2d, 0x96, 0xfb,
+	0x19, 0x8e, 0x0d, 0xcd, 0x45, 0x99, 0x07, 0xc5, 0xff, 0x0c, 0x67, 0x5a,
+	0x51, 0x5b, 0xa8, 0x53, 0xea, 0x74, 0x9a, 0xc1, 0x6b, 0x89, 0x8e, 0x34,
+	0xa5, 0x5c, 0xcd, 0x22, 0x84, 0xb9, 0x8c, 0x81, 0x46, 0xd6, 0xd0, 0x48,
+	0x55, 0xc2, 0xa3, 0xc4, 0xb9, 0xc4, 0x6e, 0xaa, 0x31, 0xc4, 0x6f, 0x64,
+	0x6b, 0x55, 0x63, 0x50, 0x91, 0xba, 0x59, 0x65, 0x07, 0x20, 0x46, 0x60,
+	0xc1, 0x08, 0x27, 0x3a, 0x66, 0xb5, 0x44, 0x26, 0x37, 0x4b, 0x95, 0xbe,
+	0xf2, 0xbc, 0x2c, 0x6c, 0x2c, 0x16, 0x82, 0xba, 0x16, 0x2f, 0xe8, 0x74,
+	0x7e, 0x44, 0x11, 0x5d, 0x74, 0x1b, 0x21, 0x5e, 0x82, 0x1b, 0x21, 0x3b,
+	0x4d, 0x2a, 0x44, 0x3a, 0x3f, 0x1e, 0xd7, 0xec, 0xf7, 0x30, 0xfd, 0x58,
+	0x97, 0x54, 0xe8, 0xff, 0xc0, 0x6c, 0x27, 0x66, 0xb2, 0x1d, 0x1f, 0xe2,
+	0x15, 0x41, 0x2a, 0x39, 0x1b, 0x22, 0x1b, 0x95, 0x26, 0xa7, 0x95, 0x25,
+	0xc0, 0xdd, 0x6d, 0x8e, 0x3c, 0x20, 0x42, 0x32, 0xaa, 0x9d, 0x22, 0xa5,
+	0x49, 0xa7, 0x52, 0xeb, 0x95, 0xfa, 0x1d, 0x06, 0x9d, 0x43, 0xa2, 0xd3,
+	0x29, 0x94, 0x5a, 0x24, 0xa9, 0x64, 0x4e, 0x15, 0x5b, 0x50, 0x14, 0x97,
+	0x5a, 0x0c, 0xb0, 0x85, 0xac, 0x9d, 0x69, 0x2c, 0xb6, 0xc1, 0xa2, 0x10,
+	0x21, 0x17, 0x0c, 0x91, 0xb2, 0x17, 0x1c, 0x29, 0x74, 0x2a, 0x15, 0x46,
+	0xb7, 0xdc, 0x96, 0xf4, 0x53, 0x88, 0xef, 0x36, 0xfb, 0xad, 0xca, 0x41,
+	0x6f, 0xbb, 0xbd, 0x61, 0x37, 0x30, 0xdb, 0xac, 0xac, 0x38, 0x36, 0x26,
+	0xa3, 0x1a, 0x4c, 0xbe, 0x9e, 0x25, 0x26, 0x03, 0xa4, 0xe1, 0x92, 0xa3,
+	0x43, 0x73, 0x71, 0xc2, 0x96, 0x09, 0xa1, 0x58, 0xed, 0x10, 0xa1, 0x9f,
+	0x46, 0xbc, 0x16, 0xf8, 0x55, 0x35, 0x29, 0x64, 0x82, 0xdb, 0x6f, 0x76,
+	0x11, 0x61, 0x82, 0xb4, 0xd9, 0xad, 0x22, 0x54, 0x22, 0xd2, 0x2e, 0xbe,
+	0x52, 0xc9, 0x05, 0x9a, 0xe5, 0x6f, 0xb6, 0xbc, 0x83, 0x26, 0xb1, 0x8e,
+	0xb2, 0xb9, 0xcc, 0x38, 0xf0, 0x8b, 0x59, 0x09, 0x29, 0xbc, 0x11, 0xb6,
+	0xa0, 0xb7, 0xe1, 0x36, 0x90, 0xda, 0x2e, 0xb6, 0xeb, 0x5d, 0xce, 0x5d,
+	0x20, 0xa4, 0xdd, 0x24, 0x16, 0xbb, 0x2d, 0x96, 0xe0, 0x5c, 0x08, 0xa6,
+	0xa4, 0xd0, 0x89, 0x36, 0x9a, 0x4b, 0x54, 0x68, 0x61, 0x56, 0x1b, 0x1d,
+	0x8e, 0xeb, 0x6d, 0xba, 0x8e, 0x38, 0xb5, 0xe0, 0xb3, 0x51, 0x5b, 0x6d,
+	0xf7, 0x64, 0x99, 0x2b, 0x45, 0xbd, 0xb8, 0xc4, 0x31, 0x51, 0xa1, 0x49,
+	0x9a, 0xc5, 0xc0, 0x88, 0x08, 0x46, 0xd2, 0xcc, 0x02, 0xf3, 0xa2, 0xd2,
+	0xe3, 0x74, 0xb7, 0xc2, 0x92, 0xbd, 0xe8, 0x54, 0x9a, 0xa5, 0x4e, 0xb9,
+	0x5f, 0xa6, 0xd0, 0x6b, 0x12, 0xa9, 0x04, 0xa2, 0x6b, 0x36, 0x94, 0xae,
+	0x1a, 0x00, 0x0a, 0x58, 0x6d, 0x8d, 0x48, 0x24, 0xda, 0x6e, 0x00, 0x25,
+	0x4c, 0x32, 0xe9, 0x05, 0x09, 0x71, 0x48, 0x5e, 0x16, 0xe1, 0x65, 0xb2,
+	0x9a, 0x41, 0x58, 0x6e, 0x92, 0xc8, 0x53, 0x90, 0x9b, 0xc5, 0x15, 0xcc,
+	0xba, 0x85, 0xd8, 0x49, 0xb1, 0x46, 0xca, 0xf3, 0x49, 0x61, 0x74, 0x93,
+	0xb2, 0x35, 0x58, 0xa9, 0x14, 0x5b, 0x2d, 0xf6, 0xfb, 0x5b, 0x06, 0x15,
+	0x86, 0xc4, 0xdc, 0x62, 0x3c, 0xeb, 0x6c, 0x66, 0xb2, 0xb3, 0x59, 0x6e,
+	0xf0, 0xa5, 0x55, 0x47, 0x99, 0x3b, 0x5d, 0xa6, 0xe1, 0x70, 0x00, 0xf1,
+	0x90, 0x55, 0x6d, 0xc5, 0xf6, 0x4d, 0xe8, 0x54, 0x5b, 0x65, 0xa6, 0xc3,
+	0x73, 0x96, 0xd1, 0xec, 0x36, 0xdb, 0x6d, 0x86, 0x41, 0x6e, 0xba, 0xdb,
+	0x6c, 0x56, 0x5b, 0x93, 0xff, 0xa5, 0x86, 0xd8, 0xf3, 0xa2, 0x39, 0xe4,
+	0xc8, 0xa3, 0x4f, 0x5c, 0xa2, 0x39, 0xe1, 0xb2, 0x8a, 0x88, 0x81, 0x08,
+	0xcc, 0x45, 0x88, 0xa6, 0x53, 0x05, 0x19, 0x3b, 0xb5, 0x86, 0xd9, 0x75,
+	0x75, 0x44, 0x19, 0xf4, 0xb0, 0xd8, 0x97, 0xf8, 0xa7, 0x13, 0x0a, 0x6d,
+	0xa6, 0x85, 0x2f, 0x55, 0x81, 0xba, 0x5d, 0xed, 0x36, 0x37, 0xe9, 0x29,
+	0x05, 0x99, 0x9a, 0xc8, 0xad, 0x44, 0x0e, 0x08, 0x43, 0xd1, 0x74, 0x4c,
+	0xa4, 0x45, 0xd8, 0xce, 0x5d, 0x20, 0xa0, 0xaa, 0x6a, 0x0b, 0x68, 0x8d,
+	0xbf, 0x29, 0x66, 0xd9, 0xad, 0x97, 0x5b, 0x9d, 0xa2, 0x54, 0x08, 0x24,
+	0x77, 0x12, 0xa6, 0xa5, 0x5f, 0xb8, 0x5d, 0x43, 0xc1, 0xde, 0x38, 0xcd,
+	0x98, 0xa5, 0x81, 0x19, 0x16, 0xcb, 0x78, 0x88, 0x0b, 0xd9, 0x1d, 0xd9,
+	0xe9, 0xe6, 0xdc, 0x76, 0x9a, 0xf1, 0xc7, 0x67, 0x0e, 0xf8, 0x79, 0xef,
+	0xc5, 0xb9, 0xe9, 0xff, 0x32, 0xab, 0xb1, 0xc3, 0x93, 0xd4, 0xfd, 0x78,
+	0x7b, 0x65, 0x51, 0x79, 0x6f, 0xe8, 0xf9, 0x1f, 0x96, 0xb5, 0x27, 0x96,
+	0xfe, 0x8f, 0x91, 0xf9, 0x77, 0x93, 0x79, 0x6f, 0x3e, 0x4f, 0xe2, 0xc3,
+	0x6c, 0x56, 0x11, 0x79, 0x6f, 0x3e, 0x4f, 0xe1, 0xe4, 0xc6, 0xbf, 0x75,
+	0x6b, 0xf2, 0x79, 0x6f, 0xf3, 0xbe, 0x4f, 0xec, 0x3e, 0x3f, 0xd8, 0x02,
+	0x48, 0xf0, 0x7f, 0x6b, 0xf6, 0x76, 0xcf, 0x27, 0x96, 0xff, 0x3b, 0xe4,
+	0xfe, 0xc6, 0x07, 0xfd, 0x80, 0x24, 0x65, 0x88, 0x25, 0xeb, 0x05, 0x68,
+	0x56, 0xd2, 0x3e, 0x1b, 0x6d, 0x86, 0xd8, 0xc6, 0x63, 0x70, 0x67, 0x31,
+	0xb2, 0xdb, 0xac, 0x76, 0x9b, 0x2a, 0xac, 0x0d, 0xaa, 0xea, 0xab, 0xa4,
+	0xb4, 0xe2, 0xae, 0xed, 0x72, 0xb2, 0xae, 0xd8, 0x95, 0x58, 0xd9, 0xae,
+	0xb6, 0xeb, 0x1d, 0xd2, 0xd3, 0x6f, 0xb7, 0x5c, 0xe1, 0x52, 0x8b, 0x9d,
+	0xc2, 0xcb, 0x63, 0x56, 0x43, 0xb6, 0x17, 0x40, 0xd6, 0xcc, 0x38, 0x6e,
+	0x76, 0x5b, 0xa1, 0x6b, 0x99, 0x27, 0x12, 0xf2, 0x91, 0x2a, 0xbd, 0x8e,
+	0xd1, 0x72, 0x2d, 0x73, 0x33, 0x93, 0x2f, 0x11, 0x39, 0xd1, 0x62, 0xe4,
+	0x43, 0xf2, 0xb4, 0x95, 0x50, 0xc2, 0x8b, 0x34, 0x4b, 0x88, 0x4b, 0x38,
+	0x49, 0xa0, 0xad, 0xb7, 0x03, 0x2c, 0x23, 0x39, 0x2a, 0xd9, 0xcf, 0x0d,
+	0xb2, 0xcb, 0x6e, 0x29, 0xc3, 0x6d, 0xd6, 0x35, 0x22, 0x94, 0xcb, 0xa4,
+	0x15, 0xbb, 0x0d, 0xce, 0xe7, 0x65, 0xb9, 0x12, 0xa1, 0x16, 0xf1, 0x15,
+	0x9b, 0xad, 0xa8, 0xd9, 0xa1, 0x4a, 0x0e, 0x24, 0x04, 0x37, 0x6b, 0x2b,
+	0x7e, 0x15, 0xa0, 0xce, 0x4a, 0xe5, 0x6f, 0xb6, 0x5b, 0x14, 0x1a, 0x0c,
+	0x39, 0x48, 0xd9, 0xd7, 0xd9, 0x24, 0x15, 0xbb, 0x2b, 0x6b, 0x0d, 0x92,
+	0xc9, 0x65, 0xb2, 0x19, 0x61, 0x5c, 0xef, 0x37, 0x3b, 0xa5, 0x96, 0xdb,
+	0x2c, 0x90, 0x59, 0x2d, 0xf0, 0xab, 0x75, 0xbe, 0xe9, 0x20, 0xb4, 0xa2,
+	0x09, 0x5b, 0x6c, 0xa6, 0xfa, 0x76, 0x55, 0x27, 0x13, 0x01, 0x8b, 0x75,
+	0x86, 0xd3, 0x76, 0xb2, 0x92, 0x58, 0xcb, 0x5a, 0x34, 0xd6, 0xac, 0x4b,
+	0x90, 0xad, 0xf7, 0x79, 0x05, 0xbe, 0xe0, 0xe9, 0x43, 0x69, 0xbd, 0x17,
+	0x10, 0x99, 0xc6, 0x4b, 0x21, 0x49, 0xb2, 0x37, 0x94, 0x9b, 0x12, 0xee,
+	0x13, 0x2d, 0x1b, 0x92, 0xf3, 0x0a, 0x6c, 0x1d, 0xc2, 0xcb, 0x72, 0x4d,
+	0x51, 0xb6, 0x9f, 0xe9, 0x25, 0x59, 0x5d, 0x2d, 0x0e, 0xb2, 0x23, 0xf6,
+	0xd2, 0x85, 0xe1, 0x24, 0xd9, 0x24, 0xa4, 0x16, 0x00, 0x35, 0x07, 0x28,
+	0x51, 0x8f, 0x24, 0xa5, 0x3e, 0x44, 0x7d, 0xca, 0xb7, 0x43, 0xa7, 0xd1,
+	0x28, 0xb4, 0x32, 0xc6, 0x5b, 0x29, 0x20, 0x99, 0x24, 0x9d, 0xce, 0xca,
+	0xf5, 0x43, 0x74, 0x34, 0x91, 0x6f, 0xc2, 0x4d, 0x92, 0x24, 0x11, 0x65,
+	0x83, 0x53, 0xe4, 0x26, 0x69, 0x90, 0x27, 0xf8, 0xd8, 0xd2, 0x60, 0x61,
+	0x56, 0x3b, 0x45, 0x86, 0xe5, 0x61, 0xb1, 0xba, 0xa8, 0xb9, 0x19, 0x1e,
+	0x61, 0x5b, 0x6e, 0xb7, 0x3b, 0x62, 0x68, 0x95, 0x0c, 0x7e, 0x9e, 0xe6,
+	0x6b, 0x62, 0xb7, 0xc4, 0xc7, 0xe4, 0x6c, 0x08, 0xe7, 0x64, 0x66, 0xe9,
+	0x76, 0xb2, 0xa1, 0xd1, 0x19, 0x69, 0xc2, 0x9b, 0xc4, 0x5c, 0xec, 0x8c,
+	0x06, 0x2e, 0x77, 0x54, 0x04, 0x17, 0x2c, 0x14, 0x07, 0x97, 0x59, 0x1b,
+	0x75, 0xbe, 0xdd, 0x2d, 0x46, 0x61, 0xbb, 0x1f, 0x08, 0xa7, 0xc8, 0xd5,
+	0xca, 0x44, 0x90, 0x98, 0xe9, 0x95, 0xaa, 0x9d, 0x4d, 0x34, 0x48, 0xf3,
+	0xec, 0xae, 0x09, 0x39, 0x86, 0xcd, 0x61, 0xb4, 0xdc, 0x89, 0x2c, 0x6d,
+	0x96, 0x1b, 0x95, 0x9d, 0x70, 0x86, 0xeb, 0x66, 0xb3, 0x34, 0x08, 0xca,
+	0x2f, 0xd3, 0x4a, 0x5d, 0xa6, 0x84, 0x41, 0xca, 0xe7, 0x65, 0x6f, 0xb7,
+	0x42, 0x8d, 0x7c, 0x88, 0xf0, 0x65, 0x25, 0x92, 0x96, 0xcb, 0x7d, 0x8c,
+	0x8c, 0x4d, 0xa6, 0xd6, 0xe7, 0x74, 0xb0, 0xd8, 0xed, 0x72, 0xe9, 0x01,
+	0xe5, 0x9d, 0x4a, 0x99, 0x45, 0x4a, 0x8c, 0x68, 0x81, 0x64, 0xb1, 0x28,
+	0x51, 0x41, 0xc1, 0x3e, 0xc2, 0xb6, 0x5e, 0x61, 0x56, 0xeb, 0x2d, 0x9c,
+	0x33, 0x06, 0xd2, 0xd2, 0xe4, 0x76, 0x82, 0x5e, 0x43, 0x63, 0xb2, 0xad,
+	0xa0, 0xd5, 0x0e, 0x7c, 0xd3, 0x20, 0xd4, 0x14, 0xd3, 0xcd, 0x88, 0xec,
+	0x50, 0x44, 0x6f, 0x2c, 0x98, 0x2d, 0x10, 0x47, 0x0a, 0x2d, 0x2e, 0x36,
+	0xd5, 0xaa, 0x28, 0x51, 0x89, 0x33, 0x39, 0x0d, 0xda, 0xd3, 0x72, 0xb7,
+	0xdb, 0x8c, 0xc8, 0x95, 0x20, 0xdb, 0x9c, 0x58, 0xbc, 0xee, 0x97, 0x7b,
+	0x7b, 0x04, 0x0d, 0xb2, 0xea, 0x60, 0xa8, 0x7e, 0x26, 0xeb, 0x22, 0xae,
+	0x2b, 0x2c, 0x90, 0x59, 0x58, 0xec, 0x6c, 0xb7, 0x28, 0x53, 0x3e, 0x0b,
+	0x79, 0x8d, 0xcd, 0x13, 0xd6, 0x41, 0x73, 0xb6, 0x5a, 0x5c, 0xe8, 0xee,
+	0xf6, 0x9b, 0x75, 0x90, 0xd7, 0x06, 0xc9, 0x69, 0x23, 0x93, 0x43, 0x93,
+	0x36, 0x42, 0x3a, 0xb3, 0x29, 0x11, 0x72, 0x91, 0x5c, 0x4e, 0x36, 0x41,
+	0x6f, 0x72, 0x50, 0x17, 0x55, 0xba, 0x6b, 0x12, 0x5c, 0x49, 0x28, 0x42,
+	0x3b, 0x41, 0xb9, 0xab, 0x19, 0x59, 0x6c, 0xc4, 0x8c, 0x36, 0x92, 0x15,
+	0x1b, 0xcc, 0xa6, 0x41, 0x6f, 0xb9, 0x48, 0x2c, 0x57, 0x96, 0x7b, 0x17,
+	0x5c, 0x2b, 0x75, 0x9c, 0xde, 0x09, 0x04, 0x46, 0xc7, 0x72, 0xb7, 0xc8,
+	0x25, 0x55, 0x5a, 0x9d, 0x16, 0xb9, 0x5f, 0xa9, 0xd5, 0x28, 0x35, 0x4a,
+	0x4d, 0x0e, 0x54, 0x7f, 0xa4, 0x50, 0x8a, 0xe9, 0x2a, 0xa9, 0x66, 0x6f,
+	0xc6, 0x83, 0x43, 0x6e, 0x4c, 0xa1, 0x38, 0xb2, 0x55, 0xc9, 0xba, 0x5b,
+	0xe1, 0x56, 0x23, 0x99, 0x36, 0xef, 0x25, 0x2d, 0x1b, 0x1b, 0x78, 0x0d,
+	0xbe, 0xe5, 0x61, 0x4c, 0xa1, 0xb2, 0x5d, 0x54, 0xb0, 0xad, 0xef, 0xf8,
+	0x28, 0x02, 0x96, 0xdb, 0x2d, 0x85, 0x6a, 0x49, 0x28, 0x3f, 0x46, 0xfc,
+	0x46, 0x50, 0x6d, 0x56, 0x35, 0xbb, 0x95, 0x94, 0xcc, 0xc6, 0xe5, 0x61,
+	0xb7, 0x16, 0x29, 0xdb, 0x99, 0x40, 0x6b, 0x77, 0x4b, 0x43, 0x9b, 0x94,
+	0x82, 0xe7, 0x61, 0xb3, 0x13, 0x09, 0x1e, 0x40, 0xd1, 0xae, 0xb7, 0x25,
+	0xbf, 0x29, 0x05, 0x8c, 0x87, 0x86, 0xde, 0x6c, 0x62, 0xac, 0x28, 0xc2,
+	0x2a, 0x3f, 0x6d, 0x63, 0x30, 0xe1, 0x6a, 0xb1, 0xb2, 0x5b, 0xed, 0xc9,
+	0x96, 0x37, 0x99, 0x05, 0x96, 0xc8, 0x7d, 0x62, 0x8a, 0x05, 0x6f, 0x2a,
+	0x31, 0x78, 0x83, 0x97, 0x58, 0xdc, 0x64, 0xd5, 0x2c, 0xd2, 0x24, 0xee,
+	0x85, 0x6e, 0x37, 0x52, 0x49, 0x3b, 0x4d, 0x92, 0xcb, 0x61, 0xb6, 0x4b,
+	0x0d, 0x68, 0xac, 0xa8, 0xb2, 0x2e, 0x6f, 0x65, 0x94, 0x2e, 0xac, 0x37,
+	0x92, 0x72, 0x33, 0x8b, 0x2b, 0x1d, 0xbe, 0xdd, 0x66, 0xb4, 0xd9, 0xdb,
+	0x0c, 0x54, 0xf0, 0x61, 0x4a, 0x54, 0x56, 0xdb, 0x2a, 0x10, 0x11, 0x3f,
+	0x9b, 0x31, 0x99, 0x3f, 0x09, 0x9a, 0x9b, 0x7b, 0x8d, 0x9e, 0xd3, 0x6e,
+	0x65, 0xa2, 0x39, 0xa2, 0x75, 0xeb, 0x90, 0x54, 0x1e, 0xe6, 0x11, 0x0c,
+	0xdd, 0x11, 0x21, 0x4f, 0x56, 0xc0, 0xa8, 0x36, 0x9b, 0x75, 0x8e, 0xd9,
+	0x75, 0xb2, 0x1c, 0x4a, 0x1a, 0x89, 0x58, 0x6d, 0x0e, 0x22, 0x49, 0x9a,
+	0xab, 0xda, 0x48, 0x48, 0x8b, 0xc5, 0x2b, 0xb6, 0x88, 0xe8, 0x20, 0x60,
+	0x64, 0xe6, 0x2c, 0xbc, 0x84, 0x10, 0xa8, 0x24, 0x72, 0x02, 0xa8, 0x1b,
+	0x3d, 0xd2, 0xd0, 0xe6, 0x8c, 0x94, 0x7f, 0x10, 0x91, 0x54, 0x47, 0xd6,
+	0x9b, 0x9c, 0x28, 0xac, 0xcd, 0xea, 0xe9, 0x09, 0x12, 0xdf, 0x6e, 0x24,
+	0xb1, 0x7b, 0x87, 0x79, 0xa3, 0x3b, 0x12, 0xba, 0xdb, 0x81, 0x9d, 0x9e,
+	0x1d, 0x4f, 0x21, 0x92, 0x91, 0x9e, 0xe2, 0x5d, 0x10, 0x8a, 0xcc, 0xda,
+	0xac, 0x6c, 0x76, 0x8b, 0x79, 0xf3, 0x89, 0xfe, 0x90, 0x68, 0x13, 0x41,
+	0x11, 0xbe, 0x88, 0x36, 0x0c, 0xa8, 0x50, 0xd2, 0xb9, 0x5f, 0xb6, 0x5e,
+	0xae, 0x77, 0x39, 0x54, 0xb2, 0x14, 0x80, 0x29, 0x74, 0xb0, 0xda, 0xd4,
+	0x90, 0x65, 0x54, 0x5a, 0x4c, 0xaa, 0x58, 0x27, 0x83, 0x4a, 0x67, 0x51,
+	0x27, 0x41, 0x95, 0x54, 0x05, 0x19, 0x0e, 0x14, 0x6c, 0x97, 0x55, 0x46,
+	0x13, 0xf3, 0x47, 0xbb, 0x19, 0x01, 0xc9, 0x1d, 0xd1, 0x1e, 0x86, 0x15,
+	0x2a, 0x3d, 0x03, 0xae, 0x57, 0xd2, 0x90, 0xa5, 0x53, 0xa8, 0x50, 0xd8,
+	0x58, 0x95, 0x10, 0xe5, 0xb0, 0xec, 0x0d, 0xa6, 0xdf, 0x2c, 0x35, 0x52,
+	0x58, 0x51, 0xb1, 0xdb, 0xec, 0x96, 0x59, 0x64, 0x2a, 0x13, 0x09, 0x1d,
+	0xe7, 0xb2, 0xda, 0x47, 0x72, 0x6c, 0xb6, 0xa1, 0xdc, 0x9b, 0x80, 0xf9,
+	0xa3, 0xb7, 0x25, 0x85, 0x0c, 0x86, 0xef, 0x72, 0xb0, 0xdc, 0x0e, 0x3c,
+	0x49, 0xfc, 0x6d, 0xf7, 0x52, 0x74, 0x11, 0xdd, 0x19, 0x5c, 0xae, 0x41,
+	0x63, 0xb6, 0x16, 0x00, 0x93, 0xc8, 0x99, 0x70, 0x91, 0x88, 0x8a, 0x08,
+	0xba, 0xfa, 0x4e, 0xa7, 0x42, 0x54, 0x53, 0xca, 0x2d, 0x26, 0x59, 0x20,
+	0xa2, 0xd2, 0xa5, 0x92, 0x0a, 0x84, 0xb2, 0x15, 0x43, 0xa4, 0x4f, 0xa5,
+	0x46, 0x14, 0x4e, 0xbc, 0xd6, 0x8b, 0x81, 0x4d, 0x92, 0x12, 0x11, 0xff,
+	0x0d, 0xa1, 0x1e, 0xc4, 0xf8, 0x85, 0xcd, 0x19, 0xee, 0x29, 0x49, 0x51,
+	0x9f, 0x98, 0x01, 0x89, 0x41, 0x45, 0x63, 0xc5, 0x68, 0x45, 0x10, 0x90,
+	0xe5, 0x45, 0x5a, 0x45, 0xeb, 0x18, 0xc1, 0x51, 0xd1, 0x15, 0x2e, 0x4c,
+	0xc2, 0xc5, 0xd3, 0x08, 0xe1, 0x46, 0xce, 0xf7, 0x43, 0x2e, 0x90, 0x53,
+	0xc2, 0xec, 0x8c, 0xdc, 0x40, 0x19, 0xca, 0x15, 0x6d, 0x24, 0xd0, 0x96,
+	0x94, 0xf9, 0x32, 0x24, 0x21, 0x2a, 0x29, 0x75, 0x8c, 0x8c, 0x0d, 0x66,
+	0x4e, 0xc3, 0x76, 0xb0, 0xda, 0x6d, 0x8f, 0x66, 0x46, 0x6c, 0x23, 0xd4,
+	0x36, 0x71, 0x35, 0x13, 0x8c, 0x1a, 0x1c, 0x82, 0x83, 0x50, 0xa4, 0xc2,
+	0xa5, 0x02, 0x7a, 0x47, 0x34, 0x53, 0x19, 0x81, 0xf8, 0x14, 0xc6, 0x64,
+	0x23, 0x6a, 0x28, 0x84, 0x73, 0x63, 0x34, 0x05, 0x03, 0x13, 0xc3, 0x30,
+	0x23, 0x99, 0x98, 0x76, 0x4d, 0x5b, 0x28, 0x44, 0x74, 0xc5, 0x34, 0x6d,
+	0xf6, 0x68, 0x54, 0xca, 0x52, 0x33, 0xa2, 0x22, 0x23, 0x65, 0xba, 0x5d,
+	0x6e, 0x48, 0xe6, 0x2a, 0x6a, 0x2a, 0x5a, 0x62, 0xca, 0x4c, 0x50, 0x37,
+	0x99, 0x05, 0xbd, 0x6f, 0xca, 0x5c, 0x3e, 0x26, 0x53, 0xea, 0x1f, 0x68,
+	0xad, 0xa4, 0x76, 0x04, 0x3f, 0x8d, 0x0a, 0xb2, 0x5a, 0x6e, 0x56, 0x5b,
+	0x1d, 0xd2, 0xd9, 0x79, 0x97, 0x48, 0x29, 0xd6, 0xf0, 0xbe, 0x23, 0xb7,
+	0x32, 0xf3, 0x31, 0xf3, 0x17, 0x93, 0x94, 0xb9, 0x29, 0x63, 0x84, 0x1a,
+	0xcd, 0x15, 0x96, 0xf1, 0x63, 0xb2, 0xa7, 0x4a, 0x4b, 0x09, 0xbd, 0x2c,
+	0xb0, 0xa7, 0x3c, 0xab, 0x9d, 0xd1, 0xa3, 0x89, 0xaa, 0xc6, 0xd8, 0xec,
+	0x42, 0x97, 0x62, 0x23, 0x86, 0x3b, 0xa4, 0xcf, 0x4a, 0x1c, 0x2d, 0x74,
+	0xb2, 0xdc, 0xee, 0x92, 0x0b, 0x22, 0x48, 0x8a, 0x68, 0x89, 0x4f, 0xaa,
+	0x3e, 0x8d, 0x86, 0xd3, 0x6e, 0x76, 0x53, 0x7a, 0xa2, 0xba, 0x21, 0x30,
+	0xa7, 0x90, 0xb2, 0x10, 0xde, 0x2c, 0x28, 0xc0, 0x4d, 0x5a, 0x48, 0xca,
+	0x36, 0x54, 0x21, 0x10, 0x0e, 0x13, 0x94, 0x34, 0x71, 0x16, 0x5e, 0x11,
+	0x10, 0x27, 0x11, 0x1b, 0x9c, 0x82, 0xcd, 0x72, 0xb7, 0xdb, 0x52, 0xf4,
+	0x6b, 0x74, 0x6a, 0x4a, 0x89, 0x23, 0x49, 0x8d, 0x92, 0xd8, 0xd0, 0xac,
+	0xee, 0x2a, 0x74, 0x14, 0xf2, 0x6f, 0x74, 0xb9, 0xd9, 0x6d, 0x8d, 0x5e,
+	0x37, 0x36, 0x5e, 0x34, 0x6b, 0x7b, 0x9d, 0x94, 0xe8, 0xce, 0xcd, 0x75,
+	0xb7, 0x2f, 0x22, 0x5b, 0x2d, 0x37, 0x47, 0x99, 0x37, 0x74, 0xa2, 0xe1,
+	0x82, 0x24, 0x15, 0x7d, 0x7b, 0x9d, 0xe6, 0xe6, 0x3f, 0x83, 0x73, 0x71,
+	0xc1, 0xab, 0xda, 0x2d, 0x36, 0xc4, 0x12, 0x17, 0x8a, 0x27, 0x51, 0x1b,
+	0x30, 0xb3, 0x0d, 0xd2, 0x41, 0x77, 0x23, 0xd1, 0xb6, 0xd8, 0x40, 0x5c,
+	0xad, 0xeb, 0x0a, 0x37, 0x30, 0x0d, 0x14, 0x1b, 0x7b, 0x1d, 0xbe, 0xe4,
+	0x72, 0xa5, 0x6e, 0x63, 0xd1, 0x78, 0xed, 0x85, 0x5d, 0xee, 0x56, 0x9b,
+	0xa5, 0xd0, 0x43, 0x44, 0x89, 0x04, 0xdf, 0xca, 0xdc, 0xe2, 0xa5, 0x20,
+	0xb6, 0x34, 0xa0, 0xdd, 0x5a, 0xf8, 0x65, 0x8e, 0x94, 0x2e, 0xe6, 0x66,
+	0xa2, 0x8d, 0xae, 0x8d, 0xcc, 0xec, 0x4c, 0x37, 0x56, 0xff, 0x17, 0x28,
+	0x10, 0x0f, 0x3b, 0x85, 0xd6, 0xe8, 0xe3, 0x83, 0x49, 0xba, 0x0e, 0xca,
+	0x5c, 0xed, 0x02, 0xc4, 0x4f, 0xf6, 0x75, 0xb6, 0xea, 0x3b, 0x63, 0x0d,
+	0x08, 0xed, 0x95, 0x9a, 0xc3, 0x63, 0xb4, 0xa6, 0x19, 0x9b, 0x11, 0x56,
+	0xd4, 0x98, 0x6d, 0xf7, 0x57, 0x56, 0x1b, 0x2d, 0xcd, 0xb8, 0x4a, 0xc5,
+	0x75, 0xb4, 0xdb, 0x16, 0x48, 0x6d, 0xce, 0xb6, 0x27, 0xb0, 0x6a, 0xae,
+	0xac, 0x50, 0x69, 0xaf, 0x6b, 0x60, 0x37, 0x57, 0x7c, 0x2b, 0x82, 0x83,
+	0x89, 0x73, 0x1d, 0xde, 0xc3, 0x79, 0x05, 0x01, 0x6d, 0x63, 0x7a, 0x11,
+	0x2d, 0xe2, 0x90, 0x27, 0xfa, 0x58, 0x6e, 0x60, 0x84, 0x36, 0x12, 0xab,
+	0x1b, 0x7c, 0x2a, 0xda, 0x27, 0x02, 0xcf, 0x22, 0x02, 0xe3, 0x6e, 0xb7,
+	0xdb, 0xa5, 0xb6, 0x26, 0x9f, 0x1b, 0x5b, 0xab, 0x94, 0xa0, 0xa4, 0xc5,
+	0x7e, 0x45, 0x52, 0x16, 0xc7, 0x6f, 0xb7, 0x8f, 0x28, 0xb5, 0x10, 0xba,
+	0xc0, 0xdb, 0x6e, 0xb6, 0xcb, 0xa5, 0xa6, 0xe9, 0x61, 0xb9, 0xb1, 0xf1,
+	0xd9, 0x6d, 0xd7, 0x6b, 0x4d, 0xca, 0xdf, 0x6e, 0xb6, 0xb7, 0xf0, 0xca,
+	0x40, 0x9c, 0x6e, 0x80, 0xaa, 0x4c, 0x26, 0xa1, 0x48, 0x4d, 0xb0, 0x4c,
+	0x40, 0x36, 0x94, 0x11, 0x26, 0x25, 0x47, 0xc6, 0x16, 0x2e, 0x13, 0x75,
+	0x77, 0xfb, 0x7b, 0x1d, 0xa1, 0x09, 0x84, 0xe7, 0xce, 0xd2, 0xef, 0x65,
+	0x0a, 0x15, 0x45, 0xb2, 0x48, 0x17, 0x0c, 0x56, 0x2c, 0x5e, 0x88, 0xec,
+	0xd6, 0x50, 0x0f, 0x25, 0xd2, 0x52, 0x66, 0x2b, 0xad, 0xb6, 0xcb, 0x72,
+	0x96, 0x1b, 0x09, 0xa1, 0xdb, 0x35, 0x99, 0xba, 0xb9, 0x85, 0xb9, 0x36,
+	0x6a, 0x1a, 0x38, 0x84, 0x57, 0xed, 0x75, 0x55, 0x62, 0x10, 0x1b, 0xbf,
+	0x94, 0xb9, 0x68, 0xd6, 0xc9, 0x6f, 0x13, 0xa1, 0x77, 0x41, 0x85, 0x5b,
+	0xc0, 0xa8, 0xee, 0x83, 0xac, 0x4b, 0x64, 0xef, 0x46, 0xc1, 0x74, 0x6d,
+	0x2a, 0xb6, 0x94, 0x3e, 0x26, 0x71, 0x27, 0x65, 0x42, 0x69, 0x1b, 0x95,
+	0xd2, 0x5f, 0x73, 0xba, 0x5b, 0xee, 0x09, 0x73, 0x90, 0xa5, 0xff, 0x50,
+	0x42, 0x1b, 0x7d, 0xd6, 0xd9, 0x64, 0x25, 0x83, 0xb6, 0x5a, 0x6c, 0x64,
+	0x02, 0x2e, 0x56, 0xaf, 0xec, 0x29, 0x82, 0x37, 0x34, 0x8c, 0xeb, 0x3a,
+	0x24, 0x09, 0xcc, 0x09, 0xe9, 0x99, 0xa7, 0x09, 0x1e, 0x13, 0xae, 0x13,
+	0xc4, 0x39, 0xde, 0x90, 0xf2, 0x8d, 0xa2, 0xc3, 0x70, 0xb9, 0xaa, 0xa8,
+	0x86, 0x28, 0x87, 0x12, 0x16, 0xf1, 0x16, 0xf0, 0x93, 0xc1, 0xdb, 0x6d,
+	0xe5, 0xbc, 0x2c, 0x10, 0x2f, 0xac, 0x6f, 0x10, 0x37, 0x2b, 0x7d, 0xd9,
+	0xbf, 0xd0, 0x32, 0x44, 0xec, 0x16, 0x76, 0x05, 0x28, 0x10, 0x06, 0x7a,
+	0x42, 0x06, 0xe9, 0x65, 0xb2, 0x42, 0xae, 0x77, 0x06, 0xd8, 0x19, 0x64,
+	0x82, 0xcb, 0x74, 0xb1, 0x86, 0x21, 0x58, 0x51, 0xe8, 0x98, 0x48, 0x6e,
+	0xe7, 0xd4, 0x49, 0x08, 0x42, 0x0c, 0x2f, 0xfd, 0x2c, 0x18, 0xb2, 0x0b,
+	0x4d, 0x92, 0xcb, 0x61, 0x24, 0x34, 0x04, 0x38, 0x53, 0xd2, 0xb9, 0xbc,
+	0x41, 0x5a, 0x6c, 0x6e, 0xe0, 0xcb, 0x2e, 0x36, 0xd2, 0x40, 0x2b, 0x9d,
+	0xa6, 0xf5, 0x65, 0x0e, 0x21, 0x91, 0x82, 0x9a, 0x54, 0xc0, 0x66, 0xae,
+	0x97, 0x7b, 0x78, 0x68, 0xa9, 0x70, 0x44, 0xb1, 0xc5, 0x1e, 0x51, 0x52,
+	0xba, 0xdb, 0xa4, 0x14, 0xcb, 0x2d, 0xba, 0xce, 0x23, 0xc3, 0x45, 0x1a,
+	0x42, 0x63, 0xf1, 0x94, 0x8a, 0x39, 0xb9, 0xeb, 0xca, 0x2c, 0x32, 0x0b,
+	0xa5, 0xe6, 0xe0, 0x88, 0x24, 0x72, 0x42, 0x97, 0xa8, 0xa0, 0x24, 0x21,
+	0xec, 0x0e, 0x86, 0x2c, 0xa6, 0x3c, 0xc2, 0x3a, 0xe3, 0x62, 0x41, 0x12,
+	0x36, 0x22, 0xb2, 0x58, 0x6e, 0x82, 0x4c, 0x24, 0x70, 0xd6, 0xcb, 0x79,
+	0x36, 0x89, 0x22, 0x0d, 0xca, 0xcb, 0x70, 0xb2, 0xb3, 0x00, 0x94, 0x39,
+	0x42, 0xa5, 0x17, 0x3b, 0xad, 0x8c, 0xfe, 0xc4, 0x9b, 0x84, 0x92, 0xc4,
+	0xe0, 0xc6, 0xcc, 0x4b, 0xa2, 0x4a, 0xe4, 0x86, 0x26, 0x4e, 0xe9, 0x7a,
+	0xb2, 0xdc, 0xad, 0xf7, 0x33, 0x4b, 0x1b, 0xb8, 0x0e, 0x11, 0x1e, 0x8b,
+	0x9e, 0xb9, 0x46, 0x51, 0x87, 0x94, 0x2a, 0xc3, 0x72, 0xb1, 0x5a, 0x6e,
+	0x87, 0x66, 0x72, 0x82, 0x59, 0x2b, 0x92, 0x97, 0x0d, 0xa4, 0xb9, 0xc6,
+	0x52, 0x2b, 0x86, 0x28, 0x88, 0xca, 0x82, 0x29, 0x45, 0x61, 0xb7, 0x58,
+	0xd1, 0x04, 0xdc, 0xf5, 0xce, 0xe0, 0x47, 0x68, 0x6e, 0x89, 0x8a, 0x37,
+	0x0b, 0x79, 0xb1, 0x89, 0x4c, 0x09, 0x28, 0x8d, 0xb6, 0xe6, 0xeb, 0xe2,
+	0x93, 0x64, 0x4b, 0x06, 0x3b, 0x66, 0xaf, 0x82, 0x50, 0x86, 0x63, 0xa8,
+	0x5e, 0x64, 0x3d, 0xfa, 0x5e, 0x64, 0x3a, 0xec, 0x6c, 0x62, 0xc6, 0x26,
+	0x93, 0x88, 0x56, 0x02, 0xf7, 0x64, 0x10, 0x88, 0x0b, 0xe6, 0x42, 0xae,
+	0x06, 0x66, 0x2d, 0xa2, 0x0c, 0xa7, 0x2e, 0x90, 0x50, 0x8d, 0xa8, 0x43,
+	0x9d, 0xcb, 0x78, 0x43, 0x0c, 0xc3, 0x34, 0xa4, 0x72, 0x07, 0x16, 0x14,
+	0x0a, 0x41, 0x03, 0xe4, 0x19, 0x1b, 0xbd, 0xbe, 0xe4, 0xb5, 0xa2, 0xaf,
+	0x83, 0x62, 0xb4, 0x89, 0xb1, 0x8a, 0xe9, 0x1a, 0x61, 0x89, 0xd9, 0xba,
+	0xc8, 0x8c, 0x00, 0xd8, 0xc7, 0x70, 0x8d, 0x7c, 0x6e, 0x4a, 0x9e, 0x24,
+	0x3c, 0x56, 0x2b, 0xca, 0x08, 0x0b, 0x06, 0x15, 0x86, 0x41, 0x6c, 0x10,
+	0x84, 0x77, 0x46, 0x17, 0x32, 0x38, 0xf1, 0x26, 0xf1, 0x30, 0x01, 0x90,
+	0x5d, 0x6e, 0x0a, 0x26, 0x45, 0xee, 0x47, 0x48, 0x53, 0x19, 0x94, 0xde,
+	0x59, 0x20, 0x36, 0x31, 0x57, 0xf1, 0xb4, 0xdb, 0x21, 0x56, 0x19, 0x05,
+	0x92, 0xd2, 0xec, 0x24, 0xc7, 0xe4, 0x64, 0x46, 0xed, 0x05, 0x6f, 0xba,
+	0xdb, 0x8a, 0x44, 0x51, 0xf1, 0x8e, 0x18, 0x53, 0x88, 0x95, 0x0c, 0x82,
+	0x45, 0x03, 0x94, 0x4b, 0xfc, 0xe7, 0x69, 0x1e, 0x82, 0x10, 0x70, 0xa7,
+	0x74, 0x63, 0x22, 0x33, 0x2a, 0x23, 0x1a, 0x39, 0x74, 0x82, 0x92, 0xe6,
+	0x26, 0x2b, 0xa6, 0x7f, 0x07, 0x6e, 0x32, 0xb5, 0x4e, 0x11, 0x6d, 0xc2,
+	0xb9, 0x97, 0x1a, 0x84, 0x8b, 0x42, 0x8c, 0x29, 0x52, 0x35, 0x45, 0x76,
+	0x0d, 0x15, 0x08, 0x20, 0x6d, 0x97, 0x56, 0xa8, 0x52, 0xdb, 0x43, 0x27,
+	0x49, 0x8c, 0xca, 0x70, 0x5f, 0xca, 0x37, 0x69, 0x0a, 0x3c, 0x56, 0x76,
+	0x63, 0x60, 0x81, 0x97, 0x48, 0x24, 0x14, 0x94, 0x8e, 0x4b, 0x35, 0xa6,
+	0xe4, 0x9f, 0x62, 0x69, 0xed, 0x6c, 0xb0, 0xdc, 0xac, 0xee, 0xc6, 0x6a,
+	0x98, 0x28, 0x14, 0x46, 0xcc, 0x76, 0x12, 0xf6, 0x27, 0x0d, 0x24, 0xc3,
+	0x16, 0x55, 0x1b, 0x60, 0xae, 0x21, 0xe1, 0x40, 0x2d, 0x09, 0x10, 0x12,
+	0x1f, 0x9a, 0x97, 0x0c, 0xb0, 0xd9, 0x50, 0xb8, 0x65, 0x16, 0x18, 0x79,
+	0x10, 0xac, 0x90, 0xf1, 0x58, 0x57, 0x4e, 0xd9, 0x6f, 0xb7, 0xad, 0x68,
+	0xdb, 0x2d, 0x2c, 0x5c, 0x2e, 0xcc, 0x4d, 0xd8, 0x89, 0x32, 0xe8, 0xc2,
+	0xb7, 0x39, 0xd4, 0x2a, 0x15, 0x09, 0x90, 0x50, 0xed, 0xf6, 0xd0, 0x25,
+	0x1b, 0x24, 0x82, 0x84, 0x64, 0x64, 0x9e, 0x29, 0x44, 0x15, 0xe2, 0x4e,
+	0xd2, 0x94, 0x5c, 0xe5, 0x30, 0xa8, 0x4c, 0xba, 0x5a, 0xa0, 0xf2, 0xa0,
+	0xd6, 0xa2, 0x99, 0x2e, 0x85, 0x42, 0x6f, 0x88, 0x12, 0x52, 0xd9, 0x94,
+	0xd6, 0x6a, 0x9e, 0x25, 0x7c, 0x90, 0x53, 0x11, 0x89, 0x53, 0xe0, 0xe5,
+	0xca, 0x9a, 0x29, 0xe2, 0xb2, 0x0b, 0xe2, 0x82, 0x7f, 0xb2, 0x15, 0x41,
+	0x77, 0x53, 0x35, 0x43, 0x4c, 0xd3, 0x17, 0x47, 0x73, 0x52, 0x6b, 0x31,
+	0xb9, 0x58, 0x6c, 0x6f, 0xa0, 0x29, 0xbf, 0xf5, 0x3e, 0x1d, 0x41, 0x3f,
+	0x8a, 0x97, 0x1c, 0xc2, 0x5a, 0x66, 0xa2, 0xaa, 0x6a, 0x9d, 0x8e, 0xab,
+	0x3f, 0xc9, 0x61, 0x0e, 0x41, 0x65, 0xb9, 0x5c, 0x9b, 0xbc, 0x6d, 0xf6,
+	0x3b, 0x1d, 0xd4, 0xfc, 0x45, 0x1e, 0x86, 0xc2, 0xf7, 0xc4, 0x9d, 0x06,
+	0x69, 0xec, 0x10, 0x05, 0x66, 0xb7, 0xdb, 0x2d, 0x96, 0xfb, 0xb9, 0x7f,
+	0x09, 0x8a, 0x2d, 0xc6, 0xeb, 0x69, 0xb9, 0xa3, 0x10, 0xc8, 0x2d, 0xd7,
+	0x5b, 0x6d, 0x89, 0xd8, 0xc5, 0x27, 0xd6, 0x14, 0x5f, 0xe7, 0x2e, 0x90,
+	0x52, 0x19, 0x18, 0x5a, 0x24, 0xc4, 0x3d, 0x5b, 0x48, 0xec, 0x96, 0x56,
+	0x7a, 0x52, 0xcb, 0x4b, 0x9d, 0xa0, 0x9b, 0x1a, 0xe9, 0x72, 0xb4, 0xdd,
+	0x9a, 0xf4, 0x64, 0x12, 0xd6, 0xf1, 0x3b, 0x4d, 0xb9, 0xf2, 0x0e, 0x14,
+	0xe6, 0x08, 0xdd, 0xc5, 0x73, 0x65, 0x11, 0x13, 0xb1, 0x75, 0x91, 0x5a,
+	0x1b, 0x7e, 0x64, 0x44, 0x76, 0x39, 0x03, 0x7e, 0x81, 0xb5, 0xcb, 0x6c,
+	0xb7, 0x63, 0x68, 0x1b, 0x85, 0xbd, 0xc9, 0xc5, 0xdc, 0xce, 0xdf, 0x75,
+	0xba, 0x39, 0x90, 0xc2, 0x8c, 0x55, 0x96, 0x69, 0x58, 0xb9, 0x41, 0xa8,
+	0x6d, 0x83, 0x18, 0x2d, 0xf8, 0x86, 0x0e, 0x48, 0xc4, 0xa5, 0xee, 0x2e,
+	0x9e, 0x22, 0x3a, 0xcc, 0xa0, 0x63, 0xb6, 0x20, 0x52, 0x70, 0xab, 0x2d,
+	0xe2, 0xe1, 0x6c, 0xb0, 0xdb, 0x88, 0xcc, 0xad, 0xc9, 0x4c, 0xac, 0xb5,
+	0x02, 0xe7, 0x2f, 0xea, 0x73, 0x29, 0x05, 0x86, 0xc8, 0x83, 0xe6, 0xfe,
+	0x24, 0xfd, 0xcc, 0x37, 0x64, 0x5c, 0x88, 0x10, 0x63, 0x74, 0xbb, 0xd9,
+	0x4d, 0xa0, 0x5d, 0xe4, 0x42, 0xf8, 0x66, 0x33, 0x29, 0xcc, 0x29, 0x69,
+	0x20, 0x1d, 0x0c, 0x07, 0x85, 0x8e, 0xcd, 0xbc, 0x54, 0x66, 0x85, 0x9e,
+	0x1d, 0x16, 0x88, 0xc2, 0x91, 0x20, 0x51, 0x12, 0x50, 0x56, 0x85, 0x94,
+	0x45, 0x19, 0x84, 0xca, 0x86, 0x65, 0x2c, 0x85, 0x3c, 0x40, 0x82, 0x09,
+	0x82, 0x18, 0x8e, 0x11, 0x99, 0x50, 0xd8, 0xad, 0xf6, 0xf1, 0x56, 0x10,
+	0x96, 0x2b, 0x6d, 0x86, 0xf1, 0x69, 0xb6, 0xdd, 0x6d, 0xaf, 0xa9, 0x25,
+	0x52, 0x82, 0x3a, 0x50, 0xa8, 0x50, 0x8e, 0x3d, 0x8a, 0xcb, 0x6c, 0xb7,
+	0xdb, 0xac, 0xe1, 0x28, 0x2f, 0xf6, 0x56, 0x59, 0x05, 0x6c, 0x4c, 0x24,
+	0x89, 0xa4, 0x3f, 0x8a, 0xcc, 0xd5, 0x43, 0x6c, 0xbc, 0xa6, 0xa1, 0xdb,
+	0xee, 0x77, 0x34, 0x83, 0x22, 0x6a, 0x12, 0x28, 0x8b, 0x0d, 0xb2, 0xcf,
+	0x6f, 0xb9, 0x0e, 0x40, 0xdb, 0x5e, 0xd1, 0x2f, 0x25, 0x94, 0x6c, 0x90,
+	0x56, 0x2b, 0xad, 0xa6, 0xd8, 0xcf, 0x86, 0x64, 0xe2, 0x68, 0x64, 0x26,
+	0x4e, 0x23, 0x04, 0x2e, 0x63, 0x6c, 0xb0, 0xd8, 0xc4, 0x4c, 0x61, 0x57,
+	0x36, 0x9e, 0x10, 0x42, 0x23, 0xaf, 0x32, 0xa4, 0x31, 0x4e, 0x1b, 0x95,
+	0x94, 0xd2, 0x05, 0xb0, 0x90, 0x11, 0x8e, 0xde, 0x31, 0x82, 0x18, 0xec,
+	0x42, 0xc4, 0x7b, 0xe4, 0x26, 0x2e, 0x28, 0x86, 0x25, 0xe2, 0x68, 0xe4,
+	0xd8, 0x44, 0xf3, 0x0e, 0x54, 0xc2, 0x49, 0x8c, 0x09, 0xbf, 0xcc, 0x21,
+	0xe0, 0x81, 0x88, 0x3e, 0x12, 0x15, 0x64, 0xb2, 0x8c, 0xc0, 0xdb, 0x0a,
+	0x10, 0xed, 0x0c, 0x8c, 0x36, 0xdb, 0x0d, 0xd2, 0xc7, 0x68, 0x30, 0x22,
+	0x2a, 0x11, 0x3c, 0x57, 0x23, 0xa1, 0x16, 0x82, 0x42, 0x31, 0x04, 0x22,
+	0x17, 0x43, 0xbb, 0x02, 0x78, 0x8e, 0x20, 0xd9, 0xae, 0x56, 0xfb, 0x68,
+	0xac, 0x20, 0x27, 0xc4, 0xa2, 0xda, 0x01, 0xe3, 0x6c, 0xbc, 0xca, 0x4a,
+	0xa4, 0x47, 0xf9, 0xcb, 0x91, 0x8f, 0x79, 0xdb, 0xd0, 0x4e, 0x68, 0x83,
+	0x79, 0xc7, 0x50, 0xcf, 0x78, 0xef, 0x36, 0xe6, 0xaa, 0x1b, 0x19, 0x53,
+	0x0d, 0xe6, 0x41, 0x67, 0xb2, 0xdb, 0x91, 0x90, 0x4c, 0x78, 0x46, 0x8e,
+	0x88, 0xe4, 0x87, 0x50, 0xd1, 0x85, 0x8b, 0xfc, 0xe5, 0x81, 0xb7, 0x49,
+	0x74, 0x49, 0x7f, 0x09, 0xc0, 0x53, 0x19, 0xb4, 0xb6, 0xc4, 0x5c, 0x23,
+	0x52, 0x0d, 0xd6, 0x2c, 0x24, 0x34, 0xb1, 0x9d, 0x28, 0x26, 0xa8, 0xff,
+	0x28, 0xff, 0xe2, 0x60, 0x5a, 0x63, 0x74, 0x53, 0xb3, 0x98, 0xcc, 0x4a,
+	0x44, 0xee, 0x16, 0xf6, 0x55, 0x15, 0x9d, 0x2b, 0xe4, 0x82, 0x68, 0x52,
+	0x26, 0x61, 0x4a, 0xab, 0x1e, 0x26, 0xcf, 0xf1, 0x14, 0xd0, 0x98, 0x89,
+	0x4d, 0x05, 0xcc, 0xee, 0x97, 0x9b, 0x80, 0xf9, 0x14, 0x82, 0xed, 0x61,
+	0xb6, 0x5d, 0x59, 0xb0, 0x56, 0x15, 0x1c, 0x9e, 0x0f, 0x0a, 0xd3, 0x80,
+	0xa7, 0x24, 0x8a, 0x6a, 0x80, 0xc4, 0xa9, 0xfe, 0x25, 0x2e, 0x42, 0x91,
+	0x74, 0x0c, 0x13, 0xbf, 0x13, 0x94, 0x32, 0xba, 0xfe, 0x49, 0x4d, 0x77,
+	0x26, 0x8d, 0x54, 0xc0, 0x3b, 0x9d, 0xbd, 0x38, 0x06, 0x62, 0xf6, 0xa6,
+	0x15, 0xb4, 0x2a, 0x66, 0xb3, 0x63, 0x61, 0xb6, 0x5a, 0x6f, 0x48, 0xec,
+	0x77, 0x49, 0x05, 0xb6, 0xea, 0x87, 0x04, 0x87, 0xc2, 0x78, 0x50, 0x08,
+	0xad, 0x73, 0xb0, 0xdb, 0x6c, 0xa6, 0x00, 0x86, 0x44, 0x30, 0xa4, 0xf1,
+	0x10, 0xfb, 0x36, 0x86, 0x24, 0x47, 0x1b, 0x49, 0x83, 0x0c, 0xc8, 0xeb,
+	0x51, 0xad, 0x12, 0xc5, 0x75, 0x11, 0x12, 0x43, 0xf2, 0xb3, 0x5a, 0x43,
+	0x5c, 0x6c, 0x81, 0x50, 0x40, 0x8c, 0xa0, 0x2e, 0x68, 0xcc, 0x21, 0x8e,
+	0x82, 0xd6, 0x90, 0xa9, 0x9c, 0xba, 0x41, 0x53, 0xb2, 0xd8, 0x6e, 0x56,
+	0x3b, 0x42, 0x65, 0x1b, 0x26, 0x10, 0x20, 0x15, 0x94, 0x04, 0x04, 0x5b,
+	0x0c, 0x3d, 0xfe, 0x10, 0x6a, 0x59, 0x9e, 0x28, 0x9f, 0xb9, 0xd3, 0x30,
+	0x6d, 0x96, 0x1b, 0x95, 0x9e, 0xcb, 0x72, 0x3f, 0x94, 0x6e, 0x05, 0x6a,
+	0xb1, 0x43, 0x83, 0x46, 0x44, 0x2b, 0x25, 0x72, 0x07, 0x0d, 0xc7, 0x90,
+	0x4a, 0x2c, 0x25, 0x41, 0x0b, 0x6e, 0x4f, 0xb2, 0x92, 0x97, 0x80, 0x14,
+	0x98, 0x54, 0x62, 0x57, 0x19, 0x5b, 0xb8, 0x45, 0x89, 0xfa, 0x8b, 0x94,
+	0x39, 0xf8, 0xa0, 0x23, 0x2b, 0x7e, 0x21, 0xd6, 0xa3, 0x90, 0x2d, 0xa4,
+	0xfe, 0x0c, 0x17, 0x06, 0xcd, 0x69, 0xbc, 0x3b, 0xf0, 0x86, 0x79, 0xd8,
+	0x64, 0x17, 0x36, 0x7d, 0x1b, 0x63, 0x72, 0x8b, 0xc5, 0x8d, 0xa6, 0xdc,
+	0x09, 0xc2, 0xea, 0x62, 0xd1, 0x65, 0x68, 0xb2, 0xb2, 0x60, 0xa2, 0xb2,
+	0x29, 0x2b, 0xa6, 0x05, 0xdb, 0xd2, 0x5c, 0xdc, 0x9d, 0xe5, 0xd0, 0xa9,
+	0xa4, 0xba, 0x41, 0x4d, 0xb7, 0xdd, 0x9a, 0xb8, 0xe4, 0x16, 0x5b, 0x6b,
+	0xc5, 0x8b, 0x90, 0x28, 0xcd, 0xb2, 0x09, 0xe8, 0xf2, 0xb8, 0x80, 0x44,
+	0x2a, 0x6b, 0x2e, 0x90, 0x50, 0x6e, 0x97, 0x4b, 0x2d, 0xb6, 0xe0, 0x02,
+	0x22, 0x3a, 0xe6, 0x84, 0xa2, 0xb4, 0xff, 0x14, 0xed, 0x90, 0xf9, 0x19,
+	0x84, 0x5f, 0xb9, 0x0a, 0xc9, 0x41, 0x19, 0x0f, 0xe4, 0x90, 0xf5, 0x6d,
+	0x47, 0xa4, 0x4b, 0x2e, 0x43, 0x2e, 0x32, 0xe8, 0x54, 0xda, 0x5d, 0x20,
+	0xa4, 0x89, 0x39, 0xbd, 0xd3, 0xba, 0x41, 0x20, 0x9a, 0xd9, 0x8f, 0x04,
+	0x6e, 0x69, 0xe8, 0xd6, 0x77, 0xfb, 0x1b, 0x78, 0x77, 0x8d, 0x96, 0xe0,
+	0xf4, 0x0a, 0xe0, 0xe4, 0x9d, 0xa2, 0xdc, 0x65, 0x70, 0xb9, 0x5b, 0xdb,
+	0x10, 0x4c, 0x18, 0x8e, 0xbc, 0xd0, 0x09, 0x0e, 0xa5, 0x2a, 0x16, 0x5b,
+	0x93, 0x5d, 0x0a, 0xd3, 0x21, 0xf6, 0x19, 0xe0, 0xbb, 0xa9, 0x99, 0x91,
+	0x0a, 0xc9, 0x21, 0xca, 0xa2, 0x05, 0x9d, 0x4a, 0xcb, 0x61, 0x21, 0x02,
+	0x53, 0xff, 0xe2, 0xe0, 0x64, 0xe2, 0x4a, 0xc6, 0x46, 0xa9, 0x44, 0xad,
+	0x84, 0x09, 0xd2, 0x1b, 0x8e, 0x7f, 0x2a, 0xfd, 0x22, 0x97, 0x68, 0x7d,
+	0x06, 0x87, 0xc8, 0xf1, 0x62, 0x1b, 0x86, 0x08, 0x86, 0xb7, 0x3f, 0x4f,
+	0x30, 0x5b, 0xce, 0x08, 0x5d, 0x65, 0x8e, 0x23, 0xf1, 0x3b, 0x44, 0x85,
+	0xd9, 0xea, 0xde, 0x5c, 0x89, 0x27, 0x68, 0xb4, 0xd9, 0x80, 0x45, 0x12,
+	0xe9, 0x5d, 0xf9, 0xe5, 0x17, 0x39, 0x4a, 0xdc, 0x7e, 0x13, 0xd4, 0x46,
+	0x50, 0x82, 0x94, 0x9f, 0xa0, 0x5f, 0xb9, 0x2d, 0xd7, 0x5b, 0x6d, 0x89,
+	0x25, 0x90, 0x49, 0x96, 0xdf, 0x6c, 0x1c, 0x71, 0x79, 0xb9, 0x1c, 0x92,
+	0x4e, 0xd1, 0xbb, 0xb1, 0xc9, 0x87, 0xc9, 0xdc, 0xac, 0xab, 0x12, 0x75,
+	0x26, 0x6d, 0x41, 0x9b, 0x36, 0x61, 0x5b, 0xad, 0xba, 0xe9, 0x69, 0xb6,
+	0x09, 0x09, 0xa0, 0xa2, 0x0a, 0x98, 0xd8, 0xed, 0xf6, 0xeb, 0x9d, 0xd6,
+	0xda, 0xc5, 0xa5, 0x0a, 0xa3, 0x2d, 0x23, 0x49, 0xc1, 0x64, 0xa5, 0xc0,
+	0xf7, 0x32, 0x79, 0x05, 0x1a, 0x83, 0x51, 0x96, 0x48, 0x2b, 0x77, 0x0b,
+	0x0d, 0xca, 0xe9, 0x20, 0x99, 0x0a, 0x20, 0xcb, 0x1b, 0x91, 0x84, 0xf1,
+	0xa5, 0xe7, 0x28, 0xc2, 0x90, 0xf0, 0xa1, 0x53, 0x11, 0xc7, 0x1b, 0x1d,
+	0xca, 0xd3, 0x62, 0x17, 0xd1, 0xb1, 0x5e, 0x43, 0xe8, 0xec, 0xd6, 0xfb,
+	0x65, 0xb2, 0xdf, 0x77, 0x44, 0x02, 0xb9, 0xdd, 0x6c, 0x61, 0x84, 0x36,
+	0x32, 0x9f, 0x1b, 0x9d, 0x96, 0xeb, 0x64, 0xb7, 0x8b, 0xd1, 0x11, 0xf9,
+	0x5d, 0xed, 0x16, 0x95, 0x46, 0x19, 0x41, 0x18, 0x95, 0x06, 0xd0, 0xd8,
+	0xc3, 0x42, 0x41, 0xb4, 0xb7, 0x5b, 0xd8, 0x98, 0xae, 0x17, 0x4b, 0xcc,
+	0xa6, 0x41, 0x7b, 0x85, 0x42, 0x61, 0x36, 0x7b, 0x2a, 0x5f, 0x95, 0xc2,
+	0xde, 0x3a, 0x82, 0x73, 0x23, 0x7b, 0x2a, 0x16, 0x96, 0x0b, 0x5a, 0x5f,
+	0x4f, 0x91, 0x91, 0x72, 0xc3, 0x8c, 0x51, 0xa9, 0x42, 0x90, 0x6c, 0x82,
+	0xd2, 0x28, 0xa9, 0x16, 0xfb, 0x5d, 0x84, 0x33, 0x09, 0x06, 0x56, 0x76,
+	0x48, 0x03, 0x09, 0x48, 0x01, 0x94, 0x15, 0x92, 0xcf, 0xa4, 0x14, 0xda,
+	0x4d, 0x3a, 0x93, 0x4d, 0xaa, 0xd3, 0x6b, 0xf4, 0xda, 0x0d, 0x52, 0x87,
+	0x48, 0xaf, 0xd3, 0x28, 0xb4, 0xea, 0x3d, 0x52, 0x90, 0x1c, 0x09, 0x09,
+	0x4b, 0xa7, 0x94, 0x15, 0x03, 0xcb, 0x0a, 0xc5, 0xa5, 0x32, 0x0b, 0x85,
+	0x86, 0xd2, 0x28, 0x42, 0x2d, 0xa3, 0x73, 0x78, 0xd7, 0x12, 0x45, 0x2b,
+	0x25, 0x7e, 0x99, 0xb0, 0xa2, 0xe1, 0x0c, 0x91, 0x5f, 0x53, 0xd9, 0x05,
+	0xae, 0x82, 0x6c, 0xed, 0x37, 0x27, 0xe6, 0xa4, 0x69, 0x61, 0x33, 0xf8,
+	0x32, 0x9f, 0x89, 0x88, 0xef, 0xc8, 0xdd, 0x44, 0x28, 0x8a, 0xc6, 0x15,
+	0x44, 0x40, 0x21, 0x04, 0xd7, 0x31, 0x72, 0xb6, 0xdd, 0x51, 0x44, 0xac,
+	0x27, 0xa6, 0x29, 0x38, 0x60, 0x97, 0x32, 0xc0, 0x6c, 0xa3, 0x17, 0x2b,
+	0x65, 0xa5, 0x66, 0x04, 0x25, 0x5e, 0x15, 0x73, 0xb8, 0x59, 0x4c, 0x80,
+	0x5f, 0x6d, 0x6e, 0x68, 0x9d, 0xfc, 0xd1, 0x2c, 0x49, 0xf8, 0x91, 0x00,
+	0x90, 0xac, 0x90, 0xc8, 0xd1, 0x98, 0xac, 0xf7, 0x26, 0x6f, 0x1b, 0x65,
+	0xe6, 0x14, 0x15, 0xa2, 0x57, 0xe3, 0x73, 0xb2, 0xb5, 0x9a, 0x13, 0xeb,
+	0x82, 0x5c, 0x98, 0x38, 0xc8, 0xe4, 0x72, 0x0a, 0x2d, 0xe2, 0xe9, 0x65,
+	0xb7, 0x18, 0xf9, 0x53, 0x2b, 0x55, 0x3a, 0x99, 0xc7, 0x29, 0x77, 0xb5,
+	0x6c, 0xbd, 0xc8, 0x19, 0x05, 0x14, 0xc9, 0x11, 0x06, 0x41, 0x28, 0x95,
+	0x50, 0xe9, 0xf4, 0x4a, 0x2d, 0x0e, 0xb9, 0x5f, 0x2f, 0x72, 0xac, 0x4a,
+	0x9e, 0xa0, 0x4b, 0x39, 0x4f, 0xb4, 0x9a, 0xc8, 0x4c, 0x29, 0xec, 0xb7,
+	0x8b, 0x1d, 0x96, 0xe1, 0x74, 0x2c, 0x51, 0x90, 0x5a, 0x04, 0xa0, 0x51,
+	0x63, 0xc5, 0x9a, 0x36, 0x16, 0x3a, 0x13, 0x94, 0x46, 0xef, 0x1a, 0x0a,
+	0x59, 0x35, 0x9a, 0xd3, 0x65, 0xb6, 0x29, 0xcb, 0x2f, 0x00, 0xb0, 0x10,
+	0xda, 0x6e, 0x97, 0x35, 0x48, 0x2b, 0x9c, 0x2a, 0xe6, 0x1c, 0xe3, 0x28,
+	0x98, 0xcd, 0x54, 0xe9, 0x0f, 0xf5, 0x2c, 0xd6, 0x1b, 0xad, 0xb0, 0x2c,
+	0x05, 0xe0, 0x06, 0xdb, 0x65, 0x7e, 0xf2, 0x96, 0x2a, 0xb8, 0xda, 0x51,
+	0x44, 0x6e, 0xf6, 0xfb, 0xa9, 0xbf, 0x0d, 0xb8, 0xc5, 0x0a, 0xd9, 0x6c,
+	0xbc, 0xc8, 0x2c, 0x4a, 0x00, 0x48, 0xc8, 0x8c, 0x04, 0x33, 0x19, 0xbc,
+	0x2a, 0xc5, 0x79, 0xba, 0x59, 0x5e, 0x9c, 0x90, 0x88, 0x42, 0x80, 0xc2,
+	0x55, 0x12, 0x78, 0x6b, 0x74, 0x5b, 0x65, 0xa6, 0xc3, 0x73, 0x96, 0xd1,
+	0xec, 0x2d, 0xd6, 0x26, 0x1e, 0x46, 0xd6, 0x6f, 0xa0, 0xb2, 0xc9, 0x05,
+	0xbe, 0xdc, 0x86, 0x62, 0xc8, 0x84, 0x93, 0x8d, 0x0a, 0x7d, 0x14, 0x60,
+	0x12, 0x3e, 0x13, 0x2b, 0x39, 0xb1, 0xd8, 0x6e, 0x57, 0x2b, 0x49, 0x66,
+	0x8a, 0x6b, 0x0b, 0x4a, 0x88, 0x5e, 0x11, 0x77, 0x3d, 0x49, 0x31, 0x1e,
+	0x8a, 0xd7, 0x44, 0xa8, 0x63, 0x3a, 0x85, 0x42, 0x65, 0xd2, 0xd4, 0x75,
+	0xff, 0x84, 0x8e, 0x9b, 0x2e, 0x85, 0x42, 0x6f, 0x92, 0x09, 0x82, 0xa4,
+	0x1c, 0x82, 0x41, 0x7c, 0x90, 0x4c, 0x66, 0x2a, 0x90, 0x61, 0xea, 0xc9,
+	0x86, 0x33, 0x45, 0x48, 0x36, 0x0b, 0x59, 0x40, 0x12, 0x14, 0xc5, 0xe9,
+	0xc6, 0xf9, 0x20, 0x3f, 0xb9, 0x4c, 0x21, 0x47, 0x2f, 0xfa, 0xe5, 0xf8,
+	0x80, 0xf4, 0xa8, 0x89, 0x26, 0x02, 0x8f, 0x88, 0x61, 0xfc, 0x37, 0x8b,
+	0x49, 0xe5, 0x09, 0x5b, 0xa8, 0x95, 0x93, 0x59, 0x08, 0x86, 0x93, 0x58,
+	0xb2, 0xd6, 0x1c, 0x2a, 0xd7, 0x65, 0xb2, 0xdc, 0x2e, 0x6c, 0xd6, 0xaf,
+	0x88, 0x6e, 0x3e, 0xad, 0x3e, 0x56, 0x4b, 0x4d, 0xce, 0xe9, 0x61, 0x70,
+	0xe1, 0x96, 0x15, 0x81, 0xdb, 0xe4, 0x12, 0xa3, 0x23, 0x3a, 0xe0, 0xae,
+	0x0d, 0x62, 0x54, 0x86, 0x6b, 0x28, 0x98, 0xd3, 0x6d, 0x34, 0x20, 0x97,
+	0x18, 0x51, 0xd3, 0xac, 0xa4, 0xee, 0x5a, 0xdb, 0x65, 0xb0, 0xdb, 0xae,
+	0x72, 0x0b, 0x45, 0xa6, 0xcf, 0x68, 0x3c, 0xd1, 0x66, 0xc2, 0xba, 0x35,
+	0x28, 0xdd, 0x9a, 0x0c, 0x6c, 0x37, 0x46, 0xcd, 0x12, 0x44, 0x25, 0x7b,
+	0x6b, 0x95, 0xd5, 0x7a, 0xc4, 0xa0, 0xd9, 0xa7, 0xc4, 0xf8, 0x0d, 0x8f,
+	0x08, 0xda, 0x54, 0xe0, 0x12, 0xed, 0x65, 0x70, 0x51, 0xb3, 0x59, 0x6e,
+	0xee, 0x0f, 0x0c, 0xfa, 0x54, 0x17, 0x07, 0x83, 0x80, 0x53, 0x73, 0xc7,
+	0xdb, 0x1b, 0xd5, 0x96, 0xe5, 0x6f, 0x3b, 0x96, 0x30, 0xa7, 0xb7, 0x59,
+	0x58, 0xe0, 0x64, 0x17, 0x0b, 0x95, 0xbe, 0xc9, 0x75, 0x64, 0x81, 0x74,
+	0xc1, 0xb9, 0xc2, 0xac, 0x2c, 0x22, 0x4f, 0xb4, 0x4e, 0xb2, 0xb7, 0x36,
+	0xc9, 0x10, 0x17, 0x1b, 0x0b, 0x77, 0x89, 0x7e, 0x92, 0x66, 0xb9, 0xbd,
+	0xa5, 0xa1, 0xf8, 0x85, 0x12, 0x88, 0x42, 0xc4, 0x14, 0x05, 0x08, 0x1d,
+	0xf4, 0x19, 0xa7, 0xe6, 0x58, 0xf8, 0xe3, 0x64, 0x10, 0x84, 0x6a, 0x36,
+	0x09, 0xf4, 0x33, 0x62, 0xb8, 0x5b, 0x2c, 0x2f, 0xfc, 0x28, 0x68, 0x8b,
+	0x5c, 0x37, 0x27, 0xc3, 0x32, 0x3d, 0x16, 0xdb, 0x33, 0x01, 0x14, 0x33,
+	0x38, 0x55, 0x8a, 0xdf, 0x75, 0xb7, 0x59, 0x1e, 0xe8, 0x42, 0xf0, 0xa9,
+	0x8e, 0xee, 0xb5, 0x26, 0x9c, 0x14, 0x69, 0xff, 0x9e, 0x94, 0x9f, 0x52,
+	0xdb, 0xf7, 0x63, 0x73, 0x51, 0xba, 0x48, 0x25, 0xa4, 0x2c, 0x29, 0xad,
+	0xf8, 0x98, 0x27, 0x59, 0xdc, 0x04, 0xe8, 0x6f, 0x92, 0x0a, 0x11, 0xf1,
+	0x0c, 0xa0, 0xf9, 0x46, 0x5d, 0x2e, 0x97, 0x26, 0x09, 0x23, 0x97, 0xfc,
+	0x64, 0xa4, 0xfa, 0xa8, 0x5d, 0x75, 0x2c, 0xc2, 0x65, 0xf1, 0x74, 0x15,
+	0x69, 0xb2, 0x6a, 0xb5, 0x28, 0x22, 0xb9, 0x85, 0x28, 0x86, 0x18, 0xb5,
+	0x13, 0xdd, 0xed, 0x16, 0x51, 0x1e, 0x33, 0x66, 0x13, 0x65, 0x2b, 0x0d,
+	0xd2, 0x15, 0x6c, 0x2c, 0xa1, 0xba, 0x2d, 0xdb, 0xd4, 0xaa, 0xb4, 0xe9,
+	0x53, 0x50, 0xd0, 0x74, 0x8d, 0xc8, 0x4a, 0x06, 0x51, 0x32, 0x4d, 0x81,
+	0xbc, 0x9d, 0x33, 0x4b, 0x04, 0x20, 0xc3, 0xb0, 0xd6, 0x7c, 0x8e, 0xed,
+	0x1a, 0x64, 0xe1, 0x44, 0x80, 0x36, 0x1b, 0x65, 0xde, 0xc3, 0x79, 0x71,
+	0x81, 0x3c, 0xa2, 0xb2, 0xdc, 0xa5, 0x2d, 0x64, 0x44, 0xd6, 0xcb, 0xd8,
+	0x22, 0x50, 0x24, 0x86, 0x65, 0x8c, 0x24, 0x6a, 0xd6, 0x20, 0x69, 0x16,
+	0x00, 0x3b, 0x2d, 0xe2, 0xe0, 0xde, 0x62, 0x37, 0x03, 0x6e, 0xb2, 0x04,
+	0x30, 0x9c, 0x70, 0x9d, 0x1a, 0x2a, 0x62, 0xdb, 0xee, 0x0b, 0xe6, 0x2c,
+	0x26, 0xa0, 0xd9, 0x07, 0x04, 0x22, 0xe0, 0x23, 0xe0, 0x6b, 0x38, 0xb6,
+	0x19, 0x05, 0x9a, 0xd9, 0x61, 0xb3, 0x94, 0x81, 0xd9, 0x6c, 0x36, 0x3b,
+	0x44, 0x29, 0x06, 0x04, 0xba, 0x12, 0xa4, 0xb2, 0xe7, 0x20, 0xa7, 0xd9,
+	0xac, 0xc7, 0x2c, 0x45, 0xee, 0x94, 0x46, 0x01, 0x2b, 0x6d, 0x86, 0xc9,
+	0x65, 0x2b, 0x02, 0x28, 0x31, 0xb3, 0x5a, 0x6f, 0x04, 0xe6, 0x37, 0x3b,
+	0x4d, 0xea, 0xca, 0xb2, 0xa3, 0x63, 0xb7, 0xdc, 0x9b, 0x28, 0x8a, 0x4c,
+	0x6c, 0x22, 0x12, 0x25, 0x9c, 0x25, 0xe2, 0x25, 0x9c, 0x36, 0xf5, 0x95,
+	0x55, 0x9f, 0xa8, 0x52, 0xd6, 0x34, 0x82, 0xde, 0xd1, 0x04, 0xde, 0x64,
+	0x3a, 0xe9, 0x67, 0x71, 0x01, 0x96, 0x0b, 0x11, 0xc8, 0x2e, 0x96, 0x93,
+	0x34, 0x1b, 0x1d, 0xbe, 0xe6, 0xb3, 0x69, 0x20, 0xb3, 0x5d, 0x4e, 0x1c,
+	0x59, 0x05, 0xda, 0xc9, 0x16, 0x59, 0x1b, 0x94, 0x45, 0xe8, 0xcc, 0x4f,
+	0xf1, 0x52, 0x32, 0x81, 0xb3, 0xaf, 0xe0, 0x89, 0x0a, 0x8e, 0x7b, 0x58,
+	0xac, 0x36, 0x3b, 0x5a, 0xdc, 0x11, 0x5a, 0x43, 0x55, 0xab, 0x72, 0x95,
+	0x85, 0x33, 0x20, 0xd2, 0x84, 0xa5, 0x4a, 0xef, 0x69, 0xb7, 0x59, 0x2d,
+	0xf7, 0x76, 0xf1, 0x4b, 0x15, 0xbc, 0xe8, 0x15, 0x52, 0x99, 0xbc, 0xc8,
+	0x49, 0xd9, 0x64, 0x08, 0xd4, 0x10, 0x22, 0x46, 0x15, 0x66, 0xb7, 0xdd,
+	0x6e, 0x4b, 0x56, 0xf7, 0x30, 0x46, 0x2b, 0x20, 0x51, 0x15, 0xb4, 0x7d,
+	0xc4, 0x67, 0xca, 0xcb, 0x6e, 0xba, 0x1e, 0x68, 0x96, 0x11, 0x8d, 0x18,
+	0xd9, 0x6e, 0x46, 0xe0, 0x57, 0x31, 0x28, 0x16, 0xf4, 0x11, 0x5a, 0x34,
+	0xbe, 0x2b, 0x9d, 0x96, 0xd9, 0x65, 0xb1, 0x9c, 0x98, 0xd8, 0xac, 0xb7,
+	0x4b, 0xbd, 0x94, 0x1d, 0xc6, 0xc2, 0xd0, 0xa3, 0x77, 0x24, 0x38, 0x1d,
+	0xc3, 0x41, 0x91, 0x61, 0x75, 0x59, 0x64, 0x2d, 0xa2, 0xb7, 0x34, 0x91,
+	0x1d, 0xda, 0x5b, 0xed, 0xc7, 0x9a, 0x37, 0x4b, 0x0d, 0xad, 0x0d, 0xca,
+	0xef, 0x6f, 0x85, 0x1c, 0x89, 0x2d, 0xc1, 0x5b, 0x8e, 0xc8, 0x5c, 0xf2,
+	0x51, 0xc7, 0xfb, 0x25, 0xb9, 0xa6, 0x3a, 0x26, 0x11, 0x4e, 0x13, 0x65,
+	0x1d, 0x05, 0x53, 0xf3, 0xfb, 0xaa, 0x18, 0xc2, 0x69, 0xcc, 0x7c, 0x34,
+	0x45, 0xad, 0x54, 0x71, 0xff, 0x8e, 0x95, 0xff, 0xb4, 0xbc, 0xf0, 0xe7,
+	0x3b, 0xdd, 0xfd, 0x96, 0xc8, 0x26, 0x49, 0xf9, 0xff, 0x20, 0xec, 0x68,
+	0x5c, 0x54, 0xf0, 0x7f, 0xe8, 0xbc, 0xff, 0x3d, 0x2b, 0xcc, 0x9e, 0x94,
+	0xc9, 0xf4, 0x6c, 0xb7, 0x84, 0x34, 0xfc, 0x3f, 0x67, 0xfc, 0xa6, 0x4b,
+	0x51, 0x73, 0x36, 0x28, 0x25, 0xef, 0x17, 0x2d, 0x10, 0xf1, 0x26, 0x33,
+	0x31, 0x23, 0x45, 0xda, 0x37, 0xd8, 0x1b, 0x92, 0xd4, 0x0b, 0x52, 0x0b,
+	0x49, 0x8d, 0xce, 0xdf, 0x20, 0x68, 0x71, 0x0a, 0x42, 0x34, 0x41, 0x5c,
+	0x83, 0x25, 0x84, 0x0d, 0x42, 0xbb, 0xdb, 0xee, 0x4c, 0x6a, 0x37, 0x31,
+	0xb3, 0x11, 0x51, 0x36, 0xcb, 0x36, 0xb2, 0x40, 0x3f, 0x6b, 0xa5, 0xca,
+	0xd2, 0x47, 0xaa, 0x37, 0x6a, 0x57, 0x11, 0x66, 0xb4, 0xdc, 0x82, 0x28,
+	0x44, 0x68, 0x8c, 0xe4, 0xee, 0x76, 0x5b, 0x0d, 0xca, 0xc7, 0x68, 0x23,
+	0xd5, 0xbb, 0xb6, 0x38, 0x93, 0xd3, 0x48, 0x2d, 0x36, 0x69, 0x05, 0xb8,
+	0xc6, 0x62, 0xda, 0x47, 0x26, 0xcb, 0xc3, 0x6d, 0xb0, 0xde, 0x2d, 0x21,
+	0xc0, 0x24, 0xb0, 0x8c, 0xea, 0xb0, 0xab, 0x69, 0x9f, 0x98, 0x1f, 0x9b,
+	0x8f, 0x93, 0x6b, 0x0d, 0xd2, 0x40, 0x2a, 0x02, 0xcd, 0x86, 0x21, 0xa7,
+	0x66, 0x08, 0x91, 0x1d, 0x92, 0x07, 0x31, 0xb2, 0xdb, 0x2d, 0x8d, 0x64,
+	0x85, 0x71, 0x0e, 0x34, 0x6d, 0x3c, 0x24, 0xd0, 0x37, 0x31, 0x67, 0x21,
+	0xb7, 0x22, 0xb3, 0x21, 0x6b, 0x4a, 0x65, 0xbd, 0xc8, 0x06, 0xa5, 0x61,
+	0xb7, 0x59, 0xec, 0xb2, 0x0a, 0x69, 0x2d, 0x13, 0x8f, 0x88, 0x1c, 0xa5,
+	0xb1, 0xa2, 0x0a, 0xe4, 0xd1, 0xa6, 0x4b, 0x26, 0x08, 0x83, 0x68, 0xb0,
+	0xdc, 0xd7, 0xa5, 0xad, 0x36, 0xeb, 0x80, 0xa5, 0x0c, 0xaa, 0x99, 0x4f,
+	0xa7, 0x51, 0xeb, 0x95, 0xfa, 0x15, 0x32, 0x9f, 0x43, 0xa5, 0xca, 0xa4,
+	0x12, 0x89, 0x9c, 0xca, 0x52, 0xe2, 0x6a, 0x2a, 0xa6, 0x3e, 0x25, 0x0a,
+	0x55, 0xf3, 0x0a, 0x62, 0xb6, 0x5b, 0x1c, 0x7c, 0x9a, 0xcc, 0x8a, 0x09,
+	0x15, 0xfc, 0x6e, 0x57, 0x96, 0xc3, 0x6a, 0x9d, 0x52, 0xa5, 0x49, 0xa2,
+	0x51, 0x5b, 0x40, 0x66, 0xd3, 0x46, 0xd5, 0x66, 0xc0, 0x11, 0x21, 0x4b,
+	0x15, 0xb2, 0xde, 0x49, 0xe3, 0x6a, 0xba, 0x95, 0x80, 0xdc, 0x81, 0x78,
+	0x82, 0x8c, 0x81, 0x60, 0x93, 0xd0, 0x81, 0x88, 0x67, 0x13, 0x19, 0xcc,
+	0xc8, 0x0f, 0x85, 0x6e, 0x8c, 0x83, 0x91, 0xac, 0xc9, 0x54, 0x08, 0x53,
+	0x48, 0x66, 0x04, 0x63, 0xc4, 0x31, 0x85, 0xc0, 0x11, 0x62, 0x89, 0x5e,
+	0x8e, 0xc2, 0xe6, 0x62, 0x2e, 0x66, 0x4c, 0xe4, 0xf8, 0xa4, 0x11, 0x25,
+	0x39, 0x9a, 0xb6, 0xb2, 0x86, 0xa8, 0x95, 0x98, 0x8e, 0xe8, 0x87, 0xa8,
+	0xb8, 0x01, 0x32, 0x50, 0xdc, 0x89, 0x31, 0x13, 0xbc, 0x8c, 0xc0, 0x56,
+	0x98, 0x5a, 0x80, 0xd6, 0x98, 0x43, 0xc4, 0x61, 0x4e, 0x9a, 0x57, 0x96,
+	0xb2, 0x26, 0x00, 0x15, 0x58, 0x13, 0x02, 0x21, 0xbb, 0x1b, 0x65, 0x86,
+	0xc7, 0x65, 0xb2, 0x14, 0x10, 0xd9, 0x99, 0x38, 0x83, 0x25, 0x09, 0x56,
+	0x6e, 0x72, 0x05, 0xe8, 0x1b, 0x1b, 0xb2, 0x93, 0x7e, 0x1d, 0xe0, 0x6c,
+	0x8a, 0xcb, 0x64, 0x85, 0x14, 0x41, 0x86, 0xd1, 0x85, 0x80, 0xb9, 0xa1,
+	0x0a, 0x89, 0x12, 0x6a, 0x14, 0x71, 0x58, 0x6e, 0x56, 0xcb, 0x48, 0x96,
+	0x0b, 0x5f, 0x19, 0x07, 0x22, 0x79, 0x20, 0x6a, 0x8c, 0xda, 0x69, 0x20,
+	0xa5, 0xda, 0x68, 0x43, 0xb6, 0x61, 0xaa, 0x20, 0xf4, 0x30, 0xab, 0x15,
+	0xd6, 0xd9, 0x6b, 0x31, 0xc6, 0xb6, 0xd9, 0x6d, 0xb6, 0xf7, 0x03, 0x12,
+	0xc2, 0x23, 0x31, 0x15, 0x60, 0xe1, 0x7b, 0x11, 0xf9, 0x27, 0xc6, 0x21,
+	0x2e, 0x11, 0xd8, 0x11, 0x21, 0x42, 0xae, 0x3b, 0x45, 0x86, 0xd8, 0x4d,
+	0x05, 0x4d, 0x05, 0x51, 0x16, 0x01, 0x57, 0xc1, 0x10, 0x02, 0x11, 0xe1,
+	0xb2, 0x96, 0xa8, 0x8e, 0xe1, 0xdb, 0x04, 0xac, 0x84, 0x34, 0xc1, 0xc4,
+	0x47, 0x1c, 0x55, 0xc0, 0x4b, 0xd8, 0x6f, 0x22, 0xd6, 0x24, 0x20, 0x42,
+	0x92, 0x2d, 0x80, 0x4a, 0xa2, 0x2b, 0x14, 0x76, 0x1b, 0x65, 0xa6, 0xcf,
+	0x6e, 0x19, 0x82, 0x25, 0x34, 0x13, 0xc7, 0xb1, 0xb9, 0xe0, 0x8f, 0xc0,
+	0x90, 0x10, 0xd8, 0x87, 0xd0, 0xad, 0xb7, 0x0b, 0x95, 0x96, 0xe6, 0x58,
+	0x64, 0x04, 0x22, 0x0b, 0xe4, 0x45, 0x66, 0xfd, 0x0b, 0x69, 0xba, 0x4b,
+	0x1e, 0xd5, 0x05, 0x5c, 0x6d, 0x83, 0x9e, 0x23, 0x22, 0x26, 0xa8, 0x46,
+	0xc5, 0xfc, 0xcd, 0x8f, 0xf9, 0x1b, 0x8f, 0x8e, 0x49, 0xac, 0x6f, 0x40,
+	0x37, 0x43, 0x89, 0x11, 0x06, 0x7b, 0xe1, 0x2c, 0x2a, 0x1e, 0xad, 0xf0,
+	0x90, 0xe2, 0x50, 0xbf, 0xc2, 0x87, 0xa9, 0x29, 0x39, 0xaf, 0xee, 0x6c,
+	0x7f, 0xc8, 0xeb, 0x76, 0x8b, 0x61, 0x25, 0xc1, 0xb7, 0x5d, 0x6d, 0xb6,
+	0x20, 0x3a, 0x26, 0x67, 0x20, 0xd5, 0x10, 0xfd, 0x15, 0x7f, 0x33, 0x48,
+	0x6b, 0x0b, 0xba, 0x2b, 0xc6, 0xa5, 0xcc, 0x3e, 0x46, 0xd3, 0x66, 0xb4,
+	0x88, 0x78, 0xdd, 0x17, 0x51, 0x01, 0xe9, 0x21, 0x44, 0xf0, 0x57, 0x4b,
+	0x7d, 0xc0, 0xbc, 0x55, 0x3c, 0x04, 0xc7, 0x8c, 0x35, 0x85, 0x54, 0x44,
+	0x35, 0x0c, 0xd3, 0x44, 0x2e, 0x85, 0x6a, 0xc6, 0x82, 0x36, 0x38, 0x63,
+	0xa3, 0x7a, 0xb2, 0xdc, 0xad, 0xef, 0xa2, 0xb0, 0xa3, 0x0c, 0x61, 0x3c,
+	0x62, 0xd8, 0x36, 0x7a, 0x2b, 0x65, 0xd5, 0xd7, 0x04, 0x41, 0x9c, 0x9d,
+	0xca, 0xdf, 0x6f, 0x58, 0xe1, 0xb7, 0x06, 0x18, 0x86, 0xb0, 0xda, 0x2c,
+	0xb6, 0xc1, 0x25, 0x17, 0xb2, 0x16, 0xfa, 0x40, 0x5f, 0x2b, 0x9d, 0xd1,
+	0xcd, 0x06, 0xda, 0x21, 0xc6, 0xb3, 0xe2, 0xfd, 0x0a, 0x5b, 0xc4, 0x4e,
+	0x64, 0xc0, 0xc2, 0x20, 0xcd, 0x2e, 0x90, 0x53, 0xd6, 0x08, 0xa6, 0x52,
+	0xe9, 0x90, 0x57, 0x9b, 0x6c, 0x89, 0x2c, 0x92, 0xfa, 0x0d, 0xb6, 0xc3,
+	0x64, 0x60, 0x42, 0x85, 0x02, 0x92, 0x5c, 0xad, 0xf7, 0x75, 0xbe, 0x24,
+	0x8f, 0x15, 0x4a, 0x5b, 0x6d, 0x96, 0xcf, 0x61, 0x6d, 0x75, 0x57, 0x01,
+	0xba, 0x2b, 0x19, 0x87, 0x42, 0xb0, 0x30, 0xca, 0xa5, 0xb6, 0x79, 0x50,
+	0xa0, 0x25, 0xce, 0xd3, 0x78, 0x29, 0xd4, 0x2f, 0x53, 0xb4, 0xde, 0x98,
+	0x10, 0xdf, 0x84, 0x5c, 0xe4, 0x6b, 0x74, 0xca, 0xd5, 0x4e, 0xa7, 0x5d,
+	0xad, 0xd7, 0x4b, 0xbd, 0x58, 0xac, 0xcd, 0xff, 0x1b, 0x84, 0xd9, 0xe4,
+	0x98, 0xa8, 0x96, 0x94, 0xad, 0xb6, 0xf1, 0x48, 0x32, 0x66, 0x36, 0xbe,
+	0x4b, 0x73, 0xd4, 0x1b, 0x9a, 0x0a, 0xf4, 0x3d, 0xb6, 0xea, 0xfe, 0x43,
+	0x73, 0xb6, 0x3d, 0x30, 0xdc, 0x8e, 0x6d, 0xd6, 0xc5, 0x9a, 0x05, 0x6b,
+	0x55, 0x78, 0x54, 0x28, 0xe7, 0x06, 0xae, 0x80, 0x84, 0x0b, 0x88, 0xb5,
+	0x02, 0xbc, 0x22, 0x25, 0xc8, 0x4f, 0x67, 0x66, 0xb9, 0x5b, 0xed, 0xaa,
+	0xc6, 0x74, 0xca, 0xd4, 0xde, 0x70, 0xc9, 0x43, 0x6d, 0xb4, 0xdb, 0x2f,
+	0x22, 0x78, 0x36, 0xe6, 0x4d, 0x17, 0x36, 0x17, 0x87, 0x25, 0xf6, 0x7b,
+	0xa0, 0x31, 0x0d, 0xa6, 0xd9, 0x64, 0x2b, 0xd1, 0x76, 0xa1, 0x5c, 0xa1,
+	0xb1, 0xdd, 0x2d, 0x36, 0xfb, 0x75, 0x85, 0xc0, 0xc5, 0x81, 0x84, 0xbe,
+	0x44, 0x24, 0x4e, 0xe6, 0xfb, 0x64, 0xaf, 0x82, 0xf5, 0xa3, 0x2c, 0x03,
+	0x41, 0x7f, 0x21, 0x5b, 0x42, 0x0e, 0x76, 0xb1, 0x59, 0x56, 0x88, 0xcb,
+	0xe0, 0x96, 0x88, 0x9c, 0xe4, 0x55, 0x90, 0xd1, 0xce, 0x18, 0xe4, 0xc5,
+	0x04, 0xac, 0x80, 0x26, 0x2c, 0xf2, 0x4a, 0xbe, 0xeb, 0x14, 0x6c, 0x72,
+	0x76, 0x66, 0xef, 0x13, 0x49, 0x2b, 0x4d, 0xd2, 0x5d, 0x0a, 0xa1, 0xad,
+	0xa8, 0xb3, 0x3b, 0x2a, 0x70, 0xce, 0x55, 0x65, 0x1b, 0xf0, 0xac, 0xe6,
+	0x90, 0x2e, 0xd0, 0x4c, 0xf4, 0x32, 0xa4, 0x15, 0x16, 0xc9, 0x1a, 0x4d,
+	0x52, 0xa6, 0xda, 0x03, 0x31, 0x6d, 0x42, 0x50, 0x93, 0x5b, 0xe4, 0x47,
+	0x28, 0x85, 0x59, 0x2d, 0xf6, 0x57, 0xba, 0x20, 0xf1, 0x53, 0x67, 0x46,
+	0x69, 0x63, 0x68, 0xab, 0x98, 0x0e, 0x93, 0xd2, 0x8a, 0xfb, 0x09, 0x9e,
+	0x0a, 0xe0, 0x0d, 0xe4, 0x43, 0x8e, 0xcf, 0x65, 0xba, 0x0a, 0x6f, 0xfc,
+	0x81, 0x92, 0x39, 0x8b, 0xba, 0x2a, 0x0a, 0x8a, 0x90, 0x98, 0xd2, 0x0c,
+	0xe5, 0x9e, 0x49, 0x72, 0xdc, 0x9b, 0xc9, 0x02, 0x8a, 0xe7, 0x20, 0x97,
+	0x4b, 0xa5, 0xd2, 0x05, 0xf1, 0x11, 0xd6, 0xff, 0x8e, 0xd0, 0x22, 0x9e,
+	0xe9, 0x30, 0x67, 0x92, 0x99, 0x4d, 0x66, 0xa5, 0xc2, 0x69, 0xba, 0xcf,
+	0x74, 0x33, 0x29, 0xac, 0xda, 0x41, 0x65, 0xb6, 0xdc, 0x2e, 0x8e, 0xa2,
+	0x29, 0x6f, 0xc5, 0xe2, 0xab, 0xce, 0xb6, 0x6b, 0x7d, 0xc9, 0x2b, 0x55,
+	0x3e, 0xe6, 0x65, 0x35, 0x9b, 0xcb, 0xa4, 0x15, 0x7b, 0x43, 0xee, 0x0a,
+	0x5c, 0x6b, 0xce, 0x15, 0xd4, 0x45, 0x84, 0x0c, 0x4d, 0x02, 0x51, 0x3f,
+	0x11, 0xb6, 0xc6, 0xce, 0x73, 0x02, 0xdc, 0xca, 0x60, 0x42, 0xca, 0x42,
+	0x8f, 0x63, 0x6e, 0x77, 0x81, 0x0b, 0x41, 0x07, 0xc7, 0x95, 0x4b, 0x68,
+	0xd2, 0xa9, 0x05, 0xbd, 0x94, 0xc6, 0xdf, 0x6e, 0x90, 0x4a, 0x25, 0x55,
+	0x3a, 0x45, 0x4a, 0x93, 0x4e, 0xa5, 0xd7, 0x2b, 0xf4, 0xfa, 0x85, 0x52,
+	0xb9, 0x5f, 0x51, 0xd3, 0xa3, 0x54, 0xa8, 0xb4, 0x5a, 0xd5, 0x16, 0x55,
+	0x29, 0x90, 0x5a, 0xec, 0xb6, 0x5b, 0x85, 0xce, 0x15, 0x75, 0xb9, 0xa5,
+	0x89, 0xa8, 0x08, 0x84, 0xa1, 0xbd, 0xc9, 0x3f, 0x7a, 0x07, 0x79, 0x04,
+	0x70, 0x81, 0xd1, 0x03, 0x4a, 0x06, 0x79, 0xaa, 0x21, 0x3e, 0xa9, 0xd8,
+	0xed, 0x16, 0x1b, 0x75, 0x9c, 0xfc, 0x50, 0x10, 0x8e, 0x15, 0x64, 0xb2,
+	0xb5, 0x92, 0x3a, 0x60, 0xd9, 0x2d, 0x8f, 0x32, 0x20, 0x2e, 0x41, 0xc2,
+	0xad, 0x60, 0xd6, 0xcb, 0x7d, 0xbe, 0xd6, 0x8d, 0x67, 0x28, 0x40, 0xa2,
+	0x96, 0x07, 0x89, 0xca, 0x64, 0x17, 0x0b, 0x09, 0x2e, 0x0a, 0x5a, 0x10,
+	0x88, 0x0d, 0xbe, 0xe0, 0xfb, 0x82, 0x99, 0xe2, 0x24, 0x0a, 0xfa, 0x42,
+	0xfe, 0x63, 0x61, 0xb1, 0x5b, 0x2c, 0xb0, 0xab, 0xa5, 0xde, 0xd2, 0x38,
+	0xe2, 0xaa, 0x86, 0x71, 0xea, 0x97, 0x1b, 0x28, 0x9a, 0x4e, 0x01, 0x4c,
+	0xa5, 0x32, 0xc0, 0x80, 0x56, 0xb2, 0x47, 0x0d, 0x35, 0x53, 0x54, 0x82,
+	0x38, 0x51, 0x54, 0x8d, 0x9a, 0xd8, 0x69, 0xe3, 0x61, 0xb9, 0x5c, 0x95,
+	0xb4, 0x8e, 0x4c, 0xae, 0x56, 0x5b, 0x35, 0xa6, 0xf0, 0xa8, 0xc4, 0x6b,
+	0xaa, 0x0b, 0x22, 0x37, 0x09, 0x73, 0x90, 0x4a, 0x26, 0x4f, 0xbc, 0x80,
+	0xae, 0x77, 0x7b, 0x90, 0x83, 0x8d, 0xcd, 0x25, 0x11, 0xb4, 0xc6, 0x14,
+	0x1d, 0x02, 0x5d, 0x46, 0x58, 0x67, 0x72, 0xb7, 0xdb, 0xae, 0x8e, 0xac,
+	0x66, 0xb0, 0x21, 0xa8, 0x37, 0x92, 0xbe, 0x46, 0xa4, 0x20, 0x1a, 0x13,
+	0x06, 0x10, 0x97, 0x2b, 0x6d, 0xc0, 0xcd, 0x88, 0xef, 0xcc, 0x49, 0xc5,
+	0x47, 0x26, 0x58, 0xd8, 0x89, 0x2a, 0x96, 0xd1, 0x14, 0x75, 0xe7, 0xb3,
+	0x99, 0x53, 0x3a, 0x94, 0x82, 0xe7, 0x6d, 0xb0, 0x88, 0xb0, 0xd6, 0xec,
+	0xa4, 0x48, 0x29, 0xa0, 0x48, 0x08, 0x57, 0x3b, 0xca, 0x28, 0x8d, 0xb4,
+	0xd2, 0xd4, 0x3b, 0xc6, 0x6c, 0x68, 0x66, 0x5e, 0x25, 0x33, 0x97, 0x4d,
+	0x4d, 0x0c, 0xa5, 0xd0, 0xa3, 0x23, 0x1b, 0xa5, 0x96, 0xf1, 0x74, 0x41,
+	0x42, 0x14, 0x04, 0xb3, 0x59, 0x6e, 0xf2, 0x0b, 0x85, 0x96, 0xe5, 0x63,
+	0xb2, 0x8d, 0x10, 0xdb, 0x2c, 0x37, 0x2b, 0x38, 0x9b, 0x89, 0xa6, 0x89,
+	0xcd, 0x55, 0x88, 0xdc, 0x46, 0xc3, 0x62, 0x04, 0xf2, 0xb3, 0x5b, 0xee,
+	0xa2, 0x18, 0x27, 0x80, 0x2a, 0x60, 0x50, 0xab, 0x31, 0x25, 0x91, 0x1f,
+	0x0a, 0x04, 0x21, 0x78, 0x18, 0x9a, 0xb3, 0xae, 0x22, 0x07, 0xa5, 0x50,
+	0xf0, 0x0a, 0xa7, 0x65, 0xb9, 0x32, 0xa8, 0xbb, 0x8a, 0x1d, 0xf9, 0xdc,
+	0xc5, 0x88, 0xd0, 0xb5, 0x65, 0x12, 0xa4, 0x2e, 0x3a, 0xe5, 0x7e, 0xa7,
+	0x45, 0xa9, 0x52, 0x68, 0xb5, 0x37, 0x0a, 0x16, 0xa4, 0x26, 0xd8, 0x1b,
+	0x6d, 0x95, 0x20, 0x46, 0xc6, 0xa8, 0xe2, 0x47, 0x44, 0x7b, 0x68, 0x50,
+	0x04, 0x67, 0x63, 0x0a, 0x2a, 0x01, 0x98, 0xcd, 0x93, 0x81, 0x2e, 0x76,
+	0x1b, 0x6d, 0xc1, 0xda, 0x05, 0x52, 0x0a, 0x6d, 0x34, 0x96, 0x93, 0x79,
+	0x09, 0x61, 0xdd, 0x06, 0xfc, 0x53, 0xa9, 0x48, 0xc0, 0x42, 0x2c, 0x47,
+	0x1d, 0xee, 0xd6, 0x1b, 0x65, 0xd5, 0xe3, 0x09, 0xdb, 0x46, 0x14, 0x59,
+	0xa3, 0x74, 0x33, 0x71, 0x30, 0x41, 0xb4, 0xd8, 0x6d, 0xc0, 0xc0, 0x83,
+	0xde, 0x66, 0xc2, 0x24, 0xfa, 0x36, 0x4b, 0x7d, 0xd5, 0xed, 0xc5, 0x51,
+	0xc5, 0xb6, 0x1a, 0x55, 0x2d, 0xa4, 0xca, 0xa1, 0x4d, 0xe1, 0xa3, 0x10,
+	0x95, 0xca, 0xfd, 0x26, 0x9d, 0x54, 0x18, 0xe2, 0xb7, 0x5d, 0x2c, 0xa2,
+	0x14, 0x26, 0x40, 0x34, 0x24, 0xe2, 0x2b, 0x78, 0xb1, 0x89, 0x26, 0x8d,
+	0x91, 0x0b, 0x51, 0x21, 0x8c, 0xb3, 0x08, 0x7f, 0x84, 0xf5, 0x84, 0xd3,
+	0xdd, 0xe6, 0x4c, 0xd3, 0x48, 0x46, 0xd1, 0x55, 0x0c, 0x6f, 0xd1, 0xd2,
+	0x98, 0xfe, 0x09, 0x12, 0xc9, 0xc9, 0x9e, 0xee, 0x69, 0xc4, 0x5e, 0xa4,
+	0x0f, 0xc4, 0xf5, 0x24, 0xdd, 0x84, 0x0d, 0xa6, 0x11, 0x63, 0x46, 0xb0,
+	0xd8, 0xec, 0xb6, 0x27, 0x80, 0x19, 0x3d, 0xce, 0x41, 0x47, 0x25, 0xb1,
+	0xb6, 0x5b, 0x11, 0xc0, 0x5c, 0xf8, 0x6c, 0x56, 0x1b, 0x99, 0xde, 0x89,
+	0xd5, 0xa5, 0x92, 0xed, 0x61, 0xb7, 0x5d, 0x2c, 0x2e, 0x9e, 0x36, 0xfb,
+	0x32, 0xc3, 0x0c, 0xa8, 0x56, 0xcc, 0x75, 0x0c, 0x84, 0xd2, 0xe7, 0x74,
+	0xb7, 0xdc, 0x81, 0xe0, 0x94, 0xcd, 0xac, 0xd6, 0x64, 0x35, 0x1b, 0x73,
+	0xdf, 0x0b, 0x97, 0x8d, 0xdd, 0x22, 0x48, 0xda, 0x4a, 0xd8, 0x26, 0xc7,
+	0x77, 0xb7, 0xc2, 0x8c, 0x86, 0x15, 0x1c, 0x42, 0xc0, 0xca, 0x55, 0x40,
+	0x24, 0x8f, 0x98, 0x6c, 0xf7, 0x51, 0x07, 0x12, 0x4b, 0x3b, 0x90, 0xf7,
+	0x8a, 0x63, 0x3d, 0xea, 0xcb, 0x72, 0xb7, 0x9d, 0x2c, 0x82, 0x59, 0x28,
+	0x40, 0xb6, 0xb0, 0x9d, 0xd8, 0xdc, 0xae, 0xf6, 0x92, 0xea, 0x11, 0xcd,
+	0x22, 0xee, 0x39, 0xcc, 0xb2, 0x41, 0x31, 0x99, 0x1d, 0x20, 0xcd, 0x9b,
+	0x5c, 0xa6, 0xd3, 0x85, 0x07, 0x4b, 0x21, 0x3e, 0x09, 0x01, 0x8a, 0x54,
+	0x8b, 0x76, 0x8a, 0x84, 0x93, 0xe2, 0x94, 0xb8, 0xc0, 0x46, 0x88, 0x43,
+	0x48, 0x61, 0xdf, 0x6b, 0x14, 0xfa, 0x92, 0x6b, 0xc0, 0x0b, 0x0d, 0xda,
+	0xd3, 0x6f, 0xba, 0xdc, 0xc7, 0xb9, 0x9b, 0x4c, 0x57, 0x8c, 0xdc, 0xd9,
+	0x19, 0x98, 0x6e, 0x44, 0xe8, 0x43, 0x78, 0x76, 0x59, 0x74, 0x82, 0x9e,
+	0x72, 0x2f, 0x6f, 0xb7, 0x5b, 0x13, 0x14, 0x90, 0x28, 0xdc, 0xb4, 0xcc,
+	0xbe, 0x2c, 0xb6, 0x13, 0xbd, 0x36, 0x68, 0x3b, 0x95, 0x86, 0xd3, 0x6c,
+	0x4a, 0x82, 0x37, 0x82, 0x01, 0x12, 0x41, 0xb3, 0x3e, 0xb2, 0x30, 0xf8,
+	0x54, 0x81, 0xb6, 0x5b, 0xd2, 0xa4, 0x53, 0x60, 0xee, 0xe7, 0x24, 0x2a,
+	0xf0, 0xac, 0x7c, 0x52, 0x89, 0x8a, 0xe1, 0x8a, 0x84, 0x8b, 0xf1, 0x8d,
+	0xd6, 0xdc, 0xed, 0x02, 0xa6, 0x67, 0x79, 0x07, 0x41, 0xba, 0x42, 0x8a,
+	0x0c, 0xd0, 0x79, 0x24, 0x17, 0x0b, 0x61, 0x69, 0x0a, 0x98, 0xb1, 0x9c,
+	0x20, 0x43, 0x89, 0xe6, 0x95, 0x24, 0x93, 0x54, 0xc3, 0xbe, 0x8e, 0x83,
+	0x90, 0x99, 0xbb, 0x82, 0xd9, 0x9e, 0x5c, 0x41, 0x44, 0x49, 0x5c, 0xd5,
+	0x7e, 0xda, 0x90, 0x53, 0xb8, 0xef, 0x37, 0x07, 0xc8, 0x72, 0x0e, 0x49,
+	0x64, 0x82, 0xe7, 0x6f, 0x71, 0x82, 0x74, 0x27, 0xb7, 0x59, 0x6c, 0xb6,
+	0x48, 0x52, 0xec, 0x0d, 0x8a, 0xcb, 0x20, 0xb3, 0xda, 0x6e, 0xcd, 0x24,
+	0x29, 0x0e, 0x36, 0xe7, 0xe9, 0x32, 0xbf, 0x5b, 0x75, 0x9e, 0x5d, 0x20,
+	0xa2, 0x82, 0x39, 0x0d, 0xf2, 0x35, 0xbb, 0x36, 0x2a, 0x20, 0x3b, 0x0e,
+	0x29, 0x1b, 0xc1, 0x1c, 0x51, 0x0d, 0x68, 0xdc, 0x9e, 0x08, 0x5a, 0xb1,
+	0x01, 0xe4, 0x59, 0xa4, 0x46, 0x44, 0xc7, 0x72, 0x04, 0x9c, 0xce, 0xcc,
+	0xd5, 0x54, 0x5c, 0x54, 0x99, 0x08, 0xad, 0xd7, 0x50, 0xbc, 0x1b, 0x93,
+	0xe4, 0x93, 0x23, 0x1c, 0x2a, 0xd9, 0x65, 0xb3, 0x5d, 0x24, 0x16, 0xfb,
+	0xb0, 0x85, 0xa2, 0x9f, 0x8d, 0xa6, 0xc8, 0xe8, 0xc7, 0x6d, 0x2e, 0xe1,
+	0x78, 0x42, 0xb0, 0xab, 0x9b, 0x33, 0x42, 0xb4, 0x99, 0x5b, 0xcb, 0xa8,
+	0x59, 0x19, 0x54, 0xec, 0x6c, 0x36, 0xe6, 0xa2, 0x11, 0xa6, 0x28, 0x55,
+	0x8d, 0xb2, 0x85, 0x54, 0x84, 0xaf, 0x5a, 0xcb, 0x64, 0x42, 0x41, 0xb7,
+	0x48, 0x26, 0x53, 0x06, 0x45, 0x23, 0x51, 0x81, 0x71, 0x1b, 0x1d, 0xbd,
+	0x6a, 0x0a, 0xe0, 0xd0, 0x84, 0xb0, 0x4a, 0x3d, 0xe6, 0x19, 0xc9, 0x6d,
+	0x5e, 0x81, 0xb9, 0xa5, 0x81, 0x06, 0x48, 0xbf, 0xa8, 0xbe, 0x50, 0xcc,
+	0x03, 0x88, 0x54, 0x57, 0x26, 0x92, 0x57, 0xc9, 0x61, 0xa5, 0x31, 0xc5,
+	0x16, 0xc0, 0x21, 0x37, 0x19, 0x94, 0xde, 0x4a, 0x15, 0xe6, 0x22, 0x6f,
+	0x0a, 0x5a, 0xb5, 0x1a, 0xe2, 0x35, 0x93, 0x12, 0x23, 0x9b, 0x4c, 0x29,
+	0xb6, 0x9a, 0x14, 0xbe, 0xe6, 0x2a, 0xc9, 0x57, 0xb7, 0xdc, 0xac, 0x92,
+	0x0a, 0x95, 0x95, 0x2f, 0x4e, 0xda, 0x20, 0x62, 0xee, 0x29, 0x77, 0x6e,
+	0x62, 0x27, 0xb1, 0x6e, 0xd6, 0x45, 0x52, 0xb7, 0x5c, 0xc2, 0xc0, 0x6d,
+	0xa2, 0xfd, 0x15, 0x7a, 0x7d, 0x4a, 0x88, 0x31, 0xab, 0x61, 0x01, 0x52,
+	0x96, 0x8e, 0xa0, 0xba, 0x78, 0x85, 0x81, 0x51, 0x6d, 0xd6, 0x7b, 0x65,
+	0xa6, 0xe7, 0x68, 0x85, 0x07, 0x69, 0x81, 0x31, 0xdb, 0xec, 0xe0, 0x3a,
+	0x2f, 0x82, 0x52, 0xa9, 0x6d, 0x5e, 0x54, 0xf4, 0x02, 0xfa, 0x85, 0x20,
+	0x1a, 0x71, 0x79, 0x91, 0x0d, 0x21, 0xb7, 0x02, 0xd2, 0x3e, 0x4b, 0x0b,
+	0xca, 0x58, 0xd8, 0x54, 0x88, 0x1c, 0x55, 0xbc, 0xd1, 0x94, 0x66, 0x33,
+	0x29, 0xa8, 0x3e, 0x95, 0xb4, 0xb1, 0x85, 0xbe, 0xc9, 0x4e, 0x0a, 0xea,
+	0x09, 0x02, 0x00, 0x83, 0x22, 0x7c, 0x11, 0x91, 0x4b, 0x24, 0x12, 0x22,
+	0xab, 0x37, 0xad, 0x2b, 0x2d, 0xca, 0xe5, 0x6f, 0xb9, 0x48, 0x80, 0x94,
+	0xe4, 0x4c, 0xae, 0x36, 0xeb, 0x2d, 0x8d, 0xd7, 0x09, 0xeb, 0x46, 0xd3,
+	0x73, 0x85, 0x38, 0x02, 0x81, 0xe8, 0xac, 0x1a, 0x2b, 0x49, 0x04, 0x18,
+	0x8d, 0xc9, 0x82, 0xd8, 0xdb, 0x4e, 0x94, 0x67, 0x00, 0xae, 0x53, 0x29,
+	0xa9, 0xd3, 0x8a, 0x9d, 0x88, 0x34, 0x08, 0x42, 0x08, 0x77, 0x12, 0x56,
+	0x89, 0x40, 0xad, 0x96, 0x14, 0x22, 0x6c, 0x44, 0x83, 0x6e, 0xb2, 0x5b,
+	0xee, 0xe2, 0x86, 0x96, 0x5b, 0xbd, 0x96, 0xe4, 0xa7, 0x23, 0x68, 0xb7,
+	0xdc, 0x8d, 0xa4, 0x65, 0x83, 0x5a, 0x37, 0x4b, 0x1d, 0xa0, 0x84, 0x95,
+	0x52, 0x89, 0x8f, 0x51, 0x0c, 0x86, 0xef, 0x68, 0xb7, 0x84, 0x18, 0xbc,
+	0xd1, 0x8d, 0x6b, 0xd0, 0x6a, 0x74, 0x3a, 0x4d, 0x25, 0x12, 0x46, 0xe8,
+	0x6d, 0x22, 0x42, 0x68, 0xfa, 0xcd, 0x2e, 0x90, 0x50, 0x5b, 0xe9, 0x03,
+	0x3c, 0xd5, 0xef, 0x2c, 0x76, 0x1b, 0x85, 0xa6, 0xe9, 0x61, 0xb6, 0x11,
+	0x01, 0x87, 0xb1, 0x5b, 0x2d, 0x8c, 0x5a, 0x21, 0x4a, 0x63, 0x3c, 0x36,
+	0x3b, 0x7d, 0xcc, 0x68, 0x85, 0x02, 0x08, 0x01, 0x8c, 0x6e, 0x4c, 0x4e,
+	0x86, 0xcd, 0x6c, 0xb0, 0xae, 0x69, 0x14, 0x41, 0xae, 0xf1, 0x28, 0x89,
+	0x3f, 0xb9, 0x0a, 0x21, 0x09, 0x08, 0xdd, 0x9a, 0x80, 0x8a, 0xe0, 0xc6,
+	0x95, 0x08, 0x54, 0xac, 0xb7, 0x30, 0xa3, 0x17, 0xdc, 0x85, 0x0d, 0x69,
+	0x94, 0xd6, 0x6a, 0x41, 0x08, 0xe7, 0xa2, 0xee, 0x06, 0x0b, 0xe8, 0x32,
+	0x25, 0x69, 0xbc, 0x23, 0xc1, 0x20, 0x69, 0x5c, 0xe1, 0x52, 0xa7, 0x9a,
+	0x39, 0x51, 0x41, 0x15, 0x6e, 0xe7, 0x68, 0xb9, 0x5a, 0x6d, 0xd6, 0xb9,
+	0x75, 0x8d, 0xaf, 0x89, 0x4e, 0x89, 0x51, 0x86, 0xd0, 0x77, 0xc4, 0xa9,
+	0x44, 0x63, 0x62, 0xaa, 0x06, 0x62, 0x6a, 0x7d, 0xee, 0xa3, 0x28, 0xa0,
+	0x0a, 0xea, 0xb4, 0xbf, 0x44, 0x63, 0x64, 0x56, 0x23, 0x2a, 0xb9, 0x22,
+	0x58, 0xa1, 0x10, 0xdb, 0x6c, 0x92, 0xa6, 0xd1, 0x56, 0xb2, 0x1b, 0x9d,
+	0xb4, 0x2c, 0x85, 0x75, 0xc6, 0xc3, 0x66, 0x36, 0x91, 0x6b, 0x88, 0x37,
+	0xc2, 0x85, 0x5a, 0xae, 0xa6, 0x74, 0x26, 0x34, 0x36, 0x63, 0x39, 0x14,
+	0x7a, 0x13, 0x1b, 0x40, 0x1c, 0x73, 0x27, 0x1b, 0x7d, 0x91, 0x75, 0xc6,
+	0xd0, 0x63, 0x42, 0x94, 0x69, 0x6f, 0x54, 0x01, 0x6d, 0xf4, 0xa0, 0xdb,
+	0xac, 0x36, 0xcb, 0xcd, 0xcd, 0xf4, 0xc4, 0x64, 0x16, 0x82, 0xeb, 0x0e,
+	0xa8, 0x2e, 0x57, 0xac, 0xc4, 0x64, 0x2c, 0xc6, 0x28, 0x06, 0x35, 0xa4,
+	0x63, 0x68, 0x20, 0x08, 0x50, 0x62, 0x04, 0xa8, 0x8c, 0x6e, 0x79, 0x24,
+	0xaa, 0x8a, 0x6f, 0xa5, 0x70, 0x15, 0x61, 0x3b, 0x51, 0xb0, 0x89, 0x48,
+	0xa0, 0x48, 0x9a, 0x71, 0x59, 0x55, 0xc1, 0x2f, 0x27, 0x7c, 0x56, 0x80,
+	0x29, 0x1b, 0xbd, 0x96, 0xd9, 0x6c, 0x39, 0x92, 0xb6, 0xda, 0x6c, 0xf6,
+	0x82, 0x38, 0x89, 0x64, 0x29, 0x4e, 0xc4, 0xdc, 0x0d, 0xdd, 0x5c, 0x2a,
+	0x8d, 0x21, 0xc4, 0xe4, 0x49, 0xfe, 0x88, 0x8e, 0xa0, 0xd6, 0xc6, 0xd8,
+	0x15, 0x22, 0xc5, 0xcc, 0xf0, 0x06, 0x51, 0xd0, 0xcb, 0xa4, 0x0d, 0x25,
+	0x61, 0x4a, 0xc1, 0xb6, 0x21, 0x18, 0xd5, 0xc9, 0x91, 0x4f, 0x64, 0xac,
+	0x24, 0x30, 0x67, 0xc2, 0x29, 0x62, 0x2c, 0xba, 0x23, 0x86, 0x56, 0xc3,
+	0xee, 0x49, 0x54, 0xb6, 0xd5, 0x2a, 0x12, 0x44, 0xb1, 0xdb, 0xed, 0x97,
+	0x5b, 0x6d, 0xb8, 0xf5, 0xce, 0x75, 0x0a, 0x3c, 0xe1, 0x6f, 0x21, 0xb9,
+	0x5b, 0xee, 0x17, 0x97, 0x4f, 0x46, 0xe6, 0x1b, 0x2d, 0xca, 0x5b, 0x30,
+	0x35, 0x36, 0x76, 0x82, 0x3b, 0x33, 0xb8, 0x2e, 0xb8, 0xa8, 0x69, 0x1e,
+	0x70, 0xdc, 0xae, 0xb6, 0xe7, 0x4e, 0x5b, 0x35, 0xca, 0xc2, 0xf9, 0x66,
+	0xbb, 0x2e, 0xbd, 0x88, 0x7b, 0x24, 0x96, 0x8e, 0x7c, 0x8a, 0x81, 0x07,
+	0x65, 0x6b, 0x51, 0x40, 0x51, 0x7b, 0x13, 0x85, 0x29, 0x00, 0xdd, 0xd7,
+	0xb8, 0xab, 0x75, 0x2a, 0x65, 0x14, 0x08, 0x48, 0x68, 0x52, 0xea, 0x85,
+	0xa5, 0x66, 0x4d, 0x41, 0x04, 0x05, 0x38, 0x8f, 0xf0, 0xa5, 0x88, 0x82,
+	0x03, 0x28, 0x91, 0xdc, 0xac, 0xa6, 0xbe, 0x41, 0x93, 0x17, 0x38, 0x52,
+	0x41, 0x12, 0x58, 0xa8, 0x0e, 0x69, 0xe1, 0x8d, 0xbe, 0xe5, 0x6b, 0x4e,
+	0x81, 0x6d, 0x42, 0x7d, 0xf7, 0x57, 0x63, 0xb3, 0xa1, 0x10, 0xd9, 0x2f,
+	0x2c, 0xa8, 0x36, 0x1b, 0x91, 0xe4, 0x0c, 0xaa, 0x41, 0x6c, 0xbd, 0x5c,
+	0x0e, 0x23, 0xf8, 0x35, 0xc8, 0xd4, 0x00, 0x84, 0xed, 0xf7, 0x5b, 0x61,
+	0x3f, 0x95, 0x96, 0xc9, 0x69, 0xb1, 0xdd, 0x11, 0xd8, 0xca, 0xdc, 0x4e,
+	0xa1, 0x09, 0xcc, 0x80, 0x71, 0xd8, 0xd5, 0xd3, 0xb1, 0x00, 0x95, 0x55,
+	0x3c, 0x57, 0xa0, 0xd7, 0x10, 0x89, 0xc8, 0x8f, 0x0c, 0x44, 0x4d, 0x6c,
+	0x37, 0x22, 0x6d, 0x15, 0xef, 0x1b, 0x3d, 0x95, 0x5f, 0xc6, 0xd9, 0x6f,
+	0xb7, 0x59, 0xd7, 0xa8, 0xc3, 0x21, 0x56, 0xbc, 0x6e, 0x76, 0x1b, 0xb0,
+	0x9f, 0x13, 0xd8, 0x98, 0xd0, 0x2d, 0x86, 0x41, 0x68, 0xb2, 0xb3, 0x89,
+	0x58, 0x6e, 0x0d, 0x34, 0xc6, 0x1c, 0x50, 0xa8, 0x50, 0x44, 0x88, 0x13,
+	0x22, 0xd7, 0x90, 0x6c, 0x0d, 0x9d, 0x6e, 0x05, 0xe9, 0x89, 0x8d, 0x62,
+	0x45, 0x20, 0xb4, 0xd9, 0x9d, 0x94, 0x88, 0xc5, 0xd3, 0xf0, 0x47, 0x02,
+	0x18, 0x31, 0x21, 0x46, 0xd2, 0xf7, 0x39, 0x05, 0x8e, 0xd8, 0xc2, 0xc4,
+	0xff, 0x63, 0x65, 0x2a, 0xc3, 0x37, 0x4b, 0x1e, 0x93, 0xb2, 0x58, 0x6e,
+	0x96, 0x15, 0xec, 0x40, 0xaf, 0x31, 0xad, 0x2b, 0xcb, 0x1a, 0x4c, 0x28,
+	0xa4, 0x0a, 0xdd, 0x63, 0xb9, 0x5e, 0x6e, 0x17, 0x43, 0x26, 0x26, 0x1e,
+	0x17, 0xa6, 0x2b, 0x48, 0xfe, 0x0b, 0x1b, 0xa5, 0xa6, 0xc5, 0x6c, 0xb2,
+	0xab, 0x0f, 0xf5, 0x16, 0x51, 0xb2, 0xdc, 0xae, 0xf6, 0x9b, 0x9d, 0x95,
+	0xb0, 0x52, 0x44, 0xe0, 0x03, 0x65, 0xba, 0x5a, 0x6e, 0x84, 0xf0, 0x2a,
+	0xc2, 0xcd, 0x8e, 0x41, 0x82, 0x20, 0xac, 0x27, 0x08, 0x48, 0x4a, 0x60,
+	0x82, 0x86, 0x24, 0x46, 0x6e, 0x74, 0x39, 0x51, 0xd4, 0x43, 0xe9, 0x89,
+	0x40, 0x9a, 0xa8, 0x25, 0x0e, 0xa7, 0x56, 0x00, 0x22, 0x76, 0x61, 0x2e,
+	0xd5, 0xb6, 0x5b, 0xdb, 0x2c, 0x4c, 0x9c, 0x9f, 0xec, 0x5f, 0x90, 0x5c,
+	0xb0, 0x49, 0x48, 0x6d, 0x16, 0x55, 0x73, 0x16, 0xb6, 0x1b, 0x85, 0xb2,
+	0xde, 0x0e, 0xa3, 0x64, 0x6d, 0xf4, 0xa6, 0x87, 0xa8, 0xcb, 0x6a, 0x96,
+	0xf9, 0x6d, 0x19, 0xdb, 0x49, 0xbd, 0x51, 0xaa, 0xed, 0xc2, 0xd2, 0xd9,
+	0x61, 0x75, 0xc3, 0x72, 0x73, 0xb9, 0x59, 0x53, 0x78, 0x57, 0xc0, 0xdd,
+	0x64, 0x6c, 0xb7, 0x26, 0xd2, 0x39, 0x74, 0x82, 0x92, 0xac, 0xf2, 0x34,
+	0x24, 0xc3, 0x82, 0x48, 0xa8, 0x38, 0x0e, 0x02, 0x23, 0x65, 0xb6, 0x59,
+	0x83, 0x80, 0x49, 0x74, 0x8b, 0x04, 0x6e, 0xb7, 0x23, 0x49, 0x13, 0x9a,
+	0x9b, 0x42, 0x8a, 0x88, 0xba, 0x09, 0x3d, 0x0d, 0xcd, 0xce, 0xca, 0xe5,
+	0x65, 0xb1, 0x9a, 0xa0, 0x82, 0xb0, 0xb4, 0x41, 0x42, 0x87, 0x04, 0xe4,
+	0x16, 0xeb, 0xad, 0xb6, 0xc4, 0x0e, 0xe2, 0xa3, 0x2c, 0x7a, 0x6c, 0xf8,
+	0x25, 0x45, 0xb6, 0x5a, 0x6c, 0x37, 0x39, 0x6d, 0x1e, 0xc3, 0x6d, 0xb6,
+	0xd8, 0x47, 0xe9, 0x05, 0xa0, 0x9e, 0xa8, 0x48, 0xbc, 0x85, 0xd0, 0x41,
+	0xd4, 0x83, 0x14, 0x65, 0xc3, 0x20, 0x2b, 0x26, 0x77, 0x7b, 0x79, 0x81,
+	0x8d, 0xa4, 0x55, 0x86, 0xce, 0x08, 0xc8, 0x58, 0xe6, 0x83, 0x6b, 0x65,
+	0xb4, 0xb0, 0x80, 0xdd, 0xed, 0xd2, 0xc9, 0x04, 0xa8, 0xb1, 0xce, 0xb9,
+	0x5f, 0xa6, 0xd5, 0x28, 0xd5, 0xca, 0xf9, 0xea, 0x08, 0xdb, 0x08, 0xed,
+	0x0b, 0xe3, 0xdd, 0x16, 0x99, 0x49, 0xa0, 0xd4, 0xe5, 0x52, 0x09, 0x44,
+	0xaa, 0x5b, 0x6d, 0x90, 0x4b, 0x6e, 0x4f, 0xae, 0x63, 0x28, 0x2f, 0xe8,
+	0x36, 0x59, 0x54, 0xa5, 0x46, 0x5c, 0x3d, 0x48, 0xa4, 0xcc, 0x33, 0xd8,
+	0xe2, 0x91, 0xad, 0x48, 0x78, 0x85, 0x8c, 0x50, 0x6b, 0x48, 0xb3, 0x12,
+	0xe5, 0x69, 0x07, 0x51, 0x7c, 0x41, 0xb4, 0xdb, 0xae, 0x77, 0x41, 0xae,
+	0x10, 0xe7, 0x21, 0xa1, 0x11, 0x68, 0x2b, 0x09, 0x81, 0x89, 0x04, 0x8a,
+	0x6e, 0x98, 0xc2, 0x12, 0xd9, 0x19, 0x47, 0xb4, 0x28, 0x25, 0x46, 0xce,
+	0x62, 0x22, 0x24, 0xc4, 0x31, 0x08, 0x15, 0xc4, 0x75, 0x34, 0x70, 0x83,
+	0x6e, 0x78, 0x45, 0x17, 0x71, 0x07, 0x71, 0x0c, 0x44, 0x1c, 0x94, 0xb0,
+	0x8b, 0x21, 0x59, 0x6e, 0x43, 0xae, 0x83, 0xc4, 0x20, 0x27, 0x02, 0x70,
+	0x36, 0xfb, 0x73, 0x1d, 0x90, 0x24, 0x90, 0x77, 0x90, 0x1e, 0x29, 0xdc,
+	0x0d, 0x8c, 0x96, 0x04, 0xb0, 0x44, 0x68, 0x8c, 0x81, 0xd2, 0xd2, 0x75,
+	0xe2, 0x2e, 0x42, 0x34, 0x24, 0x42, 0x28, 0xee, 0x75, 0x45, 0x78, 0x05,
+	0x85, 0x42, 0x9d, 0xcf, 0xf2, 0xdb, 0x07, 0x77, 0xb0, 0xde, 0x4e, 0x58,
+	0x9d, 0xfd, 0xec, 0x56, 0x9b, 0x75, 0x86, 0xe5, 0x79, 0x75, 0x76, 0x3e,
+	0x01, 0x05, 0x34, 0xbb, 0x58, 0x6e, 0x56, 0x9b, 0x0a, 0xf9, 0x0c, 0x29,
+	0xd6, 0x10, 0xe5, 0x8c, 0xdd, 0x46, 0x5d, 0x20, 0x21, 0x23, 0x49, 0x51,
+	0x85, 0x42, 0x92, 0x54, 0x56, 0xec, 0xdb, 0x58, 0x57, 0x58, 0x52, 0x90,
+	0x6c, 0x4c, 0x76, 0x28, 0xc4, 0xab, 0xd2, 0xe4, 0x5c, 0x36, 0xd2, 0xd3,
+	0x1b, 0x7b, 0x52, 0x11, 0x09, 0x95, 0x3c, 0xb5, 0x0e, 0x99, 0x69, 0xb1,
+	0x5c, 0x85, 0x8c, 0x50, 0xc4, 0x4d, 0x44, 0x47, 0xc9, 0xee, 0x76, 0xfb,
+	0xad, 0xc8, 0x3a, 0x04, 0x91, 0x84, 0x81, 0x44, 0x70, 0x4e, 0xf2, 0x27,
+	0x42, 0xe5, 0x03, 0x61, 0x32, 0x52, 0xb1, 0x5e, 0x40, 0x8c, 0x80, 0xc8,
+	0x00, 0x6d, 0x20, 0x48, 0x61, 0x72, 0x75, 0x68, 0x69, 0x6b, 0x6f, 0x20,
+	0x4f, 0x6b, 0x75, 0x6d, 0x75, 0x72, 0x61, 0x0a, 0x20, 0x20, 0x3c, 0x68,
+	0x74, 0x74, 0x70, 0x73, 0x3a, 0x2f, 0x2f, 0x6f, 0x6b, 0x75, 0x2e, 0x65,
+	0x64, 0x75, 0x2e, 0x6d, 0x69, 0x65, 0x2d, 0x75, 0x2e, 0x61, 0x63, 0x2e,
+	0x6a, 0x70, 0x2f, 0x7e, 0x21, 0x81, 0x20, 0x82, 0x97, 0x8d, 0x0c, 0xcb,
+	0xd2, 0xb0, 0xa5, 0xd6, 0x39, 0xf2, 0x8c, 0xb1, 0x4c, 0x08, 0x15, 0x91,
+	0x06, 0x0d, 0x86, 0xd8, 0xce, 0x84, 0x87, 0x29, 0x70, 0xba, 0xd8, 0xad,
+	0x96, 0x9b, 0x1a, 0xb4, 0x0d, 0xb6, 0xc3, 0x69, 0x79, 0x81, 0x95, 0x19,
+	0xf8, 0xa8, 0x89, 0x5d, 0x2c, 0x36, 0x3b, 0x5a, 0x6e, 0x95, 0x9a, 0xd8,
+	0x54, 0x03, 0x70, 0x63, 0x81, 0x3b, 0x11, 0xb5, 0xaa, 0x48, 0x96, 0x70,
+	0xa3, 0x10, 0xda, 0x6d, 0x96, 0x10, 0xb9, 0x1b, 0xad, 0xb9, 0x75, 0x45,
+	0xd6, 0x4c, 0xc9, 0x84, 0x68, 0x64, 0x83, 0x04, 0x78, 0x90, 0x71, 0x86,
+	0x58, 0x5f, 0x48, 0xeb, 0x43, 0x64, 0x68, 0x42, 0x3e, 0x11, 0x9d, 0x10,
+	0x74, 0x13, 0xe5, 0xcb, 0x93, 0x10, 0x65, 0xf7, 0x1b, 0xad, 0x96, 0xe6,
+	0x72, 0x45, 0x73, 0x97, 0xcc, 0xe6, 0xf3, 0x69, 0xbc, 0xda, 0x69, 0x30,
+	0x9f, 0x1a, 0x88, 0xd0, 0x47, 0x85, 0xc1, 0xb0, 0x97, 0xa5, 0xdc, 0x28,
+	0x49, 0xbc, 0x98, 0xec, 0x65, 0x14, 0x5b, 0x75, 0x9e, 0xd9, 0x69, 0xb9,
+	0xda, 0x25, 0x32, 0x0b, 0xa5, 0x96, 0xf0, 0x4a, 0xc4, 0x41, 0xef, 0x67,
+	0x43, 0x51, 0xba, 0xd8, 0x8b, 0xbc, 0xec, 0x36, 0xeb, 0xa5, 0xa6, 0xe5,
+	0x65, 0xbd, 0x4b, 0xd5, 0xd8, 0x6f, 0x53, 0xe8, 0x54, 0x29, 0xac, 0xc6,
+	0xda, 0x41, 0xd1, 0x65, 0xb7, 0x4b, 0xae, 0xf6, 0x9b, 0x5d, 0xa6, 0xc5,
+	0x6f, 0xb7, 0xda, 0xee, 0x72, 0xeb, 0x7d, 0xca, 0xcf, 0x2f, 0x36, 0xf2,
+	0x97, 0xd1, 0x16, 0xcc, 0x6b, 0xf4, 0x32, 0x36, 0x9a, 0x22, 0x53, 0x09,
+	0xfe, 0x08, 0xa7, 0x0d, 0x7c, 0x68, 0x66, 0x7c, 0xc3, 0x86, 0x5b, 0x3f,
+	0xe6, 0x3d, 0x41, 0x98, 0xcd, 0x66, 0xb3, 0x23, 0x5b, 0x18, 0x4d, 0x4c,
+	0xd6, 0x05, 0xb5, 0xd0, 0x66, 0xbe, 0x8f, 0x13, 0x5c, 0xee, 0xb6, 0x9b,
+	0xa0, 0xb3, 0x11, 0x89, 0x79, 0x37, 0x86, 0xf3, 0x0a, 0x84, 0xdc, 0xed,
+	0x16, 0xfb, 0x92, 0xba, 0x0d, 0xd1, 0xea, 0x0e, 0x58, 0x80, 0x82, 0xa3,
+	0xc2, 0xaa, 0x63, 0x55, 0xa9, 0x53, 0x06, 0x28, 0xac, 0x88, 0xc2, 0x26,
+	0x58, 0x36, 0x51, 0x16, 0x13, 0x2d, 0x34, 0x6f, 0x16, 0x68, 0x10, 0xe7,
+	0x14, 0x3e, 0x54, 0x25, 0x28, 0x54, 0x26, 0x91, 0x54, 0xa6, 0xd3, 0x14,
+	0xe0, 0xee, 0x72, 0xea, 0xdc, 0xca, 0xba, 0x7b, 0xa3, 0x4d, 0x43, 0x42,
+	0xb6, 0x5a, 0x6d, 0x76, 0x59, 0x05, 0x41, 0x1f, 0xc6, 0x4e, 0xb7, 0xa5,
+	0x67, 0xb7, 0x81, 0xe8, 0xda, 0x2d, 0xb2, 0xc9, 0x01, 0xf0, 0x1d, 0xa1,
+	0x54, 0xc5, 0x49, 0xc6, 0xc3, 0x72, 0xb2, 0x4b, 0x6e, 0xe6, 0xa4, 0x25,
+	0x58, 0x40, 0x8c, 0x26, 0x9e, 0x2e, 0x38, 0x36, 0x9b, 0x65, 0xd2, 0x5b,
+	0x69, 0xb7, 0x42, 0xa1, 0x2f, 0x02, 0x36, 0x53, 0x73, 0x25, 0x31, 0x29,
+	0x94, 0xd6, 0x68, 0xb8, 0xc5, 0x6d, 0x6d, 0x51, 0x44, 0xb6, 0xbb, 0xdb,
+	0xee, 0x56, 0x47, 0x5e, 0x24, 0xde, 0x10, 0x23, 0x1b, 0x0d, 0x9e, 0xda,
+	0xb0, 0xc2, 0xbc, 0x03, 0x62, 0xb4, 0xd9, 0xee, 0x56, 0x1b, 0x6a, 0xf0,
+	0x12, 0xbf, 0xac, 0x24, 0xa1, 0x86, 0xcb, 0x72, 0xb1, 0x8f, 0x78, 0x87,
+	0x98, 0xbc, 0x91, 0x5c, 0xe4, 0x12, 0x8b, 0x2d, 0xe2, 0xc7, 0x65, 0xb8,
+	0x5d, 0x24, 0x16, 0xa9, 0x64, 0x82, 0xd7, 0x2c, 0x90, 0x5c, 0x65, 0x20,
+	0xf4, 0x96, 0x9b, 0x75, 0xb9, 0x5e, 0xc6, 0xd9, 0x6f, 0xb7, 0xdc, 0x1e,
+	0xe1, 0x52, 0x51, 0x2c, 0x96, 0x54, 0xbe, 0x2b, 0x94, 0x2a, 0x12, 0xb1,
+	0xc2, 0x83, 0xc4, 0x33, 0x2b, 0x3a, 0x3d, 0xd1, 0x84, 0xca, 0xa4, 0x14,
+	0x6b, 0x2b, 0x24, 0x0b, 0x2c, 0x1d, 0xb8, 0xcd, 0x44, 0x05, 0xd2, 0xb0,
+	0x3e, 0xc8, 0xcb, 0x24, 0xb8, 0xf0, 0x8d, 0x87, 0x2e, 0x55, 0xe1, 0x90,
+	0x4c, 0x5b, 0xc4, 0x6e, 0x6a, 0xec, 0x33, 0xd9, 0xea, 0x64, 0x94, 0xfe,
+	0x41, 0x53, 0x44, 0x54, 0x01, 0x83, 0xb6, 0x5a, 0x5e, 0x4c, 0x6c, 0x36,
+	0xc9, 0xd4, 0x82, 0xcc, 0xac, 0x9f, 0x69, 0x92, 0xc5, 0x92, 0x25, 0xd4,
+	0x16, 0x1d, 0x20, 0x59, 0x35, 0xfa, 0x14, 0x2a, 0x1b, 0x0d, 0xa6, 0xcf,
+	0x68, 0x6c, 0xa1, 0xb4, 0x5c, 0xad, 0xf7, 0x5b, 0x3a, 0xb3, 0x88, 0x0f,
+	0x22, 0xa2, 0xa2, 0x7f, 0x89, 0x9a, 0x8a, 0xc8, 0x9c, 0xc9, 0x65, 0xea,
+	0x6b, 0x3f, 0x1b, 0xf1, 0x5b, 0x43, 0x42, 0x95, 0x5b, 0x9f, 0xe0, 0xf0,
+	0xe6, 0xba, 0x2a, 0x0b, 0x26, 0x04, 0x07, 0x6f, 0xb6, 0x14, 0x30, 0xb8,
+	0x49, 0x53, 0x25, 0x73, 0x17, 0x29, 0x55, 0xe4, 0xfd, 0xae, 0x8a, 0xaf,
+	0xe7, 0xa6, 0x72, 0xe9, 0x05, 0x06, 0xdc, 0x27, 0xa2, 0x37, 0x67, 0x76,
+	0xb0, 0xdb, 0x2e, 0xad, 0xcc, 0x36, 0x69, 0x05, 0x62, 0x74, 0xa6, 0x65,
+	0x6b, 0xba, 0xdc, 0x00, 0x7c, 0xeb, 0x12, 0x7b, 0xa5, 0xa2, 0x41, 0x22,
+	0x4d, 0xd2, 0x91, 0x12, 0xf2, 0xae, 0x8a, 0xa5, 0xf3, 0xca, 0x1c, 0xc0,
+	0xdb, 0x11, 0x6c, 0x63, 0x18, 0x36, 0x20, 0x22, 0x3b, 0x6c, 0x82, 0x62,
+	0x03, 0x85, 0x35, 0x50, 0xf6, 0x00, 0x51, 0x7d, 0x92, 0x6d, 0x26, 0xb8,
+	0x5e, 0x5c, 0xbd, 0x13, 0x90, 0xd7, 0xd7, 0xf7, 0x2a, 0x90, 0x54, 0xac,
+	0xb7, 0x0b, 0x2b, 0x72, 0x0d, 0xd4, 0xd4, 0x06, 0xd8, 0xf0, 0xe4, 0xf5,
+	0xe2, 0xf5, 0xc5, 0x6e, 0x0f, 0xf1, 0xb7, 0xbd, 0x78, 0xac, 0x14, 0xb3,
+	0x32, 0x5b, 0x2c, 0xb6, 0x60, 0x2e, 0x16, 0x47, 0x45, 0x7e, 0xfc, 0xc2,
+	0xa1, 0x34, 0x2b, 0x2d, 0x8e, 0xc2, 0x5a, 0x82, 0xaf, 0xaa, 0x98, 0x0a,
+	0x06, 0x02, 0x95, 0x6c, 0xc8, 0x46, 0xa7, 0xf6, 0x05, 0xe5, 0x75, 0xb7,
+	0x20, 0x49, 0x80, 0xe8, 0xc8, 0xad, 0x96, 0x5b, 0x0d, 0xca, 0xdd, 0x22,
+	0x85, 0x42, 0x6d, 0xd6, 0x5b, 0xba, 0x6e, 0x23, 0xfc, 0x98, 0xd0, 0xb0,
+	0x0f, 0x92, 0x49, 0x0b, 0xaa, 0x15, 0x85, 0x44, 0x8a, 0x41, 0x68, 0x28,
+	0x71, 0xb7, 0x85, 0x70, 0x93, 0x01, 0xde, 0x64, 0x16, 0x1b, 0x83, 0x9f,
+	0x8b, 0xe0, 0x8b, 0x66, 0x2a, 0x46, 0x8d, 0x9c, 0x53, 0x05, 0xd2, 0x05,
+	0x81, 0x4e, 0x15, 0x49, 0xba, 0x48, 0x2d, 0xab, 0xd0, 0x6d, 0xe4, 0x29,
+	0xba, 0x2d, 0x82, 0x23, 0x36, 0x69, 0xda, 0x42, 0xb8, 0x96, 0x6b, 0x4d,
+	0xe0, 0x7c, 0x46, 0xc8, 0x72, 0x8f, 0x20, 0xad, 0xd0, 0xe9, 0xf4, 0x4a,
+	0x2d, 0x0c, 0x74, 0x8e, 0xf3, 0x73, 0xba, 0x59, 0x6d, 0xa1, 0x24, 0x57,
+	0x0b, 0x0a, 0x13, 0x8d, 0xbe, 0xcd, 0x0a, 0x1d, 0xda, 0x97, 0x48, 0x0e,
+	0x1e, 0x65, 0x88, 0xfa, 0x97, 0x3b, 0x78, 0x7d, 0x8b, 0x51, 0x25, 0x9a,
+	0xd3, 0x65, 0xb6, 0x27, 0x01, 0x09, 0xb2, 0x5b, 0xed, 0xca, 0x92, 0x36,
+	0x6b, 0xab, 0xa4, 0x12, 0x16, 0xa5, 0xbe, 0xdd, 0x65, 0x85, 0x5d, 0xdd,
+	0x2c, 0xef, 0x36, 0xfb, 0xab, 0x76, 0x9d, 0x9e, 0xcb, 0x74, 0x54, 0x42,
+	0x45, 0x41, 0x90, 0x0d, 0x28, 0xdd, 0x6d, 0x97, 0x4b, 0x9c, 0x82, 0xee,
+	0x68, 0xa3, 0x20, 0xb8, 0xa0, 0x30, 0xba, 0x70, 0x87, 0x7a, 0x8c, 0xd2,
+	0x83, 0x03, 0xa7, 0xdc, 0x5b, 0x4a, 0x2c, 0xec, 0x97, 0x6b, 0x0a, 0x2c,
+	0x0d, 0x90, 0x17, 0xe4, 0xf9, 0x4e, 0xf2, 0x1b, 0x22, 0xbe, 0xa2, 0xde,
+	0x43, 0x69, 0xb7, 0x5d, 0x91, 0x50, 0xac, 0x81, 0xae, 0x2a, 0x60, 0x2c,
+	0x44, 0x37, 0x0b, 0xad, 0xc8, 0xa2, 0x85, 0x16, 0x8a, 0xe5, 0x74, 0xb4,
+	0xd9, 0xad, 0x36, 0x3b, 0x4d, 0x86, 0xd9, 0x0a, 0xb4, 0xa2, 0xa8, 0xdb,
+	0x2d, 0x96, 0x91, 0x48, 0x1b, 0x1d, 0x94, 0x92, 0x04, 0x67, 0xc4, 0x63,
+	0x05, 0x31, 0xc6, 0xc6, 0x3a, 0xe2, 0xa1, 0xa2, 0xf2, 0x85, 0x70, 0xb2,
+	0xdb, 0xc6, 0x74, 0x89, 0x7c, 0x6d, 0x96, 0x9b, 0x2d, 0xd4, 0x6c, 0xc6,
+	0x83, 0x6e, 0x25, 0xe1, 0x51, 0x31, 0x2f, 0x62, 0x04, 0xa2, 0x15, 0xa1,
+	0xb1, 0x9f, 0x70, 0xd8, 0x6c, 0x56, 0xfb, 0xa8, 0x8d, 0x95, 0x90, 0x12,
+	0x4e, 0xdc, 0xd4, 0x49, 0x69, 0x4a, 0xd1, 0xb9, 0x5d, 0x4e, 0x54, 0xd7,
+	0xd1, 0xab, 0x74, 0xca, 0xd5, 0x4e, 0xa6, 0x0c, 0xc3, 0x0a, 0x12, 0x6b,
+	0x20, 0xf7, 0xb9, 0x12, 0x60, 0xd9, 0xe6, 0x93, 0x29, 0x75, 0x8a, 0xd9,
+	0x6f, 0xb3, 0xdc, 0xee, 0x16, 0xfb, 0xa1, 0x77, 0x9c, 0xca, 0x61, 0x32,
+	0x99, 0x4b, 0xe6, 0x13, 0x12, 0x40, 0x1b, 0xc5, 0xbe, 0xe5, 0x2e, 0xb4,
+	0x5d, 0x2d, 0xb6, 0xc2, 0x47, 0x11, 0xd8, 0x26, 0xed, 0x28, 0x53, 0x79,
+	0x0d, 0xd2, 0xd0, 0xbe, 0x04, 0x0e, 0xe4, 0x93, 0x23, 0x76, 0x31, 0xf2,
+	0xba, 0x5d, 0xc9, 0x74, 0x87, 0x19, 0xc3, 0x0d, 0x0a, 0x4c, 0xd6, 0xc9,
+	0x64, 0x17, 0x2b, 0xad, 0xba, 0xe7, 0x20, 0x91, 0x53, 0x29, 0x35, 0x49,
+	0x05, 0x6e, 0x85, 0x59, 0xaa, 0x51, 0x6b, 0xb2, 0x23, 0xaa, 0x31, 0xbc,
+	0x62, 0x94, 0x22, 0x60, 0x34, 0xc7, 0x1b, 0x21, 0xc1, 0x8a, 0x14, 0x8b,
+	0xac, 0x0d, 0x91, 0xb2, 0x8a, 0xc2, 0x96, 0x63, 0x66, 0xb3, 0x29, 0x88,
+	0xc8, 0xa8, 0x74, 0xfa, 0x85, 0x64, 0x75, 0x86, 0x8b, 0x4e, 0xa3, 0xd5,
+	0x29, 0x12, 0xc9, 0x05, 0x12, 0x93, 0x53, 0xaa, 0x50, 0x69, 0xd4, 0x32,
+	0x6e, 0x19, 0x74, 0x2a, 0x8b, 0x78, 0x45, 0x61, 0x1b, 0x73, 0x22, 0x03,
+	0x0e, 0xb3, 0xb0, 0x85, 0xe9, 0x27, 0x30, 0x8e, 0x25, 0x58, 0x94, 0x30,
+	0x6c, 0x81, 0x8a, 0x32, 0x0a, 0x2d, 0xe2, 0xc7, 0x6c, 0xba, 0xdc, 0xed,
+	0x37, 0x6b, 0x2c, 0xb6, 0x9f, 0x72, 0x90, 0x4a, 0x28, 0x23, 0x6c, 0x23,
+	0x96, 0x76, 0xfb, 0x94, 0x2a, 0xe7, 0x75, 0xb1, 0x2f, 0x28, 0x8e, 0x52,
+	0x5d, 0xed, 0xf7, 0x5b, 0x61, 0x3a, 0x0d, 0xb2, 0xe7, 0x6f, 0x4d, 0xc2,
+	0x52, 0x31, 0x30, 0x8a, 0xb1, 0x59, 0x50, 0x68, 0xac, 0xb7, 0x3b, 0x85,
+	0x94, 0x57, 0xca, 0xd9, 0x79, 0x19, 0xab, 0x40, 0xe1, 0x85, 0x5b, 0x6c,
+	0x36, 0xb0, 0x49, 0x43, 0xf1, 0xa0, 0x61, 0x34, 0x0d, 0x3b, 0x0c, 0x82,
+	0xb7, 0x53, 0xaa, 0xd0, 0xa9, 0x94, 0x5a, 0x8b, 0xfc, 0x0d, 0x8c, 0x2f,
+	0xc6, 0xca, 0x0c, 0xc2, 0xa4, 0xee, 0x38, 0xd0, 0xd6, 0x85, 0x73, 0x85,
+	0x23, 0xf1, 0xc8, 0xab, 0x14, 0xfa, 0x91, 0x53, 0xfc, 0x96, 0x37, 0xc8,
+	0x9d, 0x28, 0xd3, 0x69, 0xf5, 0x2a, 0x2c, 0x80, 0x9a, 0xd1, 0xf8, 0x91,
+	0xbb, 0xd1, 0xe5, 0x04, 0xb5, 0xd2, 0xcb, 0x61, 0x2e, 0x91, 0xb3, 0x42,
+	0x89, 0x98, 0x90, 0x3c, 0x4a, 0x8c, 0x96, 0x5c, 0x6e, 0x92, 0x03, 0xa4,
+	0x16, 0x52, 0x41, 0xb1, 0x1b, 0x80, 0xd9, 0x09, 0x4d, 0xab, 0x72, 0x09,
+	0x58, 0xb3, 0x32, 0xa9, 0x2a, 0x11, 0x54, 0xa3, 0x32, 0xa8, 0x75, 0x90,
+	0x3d, 0x8b, 0x2b, 0x54, 0xc4, 0xfa, 0x89, 0xd5, 0xcd, 0x99, 0x8d, 0x4a,
+	0x09, 0x53, 0x86, 0xdb, 0x65, 0xb0, 0x93, 0x10, 0x83, 0xa1, 0x0b, 0x00,
+	0xbf, 0xc1, 0x58, 0xed, 0x0c, 0xd2, 0x2d, 0xdc, 0xb0, 0xa1, 0x6c, 0x15,
+	0xff, 0x39, 0x45, 0xde, 0xd0, 0x3e, 0xe3, 0x20, 0xb8, 0x5b, 0x2c, 0x36,
+	0x31, 0x56, 0x29, 0x05, 0xa2, 0xcb, 0x61, 0xbb, 0x5e, 0x52, 0xcc, 0x6e,
+	0x56, 0x40, 0x07, 0x11, 0xcd, 0x25, 0x2b, 0x14, 0x78, 0x4b, 0x94, 0xb1,
+	0x51, 0x11, 0x97, 0x89, 0x53, 0x85, 0x55, 0x92, 0x53, 0x2e, 0x85, 0x22,
+	0xa9, 0x9b, 0x3a, 0x2a, 0x70, 0xda, 0xed, 0xd6, 0xfb, 0xb9, 0x4b, 0x89,
+	0x31, 0x95, 0x6a, 0xb9, 0x5f, 0x3a, 0x41, 0x2b, 0xa1, 0x85, 0x48, 0xcf,
+	0xb4, 0xea, 0x54, 0x9a, 0x3d, 0x22, 0xa9, 0x0a, 0x4c, 0x11, 0x79, 0xa4,
+	0x7a, 0x42, 0x48, 0x73, 0xb2, 0x3a, 0x18, 0xbd, 0xf9, 0x29, 0xe1, 0x55,
+	0x6d, 0xd6, 0xcb, 0x48, 0x6f, 0x0d, 0xcc, 0x5b, 0xc9, 0x20, 0x8d, 0x53,
+	0x86, 0xca, 0x53, 0xa2, 0x0a, 0xe3, 0x76, 0xb2, 0x99, 0xf8, 0xab, 0x49,
+	0x5c, 0x2e, 0xb6, 0x25, 0x11, 0x18, 0x55, 0x92, 0xdf, 0x6d, 0xb0, 0xda,
+	0x42, 0x50, 0x6c, 0x86, 0x3a, 0x2d, 0xc6, 0x44, 0x58, 0x41, 0xd4, 0x36,
+	0xc0, 0x2a, 0x21, 0xd7, 0x49, 0xd4, 0x80, 0x7b, 0x9a, 0xcb, 0x6e, 0x97,
+	0x5d, 0xed, 0x36, 0xbb, 0x4d, 0xc2, 0xcb, 0x64, 0xb4, 0xd8, 0x65, 0xd6,
+	0xfb, 0x95, 0x9e, 0x5e, 0xad, 0x25, 0x2f, 0xa6, 0x59, 0x6d, 0xb7, 0x0b,
+	0x2d, 0xb2, 0x4b, 0x45, 0x99, 0x49, 0x67, 0x13, 0x09, 0x2c, 0xe6, 0x67,
+	0x5a, 0xb4, 0xdd, 0x96, 0x09, 0xea, 0x65, 0x20, 0x57, 0x25, 0x8e, 0x8b,
+	0xd5, 0xe6, 0xda, 0x8b, 0x83, 0x6b, 0xb4, 0xc2, 0xab, 0x75, 0x2a, 0x65,
+	0x15, 0x56, 0xff, 0xc3, 0x52, 0xba, 0xdb, 0xa5, 0xb6, 0xcb, 0x2d, 0xba,
+	0xcf, 0x74, 0xb4, 0x57, 0xd1, 0xe0, 0xd8, 0xa0, 0x61, 0x55, 0xba, 0x3d,
+	0x3a, 0xab, 0x20, 0xa6, 0xd8, 0x6d, 0x76, 0x55, 0x5b, 0x9b, 0xbd, 0xde,
+	0xef, 0x2e, 0xb3, 0xdb, 0xae, 0xaa, 0xe4, 0x77, 0x30, 0x04, 0x1b, 0xbb,
+	0xa8, 0x0c, 0xbc, 0xd4, 0x86, 0xcb, 0x2f, 0x1d, 0xf1, 0x55, 0xbf, 0xf0,
+	0xd0, 0xeb, 0xf2, 0x8b, 0x85, 0xca, 0xdf, 0x67, 0xb9, 0x58, 0x6d, 0xb6,
+	0xd6, 0x5e, 0x1a, 0xfd, 0xb2, 0xc3, 0x6e, 0xb3, 0xdd, 0x6c, 0x36, 0x7b,
+	0x2c, 0xa4, 0x77, 0xc6, 0x73, 0x39, 0x55, 0xbf, 0xf0, 0xb2, 0xa8, 0xc2,
+	0xab, 0x75, 0x0a, 0x0d, 0x52, 0x90, 0xab, 0x7f, 0xe1, 0x67, 0xe2, 0xaf,
+	0xca, 0x2e, 0xd6, 0x1b, 0x95, 0xa5, 0xf2, 0x09, 0x94, 0x86, 0xc7, 0x6d,
+	0xb8, 0x2a, 0xdf, 0xf8, 0x68, 0x76, 0xdb, 0x85, 0x7e, 0x51, 0x55, 0xb7,
+	0x5a, 0x6f, 0x0c, 0xa4, 0x20, 0xab, 0x26, 0xb7, 0x2a, 0xb7, 0xfe, 0x1a,
+	0x20, 0x2b, 0x3d, 0x7d, 0xef, 0x4c, 0x77, 0xd9, 0x57, 0x3f, 0xc1, 0x43,
+	0x79, 0xd1, 0xb1, 0xc2, 0xab, 0x74, 0x1a, 0x85, 0x25, 0x56, 0xff, 0xc3,
+	0x41, 0xb8, 0x5c, 0x14, 0x44, 0x6c, 0x20, 0xb0, 0x55, 0xf6, 0x3e, 0xa1,
+	0x9b, 0x3b, 0x32, 0x44, 0x8c, 0x2a, 0xb7, 0x66, 0x40, 0x31, 0xb1, 0xaa,
+	0xda, 0xaf, 0xd2, 0xd8, 0xee, 0x05, 0xe2, 0x2f, 0x6a, 0x44, 0x0c, 0x77,
+	0x2b, 0x29, 0x4f, 0x08, 0xb6, 0x14, 0xbe, 0xc7, 0x73, 0xba, 0x59, 0x2d,
+	0x36, 0xf9, 0x7b, 0xd0, 0x9b, 0x0b, 0x0d, 0x98, 0x36, 0x05, 0xe9, 0x7f,
+	0xde, 0xfb, 0x84, 0xc2, 0xc3, 0x4e, 0xa2, 0x51, 0x68, 0x55, 0x5a, 0x3a,
+	0xad, 0xe5, 0x8e, 0xe0, 0x11, 0xa2, 0xf8, 0x8a, 0x40, 0xc7, 0x77, 0x97,
+	0xd8, 0xe5, 0xf6, 0x5b, 0x95, 0xca, 0xdf, 0x72, 0x97, 0xd8, 0x6e, 0x77,
+	0x3b, 0x2d, 0xca, 0xe9, 0x0a, 0xad, 0xd1, 0x69, 0xf4, 0x67, 0xa6, 0xff,
+	0x68, 0x26, 0x0b, 0x0b, 0x0a, 0x9e, 0x14, 0xb9, 0xe9, 0x48, 0x20, 0x92,
+	0x15, 0x5b, 0xb9, 0xda, 0x2e, 0x56, 0x9b, 0x75, 0xac, 0x21, 0x8c, 0x24,
+	0xd8, 0x24, 0x5e, 0xd0, 0x13, 0x71, 0x68, 0x67, 0xc1, 0xa7, 0xd4, 0xe9,
+	0x35, 0x85, 0x5b, 0xff, 0x08, 0x5e, 0x98, 0x53, 0x45, 0xc1, 0xad, 0x88,
+	0x3a, 0xa2, 0x15, 0x5b, 0xb6, 0x5e, 0xae, 0x6f, 0x78, 0x21, 0xe4, 0x62,
+	0x06, 0xd0, 0xaa, 0xdd, 0xc2, 0xdf, 0x6f, 0xb6, 0x04, 0x31, 0x88, 0xc2,
+	0x04, 0x00, 0xd9, 0x6d, 0xb7, 0x3b, 0x2d, 0xd1, 0x56, 0xc5, 0xea, 0x3f,
+	0xce, 0x12, 0xa3, 0x67, 0x97, 0x89, 0x4a, 0x03, 0xf9, 0x59, 0x6d, 0xb6,
+	0xdb, 0x7d, 0xd9, 0x7c, 0x59, 0xeb, 0x7f, 0xc4, 0x2b, 0x2c, 0x2d, 0x44,
+	0x2c, 0x88, 0xd6, 0x90, 0xf5, 0xbf, 0xe2, 0x15, 0x96, 0x6b, 0x41, 0x1a,
+	0x35, 0xb4, 0x5c, 0x9e, 0x9b, 0xfd, 0x23, 0xaa, 0xf6, 0x8b, 0x93, 0x0b,
+	0x09, 0xaf, 0x0d, 0x86, 0xc8, 0xab, 0x72, 0xa6, 0x63, 0x73, 0x97, 0x5b,
+	0xee, 0x0b, 0xb4, 0x37, 0x2b, 0x7d, 0xd6, 0xe0, 0xae, 0x47, 0x6f, 0x51,
+	0x01, 0xb7, 0x59, 0x48, 0xc0, 0xa5, 0xf3, 0x99, 0xb4, 0xe6, 0x73, 0x39,
+	0x98, 0xce, 0x66, 0xf3, 0x99, 0xcc, 0xbe, 0xcd, 0x75, 0xb7, 0x16, 0xf9,
+	0xdc, 0xe5, 0xe4, 0x40, 0x72, 0xeb, 0x45, 0xd2, 0xdb, 0x6c, 0x09, 0x11,
+	0xba, 0x5c, 0x97, 0x64, 0x5e, 0x9b, 0xfd, 0x22, 0xb2, 0x64, 0xde, 0x8c,
+	0x2c, 0x20, 0x88, 0x8f, 0x4d, 0xfe, 0x70, 0x44, 0x40, 0x43, 0x56, 0x16,
+	0x1b, 0x95, 0x96, 0xcb, 0x6e, 0x30, 0xb1, 0xb7, 0x15, 0x8b, 0x2b, 0x17,
+	0xf2, 0xa9, 0x17, 0x52, 0xd8, 0xef, 0x35, 0xf9, 0x41, 0xad, 0x95, 0xd4,
+	0xd2, 0x49, 0x94, 0x86, 0xe9, 0x68, 0x22, 0x12, 0x90, 0x5c, 0xec, 0x36,
+	0x65, 0xf1, 0xa5, 0x66, 0xfd, 0x55, 0x0c, 0xb0, 0xeb, 0xe6, 0x64, 0x57,
+	0x4b, 0xcc, 0x2a, 0xb7, 0x46, 0xa4, 0xad, 0x97, 0x01, 0x4f, 0xe6, 0xd3,
+	0x6f, 0x11, 0x61, 0x46, 0x11, 0x90, 0x4c, 0x9e, 0x9b, 0x2c, 0xd6, 0x1b,
+	0x89, 0x19, 0x8a, 0xba, 0x09, 0xd2, 0x94, 0xbd, 0xbb, 0xe6, 0x5a, 0x74,
+	0xa3, 0x2f, 0x46, 0x02, 0x99, 0x30, 0xb0, 0xd9, 0x6d, 0xb6, 0x2b, 0x2d,
+	0x91, 0x1f, 0x05, 0x56, 0xff, 0xc3, 0x45, 0x3c, 0xc5, 0xaf, 0xdc, 0xef,
+	0x37, 0x3b, 0xa5, 0x96, 0xda, 0x10, 0x03, 0x75, 0xb9, 0xdb, 0x17, 0xcb,
+	0x50, 0x14, 0xa5, 0xb6, 0xcb, 0x4d, 0x8a, 0xc6, 0xae, 0x47, 0x64, 0x4d,
+	0x21, 0xb6, 0x5b, 0xc9, 0x99, 0xec, 0x76, 0xf2, 0x3a, 0x13, 0x24, 0x1b,
+	0x2d, 0xcd, 0x56, 0xff, 0xc3, 0x43, 0x43, 0x66, 0x85, 0x56, 0xea, 0x75,
+	0x5a, 0x15, 0x32, 0x8b, 0x51, 0x08, 0xa1, 0xb1, 0xda, 0x09, 0x18, 0x55,
+	0x6e, 0x6c, 0xf6, 0x9b, 0xa5, 0xa2, 0xeb, 0x62, 0x7b, 0xd3, 0xb4, 0x5b,
+	0xee, 0xf6, 0x5b, 0x95, 0xaa, 0x5f, 0x73, 0x53, 0x41, 0xb2, 0xdc, 0x61,
+	0x55, 0xba, 0x68, 0xb5, 0x8c, 0xb6, 0xa9, 0x6f, 0x96, 0xd1, 0xae, 0x56,
+	0xf2, 0xf0, 0xff, 0x1a, 0x4f, 0x1d, 0xd2, 0xdf, 0x2d, 0xb3, 0x25, 0x39,
+	0x57, 0xcb, 0xb4, 0xae, 0x76, 0x6b, 0x7d, 0xc9, 0x00, 0x86, 0x8b, 0x6c,
+	0xb4, 0xd8, 0x6e, 0x72, 0xda, 0x3b, 0x21, 0x8d, 0x85, 0x56, 0xff, 0xc2,
+	0x9c, 0xa7, 0x5f, 0xb3, 0xa7, 0x61, 0x39, 0x29, 0x2f, 0x29, 0xd3, 0x2b,
+	0x55, 0x75, 0x5b, 0xff, 0x99, 0x57, 0xb2, 0xdb, 0x2c, 0x61, 0x74, 0x34,
+	0xca, 0xd5, 0x41, 0x6d, 0x3e, 0x58, 0xad, 0xf6, 0xfb, 0x59, 0xd4, 0x23,
+	0x8b, 0x25, 0x86, 0xe9, 0x61, 0xaf, 0xd0, 0xdb, 0xc2, 0x1c, 0x6b, 0x1b,
+	0xc5, 0xe4, 0x6a, 0xd6, 0x30, 0xa8, 0x54, 0xf2, 0xe7, 0x74, 0xbc, 0xdb,
+	0x2c, 0xb2, 0x0b, 0xa5, 0xe6, 0xe1, 0x65, 0x9e, 0xc8, 0xae, 0x96, 0x5b,
+	0xc5, 0xd1, 0xf2, 0xc4, 0x09, 0x00, 0x73, 0x22, 0x3e, 0x62, 0x6f, 0x64,
+	0x79, 0x7b, 0x6d, 0x61, 0x72, 0x67, 0x69, 0x6e, 0x3a, 0x34, 0x30, 0x70,
+	0x78, 0x20, 0x61, 0x75, 0x74, 0x6f, 0x3b, 0x6d, 0x61, 0x78, 0x2d, 0x77,
+	0x69, 0x64, 0x74, 0x68, 0x3a, 0x38, 0x35, 0x5e, 0x01, 0x9d, 0x92, 0x29,
+	0x4b, 0x6d, 0x16, 0x5b, 0x4d, 0x9e, 0xd1, 0x74, 0x9d, 0x4c, 0x65, 0xd3,
+	0x69, 0xdd, 0x99, 0x2a, 0x06, 0x5b, 0x73, 0xb4, 0xde, 0xac, 0xb3, 0xa9,
+	0x8c, 0xd9, 0x7d, 0x86, 0xc7, 0x6f, 0xb6, 0x5b, 0xee, 0x53, 0xa9, 0x1c,
+	0xd2, 0x69, 0x34, 0x9d, 0xdc, 0x2c, 0x36, 0x45, 0x1f, 0x29, 0xd4, 0xc2,
+	0x41, 0x31, 0x5e, 0x01, 0xbe, 0xda, 0x26, 0x32, 0xcb, 0x44, 0xca, 0x59,
+	0x68, 0x99, 0xde, 0xd7, 0xe7, 0x26, 0x57, 0xdb, 0xa3, 0x56, 0x94, 0x82,
+	0xf6, 0xbd, 0xa8, 0xc5, 0x83, 0x30, 0x92, 0xce, 0xe4, 0x16, 0x2b, 0x7d,
+	0xc9, 0xca, 0x06, 0x5a, 0xc3, 0x03, 0x6c, 0xb0, 0xdc, 0x2e, 0x76, 0x59,
+	0xd3, 0x77, 0x0b, 0x34, 0x24, 0xed, 0x92, 0x92, 0x59, 0x20, 0xba, 0x5a,
+	0x19, 0xfc, 0x6c, 0x97, 0xb6, 0x5f, 0x46, 0x57, 0x15, 0xe1, 0x1b, 0x9d,
+	0xbe, 0xd9, 0x69, 0xb2, 0x48, 0x2c, 0x56, 0xcb, 0x0d, 0x8e, 0xd7, 0x3b,
+	0xbe, 0xb9, 0x31, 0x48, 0x2f, 0x6c, 0xde, 0x4c, 0x36, 0x32, 0x09, 0x1c,
+	0xc0, 0x94, 0x86, 0x73, 0x32, 0x9d, 0xc8, 0x2f, 0xb2, 0x09, 0xe1, 0x51,
+	0x0a, 0xdf, 0x8c, 0xfa, 0x14,
+};
+
+static unsigned char asset_cache[40660];
+
+shrink_asset_t asset = {
+	.codec = CODEC_LZSSX,
+	.data = asset_data,
+	.length = 20441,
+	.cache = asset_cache,
+	.size = 40660,
+};
@@ -0,0 +1,2986 @@
+/* generated by 'shrink -E', do not edit */
+#include "shrink.h"
+
+static const unsigned char asset_data[] = {
+	0xba, 0xb3, 0x86, 0x37, 0xcb, 0x86, 0x37, 0xd3, 0x83, 0x7d, 0xef, 0x7c,
+	0x70, 0xc1, 0xcb, 0x87, 0x54, 0xcf, 0x3e, 0x17, 0x85, 0xe1, 0x87, 0x5d,
+	0xf8, 0x1e, 0x01, 0xdd, 0xb7, 0x77, 0x27, 0x07, 0x06, 0x78, 0x45, 0xdf,
+	0x67, 0x39, 0xd8, 0xc6, 0x9c, 0x75, 0xd3, 0x4d, 0x74, 0xd6, 0x5b, 0x36,
+	0xd7, 0x1d, 0xb5, 0xcd, 0xc7, 0x5d, 0x5c, 0xf3, 0xa4, 0x74, 0x98, 0x59,
+	0x95, 0xe1, 0xa9, 0xc2, 0x63, 0x85, 0x99, 0xe1, 0x19, 0x71, 0x6e, 0x70,
+	0x55, 0xa6, 0x58, 0x95, 0x87, 0x27, 0x47, 0x4a, 0x6e, 0x75, 0x73, 0x9c,
+	0xa7, 0x47, 0x17, 0x49, 0xd4, 0x73, 0x6d, 0xcd, 0xcb, 0x66, 0x78, 0x47,
+	0x19, 0x13, 0x87, 0x39, 0xd0, 0x9d, 0xdc, 0x65, 0xdf, 0x49, 0xcf, 0x79,
+	0xde, 0x99, 0xa4, 0x71, 0x31, 0x25, 0x9c, 0x5d, 0xa2, 0x59, 0xc5, 0xde,
+	0x76, 0x6d, 0xc8, 0x72, 0x72, 0x61, 0xc9, 0xc9, 0xc9, 0xc9, 0xcb, 0x7d,
+	0x9c, 0xf8, 0x69, 0xc3, 0x87, 0x19, 0xca, 0x74, 0xe1, 0xd3, 0x87, 0x49,
+	0xd6, 0xc7, 0x6e, 0x18, 0x76, 0x75, 0xb5, 0x5d, 0xe1, 0xbd, 0x69, 0xc5,
+	0x88, 0x77, 0x73, 0x71, 0x71, 0x74, 0xe1, 0xce, 0xe5, 0xcd, 0xcd, 0xcd,
+	0xcd, 0xcd, 0xce, 0x70, 0x27, 0x09, 0xc2, 0x70, 0x9b, 0x71, 0x89, 0xc2,
+	0x49, 0x26, 0x1d, 0x9c, 0x27, 0x07, 0x79, 0xc2, 0x70, 0x9c, 0x26, 0xe5,
+	0x74, 0x73, 0xe1, 0xc5, 0x5d, 0x5e, 0x07, 0x82, 0x6a, 0x69, 0x88, 0x77,
+	0x73, 0x71, 0x71, 0x74, 0x9c, 0x27, 0x07, 0x37, 0x37, 0x37, 0x37, 0x37,
+	0x39, 0xc0, 0x9c, 0x27, 0x09, 0xc2, 0x6d, 0xc6, 0x27, 0x09, 0x24, 0x98,
+	0x76, 0x70, 0x76, 0x9b, 0x9b, 0x9b, 0x9a, 0x91, 0xcd, 0xe0, 0x99, 0x72,
+	0x78, 0x1e, 0x0b, 0xd6, 0x60, 0xa7, 0x1d, 0xf3, 0x9d, 0xa7, 0x6b, 0xc2,
+	0xf4, 0xbd, 0x2c, 0xdf, 0x81, 0x6e, 0x2e, 0x5d, 0x49, 0xdd, 0xb9, 0x26,
+	0xb8, 0x72, 0x9c, 0xee, 0xa6, 0xf7, 0xa9, 0x80, 0x09, 0x2c, 0x72, 0x9c,
+	0x67, 0x1b, 0x1c, 0x1c, 0x1c, 0x27, 0x7b, 0xca, 0x86, 0x67, 0x18, 0x6a,
+	0xf5, 0x75, 0x89, 0xdc, 0x77, 0x6d, 0xdd, 0xca, 0xf5, 0x66, 0xf5, 0x71,
+	0x76, 0x4b, 0xd6, 0x71, 0x9c, 0x70, 0x69, 0xc1, 0xce, 0x6d, 0x86, 0x18,
+	0x77, 0x72, 0x99, 0x76, 0x27, 0x76, 0xe7, 0x19, 0xc5, 0xc9, 0xc2, 0xf4,
+	0x70, 0xdf, 0x81, 0x99, 0xb7, 0x49, 0xa6, 0xb1, 0x26, 0xf8, 0x74, 0x6a,
+	0x66, 0x66, 0x70, 0x88, 0x6a, 0x61, 0xd1, 0x66, 0x1d, 0x40, 0x2d, 0x98,
+	0x65, 0x8e, 0x15, 0xc2, 0x75, 0x73, 0x73, 0x6d, 0x97, 0x35, 0x76, 0x76,
+	0xb9, 0x96, 0x61, 0xc9, 0xcd, 0xe0, 0x76, 0x00, 0x07, 0x79, 0x65, 0x75,
+	0xbd, 0xe7, 0x04, 0xb1, 0x37, 0xc3, 0x7c, 0x77, 0xde, 0xf4, 0x88, 0x88,
+	0x71, 0x9b, 0x77, 0x6e, 0x66, 0x67, 0x86, 0x62, 0xd9, 0xc1, 0xd2, 0x99,
+	0x9c, 0x27, 0x00, 0x0d, 0xf5, 0x9c, 0x5a, 0x2e, 0x5c, 0x5b, 0xde, 0x49,
+	0x97, 0x36, 0xdc, 0x31, 0xa7, 0x59, 0x89, 0x89, 0x89, 0x87, 0x37, 0x06,
+	0x27, 0x49, 0x27, 0x49, 0xd1, 0xb8, 0x70, 0x65, 0xde, 0x76, 0xbc, 0xb7,
+	0xde, 0x72, 0x0b, 0x1c, 0x1b, 0x71, 0x9c, 0x67, 0x07, 0x37, 0x81, 0xd9,
+	0xde, 0x49, 0xa7, 0x07, 0x07, 0x07, 0x0c, 0x70, 0x73, 0xbb, 0x72, 0x74,
+	0x71, 0xc6, 0xee, 0xb8, 0x6e, 0xf6, 0x31, 0x96, 0x53, 0x7b, 0x6d, 0x86,
+	0xdb, 0xc1, 0xb6, 0x51, 0xb6, 0xee, 0xa7, 0x27, 0x56, 0x1b, 0xbd, 0x9c,
+	0xef, 0x37, 0x26, 0x51, 0xa9, 0xa9, 0x67, 0x79, 0xa9, 0xa9, 0x89, 0x82,
+	0x65, 0xb7, 0x81, 0xc9, 0xb6, 0x2c, 0x9c, 0x1b, 0x6d, 0xc5, 0xc6, 0x61,
+	0xc9, 0x96, 0x5a, 0x6e, 0x72, 0x61, 0xcd, 0xb7, 0x3c, 0x72, 0x59, 0xd6,
+	0x9c, 0x1c, 0xa1, 0x5a, 0x9b, 0x71, 0x59, 0xc1, 0xdb, 0x06, 0x18, 0xbc,
+	0x86, 0x9c, 0x58, 0x78, 0x1c, 0xd9, 0x71, 0x70, 0x61, 0x59, 0x78, 0x1e,
+	0x06, 0x1c, 0x1c, 0x87, 0x37, 0x16, 0x26, 0x11, 0xb7, 0x16, 0x61, 0x87,
+	0x49, 0x96, 0x55, 0xcd, 0x5b, 0x78, 0x1d, 0x58, 0x98, 0x65, 0xcd, 0xe0,
+	0xb2, 0xe1, 0xb9, 0x92, 0xc7, 0x37, 0x36, 0x61, 0xe0, 0x77, 0xb1, 0xa7,
+	0x47, 0x67, 0x07, 0x07, 0x07, 0x0b, 0x26, 0xa6, 0xdc, 0xa4, 0x71, 0x72,
+	0x75, 0x65, 0x87, 0x27, 0x29, 0xc9, 0xb7, 0x29, 0x87, 0x07, 0x27, 0x19,
+	0x85, 0x55, 0x49, 0xc1, 0xbb, 0x97, 0x46, 0x92, 0x71, 0x99, 0x61, 0xcd,
+	0xe0, 0x72, 0x61, 0xcd, 0x55, 0x1d, 0x9d, 0x9d, 0x1d, 0x51, 0x5c, 0xda,
+	0x91, 0xd5, 0xe0, 0xba, 0x57, 0x39, 0xc6, 0x70, 0x70, 0x9c, 0x26, 0x66,
+	0x58, 0x77, 0x77, 0x99, 0x73, 0x73, 0x47, 0x76, 0xda, 0x91, 0x52, 0x46,
+	0x24, 0x70, 0x71, 0x72, 0x73, 0x71, 0x9c, 0xa4, 0x75, 0x61, 0xca, 0x66,
+	0x70, 0x71, 0x75, 0x76, 0x69, 0xc5, 0xb7, 0x06, 0x15, 0x5d, 0x56, 0x6e,
+	0x76, 0x76, 0x99, 0x78, 0x16, 0x70, 0x11, 0x27, 0x66, 0x91, 0xca, 0x71,
+	0x91, 0xda, 0x73, 0x71, 0x96, 0x65, 0xc1, 0xa6, 0xd5, 0xc1, 0x58, 0x73,
+	0x95, 0xc1, 0xc2, 0x71, 0x71, 0xc6, 0x18, 0x9c, 0x5d, 0x1c, 0xda, 0xc5,
+	0x6f, 0x1a, 0xb1, 0x89, 0xc5, 0xa7, 0x19, 0xc2, 0x77, 0x73, 0x66, 0x69,
+	0x49, 0xc5, 0x86, 0xa4, 0x19, 0x4b, 0x19, 0x72, 0x98, 0x9c, 0x5b, 0x9c,
+	0x93, 0x1c, 0x27, 0x05, 0x98, 0x9d, 0x1b, 0x61, 0xda, 0x69, 0xde, 0x75,
+	0x77, 0x77, 0x77, 0x9c, 0xa7, 0x29, 0x96, 0x5c, 0x1a, 0x59, 0xd7, 0x19,
+	0x98, 0x9b, 0x77, 0xc7, 0x2b, 0x19, 0x5e, 0x16, 0x65, 0x89, 0x65, 0xa7,
+	0x44, 0x75, 0xcc, 0x9a, 0x75, 0x87, 0x17, 0x16, 0xd8, 0x85, 0x56, 0x55,
+	0x66, 0xe7, 0x36, 0x1b, 0x75, 0x54, 0x59, 0x87, 0x27, 0x76, 0xa7, 0x59,
+	0xe0, 0x9e, 0x09, 0xe0, 0x61, 0xdf, 0x26, 0xdd, 0xde, 0x07, 0x79, 0xe0,
+	0x99, 0x72, 0x9d, 0xa5, 0x70, 0x73, 0x9c, 0x38, 0x61, 0x89, 0xa1, 0x27,
+	0x07, 0x24, 0x76, 0x98, 0x77, 0x9d, 0x67, 0x08, 0x76, 0x66, 0xee, 0xe2,
+	0x53, 0x1d, 0x5c, 0xe7, 0x0b, 0xd6, 0x77, 0xc7, 0x56, 0x31, 0xd7, 0x07,
+	0x12, 0xc7, 0x69, 0xca, 0x57, 0x48, 0x5c, 0x59, 0x89, 0x89, 0xc2, 0xf0,
+	0xa6, 0xe7, 0x51, 0xd1, 0xb9, 0xc1, 0xd2, 0xee, 0xe1, 0xa7, 0x74, 0x5b,
+	0xd6, 0xf1, 0x6e, 0x1d, 0x2f, 0x59, 0xe0, 0x73, 0x73, 0x72, 0x70, 0x73,
+	0x76, 0x59, 0x1d, 0xe4, 0x92, 0x47, 0x67, 0x01, 0xc2, 0xf7, 0x72, 0x73,
+	0xbc, 0x19, 0xbe, 0x0c, 0x49, 0xc8, 0x99, 0x65, 0xe0, 0x96, 0x6d, 0x89,
+	0x87, 0x67, 0x76, 0x31, 0x1d, 0x2f, 0x0b, 0x59, 0x9e, 0x09, 0xc6, 0x76,
+	0xde, 0x27, 0x27, 0x59, 0x97, 0x16, 0xe6, 0xa7, 0x37, 0x77, 0x17, 0x46,
+	0x5e, 0x05, 0x87, 0x47, 0x36, 0x2e, 0x5b, 0xbd, 0x9c, 0x9c, 0x1a, 0x70,
+	0x76, 0x71, 0x9d, 0x15, 0x59, 0x71, 0x73, 0x59, 0xce, 0x74, 0x65, 0xa1,
+	0xcd, 0xcd, 0xb6, 0x1c, 0xd5, 0xc5, 0x89, 0xb6, 0xa7, 0x65, 0x72, 0x56,
+	0xdc, 0x1d, 0x1c, 0x27, 0x26, 0x5d, 0x25, 0x59, 0x18, 0x74, 0x98, 0x69,
+	0x89, 0x87, 0x81, 0xb7, 0x07, 0x77, 0x17, 0x69, 0x96, 0x9d, 0xdd, 0xdd,
+	0xdd, 0x9d, 0x9d, 0x9d, 0x9d, 0x9c, 0x5d, 0x9d, 0x9e, 0x06, 0x58, 0x77,
+	0x75, 0x74, 0x62, 0x65, 0xce, 0x65, 0xc1, 0xc1, 0xa6, 0x56, 0x65, 0xe0,
+	0x71, 0x69, 0xa9, 0x85, 0x61, 0xd7, 0x15, 0xc9, 0xc9, 0xa8, 0x77, 0x77,
+	0x9d, 0xd9, 0x73, 0x73, 0x73, 0x71, 0x99, 0x57, 0x15, 0x6d, 0xd5, 0xa5,
+	0x69, 0x59, 0x61, 0xc9, 0xd9, 0xc5, 0xdd, 0x55, 0x94, 0x65, 0x5c, 0xd8,
+	0x71, 0x71, 0x71, 0x57, 0x35, 0x99, 0x71, 0x72, 0x70, 0x99, 0x64, 0xdf,
+	0x07, 0x4b, 0xd0, 0x47, 0x56, 0xdc, 0x5d, 0x99, 0x47, 0x46, 0x27, 0x69,
+	0x5c, 0x08, 0x89, 0xa7, 0x29, 0x1c, 0x98, 0x89, 0x5c, 0x9c, 0x1d, 0x9c,
+	0xe2, 0x1d, 0x21, 0xa5, 0x74, 0x73, 0x71, 0x63, 0x15, 0x87, 0x79, 0xc5,
+	0xc1, 0xa6, 0x1b, 0x57, 0x47, 0x56, 0xe6, 0x99, 0x70, 0x65, 0xa5, 0x49,
+	0xc9, 0x9c, 0x78, 0x1a, 0x75, 0x99, 0x65, 0xd1, 0xc1, 0x66, 0xa6, 0x58,
+	0x25, 0x95, 0xa9, 0x6d, 0x57, 0x07, 0x37, 0x29, 0x1e, 0x06, 0x9b, 0x76,
+	0x91, 0xc5, 0x97, 0x67, 0x09, 0xc5, 0x86, 0xf1, 0x87, 0x37, 0x37, 0x77,
+	0x76, 0xdd, 0xe7, 0x45, 0x47, 0x17, 0x82, 0x6e, 0x59, 0x59, 0x72, 0x72,
+	0x71, 0x72, 0x9c, 0x95, 0x1c, 0x27, 0x19, 0x5d, 0x1c, 0x9c, 0xc7, 0x37,
+	0x37, 0x27, 0x38, 0x54, 0x6d, 0xd1, 0xd1, 0xd1, 0xd1, 0xd1, 0xa7, 0x41,
+	0xd1, 0xd1, 0xcd, 0xd2, 0x61, 0x67, 0x16, 0xdc, 0x18, 0xab, 0x8b, 0x81,
+	0xcd, 0xcd, 0xa7, 0x37, 0x45, 0x73, 0x73, 0x73, 0x62, 0xe1, 0x99, 0xc1,
+	0x87, 0x56, 0x98, 0x9d, 0xa6, 0xe7, 0x36, 0xee, 0x1a, 0x9a, 0x9a, 0x9b,
+	0x9c, 0x99, 0x72, 0x96, 0x57, 0x29, 0x5d, 0x95, 0xe0, 0x91, 0x86, 0x1d,
+	0xa6, 0x9d, 0x27, 0x46, 0xdc, 0x6f, 0x76, 0x27, 0x21, 0x1c, 0x5c, 0x5d,
+	0xe4, 0x92, 0x47, 0x46, 0x64, 0x92, 0x47, 0x27, 0x69, 0xd9, 0x65, 0x89,
+	0x58, 0x9a, 0x9c, 0xaf, 0x47, 0x37, 0x36, 0x9c, 0xe6, 0x15, 0xcd, 0xcd,
+	0xcd, 0x8c, 0x62, 0x49, 0xdd, 0x97, 0x1b, 0xd5, 0x95, 0xbc, 0xe7, 0x66,
+	0x26, 0x27, 0x57, 0x39, 0xc5, 0x89, 0xc5, 0xa9, 0xc6, 0x71, 0x66, 0x71,
+	0xb5, 0xc6, 0xf0, 0x69, 0xce, 0x77, 0x65, 0xdd, 0xd9, 0x5d, 0x15, 0x58,
+	0x85, 0xb5, 0x6e, 0x5b, 0x6d, 0x86, 0x9c, 0x5c, 0x58, 0x9c, 0x19, 0x73,
+	0x77, 0x57, 0x15, 0x69, 0x8b, 0x89, 0xe0, 0x9c, 0x49, 0xd2, 0x74, 0x6a,
+	0x2e, 0x56, 0x75, 0x6d, 0xc9, 0x84, 0x65, 0xe0, 0x57, 0x49, 0xb5, 0x46,
+	0xa7, 0x82, 0x78, 0x2e, 0x49, 0xc5, 0x9b, 0x89, 0x5c, 0xa7, 0x36, 0x66,
+	0xa6, 0x1d, 0xa7, 0x49, 0xc1, 0xe0, 0x91, 0xc1, 0xb9, 0xc5, 0x96, 0x11,
+	0xcd, 0xc1, 0xd2, 0x46, 0x51, 0xa7, 0x07, 0x15, 0x69, 0xc1, 0xb6, 0x1c,
+	0x56, 0x72, 0x45, 0x46, 0x5c, 0x96, 0x70, 0x9c, 0x1c, 0x27, 0x09, 0xc1,
+	0x51, 0xd1, 0xb6, 0x26, 0xe6, 0xf1, 0xc5, 0xc9, 0xc9, 0xa7, 0x29, 0xdd,
+	0x5c, 0x1c, 0x1c, 0x18, 0xbc, 0x1c, 0x89, 0xd1, 0xd1, 0x99, 0xd6, 0x6d,
+	0x86, 0x26, 0x99, 0x86, 0x96, 0x66, 0x59, 0xa9, 0x9b, 0xcd, 0xc9, 0xa6,
+	0x9c, 0x5d, 0x59, 0x9b, 0x9b, 0x9c, 0xc6, 0x1d, 0x1c, 0x1d, 0xdd, 0x9c,
+	0x5d, 0x9d, 0xdc, 0x1d, 0x5d, 0x15, 0xc1, 0xc1, 0xb7, 0x75, 0x73, 0x73,
+	0x9c, 0xdc, 0x1b, 0x54, 0x65, 0x99, 0xc6, 0x71, 0x6e, 0x71, 0xb1, 0x64,
+	0x75, 0x86, 0x1d, 0x67, 0x36, 0x18, 0x61, 0xd2, 0x74, 0x65, 0x96, 0xd5,
+	0xe0, 0x69, 0x58, 0x67, 0x16, 0xf7, 0xc6, 0x2e, 0x58, 0xa6, 0xb7, 0xdf,
+	0x7d, 0xa4, 0xba, 0x75, 0x78, 0x1b, 0x45, 0x78, 0x1d, 0xdd, 0xd9, 0x9b,
+	0x66, 0x77, 0x70, 0x62, 0x70, 0x9d, 0x18, 0x49, 0xd2, 0x6d, 0xd6, 0x75,
+	0x75, 0x6d, 0xd5, 0xc9, 0xd1, 0xd1, 0xb6, 0xda, 0x9c, 0xe7, 0x37, 0x18,
+	0xbe, 0x05, 0x89, 0x1d, 0x1c, 0x99, 0x72, 0x59, 0xc9, 0xa5, 0x61, 0x9b,
+	0xc5, 0xdd, 0xda, 0x1b, 0x6d, 0xb6, 0x9c, 0x59, 0x62, 0x6a, 0x69, 0xde,
+	0x57, 0x57, 0x76, 0xd6, 0x69, 0x87, 0x19, 0xd9, 0x1c, 0xdd, 0x5c, 0x1c,
+	0x1c, 0x18, 0x70, 0x6d, 0xd6, 0x6d, 0xc2, 0x6e, 0x77, 0x56, 0x18, 0x87,
+	0x69, 0x1c, 0x5c, 0xe6, 0xe6, 0xdc, 0xa4, 0x72, 0x57, 0x26, 0xdc, 0x18,
+	0xb9, 0xb9, 0xbb, 0x18, 0xbc, 0x66, 0x25, 0xb1, 0x99, 0xa7, 0x29, 0xd5,
+	0x26, 0x9b, 0x69, 0xde, 0x68, 0x77, 0x6d, 0xa5, 0x9d, 0x9b, 0x9c, 0x5c,
+	0x09, 0xc1, 0x87, 0x16, 0x1d, 0x18, 0x47, 0x2b, 0x86, 0x58, 0x6d, 0xc9,
+	0xb7, 0x49, 0xc9, 0x96, 0x1d, 0x59, 0x9c, 0xa7, 0x27, 0x47, 0x19, 0xca,
+	0x72, 0x71, 0x9c, 0xa6, 0x97, 0x16, 0x61, 0x11, 0x16, 0x73, 0x71, 0x72,
+	0x62, 0x73, 0x9c, 0xe7, 0x31, 0x87, 0x29, 0xce, 0x49, 0xcd, 0x99, 0xce,
+	0x62, 0x6d, 0x27, 0x77, 0x57, 0x04, 0x65, 0xd9, 0xc2, 0xca, 0x95, 0x73,
+	0x16, 0xf5, 0x6a, 0x78, 0x1e, 0x0b, 0x5d, 0x27, 0x66, 0x9e, 0x07, 0x75,
+	0x77, 0x9b, 0x69, 0x86, 0x5c, 0x61, 0xc5, 0x9c, 0x70, 0x57, 0x4c, 0x46,
+	0x67, 0x39, 0xbc, 0xef, 0x7d, 0x65, 0xba, 0x45, 0xc7, 0x2a, 0xa7, 0x27,
+	0x2e, 0x18, 0x5b, 0x12, 0xf0, 0x9b, 0x9c, 0x26, 0x25, 0xba, 0x6d, 0x8b,
+	0xb6, 0x19, 0x78, 0x1a, 0xbc, 0x1a, 0x6e, 0xc7, 0x27, 0x0b, 0x07, 0x0b,
+	0xc2, 0xf0, 0x71, 0x72, 0xbd, 0xdb, 0x6d, 0x97, 0x75, 0x78, 0x13, 0x3c,
+	0x27, 0x69, 0x58, 0x70, 0x75, 0x77, 0x95, 0xe0, 0x49, 0xdd, 0x97, 0x82,
+	0xf8, 0x1c, 0x67, 0x81, 0x99, 0xe0, 0x9e, 0x06, 0x67, 0x17, 0x6b, 0xd2,
+	0x77, 0x9d, 0xa7, 0x69, 0xd9, 0xc1, 0xc3, 0x1d, 0x56, 0x6d, 0x27, 0x09,
+	0x89, 0x89, 0xd6, 0x27, 0x76, 0xd8, 0x9c, 0xd8, 0x66, 0x77, 0x6a, 0x76,
+	0x69, 0xb9, 0xc9, 0xc9, 0xc2, 0x73, 0x1c, 0x2e, 0x1a, 0x59, 0xd1, 0xc5,
+	0x5d, 0xd2, 0x78, 0x27, 0x56, 0x5d, 0x67, 0x81, 0xcd, 0xb9, 0xde, 0xe1,
+	0x5d, 0x25, 0x78, 0x11, 0xcc, 0x78, 0x12, 0x46, 0xd9, 0x78, 0x16, 0x47,
+	0x77, 0x56, 0x59, 0xb3, 0x7e, 0x09, 0xd5, 0x8a, 0x75, 0xaa, 0x66, 0x74,
+	0x9d, 0x33, 0x99, 0xe0, 0x9e, 0x09, 0xe0, 0x6d, 0xb9, 0xb5, 0x9e, 0x09,
+	0xc2, 0x6a, 0x69, 0xde, 0x78, 0x1b, 0x62, 0x6d, 0x86, 0x67, 0x06, 0xa7,
+	0x82, 0x71, 0x65, 0x87, 0x47, 0x36, 0x2e, 0xe7, 0x57, 0x37, 0x17, 0x17,
+	0x19, 0xe0, 0x9d, 0x5a, 0x9e, 0x09, 0xe0, 0x6a, 0x1c, 0x15, 0x51, 0xe0,
+	0x73, 0x6e, 0x77, 0x57, 0x19, 0xe0, 0x70, 0x78, 0x2e, 0x1c, 0xa7, 0x6b,
+	0xde, 0xf7, 0xbd, 0xc6, 0x5c, 0x9c, 0xa1, 0xc6, 0x75, 0x9d, 0x67, 0x57,
+	0x09, 0xd5, 0xe0, 0x5b, 0x94, 0x57, 0x29, 0x89, 0xcb, 0x1a, 0x6a, 0x22,
+	0x06, 0x1c, 0x5c, 0x67, 0x75, 0x87, 0x29, 0xd9, 0xbb, 0xce, 0x69, 0xb9,
+	0xc1, 0x1c, 0xae, 0x1b, 0x9c, 0x52, 0x72, 0xbe, 0x07, 0x45, 0x9d, 0x6a,
+	0x74, 0x73, 0x73, 0x74, 0x72, 0x71, 0xa4, 0x76, 0x9d, 0x59, 0x9c, 0x52,
+	0xf3, 0x72, 0xbc, 0xd8, 0x72, 0x74, 0x54, 0xb5, 0x89, 0xb6, 0xe6, 0xdd,
+	0x67, 0x79, 0xdd, 0xca, 0x77, 0x9b, 0x57, 0x79, 0xc9, 0x16, 0x77, 0x71,
+	0x9c, 0x1e, 0x06, 0x18, 0x65, 0xa4, 0xb6, 0x62, 0x1a, 0xb5, 0xa7, 0x46,
+	0x55, 0xca, 0x41, 0xa6, 0xda, 0x69, 0xc9, 0x1b, 0x6d, 0x67, 0x82, 0x78,
+	0x27, 0x80, 0x62, 0x66, 0x73, 0x6d, 0x66, 0x9d, 0x25, 0x6d, 0x96, 0xe4,
+	0x6a, 0x9a, 0x71, 0x6d, 0xc5, 0xa6, 0x58, 0x78, 0x15, 0xa6, 0x27, 0x36,
+	0x62, 0x70, 0x9c, 0x1c, 0x27, 0x0b, 0xdd, 0x66, 0x52, 0xc7, 0x27, 0x37,
+	0x27, 0x56, 0xa7, 0x29, 0xbb, 0x99, 0xe0, 0x71, 0x6d, 0xe0, 0x12, 0x61,
+	0xc5, 0xce, 0x66, 0x55, 0x98, 0x6d, 0xa9, 0xc9, 0xc5, 0x70, 0x9c, 0x15,
+	0x97, 0x25, 0x56, 0x86, 0xe1, 0x98, 0x69, 0xc8, 0x69, 0xd5, 0xa9, 0x51,
+	0xda, 0x47, 0x81, 0x87, 0x4b, 0x58, 0x87, 0x7b, 0x78, 0x70, 0xe1, 0xc9,
+	0xe0, 0x71, 0x1d, 0xe4, 0x74, 0xbc, 0x18, 0xbb, 0xbc, 0xd9, 0x9d, 0x27,
+	0x48, 0x6e, 0x6a, 0x72, 0xbc, 0x67, 0x79, 0xdd, 0xc9, 0xcb, 0x3c, 0xd6,
+	0x72, 0x47, 0x09, 0xc2, 0x70, 0x9c, 0x25, 0x69, 0xde, 0x71, 0x9e, 0x06,
+	0x27, 0x56, 0x27, 0x81, 0xcd, 0xce, 0x59, 0xc0, 0x75, 0xba, 0x99, 0x65,
+	0xcd, 0x27, 0x27, 0x47, 0x66, 0x61, 0x2f, 0x17, 0x2b, 0xc5, 0x87, 0x82,
+	0x78, 0x15, 0x99, 0x86, 0x15, 0xd5, 0xd5, 0xa6, 0x1d, 0xec, 0x62, 0x6e,
+	0xf4, 0x57, 0x64, 0x9a, 0x70, 0x74, 0xb5, 0xd9, 0x97, 0x36, 0xe5, 0x9c,
+	0x15, 0x51, 0x5c, 0x67, 0x07, 0x79, 0xce, 0x73, 0x6d, 0xe0, 0xb8, 0x59,
+	0xce, 0x73, 0x72, 0x87, 0x46, 0x92, 0x71, 0x74, 0x61, 0xd9, 0xa4, 0x9a,
+	0xbc, 0x61, 0xc9, 0x1b, 0x9c, 0x1d, 0x26, 0x25, 0x66, 0x27, 0x55, 0x74,
+	0x71, 0x59, 0x2e, 0xf8, 0x70, 0x61, 0xd5, 0xe0, 0x6e, 0x59, 0x1c, 0xa7,
+	0x07, 0x07, 0x78, 0x56, 0x51, 0xb5, 0x9d, 0xe6, 0x1c, 0x67, 0x09, 0xc1,
+	0xc2, 0x57, 0x81, 0x6f, 0x46, 0xe6, 0xa4, 0x76, 0x9b, 0x6d, 0xe0, 0xbd,
+	0x22, 0x72, 0x55, 0x66, 0x1b, 0x59, 0x5d, 0x29, 0xca, 0x72, 0x73, 0x76,
+	0x6a, 0x68, 0x77, 0x9b, 0xb9, 0x74, 0x61, 0xdd, 0x67, 0x06, 0xd5, 0x96,
+	0x55, 0x58, 0x57, 0x81, 0xc5, 0x97, 0x17, 0x16, 0x9d, 0x9d, 0x9d, 0x9d,
+	0x9d, 0x9c, 0x9d, 0x04, 0x77, 0x9e, 0x07, 0x27, 0x46, 0x46, 0x5a, 0x65,
+	0xca, 0x47, 0x82, 0x57, 0x82, 0x71, 0x72, 0x74, 0x71, 0x76, 0x66, 0x56,
+	0xdd, 0x9a, 0x61, 0x5d, 0x98, 0x9b, 0xa5, 0x77, 0x69, 0xc6, 0x6a, 0x72,
+	0x9c, 0x9b, 0x71, 0xbc, 0x55, 0xcd, 0xe0, 0x9b, 0x74, 0x9b, 0x89, 0xb6,
+	0xa6, 0xc7, 0x1b, 0xd2, 0xf4, 0x9d, 0x86, 0x2c, 0x9b, 0x9c, 0xac, 0x76,
+	0x9d, 0x18, 0x6e, 0x72, 0x47, 0x07, 0x09, 0xc6, 0x57, 0x16, 0x67, 0x36,
+	0xe2, 0x1c, 0x9c, 0x1c, 0x9c, 0xa7, 0x57, 0x09, 0xd9, 0xb9, 0xa9, 0xb6,
+	0x67, 0x67, 0x47, 0x79, 0xc1, 0x95, 0x92, 0x46, 0xdd, 0xa7, 0x58, 0x9d,
+	0x27, 0x47, 0x29, 0xd2, 0x45, 0x71, 0x71, 0x96, 0x61, 0x97, 0x81, 0xce,
+	0x74, 0x49, 0x87, 0x79, 0xd1, 0xb6, 0x1c, 0x67, 0x56, 0x1c, 0x9c, 0xdb,
+	0x70, 0x70, 0x70, 0x9a, 0x72, 0x71, 0x65, 0xcd, 0x1d, 0x1c, 0x19, 0x9b,
+	0x6d, 0xda, 0x65, 0xb6, 0x1a, 0x6e, 0x72, 0x61, 0x8a, 0xc6, 0xf1, 0xbb,
+	0xc5, 0x89, 0xd5, 0xa8, 0x70, 0x26, 0x25, 0x65, 0xde, 0x62, 0x72, 0x6d,
+	0xa9, 0xca, 0x72, 0x70, 0x9c, 0xb1, 0xc5, 0x66, 0x1c, 0x27, 0x07, 0x29,
+	0xc2, 0x71, 0x65, 0xb5, 0x9c, 0x27, 0x51, 0x24, 0x66, 0x77, 0x61, 0xce,
+	0x58, 0x69, 0xa9, 0x27, 0x29, 0xc9, 0x97, 0x64, 0x9c, 0xe7, 0x46, 0x9e,
+	0x06, 0x59, 0x59, 0xb7, 0x67, 0x66, 0x1a, 0x6d, 0xc9, 0x86, 0x27, 0x19,
+	0xd2, 0x74, 0x9d, 0x18, 0x9d, 0x1a, 0x74, 0x74, 0x74, 0x61, 0xd1, 0xce,
+	0xf7, 0x59, 0xd6, 0x75, 0x6a, 0x75, 0xc6, 0x96, 0x75, 0x72, 0x9a, 0x9c,
+	0x9c, 0x9a, 0x69, 0xa7, 0x59, 0xdd, 0x5d, 0xa7, 0x21, 0xb5, 0xba, 0x46,
+	0x67, 0x16, 0x71, 0xcd, 0xd6, 0xee, 0x65, 0x97, 0x5a, 0x9d, 0x5b, 0x86,
+	0xa7, 0x77, 0x5c, 0x78, 0x2c, 0x96, 0xc7, 0x48, 0x6e, 0x51, 0xd1, 0xb7,
+	0x47, 0x45, 0x57, 0x69, 0x27, 0x19, 0xc5, 0xb9, 0xc6, 0x73, 0x5b, 0xc2,
+	0xf0, 0xbc, 0x06, 0x25, 0x75, 0x96, 0x59, 0x65, 0x94, 0x95, 0xb9, 0x5c,
+	0x9d, 0xa6, 0xa7, 0x26, 0x9c, 0x9c, 0x5b, 0x9b, 0x73, 0x76, 0x6d, 0xd9,
+	0xd9, 0xc5, 0xa7, 0x11, 0xd9, 0xb7, 0x67, 0x36, 0x5c, 0x1b, 0x1c, 0xd9,
+	0x6d, 0xd1, 0x97, 0x26, 0x5c, 0x1c, 0xb1, 0xd5, 0xa9, 0x99, 0x96, 0xe6,
+	0x5d, 0x95, 0xd5, 0xce, 0x69, 0x85, 0xbc, 0x1a, 0x9c, 0x99, 0x86, 0x9d,
+	0x9a, 0x9d, 0x9a, 0x4b, 0x97, 0x76, 0x21, 0xb8, 0x65, 0x96, 0xdb, 0x61,
+	0x89, 0x5d, 0x5a, 0x74, 0x55, 0x66, 0xed, 0xa6, 0x67, 0x48, 0x6a, 0xed,
+	0xc9, 0x5c, 0x1d, 0x5c, 0x9d, 0x1c, 0xdc, 0xd8, 0x6d, 0xb7, 0x81, 0xc1,
+	0x94, 0x78, 0x29, 0xb6, 0x19, 0x9a, 0x9a, 0x66, 0x6b, 0x3c, 0xd6, 0x73,
+	0x90, 0x57, 0x81, 0x89, 0xa5, 0x61, 0xca, 0x15, 0x21, 0x89, 0x95, 0x59,
+	0xb6, 0x9d, 0xe7, 0x26, 0xe6, 0xd8, 0x9a, 0x74, 0x6d, 0xe0, 0x9c, 0xa5,
+	0x95, 0x96, 0x5a, 0x5b, 0xd5, 0x21, 0xc6, 0xe5, 0x89, 0x89, 0x1e, 0x07,
+	0x81, 0x96, 0xe6, 0xe7, 0x59, 0x97, 0x16, 0x51, 0xa7, 0x59, 0x99, 0xc6,
+	0x61, 0xca, 0x71, 0x6d, 0x86, 0x1b, 0x6d, 0xc6, 0x70, 0x72, 0x70, 0x73,
+	0x9d, 0x95, 0x1c, 0xa7, 0x07, 0x06, 0x71, 0xd2, 0xdb, 0xca, 0x72, 0x27,
+	0x06, 0xb1, 0xe0, 0xbc, 0xb1, 0xdb, 0x3c, 0xd8, 0xcd, 0x6a, 0xf5, 0x72,
+	0xbd, 0x9c, 0x5c, 0xc7, 0x29, 0xde, 0x26, 0xdc, 0xa7, 0x49, 0xce, 0x6a,
+	0x73, 0x59, 0xc6, 0x75, 0x6d, 0x89, 0xb9, 0xce, 0x76, 0x62, 0x75, 0x74,
+	0x6e, 0xed, 0xc1, 0xa7, 0x46, 0x51, 0xb5, 0x6d, 0xc2, 0x77, 0x1c, 0x18,
+	0x19, 0x74, 0x6e, 0x77, 0x61, 0x5c, 0x52, 0x9d, 0x1c, 0x5d, 0x1a, 0x6d,
+	0x1b, 0x59, 0xe0, 0x72, 0x92, 0x78, 0x1d, 0xdc, 0x5c, 0xb1, 0xa9, 0xb2,
+	0x77, 0x73, 0xbd, 0x67, 0x82, 0xcb, 0xd6, 0x76, 0x5a, 0xcc, 0x72, 0x33,
+	0xd2, 0x65, 0xe0, 0x74, 0xbc, 0xe5, 0x94, 0x62, 0x6a, 0x52, 0x71, 0x63,
+	0x3a, 0x75, 0x76, 0x91, 0x9c, 0x27, 0x0c, 0x61, 0xcb, 0x3a, 0x72, 0x4b,
+	0xd9, 0xc1, 0xb4, 0x66, 0xf1, 0x69, 0x51, 0x8a, 0x98, 0xb6, 0xe6, 0x62,
+	0x61, 0xd6, 0x77, 0x71, 0xb8, 0xba, 0x77, 0x56, 0x1c, 0x2e, 0x55, 0xd5,
+	0xa7, 0x34, 0xbe, 0x07, 0x47, 0x46, 0xdd, 0xae, 0x15, 0xc5, 0x87, 0x77,
+	0x27, 0x47, 0x14, 0x9c, 0xae, 0xe7, 0x79, 0x89, 0x9c, 0xf4, 0x26, 0x98,
+	0x47, 0x69, 0x1c, 0x67, 0x56, 0x18, 0x47, 0x0e, 0x01, 0x62, 0x22, 0x1e,
+	0x08, 0x96, 0x70, 0x71, 0x71, 0x74, 0x70, 0x49, 0x97, 0x07, 0x06, 0xdc,
+	0xe6, 0x55, 0xc5, 0x87, 0x47, 0x27, 0x47, 0x14, 0x78, 0x26, 0x5c, 0x5e,
+	0x07, 0x80, 0xce, 0x73, 0x9b, 0xc5, 0xab, 0xd3, 0x19, 0x75, 0x93, 0x3c,
+	0xa7, 0x33, 0x3d, 0x24, 0x9b, 0xa6, 0xda, 0x1c, 0xa7, 0x82, 0x62, 0x77,
+	0x76, 0xba, 0x62, 0x6c, 0x62, 0x73, 0xbb, 0x65, 0x99, 0xd9, 0xa7, 0x64,
+	0x61, 0x96, 0xe7, 0x66, 0x92, 0x61, 0xbc, 0xb8, 0x1c, 0x5c, 0x5c, 0x5d,
+	0x5d, 0x9c, 0x99, 0x9d, 0x65, 0x9c, 0x1d, 0x9c, 0xf3, 0x1d, 0x98, 0x6d,
+	0xe0, 0x61, 0x86, 0x16, 0x67, 0x1b, 0x4a, 0x98, 0xba, 0x70, 0x92, 0x56,
+	0xdc, 0x66, 0x1d, 0xa6, 0x26, 0x26, 0x26, 0x1e, 0x09, 0x86, 0xee, 0xdc,
+	0xad, 0x70, 0x9c, 0x9a, 0x73, 0x73, 0x65, 0xcd, 0xcd, 0xce, 0x6d, 0xda,
+	0x65, 0x1c, 0x9d, 0x5d, 0x5c, 0x17, 0x1d, 0x9c, 0x98, 0x9b, 0x6a, 0x72,
+	0x77, 0x9c, 0x5d, 0x60, 0x9c, 0xdb, 0x74, 0x76, 0x77, 0x49, 0xca, 0x72,
+	0x9c, 0x98, 0x6a, 0x72, 0x47, 0x56, 0x26, 0x64, 0x56, 0x19, 0x73, 0xb9,
+	0x57, 0x16, 0x9a, 0x54, 0x62, 0x71, 0x62, 0x70, 0x71, 0x69, 0xa9, 0x58,
+	0x9c, 0x86, 0x1d, 0x1c, 0xb8, 0x74, 0x77, 0x6d, 0x96, 0x5a, 0x9c, 0x6f,
+	0x09, 0x27, 0x7b, 0x2f, 0x06, 0x51, 0xa6, 0xe2, 0x61, 0x67, 0x81, 0xcd,
+	0x5d, 0x67, 0x59, 0x5c, 0x26, 0xe5, 0x1c, 0x27, 0x57, 0x16, 0x5c, 0x18,
+	0x61, 0xcd, 0x89, 0xcd, 0xc6, 0x6d, 0xc5, 0xb7, 0x83, 0x1d, 0xf2, 0x9d,
+	0x71, 0xda, 0x61, 0xa4, 0x9e, 0x0b, 0xa7, 0x52, 0xea, 0x71, 0x96, 0xe1,
+	0xdd, 0xde, 0x16, 0x69, 0x5c, 0x4b, 0x89, 0x67, 0x09, 0xd1, 0x5c, 0x67,
+	0x81, 0x99, 0xc8, 0x61, 0xd5, 0x5c, 0xe7, 0x16, 0x67, 0x39, 0xdd, 0xc1,
+	0xb9, 0xd1, 0xa7, 0x77, 0x47, 0x81, 0x86, 0x9b, 0x71, 0x9d, 0xdd, 0x52,
+	0xe9, 0xb6, 0x27, 0x67, 0x46, 0x1c, 0xae, 0x12, 0x47, 0x77, 0x76, 0x1a,
+	0x75, 0xb8, 0x57, 0x28, 0x6e, 0xe9, 0x97, 0x56, 0x9d, 0x58, 0x74, 0x70,
+	0x9c, 0x2d, 0x87, 0x69, 0x91, 0xc1, 0xcd, 0xcd, 0xce, 0x70, 0x46, 0xdd,
+	0x1d, 0x1d, 0x1d, 0x1d, 0x1a, 0x74, 0x1d, 0x11, 0xb6, 0xd9, 0x65, 0xdd,
+	0xe0, 0x99, 0x65, 0xc2, 0xe9, 0xd8, 0xc6, 0x9c, 0x71, 0xce, 0x66, 0x41,
+	0xcd, 0x2f, 0x57, 0x03, 0x3c, 0xde, 0x08, 0x72, 0x99, 0x48, 0x73, 0x81,
+	0x84, 0x74, 0x78, 0x26, 0xd9, 0x72, 0x70, 0x59, 0x96, 0x26, 0x07, 0x37,
+	0x82, 0x69, 0xca, 0x6d, 0xc5, 0xa7, 0x27, 0x39, 0xa7, 0x81, 0xa9, 0xca,
+	0x1e, 0x08, 0x75, 0x57, 0x69, 0x87, 0x67, 0x19, 0x24, 0x6a, 0x1c, 0xdc,
+	0xdd, 0xdc, 0x12, 0x73, 0x78, 0x18, 0x77, 0x6d, 0xd9, 0xc1, 0xdd, 0xa6,
+	0x1c, 0xd5, 0xc5, 0xc5, 0xb9, 0xc5, 0x97, 0x29, 0xce, 0x6e, 0x47, 0x3c,
+	0x77, 0x47, 0x46, 0x1c, 0x1d, 0xdd, 0x5d, 0x58, 0xbc, 0x71, 0xcd, 0x95,
+	0x62, 0x57, 0x77, 0x07, 0x36, 0x1c, 0xed, 0x76, 0x2d, 0x9d, 0xf1, 0xda,
+	0x6d, 0xda, 0x72, 0x73, 0x72, 0xb8, 0x77, 0x86, 0xdd, 0x0c, 0x75, 0xb6,
+	0x77, 0x9e, 0x09, 0x89, 0xce, 0x6e, 0x77, 0x74, 0x9d, 0xe6, 0xdc, 0x1c,
+	0x24, 0x70, 0x94, 0x96, 0x59, 0xc9, 0xce, 0x71, 0x95, 0xc1, 0xa6, 0x67,
+	0x66, 0x1d, 0x9d, 0x9d, 0x9d, 0x9d, 0x9a, 0x76, 0x1d, 0x9c, 0xdd, 0x9d,
+	0x21, 0x27, 0x81, 0xa9, 0x1c, 0x67, 0x39, 0xa2, 0x73, 0x9c, 0xe7, 0x37,
+	0x69, 0x97, 0x81, 0xcd, 0xe0, 0x9c, 0xdd, 0xe7, 0x39, 0xa5, 0x86, 0xe2,
+	0x1d, 0xa7, 0x09, 0xc9, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1c, 0x1d, 0xe6,
+	0xe7, 0x06, 0xa6, 0x26, 0x1b, 0x98, 0x70, 0x98, 0x98, 0x74, 0x98, 0x98,
+	0x78, 0x26, 0x27, 0x15, 0x91, 0xb7, 0x79, 0x1d, 0x9d, 0x64, 0x91, 0xa7,
+	0x17, 0x17, 0x16, 0x1c, 0x5c, 0x67, 0x76, 0x67, 0x19, 0x82, 0xf2, 0x95,
+	0xc1, 0xce, 0x70, 0x75, 0x76, 0x27, 0x29, 0x89, 0x1b, 0x6d, 0x96, 0x58,
+	0x76, 0x71, 0x59, 0x9a, 0x69, 0x86, 0xe6, 0x15, 0x52, 0x62, 0x49, 0x89,
+	0xc5, 0xcd, 0xce, 0x73, 0x98, 0x27, 0x29, 0xb9, 0xc9, 0xda, 0x69, 0xc1,
+	0xd1, 0xe0, 0x9c, 0x9e, 0x0c, 0xf6, 0x48, 0x6a, 0x1e, 0x07, 0x58, 0x9d,
+	0x11, 0xc3, 0x3d, 0x91, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xde, 0x71, 0x9c,
+	0x9a, 0x98, 0x27, 0x39, 0x5c, 0x65, 0x47, 0x57, 0x47, 0x35, 0x95, 0xcd,
+	0xe0, 0x61, 0x14, 0x57, 0x59, 0xc2, 0x72, 0x74, 0x65, 0xb6, 0xd5, 0xc9,
+	0x87, 0x81, 0xdc, 0x77, 0x70, 0x76, 0x70, 0xca, 0x76, 0xc7, 0x75, 0x61,
+	0xd2, 0x78, 0x1d, 0x1d, 0x58, 0x86, 0x99, 0x78, 0x25, 0x66, 0x56, 0x9b,
+	0x61, 0x66, 0x5a, 0x9d, 0x66, 0x5e, 0x09, 0xdd, 0xb6, 0x1c, 0x58, 0x66,
+	0x9a, 0x75, 0x95, 0x96, 0x1d, 0xdd, 0x5e, 0x07, 0x81, 0xc1, 0xa6, 0x9e,
+	0x05, 0x46, 0xa7, 0x06, 0x5a, 0x69, 0x5c, 0x18, 0x75, 0x66, 0x78, 0x1b,
+	0x62, 0x71, 0x9d, 0x5c, 0xdb, 0x70, 0x76, 0x91, 0x58, 0x59, 0x5e, 0x09,
+	0xc5, 0xc9, 0xce, 0x62, 0x1b, 0x6d, 0xd0, 0x49, 0x87, 0x36, 0x18, 0x69,
+	0xcd, 0xb4, 0x74, 0x65, 0xde, 0xe6, 0x65, 0xc9, 0x96, 0xdd, 0x9e, 0x06,
+	0x6f, 0x19, 0x97, 0x36, 0x59, 0x6d, 0x1d, 0x9e, 0x06, 0x1d, 0x46, 0x5a,
+	0x73, 0x65, 0xe0, 0x57, 0x76, 0xad, 0x74, 0xba, 0x49, 0xb6, 0x19, 0x61,
+	0xd9, 0xd9, 0x84, 0x63, 0x1e, 0x07, 0x29, 0x1a, 0x6a, 0x65, 0x5c, 0x1d,
+	0xdd, 0xd6, 0x69, 0x18, 0x71, 0x99, 0x6e, 0x65, 0xc1, 0xdd, 0x89, 0xc1,
+	0xb5, 0x69, 0xce, 0x66, 0x6e, 0x61, 0xb7, 0x71, 0x26, 0x5c, 0x65, 0x74,
+	0x57, 0x07, 0x57, 0x14, 0x9a, 0x1c, 0x51, 0xac, 0x59, 0xc1, 0xca, 0x59,
+	0x5a, 0x9d, 0x27, 0x6c, 0xe5, 0x6f, 0x6b, 0x1a, 0xb1, 0xc1, 0xd9, 0x89,
+	0x87, 0x82, 0x65, 0x96, 0x5c, 0x9d, 0x2c, 0x56, 0x26, 0xe6, 0x5e, 0x08,
+	0x62, 0x69, 0xa9, 0x86, 0x9d, 0xdd, 0x27, 0x39, 0xca, 0x6d, 0xca, 0x72,
+	0x9e, 0x07, 0x39, 0x87, 0x69, 0xd9, 0xcd, 0x99, 0xd1, 0xc5, 0x86, 0xd9,
+	0x78, 0x19, 0x77, 0x62, 0x66, 0x69, 0x81, 0xc2, 0x74, 0x9c, 0x9b, 0x95,
+	0xb7, 0x36, 0x1c, 0x1c, 0x96, 0x47, 0x25, 0x9d, 0xde, 0x09, 0xe0, 0x65,
+	0xdd, 0xa7, 0x17, 0x15, 0x78, 0x1a, 0x95, 0x98, 0x9b, 0x91, 0xa7, 0x72,
+	0x74, 0x72, 0xc7, 0x07, 0x17, 0x17, 0x17, 0x17, 0x17, 0x11, 0xdd, 0xd9,
+	0xe0, 0x9c, 0x24, 0x9c, 0x1d, 0x1e, 0x09, 0xc1, 0xc9, 0xe0, 0x47, 0x47,
+	0x69, 0x97, 0x74, 0x98, 0x65, 0xce, 0x78, 0x1c, 0x5c, 0xdd, 0x1c, 0xdc,
+	0x11, 0x94, 0x62, 0x47, 0x16, 0x5b, 0x65, 0x97, 0x47, 0x46, 0xdc, 0x09,
+	0x1b, 0x91, 0xc9, 0xd9, 0xa5, 0x6d, 0x87, 0x39, 0xb6, 0x61, 0xe0, 0x72,
+	0x6a, 0x1a, 0x72, 0x78, 0x1c, 0x9d, 0x95, 0x86, 0x67, 0x81, 0xdd, 0x97,
+	0x56, 0x5c, 0x1d, 0xe5, 0x78, 0x24, 0x91, 0xc6, 0x57, 0x19, 0xb7, 0x48,
+	0x69, 0x64, 0x74, 0x75, 0x87, 0x2a, 0x73, 0x9d, 0x67, 0x77, 0x65, 0x62,
+	0x70, 0x87, 0x69, 0x96, 0x64, 0x77, 0x61, 0x96, 0x58, 0xb5, 0x58, 0x99,
+	0x78, 0x15, 0x89, 0xc5, 0x89, 0x89, 0xc1, 0x96, 0x64, 0x5b, 0x5d, 0x26,
+	0xa6, 0xa1, 0xa7, 0x47, 0x58, 0x62, 0x59, 0xa6, 0x27, 0x57, 0x29, 0x5d,
+	0x5d, 0x5c, 0x5d, 0xe7, 0x36, 0xa4, 0x92, 0x72, 0x98, 0x71, 0x71, 0x54,
+	0x9c, 0x9d, 0x1c, 0x24, 0x57, 0x29, 0x87, 0x08, 0x99, 0x9c, 0x9c, 0xe7,
+	0x39, 0xa7, 0x27, 0x45, 0x65, 0x87, 0x65, 0x9a, 0x75, 0x60, 0x66, 0x59,
+	0x66, 0x9c, 0x1d, 0xdb, 0x58, 0x73, 0x69, 0x87, 0x47, 0x39, 0xc5, 0xd6,
+	0x1b, 0x72, 0x1a, 0x61, 0xc1, 0xc5, 0xcd, 0xa6, 0x1c, 0xd9, 0x70, 0x62,
+	0x6a, 0x57, 0x57, 0x37, 0x57, 0x57, 0x57, 0x17, 0x41, 0x26, 0x26, 0x51,
+	0xdd, 0xdd, 0x1d, 0xa7, 0x17, 0x47, 0x26, 0x1c, 0x5a, 0x75, 0x78, 0x19,
+	0x92, 0x47, 0x16, 0xa6, 0xda, 0x96, 0x15, 0xd5, 0xd5, 0xc2, 0x57, 0x79,
+	0xd5, 0xbb, 0xc9, 0xe0, 0x75, 0x78, 0x19, 0x78, 0x1e, 0x07, 0x36, 0x9e,
+	0x06, 0x9d, 0x61, 0x96, 0x98, 0x92, 0x61, 0xb9, 0xb7, 0x47, 0x17, 0x81,
+	0x55, 0xc1, 0xa9, 0xb6, 0x95, 0xb7, 0x77, 0x16, 0x1d, 0x1d, 0x26, 0xe6,
+	0x5c, 0xdd, 0x1c, 0x04, 0x76, 0x9b, 0x75, 0x77, 0x75, 0x57, 0x57, 0x66,
+	0x27, 0x19, 0xc5, 0x97, 0x37, 0x75, 0x9d, 0x27, 0x57, 0x81, 0x58, 0x95,
+	0xb5, 0x9c, 0x5c, 0x1d, 0x58, 0x62, 0x08, 0x44, 0x61, 0x96, 0x95, 0x86,
+	0x66, 0x19, 0x98, 0x74, 0x98, 0x69, 0xcc, 0xbc, 0xa6, 0x4b, 0xca, 0x73,
+	0xbc, 0x9a, 0x9c, 0x1c, 0x64, 0x92, 0x71, 0x92, 0x66, 0xe7, 0x3c, 0xb1,
+	0xb6, 0x59, 0xbc, 0x73, 0xc9, 0x86, 0x26, 0x15, 0x66, 0xd6, 0xc7, 0x59,
+	0xe0, 0x9b, 0x98, 0x9c, 0xef, 0x44, 0x70, 0x70, 0x70, 0x70, 0x70, 0x70,
+	0x99, 0x9c, 0xa7, 0x36, 0xa7, 0x29, 0xc9, 0xb9, 0xc9, 0xc2, 0x72, 0x9c,
+	0x9d, 0x27, 0x29, 0xc9, 0xe0, 0x98, 0x9c, 0xa7, 0x29, 0xc9, 0x96, 0x67,
+	0x45, 0x99, 0x72, 0x92, 0x66, 0x1e, 0x09, 0x99, 0x96, 0x9c, 0x5c, 0x5c,
+	0x58, 0x71, 0x71, 0xb1, 0x9b, 0xa9, 0xb3, 0x1d, 0x67, 0x47, 0x39, 0xc9,
+	0xd5, 0x73, 0xd3, 0x3d, 0x26, 0x58, 0x74, 0x77, 0x6e, 0x76, 0x9c, 0x26,
+	0x1b, 0x62, 0xe6, 0x72, 0x61, 0xc6, 0x61, 0x5a, 0x71, 0x9a, 0x78, 0x27,
+	0x36, 0xdc, 0xc4, 0x9c, 0x1c, 0x5d, 0x24, 0x57, 0x27, 0x57, 0x47, 0x06,
+	0x6e, 0xa6, 0xdc, 0x27, 0x56, 0x6e, 0x27, 0x4b, 0x56, 0x74, 0x66, 0xf6,
+	0x6d, 0xcd, 0x86, 0x9c, 0x1c, 0xd5, 0x87, 0x69, 0x5d, 0x1d, 0x58, 0x77,
+	0x69, 0xdd, 0xe0, 0x60, 0x65, 0xb9, 0xd2, 0x69, 0xd9, 0xc6, 0xf1, 0x99,
+	0x62, 0x65, 0x97, 0x57, 0x35, 0x9d, 0xe6, 0xdd, 0xa7, 0x07, 0x17, 0x16,
+	0xd8, 0x77, 0x61, 0x99, 0xb7, 0x72, 0x6e, 0x6d, 0x97, 0x17, 0x07, 0x82,
+	0x49, 0x85, 0x56, 0x59, 0x77, 0x54, 0x77, 0x77, 0x77, 0x72, 0x77, 0x6d,
+	0x87, 0x06, 0x19, 0x65, 0x87, 0x82, 0x72, 0xbc, 0x19, 0x6d, 0xb7, 0x64,
+	0x6d, 0x89, 0x86, 0x9c, 0x59, 0x57, 0x67, 0x81, 0xc1, 0x89, 0x86, 0x9c,
+	0xa1, 0xc1, 0xa7, 0x76, 0x9d, 0x18, 0x65, 0xc9, 0xc9, 0x87, 0x37, 0x26,
+	0x9c, 0xd8, 0x71, 0x74, 0x6e, 0x78, 0x1a, 0xbc, 0x9c, 0x9b, 0xbc, 0x66,
+	0x9a, 0x73, 0x71, 0x57, 0x25, 0x61, 0xd5, 0xc5, 0x86, 0x5d, 0xe5, 0x65,
+	0x99, 0xc2, 0x57, 0x16, 0x59, 0x9a, 0x89, 0xa6, 0x1c, 0x1c, 0x1c, 0x1c,
+	0x19, 0x9c, 0xdd, 0x5d, 0x1a, 0x6a, 0x44, 0x72, 0x70, 0x65, 0xb6, 0x58,
+	0x92, 0x69, 0xdd, 0xd5, 0xa7, 0x16, 0xdd, 0x9d, 0xd5, 0xcd, 0xcd, 0xa6,
+	0xdd, 0x66, 0xa1, 0xc2, 0xf6, 0x9d, 0x27, 0x59, 0xd9, 0x6f, 0x56, 0x9c,
+	0x65, 0x72, 0x9c, 0x26, 0x9d, 0xe7, 0x09, 0xdd, 0x5e, 0x09, 0xc1, 0x24,
+	0x74, 0x9b, 0x75, 0x70, 0x70, 0x71, 0x75, 0x71, 0x70, 0x62, 0x61, 0x56,
+	0x61, 0x5c, 0xe7, 0x07, 0x06, 0x26, 0xd6, 0x72, 0x61, 0xb6, 0x55, 0xc1,
+	0xc5, 0x5d, 0x1d, 0x5c, 0x58, 0x9c, 0x5d, 0x55, 0xd9, 0xa7, 0x35, 0x66,
+	0x56, 0xa7, 0x17, 0x57, 0x81, 0x86, 0x5a, 0x47, 0x82, 0x74, 0x9d, 0x61,
+	0xe0, 0x76, 0x86, 0x1d, 0x22, 0x77, 0x9b, 0x2e, 0x9c, 0x9a, 0x72, 0xa9,
+	0x88, 0x74, 0x98, 0x76, 0x56, 0x21, 0xc5, 0x5d, 0x95, 0x96, 0x27, 0x82,
+	0x56, 0x18, 0x70, 0x6e, 0x78, 0x18, 0x73, 0x9c, 0x5a, 0x77, 0x1c, 0x66,
+	0xa7, 0x17, 0x07, 0x09, 0xb9, 0x21, 0x97, 0x26, 0x95, 0xd9, 0x97, 0x81,
+	0x97, 0x36, 0x98, 0x9c, 0x16, 0x47, 0x17, 0x14, 0x61, 0x5c, 0x58, 0x56,
+	0x26, 0xdc, 0x95, 0x97, 0x77, 0x77, 0x46, 0x1c, 0xa2, 0x69, 0xdd, 0xde,
+	0x49, 0xc1, 0xc9, 0xc9, 0xd4, 0x47, 0x29, 0x5d, 0x9d, 0x5b, 0x69, 0x86,
+	0xde, 0x07, 0x36, 0x9a, 0x71, 0x6d, 0xc1, 0xc1, 0x5c, 0x21, 0xb7, 0x76,
+	0x5b, 0x71, 0x66, 0x70, 0x67, 0x19, 0x70, 0x66, 0x69, 0x97, 0x46, 0x21,
+	0xda, 0x21, 0xd1, 0xa7, 0x80, 0x98, 0x73, 0x9b, 0x74, 0x78, 0x11, 0xa9,
+	0x1d, 0x1c, 0x9c, 0x9d, 0x9b, 0x9c, 0xa6, 0x9b, 0x78, 0x27, 0x16, 0xa9,
+	0xce, 0x57, 0x65, 0x9c, 0x11, 0x87, 0x56, 0xe1, 0x6f, 0x26, 0x99, 0x76,
+	0x76, 0x76, 0x76, 0x76, 0x6a, 0x59, 0x15, 0xd1, 0xb7, 0x26, 0x26, 0x25,
+	0x70, 0x99, 0x77, 0x98, 0x6e, 0x76, 0x69, 0xc6, 0x49, 0xdd, 0xa6, 0x5d,
+	0x95, 0xe0, 0x76, 0x76, 0x69, 0xd1, 0xd1, 0xb7, 0x07, 0x37, 0x69, 0x97,
+	0x09, 0xb7, 0x66, 0x9c, 0x27, 0x47, 0x07, 0x58, 0x65, 0xa6, 0xdd, 0x58,
+	0x72, 0x91, 0xde, 0x75, 0x70, 0x69, 0xd1, 0xb9, 0x97, 0x16, 0x5a, 0x74,
+	0x9c, 0x15, 0xd1, 0xa6, 0x9a, 0x72, 0x69, 0xcd, 0x55, 0x97, 0x37, 0x37,
+	0x37, 0x16, 0x66, 0xe7, 0x45, 0x70, 0x74, 0x69, 0x89, 0xc1, 0x61, 0xe0,
+	0x57, 0x26, 0xa7, 0x07, 0x06, 0x5b, 0x46, 0x5d, 0x1c, 0x96, 0x6e, 0x65,
+	0xcd, 0x87, 0x67, 0x09, 0xd5, 0x87, 0x47, 0x27, 0x27, 0x46, 0x67, 0x81,
+	0xd2, 0x62, 0x62, 0x4c, 0xf4, 0xcf, 0x49, 0x97, 0x49, 0x87, 0x81, 0xa6,
+	0xa6, 0x26, 0x26, 0x27, 0x16, 0xdd, 0xde, 0x07, 0x77, 0x09, 0xc1, 0x99,
+	0xc9, 0xb7, 0x19, 0xcd, 0xe0, 0x78, 0x1e, 0x06, 0x9c, 0x1d, 0x1d, 0x1c,
+	0x57, 0x3b, 0x70, 0x62, 0x73, 0x9d, 0xa7, 0x26, 0xe4, 0x69, 0xd9, 0x87,
+	0x06, 0x15, 0xd5, 0xa8, 0x91, 0xdd, 0xa9, 0xb9, 0xc1, 0xd9, 0xca, 0x74,
+	0x98, 0x6e, 0x49, 0xc9, 0xc1, 0xc9, 0xd2, 0x73, 0x78, 0x1c, 0x59, 0xa9,
+	0xc0, 0xba, 0x71, 0x65, 0xd2, 0x70, 0xba, 0xcf, 0x35, 0x61, 0xde, 0x77,
+	0x78, 0x1d, 0x98, 0x91, 0xab, 0xa7, 0x39, 0x1b, 0x9d, 0x51, 0x89, 0x1b,
+	0x72, 0x77, 0x65, 0x89, 0xa7, 0x4b, 0x1d, 0x9d, 0x1b, 0x72, 0x12, 0x73,
+	0x71, 0x70, 0x9c, 0x1d, 0x1c, 0x55, 0x67, 0x46, 0x9d, 0x98, 0x55, 0x72,
+	0x57, 0x17, 0x27, 0x57, 0x37, 0x57, 0x47, 0x56, 0x9c, 0x44, 0x70, 0x71,
+	0x70, 0x89, 0xa9, 0xcd, 0x58, 0x76, 0x87, 0x17, 0x37, 0x16, 0x59, 0x61,
+	0x97, 0x07, 0x26, 0xd5, 0xcd, 0x5d, 0xdc, 0x55, 0x58, 0x5b, 0x1c, 0x19,
+	0x74, 0x9d, 0x1a, 0x77, 0x74, 0x76, 0x75, 0x96, 0x47, 0x36, 0x1c, 0x1d,
+	0xdc, 0xd8, 0x61, 0x84, 0x78, 0x15, 0xdd, 0x58, 0x72, 0x98, 0x58, 0x65,
+	0xc9, 0x87, 0x55, 0x70, 0x75, 0x9d, 0x5c, 0x1b, 0x86, 0x95, 0xdd, 0xd2,
+	0x62, 0x1d, 0xdd, 0x5d, 0x5e, 0x09, 0x89, 0xd1, 0xd5, 0xda, 0x1d, 0x95,
+	0x5c, 0x95, 0x87, 0x59, 0x15, 0x86, 0x9c, 0xd8, 0x70, 0x95, 0xda, 0x57,
+	0x09, 0xa6, 0xe5, 0x74, 0x59, 0xb7, 0x39, 0x1d, 0x1d, 0x92, 0x61, 0xe0,
+	0x74, 0x61, 0xc9, 0xdd, 0xcd, 0x96, 0xa7, 0x57, 0x37, 0x56, 0xa6, 0x9c,
+	0x9c, 0x05, 0x69, 0x94, 0x9d, 0x99, 0x76, 0x72, 0x69, 0x87, 0x09, 0xb7,
+	0x09, 0xd9, 0xac, 0xed, 0xd9, 0x61, 0xcd, 0xcd, 0xc5, 0xc6, 0x71, 0x9c,
+	0x58, 0x91, 0x86, 0x5c, 0x51, 0xb9, 0x67, 0x06, 0x67, 0x39, 0x5c, 0x5a,
+	0x99, 0x6a, 0x49, 0x95, 0x74, 0x74, 0x6d, 0xc1, 0xd6, 0x71, 0x78, 0x1a,
+	0x71, 0x11, 0xc1, 0xc5, 0xde, 0x46, 0x18, 0x73, 0x73, 0x73, 0x73, 0x70,
+	0x73, 0x72, 0x71, 0x71, 0x70, 0x72, 0x72, 0x69, 0x97, 0x49, 0x95, 0x87,
+	0x37, 0x66, 0x21, 0xc0, 0x72, 0x61, 0xc9, 0xcd, 0xdd, 0xdd, 0xdd, 0xc1,
+	0xc8, 0x47, 0x79, 0x99, 0x67, 0x77, 0x81, 0xa7, 0x57, 0x49, 0xca, 0x47,
+	0x55, 0x56, 0x65, 0x75, 0x59, 0xcd, 0xdd, 0x96, 0x87, 0x29, 0x1b, 0x61,
+	0xcd, 0x66, 0x11, 0x86, 0xa4, 0x75, 0x6d, 0xc9, 0xc1, 0x2d, 0x71, 0x9c,
+	0x1d, 0x27, 0x07, 0x36, 0x5d, 0x56, 0x72, 0x76, 0x65, 0x1d, 0x15, 0x64,
+	0x69, 0x86, 0x64, 0x69, 0xdd, 0x55, 0x97, 0x47, 0x47, 0x47, 0x16, 0x6e,
+	0x59, 0x6e, 0x56, 0x5d, 0xa2, 0x47, 0x19, 0x99, 0x87, 0x27, 0x28, 0x72,
+	0xcf, 0x69, 0xb6, 0x5c, 0xa4, 0x65, 0xa9, 0x5d, 0x95, 0xb7, 0x17, 0x56,
+	0x11, 0x99, 0xc2, 0xe9, 0x97, 0x66, 0xdd, 0xa7, 0x25, 0x65, 0x89, 0x15,
+	0xd1, 0xca, 0x62, 0x70, 0x66, 0x71, 0x76, 0x6a, 0x66, 0x56, 0x1e, 0x06,
+	0xe1, 0xcd, 0x55, 0xd9, 0xa6, 0x19, 0x9c, 0x1a, 0x98, 0x55, 0x66, 0x70,
+	0x87, 0x81, 0xc5, 0x97, 0x17, 0x69, 0x19, 0x65, 0xb7, 0x19, 0xb7, 0x57,
+	0x82, 0x56, 0xe7, 0x37, 0x11, 0xcd, 0x89, 0xd9, 0x89, 0x87, 0x47, 0x81,
+	0x18, 0x96, 0x77, 0x70, 0x65, 0xa5, 0x70, 0x6d, 0xc1, 0xa6, 0x91, 0xe0,
+	0x75, 0x78, 0x18, 0x87, 0x57, 0x37, 0x06, 0xda, 0x91, 0xe0, 0x69, 0x87,
+	0x15, 0x56, 0x15, 0xcd, 0xd2, 0x65, 0xd1, 0xd9, 0x87, 0x81, 0xb7, 0x47,
+	0x66, 0x18, 0x61, 0x18, 0x6d, 0x2d, 0xc6, 0x5c, 0x1c, 0xda, 0x6d, 0xc9,
+	0xc5, 0xde, 0x69, 0xc2, 0x69, 0xe0, 0x78, 0x1c, 0x5c, 0xda, 0x87, 0x06,
+	0x1d, 0xd9, 0x78, 0x27, 0x47, 0x0c, 0x77, 0x69, 0x5e, 0x07, 0x17, 0x29,
+	0xc5, 0x55, 0x99, 0x97, 0x67, 0x81, 0xd5, 0x99, 0xc6, 0x48, 0x61, 0xc5,
+	0xd1, 0x67, 0x17, 0x05, 0xb5, 0xce, 0x65, 0x97, 0x82, 0x72, 0x6d, 0xc5,
+	0xe0, 0x73, 0x85, 0x56, 0x51, 0x95, 0x75, 0x61, 0xd9, 0xc6, 0x61, 0x66,
+	0x55, 0xb7, 0x07, 0x17, 0x06, 0x27, 0x27, 0x07, 0x11, 0xb6, 0xa6, 0xe4,
+	0x77, 0x71, 0x65, 0xc2, 0xc6, 0x5c, 0x5a, 0x6d, 0xa7, 0x26, 0xe7, 0x06,
+	0xb3, 0xc9, 0xc2, 0x6e, 0x75, 0x66, 0x56, 0x1c, 0xa6, 0x9b, 0x69, 0x85,
+	0x91, 0x89, 0xc6, 0x61, 0xa9, 0xd6, 0x1b, 0x6d, 0xe0, 0x98, 0x69, 0xd5,
+	0xc5, 0xc2, 0x68, 0x75, 0x6d, 0xd5, 0xc9, 0xc9, 0xd1, 0x86, 0x25, 0x71,
+	0x59, 0xc1, 0x5c, 0xdc, 0x9d, 0xd1, 0x87, 0x79, 0xc1, 0xc2, 0xe6, 0x76,
+	0xba, 0x56, 0x1c, 0x22, 0x72, 0x74, 0x73, 0x74, 0x9c, 0xda, 0x61, 0xd5,
+	0xc6, 0x78, 0x1c, 0xa7, 0x49, 0xd9, 0x95, 0x56, 0xd8, 0x9a, 0x9b, 0x69,
+	0xb6, 0x26, 0x5c, 0xdb, 0x69, 0xc6, 0x69, 0x58, 0x65, 0xca, 0x71, 0x49,
+	0xc1, 0xa6, 0x9b, 0x71, 0x72, 0x65, 0xc9, 0xc2, 0x1c, 0x27, 0x16, 0xde,
+	0x06, 0x99, 0xb6, 0x66, 0x6e, 0x55, 0x9c, 0x1a, 0x56, 0x67, 0x75, 0x65,
+	0x95, 0x66, 0xf2, 0x56, 0x59, 0x56, 0x71, 0xa5, 0x66, 0x72, 0x56, 0x6c,
+	0x56, 0x5b, 0x56, 0x67, 0x05, 0x65, 0x95, 0x66, 0x65, 0x59, 0x65, 0x59,
+	0xb1, 0x59, 0x65, 0x59, 0x9a, 0x56, 0x59, 0x56, 0x71, 0xe0, 0x56, 0x1c,
+	0x1b, 0x91, 0x86, 0x5b, 0x9c, 0x96, 0xe6, 0xe1, 0xdc, 0xc7, 0x59, 0xa7,
+	0x47, 0x37, 0x81, 0xd6, 0x61, 0xd9, 0xa4, 0x75, 0x9c, 0x18, 0x9d, 0x46,
+	0x67, 0x66, 0x27, 0x39, 0xd5, 0x97, 0x27, 0x56, 0x9a, 0x65, 0xa9, 0xd5,
+	0xa6, 0x11, 0xb7, 0x66, 0x27, 0x59, 0xe0, 0x57, 0x24, 0x74, 0x57, 0x37,
+	0x77, 0x26, 0xb1, 0xe0, 0xbd, 0x33, 0xd3, 0x3d, 0x0c, 0xc6, 0x51, 0xa7,
+	0x49, 0x97, 0x57, 0x26, 0x5e, 0x07, 0x77, 0x69, 0x87, 0x81, 0xc0, 0xbc,
+	0x5c, 0x19, 0x71, 0x69, 0xc6, 0x6a, 0x70, 0x98, 0x6a, 0xe5, 0xd5, 0x87,
+	0x67, 0x09, 0x97, 0x47, 0x0b, 0xc1, 0x1e, 0x07, 0x79, 0xc2, 0x70, 0x72,
+	0x72, 0x72, 0x72, 0xbc, 0x5c, 0xa6, 0x1d, 0x9d, 0x18, 0x69, 0xc5, 0xce,
+	0x74, 0x62, 0xf7, 0x74, 0x95, 0xa7, 0x09, 0x89, 0x1c, 0x15, 0xb5, 0x72,
+	0x56, 0x5a, 0xbd, 0x9a, 0x98, 0x70, 0x6d, 0x87, 0x81, 0xb5, 0x9a, 0x69,
+	0xc5, 0x9b, 0x5a, 0x73, 0x71, 0x58, 0x56, 0x98, 0x9d, 0x9c, 0x5d, 0xc9,
+	0xc1, 0xc2, 0x70, 0x70, 0x98, 0x71, 0x92, 0x6d, 0x96, 0x26, 0x9d, 0xa7,
+	0x16, 0x5e, 0x06, 0x9c, 0xdb, 0x59, 0x87, 0x16, 0xd6, 0xe2, 0x1c, 0x1c,
+	0xe4, 0x75, 0x87, 0x36, 0x9d, 0x15, 0x97, 0x47, 0x46, 0x1b, 0x66, 0x44,
+	0x65, 0x97, 0x07, 0x05, 0x65, 0xc1, 0xa6, 0x25, 0x57, 0x67, 0x06, 0x18,
+	0x86, 0x96, 0x44, 0x62, 0x72, 0x65, 0xd5, 0xc1, 0x51, 0xd1, 0xd1, 0xc1,
+	0xda, 0x62, 0xf1, 0x77, 0x65, 0xd1, 0x1c, 0x91, 0xd5, 0x18, 0x75, 0x67,
+	0x39, 0xcf, 0x09, 0x71, 0x86, 0x5e, 0x07, 0x81, 0x56, 0xf5, 0x89, 0xa5,
+	0x5b, 0xa9, 0xc5, 0xb9, 0xc2, 0x66, 0x6d, 0x87, 0x09, 0xb9, 0x59, 0x65,
+	0xc9, 0xd1, 0x58, 0x66, 0x70, 0x65, 0x86, 0x19, 0xc6, 0x5c, 0x5c, 0x5c,
+	0x59, 0x49, 0xb6, 0xd8, 0x9a, 0x75, 0x75, 0xa6, 0x9a, 0x75, 0x91, 0x67,
+	0x69, 0xc1, 0xd1, 0xb7, 0x59, 0xce, 0xf6, 0x75, 0x75, 0x6d, 0xb9, 0x1c,
+	0xe7, 0x48, 0x66, 0x11, 0x9c, 0x72, 0xe1, 0x73, 0xc7, 0x1c, 0x59, 0x92,
+	0x47, 0x57, 0x19, 0x1a, 0x95, 0xd2, 0x62, 0xd6, 0x55, 0x91, 0xa6, 0xdc,
+	0x1a, 0x9e, 0x0c, 0x73, 0xe1, 0x88, 0xc7, 0x47, 0x83, 0x86, 0x72, 0x96,
+	0x9c, 0xdd, 0x9d, 0x67, 0x29, 0x56, 0xe2, 0x73, 0x9d, 0x9c, 0x26, 0x1b,
+	0x99, 0x9a, 0x65, 0xc6, 0x72, 0x9b, 0x61, 0xc9, 0x5d, 0x1c, 0x55, 0xd5,
+	0xc2, 0x76, 0xa7, 0x26, 0x96, 0xee, 0xe1, 0xda, 0x1d, 0x5c, 0x9d, 0xa7,
+	0x57, 0x28, 0x70, 0x77, 0x61, 0xa7, 0x17, 0x0c, 0xc7, 0x73, 0x32, 0xf5,
+	0xcc, 0x96, 0x57, 0x47, 0x27, 0x82, 0x47, 0x5c, 0x69, 0x9a, 0xb6, 0xca,
+	0x6e, 0x65, 0xbb, 0xd6, 0x66, 0x1e, 0x09, 0xce, 0x6d, 0xa7, 0x17, 0x17,
+	0x16, 0x1c, 0x5c, 0x58, 0xba, 0xbd, 0xa6, 0xe6, 0xda, 0x9b, 0x76, 0x9b,
+	0x9b, 0x72, 0x9b, 0x9b, 0x78, 0x26, 0xe7, 0x59, 0xc2, 0x6e, 0xe6, 0x70,
+	0xb9, 0xb9, 0xb9, 0xb9, 0xb9, 0xbc, 0xdb, 0x9d, 0xd8, 0x6d, 0xda, 0x75,
+	0x92, 0x75, 0x9d, 0x67, 0x16, 0x27, 0x59, 0xd5, 0xc1, 0xc1, 0x97, 0x07,
+	0x07, 0x09, 0xca, 0x77, 0x9d, 0xda, 0x71, 0xb6, 0x70, 0x9d, 0x2c, 0x72,
+	0x47, 0x64, 0xa3, 0x1d, 0xe7, 0x81, 0xe0, 0x77, 0x74, 0xbc, 0x9d, 0xdd,
+	0x27, 0x81, 0xa6, 0x99, 0xa5, 0x77, 0x5b, 0xc5, 0x89, 0x87, 0x81, 0xd1,
+	0xc5, 0xe0, 0x57, 0x0b, 0xc1, 0xc3, 0x13, 0x19, 0xc6, 0x71, 0x93, 0x19,
+	0x65, 0x1a, 0xbd, 0xe2, 0x56, 0x26, 0x1d, 0x5d, 0xa6, 0x59, 0xc6, 0xef,
+	0x29, 0x56, 0xe1, 0x99, 0x96, 0x5c, 0x16, 0x62, 0x78, 0x15, 0x1a, 0x89,
+	0x89, 0x89, 0x82, 0x61, 0x94, 0xbe, 0x06, 0xea, 0x49, 0xe0, 0x74, 0x78,
+	0x27, 0x67, 0x82, 0x61, 0x97, 0x17, 0x08, 0x86, 0x64, 0x69, 0xa9, 0xc9,
+	0x67, 0x56, 0xa7, 0x81, 0xcd, 0x96, 0x99, 0x66, 0x76, 0x9c, 0x91, 0xb6,
+	0x5e, 0x09, 0xda, 0x78, 0x1c, 0xb1, 0xc9, 0xc3, 0x09, 0x19, 0x55, 0x71,
+	0x57, 0x67, 0x59, 0xdd, 0xe0, 0x95, 0xdd, 0xc9, 0xc1, 0xa6, 0x59, 0x73,
+	0x6d, 0x88, 0x70, 0x65, 0x1c, 0x1c, 0x1c, 0x5d, 0xd9, 0x62, 0x69, 0x5c,
+	0xdd, 0x9d, 0xa6, 0x66, 0x5d, 0xdd, 0x1b, 0x57, 0x27, 0x77, 0x69, 0x87,
+	0x67, 0x57, 0x81, 0xb5, 0x71, 0x76, 0x76, 0x61, 0xcd, 0xcd, 0xd5, 0x99,
+	0x96, 0x9a, 0x72, 0x57, 0x5c, 0x1d, 0x31, 0x1d, 0x5a, 0xbd, 0xb3, 0xe0,
+	0x72, 0xc6, 0x59, 0x9a, 0x76, 0x95, 0x89, 0x89, 0x59, 0x59, 0xb6, 0xdd,
+	0x9c, 0xa6, 0x1d, 0xa7, 0x19, 0xb3, 0x3c, 0x5d, 0x73, 0x94, 0xc7, 0x5c,
+	0xf2, 0xc7, 0x46, 0x27, 0x07, 0x39, 0xcd, 0x89, 0xdd, 0xda, 0x72, 0x9a,
+	0x70, 0x49, 0xd5, 0xb6, 0x9c, 0x62, 0x6a, 0xf3, 0x70, 0x71, 0x65, 0xb9,
+	0x87, 0x09, 0x4b, 0xd2, 0x71, 0x73, 0x74, 0xb9, 0x99, 0xb9, 0x54, 0x61,
+	0x66, 0xa6, 0xa6, 0x9a, 0x65, 0x1a, 0x76, 0x9e, 0x05, 0xbd, 0x58, 0x77,
+	0x45, 0x92, 0x6e, 0xe5, 0xb6, 0xa6, 0x16, 0x74, 0x9a, 0x9a, 0xc7, 0x46,
+	0xe7, 0x39, 0x97, 0x77, 0x1c, 0x73, 0xb8, 0x61, 0xd1, 0x94, 0x9c, 0x1d,
+	0x1c, 0x06, 0x6e, 0x9c, 0x25, 0xb1, 0xc5, 0xd5, 0xdd, 0x98, 0x71, 0x95,
+	0x1d, 0x9b, 0x6a, 0x75, 0x98, 0x76, 0x6e, 0x47, 0x17, 0x44, 0x61, 0xc9,
+	0x87, 0x81, 0xdd, 0xdd, 0x85, 0x61, 0xc6, 0x75, 0x71, 0x75, 0x73, 0x73,
+	0x61, 0x85, 0x69, 0x5c, 0x26, 0x98, 0x71, 0x6d, 0xc9, 0xde, 0x1c, 0x5c,
+	0x99, 0x61, 0x5d, 0x9c, 0x5d, 0xd1, 0xdd, 0xb6, 0xaf, 0x69, 0x87, 0x36,
+	0x95, 0x99, 0xc6, 0x75, 0xcb, 0x3e, 0x0b, 0xc9, 0x89, 0xd5, 0xa4, 0x6d,
+	0xc9, 0xdd, 0x66, 0x55, 0xde, 0x6a, 0xe5, 0xaa, 0x94, 0x59, 0xd1, 0xc6,
+	0x6a, 0x59, 0x97, 0x59, 0xa6, 0x5d, 0x9c, 0x67, 0x07, 0x77, 0x07, 0x26,
+	0x1b, 0x9c, 0x91, 0xa9, 0xce, 0x72, 0x70, 0x74, 0x9d, 0x9a, 0x73, 0x75,
+	0x71, 0x57, 0x77, 0x17, 0x07, 0x81, 0xd9, 0xd9, 0xc9, 0xc1, 0xb7, 0x19,
+	0x58, 0xcd, 0x69, 0xb7, 0x46, 0x51, 0xb5, 0x87, 0x29, 0x07, 0x06, 0x09,
+	0x86, 0xa6, 0x1d, 0x85, 0x78, 0x1c, 0x5c, 0x9c, 0xa4, 0x87, 0x56, 0x5c,
+	0x21, 0xd4, 0x76, 0x77, 0x71, 0x69, 0x27, 0x36, 0x5c, 0x9a, 0x69, 0x5c,
+	0x67, 0x81, 0xd5, 0xc5, 0xc9, 0xb4, 0x74, 0x9a, 0x78, 0x15, 0xc6, 0x69,
+	0xb7, 0x77, 0x05, 0x9c, 0x33, 0xda, 0x74, 0x9d, 0x2f, 0x1c, 0xf0, 0xcf,
+	0x79, 0xd9, 0xc1, 0x1c, 0x69, 0xd1, 0xd1, 0x87, 0x67, 0x79, 0x18, 0x9d,
+	0xa7, 0x09, 0xce, 0x70, 0x70, 0x61, 0x96, 0x9c, 0xe7, 0x26, 0x5a, 0x65,
+	0xc5, 0x96, 0x58, 0x9a, 0x71, 0xbc, 0x67, 0x37, 0x74, 0xbc, 0x5b, 0x74,
+	0x65, 0xe0, 0x62, 0x75, 0x8b, 0x89, 0xd9, 0xd1, 0xd5, 0xda, 0x49, 0xe0,
+	0x9d, 0x8b, 0xc6, 0x56, 0x9d, 0x66, 0xa7, 0x82, 0x6d, 0xe0, 0x9b, 0x76,
+	0x86, 0x5c, 0x31, 0x65, 0x74, 0x9b, 0x70, 0x6e, 0xf4, 0x6d, 0xc1, 0xce,
+	0x69, 0xa6, 0x27, 0x17, 0x81, 0x5d, 0xdd, 0x58, 0x98, 0x66, 0x70, 0x75,
+	0x87, 0x81, 0x97, 0x67, 0x16, 0x1e, 0x06, 0xdd, 0x5e, 0x0c, 0xf1, 0xcf,
+	0x17, 0x37, 0x27, 0x37, 0x58, 0x65, 0x18, 0x75, 0x61, 0xd1, 0xe0, 0x91,
+	0x85, 0x62, 0x1b, 0x66, 0x55, 0x65, 0x97, 0x27, 0x81, 0x86, 0x1c, 0x5c,
+	0x26, 0x92, 0x46, 0x5c, 0x5a, 0x72, 0x9c, 0xa7, 0x27, 0x26, 0xdd, 0x86,
+	0x98, 0x57, 0x07, 0x49, 0x87, 0x07, 0x77, 0x56, 0x9e, 0x06, 0x9e, 0x06,
+	0x1c, 0xdb, 0x6d, 0xc1, 0x55, 0x97, 0x07, 0x39, 0xa7, 0x36, 0x98, 0x65,
+	0x18, 0x9c, 0xa7, 0x39, 0xcd, 0xc6, 0xf4, 0x71, 0x57, 0x08, 0xcf, 0x67,
+	0x57, 0x36, 0x59, 0x91, 0xb7, 0x09, 0x97, 0x65, 0x61, 0x18, 0x69, 0x87,
+	0x16, 0xd8, 0x70, 0x9a, 0x85, 0x92, 0xf1, 0x75, 0x98, 0x70, 0x71, 0x73,
+	0x75, 0x75, 0x65, 0xb7, 0x26, 0x9c, 0xa7, 0x49, 0xa6, 0x27, 0x82, 0x76,
+	0xbb, 0x72, 0x74, 0x9c, 0xe9, 0xb4, 0x70, 0x99, 0x72, 0x86, 0x1a, 0x73,
+	0x96, 0x65, 0xcd, 0xcd, 0xcd, 0xb4, 0x70, 0x74, 0x9a, 0x70, 0x92, 0x65,
+	0xde, 0x72, 0x6d, 0xe0, 0x75, 0x72, 0x77, 0x72, 0x65, 0xd9, 0xa7, 0x39,
+	0x59, 0x9a, 0x71, 0x74, 0x55, 0x6e, 0x69, 0xd2, 0x6d, 0xd5, 0xd5, 0xc9,
+	0xd5, 0xc1, 0xd5, 0xd5, 0x97, 0x47, 0x49, 0x59, 0x69, 0xa6, 0xdd, 0x26,
+	0xdc, 0x5c, 0x67, 0x59, 0xb6, 0x9b, 0x61, 0x98, 0x71, 0x9b, 0x61, 0x97,
+	0x57, 0x77, 0x06, 0x19, 0x74, 0x72, 0x74, 0x70, 0x57, 0x77, 0x07, 0x69,
+	0x86, 0x66, 0x27, 0x39, 0xcd, 0xd1, 0xd6, 0x46, 0xdc, 0x98, 0x65, 0xd9,
+	0x96, 0x5d, 0xd8, 0x87, 0x81, 0xb6, 0xa6, 0x9c, 0x18, 0x66, 0x59, 0xd5,
+	0x96, 0x58, 0x66, 0x6e, 0x72, 0x9c, 0x1d, 0xdc, 0x1c, 0xe6, 0x67, 0x26,
+	0xd1, 0xcd, 0xcd, 0xda, 0x70, 0x62, 0x49, 0xc2, 0x57, 0x36, 0x19, 0x95,
+	0xd5, 0x96, 0x98, 0x71, 0x86, 0xda, 0x95, 0xc1, 0x86, 0x5d, 0x25, 0x65,
+	0x96, 0x19, 0x57, 0x79, 0x1d, 0x9d, 0x5c, 0xe2, 0x1b, 0x49, 0x87, 0x18,
+	0x95, 0xd9, 0xc5, 0x86, 0x67, 0x07, 0x65, 0x75, 0x77, 0x60, 0x70, 0x98,
+	0x6a, 0x76, 0x9d, 0xdc, 0x9c, 0xa6, 0x59, 0x69, 0xc9, 0x87, 0x09, 0xb7,
+	0x07, 0x49, 0x5d, 0x98, 0x71, 0x73, 0x76, 0x56, 0xdc, 0xd8, 0x1d, 0x9c,
+	0xda, 0x75, 0x76, 0x72, 0x9c, 0xdd, 0x5d, 0x5a, 0xbd, 0x1c, 0x1d, 0x1d,
+	0x15, 0xc1, 0xe0, 0x75, 0x62, 0x76, 0x65, 0xce, 0x74, 0x77, 0x69, 0xbc,
+	0x48, 0x59, 0xc1, 0xe0, 0x9a, 0x99, 0x33, 0x58, 0x9d, 0x9c, 0x1c, 0x1c,
+	0xd2, 0x73, 0x74, 0x91, 0xc2, 0x76, 0x78, 0x1d, 0x98, 0x6b, 0x87, 0x57,
+	0x67, 0x62, 0x72, 0x99, 0x6d, 0xbc, 0x72, 0x9c, 0xa7, 0x47, 0x81, 0xac,
+	0x69, 0xab, 0x27, 0x17, 0x39, 0x87, 0x37, 0x36, 0x1d, 0x1c, 0x78, 0x6d,
+	0xdd, 0xdc, 0x69, 0xa7, 0x57, 0x17, 0x57, 0x29, 0xa9, 0x5a, 0x74, 0x69,
+	0xc5, 0xc5, 0x97, 0x19, 0x6d, 0x9d, 0x98, 0x92, 0x47, 0x19, 0x19, 0x77,
+	0x65, 0xd9, 0xcd, 0xda, 0x49, 0x24, 0x1d, 0x1c, 0x1d, 0x1d, 0x1d, 0x1d,
+	0x18, 0x78, 0x1d, 0x99, 0x65, 0xb7, 0x67, 0x67, 0x57, 0x57, 0x52, 0x6d,
+	0xd2, 0xf8, 0x26, 0x67, 0x81, 0xc5, 0xd6, 0x71, 0x66, 0x78, 0x24, 0x86,
+	0xa7, 0x81, 0xb8, 0x71, 0x71, 0x78, 0x1e, 0x07, 0x80, 0x89, 0x64, 0x92,
+	0x72, 0x61, 0xc5, 0xe0, 0x77, 0x75, 0x9c, 0x9d, 0x9c, 0x58, 0x70, 0x72,
+	0x76, 0x76, 0x76, 0x27, 0x16, 0xdb, 0x6d, 0xc5, 0xcd, 0xdd, 0x96, 0x5c,
+	0xdd, 0xd8, 0x77, 0x77, 0x70, 0x73, 0x9c, 0x66, 0x24, 0x66, 0x6d, 0xb7,
+	0x37, 0x07, 0x65, 0x77, 0x74, 0x72, 0x72, 0x9d, 0x65, 0x96, 0x52, 0x47,
+	0x29, 0xc2, 0x49, 0xc1, 0xda, 0x48, 0x6e, 0x19, 0x58, 0x88, 0x88, 0x73,
+	0x9e, 0x07, 0x56, 0xe6, 0x5c, 0xe6, 0x66, 0x26, 0x26, 0x07, 0x77, 0x06,
+	0xe4, 0x9d, 0x26, 0xa7, 0x08, 0x95, 0xd9, 0x5d, 0xe6, 0xc9, 0xd1, 0xc6,
+	0x74, 0x70, 0x76, 0x9c, 0x1d, 0x5d, 0x66, 0xdd, 0x1d, 0x67, 0x46, 0x9d,
+	0x5c, 0x67, 0x27, 0x79, 0xc2, 0x46, 0xdc, 0x99, 0x73, 0x75, 0x73, 0x69,
+	0xcd, 0xcd, 0xcd, 0xc1, 0xcd, 0xcd, 0xb9, 0xd1, 0xd1, 0xdd, 0x96, 0xe4,
+	0x9b, 0x9b, 0x9b, 0x26, 0x1c, 0x1d, 0xa1, 0xd6, 0x62, 0x69, 0xd9, 0xb9,
+	0x95, 0x76, 0x94, 0x92, 0x65, 0x96, 0x9e, 0x07, 0x81, 0xe0, 0x1c, 0x1d,
+	0xe6, 0x1c, 0xdc, 0xe5, 0x78, 0x1a, 0x9b, 0x61, 0xa7, 0x59, 0x5d, 0xe7,
+	0x17, 0x77, 0x77, 0x73, 0x39, 0x98, 0x76, 0x9e, 0x00, 0x99, 0x74, 0x78,
+	0x1d, 0x5d, 0x5d, 0xdd, 0xdc, 0x67, 0x81, 0xb6, 0x1e, 0x09, 0xb9, 0x97,
+	0x50, 0x70, 0x76, 0x77, 0x88, 0xe1, 0xd9, 0xa7, 0x09, 0xd6, 0x47, 0x69,
+	0x9b, 0xca, 0x6e, 0x59, 0xb7, 0x51, 0xd5, 0xc1, 0xc1, 0xa7, 0x47, 0x47,
+	0x47, 0x46, 0xdb, 0x74, 0x9d, 0x9b, 0x6d, 0xb6, 0xdb, 0x6d, 0xd5, 0xc9,
+	0xc9, 0xe0, 0x6e, 0x73, 0x9d, 0x99, 0x61, 0xc5, 0xb6, 0x27, 0x81, 0xb9,
+	0x99, 0xb6, 0x1c, 0x5a, 0x71, 0x71, 0x71, 0x61, 0xb6, 0x1b, 0x71, 0x71,
+	0x66, 0x76, 0x98, 0x98, 0x2f, 0x39, 0x1a, 0x73, 0xbb, 0xc5, 0xc6, 0x31,
+	0x31, 0x18, 0xbc, 0xda, 0x46, 0xee, 0xa6, 0x27, 0x80, 0x62, 0x59, 0x66,
+	0x26, 0x5b, 0x5b, 0xc1, 0xe0, 0x70, 0x69, 0xb5, 0x70, 0x56, 0xe7, 0x47,
+	0x0b, 0xd1, 0xc5, 0xc1, 0xc9, 0xbb, 0xa6, 0xdc, 0xda, 0x75, 0x6d, 0x89,
+	0x86, 0x67, 0x3b, 0xc1, 0xcd, 0xa6, 0x19, 0x71, 0x73, 0x65, 0xc5, 0xe0,
+	0x6a, 0xe9, 0xa9, 0xd1, 0x89, 0x89, 0xa9, 0xc3, 0x49, 0xb6, 0x51, 0xa7,
+	0x39, 0x99, 0xce, 0xa4, 0x78, 0x21, 0x87, 0x76, 0x5d, 0xdc, 0xa7, 0x06,
+	0x95, 0xc2, 0x65, 0xb6, 0x51, 0x97, 0x47, 0x45, 0x91, 0xcd, 0x5a, 0x6c,
+	0x72, 0x46, 0x2c, 0x6d, 0xb6, 0x1b, 0x68, 0x6d, 0x18, 0x9c, 0x98, 0x76,
+	0x99, 0x77, 0x69, 0xd5, 0xc9, 0xc1, 0xa6, 0xdb, 0x72, 0x70, 0xbe, 0x05,
+	0x71, 0x71, 0x9c, 0x1a, 0x70, 0x61, 0xd5, 0xc1, 0xc9, 0xc5, 0xb8, 0x75,
+	0x54, 0x71, 0x62, 0x72, 0x55, 0x65, 0xc6, 0x57, 0x2b, 0xcd, 0xa7, 0x26,
+	0xdc, 0xa1, 0x5d, 0xdd, 0xaf, 0x27, 0x47, 0x76, 0x61, 0xb5, 0x6d, 0xe0,
+	0x78, 0x1d, 0x6c, 0xbc, 0x64, 0x2c, 0x9c, 0x24, 0x74, 0x9d, 0xa4, 0x62,
+	0x1e, 0x06, 0x5a, 0x61, 0xdd, 0x96, 0x19, 0x9d, 0xdc, 0x26, 0x1d, 0xdc,
+	0x9a, 0x6e, 0xf2, 0x95, 0x99, 0x87, 0x39, 0xcd, 0xb9, 0xc9, 0xcd, 0xd9,
+	0xd1, 0xdd, 0xcd, 0x86, 0xd9, 0x78, 0x1d, 0x18, 0x66, 0x66, 0xa7, 0x26,
+	0xa4, 0x6d, 0xd2, 0x15, 0xa9, 0xc9, 0xd1, 0xc1, 0xe0, 0x69, 0xc5, 0x87,
+	0x78, 0x65, 0xe0, 0x77, 0x57, 0x37, 0x35, 0x96, 0x73, 0x72, 0x75, 0x61,
+	0x97, 0x37, 0x17, 0x39, 0xb9, 0xa7, 0x67, 0x67, 0x21, 0xcd, 0xc1, 0xc9,
+	0xd9, 0xd9, 0x5d, 0x67, 0x29, 0x87, 0x16, 0x2e, 0x5a, 0x62, 0x69, 0xcd,
+	0xc5, 0x97, 0x82, 0x65, 0x5d, 0x55, 0xc1, 0x86, 0x1b, 0x1a, 0x61, 0x96,
+	0x95, 0xd5, 0xa5, 0x74, 0x75, 0x70, 0x91, 0xc5, 0xb6, 0x1b, 0x70, 0x73,
+	0x56, 0x9d, 0x1b, 0x62, 0x77, 0xc6, 0x71, 0xbc, 0x4b, 0x19, 0x46, 0x9d,
+	0xe7, 0x17, 0x19, 0xa9, 0xdd, 0xa7, 0x19, 0xcd, 0x66, 0xe6, 0x1c, 0x9e,
+	0x06, 0x27, 0x29, 0xc5, 0xd5, 0xc3, 0x1a, 0xc6, 0x71, 0xd4, 0x61, 0xc6,
+	0x66, 0x27, 0x36, 0x52, 0x73, 0x69, 0xa7, 0x36, 0x67, 0x66, 0xd8, 0x74,
+	0x57, 0x07, 0x77, 0x17, 0x81, 0x56, 0x75, 0x69, 0x5c, 0xdd, 0x18, 0x47,
+	0x49, 0xe0, 0x72, 0x9d, 0x59, 0x9b, 0x75, 0x70, 0x69, 0xc2, 0xa7, 0x56,
+	0x5c, 0x9a, 0x76, 0x6d, 0xd5, 0xa7, 0x56, 0xa7, 0x81, 0x8a, 0xa7, 0x07,
+	0x36, 0x69, 0x5c, 0x9e, 0x07, 0x76, 0x98, 0x74, 0x65, 0xa9, 0xc5, 0xd1,
+	0xd5, 0xd9, 0xe0, 0x91, 0xcd, 0xc9, 0xde, 0xe1, 0xd1, 0x97, 0x29, 0x66,
+	0x9d, 0xc6, 0xa4, 0x6d, 0x95, 0x59, 0xcd, 0xc1, 0xc1, 0xdd, 0xc5, 0xc5,
+	0xa9, 0xd9, 0xc2, 0xd7, 0x67, 0x49, 0x86, 0x55, 0x57, 0x19, 0x95, 0x99,
+	0xc2, 0xf6, 0x74, 0x77, 0x70, 0x76, 0x73, 0x96, 0x46, 0x5b, 0x57, 0x18,
+	0x98, 0x74, 0x66, 0x74, 0x70, 0x61, 0x87, 0x36, 0xd9, 0x72, 0x49, 0xc5,
+	0xde, 0x78, 0x07, 0x57, 0x79, 0xc5, 0xc9, 0xe0, 0x72, 0x57, 0x27, 0x59,
+	0x55, 0x86, 0x9c, 0x5d, 0x99, 0x65, 0x97, 0x27, 0x69, 0xb6, 0xdb, 0x73,
+	0x61, 0x27, 0x26, 0x15, 0x99, 0x18, 0x75, 0x75, 0x59, 0xcd, 0xd9, 0xc1,
+	0xc1, 0xd9, 0xa7, 0x81, 0xd5, 0xd9, 0x86, 0x55, 0xd5, 0xd1, 0xc2, 0x56,
+	0xdc, 0x24, 0x71, 0x62, 0xdb, 0xce, 0xf2, 0xbd, 0x2f, 0x46, 0x2e, 0xda,
+	0x49, 0x87, 0x09, 0x1d, 0xa6, 0x58, 0x76, 0xb5, 0xda, 0x18, 0x6d, 0xc5,
+	0xb6, 0x99, 0x9c, 0x59, 0x9a, 0x1a, 0x9c, 0x27, 0x17, 0x29, 0xcd, 0x59,
+	0x75, 0x72, 0x70, 0x71, 0x66, 0x73, 0x61, 0x87, 0x49, 0xdd, 0xd4, 0x9d,
+	0xdc, 0xdb, 0x71, 0x9e, 0x07, 0x38, 0x72, 0x77, 0x62, 0x1d, 0x5b, 0x70,
+	0x9d, 0x5b, 0x72, 0xb2, 0x1a, 0x65, 0xc1, 0x66, 0x11, 0x5b, 0x74, 0x61,
+	0xd1, 0xc9, 0x5c, 0xf1, 0xd3, 0x3c, 0xf3, 0xce, 0xf2, 0xbc, 0xb1, 0xd7,
+	0x1c, 0x71, 0x6c, 0xbd, 0xa7, 0x16, 0x59, 0x74, 0x75, 0x76, 0x9a, 0x98,
+	0xb9, 0x99, 0xbd, 0x1b, 0xc6, 0xe6, 0xef, 0x19, 0xb6, 0x5b, 0x65, 0xc9,
+	0x2a, 0x71, 0x65, 0xa5, 0x9d, 0x9a, 0x9d, 0xe7, 0x55, 0x78, 0x1e, 0x0b,
+	0xc1, 0xd1, 0xc5, 0xca, 0xc7, 0x07, 0x37, 0x0b, 0xd6, 0x78, 0x1e, 0x08,
+	0x71, 0x57, 0x55, 0x71, 0x6d, 0x1a, 0xbc, 0x99, 0xbb, 0xbc, 0x27, 0x5b,
+	0xca, 0xf2, 0x62, 0xf2, 0x69, 0x2f, 0x17, 0x09, 0xd6, 0xee, 0xee, 0xee,
+	0xee, 0xee, 0xee, 0xe6, 0xe6, 0x2e, 0xee, 0xd9, 0x66, 0x59, 0x65, 0x70,
+	0x61, 0x86, 0x9a, 0x76, 0x71, 0x64, 0x69, 0xdd, 0xe0, 0xbc, 0xe7, 0x4b,
+	0xd2, 0x71, 0xb9, 0x6a, 0xa7, 0x81, 0x9b, 0x99, 0xce, 0xf6, 0xc7, 0x78,
+	0x27, 0x56, 0x51, 0xc9, 0xc2, 0xf4, 0xbc, 0x6e, 0x2f, 0x16, 0x6d, 0x6e,
+	0xf5, 0xbb, 0x70, 0x95, 0x99, 0x24, 0x71, 0x61, 0xc2, 0x61, 0xca, 0x61,
+	0xa6, 0x9c, 0x1c, 0x1b, 0x56, 0x1c, 0xdb, 0x57, 0x36, 0xdc, 0x1c, 0x1c,
+	0x95, 0xb7, 0x17, 0x04, 0x75, 0x57, 0x56, 0x9c, 0x99, 0x61, 0x86, 0x5c,
+	0xdd, 0x9c, 0x5c, 0x5a, 0x73, 0x70, 0x70, 0x71, 0xbb, 0x99, 0xbd, 0x5e,
+	0x07, 0x11, 0xc1, 0xd6, 0xf2, 0xbc, 0x1c, 0xdd, 0x5d, 0x65, 0x6d, 0xe0,
+	0x74, 0x6d, 0xb9, 0x5d, 0x18, 0x73, 0x78, 0x1c, 0x1c, 0x1a, 0x87, 0x17,
+	0x09, 0xc5, 0xd5, 0x89, 0x5d, 0x1a, 0x65, 0x95, 0x70, 0x61, 0xa6, 0x99,
+	0x98, 0x74, 0x72, 0x76, 0x72, 0x46, 0x1d, 0x6f, 0x57, 0x06, 0xa5, 0x74,
+	0x95, 0xc5, 0xc1, 0xe0, 0x70, 0x69, 0x21, 0xa7, 0x11, 0x5e, 0x09, 0x88,
+	0x76, 0x92, 0x1d, 0xdb, 0x81, 0xcd, 0xb7, 0x77, 0x56, 0xdd, 0x9d, 0x9b,
+	0x6d, 0xac, 0x56, 0x9c, 0x21, 0x96, 0x11, 0xc9, 0xe0, 0x70, 0xbd, 0xdd,
+	0x5d, 0x5b, 0x57, 0x27, 0x81, 0xb7, 0x36, 0x5b, 0xc5, 0x70, 0x9c, 0x1b,
+	0x65, 0x86, 0x1a, 0x72, 0x46, 0x66, 0x5a, 0x74, 0x70, 0x74, 0x99, 0x70,
+	0x70, 0x70, 0x70, 0x91, 0xc2, 0x6d, 0xb7, 0x17, 0x82, 0xf4, 0x70, 0xbb,
+	0x9c, 0x5b, 0x61, 0xc6, 0xf7, 0x73, 0x9c, 0x15, 0x67, 0x29, 0xc5, 0xd1,
+	0xc2, 0x70, 0x47, 0x67, 0x28, 0x9c, 0x9a, 0x98, 0x6e, 0x75, 0x9e, 0x09,
+	0xe0, 0x9e, 0x02, 0x78, 0x19, 0x46, 0x9d, 0x5e, 0x07, 0x49, 0x5d, 0x1d,
+	0x66, 0x9c, 0x26, 0xa6, 0x9b, 0x62, 0x72, 0x59, 0x89, 0xc9, 0xa7, 0x47,
+	0x57, 0x09, 0xb5, 0x70, 0x9d, 0x59, 0x6a, 0x69, 0x67, 0x65, 0x6d, 0x96,
+	0x5b, 0x78, 0x1b, 0x72, 0x65, 0xa7, 0x09, 0xcd, 0xc2, 0x71, 0x69, 0xc1,
+	0xc5, 0x86, 0x2f, 0x76, 0xa7, 0x36, 0xdc, 0xdc, 0x1c, 0x1d, 0xdb, 0x76,
+	0x72, 0x88, 0x77, 0x72, 0x65, 0x55, 0xb6, 0x2c, 0x9c, 0xe7, 0x39, 0xcc,
+	0xbb, 0xbb, 0xbc, 0x6f, 0x16, 0x67, 0x26, 0x9a, 0x56, 0x6f, 0x2b, 0xc6,
+	0xf3, 0x74, 0x75, 0x9a, 0x9a, 0x99, 0x61, 0x97, 0x81, 0xe0, 0x77, 0x1d,
+	0xdd, 0xde, 0x07, 0x76, 0x5e, 0x06, 0x9a, 0xc7, 0x4b, 0xd5, 0x97, 0x37,
+	0x4a, 0x78, 0x27, 0x2b, 0x27, 0x79, 0xe0, 0xb2, 0x77, 0x1c, 0xe7, 0x39,
+	0xcd, 0xd1, 0xc2, 0xea, 0x75, 0x9d, 0x98, 0x9c, 0xdd, 0xee, 0x9c, 0x24,
+	0x9d, 0x1c, 0x24, 0x72, 0x57, 0x27, 0x27, 0x29, 0x2f, 0x37, 0x27, 0x3b,
+	0xc5, 0xc5, 0xdd, 0xd9, 0xd9, 0xa6, 0x66, 0x15, 0xcd, 0x1e, 0x07, 0x47,
+	0x16, 0x91, 0xdd, 0xa7, 0x17, 0x17, 0x81, 0x95, 0x78, 0x1e, 0x07, 0x47,
+	0x37, 0x81, 0xc9, 0xdd, 0xb6, 0x58, 0x71, 0x87, 0x56, 0x2f, 0x09, 0xde,
+	0x77, 0x9d, 0x4b, 0xc1, 0x94, 0x9c, 0x27, 0x82, 0x78, 0x2f, 0x4b, 0x58,
+	0x9c, 0x2f, 0x27, 0x57, 0x81, 0xe0, 0x78, 0x18, 0x9c, 0xe6, 0x9c, 0x1b,
+	0x66, 0xf0, 0x9b, 0x61, 0xc1, 0xa6, 0xa6, 0xa6, 0xd6, 0x71, 0x6d, 0x6f,
+	0x4b, 0xce, 0x76, 0x61, 0x97, 0x05, 0x57, 0x77, 0x36, 0x1c, 0xdc, 0xb0,
+	0x65, 0x97, 0x07, 0x45, 0x71, 0x71, 0x69, 0x8b, 0xc9, 0xc6, 0x76, 0x9e,
+	0x07, 0x26, 0x6f, 0x56, 0xe5, 0x9e, 0x07, 0x26, 0x1a, 0x73, 0x69, 0xd1,
+	0x94, 0x61, 0xa9, 0xcd, 0xb7, 0x57, 0x57, 0x57, 0x56, 0x5c, 0x9e, 0x07,
+	0x37, 0x47, 0x55, 0x61, 0x96, 0xdd, 0xc5, 0xa6, 0x1c, 0xdb, 0x71, 0x74,
+	0x61, 0x12, 0xf4, 0x70, 0x61, 0x87, 0x26, 0xdd, 0xdc, 0x1d, 0x9c, 0x1c,
+	0x9d, 0x15, 0xc2, 0x56, 0xdd, 0x5c, 0x59, 0xb9, 0x6e, 0xe6, 0x56, 0x98,
+	0x69, 0xc2, 0xe9, 0x96, 0x5d, 0x5e, 0x07, 0x37, 0x75, 0x77, 0x78, 0x1c,
+	0xa4, 0x9c, 0x5c, 0x9d, 0x99, 0x76, 0x61, 0xc9, 0xc6, 0x66, 0x72, 0x77,
+	0x6a, 0x65, 0xdb, 0x06, 0x5d, 0xda, 0x9b, 0x76, 0x65, 0x96, 0x64, 0x62,
+	0x47, 0x56, 0x1c, 0x9b, 0x73, 0x99, 0x71, 0x99, 0x73, 0x6e, 0x19, 0x55,
+	0x56, 0x1c, 0x9d, 0x58, 0x86, 0x5d, 0x98, 0x9b, 0x99, 0x98, 0x9a, 0x6a,
+	0x1b, 0x61, 0xcd, 0x86, 0x59, 0x61, 0xc1, 0x5c, 0x9c, 0x9a, 0x62, 0x46,
+	0xdc, 0x47, 0x29, 0x1c, 0xdb, 0x9d, 0x1e, 0x06, 0x5c, 0xa6, 0xa7, 0x37,
+	0x66, 0x9b, 0x45, 0x9c, 0x1c, 0x67, 0x19, 0x1a, 0x76, 0x73, 0x98, 0x6d,
+	0x5d, 0xe2, 0x46, 0x67, 0x17, 0x69, 0x5a, 0xbd, 0x9a, 0x9a, 0x75, 0x87,
+	0x26, 0x55, 0x5d, 0x18, 0x71, 0x98, 0x61, 0x87, 0x45, 0x9a, 0x6a, 0x18,
+	0x69, 0xc9, 0xca, 0x70, 0x9a, 0x27, 0x07, 0x57, 0x07, 0x07, 0x29, 0x97,
+	0x17, 0x26, 0x1d, 0xa5, 0x95, 0xc2, 0xf0, 0x71, 0x77, 0x70, 0x9c, 0x95,
+	0xd2, 0x68, 0x6d, 0xc2, 0x69, 0xcd, 0xcc, 0x98, 0x56, 0x26, 0x9a, 0x77,
+	0x71, 0x56, 0x5a, 0x70, 0x1c, 0xa7, 0x26, 0xa6, 0xdc, 0x64, 0x95, 0x97,
+	0x69, 0x1e, 0x09, 0x24, 0x57, 0x47, 0x80, 0xbd, 0x2f, 0x48, 0x69, 0xb7,
+	0x27, 0x36, 0x66, 0x61, 0x87, 0x77, 0x77, 0x59, 0xb6, 0xe7, 0x49, 0xce,
+	0x70, 0x69, 0xd9, 0xca, 0x49, 0xcd, 0x5a, 0x9d, 0x1d, 0x5c, 0x26, 0x1a,
+	0x71, 0x61, 0xe0, 0x78, 0x19, 0x57, 0x66, 0x18, 0x9b, 0x6e, 0x6d, 0xc8,
+	0x71, 0x70, 0x6d, 0xc9, 0xd9, 0x5d, 0x9d, 0x1c, 0x98, 0x70, 0x9d, 0x51,
+	0x87, 0x66, 0x66, 0x1d, 0x5d, 0x1d, 0x5c, 0x1c, 0x1c, 0x5c, 0xa7, 0x17,
+	0x17, 0x28, 0x74, 0x72, 0x72, 0x77, 0x69, 0xdd, 0xdd, 0x5d, 0xdd, 0xe7,
+	0x19, 0x87, 0x2a, 0x6d, 0xb6, 0x26, 0xa7, 0x39, 0x1c, 0x9b, 0x78, 0x1d,
+	0xd5, 0xcd, 0xdd, 0x89, 0xa6, 0x5c, 0xde, 0x05, 0x99, 0x69, 0xe0, 0x65,
+	0x86, 0x9a, 0x61, 0xcd, 0x67, 0x06, 0x26, 0xd8, 0x69, 0x98, 0x6e, 0x71,
+	0x75, 0x6d, 0xe0, 0x73, 0x75, 0x61, 0xa7, 0x47, 0x17, 0x16, 0x19, 0xa7,
+	0x47, 0x47, 0x16, 0x67, 0x07, 0x19, 0x1d, 0x1d, 0x52, 0x6d, 0xb9, 0x1d,
+	0xdc, 0x9e, 0x06, 0x5e, 0x06, 0x5d, 0x98, 0x9d, 0x5b, 0x25, 0x9a, 0x69,
+	0xd1, 0xd6, 0x69, 0xc1, 0xc5, 0xca, 0x70, 0x57, 0x08, 0x9c, 0xdd, 0x67,
+	0x16, 0x9a, 0x99, 0x65, 0x87, 0x37, 0x49, 0x92, 0x65, 0x58, 0x76, 0x69,
+	0x58, 0x92, 0x78, 0x27, 0x81, 0xab, 0xce, 0x16, 0x1d, 0xd6, 0x57, 0x76,
+	0x27, 0x46, 0x1c, 0xe6, 0xdb, 0x59, 0x94, 0xc7, 0x82, 0xd7, 0x27, 0x06,
+	0x9b, 0x72, 0x99, 0x69, 0x86, 0x67, 0x16, 0x1b, 0x91, 0xc1, 0xd9, 0xb7,
+	0x47, 0x17, 0x56, 0x99, 0x72, 0x62, 0x71, 0x71, 0x56, 0xd1, 0xa1, 0xc1,
+	0x86, 0x59, 0x57, 0x07, 0x47, 0x46, 0x2f, 0x1b, 0x9b, 0xc2, 0xf0, 0xbc,
+	0x18, 0xbc, 0x5a, 0x46, 0xdd, 0x5c, 0x71, 0xd1, 0xd1, 0x97, 0x67, 0x69,
+	0xd1, 0x18, 0x9c, 0x22, 0x65, 0x89, 0x97, 0x49, 0x99, 0xc1, 0xd1, 0xa7,
+	0x46, 0xa9, 0x8b, 0xab, 0xcf, 0x17, 0x16, 0x76, 0xc3, 0x12, 0xf6, 0xbd,
+	0xa7, 0x3c, 0x69, 0xa5, 0x9d, 0x71, 0x04, 0x9d, 0xdd, 0x9d, 0xe6, 0xa7,
+	0x2b, 0x27, 0x19, 0xda, 0x70, 0x9c, 0x58, 0x9c, 0x19, 0x9c, 0x2f, 0x27,
+	0x3b, 0xde, 0xe1, 0xd6, 0xf1, 0x56, 0x56, 0x75, 0x72, 0x61, 0x27, 0x77,
+	0x66, 0x2f, 0x27, 0x55, 0xbd, 0x1c, 0xe4, 0x6d, 0xca, 0xd7, 0x07, 0x37,
+	0x1b, 0x5d, 0x24, 0x61, 0xc1, 0xab, 0xd5, 0x86, 0x9c, 0x9e, 0x07, 0x27,
+	0x16, 0x95, 0x46, 0x92, 0xf3, 0x67, 0x06, 0xdd, 0xdd, 0xd9, 0x55, 0x57,
+	0x5b, 0xd9, 0x87, 0x26, 0x5b, 0x59, 0x86, 0x1d, 0x58, 0x9c, 0x1b, 0x61,
+	0x8b, 0xb6, 0x9c, 0x93, 0x1d, 0x99, 0x9a, 0x61, 0x65, 0x56, 0x91, 0xb6,
+	0x47, 0x56, 0x1c, 0x5d, 0x5b, 0x56, 0x18, 0x61, 0xcd, 0x85, 0x6a, 0x24,
+	0x62, 0x71, 0x98, 0x6d, 0xc1, 0xc9, 0xa7, 0x05, 0x70, 0x70, 0x98, 0x82,
+	0x9c, 0xa7, 0x17, 0x79, 0xc4, 0x49, 0x19, 0x9c, 0xdd, 0xdd, 0x18, 0x6a,
+	0x71, 0x57, 0x81, 0xc2, 0x18, 0x73, 0x6d, 0xce, 0x62, 0x47, 0x37, 0x42,
+	0x70, 0x6d, 0xcd, 0xca, 0x61, 0x99, 0xa7, 0x17, 0x64, 0x76, 0x6d, 0xa7,
+	0x25, 0x73, 0x72, 0x76, 0x74, 0x98, 0x70, 0x67, 0x07, 0x07, 0x57, 0x67,
+	0x07, 0x19, 0xcd, 0xd1, 0xb6, 0xdd, 0x66, 0xdd, 0x9a, 0x69, 0xd5, 0xd5,
+	0x64, 0x69, 0x1d, 0x1e, 0x07, 0x29, 0xd1, 0xb9, 0x1c, 0xe6, 0xd2, 0x6a,
+	0x27, 0x16, 0xde, 0x05, 0x76, 0x61, 0x97, 0x57, 0x61, 0x1d, 0xd9, 0x6a,
+	0xf2, 0x75, 0x6e, 0x6e, 0x65, 0xa6, 0xe5, 0x77, 0x56, 0xa5, 0x74, 0xc4,
+	0x6e, 0x70, 0x71, 0x47, 0x09, 0xc5, 0xb7, 0x06, 0x27, 0x57, 0x09, 0x65,
+	0x65, 0x55, 0xc9, 0x87, 0x19, 0x89, 0x66, 0x1c, 0x1c, 0x5d, 0x19, 0x70,
+	0x9d, 0xe1, 0xd1, 0xd9, 0xc1, 0xb9, 0xca, 0xea, 0xea, 0x74, 0x77, 0x78,
+	0x08, 0x72, 0x75, 0x9d, 0xe7, 0x3b, 0xc1, 0xd6, 0x57, 0x07, 0x06, 0x27,
+	0x39, 0xc8, 0x9d, 0xa6, 0x65, 0x71, 0x57, 0x79, 0x97, 0x34, 0x61, 0xdd,
+	0x66, 0x5d, 0x5c, 0x5d, 0x66, 0x5b, 0x70, 0x9c, 0x1a, 0x74, 0x71, 0x65,
+	0xca, 0x6e, 0x74, 0x75, 0x65, 0xc1, 0xd1, 0xc5, 0x97, 0x56, 0x22, 0x08,
+	0x71, 0x9c, 0x9c, 0x26, 0x9c, 0xdc, 0x58, 0x65, 0xa9, 0xc9, 0xc9, 0xc8,
+	0x9c, 0x15, 0x89, 0x88, 0x6d, 0xd2, 0x1d, 0xd8, 0x98, 0x9d, 0xdd, 0xa4,
+	0x62, 0x70, 0x75, 0x88, 0x71, 0x6a, 0x75, 0x9c, 0x1c, 0x58, 0x9c, 0x9a,
+	0xc6, 0x1d, 0x1e, 0x07, 0x81, 0xe0, 0x61, 0xa4, 0x9d, 0xd2, 0x61, 0xd1,
+	0xd2, 0x6d, 0xc5, 0xe0, 0x71, 0x9d, 0x67, 0x67, 0x81, 0xa7, 0x17, 0x19,
+	0xc5, 0xd1, 0xca, 0x69, 0x99, 0xd1, 0xcd, 0xd2, 0x70, 0x61, 0xcd, 0xcd,
+	0xce, 0x69, 0xb7, 0x81, 0xa7, 0x47, 0x39, 0xb8, 0x61, 0xb6, 0x5c, 0xdd,
+	0xd8, 0x73, 0x56, 0x9d, 0xdb, 0x6d, 0xb7, 0x29, 0x85, 0x78, 0x24, 0x91,
+	0xa8, 0x71, 0x65, 0xa9, 0xc1, 0xe0, 0x75, 0x91, 0xcd, 0x87, 0x47, 0x17,
+	0x79, 0x96, 0xa4, 0x65, 0x65, 0x77, 0x73, 0x65, 0xc9, 0xb6, 0x26, 0x1c,
+	0x1a, 0x91, 0xcd, 0x86, 0xa2, 0x74, 0x9c, 0xda, 0x76, 0x6d, 0xd5, 0xdd,
+	0x5a, 0x9d, 0x1d, 0x1c, 0x1d, 0x5a, 0x9d, 0x5c, 0x9d, 0xdb, 0x1b, 0x76,
+	0x6d, 0x87, 0x45, 0x57, 0x76, 0x98, 0x65, 0xdd, 0xa9, 0xd1, 0x55, 0x9c,
+	0x59, 0x1c, 0xa6, 0x19, 0xc1, 0xcd, 0xd9, 0xd1, 0x97, 0x69, 0x66, 0xa7,
+	0x19, 0x64, 0x71, 0x6d, 0xd6, 0x77, 0x9c, 0xa7, 0x29, 0xc2, 0x65, 0xd4,
+	0x78, 0x1c, 0x9d, 0x5d, 0xd5, 0x89, 0x96, 0xd8, 0x74, 0x6a, 0x61, 0x55,
+	0xb6, 0x49, 0x13, 0x16, 0x78, 0x1a, 0xa7, 0x55, 0x75, 0x70, 0x74, 0x75,
+	0x61, 0x99, 0x26, 0x16, 0xf3, 0xc6, 0xef, 0x31, 0x87, 0x09, 0xb8, 0x91,
+	0x97, 0x55, 0xb2, 0x77, 0x65, 0xc1, 0xc1, 0xc1, 0x87, 0x47, 0x59, 0xcd,
+	0x96, 0x5c, 0xe2, 0x73, 0x72, 0x72, 0x6d, 0xb6, 0xe4, 0x6a, 0x76, 0x55,
+	0x65, 0xcd, 0xd1, 0x67, 0x77, 0x09, 0xc2, 0x75, 0x73, 0x9d, 0x9b, 0x69,
+	0xcd, 0xce, 0x71, 0x77, 0x31, 0xc9, 0xda, 0x65, 0xa7, 0x17, 0x78, 0x77,
+	0x6d, 0xb7, 0x79, 0xda, 0x76, 0x76, 0x98, 0x24, 0x71, 0x9e, 0x07, 0x27,
+	0x27, 0x67, 0x6b, 0x25, 0x98, 0x72, 0x62, 0xed, 0xa7, 0x17, 0x17, 0x16,
+	0x1b, 0x61, 0xb7, 0x17, 0x16, 0x5c, 0x5b, 0x69, 0xa6, 0xe4, 0x71, 0x69,
+	0xa9, 0x29, 0xd9, 0x99, 0xdd, 0xd9, 0xc9, 0xd2, 0x6a, 0x68, 0x75, 0x6a,
+	0x72, 0x78, 0x26, 0x9e, 0x07, 0x46, 0x9c, 0xe7, 0x46, 0xd6, 0xe1, 0xb8,
+	0x76, 0x71, 0x91, 0x89, 0x24, 0x66, 0x49, 0x66, 0xdc, 0x9c, 0x9a, 0x91,
+	0xe0, 0x91, 0xe0, 0x91, 0xc1, 0xb7, 0x37, 0x37, 0x36, 0x64, 0x70, 0x92,
+	0x46, 0x62, 0xcc, 0x72, 0x9a, 0x1d, 0x26, 0x5d, 0x66, 0xdd, 0x18, 0x65,
+	0xde, 0x69, 0xd9, 0xb6, 0x19, 0x6d, 0x96, 0xdc, 0x1b, 0x65, 0xa6, 0xdc,
+	0x26, 0x99, 0x62, 0x72, 0x70, 0x77, 0x77, 0x66, 0x49, 0xa7, 0x07, 0x46,
+	0x66, 0x9d, 0xd5, 0xc5, 0xc5, 0xb6, 0x1c, 0x1d, 0x6e, 0x59, 0x66, 0x76,
+	0x66, 0x78, 0x18, 0x56, 0xd6, 0x15, 0xc6, 0x1d, 0x5d, 0x67, 0x66, 0xe7,
+	0x79, 0x92, 0xf4, 0x74, 0x84, 0x75, 0x74, 0x78, 0x27, 0x29, 0x59, 0x69,
+	0xe0, 0x55, 0x49, 0xb7, 0x06, 0x1e, 0x07, 0x81, 0xa9, 0xa9, 0xe0, 0x59,
+	0xc2, 0x70, 0x60, 0x76, 0x99, 0x75, 0x9d, 0x9c, 0x15, 0xb7, 0x67, 0x66,
+	0x5d, 0x9a, 0x55, 0x47, 0x57, 0x28, 0x9c, 0x1d, 0xdd, 0x66, 0xdc, 0x27,
+	0x17, 0x07, 0x31, 0xce, 0x74, 0x61, 0xe0, 0x6d, 0xdd, 0xa7, 0x66, 0x24,
+	0x6d, 0x61, 0xc9, 0x89, 0x89, 0xb8, 0x99, 0x96, 0x62, 0x61, 0xc9, 0x87,
+	0x3b, 0xcd, 0x96, 0xdd, 0x91, 0x24, 0x69, 0x86, 0xd5, 0x1a, 0x65, 0xd5,
+	0x87, 0x25, 0x99, 0x6e, 0x69, 0xc5, 0x87, 0x81, 0xc1, 0xa7, 0x66, 0x98,
+	0x71, 0x66, 0x72, 0x6d, 0x87, 0x06, 0xdd, 0x66, 0xee, 0xe7, 0x76, 0x5e,
+	0x0b, 0xc9, 0xce, 0x75, 0x75, 0xbd, 0x1d, 0x64, 0x61, 0xc5, 0xd6, 0xe6,
+	0x6a, 0x46, 0x9a, 0x91, 0x64, 0x71, 0x9c, 0xa7, 0x16, 0x66, 0x9a, 0x92,
+	0x75, 0x9c, 0x9c, 0x5c, 0x67, 0x48, 0x72, 0x74, 0x6a, 0x72, 0x71, 0x59,
+	0x1e, 0x06, 0xdd, 0x1d, 0x96, 0x66, 0x1b, 0x56, 0x18, 0x61, 0x5b, 0x92,
+	0x19, 0x65, 0xe0, 0x59, 0x18, 0x6d, 0xe0, 0x75, 0x61, 0xd5, 0xc9, 0xa9,
+	0x55, 0x59, 0x74, 0x85, 0x9c, 0x9d, 0x99, 0x68, 0x72, 0x75, 0x6d, 0xda,
+	0x57, 0x07, 0x57, 0x31, 0xa7, 0x17, 0x67, 0x26, 0x19, 0x59, 0x65, 0x57,
+	0x47, 0x06, 0xa6, 0x1c, 0xa6, 0x1c, 0xa6, 0x18, 0x91, 0xc1, 0x89, 0xd5,
+	0xa6, 0xe4, 0x9d, 0x84, 0x74, 0x77, 0x69, 0xda, 0x59, 0x64, 0x65, 0xdd,
+	0xc1, 0xb6, 0x27, 0x65, 0x74, 0x6a, 0x61, 0x86, 0xa6, 0x19, 0x9c, 0x9d,
+	0x9c, 0x9d, 0x9b, 0x69, 0x85, 0x91, 0x85, 0x57, 0x57, 0x26, 0x1a, 0x5b,
+	0xc9, 0xa9, 0x1a, 0x9a, 0x71, 0x56, 0x5c, 0x5c, 0x18, 0x69, 0x5c, 0x9d,
+	0x55, 0xcd, 0xc1, 0xa6, 0xe2, 0x46, 0xa6, 0xa5, 0x71, 0x6d, 0xd1, 0xb6,
+	0xe7, 0x16, 0x91, 0xa7, 0x27, 0x39, 0x5c, 0x24, 0x77, 0x73, 0x69, 0xc1,
+	0x1e, 0x05, 0x9a, 0x9c, 0x1c, 0x9c, 0x5b, 0x75, 0x99, 0x6d, 0xc1, 0xc5,
+	0xc1, 0x58, 0x75, 0x6d, 0xdd, 0xde, 0x56, 0x5d, 0xdb, 0x9c, 0xdc, 0x6f,
+	0x44, 0x61, 0xa8, 0x74, 0x78, 0x1d, 0x27, 0x79, 0xde, 0x77, 0x66, 0x24,
+	0x92, 0x70, 0x6d, 0xb9, 0x87, 0x67, 0x77, 0x69, 0xa7, 0x81, 0x86, 0x99,
+	0x72, 0x9c, 0x1a, 0x6e, 0x65, 0x97, 0x05, 0x54, 0x9c, 0x16, 0x56, 0xda,
+	0x6d, 0x55, 0x53, 0x1c, 0x31, 0xac, 0x62, 0xf6, 0xe1, 0xd1, 0xa7, 0x81,
+	0xc5, 0xe0, 0x73, 0xb2, 0x61, 0x86, 0xe6, 0xe6, 0xe6, 0xe1, 0xb7, 0x39,
+	0xcd, 0xc2, 0x6e, 0x70, 0x65, 0xc5, 0xd1, 0xd2, 0xc7, 0x39, 0xce, 0x75,
+	0x66, 0x73, 0x73, 0x74, 0x78, 0x24, 0x54, 0x71, 0x6d, 0x84, 0x74, 0x55,
+	0x70, 0x65, 0x86, 0x19, 0x49, 0xc1, 0xd2, 0x73, 0x75, 0x76, 0x9c, 0xe7,
+	0x37, 0x39, 0xa7, 0x47, 0x4b, 0x15, 0xab, 0xb7, 0x67, 0x07, 0x81, 0xaa,
+	0x72, 0x91, 0xb1, 0xb7, 0x6c, 0xf3, 0x78, 0x0b, 0xd1, 0xa7, 0x4b, 0xa7,
+	0x0b, 0x84, 0x78, 0x1d, 0x9d, 0xdc, 0x1d, 0xa5, 0x9d, 0x18, 0x6b, 0x1d,
+	0xdd, 0x9d, 0x89, 0xda, 0x66, 0x57, 0x77, 0x09, 0xd1, 0x86, 0x5a, 0x9c,
+	0xe6, 0xe7, 0x28, 0x96, 0xf3, 0x76, 0x76, 0x19, 0x73, 0xbd, 0x5b, 0x72,
+	0x87, 0x76, 0x9d, 0x9d, 0x9a, 0x9d, 0x1c, 0x27, 0x27, 0x67, 0x67, 0x6c,
+	0x76, 0x74, 0x77, 0x9d, 0xa7, 0x07, 0x77, 0x2b, 0xb7, 0x66, 0x1e, 0x07,
+	0x81, 0xde, 0x70, 0x6a, 0x48, 0x82, 0x1c, 0x9d, 0x1a, 0x78, 0x1e, 0x07,
+	0x81, 0xe0, 0x6d, 0xb7, 0x81, 0xd1, 0x87, 0x81, 0xe0, 0xbd, 0xd8, 0x6d,
+	0xd1, 0xd1, 0xe0, 0x70, 0x9c, 0x24, 0x62, 0xf2, 0x69, 0xc5, 0xc5, 0xc5,
+	0x86, 0xd8, 0x6d, 0xc5, 0xc5, 0x97, 0x16, 0xda, 0x69, 0xb7, 0x81, 0xc5,
+	0xa5, 0x78, 0x1e, 0x07, 0x46, 0xde, 0x07, 0x81, 0x87, 0x27, 0x81, 0xd9,
+	0xd5, 0xa7, 0x57, 0x59, 0xc5, 0xc5, 0xcd, 0xde, 0x59, 0x48, 0x6a, 0x6d,
+	0xd5, 0xd1, 0xd1, 0xd1, 0xcd, 0xb4, 0x73, 0x61, 0xd5, 0xdd, 0x97, 0x37,
+	0x06, 0x96, 0x49, 0x1c, 0x9b, 0x91, 0xd1, 0x87, 0x29, 0x1d, 0x9d, 0x5a,
+	0x75, 0x75, 0x91, 0xc2, 0x73, 0x65, 0xe0, 0x69, 0xe0, 0x74, 0x87, 0x47,
+	0x37, 0x06, 0xdd, 0xdc, 0xdc, 0xd9, 0x73, 0x96, 0x51, 0xd5, 0xd5, 0xd5,
+	0xd5, 0xd5, 0xc5, 0xd5, 0xd9, 0xd5, 0xd5, 0x99, 0xc1, 0xc1, 0xde, 0xc6,
+	0x66, 0x6f, 0x79, 0xc6, 0x43, 0x3d, 0x27, 0x47, 0x1a, 0x78, 0x26, 0x2e,
+	0x1a, 0x77, 0x19, 0x99, 0x70, 0x9d, 0x22, 0xc4, 0x61, 0x85, 0x58, 0x6d,
+	0xc9, 0x97, 0x31, 0xce, 0x46, 0x18, 0x9c, 0x5b, 0x61, 0xa9, 0xca, 0x61,
+	0x9b, 0x87, 0x77, 0x46, 0x59, 0x61, 0x87, 0x26, 0x26, 0xdb, 0x76, 0x61,
+	0x89, 0xb6, 0xe1, 0x55, 0xd9, 0xa7, 0x47, 0x57, 0x16, 0x29, 0xdd, 0x64,
+	0x74, 0x69, 0x96, 0x5d, 0xd8, 0x9a, 0x69, 0x5a, 0x69, 0xc9, 0xca, 0x60,
+	0x61, 0xe0, 0x72, 0x76, 0x91, 0x99, 0xc6, 0x56, 0x27, 0x76, 0xdd, 0x67,
+	0x7b, 0x99, 0xd6, 0x61, 0xdd, 0xd5, 0xe0, 0x73, 0x75, 0xba, 0x77, 0xbd,
+	0x99, 0x95, 0x87, 0x69, 0xc2, 0x73, 0x75, 0x6a, 0x46, 0xe6, 0xae, 0x95,
+	0xa9, 0xd5, 0xe0, 0x70, 0x9a, 0x6a, 0x6d, 0xca, 0x6d, 0xb1, 0xb7, 0x66,
+	0xdc, 0xdd, 0x1c, 0x18, 0x6a, 0x62, 0x62, 0x19, 0x78, 0x1a, 0x76, 0x1b,
+	0x9d, 0x58, 0x9c, 0x9d, 0xda, 0x70, 0x9d, 0x66, 0x21, 0x86, 0xa1, 0x66,
+	0xe7, 0x37, 0x36, 0x5d, 0x1c, 0x1d, 0xdd, 0x1c, 0x2e, 0xdd, 0x8b, 0x5d,
+	0x5c, 0x9c, 0x5d, 0x5c, 0x5c, 0xa5, 0x6d, 0xb9, 0xd6, 0x74, 0x9c, 0xa6,
+	0x1c, 0xe6, 0x9c, 0xae, 0x5c, 0x9c, 0x9a, 0x75, 0x6e, 0x70, 0x9d, 0xe6,
+	0x58, 0x9e, 0x06, 0x9c, 0x5c, 0x5c, 0x58, 0x6d, 0x86, 0xdc, 0x5c, 0x59,
+	0x71, 0x6e, 0x1c, 0xae, 0x1a, 0x78, 0x1d, 0x1b, 0x73, 0x73, 0x9c, 0x5d,
+	0x5a, 0x74, 0x99, 0x99, 0x1c, 0x1c, 0x1b, 0x76, 0x70, 0x72, 0x58, 0x99,
+	0x78, 0x1b, 0x99, 0x77, 0x61, 0xca, 0xe6, 0x1d, 0x5a, 0x75, 0x75, 0x9c,
+	0x1c, 0x5c, 0xe1, 0x97, 0x07, 0x36, 0x5d, 0xdc, 0x5a, 0x57, 0x77, 0x77,
+	0x26, 0xdd, 0xdd, 0x58, 0x72, 0x77, 0x77, 0x75, 0x69, 0xd5, 0xd5, 0xdd,
+	0xc2, 0x46, 0x5e, 0x09, 0x24, 0x24, 0x76, 0x95, 0xd9, 0xd5, 0xc5, 0xd5,
+	0xd6, 0x72, 0x6a, 0x49, 0xc9, 0xb9, 0x97, 0x4b, 0x9b, 0x97, 0x80, 0xbc,
+	0xa7, 0x79, 0xd1, 0xd4, 0x77, 0x61, 0xd9, 0xc8, 0x69, 0xd5, 0x86, 0x1a,
+	0x66, 0x72, 0x65, 0x89, 0xce, 0x70, 0x71, 0x99, 0x91, 0xc6, 0x47, 0x17,
+	0x07, 0x19, 0xd6, 0xc5, 0x98, 0x74, 0xb1, 0x88, 0x61, 0xd2, 0x19, 0x76,
+	0x75, 0x54, 0x76, 0x9d, 0x9d, 0xe4, 0x69, 0xa7, 0x25, 0x71, 0x69, 0x96,
+	0x18, 0x65, 0xc5, 0xc9, 0x89, 0xcd, 0xa6, 0x59, 0x5a, 0x74, 0x98, 0x72,
+	0x6e, 0x76, 0x9d, 0x9e, 0x06, 0xdb, 0x9c, 0x1c, 0x25, 0x78, 0x1d, 0x31,
+	0xcf, 0x13, 0x1d, 0x67, 0x33, 0x1d, 0x19, 0x46, 0xa7, 0x08, 0x96, 0x73,
+	0x9b, 0x65, 0xa9, 0xc1, 0xde, 0x49, 0x15, 0x86, 0x5b, 0xba, 0x15, 0x26,
+	0x66, 0x46, 0x19, 0x65, 0x5a, 0x9b, 0x72, 0x9b, 0x99, 0x66, 0x70, 0x6d,
+	0xda, 0x6e, 0x47, 0x05, 0x65, 0xc2, 0xe1, 0x22, 0x74, 0x65, 0xcd, 0xd5,
+	0xd5, 0xc9, 0xc1, 0xa7, 0x39, 0x85, 0x95, 0xd5, 0xa9, 0xc9, 0xb6, 0xdc,
+	0xa6, 0x1c, 0x1c, 0x55, 0xd1, 0xc6, 0x65, 0x96, 0xa6, 0x16, 0x75, 0x69,
+	0x5d, 0x99, 0x9d, 0x9c, 0xde, 0x09, 0x1c, 0x1c, 0xdc, 0x59, 0x9d, 0x51,
+	0xe0, 0x78, 0x1d, 0xdd, 0xdb, 0x75, 0x65, 0xc9, 0x87, 0x06, 0x95, 0x51,
+	0x5c, 0x1d, 0x5a, 0xbc, 0x1a, 0xbc, 0x26, 0x19, 0x61, 0xd1, 0x5c, 0x9d,
+	0xe1, 0xb6, 0xdd, 0x5d, 0xa6, 0xd8, 0x72, 0x9e, 0x07, 0x79, 0x58, 0x9a,
+	0x91, 0xcd, 0xd5, 0xce, 0x6a, 0x61, 0x97, 0x46, 0xd6, 0x18, 0x74, 0x77,
+	0x46, 0x92, 0x27, 0x36, 0x9d, 0x1c, 0xdc, 0x18, 0x74, 0x9c, 0xd5, 0xdd,
+	0xe0, 0x72, 0x95, 0xd9, 0x96, 0x9d, 0x5c, 0x95, 0xc9, 0x5a, 0x61, 0xe0,
+	0x66, 0x73, 0x62, 0x62, 0x47, 0x17, 0x35, 0x66, 0x6d, 0xd6, 0x65, 0xd1,
+	0xd9, 0xa7, 0x07, 0x47, 0x07, 0x79, 0x1c, 0x1c, 0x07, 0x47, 0x81, 0xe0,
+	0x73, 0xce, 0x33, 0xb5, 0x9c, 0xe7, 0x49, 0xc1, 0xce, 0x71, 0x77, 0x57,
+	0x52, 0x57, 0x46, 0x18, 0x72, 0x89, 0xb5, 0x72, 0x6b, 0x18, 0x56, 0x1c,
+	0x64, 0x70, 0x9c, 0x64, 0x9d, 0x5b, 0xcf, 0x4c, 0xf2, 0x57, 0x29, 0xa8,
+	0x76, 0x78, 0x1a, 0x78, 0x1d, 0xd8, 0x70, 0x69, 0xdd, 0xb9, 0xcd, 0xc9,
+	0xa9, 0xce, 0x21, 0x86, 0xe7, 0x26, 0x9d, 0x24, 0x98, 0x72, 0x55, 0x6d,
+	0xc1, 0xb7, 0x56, 0x1c, 0xdc, 0xda, 0x9c, 0x95, 0x67, 0x79, 0xb2, 0x77,
+	0x72, 0x72, 0x72, 0x95, 0xc5, 0xd5, 0xe0, 0x73, 0x77, 0x76, 0x65, 0xc2,
+	0xf0, 0x98, 0x74, 0x98, 0x70, 0x6e, 0x76, 0xbd, 0xaf, 0x27, 0x47, 0x81,
+	0xc9, 0x51, 0xcd, 0xd1, 0x99, 0xd1, 0x1d, 0xde, 0x07, 0x06, 0x1c, 0x1b,
+	0x9b, 0x45, 0x61, 0xdd, 0xdd, 0x58, 0x66, 0x24, 0x59, 0xd9, 0xcd, 0xc2,
+	0xc7, 0x46, 0x98, 0x95, 0x5c, 0x9c, 0xdb, 0x72, 0x65, 0xc1, 0x96, 0x95,
+	0x18, 0x59, 0x87, 0x65, 0x9a, 0x78, 0x19, 0x70, 0x59, 0x97, 0x17, 0x17,
+	0x06, 0xdc, 0x55, 0x84, 0x61, 0xc1, 0x87, 0x76, 0x9b, 0x76, 0x72, 0x69,
+	0xd1, 0xdd, 0xdd, 0x97, 0x46, 0xde, 0x06, 0x5c, 0x9e, 0x06, 0x5a, 0x9d,
+	0xdc, 0xdc, 0x1c, 0xd5, 0x97, 0x77, 0x76, 0x1c, 0x5c, 0x5d, 0xe4, 0x74,
+	0x47, 0x46, 0xda, 0x78, 0x15, 0xdd, 0xd9, 0xb1, 0xcd, 0x87, 0x59, 0xc1,
+	0xbc, 0x57, 0x81, 0x59, 0x78, 0x1c, 0x26, 0x2e, 0xb1, 0xcb, 0x1c, 0x71,
+	0xd3, 0x1d, 0x31, 0xd3, 0x39, 0xbd, 0x1c, 0x11, 0xd6, 0xe6, 0x70, 0x96,
+	0x62, 0x65, 0xa9, 0xb9, 0xb5, 0xbc, 0x25, 0x9a, 0x6a, 0x74, 0x61, 0x96,
+	0x9c, 0xe6, 0xd6, 0x74, 0x70, 0x9d, 0x1d, 0x5b, 0x49, 0xd1, 0xb7, 0x77,
+	0x77, 0x82, 0xe1, 0xc9, 0xcd, 0xd9, 0xc1, 0xd5, 0x96, 0xd9, 0x65, 0x99,
+	0xcd, 0x87, 0x81, 0x96, 0x59, 0x6e, 0x46, 0x64, 0x9d, 0x9c, 0x1d, 0x9c,
+	0x5c, 0x1d, 0x99, 0x9d, 0x24, 0x77, 0xba, 0x59, 0x1d, 0x9d, 0xa5, 0x87,
+	0x57, 0x76, 0x1d, 0x1b, 0x6d, 0x19, 0x77, 0x1c, 0x18, 0x19, 0x72, 0x6e,
+	0x65, 0x87, 0x29, 0x1c, 0x18, 0x61, 0x5c, 0x15, 0x89, 0x1c, 0xdc, 0x5c,
+	0xda, 0x92, 0x46, 0x5d, 0x61, 0x96, 0x9e, 0x07, 0x3c, 0x61, 0xb7, 0x07,
+	0x81, 0x96, 0xde, 0x07, 0x81, 0x86, 0xde, 0x01, 0xd5, 0xd9, 0xd5, 0x97,
+	0x17, 0x07, 0x27, 0x16, 0xdc, 0x18, 0x67, 0x11, 0xa7, 0x17, 0x29, 0x89,
+	0x5b, 0x99, 0x72, 0xbd, 0x98, 0x73, 0xb1, 0xce, 0xc9, 0xb5, 0x78, 0x24,
+	0x70, 0x61, 0x85, 0x76, 0x54, 0x62, 0x47, 0x66, 0x98, 0x91, 0xd9, 0xde,
+	0x71, 0x92, 0x6d, 0xc2, 0x1c, 0x59, 0x99, 0x57, 0x67, 0x76, 0xd9, 0x65,
+	0xd9, 0x1d, 0x99, 0x6e, 0x70, 0x61, 0xb6, 0xa6, 0x1c, 0x1d, 0x1b, 0x71,
+	0x69, 0xde, 0x45, 0xc5, 0x65, 0xcd, 0xa6, 0x5d, 0x9d, 0x1d, 0xd6, 0x47,
+	0x57, 0x77, 0x29, 0x5c, 0x58, 0x86, 0x66, 0x98, 0x56, 0x95, 0x1a, 0x70,
+	0x74, 0x98, 0x98, 0x95, 0xc5, 0xc5, 0x1d, 0x9c, 0x5c, 0xa5, 0x73, 0x1a,
+	0x60, 0x95, 0x97, 0x12, 0x71, 0xbd, 0xdc, 0x62, 0x57, 0x46, 0x18, 0x46,
+	0x1c, 0xef, 0x36, 0x5d, 0xa6, 0x26, 0xda, 0x70, 0x56, 0x9d, 0x1d, 0x5a,
+	0x69, 0xb7, 0x27, 0x35, 0x78, 0x1c, 0x5c, 0xdc, 0x1e, 0x07, 0x17, 0x81,
+	0xa7, 0x07, 0x47, 0x49, 0xa7, 0x19, 0xc6, 0x68, 0xc6, 0x1c, 0x1e, 0x07,
+	0x67, 0x57, 0x69, 0xc1, 0xcd, 0xb6, 0xee, 0xef, 0x27, 0x17, 0x57, 0x15,
+	0x49, 0xda, 0x66, 0x73, 0x72, 0x9a, 0x9d, 0xb1, 0x89, 0x0b, 0xd6, 0x1d,
+	0x64, 0x9c, 0x26, 0xa5, 0x9c, 0x64, 0x76, 0x77, 0x66, 0x47, 0x1b, 0xd1,
+	0x5d, 0x26, 0x9c, 0x1b, 0x9a, 0xbd, 0x66, 0xd9, 0x66, 0x66, 0x2f, 0x57,
+	0x47, 0x59, 0xd1, 0xb6, 0xd8, 0x65, 0xd9, 0xd9, 0xd9, 0xcd, 0xc1, 0xd9,
+	0xd9, 0xd9, 0xc1, 0xd8, 0x65, 0xc9, 0xce, 0x78, 0x1c, 0xde, 0x09, 0xc5,
+	0xd5, 0xdd, 0xc9, 0xc2, 0x47, 0x81, 0x86, 0x25, 0x61, 0x85, 0x75, 0x74,
+	0x73, 0x72, 0x87, 0x25, 0x59, 0xda, 0x70, 0x9a, 0x91, 0xd1, 0xdd, 0xde,
+	0xe6, 0x95, 0xd2, 0x1b, 0x62, 0x63, 0x31, 0xdd, 0x58, 0x9c, 0x1e, 0x07,
+	0x46, 0x19, 0x6d, 0xa5, 0x62, 0x24, 0x74, 0x72, 0x61, 0xc9, 0xde, 0xc7,
+	0x05, 0x75, 0x16, 0xf0, 0x61, 0xde, 0x70, 0x72, 0x71, 0x9a, 0xb1, 0xab,
+	0xc1, 0xc5, 0x1c, 0xa7, 0x67, 0x67, 0x36, 0x2e, 0x58, 0x61, 0xd9, 0x99,
+	0x95, 0x89, 0x87, 0x82, 0xe6, 0x4c, 0x6a, 0x73, 0x2e, 0x9a, 0x99, 0x71,
+	0x74, 0x70, 0x95, 0xd9, 0xb6, 0xe6, 0x67, 0x81, 0x86, 0x1e, 0x07, 0x82,
+	0xcb, 0xa7, 0x37, 0x37, 0x37, 0x17, 0x17, 0x37, 0x37, 0x57, 0x59, 0xcd,
+	0xb9, 0x89, 0xc9, 0x96, 0x1c, 0x5b, 0x62, 0x9b, 0x88, 0x61, 0xc5, 0xa9,
+	0xe0, 0x71, 0x78, 0x1c, 0xe9, 0x87, 0x17, 0x27, 0x09, 0xb7, 0x46, 0x9b,
+	0x65, 0x96, 0x59, 0x65, 0x97, 0x06, 0x1d, 0x5c, 0x62, 0xc9, 0xc5, 0xcd,
+	0xde, 0x70, 0x9c, 0x07, 0x37, 0x37, 0x37, 0x49, 0xb9, 0x89, 0x89, 0xb7,
+	0x81, 0x66, 0xe7, 0x79, 0x87, 0x47, 0x47, 0x4b, 0xa7, 0x49, 0x5b, 0x6e,
+	0x69, 0xdd, 0xde, 0x62, 0x66, 0x6a, 0x65, 0xa8, 0x72, 0x77, 0x9b, 0x78,
+	0x1a, 0x59, 0x87, 0x27, 0x66, 0xe5, 0x9c, 0x5c, 0xdb, 0x99, 0x56, 0x66,
+	0x5d, 0x5c, 0x5c, 0x5d, 0x5c, 0x91, 0xd6, 0x1c, 0xa6, 0x5e, 0x06, 0x66,
+	0x1c, 0xdc, 0xe6, 0x19, 0x71, 0x98, 0x92, 0x61, 0xce, 0xea, 0x70, 0x9c,
+	0x1c, 0xe4, 0x87, 0x49, 0xb9, 0xb7, 0x46, 0xdb, 0x9a, 0x99, 0x6e, 0x6c,
+	0x62, 0x70, 0x61, 0xc5, 0xc5, 0xc5, 0xc5, 0xb7, 0x17, 0x37, 0x39, 0x1b,
+	0x98, 0x9a, 0x65, 0x87, 0x16, 0xd8, 0x9b, 0x6e, 0x69, 0xe0, 0x61, 0xc5,
+	0xa5, 0x69, 0xc1, 0xdd, 0xc5, 0xa5, 0x77, 0x77, 0x74, 0x6d, 0xdd, 0xdd,
+	0xcd, 0xb7, 0x55, 0x66, 0x70, 0x75, 0x71, 0x71, 0x75, 0x72, 0x47, 0x57,
+	0x82, 0x76, 0x76, 0x71, 0x9d, 0xa6, 0xe6, 0xe6, 0xc7, 0x09, 0x65, 0x71,
+	0x77, 0x77, 0x8b, 0x98, 0x6a, 0x62, 0x72, 0x9b, 0xb9, 0x59, 0xb7, 0x17,
+	0x69, 0x96, 0xdc, 0x1a, 0x98, 0x61, 0x87, 0x81, 0xa7, 0x17, 0x65, 0xb3,
+	0x1a, 0xc6, 0xb1, 0xa2, 0xe5, 0x94, 0x69, 0xd2, 0x15, 0xd2, 0xe2, 0x74,
+	0x57, 0x47, 0x75, 0x46, 0x9c, 0x9d, 0x5d, 0x5d, 0x47, 0x56, 0x51, 0xa7,
+	0x77, 0x37, 0x57, 0x37, 0x79, 0xcd, 0xbb, 0xd2, 0x70, 0x70, 0x9c, 0x65,
+	0xb9, 0x61, 0xb7, 0x19, 0xcd, 0xc5, 0xc6, 0x62, 0x61, 0xc9, 0x9b, 0xb7,
+	0x1b, 0xc9, 0xd5, 0xdd, 0x89, 0xce, 0xf2, 0x77, 0x66, 0x56, 0x9e, 0x04,
+	0x95, 0x9a, 0x45, 0x47, 0x82, 0x73, 0x56, 0x95, 0xe0, 0xb2, 0x56, 0x9c,
+	0xdb, 0x73, 0x72, 0x65, 0x85, 0x56, 0x25, 0x65, 0xdd, 0x87, 0x39, 0xd9,
+	0x97, 0x67, 0x17, 0x59, 0xb6, 0x5e, 0x09, 0x1d, 0x58, 0x6a, 0x6d, 0xa8,
+	0x55, 0x65, 0x1b, 0x75, 0x56, 0x18, 0x61, 0xe0, 0x9b, 0x5b, 0xc1, 0xd5,
+	0xd1, 0x89, 0x26, 0x5c, 0xa5, 0x68, 0x99, 0x62, 0x70, 0x71, 0x9a, 0x77,
+	0x1b, 0x6d, 0xb6, 0xda, 0x69, 0xdd, 0x99, 0xde, 0x65, 0xc5, 0xa9, 0xb6,
+	0xda, 0xb8, 0x70, 0x70, 0x9a, 0x75, 0x61, 0xca, 0x78, 0x24, 0x9c, 0x27,
+	0x09, 0x96, 0x9b, 0x88, 0x87, 0x81, 0x99, 0xd5, 0xc5, 0xd5, 0xc5, 0xd2,
+	0x6a, 0x75, 0x6d, 0x1c, 0x1e, 0x09, 0x95, 0x74, 0x74, 0x72, 0x61, 0xa9,
+	0xc9, 0xa7, 0x55, 0x59, 0xc6, 0x61, 0xe0, 0x91, 0xca, 0x65, 0xcd, 0xce,
+	0x45, 0x70, 0x56, 0x26, 0x19, 0x46, 0xd1, 0x86, 0x67, 0x16, 0x9c, 0x9c,
+	0x15, 0xd1, 0xdd, 0xc9, 0x87, 0x17, 0x66, 0x9d, 0xd5, 0x59, 0x71, 0x9c,
+	0x96, 0xed, 0xc1, 0x99, 0x18, 0x65, 0x86, 0x1b, 0x69, 0x99, 0xa4, 0x9c,
+	0xdc, 0x9d, 0x87, 0x57, 0x82, 0x76, 0x6f, 0x1c, 0xdd, 0x26, 0x65, 0x65,
+	0xda, 0x57, 0x26, 0x1a, 0x76, 0x91, 0xb9, 0xa9, 0xd2, 0xcb, 0x2c, 0x2e,
+	0x2e, 0x32, 0xc4, 0xc7, 0x81, 0x31, 0x9b, 0xc1, 0xce, 0x27, 0x39, 0x97,
+	0x82, 0x62, 0x46, 0xa7, 0x49, 0xd1, 0xa9, 0xdd, 0x55, 0x99, 0xa9, 0xc6,
+	0xe1, 0x86, 0x12, 0xed, 0x52, 0x73, 0x74, 0x65, 0xce, 0x77, 0x57, 0x82,
+	0x72, 0x9c, 0xa7, 0x22, 0x72, 0x9c, 0xa7, 0x1c, 0x77, 0x4c, 0xc9, 0xcd,
+	0xc9, 0xce, 0x71, 0x9c, 0x66, 0xa2, 0x71, 0x6a, 0x66, 0x99, 0x62, 0xf2,
+	0x59, 0xcd, 0xc1, 0x9b, 0xd5, 0xc1, 0x66, 0x9b, 0xbc, 0xaa, 0x72, 0x9d,
+	0xa7, 0x69, 0xd9, 0xdd, 0xc1, 0x5c, 0xa4, 0x91, 0xdd, 0xa9, 0x1a, 0x77,
+	0xb0, 0x56, 0xa7, 0x66, 0x1c, 0xaf, 0x5b, 0xc5, 0xb9, 0x21, 0xc9, 0xc9,
+	0xd2, 0xf7, 0x47, 0x81, 0xc1, 0x96, 0xd9, 0x61, 0xda, 0xf0, 0xc4, 0x65,
+	0x97, 0x82, 0x69, 0x5c, 0x5c, 0x5a, 0x61, 0xd5, 0xc6, 0x62, 0x1c, 0x99,
+	0x78, 0x1b, 0x57, 0x17, 0x0b, 0x85, 0x65, 0x87, 0x65, 0x69, 0x98, 0x75,
+	0x65, 0x18, 0x75, 0x9b, 0x9c, 0xf1, 0x27, 0x45, 0x70, 0x77, 0x9d, 0x1c,
+	0x9d, 0x98, 0x91, 0xa9, 0xcd, 0xe0, 0x75, 0x4c, 0x47, 0x63, 0x11, 0xc9,
+	0xc5, 0xcd, 0xc9, 0xc1, 0xe0, 0x9c, 0x1b, 0x6d, 0xe0, 0xb5, 0x97, 0x59,
+	0x66, 0xe7, 0x65, 0x9b, 0x70, 0x9d, 0xdd, 0x5d, 0x5c, 0x9d, 0x5d, 0x5b,
+	0x75, 0x77, 0x77, 0x9a, 0x6e, 0x66, 0x71, 0x65, 0x87, 0x16, 0xd8, 0x76,
+	0x6e, 0x24, 0x61, 0xc6, 0x62, 0x60, 0x73, 0x73, 0x73, 0x73, 0x91, 0xd6,
+	0x72, 0x74, 0x69, 0xd2, 0x49, 0xd5, 0xc2, 0x75, 0x87, 0x58, 0x75, 0x75,
+	0x66, 0x71, 0x74, 0x91, 0xa6, 0x1e, 0x09, 0xa7, 0x2b, 0xd5, 0x88, 0x74,
+	0x70, 0x9d, 0xdd, 0x1a, 0x6d, 0x96, 0x59, 0x65, 0x96, 0x58, 0x94, 0x72,
+	0x71, 0x75, 0x75, 0x99, 0x99, 0x07, 0x77, 0x47, 0x07, 0x77, 0x56, 0x1c,
+	0x9d, 0xdd, 0xa6, 0x66, 0x67, 0x19, 0xc5, 0x99, 0x89, 0xca, 0x18, 0x76,
+	0x76, 0x9d, 0xdd, 0x67, 0x29, 0x86, 0xe6, 0xd9, 0x89, 0x1a, 0x78, 0x27,
+	0x23, 0x12, 0x6c, 0x87, 0x76, 0xa4, 0x78, 0x1c, 0xe7, 0x4b, 0xa8, 0x78,
+	0x27, 0x36, 0x9e, 0x07, 0x49, 0x27, 0x37, 0x36, 0xa7, 0x17, 0x76, 0x9d,
+	0xa6, 0x27, 0x74, 0x9c, 0x66, 0x9b, 0x6d, 0x65, 0x65, 0x58, 0x57, 0x06,
+	0xd8, 0x65, 0xdc, 0x57, 0x56, 0xdb, 0x61, 0x5c, 0x91, 0x86, 0xd9, 0x69,
+	0xb6, 0x58, 0x65, 0xc5, 0xc5, 0x8a, 0x76, 0x76, 0x76, 0x72, 0x65, 0xa5,
+	0x73, 0x57, 0x46, 0xec, 0x61, 0xa6, 0xa6, 0x9d, 0x5d, 0x5d, 0x5b, 0xb9,
+	0xbd, 0x71, 0xbb, 0xa6, 0x26, 0x27, 0x66, 0xd6, 0xa9, 0xcd, 0x99, 0x1a,
+	0x59, 0xa8, 0x98, 0x65, 0x96, 0x24, 0x56, 0xd2, 0x65, 0x64, 0x4a, 0x47,
+	0x09, 0x5b, 0x6d, 0xda, 0xf8, 0x27, 0x16, 0x5c, 0x9d, 0xdc, 0x95, 0x84,
+	0x6d, 0xde, 0x70, 0x65, 0x87, 0x05, 0x6e, 0x73, 0x49, 0xc9, 0xb6, 0x5c,
+	0xdd, 0x5b, 0x6d, 0xde, 0x72, 0x75, 0x69, 0xe0, 0x9c, 0xa7, 0x47, 0x06,
+	0x9a, 0x78, 0x2f, 0x81, 0xd7, 0x18, 0x69, 0x5e, 0x07, 0x35, 0x71, 0x48,
+	0x71, 0x72, 0xbc, 0x5b, 0x71, 0x70, 0x78, 0x1a, 0x9c, 0x9c, 0x9c, 0xdb,
+	0x70, 0x62, 0x70, 0x99, 0x65, 0xd5, 0x55, 0x96, 0xdb, 0x59, 0x87, 0x27,
+	0x49, 0x97, 0x06, 0x91, 0xcd, 0x66, 0x5b, 0x59, 0xc9, 0x97, 0x17, 0x58,
+	0x6d, 0xd0, 0x49, 0xc1, 0xc5, 0xd6, 0x11, 0xdd, 0xde, 0x1a, 0x9c, 0xa7,
+	0x16, 0x9e, 0x05, 0x9c, 0x25, 0x57, 0x57, 0x09, 0xde, 0x69, 0xd9, 0x58,
+	0x98, 0x95, 0xc5, 0xd1, 0x87, 0x76, 0xa1, 0x87, 0x39, 0x19, 0x70, 0x75,
+	0x95, 0xb9, 0xa7, 0x66, 0x5b, 0x98, 0x47, 0x07, 0x29, 0x97, 0x77, 0x27,
+	0x37, 0x04, 0x9c, 0x9c, 0x67, 0x38, 0x9c, 0xdc, 0xe7, 0x36, 0xaf, 0x66,
+	0xad, 0x69, 0x99, 0xa9, 0x89, 0x1d, 0x5c, 0x26, 0x9c, 0x6d, 0xb5, 0xa7,
+	0x38, 0x9c, 0x27, 0x65, 0x9d, 0x1c, 0x5d, 0x9d, 0xe7, 0x07, 0x77, 0x29,
+	0xd2, 0x71, 0x54, 0x9c, 0x1d, 0xa7, 0x07, 0x19, 0xce, 0x65, 0xc2, 0x19,
+	0x99, 0x65, 0x67, 0x16, 0x31, 0x86, 0xdb, 0x9d, 0xdb, 0x62, 0x61, 0xd2,
+	0x73, 0x71, 0x65, 0x86, 0xa6, 0x9d, 0xa5, 0x69, 0xd9, 0xa7, 0x27, 0x06,
+	0x58, 0x55, 0x61, 0xd1, 0x97, 0x16, 0x26, 0xa6, 0x99, 0x9d, 0xdd, 0x5d,
+	0x26, 0x99, 0x9b, 0x95, 0xd5, 0xa7, 0x26, 0xda, 0x6e, 0xf2, 0x70, 0x77,
+	0x9a, 0x9b, 0x69, 0xc9, 0xc5, 0xce, 0x70, 0x75, 0x9c, 0xe7, 0x69, 0xc9,
+	0xc1, 0xc6, 0x1c, 0x9c, 0x9c, 0x19, 0x55, 0x87, 0x59, 0x97, 0x46, 0x67,
+	0x77, 0x09, 0x96, 0x1a, 0x61, 0xd1, 0xcd, 0xcd, 0x87, 0x27, 0x56, 0x9d,
+	0x95, 0x59, 0x76, 0x70, 0x70, 0x72, 0x65, 0xc9, 0x87, 0x67, 0x36, 0x1d,
+	0x9b, 0x76, 0xbb, 0x9c, 0xdc, 0xa7, 0x17, 0x31, 0x5d, 0x9d, 0x58, 0x63,
+	0x18, 0x9e, 0x07, 0x67, 0x47, 0x46, 0xb1, 0x66, 0x19, 0x65, 0xc6, 0x67,
+	0x1d, 0x1a, 0x75, 0x95, 0xda, 0x47, 0x27, 0x2c, 0x66, 0x73, 0xce, 0xaa,
+	0x1b, 0x6e, 0xea, 0x75, 0x76, 0x65, 0x98, 0x6a, 0x75, 0x69, 0xe0, 0x78,
+	0x1e, 0x07, 0x81, 0xc9, 0xca, 0x71, 0x99, 0x9c, 0x1d, 0x5c, 0x5c, 0x9c,
+	0x5d, 0xdc, 0xaf, 0x82, 0x68, 0xbd, 0xda, 0x65, 0xb7, 0x37, 0x37, 0x69,
+	0x1b, 0x6e, 0xcb, 0xa9, 0x97, 0x66, 0x64, 0x9b, 0x73, 0x73, 0x73, 0x73,
+	0x6d, 0xcd, 0xcd, 0xd5, 0xd6, 0xd6, 0xdd, 0x67, 0x66, 0x58, 0x71, 0x6d,
+	0x89, 0x86, 0x26, 0x1c, 0x27, 0x76, 0x5c, 0x66, 0x26, 0x07, 0x37, 0x17,
+	0x37, 0x39, 0x1d, 0x6d, 0x73, 0x69, 0xda, 0x49, 0xb7, 0x0b, 0xe0, 0x87,
+	0x58, 0x75, 0x75, 0x9c, 0x66, 0x66, 0xe6, 0x1a, 0xb6, 0x59, 0xc1, 0xcd,
+	0xb6, 0x25, 0x74, 0x70, 0x9c, 0x5d, 0x9a, 0x6d, 0x96, 0x59, 0x65, 0x96,
+	0x58, 0x99, 0x1c, 0x9c, 0x66, 0x5d, 0x66, 0xe6, 0xc1, 0xdd, 0xd1, 0xc1,
+	0xdd, 0xd5, 0x87, 0x27, 0x77, 0x69, 0xb9, 0xb9, 0x65, 0x66, 0x62, 0xe6,
+	0x18, 0x76, 0x76, 0xbe, 0x07, 0x59, 0xca, 0x61, 0xb9, 0xb6, 0x62, 0x46,
+	0x9e, 0x09, 0xc8, 0xbe, 0x09, 0xb3, 0x07, 0x17, 0x2b, 0xc1, 0xd1, 0xc9,
+	0x9b, 0xc9, 0x64, 0x65, 0x66, 0xa6, 0x1c, 0x5c, 0x26, 0x1b, 0x6a, 0x27,
+	0x06, 0x27, 0x09, 0xd1, 0x99, 0xd2, 0x70, 0x9a, 0x9c, 0xe7, 0x37, 0x37,
+	0x81, 0xa7, 0x17, 0x17, 0x37, 0x6a, 0x85, 0x77, 0x11, 0x19, 0x70, 0x6d,
+	0x5c, 0x92, 0x61, 0xd1, 0xcd, 0xd9, 0x5a, 0x74, 0x6d, 0xd5, 0x89, 0xe0,
+	0x75, 0x65, 0xdd, 0xcd, 0x64, 0x56, 0xe4, 0x6d, 0xa7, 0x77, 0x79, 0xb5,
+	0x74, 0x66, 0xf1, 0x9c, 0xdc, 0x19, 0x55, 0x78, 0x1a, 0x65, 0x96, 0x6f,
+	0x26, 0x5d, 0x1b, 0x65, 0x87, 0x77, 0x76, 0x26, 0x19, 0x98, 0x6d, 0x5d,
+	0xd8, 0x74, 0xbd, 0x19, 0xc6, 0x5d, 0x9c, 0x98, 0xab, 0xab, 0xe0, 0x56,
+	0x1c, 0xa6, 0x9c, 0xe6, 0x18, 0x75, 0x6a, 0x69, 0x89, 0xc1, 0xc1, 0xe0,
+	0x75, 0x90, 0x44, 0x70, 0x98, 0x49, 0xcd, 0xd2, 0x74, 0x6d, 0x96, 0x9d,
+	0x96, 0x74, 0x9b, 0x70, 0x70, 0x9b, 0x9c, 0x9c, 0x19, 0x77, 0x73, 0x72,
+	0x73, 0x91, 0xc5, 0x89, 0xc9, 0xe0, 0x71, 0x72, 0x71, 0x78, 0x1b, 0x65,
+	0x95, 0x91, 0xdd, 0x86, 0x1d, 0x1b, 0x5b, 0xe0, 0x9d, 0x95, 0x94, 0x9a,
+	0x6a, 0x71, 0x75, 0x74, 0x78, 0x27, 0x5b, 0xde, 0xe1, 0xcd, 0xc4, 0x87,
+	0x76, 0x9a, 0x57, 0x47, 0x59, 0x1d, 0x19, 0x76, 0x65, 0x55, 0xc5, 0x87,
+	0x57, 0x49, 0x86, 0x59, 0x9e, 0x07, 0x1b, 0xb6, 0x5c, 0x24, 0x6d, 0xc5,
+	0x89, 0xa9, 0xb7, 0x79, 0x1d, 0xa6, 0x1d, 0x5c, 0x26, 0x26, 0x26, 0x1d,
+	0x1c, 0x47, 0x79, 0x5d, 0x1d, 0xdd, 0xd9, 0x9d, 0x27, 0x09, 0x99, 0xd2,
+	0x1a, 0x73, 0x11, 0x1c, 0x61, 0xd1, 0x52, 0x46, 0x98, 0x9d, 0x1a, 0x70,
+	0x70, 0x70, 0x69, 0x19, 0x72, 0x70, 0x65, 0x86, 0x55, 0x5a, 0x59, 0xc9,
+	0x5a, 0x76, 0x65, 0xa9, 0x87, 0x07, 0x66, 0x61, 0x27, 0x47, 0x37, 0x61,
+	0xcd, 0xda, 0x69, 0xc9, 0xe0, 0x72, 0x57, 0x27, 0x57, 0x75, 0xba, 0x72,
+	0x72, 0x76, 0x57, 0x81, 0xa8, 0x61, 0x19, 0x6a, 0xc6, 0xaf, 0x07, 0x59,
+	0x5c, 0x99, 0x74, 0x71, 0x56, 0x55, 0xd9, 0x86, 0x55, 0x87, 0x27, 0x47,
+	0x06, 0xdd, 0x9c, 0x55, 0xc1, 0xdd, 0xb6, 0x26, 0x1c, 0x5c, 0xa7, 0x45,
+	0x75, 0x78, 0x2e, 0xe7, 0x47, 0x16, 0x9c, 0x9d, 0x26, 0x98, 0x76, 0x77,
+	0x47, 0x47, 0x06, 0xdd, 0xdc, 0x66, 0x64, 0x77, 0x77, 0x65, 0xc2, 0x6d,
+	0xda, 0x6c, 0x65, 0xdd, 0xa7, 0x06, 0x5d, 0x1a, 0x69, 0xa6, 0x1d, 0x1b,
+	0x5b, 0x86, 0x71, 0x1e, 0x0b, 0x27, 0x16, 0x5b, 0x71, 0x73, 0x61, 0xc9,
+	0xe0, 0x18, 0x69, 0x59, 0x65, 0x26, 0xdd, 0x66, 0xe6, 0x15, 0xa9, 0x5b,
+	0x91, 0xc5, 0xcd, 0x18, 0x69, 0xb6, 0x58, 0x9c, 0x16, 0x73, 0x73, 0x72,
+	0x74, 0x70, 0x69, 0xc8, 0x47, 0x09, 0x66, 0xae, 0x61, 0xa7, 0x59, 0xa9,
+	0xc1, 0xcd, 0xce, 0x56, 0xa4, 0x61, 0xc1, 0x87, 0x81, 0xc5, 0x58, 0x92,
+	0x47, 0x46, 0x58, 0x70, 0x1a, 0x72, 0x65, 0xd1, 0x95, 0x9a, 0x73, 0x69,
+	0x84, 0x71, 0x75, 0x71, 0x72, 0x86, 0xdc, 0x98, 0x75, 0x6a, 0xf2, 0x82,
+	0xf2, 0x97, 0x3a, 0x71, 0x75, 0x75, 0x88, 0xb5, 0xde, 0xf0, 0xbc, 0x55,
+	0x6f, 0x17, 0x17, 0x82, 0x75, 0x9c, 0x9b, 0x65, 0x96, 0x59, 0x77, 0x9a,
+	0x72, 0x47, 0x07, 0x07, 0x07, 0x07, 0x07, 0x09, 0xc2, 0x52, 0x56, 0xdc,
+	0xdc, 0xd6, 0x1e, 0x07, 0x59, 0x1d, 0x99, 0x91, 0xa9, 0x2e, 0x66, 0xdc,
+	0x07, 0x27, 0x36, 0x51, 0xcd, 0xcd, 0x99, 0x24, 0xbc, 0xe2, 0x24, 0x9c,
+	0x9e, 0x07, 0x67, 0x57, 0x59, 0xcd, 0x96, 0x64, 0x9d, 0x98, 0x77, 0x9d,
+	0x1c, 0x1c, 0xe2, 0x59, 0x96, 0x6e, 0x9d, 0x9c, 0x66, 0xd5, 0x9e, 0x1c,
+	0x91, 0xdd, 0xc9, 0xc5, 0xdd, 0xda, 0x70, 0x9c, 0x1d, 0x9c, 0x07, 0x57,
+	0x4b, 0xae, 0x1c, 0x9d, 0x19, 0x9c, 0xa7, 0x2b, 0xb9, 0xce, 0x27, 0x79,
+	0x95, 0x71, 0x71, 0x71, 0x71, 0x9d, 0x5d, 0xa5, 0xbc, 0x1b, 0x71, 0xbb,
+	0xba, 0x91, 0x97, 0x06, 0x9d, 0x5d, 0xa7, 0x80, 0x9e, 0x09, 0xd2, 0x78,
+	0x27, 0x27, 0x17, 0x37, 0x29, 0xe0, 0x65, 0x97, 0x82, 0x78, 0x18, 0x76,
+	0x9e, 0x07, 0x07, 0x39, 0xa9, 0xce, 0x76, 0x66, 0x47, 0x46, 0x99, 0x74,
+	0x73, 0x9d, 0xa7, 0x67, 0x27, 0x01, 0xd5, 0xe0, 0x9d, 0x98, 0x73, 0x73,
+	0x73, 0x73, 0x73, 0x73, 0x73, 0x70, 0x1c, 0xdc, 0xd9, 0x47, 0x57, 0x56,
+	0xe7, 0x59, 0xd6, 0x68, 0xbd, 0x26, 0xae, 0xe7, 0x69, 0x1d, 0x9d, 0xc9,
+	0x24, 0x9b, 0x78, 0x1d, 0xd2, 0x77, 0x57, 0x16, 0x5c, 0x5a, 0x65, 0xcd,
+	0xd2, 0x71, 0x72, 0x95, 0xb6, 0x6e, 0x96, 0x72, 0x71, 0x69, 0x18, 0x9c,
+	0x95, 0xc1, 0x86, 0x58, 0x9c, 0x1d, 0x19, 0x61, 0x2f, 0x49, 0xca, 0x49,
+	0x1b, 0xbc, 0x9b, 0x70, 0x73, 0x56, 0x6f, 0x44, 0x61, 0xd1, 0x97, 0x69,
+	0x87, 0x37, 0x07, 0x07, 0x06, 0xe6, 0x9b, 0x92, 0x65, 0x5d, 0x26, 0x67,
+	0x04, 0x74, 0x6a, 0x1d, 0xdc, 0xdd, 0x1c, 0xd8, 0x62, 0x47, 0x36, 0x99,
+	0x65, 0x1a, 0x56, 0x9a, 0x71, 0x69, 0x99, 0x96, 0xdd, 0x58, 0x69, 0xab,
+	0x58, 0xd6, 0xdb, 0xb6, 0x72, 0x66, 0x71, 0x74, 0x76, 0x61, 0xa9, 0x85,
+	0x6e, 0x72, 0x66, 0x57, 0x67, 0x61, 0xc2, 0x6d, 0xc5, 0x87, 0x55, 0x74,
+	0x49, 0xa6, 0x09, 0xc5, 0x85, 0x95, 0x66, 0x18, 0x98, 0x9c, 0x9d, 0x16,
+	0x70, 0x74, 0x9b, 0x61, 0x97, 0x57, 0x69, 0x5d, 0x1e, 0x09, 0x86, 0x1c,
+	0x9c, 0x1c, 0x1c, 0x27, 0x27, 0x16, 0x9c, 0xdb, 0x63, 0x3a, 0x77, 0x99,
+	0x61, 0xd5, 0xd1, 0x64, 0x61, 0xd9, 0x19, 0x72, 0x72, 0x75, 0x70, 0x91,
+	0xb7, 0x56, 0xd9, 0x95, 0xe0, 0x65, 0xc6, 0x1a, 0x57, 0x06, 0x5c, 0x18,
+	0x69, 0xa6, 0x59, 0x61, 0xde, 0x6a, 0x72, 0x65, 0xb7, 0x24, 0x9c, 0x15,
+	0xd0, 0x91, 0x58, 0x9a, 0x9a, 0x73, 0x95, 0xc5, 0xd9, 0xcd, 0xdd, 0x88,
+	0x6d, 0xe0, 0x72, 0x69, 0x5a, 0x70, 0x70, 0x61, 0x97, 0x49, 0x1b, 0x71,
+	0x69, 0x5d, 0xae, 0x16, 0x70, 0x6a, 0x09, 0x87, 0x82, 0x56, 0xdd, 0xdd,
+	0xdd, 0xd8, 0x9a, 0x70, 0x71, 0x65, 0x97, 0x75, 0x9a, 0x99, 0x87, 0x07,
+	0x77, 0x47, 0x76, 0x5c, 0xa7, 0x81, 0xc5, 0xd9, 0x97, 0x17, 0x82, 0x62,
+	0xf6, 0xb1, 0xd5, 0xd0, 0x86, 0x59, 0x92, 0x47, 0x67, 0x79, 0xa7, 0x46,
+	0x67, 0x07, 0x47, 0x69, 0x5d, 0xd5, 0xb9, 0x97, 0x27, 0x46, 0x59, 0x49,
+	0x65, 0x99, 0x75, 0x70, 0x9c, 0xa6, 0x27, 0x07, 0x06, 0x67, 0x27, 0x81,
+	0x67, 0x27, 0x49, 0xc5, 0xd5, 0x99, 0x97, 0x16, 0x27, 0x16, 0xde, 0x09,
+	0x67, 0x09, 0xc2, 0x6a, 0x27, 0x47, 0x82, 0x72, 0x9a, 0x84, 0x78, 0x27,
+	0x69, 0x27, 0x67, 0x29, 0xa9, 0x86, 0x66, 0x65, 0x73, 0x99, 0x66, 0x74,
+	0x45, 0x66, 0x73, 0x57, 0x69, 0xb9, 0xd1, 0xe0, 0x91, 0x87, 0x07, 0x75,
+	0x57, 0x49, 0xd5, 0xb7, 0x47, 0x56, 0xdc, 0xd8, 0x59, 0xca, 0x72, 0x62,
+	0x75, 0x73, 0x6a, 0x47, 0x46, 0x9c, 0x9c, 0x27, 0x56, 0x18, 0x49, 0xd5,
+	0xde, 0x65, 0x89, 0xc9, 0xa7, 0x06, 0x19, 0x77, 0x56, 0x9a, 0x69, 0x59,
+	0x9c, 0x44, 0x72, 0x6d, 0xd9, 0xdd, 0x55, 0xd5, 0x66, 0x5c, 0xdd, 0xd8,
+	0x74, 0x76, 0x6d, 0x86, 0x55, 0xa7, 0x81, 0x5d, 0x1d, 0x27, 0x19, 0xab,
+	0xd5, 0xd5, 0xd9, 0xcd, 0xd1, 0x55, 0x55, 0xd9, 0x71, 0x99, 0xc1, 0xe0,
+	0x24, 0x74, 0x97, 0x11, 0xb4, 0xa7, 0x17, 0x39, 0x15, 0x5d, 0x55, 0x87,
+	0x69, 0x18, 0x75, 0x77, 0x76, 0x9c, 0x99, 0x78, 0x26, 0x66, 0x5c, 0xd9,
+	0x71, 0x9a, 0x56, 0x1d, 0x1d, 0x18, 0x73, 0x76, 0x9b, 0x72, 0x73, 0x47,
+	0x56, 0xdc, 0x9c, 0x9a, 0x56, 0x15, 0xc4, 0x74, 0x95, 0x86, 0x9d, 0x1e,
+	0x09, 0xa9, 0xd9, 0x84, 0x70, 0x75, 0x75, 0x74, 0x61, 0x85, 0x9c, 0x9c,
+	0x5c, 0x11, 0x87, 0x27, 0x66, 0xda, 0x74, 0x9c, 0x5c, 0x1c, 0x2e, 0xa7,
+	0x0c, 0xeb, 0x0c, 0x72, 0xc7, 0x0c, 0xea, 0x75, 0x6d, 0x1c, 0x5e, 0x07,
+	0x81, 0xe0, 0x78, 0x1e, 0x07, 0x81, 0xe0, 0xbc, 0xdc, 0x59, 0x9d, 0x5a,
+	0x62, 0x73, 0x6d, 0x66, 0x5a, 0x9c, 0xa6, 0xd9, 0x56, 0xd9, 0xbc, 0x1d,
+	0x1c, 0x9b, 0x69, 0xa5, 0x59, 0xd5, 0x67, 0x17, 0x47, 0x07, 0x0c, 0x62,
+	0x74, 0x2f, 0x56, 0xa5, 0x95, 0xd1, 0xd5, 0xda, 0xf1, 0xa9, 0x49, 0x18,
+	0x9a, 0x92, 0xe9, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xc9, 0xd5, 0xd4,
+	0x75, 0x62, 0x9c, 0x65, 0x9b, 0x78, 0x16, 0x78, 0x1d, 0x5d, 0x59, 0x84,
+	0x77, 0x71, 0x70, 0x71, 0x99, 0x89, 0xc6, 0xf5, 0x9a, 0x9a, 0xbd, 0x26,
+	0x1e, 0x07, 0x17, 0x77, 0x27, 0x67, 0x66, 0x9e, 0x09, 0xa9, 0x89, 0xa7,
+	0x32, 0x69, 0x87, 0x49, 0x5d, 0x26, 0x1d, 0x1c, 0x27, 0x39, 0xa6, 0x9d,
+	0xda, 0x77, 0x77, 0x77, 0x75, 0x77, 0x73, 0x1d, 0xd8, 0x75, 0x78, 0x27,
+	0x06, 0xe6, 0xa6, 0xa6, 0xa6, 0x9d, 0x9d, 0x9c, 0x9c, 0xa2, 0x21, 0xb6,
+	0xe1, 0xdd, 0xb9, 0xca, 0xe2, 0xe1, 0xc1, 0xd2, 0x65, 0xb7, 0x47, 0x46,
+	0x9d, 0x1d, 0x1d, 0x24, 0x99, 0x26, 0x58, 0x74, 0x78, 0x26, 0x5b, 0xb9,
+	0x61, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd9, 0xd2, 0xf0, 0x77, 0x91, 0x87,
+	0x77, 0x47, 0x76, 0xdb, 0x6e, 0x6e, 0x6e, 0x6e, 0x6d, 0xd9, 0xd9, 0xd1,
+	0xd2, 0x22, 0x1b, 0x6e, 0x22, 0x75, 0x9d, 0x59, 0x59, 0xce, 0x6e, 0x70,
+	0x74, 0x74, 0x74, 0x74, 0x71, 0x74, 0x74, 0x9c, 0x26, 0x47, 0x36, 0x1e,
+	0x07, 0x82, 0x6d, 0xb9, 0xc1, 0x87, 0x67, 0x67, 0x67, 0x67, 0x67, 0x67,
+	0x49, 0xc1, 0xde, 0x70, 0x61, 0xdd, 0xd1, 0xdd, 0xb6, 0xdb, 0x9c, 0x27,
+	0x09, 0xc2, 0x70, 0x88, 0x88, 0x88, 0x87, 0x67, 0x67, 0x66, 0x22, 0x21,
+	0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xd5, 0xca, 0x6d, 0xd6, 0x71, 0x99, 0x9a,
+	0x9c, 0x1e, 0x04, 0x9c, 0x1d, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd, 0xdd,
+	0x1d, 0x87, 0x56, 0x1d, 0x62, 0x1b, 0x9b, 0x9b, 0x9b, 0x9b, 0x76, 0x76,
+	0x72, 0x72, 0x88, 0x86, 0xdb, 0x87, 0x77, 0x68, 0x21, 0x89, 0xde, 0x75,
+	0x98, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x72, 0x75, 0x75, 0x1d, 0x58,
+	0x77, 0x77, 0x98, 0x6e, 0x62, 0x62, 0x60, 0xc7, 0x36, 0xe7, 0x09, 0xd1,
+	0xdd, 0x67, 0x07, 0x61, 0x26, 0x9b, 0x9c, 0xe2, 0x73, 0x62, 0x71, 0x99,
+	0x73, 0x49, 0xc2, 0x70, 0x73, 0x56, 0xef, 0x36, 0xa6, 0x9b, 0x65, 0xe0,
+	0x49, 0xa9, 0xc5, 0xc9, 0xca, 0x76, 0x91, 0xc9, 0xb7, 0x07, 0x81, 0xdd,
+	0x58, 0xba, 0xc6, 0xb1, 0xc6, 0xf0, 0xc7, 0x5c, 0xef, 0x09, 0xe0, 0xc4,
+	0x9d, 0x5a, 0x5c, 0x70, 0xc7, 0x41, 0x31, 0xd5, 0xda, 0xf1, 0x78, 0x26,
+	0xa6, 0xcb, 0x2f, 0x66, 0x27, 0x49, 0xce, 0x75, 0x9d, 0xee, 0xf1, 0x1a,
+	0xbd, 0xdc, 0x51, 0xd2, 0x74, 0x9d, 0x5c, 0xd8, 0x9d, 0x9c, 0x1d, 0xd8,
+	0x6d, 0xd5, 0x89, 0xde, 0xe5, 0xe0, 0x6d, 0xcd, 0xc1, 0x6c, 0x49, 0x86,
+	0x9c, 0xdd, 0x5d, 0x24, 0x92, 0x74, 0x9d, 0x2e, 0x5d, 0xae, 0x59, 0x66,
+	0x57, 0x59, 0xa9, 0xb3, 0x3c, 0x5c, 0x5d, 0xaf, 0x59, 0x5c, 0x64, 0x95,
+	0xb9, 0x85, 0xbd, 0x98, 0xbb, 0x72, 0x65, 0x8b, 0xc2, 0x65, 0x87, 0x29,
+	0xb7, 0x45, 0x61, 0x99, 0xc8, 0x9c, 0x58, 0x9a, 0x9c, 0x5b, 0x62, 0xe7,
+	0x1b, 0xc5, 0x62, 0xf3, 0x74, 0x74, 0x62, 0x26, 0x1d, 0x98, 0x69, 0x27,
+	0x16, 0x5e, 0x09, 0x5d, 0xdc, 0xa7, 0x59, 0xd2, 0x74, 0x95, 0xa9, 0x5c,
+	0x9a, 0x69, 0x87, 0x3a, 0x75, 0x9a, 0x76, 0x72, 0x91, 0x67, 0x47, 0x82,
+	0x49, 0x26, 0xde, 0x07, 0x39, 0xc1, 0xb5, 0x74, 0x57, 0x47, 0x77, 0x27,
+	0x06, 0xe4, 0x69, 0xa6, 0x5d, 0xda, 0x9c, 0xdc, 0xd9, 0x69, 0x95, 0x6f,
+	0x1a, 0x9a, 0x59, 0xd1, 0x25, 0x86, 0x5c, 0x5c, 0x5b, 0x6d, 0xdd, 0xc9,
+	0xa7, 0x56, 0xdb, 0x69, 0xd1, 0xd5, 0x94, 0x77, 0x46, 0x19, 0x9d, 0x1a,
+	0x61, 0x85, 0x71, 0x98, 0x61, 0x99, 0xc6, 0x19, 0x6d, 0xe0, 0x99, 0x9a,
+	0x78, 0x1a, 0x72, 0x89, 0x27, 0x19, 0xc6, 0x71, 0x78, 0x1c, 0x9d, 0x66,
+	0x21, 0xcd, 0x89, 0xc5, 0xe0, 0x70, 0x46, 0x15, 0xd9, 0x85, 0x62, 0x6d,
+	0xc2, 0x66, 0x6a, 0x46, 0xa4, 0x91, 0x5c, 0x1c, 0xe6, 0x59, 0x95, 0xc2,
+	0x76, 0x70, 0x9d, 0x5d, 0x95, 0xa7, 0x42, 0xf7, 0x70, 0x65, 0xa7, 0x36,
+	0x98, 0x9c, 0xdd, 0x9a, 0x6d, 0x96, 0x1d, 0x16, 0x13, 0x3a, 0xce, 0xb1,
+	0xd9, 0xc9, 0xc1, 0xca, 0x73, 0x71, 0x94, 0x96, 0x61, 0x2e, 0x19, 0x6e,
+	0x6a, 0x70, 0x77, 0x65, 0xe0, 0x9c, 0x18, 0x72, 0x6f, 0x19, 0x98, 0x98,
+	0x6a, 0xa6, 0x9b, 0x76, 0x6d, 0xa9, 0x67, 0x81, 0xe0, 0x65, 0xc9, 0xa9,
+	0x87, 0x75, 0x78, 0x15, 0xe0, 0x61, 0xd2, 0x47, 0x26, 0x18, 0x9d, 0x15,
+	0xc5, 0x9a, 0x61, 0xcd, 0xb5, 0x70, 0x9c, 0x95, 0xb6, 0x66, 0xe7, 0x6c,
+	0x30, 0xc2, 0x78, 0x2f, 0x7c, 0x2e, 0x6e, 0x73, 0x86, 0xb1, 0xc9, 0xc9,
+	0xa6, 0xb2, 0xc6, 0x31, 0xc9, 0xda, 0x4c, 0x70, 0xcf, 0x6b, 0xcb, 0x1c,
+	0x59, 0xb2, 0x74, 0x9c, 0x27, 0x36, 0x67, 0x82, 0xf0, 0xb1, 0x8a, 0x56,
+	0x6e, 0x1c, 0x1a, 0xba, 0x72, 0x62, 0xe9, 0x96, 0xd8, 0x59, 0xe0, 0xb9,
+	0xbc, 0x5c, 0xef, 0x56, 0xa7, 0x67, 0x37, 0x17, 0x81, 0x97, 0x07, 0x37,
+	0x26, 0x21, 0xcd, 0x6e, 0x14, 0xbd, 0x52, 0x46, 0x5c, 0x1c, 0xee, 0xee,
+	0xa5, 0x77, 0x66, 0x57, 0x0c, 0x76, 0x73, 0x9a, 0x99, 0x95, 0xa7, 0x81,
+	0xd9, 0x87, 0x26, 0x51, 0xc9, 0xc5, 0x84, 0x91, 0xe0, 0x61, 0xb7, 0x25,
+	0x71, 0x46, 0x5b, 0x95, 0xa6, 0x18, 0x74, 0x69, 0xa6, 0xdc, 0x58, 0xbc,
+	0x1c, 0x9c, 0x18, 0x69, 0x26, 0xdc, 0xc9, 0x87, 0x07, 0x76, 0x9d, 0xdc,
+	0x26, 0x5c, 0x5c, 0x9a, 0x72, 0x74, 0x57, 0x07, 0x81, 0xa6, 0x1b, 0x71,
+	0x75, 0x6d, 0x9b, 0xc5, 0xb9, 0x89, 0x97, 0x59, 0x97, 0x07, 0x19, 0xa7,
+	0x27, 0x37, 0x69, 0x96, 0x1a, 0x95, 0xc6, 0x41, 0xd9, 0xb9, 0xc1, 0xc3,
+	0x39, 0x72, 0x73, 0x9b, 0xbc, 0xda, 0x61, 0x97, 0x06, 0x31, 0xc2, 0x65,
+	0xd5, 0xb7, 0x7b, 0xdf, 0x39, 0x62, 0xf8, 0x04, 0x71, 0x73, 0x9c, 0xd9,
+	0x9a, 0x91, 0xe0, 0x73, 0x70, 0x71, 0x61, 0x96, 0x18, 0x75, 0x6a, 0x73,
+	0x66, 0x6e, 0x73, 0x70, 0x71, 0x49, 0x96, 0xb1, 0x5d, 0xd5, 0xd1, 0x1c,
+	0xdc, 0x9c, 0x5c, 0x5a, 0x76, 0x9c, 0x9d, 0x67, 0x47, 0x2c, 0xed, 0x1c,
+	0x99, 0x5c, 0xf3, 0xcf, 0x55, 0x96, 0x6d, 0xb6, 0x31, 0x87, 0x59, 0x99,
+	0xa7, 0x82, 0x46, 0xdc, 0x5c, 0x56, 0x46, 0x9c, 0x67, 0x27, 0x06, 0x98,
+	0x74, 0x77, 0x73, 0x72, 0x6b, 0x3d, 0x9d, 0xef, 0x47, 0x6b, 0x9c, 0x70,
+	0x75, 0xb5, 0xc5, 0xca, 0xe1, 0xc2, 0xe6, 0x46, 0xa1, 0xc5, 0x67, 0x06,
+	0x18, 0x71, 0x65, 0x86, 0x16, 0x61, 0xb6, 0x66, 0x1c, 0xa7, 0x3c, 0x70,
+	0x70, 0x69, 0x26, 0x9a, 0x73, 0x9c, 0xda, 0x56, 0x95, 0x15, 0x99, 0xd1,
+	0xce, 0x76, 0x6a, 0xf6, 0x49, 0x1d, 0xdc, 0x1c, 0x5c, 0x18, 0x69, 0x97,
+	0x81, 0x61, 0x87, 0x81, 0x19, 0x9e, 0x07, 0x09, 0x1c, 0x1c, 0xdb, 0x73,
+	0x6d, 0x9b, 0xd5, 0xc5, 0x87, 0x46, 0xdc, 0xef, 0x0b, 0xe0, 0xbe, 0x09,
+	0x96, 0x9d, 0x1c, 0x9a, 0x69, 0xe0, 0x9e, 0x09, 0xdd, 0xa7, 0x57, 0x6c,
+	0xc9, 0xc0, 0xcc, 0x75, 0x78, 0x1d, 0xa4, 0x72, 0x72, 0x91, 0xb6, 0xe4,
+	0x78, 0x24, 0x65, 0xc9, 0xc5, 0x9b, 0xd1, 0xe0, 0x67, 0x06, 0x9d, 0x1d,
+	0x1c, 0x5d, 0x1d, 0x1c, 0xdd, 0x19, 0x72, 0x71, 0x65, 0x5d, 0x61, 0x99,
+	0xd9, 0x87, 0x67, 0x36, 0x5c, 0x67, 0x56, 0x27, 0x19, 0xc5, 0xc2, 0x6a,
+	0xe1, 0xa6, 0xd9, 0x65, 0x96, 0x59, 0x66, 0xe5, 0xd1, 0x5d, 0x1a, 0x74,
+	0x74, 0x70, 0x61, 0xd1, 0xd1, 0xc1, 0x8b, 0xdf, 0x32, 0x71, 0x9c, 0x5c,
+	0x9a, 0x91, 0xc1, 0xd2, 0x6e, 0x6d, 0xb6, 0xe6, 0xe6, 0xa6, 0xd9, 0x72,
+	0x71, 0x66, 0x21, 0x99, 0xc1, 0xa7, 0x47, 0x47, 0x17, 0x47, 0x47, 0x37,
+	0x46, 0x5c, 0x9c, 0x59, 0x57, 0x59, 0xc1, 0x99, 0x96, 0x26, 0x5c, 0xd9,
+	0x71, 0x78, 0x18, 0x78, 0x26, 0x5c, 0x18, 0x71, 0x57, 0x16, 0x1c, 0x5c,
+	0x5c, 0x58, 0x71, 0x71, 0x70, 0x9c, 0x27, 0x06, 0x9b, 0x65, 0x96, 0x59,
+	0x65, 0x97, 0x49, 0xc2, 0x70, 0x9c, 0x27, 0x09, 0xc1, 0xe0, 0x72, 0x78,
+	0x1e, 0x07, 0x46, 0x1e, 0x07, 0x81, 0xd9, 0xe0, 0x78, 0x1a, 0x6d, 0x96,
+	0x59, 0x65, 0x96, 0x5c, 0x66, 0xe6, 0xdc, 0xdb, 0x9b, 0x9a, 0x9b, 0x66,
+	0x6d, 0xc5, 0x99, 0xc5, 0xe0, 0x1c, 0x27, 0x16, 0x9d, 0x1d, 0x1c, 0x9d,
+	0x1b, 0x72, 0x74, 0x65, 0xd1, 0xc5, 0x95, 0x75, 0x9c, 0x19, 0x9c, 0x58,
+	0x98, 0x73, 0x65, 0xc6, 0x18, 0x78, 0x26, 0x1c, 0x18, 0x9c, 0x27, 0x09,
+	0xc2, 0x70, 0x72, 0x69, 0xdd, 0xc1, 0xd2, 0x62, 0x61, 0xb6, 0xe6, 0x25,
+	0x98, 0x65, 0xc9, 0xc5, 0x94, 0x69, 0x99, 0xa9, 0xa6, 0x5c, 0xdc, 0xda,
+	0x73, 0x70, 0x71, 0x73, 0x65, 0xcd, 0xc5, 0x95, 0x74, 0x9a, 0x66, 0x69,
+	0x89, 0xa7, 0x36, 0x5c, 0x66, 0x98, 0x9a, 0x9a, 0x70, 0x62, 0x6a, 0x6a,
+	0x6a, 0x69, 0xc9, 0xa7, 0x77, 0x07, 0x49, 0x89, 0x86, 0xdb, 0x98, 0x96,
+	0x61, 0x97, 0x27, 0x16, 0x67, 0x39, 0xc6, 0x61, 0x97, 0x49, 0xb5, 0x57,
+	0x57, 0x27, 0x57, 0x57, 0x37, 0x56, 0x5d, 0x5c, 0x59, 0x57, 0x69, 0xb6,
+	0x65, 0x96, 0x59, 0x5c, 0x9d, 0x5c, 0x9c, 0x9c, 0x5d, 0xdd, 0xdb, 0x6d,
+	0xdd, 0xd9, 0xdd, 0x97, 0x27, 0x16, 0x6a, 0x56, 0xa6, 0xdc, 0xa5, 0x70,
+	0x75, 0x75, 0x6d, 0xa7, 0x57, 0x37, 0x56, 0x5d, 0x5c, 0x59, 0x57, 0x69,
+	0x59, 0x96, 0x59, 0x65, 0x72, 0x75, 0x72, 0x72, 0x71, 0x77, 0x77, 0x6d,
+	0xb7, 0x77, 0x67, 0x76, 0x5c, 0x9c, 0x59, 0x9c, 0x66, 0x59, 0x61, 0x5c,
+	0x66, 0x5c, 0xef, 0x69, 0x87, 0x27, 0x66, 0x5d, 0x1c, 0x1d, 0x9c, 0xdd,
+	0x99, 0x75, 0x71, 0x65, 0x5d, 0xe6, 0x19, 0x9c, 0x98, 0x78, 0x1c, 0xd9,
+	0x71, 0x9a, 0x62, 0x72, 0x9c, 0x9c, 0x27, 0x19, 0xcd, 0xa6, 0xd9, 0x65,
+	0x96, 0x59, 0x66, 0x74, 0x9c, 0xe7, 0x39, 0xce, 0x73, 0x75, 0x71, 0x91,
+	0xc5, 0xde, 0x6e, 0x6d, 0xb6, 0xe6, 0xe6, 0xa6, 0xd9, 0x72, 0x71, 0x65,
+	0xe0, 0x98, 0x65, 0x89, 0x97, 0x29, 0xc9, 0xd2, 0x72, 0x9c, 0x9c, 0xdd,
+	0xd9, 0x75, 0x70, 0x77, 0x73, 0x77, 0x65, 0xd5, 0xc5, 0x95, 0x78, 0x27,
+	0x26, 0x67, 0x26, 0x1e, 0x07, 0x36, 0x5c, 0x64, 0x62, 0x49, 0xc9, 0xc2,
+	0x72, 0x9c, 0x9a, 0x6d, 0x96, 0x59, 0x65, 0x96, 0x5d, 0x27, 0x29, 0xca,
+	0x72, 0x9c, 0xa7, 0x27, 0x67, 0x29, 0x1c, 0x9e, 0x09, 0xb9, 0xb6, 0xdb,
+	0x9b, 0x9a, 0x9b, 0x65, 0xc9, 0xc5, 0x99, 0xce, 0x6d, 0x96, 0x25, 0x9c,
+	0xec, 0x12, 0x73, 0x71, 0x77, 0x77, 0x74, 0x77, 0x77, 0x73, 0x77, 0x65,
+	0xd5, 0xc5, 0x95, 0x78, 0x26, 0x99, 0x9c, 0xd8, 0x87, 0x36, 0x5c, 0x61,
+	0x89, 0xce, 0x73, 0x70, 0x9c, 0xe7, 0x36, 0x9b, 0x65, 0x96, 0x59, 0x65,
+	0x99, 0xce, 0x73, 0x9c, 0xe7, 0x39, 0xcd, 0xd5, 0xc6, 0x47, 0x17, 0x79,
+	0xb9, 0xb6, 0xdb, 0x9b, 0x9a, 0x9b, 0x65, 0xc9, 0xc5, 0x97, 0x82, 0x61,
+	0x96, 0x18, 0x9c, 0x67, 0x21, 0x27, 0x27, 0x07, 0x67, 0x67, 0x37, 0x67,
+	0x67, 0x37, 0x66, 0x5d, 0x5c, 0x59, 0x57, 0x79, 0xc9, 0x99, 0xc9, 0x89,
+	0xc9, 0xcd, 0x97, 0x18, 0x62, 0x49, 0xc9, 0xc2, 0x72, 0x9c, 0x9a, 0x6d,
+	0x96, 0x59, 0x65, 0x96, 0x5d, 0x27, 0x29, 0xca, 0x72, 0x9c, 0x8c, 0x66,
+	0x6d, 0xd9, 0xc5, 0xd5, 0xde, 0x66, 0x6e, 0x71, 0x49, 0xd5, 0xb7, 0x16,
+	0x66, 0x18, 0x9c, 0xdc, 0x65, 0x45, 0x69, 0xcd, 0xa9, 0x97, 0x59, 0xd5,
+	0x1c, 0x58, 0x55, 0xb8, 0x72, 0x61, 0xce, 0x71, 0x71, 0xc7, 0x59, 0xc9,
+	0x99, 0xcd, 0x95, 0x9c, 0xde, 0x07, 0x16, 0x55, 0x51, 0x89, 0x65, 0x69,
+	0x5a, 0x89, 0x1c, 0x98, 0x86, 0xe7, 0x81, 0xd6, 0x49, 0x1c, 0x24, 0x76,
+	0x65, 0xe0, 0x9b, 0x9d, 0xd6, 0x65, 0xd9, 0xc9, 0xc5, 0xd1, 0x15, 0xdd,
+	0xe0, 0x24, 0x78, 0x31, 0xde, 0x61, 0xc9, 0x1d, 0x16, 0x31, 0xdd, 0xa4,
+	0x9b, 0x70, 0x61, 0xc1, 0xb4, 0x25, 0x9d, 0x58, 0x70, 0x69, 0x1c, 0x1c,
+	0x18, 0x70, 0x69, 0x1d, 0xa7, 0x19, 0xc1, 0xc5, 0xb4, 0x71, 0x71, 0x78,
+	0x26, 0xa7, 0x06, 0x25, 0x98, 0x58, 0x77, 0x91, 0x51, 0x87, 0x17, 0x56,
+	0x98, 0x77, 0x92, 0x26, 0x5d, 0x26, 0x5c, 0x1d, 0xa6, 0xd9, 0x78, 0x1c,
+	0xdd, 0xe6, 0x1c, 0x19, 0x66, 0x61, 0xd1, 0x94, 0x76, 0x47, 0x59, 0x86,
+	0x91, 0xb8, 0x71, 0x76, 0x61, 0xa9, 0x1d, 0x64, 0x87, 0x67, 0x17, 0x37,
+	0x04, 0x71, 0x73, 0x70, 0x6d, 0x86, 0x1c, 0x1c, 0xa4, 0x66, 0x70, 0x61,
+	0xb7, 0x59, 0xd6, 0xed, 0xb7, 0x57, 0x37, 0x01, 0xc1, 0xd1, 0xdd, 0xd9,
+	0xb4, 0x70, 0x98, 0x70, 0x57, 0x17, 0x76, 0x1d, 0xd9, 0x77, 0x61, 0xd1,
+	0xdd, 0xd9, 0xac, 0x71, 0x9b, 0x9b, 0x9c, 0x9c, 0xdc, 0xdb, 0x9c, 0x1d,
+	0xa7, 0x27, 0x56, 0x65, 0x70, 0x56, 0xdb, 0x9a, 0x77, 0x66, 0x65, 0xb9,
+	0x06, 0x1d, 0x58, 0x75, 0x69, 0x96, 0x2e, 0xdc, 0x58, 0x9c, 0x5d, 0x91,
+	0xa6, 0xdc, 0x5a, 0x87, 0x27, 0x19, 0xc9, 0xe0, 0x9a, 0x72, 0x66, 0x69,
+	0xc5, 0x96, 0x16, 0x15, 0x67, 0x07, 0x77, 0x79, 0xd9, 0x65, 0x11, 0x27,
+	0x16, 0x91, 0xb7, 0x38, 0x47, 0x67, 0x07, 0x29, 0xd1, 0xb7, 0x27, 0x79,
+	0xc1, 0xd9, 0x5c, 0x5a, 0x78, 0x1c, 0x67, 0x49, 0xb7, 0x46, 0x11, 0xc5,
+	0xc1, 0xc1, 0x27, 0x06, 0x5d, 0x91, 0x99, 0xa9, 0xa7, 0x09, 0xa7, 0x17,
+	0x57, 0x66, 0x5c, 0x9c, 0x56, 0x69, 0xa9, 0xc5, 0xd1, 0xde, 0x61, 0xc3,
+	0x11, 0x18, 0x73, 0x2e, 0x58, 0x71, 0x73, 0x75, 0x69, 0x98, 0x59, 0xcd,
+	0x85, 0x98, 0x69, 0xc2, 0x61, 0x31, 0x97, 0x77, 0x06, 0x9c, 0x98, 0x91,
+	0x19, 0x99, 0x99, 0x76, 0x99, 0x71, 0x73, 0x76, 0x65, 0xca, 0x70, 0x9b,
+	0x6d, 0xd5, 0xd6, 0x65, 0xda, 0x47, 0x49, 0x81, 0x85, 0x92, 0x59, 0xd1,
+	0xe0, 0x9b, 0x73, 0x70, 0x75, 0x75, 0x61, 0x87, 0x05, 0x70, 0x98, 0x71,
+	0x57, 0x29, 0xc2, 0x59, 0x87, 0x07, 0x27, 0x07, 0x15, 0x74, 0x74, 0x76,
+	0x98, 0x65, 0xe0, 0x62, 0x74, 0x77, 0x76, 0x49, 0x5b, 0x9e, 0x06, 0x5e,
+	0x09, 0xcd, 0x97, 0x57, 0x57, 0x81, 0x87, 0x25, 0x76, 0x69, 0x97, 0x81,
+	0xe0, 0x57, 0x56, 0x27, 0x07, 0x19, 0xb7, 0x16, 0x91, 0xc5, 0xca, 0x62,
+	0x78, 0x27, 0x81, 0xc0, 0xb1, 0xdd, 0xb7, 0x69, 0xe0, 0xcc, 0xc5, 0xcb,
+	0x1a, 0x62, 0xe1, 0xa4, 0x6e, 0x73, 0x85, 0x72, 0x59, 0xd9, 0x67, 0x66,
+	0xa7, 0x39, 0xd8, 0x9a, 0x71, 0x71, 0x70, 0x9d, 0x15, 0xc2, 0x6d, 0x27,
+	0x76, 0x9b, 0x66, 0x73, 0x55, 0x98, 0x65, 0x87, 0x07, 0x66, 0x09, 0xd5,
+	0x97, 0x67, 0x05, 0x9e, 0x07, 0x17, 0x47, 0x81, 0x59, 0x92, 0x73, 0x73,
+	0x46, 0x9a, 0x9d, 0x26, 0x1b, 0x47, 0x06, 0xdd, 0x1d, 0x1c, 0x5c, 0x5c,
+	0x9d, 0xe7, 0x26, 0x59, 0x6d, 0xd1, 0x18, 0x70, 0x70, 0x65, 0xc2, 0x9c,
+	0xda, 0x71, 0x6d, 0x87, 0x57, 0x49, 0xd9, 0xc6, 0x6d, 0xdd, 0xa4, 0x6e,
+	0x70, 0x46, 0x62, 0x9d, 0xe1, 0x27, 0x16, 0xdc, 0xdd, 0xe6, 0xe6, 0x58,
+	0x66, 0x46, 0x9c, 0x55, 0x86, 0xe6, 0xd8, 0x74, 0x91, 0x2c, 0x49, 0xca,
+	0xf1, 0x71, 0x6d, 0xce, 0x69, 0xd5, 0x19, 0x9c, 0xd6, 0x21, 0x96, 0x9c,
+	0xdd, 0x5d, 0xa5, 0x71, 0x9c, 0x9b, 0x75, 0x73, 0x71, 0x77, 0x77, 0x74,
+	0xb2, 0x71, 0x66, 0x73, 0x71, 0x70, 0x98, 0x65, 0xcd, 0xc5, 0x1c, 0x1c,
+	0x25, 0x66, 0x65, 0xa5, 0x9c, 0xa5, 0x84, 0x70, 0x70, 0x78, 0x27, 0x26,
+	0xd1, 0xc1, 0xd9, 0xc9, 0x5d, 0x5d, 0x92, 0xe5, 0xe0, 0x72, 0x70, 0x9b,
+	0x47, 0x82, 0x66, 0xc9, 0xa3, 0x3e, 0x08, 0x98, 0x75, 0x77, 0x75, 0x65,
+	0x96, 0x24, 0xcd, 0xcf, 0x2c, 0x76, 0x26, 0x59, 0x46, 0x96, 0x78, 0x2e,
+	0x6e, 0x6e, 0x58, 0x6d, 0xa4, 0x6e, 0x62, 0x71, 0x59, 0xd1, 0x5d, 0xae,
+	0x59, 0x9b, 0x49, 0xd9, 0x5c, 0x27, 0x29, 0xc6, 0x9b, 0x56, 0x99, 0x9e,
+	0x07, 0x26, 0xae, 0x1d, 0x5c, 0xc6, 0x5b, 0x6a, 0xf0, 0xe1, 0xdf, 0x38,
+	0xc9, 0xdf, 0x1b, 0x6e, 0x1c, 0xae, 0xd2, 0x77, 0x61, 0xb5, 0x78, 0x1b,
+	0xb9, 0x62, 0xc5, 0x71, 0xa7, 0x06, 0x1a, 0x9b, 0xbd, 0x1c, 0x5a, 0x61,
+	0x66, 0xa6, 0xc7, 0x0b, 0xb6, 0x1c, 0x9d, 0xdd, 0xdc, 0x1b, 0x74, 0x56,
+	0xad, 0x6d, 0x87, 0x36, 0x5c, 0x5c, 0xaf, 0x5b, 0xa6, 0xef, 0x57, 0x27,
+	0x26, 0x27, 0x7c, 0xdb, 0xbb, 0x6c, 0x65, 0x1a, 0x5b, 0x6e, 0x6e, 0x5b,
+	0x61, 0xb6, 0x91, 0xbb, 0x65, 0x74, 0x46, 0x22, 0x66, 0xf3, 0x9c, 0xe6,
+	0x6d, 0x49, 0xb9, 0xce, 0xf2, 0x74, 0x9d, 0x2e, 0xe7, 0x79, 0xd5, 0x99,
+	0xe0, 0x69, 0xc1, 0x52, 0xed, 0x86, 0x61, 0xd5, 0x64, 0x89, 0x59, 0x95,
+	0xa6, 0xa7, 0x67, 0x09, 0xda, 0x76, 0x75, 0x69, 0x97, 0x49, 0x87, 0x37,
+	0x77, 0x36, 0x9b, 0x98, 0x6d, 0xd6, 0x77, 0x69, 0x87, 0x21, 0xe0, 0x69,
+	0x86, 0xdd, 0x19, 0x91, 0xc2, 0x6d, 0xb9, 0x96, 0x1c, 0x58, 0x95, 0xd5,
+	0xd9, 0xa9, 0xb8, 0x74, 0x99, 0x78, 0x1b, 0x75, 0x71, 0x71, 0x77, 0x77,
+	0x9a, 0x6d, 0xb7, 0x15, 0x9e, 0x01, 0x11, 0xc1, 0x5b, 0x9c, 0x1c, 0x5d,
+	0x5d, 0x59, 0x72, 0x6d, 0x65, 0x75, 0x9c, 0x1c, 0xe7, 0x09, 0xc1, 0xc1,
+	0xcd, 0x19, 0x98, 0x61, 0x86, 0x1c, 0x6f, 0x57, 0x56, 0x1c, 0xd6, 0x59,
+	0x96, 0xde, 0x06, 0x5d, 0xdb, 0x70, 0x69, 0x95, 0x57, 0x56, 0xda, 0x66,
+	0x65, 0xd5, 0xc2, 0x61, 0xd1, 0xda, 0x4b, 0xd9, 0xc5, 0x87, 0x37, 0x57,
+	0x56, 0x1c, 0xe6, 0xa6, 0x98, 0x9b, 0x65, 0x66, 0x21, 0xca, 0x49, 0xc9,
+	0xd5, 0xd5, 0xd5, 0xc5, 0x87, 0x07, 0x81, 0xc5, 0xd5, 0x1c, 0x9c, 0x9b,
+	0x99, 0x65, 0x96, 0xa5, 0x65, 0xa6, 0x1a, 0x77, 0x75, 0x56, 0xdc, 0x1d,
+	0x9d, 0xe7, 0x17, 0x27, 0x67, 0x0b, 0xd9, 0xe0, 0x66, 0xf1, 0x71, 0x72,
+	0x76, 0x66, 0x46, 0xd9, 0x77, 0x56, 0x5a, 0x56, 0x1d, 0x55, 0xc1, 0xd1,
+	0xd1, 0xc6, 0x1c, 0x9e, 0x07, 0x47, 0x16, 0x1c, 0x1c, 0x1d, 0x99, 0x96,
+	0x2f, 0x27, 0x07, 0x27, 0x26, 0xd8, 0x72, 0x65, 0xd5, 0xde, 0x75, 0x69,
+	0x89, 0x91, 0xcd, 0xa6, 0x1b, 0x76, 0x65, 0xe0, 0x70, 0x69, 0x64, 0x61,
+	0x1d, 0x1c, 0x64, 0x56, 0xdd, 0x5c, 0x9c, 0x64, 0x72, 0x71, 0x73, 0x9b,
+	0x9c, 0x5d, 0x1d, 0x1c, 0xc7, 0x36, 0xdc, 0xdc, 0x9a, 0x90, 0x69, 0xcd,
+	0x18, 0x69, 0x89, 0xab, 0xa7, 0x07, 0x17, 0x35, 0x9c, 0x9a, 0x58, 0x72,
+	0x74, 0x74, 0x74, 0x44, 0x78, 0x26, 0xa5, 0x9a, 0x70, 0x72, 0x96, 0x62,
+	0x47, 0x82, 0x1a, 0xc4, 0xc7, 0x7b, 0xd6, 0xe7, 0x1b, 0xc6, 0x58, 0xb3,
+	0x1c, 0x13, 0x18, 0xbc, 0x5c, 0x9c, 0xdd, 0xe5, 0x57, 0x81, 0xde, 0x27,
+	0x69, 0xc2, 0x77, 0x99, 0x70, 0x71, 0x65, 0xb6, 0x6e, 0x9a, 0x77, 0x9b,
+	0x6e, 0x78, 0x19, 0xb8, 0x61, 0xcc, 0x61, 0xd9, 0xb7, 0x79, 0xd2, 0x74,
+	0x75, 0x6d, 0xdd, 0xb6, 0x18, 0x6d, 0xc4, 0x87, 0x26, 0x1c, 0x1c, 0xd9,
+	0x73, 0x70, 0x65, 0x89, 0xd2, 0x78, 0x1c, 0xda, 0x66, 0x76, 0x57, 0x24,
+	0x78, 0x1c, 0x58, 0x47, 0x37, 0x46, 0x9a, 0x65, 0xc2, 0x76, 0x70, 0x78,
+	0x1c, 0xdc, 0x27, 0x7b, 0xa6, 0xdb, 0x71, 0x74, 0x72, 0x78, 0x2e, 0x9c,
+	0xa6, 0x26, 0x1b, 0x78, 0x15, 0x99, 0xb7, 0x77, 0x47, 0x28, 0x69, 0xd5,
+	0xc1, 0xb6, 0x2f, 0x1b, 0xd3, 0x12, 0x78, 0x0b, 0xcd, 0x94, 0x69, 0x67,
+	0x7b, 0xd6, 0xf5, 0xba, 0x61, 0xb6, 0x91, 0xb9, 0x89, 0x89, 0xd8, 0x9d,
+	0xa5, 0x9c, 0x25, 0x70, 0x9d, 0xa5, 0x57, 0x49, 0xc9, 0x81, 0xc1, 0xb6,
+	0x26, 0xd8, 0x61, 0xd9, 0xb4, 0x70, 0x65, 0xc9, 0xc1, 0x86, 0x9b, 0x9a,
+	0x65, 0xc9, 0xca, 0x74, 0x70, 0x9c, 0x18, 0x9d, 0x9a, 0x75, 0x73, 0x49,
+	0xe0, 0x78, 0x0c, 0xe6, 0x77, 0x75, 0x77, 0x77, 0x72, 0x61, 0xda, 0x76,
+	0x6d, 0xdd, 0xc2, 0x27, 0x69, 0xab, 0xd2, 0x56, 0x98, 0x6a, 0x65, 0xcd,
+	0x66, 0x15, 0xa7, 0x77, 0x76, 0x26, 0xdc, 0x66, 0xe1, 0xd1, 0x2f, 0x26,
+	0xe4, 0x65, 0xd9, 0x86, 0xdc, 0x96, 0x70, 0x77, 0x69, 0x96, 0x5a, 0x71,
+	0x56, 0x1b, 0x73, 0x76, 0x47, 0x0b, 0x1b, 0x65, 0xc9, 0x67, 0x19, 0x88,
+	0x78, 0x1c, 0x9c, 0xaf, 0x49, 0xc6, 0x49, 0xc9, 0xc9, 0x18, 0x9c, 0xae,
+	0x1c, 0xdc, 0x9d, 0x1d, 0x55, 0x55, 0xd1, 0xd9, 0xdd, 0x89, 0xc9, 0xa4,
+	0x9a, 0x9b, 0x26, 0x9a, 0x72, 0x99, 0x9a, 0x6d, 0xbb, 0x86, 0xdd, 0x9d,
+	0x67, 0x57, 0x0b, 0xd9, 0x27, 0x06, 0xde, 0x07, 0x06, 0x58, 0x72, 0x75,
+	0x9c, 0x9c, 0x1d, 0x51, 0xdd, 0xb6, 0xa1, 0x5c, 0xd8, 0x91, 0xa6, 0x5c,
+	0x18, 0x86, 0x1b, 0x75, 0x75, 0x62, 0x70, 0x87, 0x09, 0xcd, 0xd2, 0x73,
+	0x99, 0x78, 0x1d, 0xa2, 0x47, 0x59, 0xbb, 0xa6, 0x9b, 0x49, 0xd9, 0xa9,
+	0x11, 0x99, 0x99, 0x1b, 0x61, 0x96, 0x1b, 0x66, 0x46, 0xa4, 0x70, 0x6d,
+	0xa7, 0x15, 0x49, 0x5c, 0x98, 0x76, 0x57, 0x82, 0x25, 0x11, 0x15, 0xa7,
+	0x39, 0x56, 0x74, 0x75, 0x73, 0x76, 0x72, 0x72, 0x9d, 0x67, 0x48, 0x9d,
+	0x5c, 0x91, 0x87, 0x3c, 0xea, 0x57, 0x34, 0x98, 0x92, 0x61, 0x19, 0x78,
+	0x1c, 0x19, 0x78, 0x1c, 0x15, 0x87, 0x56, 0x1d, 0xd8, 0x98, 0x72, 0x9a,
+	0x6e, 0x61, 0xb9, 0x89, 0x89, 0x99, 0xc1, 0xe0, 0x72, 0x9c, 0x5d, 0x5b,
+	0x71, 0x73, 0x9c, 0x5c, 0x5b, 0x70, 0x70, 0x78, 0x21, 0x86, 0x1b, 0x76,
+	0x27, 0x09, 0x1b, 0x6d, 0x5c, 0x5c, 0x24, 0x73, 0x81, 0xb7, 0x81, 0xa9,
+	0x62, 0x77, 0x6a, 0x76, 0x6a, 0x1d, 0x99, 0x61, 0xd5, 0xc2, 0x46, 0xd6,
+	0x25, 0x87, 0x69, 0xd1, 0xca, 0x76, 0x70, 0x6d, 0xcd, 0xc5, 0x97, 0x81,
+	0xb4, 0x6d, 0xe0, 0x76, 0x78, 0x1a, 0x75, 0x73, 0x73, 0x9b, 0x77, 0x87,
+	0x17, 0x09, 0xc1, 0xd1, 0xc5, 0x15, 0xca, 0x6d, 0xa6, 0x18, 0x71, 0x95,
+	0xc9, 0xa6, 0xdc, 0x9c, 0xa7, 0x07, 0x06, 0xdb, 0x92, 0x65, 0x59, 0x65,
+	0xc1, 0x89, 0xd2, 0xee, 0xee, 0xec, 0x9d, 0xd9, 0x46, 0x96, 0xe2, 0xee,
+	0xee, 0xed, 0x86, 0xda, 0x49, 0xc5, 0xc1, 0xd9, 0xd9, 0xd9, 0x86, 0xef,
+	0x81, 0xdd, 0xcd, 0xc9, 0x94, 0x69, 0x5c, 0xdd, 0x5d, 0x5b, 0x61, 0xb6,
+	0x91, 0xb9, 0xc2, 0x74, 0x9c, 0xa7, 0x19, 0xc1, 0x89, 0xa6, 0xe7, 0x15,
+	0x9c, 0x67, 0x07, 0x29, 0xc6, 0x78, 0x27, 0x81, 0xd2, 0x9d, 0x66, 0xe7,
+	0x27, 0x69, 0xca, 0x72, 0x65, 0x87, 0x77, 0x77, 0x0a, 0x66, 0xe5, 0xd1,
+	0xd5, 0x27, 0x77, 0x27, 0x44, 0x65, 0xb8, 0x98, 0x56, 0x9d, 0x9b, 0x61,
+	0xb8, 0x76, 0x61, 0xd9, 0xa6, 0x24, 0x71, 0x71, 0x6d, 0x1e, 0x0b, 0x1c,
+	0x2e, 0x91, 0xd2, 0xea, 0x70, 0x2e, 0xdc, 0x5a, 0x72, 0x9c, 0xe7, 0x82,
+	0xdb, 0x49, 0xd9, 0x94, 0x6a, 0x71, 0x9c, 0x5d, 0x92, 0x71, 0x73, 0x95,
+	0x19, 0x9c, 0x1c, 0x27, 0x67, 0x09, 0xb6, 0x16, 0x70, 0x6a, 0x6d, 0x99,
+	0xd5, 0xc9, 0x5c, 0x65, 0x69, 0xb6, 0x9c, 0x9b, 0x72, 0x74, 0x57, 0x49,
+	0xc9, 0xa6, 0x19, 0x9c, 0xdd, 0xdc, 0x59, 0x9c, 0x99, 0x69, 0xd5, 0x9b,
+	0xc5, 0xd5, 0x87, 0x46, 0xdc, 0xee, 0xef, 0x5b, 0xd6, 0x62, 0xf1, 0x72,
+	0x1c, 0xec, 0x9d, 0x9e, 0x07, 0x67, 0x59, 0xa5, 0x78, 0x22, 0x65, 0xe0,
+	0x95, 0xd5, 0xa7, 0x5b, 0x9b, 0xd1, 0x5d, 0xd9, 0x56, 0x73, 0xb5, 0x61,
+	0xca, 0x66, 0xf3, 0x61, 0x9b, 0xd1, 0x15, 0xa6, 0x9a, 0x62, 0x75, 0x9c,
+	0x67, 0x46, 0x67, 0x49, 0x88, 0x87, 0x19, 0x66, 0x19, 0x61, 0x97, 0x59,
+	0xd1, 0x96, 0x6f, 0x07, 0x47, 0x56, 0x9b, 0x72, 0x6d, 0x5c, 0x67, 0x18,
+	0xbc, 0x6f, 0x3b, 0xce, 0x6d, 0x89, 0xe0, 0x9e, 0x0b, 0xab, 0xab, 0xa1,
+	0xcb, 0x1c, 0xdd, 0x0c, 0x73, 0xb2, 0x75, 0x96, 0x59, 0x27, 0x19, 0xa6,
+	0xdb, 0xb1, 0xe0, 0xb9, 0xb9, 0x71, 0x31, 0x51, 0xc9, 0xc9, 0xc9, 0xc9,
+	0xc9, 0xc9, 0xd1, 0xd1, 0xe0, 0x6e, 0x73, 0xb8, 0x65, 0x87, 0x16, 0xd8,
+	0x9d, 0x98, 0x9d, 0xdc, 0x29, 0x97, 0x19, 0x89, 0x82, 0x9c, 0x64, 0x75,
+	0xbd, 0x58, 0x71, 0x72, 0x75, 0x56, 0x9c, 0xd8, 0x71, 0x6d, 0xc5, 0xa7,
+	0x16, 0x1c, 0x1c, 0x5c, 0x17, 0x1c, 0x9c, 0x98, 0x72, 0x6d, 0xc9, 0xc9,
+	0xc9, 0x87, 0x17, 0x27, 0x0b, 0x8c, 0x63, 0x1c, 0xdd, 0xcb, 0xda, 0x70,
+	0x74, 0x75, 0x71, 0x55, 0x5b, 0x94, 0xb1, 0x2f, 0x39, 0xcd, 0x97, 0x51,
+	0xdd, 0x86, 0x99, 0x59, 0xa9, 0x64, 0x91, 0xb6, 0xd1, 0xcf, 0x5b, 0x16,
+	0x70, 0x9d, 0xda, 0x77, 0x19, 0x9c, 0x9d, 0xaf, 0x07, 0x81, 0xc1, 0xc1,
+	0xa6, 0xa7, 0x17, 0x09, 0xd1, 0xca, 0x66, 0x59, 0x99, 0x27, 0x6a, 0x1d,
+	0xa9, 0xc4, 0xd6, 0xae, 0xef, 0x57, 0x77, 0x76, 0x2f, 0x56, 0x18, 0xbd,
+	0x56, 0x77, 0x9c, 0xb3, 0xc7, 0x5a, 0x99, 0x70, 0x96, 0x55, 0xc4, 0x78,
+	0x26, 0xa6, 0x9b, 0x6e, 0x6b, 0x15, 0xa9, 0xcc, 0xc5, 0x72, 0x48, 0x74,
+	0x9c, 0xdb, 0x9d, 0x15, 0x86, 0x18, 0x76, 0x61, 0x67, 0x21, 0x6c, 0xc4,
+	0x57, 0x07, 0x09, 0xd9, 0x87, 0x57, 0x19, 0x12, 0x77, 0x69, 0xc1, 0x19,
+	0x74, 0x70, 0x6d, 0x56, 0x78, 0x1d, 0x1c, 0x5c, 0xa6, 0x1d, 0x9c, 0xdc,
+	0x1d, 0x19, 0x6d, 0x99, 0xc5, 0xc9, 0xca, 0x65, 0xd1, 0xc5, 0xd5, 0x85,
+	0x61, 0xcd, 0x1a, 0x56, 0x1d, 0xdb, 0x56, 0x1c, 0xd8, 0x70, 0xc6, 0x59,
+	0x72, 0x71, 0x66, 0x1d, 0xaf, 0x1b, 0x99, 0x5c, 0xdd, 0x5a, 0x71, 0x71,
+	0x77, 0x74, 0x74, 0x70, 0x65, 0x8c, 0x62, 0x45, 0x74, 0x70, 0x62, 0xe9,
+	0x97, 0x37, 0x05, 0x73, 0x56, 0x98, 0x99, 0x76, 0x69, 0xdd, 0x5d, 0x64,
+	0x9c, 0x5c, 0x31, 0x87, 0x39, 0xb9, 0x96, 0x66, 0x26, 0x9d, 0xe6, 0xe6,
+	0x9e, 0x07, 0x29, 0xb9, 0x64, 0x9a, 0x96, 0x57, 0x56, 0x9c, 0x5c, 0x66,
+	0x9d, 0xd9, 0x61, 0x86, 0x9b, 0x61, 0x59, 0x61, 0x5d, 0xa6, 0x9c, 0x1a,
+	0x6d, 0x67, 0x29, 0x6e, 0x5c, 0xc9, 0xa9, 0x27, 0x02, 0x73, 0x70, 0x47,
+	0x17, 0x78, 0x77, 0x61, 0x8c, 0x65, 0x1d, 0xdd, 0x96, 0x73, 0x56, 0xdb,
+	0x92, 0x70, 0x72, 0x98, 0x99, 0x9a, 0x65, 0xb6, 0xd5, 0xc1, 0x8a, 0x4c,
+	0x70, 0xb6, 0xea, 0x74, 0xc2, 0xdb, 0xb6, 0x55, 0xc1, 0xde, 0x77, 0x5c,
+	0xe7, 0x35, 0x5e, 0x06, 0x95, 0x9c, 0xe5, 0x6f, 0x69, 0xc5, 0xb9, 0x59,
+	0x73, 0x75, 0xbc, 0xd5, 0x87, 0x37, 0x55, 0xc7, 0x7b, 0xc5, 0x67, 0x4b,
+	0x9b, 0xa6, 0x1c, 0x5c, 0xe5, 0x56, 0x1c, 0xdc, 0xd6, 0x4d, 0x61, 0x64,
+	0x92, 0x49, 0x19, 0x72, 0x74, 0x91, 0x58, 0x74, 0x74, 0x5c, 0xf1, 0x91,
+	0x5d, 0x1d, 0x1d, 0x1d, 0x19, 0x72, 0x9c, 0x11, 0x5c, 0xdc, 0xe7, 0x09,
+	0xac, 0x61, 0xd5, 0xb7, 0x47, 0x45, 0x9d, 0xe7, 0x56, 0x27, 0x76, 0x27,
+	0x0b, 0xc1, 0xb5, 0x6e, 0x78, 0x27, 0x37, 0x17, 0x2b, 0x5a, 0x70, 0x78,
+	0x21, 0xd1, 0x87, 0x17, 0x3b, 0xc9, 0x86, 0x9c, 0xe6, 0x5c, 0x9c, 0x6f,
+	0x16, 0xed, 0xc4, 0x16, 0xf1, 0x69, 0xca, 0x15, 0xda, 0xf5, 0x95, 0xc2,
+	0xf3, 0x66, 0x18, 0x99, 0x69, 0xdd, 0x88, 0x86, 0x18, 0x61, 0x5c, 0x9d,
+	0xaf, 0x07, 0x36, 0x9a, 0x9c, 0xae, 0x27, 0x07, 0x81, 0x97, 0x81, 0xb7,
+	0x19, 0xa9, 0xa7, 0x6c, 0xf3, 0x99, 0x57, 0x77, 0x77, 0x47, 0x26, 0x5a,
+	0x9c, 0x15, 0x89, 0x1d, 0x98, 0x9c, 0x27, 0x01, 0x5d, 0xe2, 0xf2, 0x74,
+	0x75, 0x48, 0x6d, 0xa9, 0xa5, 0x9b, 0x57, 0x49, 0x99, 0xcd, 0xa9, 0xc6,
+	0x57, 0x36, 0x1d, 0x15, 0xc1, 0x84, 0xcf, 0x69, 0xc1, 0x66, 0xa6, 0x5d,
+	0xdc, 0x9c, 0xdd, 0x9d, 0x5c, 0xd5, 0x95, 0x6e, 0x65, 0xca, 0x71, 0x98,
+	0x73, 0x98, 0x78, 0x21, 0x26, 0x1c, 0xe1, 0x97, 0x81, 0x87, 0x77, 0x67,
+	0x27, 0x31, 0x97, 0x37, 0x55, 0x61, 0x97, 0x0b, 0xe0, 0x6a, 0x61, 0xbb,
+	0x1b, 0x72, 0x86, 0x5d, 0x52, 0x70, 0x47, 0x79, 0x67, 0x49, 0xa7, 0x27,
+	0x81, 0xda, 0x62, 0x74, 0x9a, 0x31, 0x97, 0x76, 0x9d, 0x5e, 0x05, 0x9a,
+	0x56, 0x25, 0x72, 0x74, 0x9d, 0xdc, 0x18, 0x69, 0xd9, 0x5e, 0x09, 0xdd,
+	0x66, 0x24, 0x6e, 0xf7, 0x56, 0x1c, 0xe7, 0x09, 0x66, 0x6f, 0x77, 0x04,
+	0x71, 0x61, 0xd1, 0xb8, 0x72, 0x72, 0x62, 0x47, 0x06, 0x58, 0x57, 0x82,
+	0x75, 0x65, 0xda, 0x26, 0xda, 0x6d, 0xd2, 0x78, 0x15, 0xcd, 0xd6, 0x46,
+	0xdc, 0xdc, 0xdb, 0x65, 0x99, 0x97, 0x76, 0x18, 0x78, 0x1c, 0x59, 0x74,
+	0x78, 0x27, 0x06, 0x66, 0xdd, 0x55, 0xd1, 0xcd, 0xcd, 0x97, 0x47, 0x66,
+	0x9d, 0xdb, 0x74, 0x77, 0x65, 0xc1, 0x26, 0x31, 0xe0, 0xbd, 0x31, 0xd6,
+	0xf3, 0x9c, 0x1a, 0x46, 0xe1, 0xc6, 0x57, 0x82, 0x6a, 0x49, 0xc5, 0xc2,
+	0x74, 0x71, 0x9b, 0x99, 0x65, 0x55, 0x5c, 0xa5, 0x9a, 0x62, 0x71, 0x76,
+	0x9a, 0x65, 0x96, 0xa6, 0xd5, 0x87, 0x37, 0x66, 0x1d, 0xdd, 0x67, 0x81,
+	0xc9, 0xcd, 0x29, 0xb6, 0x9c, 0x9d, 0xdc, 0x9c, 0x9d, 0x1b, 0x72, 0x6a,
+	0x72, 0x70, 0x75, 0x71, 0x6e, 0x66, 0x71, 0x9c, 0x67, 0x19, 0xc6, 0x71,
+	0x69, 0x1b, 0x74, 0x71, 0x73, 0x62, 0x61, 0xdd, 0x52, 0xd9, 0xb9, 0xd1,
+	0xb9, 0x87, 0x06, 0x65, 0x98, 0x65, 0xa9, 0x97, 0x36, 0x1d, 0x55, 0xc1,
+	0xc5, 0xb6, 0x1c, 0xda, 0x47, 0x27, 0x21, 0xc9, 0xa6, 0x27, 0x74, 0x73,
+	0x69, 0x67, 0x05, 0x77, 0x6d, 0xa7, 0x55, 0x62, 0x75, 0x6d, 0x67, 0x51,
+	0x11, 0x97, 0x57, 0x44, 0x76, 0x69, 0xc1, 0x89, 0xd6, 0x72, 0x33, 0x99,
+	0xcd, 0xd9, 0xdd, 0xb7, 0x27, 0x47, 0x38, 0x49, 0xd1, 0xd9, 0x96, 0x26,
+	0x89, 0x96, 0x9c, 0x1a, 0xb2, 0x65, 0xcd, 0x89, 0x18, 0x95, 0xcd, 0x97,
+	0x07, 0x25, 0x62, 0x65, 0xc6, 0x69, 0xd1, 0x96, 0xa7, 0x66, 0x1c, 0x29,
+	0x5d, 0x1d, 0x5b, 0x9c, 0x5b, 0x68, 0x71, 0x61, 0xd5, 0xd5, 0x87, 0x51,
+	0xc1, 0x99, 0x96, 0x58, 0x98, 0x99, 0x9c, 0x5c, 0xdd, 0x92, 0x65, 0xb6,
+	0x9c, 0xe7, 0x09, 0x96, 0xd9, 0x75, 0x1d, 0x1d, 0x9c, 0x59, 0x55, 0x73,
+	0x55, 0x98, 0x57, 0x36, 0x66, 0x9c, 0x1b, 0x77, 0x65, 0xb9, 0x87, 0x16,
+	0x15, 0xbb, 0x87, 0x09, 0xb9, 0x95, 0x71, 0x57, 0x66, 0x1d, 0xdc, 0x18,
+	0x73, 0x61, 0xb6, 0x99, 0x98, 0x6d, 0x89, 0xd2, 0xdc, 0x63, 0x1e, 0x09,
+	0xe0, 0x62, 0x78, 0x1a, 0x46, 0xdd, 0x9d, 0x15, 0xd9, 0x5d, 0x5d, 0x98,
+	0x99, 0x61, 0xd9, 0xe0, 0x70, 0x9a, 0x71, 0x9d, 0x5c, 0x5c, 0x27, 0x82,
+	0x72, 0x2c, 0x61, 0xc5, 0xc5, 0xd1, 0x67, 0x04, 0x59, 0xa6, 0x27, 0x77,
+	0x76, 0x9c, 0x1a, 0x69, 0x58, 0x96, 0x62, 0x61, 0x51, 0x89, 0xc9, 0xb9,
+	0xde, 0xe9, 0xd5, 0xa6, 0x52, 0x75, 0x56, 0x9d, 0xdc, 0x11, 0xd2, 0x77,
+	0x70, 0x70, 0x9c, 0x67, 0x16, 0x1d, 0x9c, 0x99, 0x65, 0x26, 0x9c, 0x5c,
+	0xa7, 0x09, 0x5d, 0xe1, 0xcd, 0x1d, 0x27, 0x81, 0xc9, 0xc5, 0xe0, 0x73,
+	0x69, 0x87, 0x36, 0x1d, 0x19, 0x59, 0x87, 0x59, 0xb7, 0x19, 0x5c, 0x67,
+	0x77, 0x46, 0x15, 0xb7, 0x26, 0x1a, 0x9c, 0xd8, 0x62, 0x91, 0xd9, 0xc9,
+	0x5d, 0xd5, 0xc5, 0xb6, 0x9c, 0x55, 0xb4, 0x99, 0x74, 0x70, 0x26, 0x99,
+	0x9d, 0x24, 0x9a, 0x95, 0xc9, 0xd9, 0xc5, 0xd9, 0xc6, 0x9a, 0x73, 0xa6,
+	0x58, 0x9c, 0x15, 0xca, 0x69, 0xc5, 0xc1, 0x96, 0xdd, 0x19, 0x61, 0x84,
+	0x95, 0x86, 0x5a, 0x65, 0x86, 0x9c, 0x59, 0x65, 0xcd, 0x96, 0x18, 0x72,
+	0x76, 0x9a, 0x9d, 0x1b, 0x9c, 0xdc, 0xdc, 0x27, 0x37, 0x09, 0xc1, 0x96,
+	0x66, 0xd9, 0x4c, 0xea, 0x66, 0x65, 0x97, 0x17, 0x29, 0xc5, 0xc2, 0x72,
+	0x72, 0xc6, 0x27, 0x29, 0x97, 0x69, 0xcd, 0x87, 0x56, 0xdc, 0x9c, 0x96,
+	0x15, 0x5d, 0x5d, 0x89, 0xcd, 0xce, 0x70, 0x70, 0x9a, 0x72, 0x72, 0x78,
+	0x1c, 0xe6, 0x5d, 0x9d, 0x9c, 0x1c, 0x11, 0xc5, 0xe0, 0x91, 0x97, 0x37,
+	0x37, 0x37, 0x56, 0x27, 0x16, 0x9d, 0x9e, 0x06, 0x5d, 0xdb, 0x57, 0x5b,
+	0xcd, 0xca, 0x66, 0x19, 0x9c, 0x12, 0x73, 0x71, 0x9c, 0x9c, 0x25, 0x76,
+	0x65, 0x86, 0x26, 0x26, 0x1e, 0x06, 0x5c, 0x9c, 0x9c, 0x18, 0x47, 0x06,
+	0xe1, 0x85, 0x6d, 0xa9, 0xcd, 0xb7, 0x46, 0x19, 0x72, 0x59, 0x1a, 0x99,
+	0x72, 0x66, 0x69, 0xdd, 0xc2, 0x69, 0x5c, 0x1c, 0x5d, 0x5c, 0x1c, 0xdd,
+	0xda, 0x56, 0x26, 0xd8, 0x9a, 0x61, 0x86, 0x99, 0x86, 0x9a, 0x75, 0x65,
+	0xcd, 0xc5, 0xb6, 0x24, 0x22, 0x57, 0x07, 0x07, 0x82, 0x73, 0x99, 0x77,
+	0x95, 0x87, 0x66, 0x9a, 0x76, 0x71, 0x55, 0x65, 0xd5, 0xdd, 0xc1, 0x89,
+	0xc5, 0xc8, 0x61, 0x87, 0x81, 0xc1, 0x55, 0xb6, 0x1c, 0xd9, 0x74, 0x56,
+	0x64, 0x74, 0x95, 0xcd, 0xde, 0x74, 0x72, 0x76, 0x72, 0x65, 0x86, 0xaf,
+	0x17, 0x81, 0xc6, 0x26, 0x1a, 0x6d, 0xde, 0x65, 0xc2, 0x48, 0x44, 0x9a,
+	0x6e, 0x56, 0xdc, 0x58, 0x77, 0x91, 0xa7, 0x55, 0x56, 0x59, 0x89, 0x96,
+	0x5c, 0x5c, 0x5b, 0x9d, 0xf3, 0x2f, 0x0b, 0x9b, 0x19, 0x46, 0x96, 0xdb,
+	0xbb, 0xb6, 0xd8, 0x6d, 0xa4, 0x6e, 0x62, 0x61, 0xda, 0x19, 0x57, 0x77,
+	0x76, 0x1b, 0x6e, 0x59, 0x5c, 0x1a, 0x71, 0x95, 0x58, 0x72, 0x72, 0x61,
+	0xd2, 0x32, 0xc8, 0x77, 0x65, 0x1a, 0x57, 0x82, 0x59, 0x65, 0x61, 0xb6,
+	0x92, 0xf1, 0x70, 0x61, 0x96, 0x55, 0x18, 0x9e, 0x08, 0x76, 0x9e, 0x06,
+	0x66, 0x59, 0x92, 0x70, 0x59, 0x81, 0xc2, 0x77, 0x70, 0x6e, 0x66, 0x70,
+	0x73, 0x65, 0xc2, 0x73, 0x9d, 0x1a, 0x9d, 0x51, 0xc6, 0x9c, 0x1b, 0x77,
+	0x78, 0x18, 0x69, 0xd1, 0xd9, 0x87, 0x76, 0xdc, 0xdc, 0x99, 0xb5, 0xcd,
+	0x86, 0x1c, 0x9c, 0x15, 0xd2, 0x78, 0x27, 0x67, 0x27, 0x46, 0x11, 0xd1,
+	0xc5, 0xc1, 0x1d, 0x5c, 0x61, 0x94, 0x65, 0xd6, 0x45, 0xce, 0xd9, 0x57,
+	0x67, 0x67, 0x09, 0x67, 0x77, 0x59, 0x87, 0x07, 0x57, 0x16, 0x5d, 0x61,
+	0x96, 0xa4, 0x99, 0x75, 0x71, 0x78, 0x1a, 0x71, 0xb9, 0x72, 0x71, 0x77,
+	0x99, 0x71, 0x77, 0x6a, 0x69, 0xa7, 0x81, 0xa9, 0xa7, 0x66, 0xde, 0x06,
+	0x9d, 0x5d, 0xa6, 0x9c, 0x96, 0x69, 0x86, 0x1b, 0x95, 0xa6, 0x64, 0x61,
+	0xc1, 0xca, 0x65, 0xc5, 0xda, 0x65, 0x5c, 0x9d, 0x1c, 0xd8, 0x70, 0x74,
+	0x98, 0x75, 0x74, 0x49, 0x86, 0xec, 0x61, 0xc5, 0xa7, 0x37, 0x27, 0x0b,
+	0x87, 0x17, 0x77, 0x75, 0x75, 0x70, 0x57, 0x67, 0x26, 0xd8, 0x78, 0x1c,
+	0x1b, 0x9b, 0x71, 0x98, 0x98, 0x76, 0x77, 0x61, 0x1c, 0x5c, 0x16, 0x65,
+	0xdd, 0xd1, 0xc5, 0x98, 0x78, 0x1e, 0x06, 0x5e, 0x06, 0xdd, 0x59, 0x73,
+	0x71, 0x71, 0x9d, 0x1e, 0x02, 0xf5, 0x74, 0x69, 0xa4, 0x72, 0x71, 0x61,
+	0x86, 0x1e, 0x06, 0x5e, 0x09, 0x59, 0x66, 0x57, 0x07, 0x06, 0x67, 0x17,
+	0x17, 0x07, 0x81, 0x97, 0x09, 0xb5, 0x99, 0x73, 0x95, 0xd1, 0xbb, 0xc1,
+	0xa7, 0x69, 0xb7, 0x19, 0x88, 0x69, 0xd5, 0x99, 0x96, 0x27, 0x07, 0x48,
+	0x48, 0xc7, 0x77, 0x08, 0x78, 0x1a, 0x98, 0x66, 0x77, 0xb2, 0xcb, 0x18,
+	0x78, 0x27, 0x46, 0xde, 0x07, 0x49, 0xb7, 0x47, 0x59, 0xb7, 0x69, 0xd6,
+	0x74, 0x74, 0x70, 0x64, 0x65, 0xd1, 0xd1, 0x89, 0xb9, 0xd9, 0x55, 0x1d,
+	0x26, 0x67, 0x66, 0xe7, 0x69, 0xc9, 0xb9, 0xc1, 0x99, 0xda, 0x62, 0x73,
+	0x18, 0x9d, 0x66, 0x5d, 0x98, 0x9d, 0x1c, 0x95, 0xc2, 0x6e, 0x61, 0xc9,
+	0xa6, 0x11, 0xc9, 0xc5, 0x66, 0x1c, 0x62, 0x65, 0x5a, 0x78, 0x1b, 0x61,
+	0xd1, 0xc1, 0x87, 0x06, 0x5d, 0xa7, 0x65, 0x71, 0x71, 0x71, 0x72, 0x65,
+	0xd5, 0x87, 0x79, 0x87, 0x34, 0x91, 0xb6, 0x9c, 0x26, 0xd1, 0x62, 0x47,
+	0x36, 0x26, 0x91, 0xd9, 0xc9, 0xc9, 0xd2, 0x59, 0x58, 0x61, 0x1d, 0x1d,
+	0x18, 0x73, 0x19, 0x65, 0xcb, 0x1c, 0xe6, 0x26, 0xde, 0x03, 0x3d, 0xdc,
+	0x27, 0x39, 0xda, 0x76, 0x9d, 0x98, 0xb9, 0x70, 0x27, 0x59, 0xc9, 0xd2,
+	0x71, 0x47, 0x39, 0x18, 0x61, 0x89, 0xb9, 0xd6, 0x75, 0x61, 0xd1, 0xdd,
+	0xdd, 0xdd, 0x87, 0x76, 0x9d, 0x27, 0x74, 0x98, 0x9a, 0x59, 0xd5, 0x5d,
+	0xe7, 0x77, 0x0b, 0x9b, 0xc2, 0xf0, 0x76, 0xbb, 0x65, 0x1a, 0xbd, 0x1b,
+	0xbb, 0xa6, 0x5c, 0x5c, 0xd8, 0xbb, 0x9c, 0x27, 0x26, 0xdd, 0x5a, 0xb8,
+	0x9c, 0x6d, 0x99, 0x65, 0xca, 0xf4, 0x71, 0x9a, 0x65, 0xb6, 0x25, 0x77,
+	0xbc, 0xa7, 0x12, 0x65, 0x94, 0x6a, 0x65, 0xc9, 0x64, 0xba, 0xbb, 0x99,
+	0x66, 0x4b, 0xc2, 0xd7, 0x82, 0x62, 0x65, 0xcd, 0x5b, 0x95, 0xd6, 0xc7,
+	0x67, 0x47, 0x56, 0x9c, 0x9c, 0x1c, 0xdc, 0x99, 0x9a, 0x9a, 0xb9, 0x72,
+	0xb8, 0x9c, 0x9d, 0x18, 0x91, 0xd1, 0xde, 0xf0, 0x69, 0x5a, 0x75, 0xbc,
+	0x16, 0x9a, 0x62, 0x61, 0x97, 0x27, 0x27, 0x16, 0x22, 0x61, 0xb4, 0x61,
+	0x5d, 0x58, 0x56, 0x18, 0x61, 0xc5, 0x8a, 0x71, 0x6d, 0x96, 0x58, 0x72,
+	0x57, 0x27, 0x39, 0xb4, 0x70, 0x76, 0x44, 0x70, 0x98, 0x72, 0x9b, 0x9c,
+	0x16, 0x77, 0x9c, 0x21, 0xda, 0x1a, 0x54, 0x76, 0x61, 0xdd, 0x87, 0x76,
+	0x9e, 0x07, 0x78, 0x65, 0xa6, 0x9c, 0xde, 0x07, 0x82, 0x1d, 0x1c, 0x98,
+	0x6e, 0x61, 0x96, 0x27, 0x16, 0x6f, 0x07, 0x47, 0x77, 0x37, 0x59, 0xc6,
+	0xc7, 0x0b, 0xb9, 0x87, 0x17, 0x14, 0x75, 0x71, 0x6e, 0x76, 0xaa, 0xa2,
+	0x99, 0x46, 0xa6, 0x9c, 0x65, 0x62, 0x76, 0x74, 0x59, 0xcd, 0xd5, 0x89,
+	0xd9, 0x98, 0x9c, 0x27, 0x19, 0x67, 0x67, 0x59, 0x87, 0x56, 0xdb, 0x61,
+	0x94, 0x9c, 0x5c, 0xa7, 0x68, 0x9c, 0x67, 0x39, 0xd9, 0xc2, 0x24, 0x1d,
+	0x5d, 0xa7, 0x56, 0x67, 0x47, 0x59, 0x87, 0x82, 0x12, 0x78, 0x19, 0x9e,
+	0x09, 0x97, 0x16, 0x1d, 0xd5, 0xde, 0x78, 0x24, 0x59, 0x1c, 0xe7, 0x19,
+	0x87, 0x07, 0x27, 0x07, 0x15, 0x9c, 0xe7, 0x69, 0xda, 0x76, 0x27, 0x66,
+	0x51, 0xa9, 0xc2, 0x71, 0x58, 0x87, 0x59, 0x92, 0x73, 0x69, 0xa7, 0x71,
+	0xb6, 0x1c, 0x61, 0x5c, 0x1c, 0x5a, 0x95, 0xce, 0x74, 0x72, 0x91, 0xc5,
+	0xcd, 0xc9, 0xb6, 0x25, 0x6d, 0xc5, 0xd5, 0xcd, 0xd1, 0xc0, 0x72, 0x6d,
+	0xd5, 0xc9, 0xb9, 0x87, 0x46, 0xdb, 0x9d, 0xdb, 0x69, 0xc2, 0x71, 0x61,
+	0xc2, 0x6d, 0xd1, 0x87, 0x55, 0x74, 0x78, 0x1d, 0x15, 0xdd, 0xd1, 0xd1,
+	0xe0, 0x70, 0x72, 0x70, 0x71, 0x57, 0x47, 0x46, 0x98, 0x6d, 0xb7, 0x27,
+	0x47, 0x46, 0xde, 0x01, 0xa6, 0x1c, 0x1c, 0x18, 0x76, 0x6d, 0x97, 0x81,
+	0xd1, 0xc5, 0x99, 0xcd, 0xda, 0x47, 0x37, 0x39, 0xdd, 0xa7, 0x47, 0x49,
+	0xd5, 0xc9, 0x5d, 0x5e, 0x07, 0x81, 0xe0, 0x73, 0xb8, 0x70, 0x72, 0x71,
+	0x71, 0x95, 0x64, 0x69, 0xc5, 0xce, 0x46, 0x9c, 0xe4, 0x57, 0x27, 0x16,
+	0x98, 0x47, 0x57, 0x21, 0xd2, 0x75, 0x6b, 0x3a, 0x73, 0x71, 0x99, 0x66,
+	0xea, 0xf0, 0xbc, 0x2e, 0xd8, 0x9d, 0xda, 0x9c, 0xe6, 0x1d, 0xd8, 0x89,
+	0x86, 0xa7, 0x02, 0x27, 0x32, 0xf1, 0x1c, 0x2f, 0x1b, 0x5d, 0xda, 0x2e,
+	0x25, 0x76, 0x70, 0x70, 0x9d, 0xa7, 0x46, 0x1c, 0x9a, 0x62, 0xf1, 0x9b,
+	0x71, 0x6d, 0xd1, 0xa9, 0xe0, 0x9c, 0x67, 0x37, 0x29, 0xa7, 0x0b, 0xc1,
+	0xa6, 0x2f, 0x59, 0xc1, 0xa6, 0x5c, 0x96, 0xc9, 0xe0, 0x62, 0x71, 0x71,
+	0xb8, 0x6d, 0xd5, 0x98, 0x4b, 0x86, 0x5c, 0x59, 0x57, 0x77, 0x27, 0x81,
+	0xd5, 0xc9, 0x97, 0x66, 0xd2, 0x65, 0xb1, 0x96, 0x07, 0x2b, 0x86, 0x1b,
+	0x77, 0x70, 0x73, 0x70, 0x9c, 0x5d, 0x2e, 0x1c, 0x24, 0x91, 0xe0, 0x74,
+	0x71, 0x6a, 0x45, 0x55, 0x49, 0xd5, 0x97, 0x49, 0xc1, 0xc2, 0x70, 0x6d,
+	0xc1, 0xa9, 0x86, 0x1a, 0x69, 0xc1, 0x88, 0x5b, 0x84, 0x71, 0x6d, 0x5c,
+	0x1b, 0x76, 0x76, 0x69, 0xa6, 0x64, 0x71, 0x56, 0x61, 0x5c, 0xda, 0x75,
+	0x78, 0x19, 0x6a, 0x17, 0x1c, 0xb1, 0x9c, 0xf8, 0x27, 0x16, 0x5b, 0x73,
+	0x57, 0x37, 0x37, 0x49, 0xc2, 0x6a, 0x6e, 0x65, 0xc2, 0x65, 0xa7, 0x80,
+	0x95, 0xd1, 0x87, 0x39, 0xb7, 0x09, 0xa9, 0xa7, 0x67, 0x16, 0x5c, 0x26,
+	0x55, 0xce, 0x21, 0xd1, 0xda, 0x9b, 0x9e, 0x09, 0xc5, 0xcd, 0xcd, 0x95,
+	0x55, 0x75, 0x65, 0xd5, 0xc9, 0x95, 0xb1, 0xc1, 0xb1, 0x87, 0x36, 0xa5,
+	0x72, 0x56, 0xa7, 0x67, 0x76, 0x24, 0x91, 0xa7, 0x27, 0x0b, 0xd9, 0xb6,
+	0x5d, 0xda, 0x62, 0x6d, 0x5e, 0x09, 0x96, 0xdb, 0x9b, 0x77, 0x69, 0xe0,
+	0x72, 0x6d, 0xb7, 0x16, 0x1d, 0x9d, 0x9a, 0x65, 0x95, 0x77, 0x59, 0xb6,
+	0x67, 0x44, 0x74, 0x6e, 0x69, 0xbc, 0x47, 0x67, 0x09, 0xc1, 0xb6, 0x9d,
+	0xdc, 0x58, 0x46, 0x26, 0x66, 0x99, 0x86, 0x5c, 0x9d, 0xd5, 0xdd, 0xcd,
+	0x99, 0xa6, 0x5c, 0x58, 0x55, 0x71, 0x55, 0x65, 0x5e, 0x06, 0xa7, 0x77,
+	0x27, 0x66, 0x51, 0xa7, 0x67, 0x05, 0x72, 0x75, 0x6e, 0x62, 0x69, 0x5d,
+	0x26, 0x9b, 0x6d, 0xc1, 0xd2, 0x72, 0x56, 0x59, 0x70, 0x61, 0xd5, 0xd5,
+	0xa4, 0x61, 0x5a, 0x61, 0x58, 0x65, 0xdd, 0xc0, 0x70, 0x87, 0x76, 0xe5,
+	0x77, 0x91, 0x96, 0x5c, 0xdd, 0x5d, 0x55, 0x87, 0x56, 0x18, 0x49, 0xcd,
+	0x97, 0x07, 0x25, 0x69, 0xdd, 0x67, 0x69, 0xdb, 0x3c, 0xd8, 0x9c, 0xe7,
+	0x37, 0x09, 0x1e, 0x06, 0xa7, 0x07, 0x79, 0xb6, 0x1c, 0x5b, 0x9c, 0x11,
+	0x96, 0xdd, 0xa4, 0x65, 0x1c, 0x1c, 0xe5, 0x9b, 0x75, 0x66, 0x71, 0x76,
+	0x77, 0x9c, 0xd9, 0x27, 0x39, 0xc9, 0x5c, 0xdc, 0xdd, 0x58, 0x65, 0xd2,
+	0x72, 0x75, 0x70, 0x6a, 0x57, 0x46, 0x1c, 0x59, 0x70, 0x6d, 0x67, 0x27,
+	0x67, 0x29, 0xcd, 0xc1, 0x5a, 0x71, 0x75, 0x6e, 0x61, 0x99, 0xc2, 0x70,
+	0x9c, 0x18, 0x70, 0x70, 0x72, 0x70, 0x65, 0xc5, 0x1c, 0xa7, 0x26, 0x58,
+	0x9b, 0x96, 0x71, 0x78, 0x24, 0x75, 0x74, 0x73, 0x74, 0x69, 0xca, 0x70,
+	0x61, 0xb4, 0x61, 0xc2, 0x55, 0x71, 0x75, 0x9c, 0x5d, 0x9c, 0x99, 0x49,
+	0xcd, 0xb7, 0x17, 0x75, 0x57, 0x45, 0x57, 0x35, 0x75, 0x71, 0x60, 0x70,
+	0x65, 0xb8, 0x69, 0xd5, 0x97, 0x16, 0x95, 0x96, 0x5d, 0x5d, 0x5d, 0x59,
+	0x73, 0x6d, 0xd9, 0x1d, 0xe1, 0xc9, 0x87, 0x17, 0x81, 0x5c, 0x9c, 0x1d,
+	0x12, 0x71, 0x90, 0x9d, 0xa1, 0xdd, 0xc5, 0x1d, 0x1e, 0x07, 0x57, 0x46,
+	0x51, 0xa4, 0x73, 0x74, 0x46, 0x25, 0x6c, 0xa9, 0x19, 0x66, 0x56, 0x5c,
+	0x99, 0x71, 0x75, 0x69, 0xc2, 0x61, 0xa9, 0x1c, 0xe6, 0x18, 0x75, 0x45,
+	0x98, 0x86, 0x1a, 0x6d, 0x5d, 0xdc, 0xdd, 0x5d, 0x9c, 0x9c, 0xda, 0x75,
+	0xcd, 0x98, 0x33, 0x97, 0x3b, 0xc5, 0xda, 0xc1, 0xc9, 0xe0, 0x99, 0x6e,
+	0xf4, 0x9d, 0xa2, 0x19, 0x00, 0x0b, 0xcd, 0xc5, 0x94, 0x61, 0xb6, 0xd9,
+	0x6f, 0x08, 0xc2, 0x22, 0x75, 0xc6, 0x40, 0x00, 0x00, 0x44, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x86, 0x35, 0xc9, 0xd6, 0xcb, 0x2c, 0x71,
+	0x5c, 0x75, 0x1a, 0x01, 0xb4, 0xbd, 0x67, 0x58, 0x89, 0xd6, 0x66, 0x75,
+	0x70, 0x9b, 0x61, 0xb4, 0x62, 0x40, 0x10, 0x00, 0x07, 0x39, 0x24, 0x65,
+	0xe0, 0x00, 0x00, 0x01, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x46,
+	0x0c, 0xc9, 0xca, 0x72, 0x71, 0x73, 0xb2, 0x27, 0x06, 0x67, 0x82, 0x76,
+	0x95, 0x88, 0x45, 0x98, 0xbc, 0x91, 0xcd, 0xc9, 0x11, 0xc1, 0xd5, 0xc1,
+	0x5c, 0x96, 0xe5, 0xd5, 0xd1, 0xd1, 0x18, 0x72, 0x73, 0x65, 0xd6, 0xc8,
+	0x26, 0x1c, 0xec, 0x76, 0xb0, 0x75, 0x78, 0x25, 0x6e, 0xcb, 0x1e, 0x07,
+	0x81, 0x99, 0xc9, 0xc5, 0x94, 0x61, 0xb6, 0xd9, 0x6d, 0xd9, 0xda, 0x70,
+	0x9c, 0x40, 0x00, 0x00, 0x44, 0x00, 0x00, 0x46, 0x18, 0x9c, 0x9c, 0xb3,
+	0x1b, 0xa9, 0xe0, 0xbd, 0x5a, 0x00, 0x1b, 0x47, 0x67, 0x67, 0x67, 0x66,
+	0x40, 0x69, 0xd5, 0xd5, 0xd9, 0xd4, 0x00, 0x00, 0x04, 0x40, 0x00, 0x04,
+	0x60, 0x9d, 0xa5, 0x70, 0x71, 0x9c, 0x49, 0xa4, 0x61, 0x67, 0x22, 0xe5,
+	0x99, 0xcd, 0xa9, 0xda, 0x76, 0x59, 0xc1, 0x1c, 0x1c, 0x67, 0x31, 0x97,
+	0x49, 0xcd, 0xbb, 0xca, 0x6a, 0x69, 0xe0, 0x65, 0xd5, 0xd9, 0x5c, 0x5d,
+	0x1b, 0x61, 0xd9, 0x8a, 0x12, 0xf4, 0x65, 0xd1, 0xd1, 0x5c, 0x29, 0xd5,
+	0x89, 0x17, 0x58, 0x98, 0x78, 0x1e, 0x04, 0x71, 0x69, 0xc1, 0xe0, 0x6e,
+	0x57, 0x56, 0x9c, 0xdb, 0x77, 0x85, 0x92, 0x57, 0x44, 0x9a, 0x72, 0x91,
+	0x97, 0x37, 0x82, 0x6d, 0xcb, 0x39, 0x75, 0x99, 0x61, 0xc2, 0x65, 0xc5,
+	0x84, 0x96, 0x6d, 0xc1, 0xe0, 0x99, 0x66, 0xf5, 0x70, 0x91, 0x86, 0x98,
+	0x47, 0x17, 0x17, 0x16, 0x1c, 0x5b, 0x71, 0x70, 0x74, 0x6e, 0x62, 0xf4,
+	0x86, 0x91, 0xd9, 0xa9, 0xb9, 0xc5, 0xd5, 0xb9, 0x97, 0x81, 0x64, 0x74,
+	0x78, 0x2f, 0x81, 0x25, 0x72, 0x6e, 0x74, 0x47, 0x1c, 0x73, 0x6a, 0x73,
+	0x70, 0x99, 0x69, 0xb7, 0x48, 0x62, 0x72, 0x6d, 0xbb, 0xc2, 0x47, 0x07,
+	0x19, 0xd2, 0x62, 0x46, 0x26, 0x5d, 0x27, 0x57, 0x15, 0x73, 0x9c, 0x95,
+	0xa6, 0xdc, 0x5c, 0x95, 0xa7, 0x78, 0x74, 0x46, 0x1d, 0x5c, 0x99, 0x72,
+	0x70, 0x9c, 0x98, 0x65, 0xc1, 0xb5, 0x61, 0xa6, 0x1c, 0x5a, 0x74, 0x65,
+	0x96, 0x5b, 0x62, 0x6d, 0xc1, 0x87, 0x09, 0xc6, 0x69, 0x89, 0xc1, 0x1c,
+	0xdc, 0x65, 0x89, 0x86, 0x5d, 0x9a, 0x73, 0x62, 0x71, 0x61, 0xb9, 0x86,
+	0xdc, 0x55, 0x66, 0x92, 0x1d, 0x1c, 0x1e, 0x05, 0x70, 0x46, 0x9d, 0x51,
+	0x1c, 0x9d, 0x1c, 0x26, 0x18, 0x9b, 0x1d, 0xda, 0x77, 0xbd, 0x9c, 0x1c,
+	0xe7, 0x29, 0xb5, 0x61, 0xca, 0x47, 0x67, 0x75, 0x56, 0x5d, 0x11, 0xc5,
+	0xdd, 0x97, 0x17, 0x81, 0xb6, 0x9b, 0x61, 0xc1, 0xda, 0x75, 0x67, 0x1c,
+	0x2f, 0x3c, 0x71, 0xc6, 0xcc, 0x71, 0x65, 0x1a, 0x72, 0x75, 0x9d, 0xdd,
+	0x1e, 0x06, 0x59, 0x95, 0xb9, 0xa9, 0x86, 0x9a, 0x9c, 0x52, 0x78, 0x26,
+	0xa6, 0x26, 0x66, 0x52, 0x69, 0xd9, 0xcd, 0x99, 0xa7, 0x33, 0x16, 0x73,
+	0x75, 0x78, 0x1b, 0x92, 0x27, 0x76, 0xa4, 0x6d, 0xd2, 0x95, 0x86, 0x64,
+	0x47, 0x81, 0xe0, 0x44, 0x70, 0x74, 0x98, 0x71, 0x76, 0x91, 0x86, 0x2f,
+	0x24, 0x62, 0x75, 0x1c, 0xd1, 0x87, 0x37, 0x25, 0x73, 0x62, 0x75, 0x61,
+	0xc9, 0xa5, 0x69, 0xa5, 0x9d, 0x9c, 0x9d, 0x58, 0x73, 0x56, 0x5c, 0x1c,
+	0xd9, 0x6a, 0x15, 0xc6, 0xd5, 0x1c, 0x5a, 0x76, 0x47, 0x36, 0x1c, 0x58,
+	0xbc, 0xda, 0xd6, 0x67, 0x07, 0x69, 0x1c, 0xa6, 0x11, 0x87, 0x67, 0x56,
+	0x64, 0x9c, 0x5d, 0x67, 0x17, 0x26, 0xdb, 0x46, 0x66, 0x1c, 0x16, 0x26,
+	0x16, 0x69, 0x5a, 0x65, 0xd1, 0xa6, 0x18, 0x57, 0x05, 0x75, 0x6e, 0x56,
+	0xd9, 0xb9, 0x70, 0x74, 0x9c, 0x99, 0x62, 0x73, 0x73, 0x61, 0xb7, 0x47,
+	0x77, 0x77, 0x07, 0x07, 0x06, 0x06, 0x1a, 0x6a, 0x47, 0x16, 0x5d, 0x9d,
+	0x15, 0xc6, 0x75, 0x75, 0x70, 0x74, 0x69, 0xcd, 0xc5, 0x66, 0xa7, 0x29,
+	0xa7, 0x76, 0x9a, 0x6d, 0xde, 0x1a, 0x65, 0x55, 0x5d, 0x15, 0xda, 0x46,
+	0x5c, 0x1c, 0x56, 0x72, 0x51, 0xb6, 0x59, 0x47, 0x27, 0x06, 0x27, 0x47,
+	0x82, 0x75, 0x75, 0x61, 0xd5, 0x1a, 0x95, 0x89, 0x86, 0x25, 0x72, 0x62,
+	0x65, 0xd5, 0xd6, 0x71, 0x94, 0xc7, 0x11, 0xca, 0xdb, 0x6d, 0x1a, 0x2d,
+	0x65, 0x96, 0x4b, 0x59, 0x46, 0xe7, 0x07, 0x77, 0x82, 0x70, 0x88, 0x9c,
+	0x1c, 0x24, 0x69, 0x56, 0x47, 0x16, 0x1d, 0x27, 0x19, 0xb9, 0xd5, 0xc1,
+	0x5c, 0x5d, 0x27, 0x29, 0xc2, 0xf0, 0x73, 0x71, 0x6e, 0x72, 0x9d, 0xdb,
+	0x76, 0x78, 0x07, 0x46, 0xdd, 0x26, 0x1e, 0x04, 0x74, 0xb8, 0x77, 0x75,
+	0x71, 0x98, 0x78, 0x1b, 0x73, 0x70, 0x56, 0x58, 0x74, 0x15, 0xd5, 0x49,
+	0xc6, 0x1a, 0x73, 0x88, 0x70, 0x70, 0x1d, 0x5b, 0x87, 0x47, 0x77, 0x59,
+	0x96, 0x9c, 0x9c, 0x25, 0x99, 0x76, 0x74, 0x9c, 0xdd, 0x29, 0xa7, 0x79,
+	0x86, 0x6e, 0x1d, 0x5d, 0x6e, 0xd9, 0x9c, 0x9b, 0x55, 0x9d, 0xde, 0x09,
+	0x27, 0x35, 0x99, 0x98, 0x70, 0x6e, 0x69, 0x66, 0x91, 0xc1, 0xc2, 0x6e,
+	0x6d, 0x5e, 0x07, 0x37, 0x07, 0x81, 0xdd, 0xc9, 0x86, 0x5c, 0x98, 0x6a,
+	0x47, 0x47, 0x77, 0x07, 0x57, 0x47, 0x27, 0x79, 0xc2, 0x6d, 0xe0, 0x74,
+	0x6d, 0xb6, 0xda, 0x75, 0x98, 0x69, 0xc2, 0x65, 0x96, 0xa7, 0x07, 0x57,
+	0x61, 0xe0, 0x75, 0x6d, 0x16, 0x71, 0x45, 0x47, 0x67, 0x81, 0x5c, 0x9b,
+	0x74, 0x98, 0x55, 0x75, 0x61, 0x96, 0x9a, 0x56, 0x9c, 0x5d, 0x9c, 0x9e,
+	0x06, 0x9b, 0x65, 0x95, 0x6d, 0xc9, 0xc5, 0x89, 0x5b, 0x74, 0x6d, 0x5d,
+	0x1c, 0x5d, 0xdd, 0x66, 0x27, 0x17, 0x39, 0xc5, 0xd9, 0xda, 0x65, 0xdd,
+	0xd6, 0x41, 0x97, 0x34, 0x75, 0x78, 0x15, 0xce, 0x70, 0x58, 0x9a, 0x51,
+	0xb6, 0xa2, 0x64, 0x59, 0x5d, 0x15, 0xc5, 0xe0, 0x71, 0x62, 0x73, 0x78,
+	0x1e, 0x07, 0x77, 0x05, 0x72, 0x75, 0x75, 0x78, 0x26, 0x1c, 0xdc, 0x5b,
+	0x9b, 0x9c, 0x1b, 0x76, 0x9b, 0x1d, 0x1b, 0x74, 0x9c, 0xde, 0x04, 0x74,
+	0x76, 0x96, 0x71, 0x70, 0x74, 0x72, 0x89, 0x5e, 0x07, 0x67, 0x36, 0x95,
+	0x55, 0xd9, 0x5b, 0x6d, 0xde, 0x6e, 0x61, 0x59, 0x77, 0x71, 0x77, 0x73,
+	0x72, 0x76, 0x99, 0x57, 0x46, 0x26, 0x98, 0x77, 0x72, 0x73, 0x99, 0x70,
+	0x75, 0x73, 0x70, 0x6e, 0x19, 0x61, 0x21, 0xc1, 0xd1, 0xe0, 0x65, 0x1a,
+	0x70, 0x6d, 0x86, 0x1c, 0x9b, 0x75, 0x61, 0xd1, 0x97, 0x81, 0xc2, 0x47,
+	0x66, 0xdc, 0xdd, 0x9d, 0x58, 0x4b, 0xa7, 0x17, 0x77, 0x46, 0x5d, 0xdb,
+	0x87, 0x17, 0x82, 0x19, 0x70, 0x78, 0x1c, 0x65, 0x72, 0x74, 0x74, 0x6d,
+	0x5c, 0xa1, 0xdd, 0xd6, 0x6d, 0xd7, 0x19, 0x77, 0x70, 0x91, 0xce, 0x65,
+	0xc3, 0x19, 0x9d, 0x20, 0x9c, 0x6a, 0xa8, 0x9d, 0x19, 0x47, 0x82, 0x6e,
+	0x62, 0x6a, 0x26, 0xd9, 0x91, 0xb9, 0x27, 0x06, 0x58, 0x6a, 0x6d, 0xa4,
+	0x62, 0x70, 0x73, 0x65, 0xc9, 0x99, 0xc1, 0xc6, 0x71, 0x45, 0x46, 0xdd,
+	0x55, 0xd5, 0xb7, 0x26, 0x9c, 0x9c, 0x99, 0x57, 0x57, 0x06, 0x1d, 0x66,
+	0x9c, 0x1d, 0xa7, 0x07, 0x37, 0x56, 0x27, 0x01, 0xb7, 0x19, 0xcd, 0xcd,
+	0xc9, 0x1e, 0x07, 0x07, 0x66, 0x1d, 0x66, 0xd1, 0xd5, 0xd5, 0xa5, 0x78,
+	0x1c, 0x9c, 0x5c, 0x9d, 0x5d, 0x58, 0x65, 0xc9, 0x87, 0x06, 0x1c, 0x5c,
+	0x59, 0x76, 0x69, 0x97, 0x57, 0x37, 0x26, 0x9b, 0x9d, 0x9d, 0x1c, 0x1c,
+	0x24, 0xb8, 0x6d, 0xc9, 0x99, 0x84, 0x54, 0x76, 0x78, 0x15, 0xc1, 0xb7,
+	0x47, 0x72, 0xc6, 0x18, 0x78, 0x18, 0x6d, 0x97, 0x59, 0x96, 0x9c, 0x71,
+	0x66, 0x0b, 0xd6, 0xf2, 0xcf, 0x82, 0xf4, 0x9a, 0x71, 0x73, 0x74, 0xc7,
+	0x27, 0x69, 0x94, 0x99, 0x49, 0x99, 0x95, 0x6f, 0x1c, 0x99, 0x66, 0x6a,
+	0x72, 0x74, 0x66, 0x73, 0x98, 0x98, 0x98, 0xb2, 0x50, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04, 0x61, 0x8c, 0x1d, 0xb1,
+	0x84, 0x99, 0x74, 0x99, 0x60, 0x1a, 0x49, 0xb1, 0x1a, 0x69, 0xa6, 0x2f,
+	0x18, 0x9c, 0x5a, 0x69, 0x18, 0x86, 0xdc, 0x93, 0x3a, 0x47, 0x26, 0xdc,
+	0x18, 0x9d, 0x66, 0xdc, 0x66, 0x1a, 0x9d, 0x1b, 0x1c, 0xe4, 0x92, 0x59,
+	0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04,
+	0x61, 0x89, 0x46, 0xe7, 0x81, 0xd2, 0x6d, 0x89, 0x11, 0x99, 0xc9, 0xe0,
+	0x61, 0xde, 0x78, 0x26, 0xe6, 0x27, 0x27, 0x19, 0x97, 0x0b, 0xc5, 0x86,
+	0x2f, 0x47, 0x39, 0xca, 0x62, 0x60, 0xc5, 0x96, 0x57, 0x47, 0x34, 0x73,
+	0x76, 0x87, 0x49, 0x1b, 0x69, 0xb6, 0xdd, 0x55, 0xb7, 0x27, 0x82, 0x73,
+	0x74, 0x65, 0x1a, 0x72, 0x70, 0x9d, 0x5d, 0xc9, 0xbc, 0x49, 0xc6, 0x75,
+	0x77, 0x91, 0xce, 0xf2, 0x61, 0x87, 0x69, 0x5d, 0xa5, 0x70, 0x9e, 0x09,
+	0x89, 0x89, 0x89, 0x87, 0x46, 0x67, 0x79, 0x89, 0x89, 0x89, 0xb9, 0x80,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x62, 0x76, 0x76, 0x9d, 0x92, 0x69,
+	0xd2, 0x65, 0x80, 0x69, 0x31, 0xc5, 0x1a, 0x69, 0xa6, 0x18, 0x9d, 0x98,
+	0x9b, 0x65, 0xc1, 0xcd, 0xcd, 0xd1, 0xd4, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x46, 0x0b, 0xde, 0x9c, 0x5c, 0x52, 0x49, 0x99, 0x99, 0x96, 0x67, 0x16,
+	0xef, 0x76, 0x98, 0xbb, 0x9d, 0x9a, 0x9c, 0xe6, 0x99, 0x71, 0x65, 0xa7,
+	0x09, 0xc5, 0xe0, 0x27, 0x19, 0x1b, 0x92, 0x47, 0x26, 0x1e, 0x07, 0x58,
+	0x9a, 0x57, 0x59, 0x67, 0x49, 0x67, 0x07, 0x26, 0xe4, 0x55, 0x6d, 0x1c,
+	0x51, 0xc2, 0x61, 0x71, 0xd5, 0xd9, 0xda, 0xf1, 0x72, 0x69, 0xc5, 0x6f,
+	0x2b, 0x5d, 0x59, 0x66, 0x75, 0x72, 0x57, 0x07, 0x64, 0x69, 0x1d, 0x9d,
+	0x95, 0xd9, 0xc1, 0xd9, 0xc5, 0xc2, 0x15, 0x65, 0x69, 0x87, 0x57, 0x37,
+	0x76, 0x59, 0xb8, 0x65, 0xd5, 0xe0, 0x69, 0xa6, 0x5c, 0x27, 0x06, 0x01,
+	0xcd, 0xcd, 0xb6, 0x1d, 0x56, 0x65, 0xd9, 0x86, 0x26, 0x5a, 0x87, 0x39,
+	0xb7, 0x4c, 0x55, 0x6a, 0x70, 0x75, 0x72, 0x61, 0xc6, 0x66, 0xea, 0x48,
+	0x6a, 0x6d, 0x8b, 0xc4, 0x71, 0x78, 0x1a, 0x72, 0x78, 0x15, 0xa6, 0x26,
+	0x46, 0xe4, 0x69, 0xc5, 0xd1, 0x5d, 0x25, 0x55, 0x77, 0x70, 0x62, 0x6e,
+	0x6b, 0x15, 0xd5, 0x86, 0x1d, 0x5a, 0x77, 0x72, 0x78, 0x1c, 0x24, 0xb8,
+	0x6d, 0xc9, 0xc9, 0xc2, 0x70, 0x76, 0x9c, 0x33, 0xa9, 0xc1, 0xc6, 0xf8,
+	0x24, 0x72, 0x77, 0x72, 0x72, 0x6e, 0x6e, 0x61, 0xa6, 0x1d, 0x5a, 0x71,
+	0x62, 0x56, 0xe2, 0x1a, 0x95, 0xc5, 0xc2, 0x47, 0x66, 0x1d, 0x9d, 0x1a,
+	0x95, 0xcd, 0x5a, 0x65, 0xc9, 0x89, 0xb6, 0xdc, 0x1b, 0x57, 0x57, 0x17,
+	0x27, 0x79, 0xd9, 0xc9, 0x86, 0x5c, 0x98, 0x70, 0x85, 0x57, 0x25, 0x74,
+	0xc6, 0x67, 0x17, 0x29, 0x5a, 0x6d, 0xd9, 0x51, 0xd9, 0x59, 0x69, 0x89,
+	0x5c, 0x96, 0x6d, 0xb0, 0x71, 0x91, 0xc1, 0xe0, 0x65, 0x96, 0x5c, 0x18,
+	0x95, 0xdd, 0xb4, 0x57, 0x07, 0x46, 0x98, 0x61, 0xc6, 0x57, 0x26, 0x9b,
+	0x72, 0x72, 0x75, 0x70, 0x6d, 0xb7, 0x67, 0x76, 0x67, 0x15, 0x56, 0x5d,
+	0x11, 0xe0, 0x73, 0x91, 0x15, 0x1d, 0x1d, 0x95, 0xac, 0x61, 0xc1, 0x5c,
+	0xdd, 0x26, 0xa4, 0x75, 0x46, 0x1c, 0xdb, 0x70, 0x59, 0x96, 0x24, 0x74,
+	0x66, 0x47, 0x29, 0x31, 0x87, 0x06, 0x1c, 0xe6, 0x58, 0x06, 0x1a, 0x74,
+	0x56, 0x26, 0x58, 0x62, 0x46, 0xa9, 0xb7, 0x57, 0x68, 0x56, 0x2e, 0x66,
+	0x65, 0x73, 0x69, 0xa7, 0x44, 0x71, 0x69, 0xa6, 0x9b, 0x6d, 0xa6, 0xe9,
+	0x86, 0x27, 0x06, 0xda, 0x70, 0x85, 0x57, 0x66, 0x58, 0x65, 0xa6, 0xa6,
+	0x95, 0x67, 0x46, 0xa7, 0x81, 0xc5, 0xc5, 0x87, 0x17, 0x07, 0x07, 0x15,
+	0x56, 0x5d, 0x9e, 0x09, 0x86, 0x01, 0xb7, 0x81, 0xca, 0x72, 0x70, 0x9d,
+	0xd8, 0x9c, 0x9c, 0x26, 0x1a, 0x74, 0x77, 0x66, 0x54, 0x76, 0x6a, 0x72,
+	0x9c, 0xa6, 0x5d, 0x1b, 0x9e, 0x06, 0xdc, 0xd8, 0x57, 0x07, 0x55, 0x9c,
+	0x5d, 0x1b, 0x61, 0xa7, 0x37, 0x07, 0x67, 0x67, 0x47, 0x05, 0x58, 0x69,
+	0x96, 0x59, 0x62, 0x66, 0x65, 0xa9, 0x85, 0x56, 0x5d, 0x24, 0x57, 0x64,
+	0x73, 0x72, 0x98, 0x45, 0x47, 0x77, 0x81, 0x5a, 0x75, 0x6a, 0x65, 0x80,
+	0x71, 0x49, 0x87, 0x47, 0x57, 0x17, 0x06, 0xda, 0x9b, 0x71, 0xbd, 0x95,
+	0xcb, 0x3d, 0xdd, 0x27, 0x27, 0x36, 0x5d, 0x26, 0x18, 0x61, 0x27, 0x47,
+	0x76, 0x99, 0x70, 0x98, 0x62, 0x65, 0x55, 0x99, 0x89, 0x1b, 0x71, 0x65,
+	0xa7, 0x37, 0x36, 0x1c, 0xe6, 0x1d, 0x1d, 0x1c, 0x1a, 0x9c, 0x58, 0x75,
+	0x1c, 0x5d, 0x5a, 0x72, 0x72, 0x71, 0x75, 0x65, 0x5d, 0x1c, 0x18, 0x9c,
+	0x5c, 0x26, 0x9b, 0x57, 0x07, 0x19, 0xa7, 0x39, 0xe0, 0x98, 0x9a, 0xc7,
+	0x45, 0x75, 0xbe, 0x07, 0x41, 0xde, 0x66, 0x65, 0x86, 0x91, 0xd9, 0x5d,
+	0x1b, 0x95, 0xe0, 0x9c, 0x46, 0x9c, 0x26, 0x1b, 0x61, 0xa9, 0x1c, 0xe6,
+	0x5c, 0x1a, 0x9a, 0x61, 0xcc, 0x71, 0x74, 0x6a, 0x73, 0x73, 0x71, 0x74,
+	0x66, 0x65, 0x27, 0x36, 0x5c, 0x1b, 0x76, 0x9d, 0x1b, 0x87, 0x55, 0x75,
+	0xb1, 0xdd, 0xd6, 0x46, 0x91, 0xa7, 0x27, 0x27, 0x57, 0x76, 0xd5, 0xd1,
+	0x55, 0x86, 0xe6, 0xd9, 0x07, 0x81, 0xa7, 0x81, 0xe0, 0x73, 0x73, 0x6f,
+	0x3c, 0x9d, 0xdc, 0x5c, 0x59, 0x73, 0x99, 0x72, 0x64, 0x62, 0x73, 0x9c,
+	0x1d, 0xb1, 0x85, 0x71, 0xc7, 0x69, 0xa5, 0x71, 0x91, 0xca, 0x44, 0x65,
+	0xd1, 0xd9, 0x64, 0x95, 0x5e, 0x05, 0x70, 0x70, 0x65, 0xc1, 0xb9, 0xc6,
+	0x47, 0x46, 0x9d, 0x5b, 0x6d, 0x1d, 0x1d, 0x6d, 0x6d, 0xce, 0x69, 0xa5,
+	0x62, 0x69, 0xdd, 0x5d, 0x15, 0x5a, 0x61, 0xa7, 0x66, 0x6f, 0x04, 0x9c,
+	0x1d, 0xa6, 0xd8, 0x91, 0xc1, 0xc1, 0x1b, 0x71, 0x69, 0x1d, 0xd9, 0x61,
+	0xa6, 0xdd, 0x27, 0x76, 0x9d, 0x49, 0xa9, 0xc0, 0xb8, 0x73, 0x69, 0xcd,
+	0xd9, 0x5c, 0x5c, 0x98, 0x61, 0xce, 0xf3, 0x72, 0x2f, 0x37, 0x47, 0x2c,
+	0xed, 0xc1, 0xc2, 0x70, 0x73, 0x59, 0xc9, 0xb9, 0x1d, 0xdc, 0x18, 0x89,
+	0x5b, 0x65, 0x99, 0xc6, 0x65, 0x1c, 0x51, 0xb9, 0xc1, 0x6f, 0x46, 0x19,
+	0x61, 0xd5, 0xb7, 0x06, 0x9c, 0xd5, 0xb7, 0x47, 0x36, 0x11, 0xb9, 0x97,
+	0x19, 0x96, 0x5d, 0xe4, 0x98, 0x9c, 0x15, 0xcb, 0x1a, 0x6d, 0xdd, 0xc5,
+	0x97, 0x81, 0xd5, 0x59, 0x47, 0x81, 0x96, 0x67, 0x29, 0x5c, 0x5b, 0xb1,
+	0xb9, 0x58, 0x57, 0x07, 0x35, 0x91, 0xd1, 0xb6, 0x1a, 0x73, 0x70, 0x66,
+	0x57, 0x36, 0x1c, 0x65, 0x99, 0x1c, 0xdc, 0x9d, 0x21, 0xc2, 0x76, 0x9b,
+	0x57, 0x77, 0x65, 0x59, 0x15, 0xc9, 0x1c, 0x59, 0x75, 0x6d, 0x5d, 0x5d,
+	0x1c, 0x26, 0xae, 0x5c, 0x95, 0xe0, 0x75, 0x45, 0x46, 0xdc, 0xd6, 0x6d,
+	0xb0, 0x74, 0x91, 0x96, 0xd9, 0x74, 0x9d, 0xdb, 0x9d, 0x95, 0x59, 0x47,
+	0x07, 0x06, 0x21, 0x97, 0x47, 0x81, 0xce, 0x65, 0xb6, 0x1a, 0x56, 0x9c,
+	0x1d, 0xd1, 0x5c, 0x59, 0x69, 0xd5, 0x5c, 0x1c, 0x99, 0x65, 0x95, 0x73,
+	0x71, 0x62, 0x47, 0x07, 0x81, 0xb5, 0x70, 0x71, 0x91, 0xd2, 0x49, 0xdd,
+	0xcd, 0xc1, 0xdd, 0x55, 0xc9, 0x55, 0xdd, 0x5c, 0x52, 0x70, 0x65, 0xa7,
+	0x77, 0x36, 0xda, 0x72, 0x98, 0x71, 0x07, 0x08, 0x71, 0x76, 0x65, 0xde,
+	0x56, 0xe6, 0x15, 0x59, 0x47, 0x07, 0x45, 0x61, 0xd1, 0xd9, 0x87, 0x37,
+	0x66, 0xda, 0x6e, 0x47, 0x16, 0x5a, 0x46, 0x1c, 0x1c, 0x19, 0x9a, 0x77,
+	0xbd, 0x55, 0xca, 0xf5, 0x73, 0x75, 0x98, 0x73, 0x69, 0x19, 0x73, 0x62,
+	0x1e, 0x06, 0xa1, 0x55, 0x97, 0x77, 0x07, 0x81, 0xe0, 0x46, 0x1a, 0x72,
+	0x66, 0xf5, 0x99, 0xbd, 0x5c, 0x9d, 0xe6, 0x5c, 0x5d, 0xd9, 0x57, 0x57,
+	0x36, 0x27, 0x07, 0x07, 0x56, 0xd5, 0xc1, 0xc5, 0xd9, 0xda, 0x70, 0x9c,
+	0x1c, 0xdd, 0x2f, 0x27, 0x27, 0x47, 0x45, 0x73, 0x9c, 0x9c, 0x1d, 0x18,
+	0x57, 0x1b, 0xb9, 0x86, 0xa7, 0x36, 0x9b, 0x66, 0x75, 0x9d, 0x9c, 0x62,
+	0x75, 0x70, 0x09, 0x67, 0x25, 0x78, 0x26, 0x9c, 0x18, 0x69, 0xd6, 0x69,
+	0x99, 0xc1, 0xc1, 0xb9, 0x87, 0x18, 0x75, 0x46, 0x1a, 0x70, 0x65, 0xc1,
+	0xc1, 0x97, 0x07, 0x05, 0x62, 0xf0, 0x70, 0x70, 0x46, 0x26, 0x65, 0x56,
+	0xdc, 0x5a, 0x6d, 0x27, 0x58, 0xbd, 0x15, 0xc2, 0x9a, 0x9d, 0x91, 0xd9,
+	0xcd, 0xa9, 0x87, 0x39, 0x89, 0xa6, 0x64, 0x6d, 0xc5, 0xc9, 0x9b, 0x12,
+	0x70, 0x91, 0xb9, 0x66, 0xda, 0x77, 0x51, 0x58, 0x69, 0xc5, 0xc1, 0xc1,
+	0xa6, 0x9c, 0xd6, 0x69, 0xd9, 0xc5, 0x97, 0x07, 0x67, 0x69, 0xb9, 0x66,
+	0x4c, 0xe2, 0x57, 0x37, 0x07, 0x57, 0x79, 0xb7, 0x36, 0x35, 0xc1, 0xe0,
+	0x70, 0x70, 0x91, 0xd5, 0x96, 0x59, 0x65, 0xcd, 0xc5, 0xe0, 0x24, 0x6e,
+	0x47, 0x37, 0x47, 0x7b, 0xd3, 0x87, 0x59, 0xe0, 0x67, 0x1c, 0xdd, 0xa7,
+	0x07, 0x79, 0x86, 0xa7, 0x1c, 0x73, 0x70, 0x47, 0x16, 0x5a, 0x9a, 0x95,
+	0x89, 0x99, 0x26, 0x5d, 0x9d, 0x5b, 0x99, 0x26, 0x5b, 0x99, 0xce, 0x5a,
+	0x57, 0x26, 0x67, 0x16, 0x5c, 0x5d, 0x25, 0x9c, 0xec, 0x70, 0x69, 0xd2,
+	0x22, 0x27, 0x36, 0x61, 0xd1, 0xd9, 0xd9, 0x87, 0x77, 0x36, 0xe9, 0xa6,
+	0xdc, 0x18, 0xb8, 0x57, 0x57, 0x56, 0xd8, 0x9d, 0xdd, 0xe0, 0x4b, 0x1d,
+	0x26, 0x25, 0x70, 0x89, 0xe0, 0x90, 0x6d, 0xb5, 0x76, 0x6e, 0x6d, 0xc1,
+	0xd9, 0xc6, 0x47, 0x57, 0x14, 0x56, 0x6f, 0x59, 0x93, 0x1a, 0x78, 0x25,
+	0x78, 0x24, 0x70, 0x77, 0xbc, 0x18, 0x74, 0x31, 0x9a, 0x71, 0x70, 0x9c,
+	0xdd, 0xf1, 0xe0, 0x92, 0x70, 0x1a, 0x9c, 0xdd, 0xa7, 0x07, 0x59, 0xc1,
+	0x86, 0xa7, 0x49, 0xc5, 0x99, 0xce, 0xf2, 0x6f, 0x5b, 0x9c, 0x67, 0x12,
+	0x75, 0x73, 0x71, 0x6e, 0x54, 0x73, 0x75, 0x9c, 0x5d, 0xdb, 0x70, 0x78,
+	0x1c, 0x1d, 0x5c, 0x5c, 0x67, 0x57, 0x27, 0x14, 0x61, 0xca, 0x78, 0x1c,
+	0x64, 0x75, 0x70, 0x9d, 0xa7, 0x0d, 0x6d, 0xb6, 0x5c, 0x95, 0x59, 0x78,
+	0x18, 0x9d, 0x1a, 0x74, 0x91, 0xa7, 0x77, 0x17, 0x07, 0x57, 0x56, 0x1d,
+	0x5d, 0x26, 0x26, 0x08, 0x75, 0x72, 0x70, 0x6d, 0xd1, 0x89, 0xd9, 0xb6,
+	0xe7, 0x37, 0x81, 0x96, 0xa7, 0x16, 0x26, 0xd8, 0x73, 0x73, 0x73, 0x62,
+	0x56, 0xc9, 0xd6, 0x1b, 0x6d, 0x5d, 0x1c, 0x27, 0x82, 0x74, 0x75, 0x1b,
+	0x75, 0xce, 0xa5, 0x25, 0x25, 0x6d, 0xca, 0x78, 0x21, 0xca, 0x62, 0x70,
+	0x98, 0x91, 0xc3, 0x3d, 0x53, 0x1c, 0x71, 0x33, 0xcd, 0x17, 0x44, 0xcf,
+	0x81, 0x2e, 0xb1, 0xc7, 0x3c, 0xb3, 0xc1, 0xac, 0xe3, 0x38, 0x73, 0xd6,
+	0x1c, 0x1b, 0xbc, 0x9d, 0xaf, 0x29, 0xce, 0x73, 0x0b, 0x67, 0x79, 0xab,
+	0xc9, 0x55, 0xc2, 0xd4, 0x9d, 0x51, 0xa6, 0xef, 0x09, 0xe0, 0x70, 0x46,
+	0x27, 0x5b, 0xc9, 0xc2, 0x78, 0x27, 0x81, 0x99, 0xe0, 0x71, 0x9e, 0x06,
+	0xe5, 0x47, 0x57, 0x77, 0x5b, 0x6d, 0x98, 0x98, 0x09, 0x1c, 0xdb, 0xb5,
+	0xd5, 0xd1, 0x19, 0x78, 0x18, 0xbb, 0x6e, 0x2e, 0xa6, 0x59, 0x6a, 0x61,
+	0xc1, 0xb9, 0x87, 0x37, 0x36, 0xef, 0x05, 0x96, 0x54, 0x61, 0xa7, 0x16,
+	0x5e, 0x07, 0x06, 0xdc, 0xdd, 0x5d, 0x1d, 0x25, 0x96, 0x52, 0xf2, 0x72,
+	0x75, 0x72, 0x74, 0x56, 0x27, 0x27, 0x07, 0x00, 0x74, 0x9c, 0x9e, 0x09,
+	0xb5, 0x57, 0x04, 0x95, 0xc9, 0x89, 0xb9, 0xb9, 0x87, 0x67, 0x06, 0xa6,
+	0x5c, 0x66, 0x5b, 0x46, 0x1a, 0x72, 0x65, 0xb7, 0x19, 0x95, 0x69, 0xc5,
+	0xb6, 0x24, 0x77, 0x2f, 0x17, 0x46, 0xdb, 0x59, 0xc1, 0xc2, 0xf1, 0x88,
+	0x1b, 0x77, 0x9b, 0x99, 0x99, 0x09, 0x87, 0x59, 0x5c, 0x64, 0x75, 0x46,
+	0x5c, 0xd8, 0x9c, 0x5b, 0x98, 0x78, 0x25, 0x65, 0xac, 0x76, 0x49, 0xa7,
+	0x29, 0x89, 0x11, 0x87, 0x57, 0x56, 0x5b, 0x6a, 0x69, 0xcd, 0xd6, 0x72,
+	0x98, 0x98, 0x98, 0x27, 0x25, 0x55, 0x53, 0x3c, 0xdd, 0x5d, 0xdc, 0xaf,
+	0x49, 0xcd, 0xe0, 0x6a, 0x70, 0x26, 0xdb, 0x77, 0x91, 0x86, 0x55, 0xc6,
+	0x71, 0x73, 0x99, 0x66, 0x71, 0x99, 0x70, 0x9a, 0x65, 0x1a, 0x65, 0xcd,
+	0x97, 0x07, 0x47, 0x37, 0x77, 0x77, 0x77, 0x41, 0xdd, 0xb7, 0x29, 0xd9,
+	0xcd, 0xcd, 0x97, 0x37, 0x37, 0x37, 0x37, 0x31, 0xcd, 0xb7, 0x37, 0x26,
+	0x19, 0x59, 0xb6, 0x1c, 0x91, 0xdd, 0xc6, 0x72, 0x6e, 0x73, 0xbd, 0x55,
+	0xa9, 0x1b, 0x9a, 0x74, 0x78, 0x18, 0x1c, 0x9c, 0x1d, 0xe6, 0x15, 0xc9,
+	0xc9, 0xb6, 0x1c, 0x56, 0x62, 0x49, 0x5b, 0x6d, 0xc5, 0xc9, 0xa6, 0x1c,
+	0x9a, 0x71, 0x62, 0x46, 0xe5, 0x9c, 0x9a, 0x75, 0x71, 0x70, 0x98, 0x76,
+	0x61, 0xd9, 0xd3, 0x1b, 0x6f, 0x1d, 0x24, 0x73, 0x24, 0x9a, 0x77, 0x77,
+	0x70, 0x9c, 0x1c, 0x15, 0xd5, 0xd1, 0xc9, 0x87, 0x77, 0x76, 0x9d, 0xdb,
+	0x69, 0xca, 0x57, 0x17, 0x07, 0x09, 0x66, 0xa6, 0x9e, 0x07, 0x81, 0xd5,
+	0xc9, 0xc9, 0xca, 0x61, 0x51, 0xd5, 0xd1, 0xd9, 0x96, 0x19, 0x78, 0x18,
+	0x24, 0x66, 0x66, 0x69, 0x5d, 0x18, 0x95, 0xc1, 0xd5, 0xc5, 0xc8, 0x77,
+	0x6d, 0xde, 0x6a, 0x0c, 0xf2, 0x1d, 0x6f, 0x0c, 0xe2, 0x57, 0x47, 0x19,
+	0x15, 0x1b, 0xbc, 0xb3, 0xca, 0x73, 0x1d, 0x0b, 0xc6, 0x6d, 0xc5, 0xc1,
+	0x1d, 0x1d, 0x15, 0xd1, 0xd1, 0x51, 0xac, 0x6d, 0xd5, 0xd5, 0xd4, 0xc6,
+	0xd9, 0x46, 0xa7, 0x19, 0x66, 0xa7, 0x09, 0xc9, 0xdd, 0xbb, 0xcb, 0x3d,
+	0xef, 0x83, 0x3d, 0x6e, 0x67, 0x16, 0x35, 0x31, 0x26, 0x26, 0x26, 0x0d,
+	0x65, 0xce, 0xf8, 0x1d, 0xa7, 0x82, 0x96, 0x27, 0x59, 0xcd, 0x86, 0x66,
+	0x26, 0x59, 0x65, 0x86, 0x56, 0x72, 0x77, 0x77, 0x77, 0x27, 0x26, 0x51,
+	0xa7, 0x19, 0xd6, 0xd5, 0xb5, 0xde, 0xa2, 0x78, 0x1c, 0x64, 0x9d, 0xaf,
+	0x66, 0x1c, 0x19, 0x72, 0x62, 0xe9, 0xb7, 0x0b, 0xb6, 0xa6, 0x1c, 0x5c,
+	0x26, 0xa6, 0x98, 0x78, 0x1d, 0x1c, 0x1c, 0x1c, 0x1b, 0xa6, 0x58, 0x47,
+	0x37, 0x07, 0x4b, 0x59, 0x4b, 0xa6, 0xf1, 0x84, 0x78, 0x1a, 0x71, 0x78,
+	0x1d, 0xdd, 0xdb, 0xb9, 0x95, 0xc1, 0xc5, 0xd1, 0xa9, 0x5a, 0x71, 0x71,
+	0x66, 0x1c, 0x05, 0x77, 0x73, 0x57, 0x07, 0x09, 0x18, 0xbc, 0x99, 0x65,
+	0x99, 0x94, 0x76, 0x61, 0xbb, 0xab, 0xdf, 0x3c, 0x58, 0x78, 0x1c, 0x9b,
+	0x78, 0x19, 0x55, 0x71, 0x62, 0x15, 0xda, 0x2f, 0x49, 0x1c, 0x5c, 0x27,
+	0x26, 0xa7, 0x14, 0x9c, 0x9c, 0x9b, 0x46, 0x64, 0xbd, 0x5c, 0x5e, 0x07,
+	0x77, 0x82, 0x73, 0x56, 0x59, 0x9b, 0x78, 0x1e, 0x09, 0x1a, 0x9c, 0x5a,
+	0x75, 0x78, 0x21, 0xc0, 0xbd, 0x5c, 0x27, 0x19, 0x15, 0xa4, 0x6d, 0x65,
+	0x78, 0x1e, 0x06, 0x9d, 0x26, 0x56, 0x6f, 0x3d, 0xe7, 0x27, 0x57, 0x67,
+	0x37, 0x69, 0xbb, 0x87, 0x29, 0xb6, 0x15, 0xd1, 0xd6, 0x41, 0x26, 0xdc,
+	0x66, 0x9b, 0x75, 0x75, 0x59, 0x66, 0x96, 0xaf, 0x27, 0x47, 0x76, 0xdd,
+	0xf3, 0xcf, 0x1a, 0x62, 0x71, 0x12, 0xe1, 0xc9, 0x1c, 0xe7, 0x29, 0x62,
+	0x44, 0x65, 0xe0, 0x9d, 0x1c, 0xe5, 0x6e, 0x74, 0x9d, 0x5c, 0x1c, 0x9c,
+	0x5a, 0x61, 0xc1, 0x96, 0xd9, 0x66, 0x71, 0x9d, 0x5e, 0x07, 0x16, 0x59,
+	0x65, 0xa9, 0xcd, 0xa7, 0x57, 0x37, 0x56, 0x9c, 0xdc, 0x9d, 0x27, 0x25,
+	0x6a, 0x71, 0x75, 0x70, 0x9a, 0x69, 0x87, 0x66, 0x58, 0x73, 0x77, 0x6a,
+	0x46, 0xda, 0x56, 0x5d, 0x49, 0xb7, 0x17, 0x26, 0xdd, 0x9e, 0x05, 0x77,
+	0x61, 0xc3, 0x1d, 0x64, 0x31, 0x67, 0x3b, 0xa8, 0x75, 0x74, 0x9b, 0x54,
+	0x75, 0xcd, 0x61, 0xd9, 0x1d, 0x51, 0xb9, 0x15, 0xb7, 0x36, 0x59, 0x77,
+	0x72, 0x86, 0x6e, 0x62, 0x22, 0xee, 0x76, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x01,
+	0x18, 0x63, 0x3d, 0x1d, 0xb3, 0xdd, 0x27, 0x37, 0x49, 0x96, 0x01, 0xa4,
+	0xb9, 0x11, 0xa6, 0x9a, 0x62, 0xea, 0x27, 0x16, 0x9a, 0x46, 0x21, 0xb7,
+	0x24, 0xce, 0x91, 0xc9, 0xb7, 0x06, 0x2e, 0x26, 0xdc, 0x66, 0x1a, 0x9d,
+	0x5b, 0xbc, 0x67, 0x67, 0x11, 0x88, 0x78, 0x2e, 0xd8, 0x78, 0x12, 0x73,
+	0x6d, 0xdd, 0xc5, 0xc2, 0x70, 0xba, 0x62, 0x84, 0x71, 0x1c, 0xa7, 0x19,
+	0xc6, 0x72, 0x71, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x04, 0x40, 0x00, 0x00, 0x01, 0x18, 0x31, 0x99, 0x26,
+	0x9c, 0x52, 0x6a, 0x76, 0x9c, 0xa7, 0x66, 0x67, 0x76, 0xda, 0x77, 0x60,
+	0x95, 0xa9, 0x5b, 0x71, 0x72, 0x56, 0x6c, 0x9c, 0x95, 0x97, 0x47, 0x15,
+	0x9c, 0xdc, 0x1d, 0x12, 0x65, 0x5c, 0x9b, 0x61, 0x89, 0xb6, 0x98, 0x61,
+	0xcd, 0xdd, 0xe0, 0x6a, 0x9d, 0xe1, 0x87, 0x08, 0x57, 0x36, 0x9d, 0xdd,
+	0xd9, 0x6d, 0xb5, 0x74, 0x73, 0x86, 0x1d, 0xdc, 0x67, 0x7b, 0x87, 0x09,
+	0x9c, 0x71, 0x71, 0x1a, 0x73, 0x72, 0x78, 0x19, 0x65, 0x1d, 0x5c, 0x5d,
+	0x1d, 0x1d, 0x9c, 0x5a, 0x69, 0x51, 0xd9, 0xc1, 0x87, 0x36, 0xa5, 0x65,
+	0x99, 0x97, 0x36, 0xdc, 0x5c, 0x1c, 0xe6, 0x1c, 0x6e, 0x9c, 0xa4, 0x77,
+	0x57, 0x19, 0x56, 0xf8, 0x2f, 0x82, 0xf8, 0x2f, 0x80, 0xc3, 0x17, 0x17,
+	0x1d, 0x71, 0x86, 0x5c, 0x5c, 0xaf, 0x2b, 0xdd, 0xda, 0x49, 0xa6, 0xaf,
+	0x3b, 0xcd, 0xd2, 0x71, 0xc9, 0xa7, 0x37, 0x3a, 0x9d, 0x1d, 0x2d, 0x9d,
+	0x67, 0x2b, 0x62, 0xf4, 0x9d, 0x5d, 0x71, 0x6c, 0x89, 0xe0, 0x56, 0x6c,
+	0x76, 0x75, 0xb2, 0x70, 0x69, 0xb7, 0x1b, 0x55, 0xde, 0x61, 0xab, 0x87,
+	0x3b, 0x84, 0x91, 0xc9, 0x13, 0x3c, 0x18, 0x6e, 0x69, 0xdd, 0xb4, 0x61,
+	0xda, 0x66, 0x47, 0x76, 0x5a, 0x69, 0x5d, 0xee, 0x64, 0x91, 0x98, 0x73,
+	0x65, 0xc1, 0x96, 0xe6, 0xd5, 0xd5, 0xd1, 0xdd, 0x86, 0xdd, 0x66, 0x19,
+	0x9c, 0x27, 0x19, 0xa7, 0x26, 0x5c, 0x66, 0x5c, 0x95, 0x87, 0x69, 0x5d,
+	0xe6, 0x19, 0x46, 0xa6, 0xdc, 0x5c, 0x9e, 0x06, 0x66, 0x9c, 0x26, 0x1d,
+	0x99, 0x95, 0x97, 0x26, 0x1a, 0x61, 0x94, 0x54, 0x76, 0x76, 0x57, 0x7b,
+	0xc6, 0x42, 0x9c, 0x9c, 0x5b, 0x72, 0x45, 0x47, 0x27, 0x25, 0x69, 0xcd,
+	0xe0, 0x78, 0x1e, 0x06, 0x66, 0x52, 0x70, 0x70, 0x72, 0x9c, 0x1c, 0x1c,
+	0x1b, 0x75, 0x72, 0x70, 0x71, 0x98, 0x6a, 0x65, 0xb5, 0xcf, 0x26, 0xde,
+	0x06, 0xa7, 0x36, 0x9e, 0x07, 0x47, 0x48, 0x56, 0x71, 0x9b, 0xc2, 0xf0,
+	0xbc, 0x0c, 0x65, 0x94, 0x6a, 0x65, 0xde, 0x74, 0x47, 0x81, 0x99, 0xe0,
+	0x58, 0x98, 0x9e, 0x07, 0x81, 0xc2, 0x75, 0x98, 0x72, 0x95, 0x89, 0xd2,
+	0x73, 0x65, 0xd1, 0xc9, 0xdd, 0x87, 0x59, 0xc1, 0x67, 0x17, 0x39, 0xc9,
+	0xd9, 0xc9, 0xcd, 0xa7, 0x57, 0x07, 0x07, 0x36, 0x1c, 0x5c, 0x5c, 0x1e,
+	0x09, 0xd5, 0xc6, 0xf4, 0x9c, 0x9b, 0x62, 0x61, 0xe0, 0x73, 0x75, 0x74,
+	0x46, 0x1d, 0x5b, 0x78, 0x19, 0x71, 0x77, 0x76, 0x69, 0xd1, 0xc5, 0x96,
+	0x5c, 0xda, 0x65, 0xc9, 0xc1, 0x86, 0xd5, 0xa1, 0x87, 0x37, 0x17, 0x77,
+	0x06, 0x59, 0x65, 0xb6, 0x19, 0x8a, 0xa6, 0xa5, 0x98, 0x76, 0x87, 0x27,
+	0x78, 0x76, 0x71, 0x71, 0x77, 0x69, 0xe0, 0x99, 0x71, 0x65, 0xe0, 0x91,
+	0x87, 0x29, 0x1c, 0xd8, 0x72, 0x74, 0x69, 0x97, 0x47, 0x26, 0x9d, 0x1c,
+	0x1d, 0x5d, 0x99, 0x12, 0x75, 0x65, 0xb6, 0xd6, 0x61, 0xb6, 0x5d, 0x1d,
+	0xda, 0x92, 0x9d, 0xdd, 0xdc, 0xda, 0x46, 0x1c, 0x5d, 0xd5, 0xc9, 0xca,
+	0x78, 0x1c, 0x1d, 0xd8, 0x56, 0xa1, 0xcd, 0x86, 0x56, 0xf4, 0x69, 0x97,
+	0x67, 0x66, 0x1a, 0x99, 0x65, 0xca, 0x6d, 0xca, 0x65, 0xe0, 0x78, 0x1c,
+	0xf1, 0x87, 0x22, 0xf7, 0xb2, 0x57, 0x77, 0x77, 0x17, 0x29, 0x98, 0xc6,
+	0x5e, 0x07, 0x81, 0x8c, 0x55, 0x9d, 0xe5, 0x95, 0xd9, 0x99, 0xb9, 0x65,
+	0x96, 0x77, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x01, 0x18, 0x63, 0x11,
+	0xdb, 0x19, 0x49, 0xc5, 0xd2, 0x6d, 0x80, 0x69, 0x2f, 0x51, 0x1a, 0x69,
+	0xa6, 0x22, 0x25, 0x86, 0x9a, 0x77, 0x47, 0x24, 0x73, 0x4c, 0x65, 0x1d,
+	0x1d, 0x1c, 0x18, 0x9a, 0x9c, 0x5c, 0xe6, 0x1a, 0x9d, 0x5b, 0xbd, 0xe7,
+	0x27, 0x11, 0x89, 0x67, 0x7b, 0xd5, 0x87, 0x81, 0x29, 0xc2, 0x73, 0x61,
+	0x94, 0xbd, 0xa9, 0xda, 0x1d, 0x9d, 0x1d, 0x1c, 0x27, 0x40, 0x40, 0x72,
+	0x9d, 0x27, 0x46, 0x67, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x44, 0x00, 0x00, 0x00, 0x04, 0x60,
+	0xbb, 0x98, 0x74, 0x71, 0x49, 0xa9, 0xd6, 0x75, 0x95, 0x9a, 0x6e, 0x76,
+	0x86, 0x51, 0x89, 0xa4, 0x9c, 0x67, 0x39, 0xa6, 0xdc, 0x5b, 0x69, 0xb6,
+	0x1c, 0x5d, 0x58, 0x71, 0x57, 0x27, 0x27, 0x27, 0x27, 0x37, 0x07, 0x4b,
+	0x95, 0x70, 0x72, 0x72, 0x9d, 0x1d, 0x9c, 0xdb, 0x56, 0x9d, 0x19, 0x76,
+	0x75, 0x69, 0xc9, 0xc2, 0xe6, 0x1c, 0x1d, 0x19, 0x72, 0x65, 0x97, 0x24,
+	0x65, 0xc9, 0x86, 0x18, 0x61, 0xa9, 0x5c, 0xda, 0x65, 0xcd, 0xa6, 0xef,
+	0x82, 0xe6, 0xf5, 0xbd, 0x4c, 0x31, 0x71, 0x6f, 0x2c, 0xb2, 0x72, 0x73,
+	0x78, 0x26, 0x9d, 0xa2, 0x59, 0x1a, 0x91, 0xc1, 0xc2, 0x65, 0x5a, 0x46,
+	0xe7, 0x19, 0xb6, 0x2d, 0xce, 0x6f, 0x26, 0x2f, 0x2b, 0xb5, 0x9d, 0xde,
+	0x09, 0xdd, 0xd6, 0x78, 0x24, 0x96, 0xf7, 0x71, 0x59, 0xe0, 0x71, 0x62,
+	0xf2, 0x92, 0x66, 0x65, 0xc1, 0xa7, 0x45, 0x59, 0x87, 0x26, 0xed, 0x56,
+	0x5b, 0x49, 0xa7, 0x77, 0x2b, 0x1c, 0x67, 0x06, 0xdc, 0x21, 0xd1, 0x66,
+	0x1a, 0x69, 0x2f, 0x81, 0x96, 0xc9, 0x1d, 0x6f, 0x2b, 0xb7, 0x1b, 0xb8,
+	0x76, 0x74, 0x65, 0xc9, 0x87, 0x44, 0x95, 0xa6, 0x9b, 0x98, 0x78, 0x18,
+	0x70, 0x96, 0x61, 0xb6, 0x5c, 0xa6, 0x19, 0x71, 0x70, 0x99, 0x89, 0x1d,
+	0x47, 0x19, 0xc5, 0xe0, 0x65, 0xd2, 0x71, 0x99, 0x91, 0x18, 0x66, 0xf8,
+	0x1d, 0x19, 0x78, 0x1c, 0x1d, 0x1c, 0x19, 0x65, 0x99, 0xc1, 0xcd, 0xc9,
+	0xcd, 0xc5, 0xc5, 0x64, 0x65, 0x87, 0x05, 0x92, 0x46, 0x18, 0x86, 0x9a,
+	0x69, 0xda, 0x70, 0x65, 0xa9, 0x87, 0x77, 0x56, 0x5c, 0x27, 0x25, 0x77,
+	0x98, 0x78, 0x1d, 0x9c, 0xe4, 0x69, 0xc9, 0xc2, 0x69, 0xc5, 0xc6, 0x47,
+	0x47, 0x66, 0x1b, 0x71, 0x64, 0xc6, 0xdc, 0x1d, 0xef, 0x16, 0xdd, 0x5c,
+	0x55, 0x51, 0xe0, 0x72, 0x61, 0xa6, 0x59, 0x72, 0x77, 0x61, 0xe0, 0x6e,
+	0x57, 0x79, 0x97, 0x07, 0x56, 0xe7, 0x26, 0x4c, 0x76, 0x1c, 0xae, 0x1a,
+	0x9b, 0x47, 0x48, 0x6b, 0x1d, 0x9e, 0x02, 0x6d, 0xb6, 0x9a, 0xbc, 0xef,
+	0x3b, 0xcc, 0x76, 0x31, 0xd9, 0xd1, 0xc1, 0x1c, 0x27, 0x81, 0x67, 0x67,
+	0x36, 0x67, 0x47, 0x81, 0x66, 0x5e, 0x05, 0x49, 0xce, 0x77, 0x70, 0x71,
+	0x6a, 0x46, 0xb1, 0xc1, 0xa6, 0x67, 0x35, 0x9c, 0xdc, 0xd8, 0x71, 0x71,
+	0x6d, 0x96, 0x55, 0xe0, 0x77, 0xa9, 0xd9, 0xcd, 0xc5, 0xb6, 0xd8, 0x9d,
+	0x1c, 0xda, 0x69, 0xa7, 0x35, 0x73, 0x70, 0x84, 0x74, 0x6d, 0xa5, 0x55,
+	0x49, 0xd5, 0x96, 0x1c, 0x5a, 0x98, 0x66, 0x69, 0xd2, 0x46, 0xdc, 0x9c,
+	0x1d, 0xa1, 0xc5, 0xcd, 0xdf, 0x1a, 0x61, 0xe0, 0x65, 0xc1, 0xc1, 0xd1,
+	0x87, 0x07, 0x07, 0x07, 0x06, 0x5c, 0x27, 0x74, 0x75, 0x72, 0xb9, 0x69,
+	0xc1, 0xa7, 0x48, 0x65, 0xd9, 0xc6, 0x1c, 0x19, 0x6d, 0xd9, 0xe0, 0x70,
+	0x70, 0x74, 0x75, 0x70, 0x74, 0x49, 0xb9, 0xc2, 0x64, 0x62, 0x1d, 0x9a,
+	0x45, 0x47, 0x17, 0x65, 0x9e, 0x06, 0xee, 0x24, 0x65, 0x87, 0x05, 0x9b,
+	0x47, 0x57, 0x82, 0x6e, 0x57, 0x62, 0x56, 0xda, 0x72, 0x65, 0xa7, 0x29,
+	0x87, 0x26, 0xdb, 0xbc, 0x2f, 0x1c, 0x76, 0xb2, 0x77, 0xc6, 0xd8, 0xbd,
+	0xef, 0x7b, 0x9b, 0x9b, 0x92, 0xe9, 0xce, 0xf3, 0x76, 0x9e, 0x0a, 0xb6,
+	0x70, 0x9c, 0x5a, 0x98, 0x9d, 0x19, 0x62, 0xe1, 0xc1, 0xb6, 0xe6, 0xea,
+	0x9c, 0x5c, 0x6e, 0x5a, 0x66, 0xf1, 0x65, 0xc2, 0x76, 0x55, 0x75, 0x71,
+	0x62, 0x75, 0x71, 0x69, 0xc5, 0xb6, 0x9d, 0x5d, 0x1d, 0x5b, 0x72, 0x71,
+	0x76, 0x9e, 0x07, 0x59, 0xe0, 0x73, 0x69, 0x29, 0x97, 0x27, 0x47, 0x34,
+	0x61, 0xd1, 0xb6, 0x15, 0x59, 0x75, 0x75, 0x62, 0xf2, 0x6d, 0xb7, 0x67,
+	0x16, 0x6e, 0xdb, 0x75, 0x6d, 0xb6, 0x25, 0x70, 0x74, 0x74, 0x65, 0x55,
+	0xd1, 0x84, 0x70, 0x86, 0xdc, 0x59, 0xb5, 0xb7, 0x37, 0x06, 0x98, 0x46,
+	0x9c, 0x1c, 0x18, 0x61, 0xc1, 0xa9, 0x86, 0x08, 0x61, 0xd1, 0xd1, 0x96,
+	0x2e, 0x9d, 0x64, 0x6e, 0x62, 0x61, 0xda, 0xed, 0xd9, 0xc9, 0xde, 0x65,
+	0xc9, 0xc9, 0xce, 0x49, 0x1d, 0xda, 0x71, 0x73, 0x56, 0x1c, 0x99, 0x72,
+	0x70, 0x59, 0xa7, 0x57, 0x07, 0x46, 0x5d, 0x5c, 0x9d, 0x11, 0xc5, 0xa7,
+	0x82, 0xf3, 0x70, 0x76, 0x72, 0x70, 0x76, 0x65, 0xd1, 0xd1, 0x86, 0x56,
+	0xf0, 0x6b, 0x1c, 0x91, 0xc1, 0xa7, 0x67, 0x17, 0x67, 0x26, 0xe4, 0x76,
+	0x92, 0x73, 0x66, 0x70, 0x98, 0x95, 0x87, 0x67, 0x67, 0x14, 0x76, 0x69,
+	0x99, 0x97, 0x16, 0x99, 0x9c, 0x94, 0x77, 0x72, 0x75, 0x45, 0x61, 0x96,
+	0x1d, 0xdd, 0x5c, 0xdc, 0x5c, 0x5c, 0x5d, 0x1c, 0x9c, 0x59, 0x65, 0xc5,
+	0x87, 0x81, 0x86, 0x98, 0x61, 0xe0, 0x57, 0x19, 0xb6, 0x98, 0x98, 0x59,
+	0xc1, 0x1c, 0xdb, 0x57, 0x36, 0xdc, 0x9c, 0xd9, 0x75, 0x9c, 0x9a, 0x78,
+	0x1d, 0x5e, 0x07, 0x81, 0x59, 0x72, 0x72, 0x96, 0x70, 0x65, 0xd9, 0xde,
+	0x72, 0x77, 0x77, 0x69, 0xa7, 0x67, 0x39, 0x99, 0x97, 0x81, 0xa7, 0x07,
+	0x05, 0x6d, 0x5d, 0x9d, 0x27, 0x27, 0x4c, 0x70, 0x74, 0x31, 0x8b, 0x5d,
+	0x5d, 0x1b, 0x9c, 0x1c, 0xa5, 0x72, 0x72, 0x72, 0x9d, 0x31, 0x80, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x18, 0x63, 0x19, 0x78, 0x31, 0xc1, 0x26,
+	0x1d, 0xdd, 0xd8, 0x06, 0x93, 0x3d, 0x91, 0xa6, 0x9a, 0x61, 0xd5, 0x86,
+	0x1e, 0x07, 0x81, 0xe0, 0x69, 0xb1, 0xc9, 0xd5, 0xd5, 0xd9, 0xdc, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x46, 0x06, 0x31, 0x97, 0x39, 0xb7, 0x1b,
+	0xd5, 0xde, 0x70, 0x78, 0x1d, 0xe6, 0xe7, 0x47, 0x29, 0xa7, 0x67, 0x67,
+	0x77, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x86, 0x21, 0xdf, 0x1c, 0x52, 0x65, 0xe0,
+	0x77, 0x60, 0x1a, 0x46, 0x91, 0xa6, 0x9a, 0x60, 0x1a, 0x49, 0xb1, 0x1a,
+	0x69, 0xa6, 0x27, 0x76, 0x24, 0x66, 0x49, 0x24, 0x91, 0xc6, 0x11, 0xd1,
+	0x1d, 0x53, 0x19, 0x47, 0x67, 0x57, 0x46, 0x26, 0xdc, 0x9d, 0x2d, 0x6a,
+	0x78, 0x1b, 0x75, 0x4c, 0x69, 0x1d, 0x66, 0x66, 0x66, 0x9b, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x04, 0x60, 0x62, 0xf2, 0x75, 0xb8, 0x49, 0x97, 0x57, 0x39, 0xca, 0x49,
+	0xb6, 0x5a, 0x92, 0x6d, 0xc6, 0x72, 0x76, 0x76, 0x77, 0x78, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11,
+	0x86, 0x21, 0xde, 0x72, 0x49, 0xb7, 0x81, 0xdd, 0x80, 0x69, 0x27, 0x14,
+	0x69, 0xa6, 0x98, 0x06, 0x92, 0x65, 0x1a, 0x69, 0xa6, 0x15, 0xe0, 0x9c,
+	0x9e, 0x0c, 0x65, 0xa7, 0x24, 0x9c, 0xd1, 0xc9, 0xc5, 0xc9, 0x89, 0xcd,
+	0xc5, 0xce, 0x73, 0x6a, 0x73, 0x6e, 0x61, 0x1d, 0xd0, 0x75, 0x96, 0x59,
+	0x86, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x11, 0x82, 0xed, 0xb9, 0xdd, 0xda, 0x74, 0x49, 0xc9, 0xd9,
+	0xa9, 0x27, 0x35, 0x69, 0x88, 0x86, 0xda, 0x98, 0x69, 0x87, 0x06, 0x67,
+	0x66, 0x59, 0x6d, 0x95, 0x57, 0x16, 0x27, 0x05, 0xbb, 0x74, 0xbc, 0x27,
+	0x07, 0x17, 0x07, 0x76, 0x9e, 0x04, 0xb8, 0x72, 0x6d, 0x19, 0x77, 0xbc,
+	0x1c, 0x56, 0xe9, 0x5a, 0xbc, 0x52, 0x74, 0x61, 0xcd, 0x1c, 0xa5, 0x70,
+	0x62, 0x62, 0xf1, 0x69, 0xc5, 0x97, 0x67, 0x16, 0x6d, 0x99, 0x9c, 0x66,
+	0xde, 0x07, 0x17, 0x67, 0x69, 0x1c, 0x9c, 0x5a, 0x6d, 0xd5, 0xe0, 0x9b,
+	0x73, 0x59, 0xc1, 0xb7, 0x77, 0x05, 0x74, 0x69, 0xc6, 0x72, 0x67, 0x18,
+	0x74, 0x65, 0x84, 0x6a, 0x1c, 0x1d, 0x59, 0x77, 0x6d, 0xdd, 0x5d, 0xd9,
+	0x75, 0x69, 0xa7, 0x36, 0x58, 0x6d, 0x66, 0xd1, 0xdd, 0xb6, 0x9c, 0x9c,
+	0x9c, 0x99, 0x69, 0xd5, 0xd5, 0xc5, 0xa7, 0x19, 0xc9, 0xc5, 0xd1, 0x97,
+	0x26, 0x9c, 0x9c, 0x9c, 0xe5, 0x77, 0x62, 0x71, 0x9a, 0x70, 0x72, 0x76,
+	0x72, 0x74, 0x77, 0x86, 0x5a, 0x6d, 0xd9, 0x96, 0x58, 0x99, 0x61, 0xd5,
+	0xd1, 0xa6, 0x9a, 0x78, 0x1d, 0x9e, 0x07, 0x06, 0x5a, 0x6a, 0x15, 0xb6,
+	0x91, 0xc1, 0x86, 0x19, 0x57, 0x37, 0x36, 0xa6, 0x99, 0x9a, 0x72, 0x9c,
+	0x1a, 0x66, 0x44, 0x6d, 0x69, 0xb6, 0x18, 0x78, 0x1a, 0x61, 0x87, 0x39,
+	0x1d, 0x27, 0x26, 0xe1, 0x87, 0x26, 0x96, 0x69, 0xc9, 0xca, 0xf2, 0x76,
+	0x99, 0x73, 0x59, 0x87, 0x29, 0x89, 0x97, 0x56, 0x66, 0x1c, 0x21, 0xdd,
+	0xd5, 0x58, 0x75, 0x70, 0x70, 0x71, 0x65, 0xca, 0x65, 0x58, 0x71, 0x71,
+	0x46, 0x19, 0x57, 0x66, 0x5d, 0xa6, 0x9b, 0x69, 0xa5, 0x91, 0xa9, 0x82,
+	0x72, 0x66, 0x72, 0x86, 0x98, 0x75, 0x78, 0x1c, 0x9d, 0x5d, 0x1e, 0x09,
+	0x5c, 0x5a, 0x71, 0x46, 0xdb, 0x77, 0x56, 0x62, 0x05, 0x69, 0xb9, 0x96,
+	0x9c, 0xdc, 0x9b, 0x71, 0x65, 0x5c, 0x56, 0x74, 0x73, 0x87, 0x23, 0x1a,
+	0x1c, 0x2f, 0x37, 0x07, 0x49, 0xb6, 0x6f, 0x17, 0x81, 0x96, 0x5d, 0xda,
+	0xc7, 0x46, 0x9e, 0x09, 0x26, 0x66, 0x1c, 0x9c, 0x9d, 0xc9, 0xa6, 0x9d,
+	0x1d, 0x26, 0xdd, 0xdc, 0x5c, 0x59, 0x95, 0xd9, 0x96, 0x5c, 0x1a, 0x9c,
+	0x9a, 0x77, 0x77, 0x74, 0x6d, 0xc9, 0xc1, 0x86, 0xe6, 0xd5, 0xa5, 0x65,
+	0xc1, 0x96, 0x58, 0x78, 0x1d, 0x27, 0x79, 0xb7, 0x06, 0xaf, 0x69, 0xac,
+	0x66, 0xf5, 0xc7, 0x5c, 0x63, 0x18, 0xc7, 0x36, 0xdb, 0xc6, 0xb5, 0x87,
+	0x27, 0x3c, 0x71, 0xcf, 0x4b, 0xe0, 0xc6, 0xd9, 0xbd, 0x6f, 0x59, 0x26,
+	0xe7, 0x16, 0xa7, 0x26, 0x55, 0x51, 0x67, 0x19, 0xd5, 0xbb, 0x2f, 0x16,
+	0x5a, 0x9d, 0x5c, 0x1c, 0x52, 0x76, 0xab, 0x07, 0x09, 0xe0, 0xb1, 0xb7,
+	0x17, 0x17, 0x75, 0xbc, 0xd9, 0x65, 0xbb, 0xc9, 0x87, 0x82, 0xf5, 0x47,
+	0x69, 0x59, 0x9c, 0x67, 0x59, 0xd6, 0xcb, 0x2c, 0xb3, 0x1c, 0x2e, 0xef,
+	0x1c, 0xeb, 0x1c, 0x31, 0xcd, 0xd5, 0xda, 0xe7, 0x3d, 0xb1, 0xbb, 0x96,
+	0x6e, 0x66, 0x2c, 0x9b, 0x9d, 0x9a, 0xbd, 0x2f, 0x46, 0x99, 0x65, 0x67,
+	0x81, 0xb6, 0x1c, 0x6d, 0xb8, 0xbd, 0x71, 0x1a, 0xcf, 0x77, 0x47, 0x47,
+	0x4b, 0xc6, 0x9d, 0x6e, 0x6e, 0x1c, 0xaf, 0x0b, 0xa5, 0x65, 0x55, 0x85,
+	0x65, 0xac, 0x61, 0xa7, 0x83, 0x18, 0x5c, 0x74, 0xc7, 0x2c, 0xf8, 0x2f,
+	0x81, 0x97, 0x17, 0x37, 0x81, 0xdd, 0xd9, 0x98, 0xc6, 0xdc, 0x2e, 0x67,
+	0x26, 0x98, 0x59, 0x5b, 0x56, 0x1c, 0x18, 0x59, 0xc6, 0x42, 0x70, 0x71,
+	0x99, 0x6a, 0x6e, 0x73, 0x57, 0x47, 0x81, 0x5b, 0xbd, 0x52, 0x27, 0x56,
+	0x67, 0x55, 0x6d, 0xab, 0xd9, 0xa7, 0x81, 0xdd, 0x5c, 0xe7, 0x47, 0x37,
+	0x07, 0x54, 0x65, 0xc9, 0xb7, 0x09, 0xcd, 0x59, 0x65, 0x64, 0x6d, 0x97,
+	0x36, 0x9a, 0x9c, 0x73, 0x95, 0x78, 0x1e, 0x06, 0x9c, 0x5c, 0x1a, 0x99,
+	0x55, 0x74, 0x75, 0x96, 0x71, 0x99, 0x6a, 0x6d, 0xac, 0x1c, 0xe6, 0xd2,
+	0x65, 0xb7, 0x39, 0x58, 0x62, 0x18, 0x9e, 0x09, 0xc5, 0x98, 0x91, 0x56,
+	0x49, 0xc5, 0x87, 0x06, 0x16, 0x6d, 0xe0, 0x97, 0x06, 0x5b, 0x6d, 0x5c,
+	0x5c, 0x98, 0x9c, 0xa1, 0xc5, 0x97, 0x82, 0x6d, 0xc6, 0x65, 0xcd, 0xc9,
+	0x87, 0x07, 0x57, 0x16, 0x24, 0x73, 0x1a, 0x61, 0xcd, 0x89, 0xc9, 0xe0,
+	0x73, 0x95, 0x99, 0xb9, 0x5c, 0x5a, 0x99, 0x75, 0x6d, 0xcd, 0xa9, 0xb8,
+	0x98, 0x74, 0x56, 0x5c, 0x15, 0xc1, 0x8c, 0x47, 0x36, 0x9b, 0x6d, 0xa7,
+	0x09, 0x55, 0x96, 0x5c, 0x56, 0x6d, 0x5d, 0xda, 0x72, 0x91, 0x86, 0x19,
+	0xa7, 0x45, 0x69, 0xa5, 0x49, 0xb9, 0x99, 0xa6, 0xdd, 0x5c, 0xa1, 0xd2,
+	0x6d, 0xe0, 0x65, 0xc5, 0x85, 0x95, 0xd5, 0xb7, 0x59, 0x1d, 0xe7, 0x07,
+	0x07, 0x26, 0xe5, 0x95, 0x97, 0x81, 0xe0, 0x74, 0x61, 0x1b, 0x75, 0x9b,
+	0x75, 0x65, 0x86, 0x98, 0x75, 0x9c, 0x27, 0x27, 0x39, 0xd9, 0xb9, 0xd9,
+	0xd5, 0xcd, 0x87, 0x27, 0x29, 0x19, 0x9c, 0x1a, 0x6a, 0x65, 0x6e, 0x6e,
+	0x57, 0x18, 0x6b, 0x1a, 0x62, 0x61, 0xd1, 0xd1, 0x86, 0x9c, 0x95, 0xe0,
+	0x76, 0x76, 0x9d, 0x27, 0x09, 0x66, 0xa6, 0xdc, 0x67, 0x49, 0xd9, 0x5c,
+	0xdc, 0xdc, 0xd8, 0x9d, 0x95, 0x1b, 0x9c, 0xa7, 0x56, 0x9d, 0x1d, 0xdc,
+	0x22, 0x77, 0x6a, 0x77, 0x95, 0xd9, 0xd9, 0x95, 0x57, 0x06, 0x1c, 0x15,
+	0xde, 0x65, 0xd2, 0x47, 0x17, 0x07, 0x57, 0x06, 0x07, 0x39, 0x99, 0xdd,
+	0xa6, 0xd9, 0x69, 0x67, 0x79, 0x67, 0x81, 0xca, 0x61, 0xc5, 0xb7, 0x08,
+	0x69, 0x87, 0x57, 0x76, 0xdb, 0x9c, 0x1c, 0x19, 0x6a, 0x1c, 0x18, 0x4c,
+	0x6d, 0xde, 0x72, 0x61, 0xdd, 0xd9, 0x5d, 0x58, 0x57, 0x81, 0x67, 0x0a,
+	0x75, 0x88, 0x45, 0x9c, 0x5c, 0x5d, 0xe6, 0x66, 0xd8, 0x73, 0x6d, 0x87,
+	0x07, 0x66, 0x98, 0x70, 0x72, 0x46, 0x1d, 0x1c, 0x5b, 0x70, 0x65, 0xd9,
+	0xd5, 0xc1, 0xa6, 0x1a, 0x73, 0x75, 0xa9, 0x92, 0xa6, 0x9b, 0x74, 0x75,
+	0x9c, 0x5e, 0x07, 0x75, 0x56, 0x66, 0x5d, 0x96, 0x75, 0x76, 0x69, 0xc9,
+	0x98, 0x78, 0x1c, 0x67, 0x29, 0x96, 0xe6, 0x5c, 0x1d, 0x1d, 0xd5, 0xcd,
+	0xe0, 0x6d, 0x87, 0x37, 0x36, 0x99, 0x98, 0x75, 0x69, 0xc9, 0xc2, 0x69,
+	0x97, 0x56, 0x19, 0x71, 0x72, 0x70, 0x19, 0x78, 0x1c, 0xd5, 0xc9, 0xd6,
+	0x6a, 0x57, 0x66, 0xdd, 0x04, 0x78, 0x1c, 0x5c, 0xa4, 0x57, 0x68, 0x6e,
+	0x67, 0x1b, 0xc6, 0x6f, 0x6b, 0xd9, 0x87, 0x19, 0xa9, 0xd5, 0xcd, 0xc9,
+	0xe0, 0x6a, 0x69, 0x99, 0xe0, 0x61, 0x86, 0x15, 0x64, 0x57, 0x14, 0x9b,
+	0x65, 0x96, 0x99, 0x9a, 0x73, 0xc7, 0x68, 0x31, 0xd2, 0x76, 0xc7, 0x40,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x11, 0x86, 0x31, 0xd5, 0xc5, 0xd5, 0xd5, 0xd2, 0x21,
+	0xe0, 0x69, 0xb9, 0xd1, 0xe0, 0x9d, 0xe7, 0x67, 0x26, 0x9d, 0x11, 0xc1,
+	0xd1, 0x97, 0x47, 0x47, 0x46, 0xa5, 0x70, 0x71, 0x49, 0xd9, 0xa7, 0x17,
+	0x69, 0xc9, 0xa7, 0x17, 0x37, 0x59, 0xdd, 0xc1, 0xb6, 0xdc, 0xd2, 0x76,
+	0x77, 0x76, 0x6d, 0xd5, 0xc9, 0xd5, 0xd1, 0xc7, 0x07, 0x19, 0xc1, 0x87,
+	0x76, 0x9c, 0x1d, 0xdc, 0xdd, 0xf0, 0x70, 0x78, 0x26, 0xa6, 0xa6, 0xe7,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x11, 0x82, 0x74, 0x96, 0x57, 0x37, 0x27, 0x69,
+	0xc2, 0x6e, 0x78, 0x24, 0x9c, 0x5b, 0x9a, 0x9c, 0x15, 0x26, 0x27, 0x26,
+	0x9b, 0x9c, 0x9b, 0x6d, 0x8b, 0x94, 0x75, 0x65, 0xcd, 0xcd, 0xcd, 0xc1,
+	0x95, 0x73, 0x57, 0x81, 0x1b, 0xa6, 0x9c, 0xa7, 0x66, 0xa7, 0x36, 0x1c,
+	0x1c, 0x9b, 0x69, 0x5c, 0xe7, 0x37, 0x55, 0x9d, 0x12, 0x65, 0xc5, 0x97,
+	0x17, 0x16, 0xdb, 0x91, 0xc9, 0xa7, 0x56, 0xee, 0x9b, 0x66, 0x6a, 0x70,
+	0x55, 0x77, 0x6d, 0x89, 0x6d, 0x62, 0x61, 0xc5, 0xa6, 0x1d, 0x1c, 0x18,
+	0x61, 0x97, 0x65, 0x61, 0xc9, 0xa7, 0x64, 0x65, 0xb7, 0x05, 0x9b, 0x74,
+	0x6d, 0xb6, 0x5c, 0x59, 0x59, 0x15, 0xb6, 0xa7, 0x26, 0xb1, 0xd5, 0x19,
+	0x98, 0x71, 0x71, 0x75, 0x6a, 0x69, 0xca, 0x66, 0x69, 0xc1, 0xb6, 0xdd,
+	0x61, 0x71, 0xe0, 0x71, 0x78, 0x1a, 0x65, 0xb7, 0x58, 0x61, 0xd1, 0xa9,
+	0x99, 0xca, 0x61, 0xb7, 0x67, 0x17, 0x08, 0x75, 0x9c, 0x1d, 0x1c, 0x5c,
+	0x15, 0x5c, 0x56, 0x73, 0x56, 0xdc, 0xd9, 0x6d, 0xd5, 0x62, 0x57, 0x17,
+	0x17, 0x81, 0xa6, 0x5c, 0xdc, 0x5c, 0xe1, 0xe0, 0x69, 0xc5, 0xc1, 0xc1,
+	0xcd, 0x5c, 0x5d, 0x05, 0x98, 0x71, 0x89, 0xc9, 0x96, 0x1d, 0x1d, 0x58,
+	0x76, 0x57, 0x67, 0x81, 0x99, 0xc1, 0xc2, 0x5b, 0xc6, 0x61, 0xa6, 0x5d,
+	0x5c, 0x18, 0x78, 0x1d, 0x1d, 0x26, 0x66, 0x19, 0x77, 0x65, 0xca, 0x1c,
+	0x5d, 0x98, 0x74, 0x61, 0xa5, 0x74, 0x61, 0x99, 0x5c, 0x9b, 0x72, 0x69,
+	0xa7, 0x09, 0x18, 0x74, 0x6d, 0xc1, 0x89, 0x5c, 0x96, 0x59, 0x86, 0x9b,
+	0x74, 0x74, 0x69, 0xca, 0x71, 0x71, 0xba, 0x76, 0x56, 0xd2, 0xf8, 0x1a,
+	0x45, 0xbc, 0x9d, 0x6f, 0x26, 0x1d, 0x9d, 0x9d, 0x15, 0x87, 0x76, 0xdd,
+	0x9b, 0x66, 0x61, 0xd6, 0x56, 0x59, 0x91, 0xc6, 0x66, 0xf4, 0x66, 0xf4,
+	0x74, 0x77, 0x62, 0x65, 0xc6, 0xa1, 0x98, 0x9c, 0x5e, 0x05, 0x61, 0xc1,
+	0xde, 0x91, 0xa6, 0x9a, 0x91, 0x99, 0xe0, 0x6a, 0x76, 0x9c, 0xdc, 0x1a,
+	0x74, 0x71, 0x6d, 0xc9, 0x1c, 0xdb, 0x65, 0x1d, 0x1c, 0x18, 0x76, 0x9d,
+	0xda, 0x71, 0x55, 0x65, 0x99, 0x95, 0xc6, 0x2e, 0x5e, 0x05, 0x62, 0x61,
+	0xdd, 0x5d, 0xd1, 0x58, 0xbd, 0xdc, 0xdd, 0xda, 0x74, 0x74, 0x56, 0x59,
+	0x77, 0x9c, 0x1c, 0x9c, 0xad, 0x65, 0xc1, 0xc9, 0xc9, 0x62, 0x73, 0x76,
+	0x71, 0x9d, 0xda, 0xce, 0x31, 0xd7, 0x2c, 0x72, 0x33, 0x86, 0x52, 0xed,
+	0xb7, 0x27, 0x1b, 0x18, 0x99, 0x66, 0xf0, 0x92, 0x61, 0xa6, 0x51, 0x5d,
+	0xe6, 0xdc, 0x26, 0xda, 0x99, 0x99, 0x56, 0x59, 0x72, 0x61, 0x87, 0x09,
+	0xdd, 0x96, 0x59, 0x70, 0x56, 0x5c, 0xdd, 0x1b, 0x65, 0x87, 0x45, 0x69,
+	0xb6, 0x1c, 0x19, 0x61, 0xce, 0x70, 0x65, 0xd1, 0xc9, 0xb7, 0x47, 0x79,
+	0xb9, 0xd1, 0xc1, 0xa6, 0x5b, 0xbc, 0x92, 0x76, 0x65, 0x15, 0xe0, 0xbc,
+	0x5d, 0x18, 0x78, 0x1b, 0x72, 0x65, 0x96, 0x21, 0xd1, 0xc1, 0xa6, 0x5c,
+	0x27, 0x39, 0x2c, 0x72, 0x75, 0x6e, 0x71, 0x9d, 0x27, 0x49, 0xd0, 0x9d,
+	0x19, 0x46, 0x9c, 0x26, 0x1d, 0xdd, 0x27, 0x36, 0x5d, 0x2f, 0x09, 0xc4,
+	0xc8, 0x72, 0x77, 0x77, 0xd1, 0xa1, 0xdd, 0x96, 0x59, 0x77, 0x65, 0x1b,
+	0x9c, 0xe6, 0x16, 0x70, 0x9a, 0x77, 0x62, 0x25, 0x9a, 0xb8, 0x67, 0x16,
+	0xf4, 0xc6, 0x2f, 0x76, 0x19, 0x73, 0x73, 0x9b, 0x46, 0x29, 0x87, 0x59,
+	0xd9, 0x97, 0x77, 0x07, 0x06, 0x26, 0xa6, 0xb3, 0xac, 0x73, 0x65, 0xd2,
+	0x9c, 0xe6, 0xa6, 0x26, 0x2e, 0x9c, 0x19, 0x9a, 0x9b, 0x87, 0x81, 0xce,
+	0x76, 0x70, 0x95, 0xd9, 0x59, 0x4a, 0x73, 0x73, 0x70, 0x70, 0x65, 0xa6,
+	0x9c, 0xa7, 0x5b, 0xce, 0xd6, 0x61, 0xc9, 0xdd, 0xc5, 0xab, 0x95, 0x76,
+	0x46, 0x9c, 0x2d, 0x74, 0x57, 0x67, 0x77, 0x09, 0xca, 0x61, 0xc9, 0xa9,
+	0x15, 0xd9, 0xc9, 0xb7, 0x27, 0x2b, 0xc9, 0xa6, 0xd2, 0x60, 0x65, 0x86,
+	0x1c, 0x95, 0xc9, 0xd1, 0xca, 0x65, 0x97, 0x16, 0x5d, 0xa7, 0x36, 0x55,
+	0xc5, 0xe0, 0x6d, 0x96, 0x24, 0x78, 0x24, 0x55, 0x66, 0x61, 0xb9, 0x22,
+	0x46, 0x9d, 0xa6, 0x65, 0x72, 0x91, 0xc5, 0xc5, 0xc5, 0xc5, 0x86, 0x15,
+	0xa8, 0x73, 0x61, 0xe0, 0x6e, 0x1b, 0x58, 0x71, 0x76, 0x74, 0x98, 0x72,
+	0x70, 0x74, 0x69, 0x58, 0x71, 0x76, 0x56, 0x5d, 0x07, 0x54, 0x61, 0xb7,
+	0x45, 0x9a, 0x71, 0x65, 0xc9, 0x95, 0x57, 0x06, 0x21, 0xd1, 0xa6, 0x59,
+	0x56, 0x9c, 0xd5, 0x89, 0x97, 0x39, 0xa1, 0x1d, 0x1d, 0x9a, 0x75, 0x70,
+	0xb8, 0x98, 0x9d, 0x5c, 0x61, 0xdd, 0xc9, 0xc9, 0x1c, 0x5d, 0xa4, 0x56,
+	0x58, 0x55, 0xc7, 0x24, 0x95, 0xd9, 0x97, 0x06, 0x5b, 0x98, 0x73, 0x62,
+	0x69, 0xcd, 0xd6, 0x19, 0x9b, 0x9c, 0x15, 0xd1, 0xa5, 0xbc, 0xe7, 0x79,
+	0xde, 0xe7, 0x1e, 0x0c, 0x78, 0x2f, 0x7c, 0x77, 0xc7, 0x3b, 0xd1, 0xc9,
+	0xcf, 0x1c, 0xb1, 0xdb, 0x1b, 0xc7, 0x36, 0x67, 0x49, 0xd2, 0x59, 0xd1,
+	0x99, 0xd1, 0x55, 0x8b, 0x89, 0xdd, 0x89, 0xd5, 0xc2, 0xe9, 0xb5, 0x9c,
+	0x67, 0x77, 0x39, 0xda, 0xea, 0xd7, 0x26, 0xdd, 0x1d, 0xae, 0xdd, 0x9c,
+	0x91, 0xe0, 0x72, 0x76, 0x70, 0x65, 0xa6, 0x15, 0x1e, 0x06, 0x58, 0x71,
+	0x65, 0xa7, 0x55, 0x65, 0xce, 0xed, 0x58, 0x71, 0x71, 0x61, 0xaa, 0x6a,
+	0x95, 0x59, 0x73, 0x73, 0x74, 0x56, 0x1c, 0x9c, 0x6c, 0x61, 0x25, 0x87,
+	0x56, 0x5c, 0xdc, 0x18, 0x72, 0x66, 0x61, 0xd2, 0x61, 0x8b, 0x5b, 0x71,
+	0xc7, 0x49, 0xa3, 0x1c, 0xef, 0x0c, 0x6c, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x86, 0x31, 0xd1, 0xca,
+	0x75, 0x49, 0xc9, 0xe0, 0x73, 0x74, 0x9c, 0xda, 0xbc, 0x2f, 0x0b, 0xc2,
+	0xee, 0xee, 0xee, 0xee, 0xed, 0xc5, 0xe0, 0x4b, 0xc5, 0x1d, 0xa7, 0x75,
+	0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x75, 0x71, 0x89, 0xd9, 0xd5,
+	0x89, 0xd1, 0xda, 0x76, 0x96, 0x78, 0x1a, 0x9c, 0x41, 0x00, 0x98, 0x9c,
+	0x67, 0x16, 0x67, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x46, 0x0b, 0xc9, 0xcd, 0xcd, 0xcd, 0xcd, 0xcf,
+	0x38, 0x47, 0x66, 0xd6, 0xf0, 0xc7, 0x71, 0x6c, 0xbc, 0x1c, 0x98, 0x70,
+	0xb8, 0x61, 0x89, 0x99, 0xe0, 0x69, 0x97, 0x59, 0xe0, 0x6d, 0xd1, 0xd3,
+	0x1d, 0xd8, 0x6e, 0xf7, 0xbc, 0x5c, 0xa7, 0x26, 0x5c, 0xdb, 0x65, 0xd9,
+	0x96, 0x25, 0x6e, 0x72, 0x6d, 0x65, 0xbb, 0x98, 0x98, 0x95, 0xc9, 0x86,
+	0x5c, 0x98, 0x71, 0x74, 0x74, 0x61, 0xd1, 0xcd, 0xb6, 0x5d, 0x5a, 0xbc,
+	0x9a, 0x75, 0x9c, 0x1a, 0x73, 0x61, 0xdd, 0xd6, 0xf0, 0x69, 0xc9, 0x1b,
+	0x77, 0x70, 0x56, 0x58, 0x55, 0x99, 0x99, 0xc2, 0x73, 0x66, 0xe2, 0x62,
+	0x47, 0x66, 0x5c, 0x99, 0x65, 0x89, 0x5e, 0x09, 0x86, 0xd6, 0x57, 0x17,
+	0x77, 0x82, 0x65, 0xc9, 0xb9, 0x16, 0x66, 0xf3, 0xbe, 0x01, 0x87, 0x47,
+	0x81, 0xe0, 0x61, 0x1d, 0x5d, 0xdd, 0xde, 0x06, 0x5d, 0xdb, 0x75, 0x72,
+	0x78, 0x19, 0x56, 0x19, 0x66, 0x69, 0x1e, 0x07, 0x49, 0xbb, 0xd1, 0x87,
+	0x17, 0x77, 0x17, 0x07, 0x05, 0x74, 0x9c, 0xa7, 0x27, 0x09, 0x96, 0xa1,
+	0xc1, 0xc2, 0x74, 0x65, 0x98, 0x57, 0x67, 0x67, 0x27, 0x66, 0x55, 0x5c,
+	0x58, 0xbd, 0xeb, 0x3d, 0x95, 0x87, 0x37, 0x77, 0x17, 0x26, 0x1d, 0x9a,
+	0xbe, 0x07, 0x0b, 0xac, 0xf3, 0xcd, 0xbc, 0xb3, 0x9c, 0x78, 0x31, 0x9b,
+	0xdf, 0x1c, 0x74, 0xbe, 0x06, 0x59, 0xc5, 0xc5, 0xbc, 0x19, 0x66, 0x6d,
+	0xd7, 0x1c, 0x46, 0xd2, 0x31, 0xc2, 0x63, 0x1d, 0xe7, 0x42, 0x73, 0xba,
+	0xb9, 0xbc, 0x96, 0x75, 0x9d, 0x2e, 0xdc, 0x98, 0x9d, 0xd6, 0xed, 0xb5,
+	0x65, 0x95, 0x56, 0x2e, 0x58, 0xb8, 0xb8, 0x6a, 0xf1, 0x56, 0x58, 0x6d,
+	0x70, 0x78, 0x1c, 0x84, 0xbb, 0x65, 0xbb, 0xd1, 0x5a, 0x71, 0x6d, 0x8b,
+	0xcd, 0xd9, 0xa4, 0x61, 0x8b, 0xc1, 0xa7, 0x46, 0x61, 0x97, 0x06, 0x1d,
+	0x9c, 0x9c, 0x9b, 0x87, 0x26, 0xef, 0x39, 0x5c, 0x5c, 0x6f, 0x56, 0xac,
+	0x61, 0xc2, 0x69, 0xe0, 0x57, 0x07, 0x76, 0x18, 0x95, 0xc5, 0xc1, 0xdd,
+	0xdd, 0xbb, 0xd5, 0xc2, 0x47, 0x09, 0x97, 0x39, 0x5c, 0xde, 0x07, 0x71,
+	0xe0, 0x61, 0xc9, 0xc5, 0x1d, 0x5e, 0x07, 0x27, 0x66, 0x5e, 0x06, 0xdd,
+	0xda, 0x27, 0x17, 0x81, 0x99, 0x27, 0x15, 0xbc, 0xdd, 0x1c, 0x1d, 0x1d,
+	0x27, 0x26, 0xe6, 0x2f, 0x59, 0x96, 0xa7, 0x46, 0x9d, 0x26, 0xe7, 0x39,
+	0x61, 0xa6, 0x26, 0x15, 0xa5, 0x57, 0x77, 0x07, 0x26, 0x59, 0x69, 0xdc,
+	0x72, 0x69, 0xc8, 0x46, 0x1a, 0x99, 0x6d, 0xa5, 0x61, 0xd5, 0x97, 0x79,
+	0x97, 0x19, 0xb6, 0xa7, 0x47, 0x82, 0x61, 0xa7, 0x26, 0x9c, 0xd8, 0x61,
+	0xd1, 0xbc, 0x99, 0x66, 0x49, 0xd5, 0x5c, 0x5c, 0x5a, 0x61, 0xe0, 0x71,
+	0x73, 0x6d, 0x5c, 0x64, 0x89, 0x26, 0x5c, 0xa6, 0xf3, 0x31, 0xd1, 0x8b,
+	0xcd, 0xcf, 0x1c, 0x67, 0x29, 0xcd, 0xa7, 0x79, 0x65, 0x62, 0x55, 0x96,
+	0x56, 0x18, 0x86, 0xa7, 0x56, 0x09, 0xd2, 0x70, 0x65, 0xcd, 0xcd, 0xa6,
+	0x19, 0x65, 0xc1, 0xde, 0x6a, 0x9a, 0x9c, 0xe7, 0x05, 0x71, 0x9c, 0x67,
+	0x46, 0x5c, 0xd9, 0x57, 0x31, 0x27, 0x27, 0x06, 0x64, 0x71, 0x57, 0x81,
+	0xc1, 0xdd, 0x97, 0x7c, 0xc6, 0x1c, 0x66, 0x5c, 0x67, 0x67, 0x47, 0x66,
+	0xdb, 0x69, 0xda, 0x49, 0x96, 0x21, 0xb6, 0x65, 0x71, 0x98, 0x72, 0x70,
+	0x9d, 0x31, 0x99, 0xd1, 0x89, 0xd2, 0x59, 0xd2, 0x74, 0x66, 0x1d, 0xa1,
+	0x89, 0xde, 0x70, 0x71, 0x78, 0x24, 0x78, 0x1b, 0x57, 0x29, 0xd6, 0x46,
+	0x67, 0x37, 0x56, 0xe7, 0x46, 0x27, 0x81, 0xcd, 0xb9, 0xc5, 0xcd, 0xce,
+	0x76, 0x65, 0xa7, 0x05, 0x9d, 0x5e, 0x06, 0x1d, 0x5a, 0xb1, 0xbb, 0x1e,
+	0x07, 0x81, 0x8b, 0x55, 0x1c, 0x5c, 0xa7, 0x66, 0xa2, 0x57, 0x09, 0xa6,
+	0x66, 0x59, 0x57, 0x81, 0x89, 0xe0, 0x6d, 0xb6, 0xa6, 0x21, 0x66, 0x1d,
+	0x9d, 0xe9, 0xce, 0x78, 0x1c, 0xdc, 0x1c, 0x59, 0x6d, 0x96, 0x66, 0xe1,
+	0x6e, 0x2f, 0x4b, 0xbb, 0xd2, 0xf4, 0xbd, 0x2a, 0xf8, 0x27, 0x4c, 0x47,
+	0x2b, 0xc6, 0xcb, 0x65, 0x98, 0x9e, 0x08, 0x70, 0xc5, 0xc7, 0x69, 0x65,
+	0x96, 0x59, 0x65, 0x96, 0x59, 0x75, 0xbc, 0x75, 0x76, 0x77, 0xa9, 0xd6,
+	0xe1, 0x8b, 0x67, 0x5a, 0x9d, 0xc6, 0x72, 0x9e, 0x06, 0xa7, 0x81, 0x6d,
+	0x11, 0x32, 0x69, 0x1b, 0x72, 0xb1, 0x27, 0x67, 0x07, 0x26, 0x1a, 0x66,
+	0x76, 0x75, 0x56, 0x27, 0x76, 0x97, 0x1c, 0xd2, 0xf4, 0x66, 0x72, 0x61,
+	0xc2, 0xf2, 0x78, 0x18, 0xcf, 0x0b, 0xcf, 0x1d, 0x18, 0x72, 0x72, 0x72,
+	0x6a, 0xef, 0x1c, 0x5c, 0xdc, 0x1d, 0xe4, 0xbd, 0x15, 0x8b, 0xab, 0xab,
+	0xa6, 0x1d, 0x66, 0x16, 0x54, 0x9d, 0x9c, 0xef, 0x16, 0x2f, 0x36, 0x27,
+	0x7b, 0xd1, 0x5e, 0x07, 0x76, 0xe7, 0x81, 0xcd, 0xc3, 0x15, 0xc1, 0x5a,
+	0x6e, 0x74, 0x6d, 0xc5, 0x99, 0xe0, 0x96, 0x5b, 0xa2, 0x99, 0x4b, 0xd5,
+	0xbb, 0x6f, 0x67, 0x56, 0x1d, 0x19, 0xb9, 0x69, 0xa6, 0xa6, 0x99, 0x65,
+	0xe0, 0x65, 0xa9, 0xc2, 0xe2, 0x59, 0xc5, 0xa7, 0x45, 0x9d, 0x5d, 0x18,
+	0x61, 0xc5, 0xa4, 0x74, 0x57, 0x09, 0x89, 0xc1, 0x9b, 0x59, 0x69, 0xc5,
+	0xb6, 0x58, 0x72, 0x65, 0xc9, 0xc9, 0x94, 0x71, 0x56, 0xdc, 0x5c, 0x99,
+	0x61, 0x89, 0xdd, 0xd0, 0xcd, 0x1c, 0x2f, 0x27, 0x81, 0xe0, 0x70, 0x66,
+	0x6d, 0x64, 0x69, 0x5d, 0xdc, 0x87, 0x19, 0xc9, 0x97, 0x17, 0x81, 0xc1,
+	0xcd, 0x96, 0x5c, 0x55, 0xc9, 0xa5, 0x61, 0x9c, 0x77, 0xb2, 0xf7, 0xc7,
+	0x06, 0x19, 0xc6, 0xaf, 0x46, 0x1b, 0x6d, 0xb6, 0x30, 0xc2, 0x56, 0x71,
+	0xc7, 0x11, 0x58, 0x72, 0xc6, 0x5d, 0x5e, 0x07, 0x75, 0x9d, 0x67, 0x39,
+	0x58, 0x98, 0x98, 0x99, 0x65, 0xc6, 0x74, 0x72, 0xa7, 0x16, 0x5b, 0x65,
+	0x86, 0x27, 0x7b, 0xc2, 0x9b, 0x69, 0xa6, 0xd5, 0xd2, 0xa9, 0xda, 0x77,
+	0x78, 0x21, 0xc3, 0x33, 0x05, 0xb8, 0xc4, 0x77, 0x72, 0x65, 0xd9, 0xd5,
+	0xda, 0x2f, 0x36, 0xda, 0x98, 0x70, 0x70, 0x47, 0x4c, 0x71, 0xc6, 0x9d,
+	0xa6, 0x1d, 0x9b, 0x45, 0x76, 0x74, 0x74, 0x65, 0xcd, 0x97, 0x67, 0x08,
+	0x91, 0xe0, 0x12, 0xf6, 0x73, 0x99, 0x6d, 0xda, 0x55, 0x74, 0x49, 0x24,
+	0x91, 0xb9, 0x21, 0xbc, 0xe1, 0xc5, 0xde, 0x6d, 0xda, 0x65, 0xb7, 0x28,
+	0x72, 0xbb, 0x9c, 0x1c, 0x9d, 0x59, 0x15, 0xc9, 0xc5, 0x27, 0x19, 0x5b,
+	0x76, 0x62, 0xf2, 0x6e, 0xf1, 0x74, 0x71, 0x62, 0x1c, 0x1c, 0xe1, 0xa9,
+	0xc9, 0xb6, 0xa7, 0x56, 0x58, 0x76, 0x87, 0x09, 0x1c, 0x9b, 0x72, 0x95,
+	0xc5, 0xc1, 0xc9, 0x67, 0x09, 0x25, 0x78, 0x19, 0x9d, 0xe6, 0xac, 0x59,
+	0xbb, 0xc5, 0x6c, 0xc7, 0x7b, 0x96, 0xf1, 0xdf, 0x19, 0xbc, 0x6f, 0x1b,
+	0xd3, 0x1d, 0xe7, 0x76, 0x59, 0x73, 0xbc, 0xdc, 0xdc, 0xd5, 0x86, 0x9a,
+	0x65, 0xcd, 0xc1, 0xd6, 0xf3, 0x92, 0x66, 0xd9, 0xa9, 0xd3, 0x15, 0x27,
+	0x29, 0xd6, 0xe1, 0xc7, 0x1a, 0xbc, 0x1c, 0x5c, 0x19, 0x9d, 0xdc, 0x5d,
+	0x19, 0x74, 0x6d, 0x6e, 0x1c, 0x2f, 0x69, 0xca, 0xf7, 0x9c, 0x58, 0x78,
+	0x1a, 0x47, 0x01, 0x6e, 0x1d, 0x1c, 0xc5, 0x66, 0x78, 0x18, 0xb2, 0xed,
+	0x5c, 0x1e, 0x06, 0xef, 0x44, 0x69, 0xa7, 0x36, 0xdc, 0xe1, 0x59, 0x72,
+	0x6d, 0x6e, 0x99, 0xbb, 0xbc, 0x19, 0x61, 0x1b, 0x73, 0x61, 0xcd, 0xc6,
+	0xf5, 0x75, 0x78, 0x1b, 0x69, 0xbb, 0xdd, 0xc5, 0xc5, 0xda, 0x73, 0x70,
+	0x6d, 0xc1, 0xc6, 0x70, 0xbc, 0x96, 0x72, 0x91, 0xb6, 0x5d, 0x25, 0x76,
+	0x56, 0x58, 0x72, 0x56, 0x99, 0x76, 0x86, 0x51, 0x87, 0x59, 0x97, 0x27,
+	0x69, 0x24, 0x99, 0x6d, 0xd4, 0x76, 0x6e, 0x57, 0x59, 0x86, 0x9b, 0x9c,
+	0x99, 0x9a, 0x98, 0x5c, 0x77, 0x95, 0xe0, 0x70, 0x6d, 0xd0, 0xc7, 0x4d,
+	0x1d, 0x1c, 0xb3, 0xc5, 0xa8, 0x89, 0xc4, 0x75, 0x6d, 0xe0, 0x59, 0xb4,
+	0x75, 0x47, 0x37, 0x66, 0xda, 0x65, 0xd9, 0x96, 0x9a, 0x65, 0xc2, 0xf7,
+	0x59, 0x87, 0x15, 0x9c, 0xdc, 0x5c, 0x1d, 0xf1, 0x33, 0xa9, 0xc8, 0xb9,
+	0x6a, 0xea, 0x59, 0xd1, 0xca, 0x1d, 0x9d, 0x99, 0x9d, 0x19, 0x71, 0x66,
+	0x69, 0xc1, 0x86, 0x5c, 0x1d, 0xda, 0x6a, 0x56, 0xdc, 0x1c, 0x15, 0xc2,
+	0x75, 0x6d, 0x86, 0xdd, 0x20, 0x65, 0xc9, 0x25, 0x9c, 0x95, 0xc2, 0x6d,
+	0x5c, 0xe7, 0x65, 0x1b, 0x69, 0x97, 0x46, 0x58, 0x9c, 0x5d, 0xdd, 0xdb,
+	0x65, 0x1c, 0x5e, 0x09, 0x98, 0x88, 0x1d, 0x21, 0x1d, 0xe1, 0x5d, 0x67,
+	0x77, 0x67, 0x07, 0x47, 0x16, 0x1a, 0x77, 0x98, 0x98, 0x91, 0xcd, 0xa6,
+	0xdb, 0x91, 0x55, 0x1c, 0x5a, 0x9c, 0x27, 0x77, 0x16, 0xda, 0x6e, 0x21,
+	0xc9, 0xc9, 0xa9, 0xc9, 0xc1, 0xc5, 0xc5, 0xb9, 0xa6, 0x55, 0x87, 0x27,
+	0x55, 0xcc, 0x73, 0x73, 0x86, 0x5c, 0x5d, 0x66, 0x58, 0x73, 0x66, 0x74,
+	0x71, 0x73, 0x69, 0xc5, 0xc5, 0x99, 0xb9, 0xc5, 0xd9, 0xce, 0x6d, 0xc5,
+	0xc5, 0x87, 0x81, 0xc5, 0xde, 0x71, 0x71, 0x75, 0x65, 0xc5, 0x87, 0x05,
+	0x47, 0x77, 0x76, 0x9b, 0x6b, 0x1d, 0xdd, 0x57, 0x1a, 0xcc, 0x61, 0x86,
+	0x31, 0xb5, 0x78, 0x1d, 0xd5, 0x8c, 0xc5, 0x91, 0xe0, 0x78, 0x1d, 0x59,
+	0x99, 0x77, 0x9c, 0xd2, 0x69, 0x87, 0x05, 0x9c, 0xdb, 0x76, 0x61, 0x59,
+	0x72, 0x72, 0x61, 0x18, 0x9c, 0x1c, 0xaf, 0x39, 0xc6, 0x9c, 0x2f, 0x17,
+	0x49, 0xda, 0x27, 0x57, 0x27, 0x57, 0x09, 0xce, 0x69, 0x96, 0x19, 0x78,
+	0x1c, 0x9a, 0x6a, 0x56, 0xdc, 0x1c, 0x15, 0xc2, 0x75, 0x6d, 0x8c, 0xf3,
+	0xbc, 0xf1, 0x58, 0x9e, 0x09, 0xa7, 0x17, 0x16, 0x55, 0x5c, 0x58, 0x9c,
+	0x5d, 0x98, 0xa7, 0x07, 0x82, 0x57, 0x77, 0x16, 0x9e, 0x09, 0x1a, 0x71,
+	0x9d, 0x9b, 0x71, 0x9c, 0x99, 0x62, 0x65, 0xd1, 0xe0, 0x61, 0x6d, 0x56,
+	0x21, 0xbb, 0xc9, 0x97, 0x68, 0x66, 0x72, 0x70, 0x70, 0x61, 0xb9, 0x1c,
+	0x2e, 0x19, 0x9d, 0x1a, 0x9c, 0x1c, 0x5c, 0x5a, 0x73, 0x9b, 0x77, 0x74,
+	0x65, 0xc6, 0x49, 0x26, 0x61, 0x97, 0x47, 0x47, 0x06, 0x25, 0x73, 0x69,
+	0xcd, 0x96, 0x5a, 0x65, 0xd1, 0x47, 0x36, 0x99, 0x71, 0x65, 0x87, 0x35,
+	0x89, 0xc9, 0xd1, 0xc6, 0x76, 0x70, 0x69, 0x86, 0x98, 0x72, 0x78, 0x1a,
+	0x70, 0x72, 0x47, 0x07, 0x17, 0x09, 0xd9, 0xcd, 0xc6, 0x1e, 0x06, 0x96,
+	0x6a, 0x69, 0xd9, 0xe0, 0x71, 0x6e, 0x74, 0x99, 0x9d, 0x18, 0x91, 0xd5,
+	0xb6, 0x1d, 0x5c, 0x9d, 0x5a, 0x6a, 0x59, 0xc5, 0xc1, 0xc6, 0x61, 0xc2,
+	0x59, 0x5a, 0x99, 0x99, 0x75, 0x91, 0x96, 0x55, 0xd5, 0xd9, 0x19, 0x69,
+	0x96, 0x26, 0xd9, 0x75, 0x6d, 0x96, 0x31, 0xbb, 0x05, 0x9c, 0x5d, 0x1c,
+	0xe5, 0xbd, 0xe5, 0x6e, 0x75, 0x92, 0x61, 0xd5, 0xc0, 0x69, 0xc6, 0x19,
+	0x86, 0x67, 0x27, 0x56, 0xe7, 0x25, 0x73, 0x69, 0x97, 0x17, 0x16, 0x1c,
+	0xa5, 0x9d, 0x59, 0x66, 0x77, 0x76, 0x6a, 0xed, 0xa6, 0x98, 0x70, 0x57,
+	0x27, 0x26, 0x98, 0x70, 0x6d, 0xb6, 0xd9, 0x47, 0x47, 0x37, 0x09, 0xdd,
+	0xda, 0xc7, 0x0c, 0x1e, 0x07, 0x27, 0x09, 0xcd, 0x27, 0x27, 0x57, 0x07,
+	0x66, 0x19, 0x61, 0x96, 0xe7, 0x46, 0x9a, 0x9d, 0x5b, 0x70, 0x70, 0x57,
+	0x09, 0x1b, 0x61, 0x88, 0x86, 0x5b, 0x65, 0xc1, 0x99, 0x86, 0x5c, 0x19,
+	0x73, 0x70, 0x92, 0x42, 0xf1, 0x75, 0x65, 0xc2, 0x69, 0xd9, 0xc5, 0xcd,
+	0xd9, 0xa9, 0xce, 0x70, 0x61, 0xc5, 0x99, 0x1c, 0x95, 0x97, 0x36, 0x98,
+	0x6a, 0x71, 0x6a, 0x15, 0x59, 0x75, 0x74, 0x56, 0x1c, 0x5c, 0x58, 0x61,
+	0xcd, 0xc5, 0x96, 0x5c, 0x9c, 0xd5, 0xb7, 0x06, 0x98, 0xb6, 0x49, 0xc5,
+	0xd9, 0xa7, 0x59, 0xcd, 0xc1, 0x5d, 0x15, 0xdd, 0xd1, 0x66, 0x99, 0x70,
+	0x6d, 0x99, 0xc1, 0x96, 0xd8, 0x61, 0xa1, 0xb9, 0x96, 0x9b, 0x6e, 0x56,
+	0xd6, 0x70, 0x73, 0x78, 0x19, 0x73, 0x6a, 0x77, 0x91, 0x96, 0x59, 0x75,
+	0x62, 0x74, 0x74, 0x9c, 0xa6, 0xa7, 0x06, 0xa4, 0x1d, 0x9c, 0xdd, 0xe7,
+	0x27, 0x5b, 0xde, 0x70, 0x76, 0x78, 0x19, 0x72, 0x65, 0xd9, 0xda, 0x70,
+	0x76, 0x6d, 0xb9, 0x97, 0x07, 0x81, 0x58, 0x66, 0x58, 0x65, 0xd1, 0x97,
+	0x04, 0x92, 0x47, 0x36, 0x26, 0x5c, 0x5c, 0x66, 0xd9, 0x71, 0x4b, 0x87,
+	0x07, 0x67, 0x39, 0xc1, 0xcd, 0xcd, 0xcd, 0xc6, 0x47, 0x37, 0x1b, 0xca,
+	0x1a, 0x6d, 0xe0, 0x75, 0x61, 0x1e, 0x09, 0xc1, 0x87, 0x26, 0x18, 0x61,
+	0xd1, 0xc5, 0x67, 0x37, 0x82, 0x60, 0x49, 0x87, 0x37, 0x16, 0xe2, 0x74,
+	0x57, 0x17, 0x09, 0xd2, 0x46, 0x5b, 0x75, 0x87, 0x66, 0x67, 0x36, 0x67,
+	0x44, 0x86, 0x19, 0x6e, 0x57, 0x81, 0x86, 0x9d, 0x26, 0x5d, 0x1a, 0x75,
+	0x6d, 0xd9, 0xdd, 0x5a, 0x78, 0x1d, 0x1c, 0x1e, 0x09, 0xa9, 0x86, 0x1c,
+	0x5a, 0x71, 0x72, 0x91, 0xa7, 0x46, 0x5a, 0x78, 0x26, 0x55, 0x89, 0x89,
+	0x84, 0x59, 0x5c, 0xda, 0x62, 0x47, 0x09, 0xa7, 0x46, 0x66, 0x27, 0x15,
+	0x69, 0x25, 0x57, 0x06, 0x64, 0x70, 0x6d, 0xa7, 0x47, 0x56, 0x1d, 0x1d,
+	0xdb, 0x69, 0x96, 0x59, 0x76, 0x74, 0x6d, 0xa9, 0x99, 0x97, 0x06, 0x5a,
+	0x9c, 0x5b, 0x57, 0x05, 0x74, 0x73, 0x71, 0x62, 0x46, 0x1d, 0xe1, 0xd2,
+	0x6a, 0x72, 0x72, 0x6d, 0xc5, 0xdd, 0xdd, 0x5a, 0x75, 0x95, 0xd2, 0x65,
+	0xb7, 0x80, 0x49, 0x67, 0x47, 0x2b, 0x87, 0x55, 0xbc, 0x73, 0x90, 0x05,
+	0x71, 0x78, 0x1d, 0x5d, 0x67, 0x07, 0x56, 0x9b, 0x6d, 0x15, 0x87, 0x81,
+	0xe0, 0x74, 0x77, 0x6d, 0xc1, 0xc9, 0x1e, 0x09, 0x59, 0x9d, 0x66, 0x98,
+	0x9c, 0x59, 0x6d, 0x27, 0x35, 0x78, 0x27, 0x07, 0x81, 0xa7, 0x07, 0x06,
+	0xd5, 0x89, 0x1e, 0x07, 0x27, 0x09, 0x27, 0x07, 0x59, 0x1c, 0x59, 0x72,
+	0x6e, 0x18, 0x65, 0xca, 0x74, 0x59, 0x99, 0xc3, 0x31, 0x87, 0x28, 0x73,
+	0x61, 0xc6, 0x46, 0x9d, 0x15, 0x59, 0x76, 0x75, 0x5c, 0x73, 0xd7, 0x45,
+	0x71, 0x77, 0x57, 0x07, 0x47, 0x46, 0x1c, 0x9e, 0x07, 0x57, 0x57, 0x09,
+	0xd9, 0xb9, 0x99, 0xe0, 0x47, 0x17, 0x17, 0x81, 0xc1, 0xb9, 0xd3, 0x3a,
+	0x86, 0x1e, 0x08, 0x9c, 0xd8, 0xc7, 0x83, 0x33, 0x33, 0x1d, 0x0c, 0xc6,
+	0x52, 0x59, 0xd2, 0x59, 0x29, 0xce, 0x62, 0x61, 0x67, 0x76, 0xda, 0x9c,
+	0x59, 0x62, 0x69, 0x56, 0xe2, 0x59, 0xc5, 0xa6, 0xb1, 0x67, 0x83, 0x3c,
+	0x5d, 0xb1, 0xcf, 0x47, 0x82, 0xd9, 0x4c, 0xe0, 0x73, 0xce, 0x5d, 0xe7,
+	0x49, 0x86, 0x71, 0x99, 0x9b, 0x6f, 0x09, 0xbb, 0xc9, 0x99, 0xc5, 0x27,
+	0x29, 0xc1, 0xe0, 0x2f, 0x82, 0xed, 0xa7, 0x5b, 0xce, 0x22, 0x19, 0x56,
+	0x9e, 0x07, 0x81, 0xe0, 0x78, 0x19, 0x78, 0x11, 0xe0, 0x78, 0x1c, 0x91,
+	0xc9, 0xc1, 0x99, 0x9b, 0x87, 0x66, 0x9c, 0x9c, 0x71, 0x9c, 0x5c, 0x76,
+	0xbd, 0xf1, 0xc3, 0x18, 0x63, 0x2c, 0xa7, 0x46, 0xe7, 0x47, 0x0b, 0xc9,
+	0xcb, 0x1c, 0x1d, 0x6d, 0x95, 0x66, 0x52, 0x72, 0x96, 0x70, 0xce, 0x5b,
+	0x9c, 0x5c, 0x31, 0x1a, 0x71, 0x9c, 0x67, 0x17, 0x26, 0x26, 0xe7, 0x27,
+	0x09, 0xd1, 0xdd, 0xd6, 0x77, 0xa7, 0x77, 0x6c, 0xe9, 0x5d, 0x1e, 0x07,
+	0x49, 0xe0, 0x61, 0xd1, 0xe0, 0x76, 0x75, 0xbd, 0x1a, 0x72, 0x76, 0x75,
+	0x62, 0x6a, 0x62, 0x73, 0x56, 0x1c, 0xe6, 0x9c, 0x65, 0x61, 0xe0, 0x69,
+	0xab, 0xcd, 0xb7, 0x66, 0x5c, 0x18, 0x55, 0x6d, 0x66, 0xe6, 0xdc, 0x99,
+	0x6d, 0xa6, 0x1a, 0x56, 0x1d, 0xdd, 0xd8, 0x9d, 0xe7, 0x59, 0xd2, 0x72,
+	0x61, 0x9b, 0x1c, 0x1c, 0xdd, 0xdc, 0x9d, 0x6e, 0x9c, 0x1c, 0xa7, 0x27,
+	0x27, 0x26, 0x5c, 0x9d, 0xe7, 0x4c, 0x73, 0xc6, 0x31, 0xa6, 0xdc, 0x5c,
+	0x2e, 0x84, 0x76, 0x66, 0xed, 0x89, 0xa9, 0xe0, 0x96, 0x76, 0x6d, 0x67,
+	0x27, 0x38, 0x66, 0x46, 0x97, 0x5c, 0xa7, 0x26, 0xa6, 0xd8, 0x72, 0x69,
+	0x5d, 0x9a, 0x9c, 0xdc, 0xd5, 0x96, 0xdb, 0x57, 0x07, 0x61, 0xdd, 0x18,
+	0x65, 0xd5, 0xe0, 0x78, 0x18, 0x65, 0xcd, 0xc1, 0xa1, 0xc5, 0x87, 0x67,
+	0x56, 0x9a, 0x6d, 0xd1, 0xc5, 0xa7, 0x79, 0x97, 0x67, 0x49, 0xd2, 0x9e,
+	0x07, 0x76, 0x5e, 0x07, 0x39, 0x1d, 0x22, 0x46, 0x5c, 0x51, 0xd9, 0xa8,
+	0xa7, 0x57, 0x46, 0xef, 0x83, 0x1c, 0x5d, 0x19, 0x66, 0x73, 0x92, 0x6a,
+	0x70, 0x66, 0x73, 0x9c, 0xf1, 0xd9, 0x87, 0x26, 0xd5, 0x99, 0xd1, 0x27,
+	0x26, 0x25, 0x69, 0x5c, 0x95, 0xcd, 0xd5, 0x97, 0x25, 0xb9, 0x56, 0x1d,
+	0xa6, 0x18, 0x72, 0x65, 0x89, 0x85, 0x66, 0x69, 0xc6, 0x73, 0xc6, 0x31,
+	0xac, 0x6a, 0xf2, 0x31, 0xa6, 0x51, 0xca, 0x75, 0x75, 0x75, 0x9d, 0xa5,
+	0x65, 0xa9, 0xd9, 0xa6, 0x98, 0x91, 0xdd, 0xb4, 0x98, 0x9a, 0x6a, 0x62,
+	0x57, 0x46, 0xa6, 0x1c, 0x15, 0xc1, 0xc2, 0x69, 0xd9, 0xb9, 0xdd, 0xc9,
+	0xc5, 0xcd, 0xc1, 0xb7, 0x26, 0x58, 0x77, 0x51, 0xdd, 0x12, 0xe1, 0x9b,
+	0xb6, 0xa7, 0x82, 0x77, 0x66, 0x47, 0x59, 0x1a, 0x73, 0x69, 0xa6, 0x5d,
+	0x1d, 0x1d, 0x9a, 0x87, 0x76, 0x5c, 0x67, 0x27, 0x19, 0x87, 0x0c, 0xf4,
+	0x9c, 0x6e, 0xf1, 0xd8, 0x65, 0xe0, 0x72, 0x9b, 0x11, 0xe0, 0x78, 0x1a,
+	0x77, 0x61, 0x96, 0x15, 0x6e, 0x5c, 0x1a, 0x9c, 0x19, 0x89, 0xc1, 0xc5,
+	0xdd, 0x26, 0x24, 0x74, 0x6d, 0x97, 0x69, 0x97, 0x45, 0x61, 0xdd, 0x58,
+	0x6d, 0x58, 0x65, 0xc6, 0x72, 0x65, 0xc1, 0x97, 0x04, 0x76, 0x57, 0x81,
+	0xb6, 0xd8, 0x78, 0x27, 0x27, 0x07, 0x67, 0x55, 0x70, 0x75, 0x57, 0x07,
+	0x02, 0x69, 0xd1, 0x87, 0x47, 0x07, 0x46, 0x1b, 0x71, 0x74, 0x72, 0x71,
+	0x74, 0x65, 0xc1, 0x19, 0x62, 0x71, 0x95, 0x89, 0xc1, 0x97, 0x76, 0x59,
+	0xb8, 0x9c, 0x9c, 0x99, 0x65, 0x5b, 0x59, 0xc9, 0xd9, 0xde, 0xe5, 0x96,
+	0xe6, 0x19, 0x58, 0x65, 0xd1, 0xd1, 0x97, 0x47, 0x81, 0xa7, 0x57, 0x55,
+	0xb9, 0xb6, 0xe5, 0x87, 0x59, 0x67, 0x16, 0x18, 0x76, 0x72, 0xc7, 0x47,
+	0x56, 0xa6, 0xdc, 0x55, 0xde, 0x46, 0xa7, 0x16, 0xdb, 0x9c, 0x6f, 0x07,
+	0x07, 0x17, 0x59, 0xc1, 0xc9, 0x84, 0x98, 0x9c, 0x9a, 0x71, 0x66, 0x1b,
+	0x9c, 0xdd, 0x5c, 0xdd, 0xd9, 0x71, 0x49, 0x26, 0xda, 0x72, 0x66, 0x59,
+	0xb5, 0x9a, 0xbb, 0x27, 0x66, 0x31, 0x5d, 0x5c, 0x58, 0x9d, 0x5d, 0xe6,
+	0x1d, 0x59, 0x75, 0x75, 0x58, 0x62, 0x66, 0x57, 0x06, 0x9c, 0x55, 0x5c,
+	0x18, 0xbc, 0x1d, 0x1b, 0x9d, 0x5b, 0x69, 0xd1, 0x55, 0xc6, 0x72, 0xbd,
+	0x1d, 0x9d, 0x9d, 0x9c, 0xdb, 0x69, 0xc5, 0xc6, 0x73, 0x5b, 0xb6, 0xa4,
+	0x71, 0x6d, 0xbc, 0x75, 0x99, 0x9d, 0x2f, 0x07, 0x24, 0x91, 0xd1, 0xd1,
+	0xdd, 0x5c, 0x96, 0x47, 0x67, 0x56, 0x6c, 0x6d, 0x66, 0x09, 0x1c, 0x99,
+	0x71, 0x72, 0x59, 0xd1, 0xb5, 0x69, 0xa6, 0xa4, 0x69, 0xc1, 0xb9, 0x87,
+	0x47, 0x07, 0x56, 0x55, 0x5b, 0x61, 0xc6, 0x77, 0x6a, 0x77, 0x55, 0x98,
+	0x9b, 0x27, 0x37, 0x27, 0x27, 0x29, 0xc2, 0xf7, 0xbd, 0xd5, 0x87, 0x57,
+	0x57, 0x47, 0x66, 0x26, 0x1a, 0xb9, 0xb2, 0x74, 0x75, 0x9a, 0x69, 0xc9,
+	0xdd, 0xcd, 0x96, 0x5d, 0x66, 0x9c, 0x1c, 0xa6, 0x9d, 0x18, 0x98, 0x56,
+	0x1b, 0x70, 0x6e, 0x6d, 0xe0, 0x9a, 0x77, 0x6b, 0x1d, 0x31, 0xd1, 0x5d,
+	0xdd, 0x1c, 0xa8, 0x77, 0x78, 0x1b, 0x66, 0x9c, 0xda, 0x69, 0xa9, 0xde,
+	0xf6, 0xbd, 0xaf, 0x52, 0xc6, 0x52, 0xc6, 0xdd, 0x27, 0x39, 0xb9, 0xe0,
+	0xcf, 0x59, 0xa9, 0x88, 0x71, 0x71, 0x61, 0x64, 0x61, 0x86, 0x5c, 0xda,
+	0x65, 0x95, 0x66, 0x74, 0x95, 0x87, 0x79, 0x24, 0x90, 0x91, 0x94, 0x69,
+	0xb9, 0x2e, 0x27, 0x19, 0x86, 0x66, 0x5b, 0x75, 0x78, 0x1e, 0x06, 0x26,
+	0x9b, 0x60, 0x62, 0x1c, 0x95, 0xc9, 0x67, 0x49, 0xb3, 0x1c, 0x06, 0xaf,
+	0x57, 0x81, 0xd5, 0xd6, 0xf2, 0x75, 0x9e, 0x04, 0x72, 0x2e, 0x62, 0x1d,
+	0x2a, 0xe5, 0xd9, 0x58, 0x8b, 0x89, 0x87, 0x56, 0x21, 0xa9, 0x86, 0x1c,
+	0xdd, 0xd9, 0x69, 0x97, 0x06, 0x26, 0x98, 0x9e, 0x07, 0x39, 0xb7, 0x27,
+	0x21, 0xc2, 0x65, 0xce, 0x61, 0xd2, 0x47, 0x76, 0x6e, 0xe7, 0x67, 0x16,
+	0x5b, 0x57, 0x47, 0x47, 0x38, 0x75, 0x69, 0xb7, 0x46, 0xd8, 0x71, 0x74,
+	0x76, 0x9e, 0x07, 0x06, 0x9a, 0x69, 0x6e, 0xd8, 0x61, 0xce, 0x46, 0x5d,
+	0x1b, 0x62, 0xa7, 0x17, 0x27, 0x67, 0x66, 0xdc, 0x1d, 0x31, 0xdd, 0x96,
+	0x65, 0x66, 0xf4, 0x65, 0xdd, 0xa9, 0x15, 0xe0, 0x62, 0x49, 0x5c, 0x5a,
+	0x76, 0x75, 0x6d, 0xc5, 0x27, 0x46, 0xdb, 0x73, 0x66, 0x24, 0x73, 0x61,
+	0x97, 0x19, 0xc2, 0x46, 0x5d, 0x19, 0x9b, 0x74, 0x74, 0x91, 0xb7, 0x07,
+	0x49, 0x96, 0x11, 0xd1, 0xdc, 0x61, 0xc5, 0xe0, 0x59, 0xc1, 0x87, 0x27,
+	0x26, 0x9a, 0x77, 0x73, 0x70, 0x92, 0x1d, 0x20, 0x9c, 0x26, 0xd5, 0xc1,
+	0xc9, 0xcd, 0xd2, 0x55, 0x61, 0x18, 0x71, 0x62, 0xf8, 0x30, 0xc6, 0x31,
+	0x86, 0x1d, 0x5a, 0x73, 0x76, 0x59, 0x97, 0x37, 0x37, 0x45, 0x56, 0x9a,
+	0x65, 0xb5, 0x91, 0x64, 0x91, 0xb7, 0x08, 0x1c, 0x21, 0xc9, 0x56, 0x64,
+	0x76, 0x61, 0xd1, 0x99, 0xa6, 0x2f, 0x37, 0x25, 0x69, 0xdd, 0xdd, 0xd1,
+	0xa7, 0x06, 0xe7, 0x16, 0x9d, 0x98, 0x69, 0xcd, 0xc9, 0xc9, 0x97, 0x76,
+	0x5b, 0x77, 0x9a, 0x72, 0x73, 0x70, 0x6d, 0x16, 0x70, 0x87, 0x5b, 0x5a,
+	0xbd, 0x5a, 0x78, 0x27, 0x47, 0x39, 0xa9, 0x5c, 0x1d, 0x5e, 0x07, 0x46,
+	0x18, 0x71, 0x47, 0x59, 0xd1, 0xc1, 0xb7, 0x37, 0x07, 0x47, 0x15, 0x91,
+	0xc9, 0xcd, 0x1c, 0xc7, 0x14, 0x69, 0xd1, 0xc6, 0x49, 0x59, 0x9e, 0x0b,
+	0x2f, 0x25, 0x98, 0x66, 0xe1, 0xb7, 0x46, 0x27, 0x09, 0x97, 0x6b, 0x67,
+	0x49, 0x89, 0xa7, 0x09, 0x66, 0x1c, 0xf3, 0x27, 0x32, 0x1b, 0x65, 0xc6,
+	0x61, 0xc1, 0xda, 0x6e, 0x71, 0x9d, 0x5c, 0x5b, 0x95, 0xc9, 0x87, 0x07,
+	0x19, 0xc9, 0x95, 0x9c, 0x31, 0xd9, 0xb6, 0x5d, 0x5c, 0x9b, 0x71, 0x75,
+	0x75, 0x70, 0x9c, 0x9c, 0x16, 0x76, 0x61, 0xc6, 0x61, 0x97, 0x07, 0x37,
+	0x36, 0x1c, 0x1c, 0x9c, 0x1a, 0x92, 0x46, 0xdc, 0x26, 0x9d, 0x5d, 0x25,
+	0x69, 0xca, 0x57, 0x36, 0x27, 0x67, 0x29, 0xa9, 0xc5, 0xc2, 0x49, 0x5d,
+	0x5c, 0x55, 0xc5, 0x64, 0x91, 0xc1, 0xd1, 0xdd, 0xa6, 0x1d, 0x9d, 0x55,
+	0x85, 0x76, 0x6d, 0x86, 0x5a, 0x61, 0x86, 0xdb, 0x9c, 0x19, 0x65, 0x86,
+	0x55, 0xb6, 0xda, 0x61, 0xd1, 0xd5, 0x86, 0x1d, 0x15, 0xd5, 0xa7, 0x46,
+	0x1e, 0x06, 0xe7, 0x57, 0x27, 0x82, 0x16, 0x61, 0x87, 0x76, 0xdb, 0x69,
+	0xe0, 0x78, 0x19, 0xbc, 0x71, 0xc2, 0xf5, 0xb6, 0xf3, 0x65, 0x1a, 0x9a,
+	0x71, 0xbe, 0x09, 0x1d, 0x9a, 0x9c, 0x55, 0x86, 0x26, 0x66, 0xa5, 0x9c,
+	0x99, 0x73, 0x73, 0x89, 0x99, 0x5c, 0xdd, 0x26, 0x9c, 0x5b, 0x69, 0xa6,
+	0x1d, 0x26, 0xdc, 0x9c, 0x9c, 0x26, 0xdd, 0xe7, 0x17, 0x15, 0x71, 0x59,
+	0xc6, 0x72, 0x70, 0x74, 0x77, 0x69, 0x87, 0x67, 0x55, 0x61, 0x5d, 0x9b,
+	0x61, 0xd5, 0xd5, 0x5e, 0x06, 0xdc, 0x1d, 0xdc, 0x9c, 0x5c, 0xdc, 0x1d,
+	0xdd, 0xd5, 0xc1, 0xb7, 0x57, 0x01, 0x96, 0xd8, 0x57, 0x36, 0x18, 0x65,
+	0x97, 0x77, 0x77, 0x16, 0x5c, 0xe4, 0x9c, 0xa1, 0xa7, 0x55, 0x87, 0x36,
+	0x59, 0x71, 0x62, 0x6e, 0x71, 0xbd, 0xaf, 0x62, 0x72, 0x65, 0x1a, 0x74,
+	0x74, 0x74, 0x9e, 0x09, 0x59, 0x9c, 0x1b, 0x56, 0x26, 0x27, 0x37, 0x77,
+	0x06, 0xda, 0x9c, 0xe4, 0x61, 0xc5, 0xd1, 0x89, 0x19, 0x9c, 0x92, 0x65,
+	0xa9, 0xc2, 0x76, 0xb1, 0xd9, 0xbb, 0xca, 0x18, 0x1e, 0x09, 0xc9, 0xa7,
+	0x36, 0x5d, 0x1b, 0x9d, 0x5d, 0xa7, 0x39, 0xd9, 0xc5, 0xd6, 0xf4, 0x77,
+	0x9b, 0x66, 0x57, 0x17, 0x56, 0x27, 0x77, 0x57, 0x67, 0x67, 0x09, 0x89,
+	0xb9, 0xc5, 0xc5, 0x5c, 0x56, 0x77, 0x98, 0x70, 0x74, 0x98, 0x6a, 0x74,
+	0x9d, 0xe7, 0x7c, 0xee, 0x77, 0x65, 0x1a, 0x9d, 0x5d, 0xa7, 0x69, 0xc6,
+	0x74, 0x6a, 0x71, 0x9b, 0x77, 0x66, 0x66, 0x6a, 0x49, 0xd2, 0x74, 0x72,
+	0x73, 0x9d, 0x26, 0x49, 0xd1, 0x97, 0x09, 0xd1, 0xd5, 0x86, 0x9d, 0x1c,
+	0x19, 0x66, 0x62, 0x6e, 0x6e, 0x78, 0x09, 0xb6, 0x51, 0xa8, 0x9a, 0x9d,
+	0xe6, 0xa6, 0x9d, 0x1d, 0xc4, 0x47, 0x08, 0x86, 0x58, 0x9c, 0x24, 0x9d,
+	0x67, 0x07, 0x56, 0x5a, 0x71, 0x61, 0x52, 0xf5, 0x71, 0x74, 0x65, 0xc9,
+	0xb7, 0x46, 0x11, 0x89, 0x96, 0xe6, 0x9a, 0x73, 0x69, 0xc1, 0xd9, 0x99,
+	0xdd, 0x27, 0x65, 0x74, 0x9c, 0xdb, 0x6d, 0x95, 0x6e, 0x78, 0x1d, 0x18,
+	0x76, 0x66, 0x73, 0x89, 0x5c, 0x1c, 0x1d, 0x1b, 0x71, 0x73, 0x65, 0x89,
+	0x97, 0x16, 0xd9, 0x65, 0xdd, 0xd1, 0x51, 0xd6, 0x56, 0xa6, 0x25, 0x6e,
+	0x57, 0x57, 0x29, 0xa5, 0x65, 0xd9, 0xce, 0x9c, 0xdd, 0x5a, 0x65, 0x1b,
+	0x65, 0x87, 0x81, 0x97, 0x06, 0x26, 0xd8, 0x8a, 0x56, 0xdc, 0x5c, 0x58,
+	0x65, 0xd6, 0x65, 0x99, 0xa2, 0xf6, 0x6e, 0x1b, 0x9b, 0x98, 0x75, 0x65,
+	0xa6, 0xa1, 0x5d, 0x1d, 0x1e, 0x09, 0xb1, 0xd9, 0xcd, 0xb6, 0x5c, 0x17,
+	0x1c, 0x26, 0x5d, 0x66, 0x26, 0x27, 0x07, 0x37, 0x11, 0x1c, 0xdc, 0x5c,
+	0x9d, 0xdd, 0xd5, 0x66, 0x55, 0xa7, 0x47, 0x07, 0x16, 0x64, 0x65, 0xb6,
+	0x1e, 0x06, 0xd8, 0x61, 0xb7, 0x67, 0x82, 0x06, 0xdd, 0xdb, 0x65, 0xcd,
+	0xd1, 0x87, 0x29, 0x97, 0x09, 0x94, 0x6d, 0x97, 0x17, 0x69, 0x2d, 0x72,
+	0x87, 0x81, 0x66, 0x1e, 0x07, 0x06, 0x5d, 0x1a, 0x73, 0x65, 0x58, 0x70,
+	0x91, 0xdd, 0xb6, 0xa7, 0x26, 0x98, 0x71, 0x65, 0xd5, 0xc5, 0xd9, 0x87,
+	0x07, 0x67, 0x06, 0xa7, 0x16, 0xa5, 0x72, 0x59, 0x58, 0x6d, 0x18, 0x57,
+	0x56, 0x15, 0x87, 0x56, 0xd5, 0x97, 0x81, 0xd5, 0xcd, 0x87, 0x27, 0x46,
+	0xe2, 0x26, 0x21, 0xc9, 0xc9, 0xd0, 0x47, 0x29, 0x87, 0x06, 0x9c, 0x9a,
+	0x98, 0x73, 0x65, 0xd1, 0xcd, 0xe0, 0x6d, 0xcd, 0xc5, 0xe0, 0x75, 0x91,
+	0x87, 0x81, 0x85, 0x9a, 0x69, 0xd9, 0xd9, 0xde, 0x1d, 0x9e, 0x07, 0x67,
+	0x31, 0xc6, 0x62, 0x56, 0x5d, 0x1d, 0x5a, 0x9a, 0x55, 0x91, 0x64, 0x76,
+	0x70, 0x73, 0x65, 0xe0, 0x65, 0xb6, 0x26, 0x9b, 0x61, 0x86, 0xde, 0x09,
+	0x1d, 0x86, 0xde, 0x06, 0xdc, 0x9c, 0x66, 0x9a, 0x6a, 0x6d, 0xdd, 0xd1,
+	0x99, 0x99, 0xb7, 0x57, 0x82, 0x1d, 0xa5, 0x74, 0x71, 0x99, 0x47, 0x77,
+	0x54, 0x49, 0xc9, 0x86, 0xdc, 0x19, 0x99, 0x55, 0x6d, 0x55, 0xdd, 0x66,
+	0x25, 0x61, 0xa9, 0x89, 0xc1, 0xb7, 0x6b, 0x21, 0xc1, 0x97, 0x16, 0x95,
+	0xca, 0x47, 0x39, 0xc6, 0x6e, 0x1c, 0xaf, 0x27, 0x1b, 0xd2, 0x1c, 0x5c,
+	0x19, 0xb8, 0xbc, 0x6f, 0x55, 0x61, 0xa6, 0x9c, 0xd8, 0x73, 0x75, 0x76,
+	0x65, 0x97, 0x36, 0xa7, 0x29, 0xc6, 0x19, 0x95, 0xd1, 0xc6, 0x72, 0x72,
+	0x74, 0x73, 0x57, 0x7b, 0x8d, 0x72, 0x61, 0x99, 0xa5, 0x74, 0x73, 0x59,
+	0xa7, 0x27, 0x56, 0x27, 0x81, 0xd9, 0x67, 0x27, 0x26, 0xdd, 0xda, 0x46,
+	0x9c, 0xdc, 0x5c, 0xdc, 0x19, 0x70, 0x47, 0x48, 0x87, 0x36, 0x9c, 0xda,
+	0x98, 0x64, 0x72, 0x71, 0x72, 0x71, 0x57, 0x27, 0x56, 0x5a, 0x1b, 0x72,
+	0x9c, 0x26, 0x0c, 0x07, 0x2c, 0x78, 0x1c, 0x67, 0x77, 0x19, 0xca, 0xf7,
+	0x65, 0x73, 0xb7, 0x81, 0x89, 0x87, 0x77, 0x51, 0xc2, 0x47, 0x27, 0x57,
+	0x57, 0x17, 0x56, 0x5d, 0x5c, 0x19, 0x57, 0x57, 0x56, 0x1d, 0x5d, 0x5c,
+	0xd1, 0x99, 0x86, 0x66, 0x25, 0x61, 0xa9, 0x97, 0x16, 0xdc, 0x58, 0x70,
+	0x56, 0xd1, 0xc5, 0xd5, 0xd9, 0x15, 0xa6, 0xe6, 0x9d, 0x1a, 0x70, 0x73,
+	0x9a, 0x61, 0xc5, 0xcd, 0xd5, 0xc9, 0xb7, 0x59, 0x97, 0x2c, 0x73, 0x6d,
+	0x66, 0xdb, 0x73, 0x77, 0x65, 0xc5, 0x96, 0xd8, 0x9d, 0x1d, 0x2e, 0xdc,
+	0x67, 0x06, 0x1c, 0x69, 0xc6, 0x71, 0x78, 0x19, 0xba, 0x74, 0x76, 0x75,
+	0x72, 0x98, 0x1d, 0x65, 0x6d, 0xc9, 0xd1, 0xc5, 0xa6, 0xed, 0xb9, 0x70,
+	0x9b, 0xb8, 0x71, 0x61, 0xc9, 0x55, 0x18, 0x73, 0x77, 0x74, 0x69, 0xc2,
+	0x1c, 0x1d, 0x5a, 0x69, 0x88, 0x77, 0x56, 0x18, 0x62, 0x71, 0x6d, 0x97,
+	0x15, 0x1c, 0x98, 0x71, 0x60, 0x61, 0x87, 0x36, 0x27, 0x74, 0x65, 0xce,
+	0x1d, 0x5c, 0x1d, 0xda, 0x6a, 0x6a, 0x65, 0xd2, 0x61, 0xe0, 0x73, 0x1c,
+	0x9c, 0x64, 0x69, 0xe0, 0x76, 0x78, 0x1c, 0xa5, 0x71, 0xba, 0x98, 0x89,
+	0x55, 0x9b, 0xca, 0xf7, 0xbd, 0x6f, 0x7b, 0xd5, 0x94, 0x6a, 0x62, 0x59,
+	0xd5, 0x86, 0xe6, 0x5d, 0x5b, 0x78, 0x2c, 0xce, 0x98, 0x9a, 0x11, 0xc6,
+	0x65, 0xd2, 0x49, 0xc5, 0xd9, 0xd1, 0x99, 0xd9, 0xc2, 0x73, 0x99, 0x72,
+	0x69, 0x97, 0x07, 0x15, 0x9c, 0x5a, 0x70, 0x12, 0x71, 0x65, 0xa7, 0x0a,
+	0x9d, 0x2e, 0x1d, 0x1a, 0x98, 0x72, 0x71, 0x73, 0x9c, 0xda, 0x62, 0xd9,
+	0x64, 0x77, 0x47, 0x79, 0x1d, 0x1c, 0x1b, 0x6d, 0xd1, 0x8b, 0xc7, 0x19,
+	0xc6, 0x67, 0x36, 0x1c, 0x5a, 0x76, 0xb8, 0x58, 0x91, 0xcd, 0xe0, 0x75,
+	0x69, 0xc2, 0x48, 0xa6, 0x6f, 0x47, 0x68, 0x88, 0x63, 0x1d, 0xf1, 0xde,
+	0xf3, 0x9c, 0x2f, 0x36, 0x59, 0xba, 0xba, 0x71, 0x74, 0x75, 0x9c, 0x5e,
+	0x09, 0xde, 0x75, 0x69, 0xde, 0x21, 0xc9, 0x87, 0x67, 0x68, 0x88, 0x65,
+	0x96, 0xde, 0x0b, 0xcf, 0x0b, 0xdd, 0xda, 0x5c, 0x78, 0x16, 0xee, 0xe9,
+	0x95, 0x9c, 0xd9, 0x62, 0x6e, 0x6e, 0x6d, 0x86, 0x5b, 0x70, 0x61, 0x67,
+	0x56, 0x71, 0xe0, 0x9c, 0xda, 0x9d, 0x27, 0x79, 0xde, 0xed, 0x59, 0x73,
+	0x9e, 0x0b, 0xd9, 0xd1, 0x94, 0x78, 0x1c, 0x1c, 0x19, 0xbc, 0x2f, 0x6b,
+	0x87, 0x06, 0x55, 0xc9, 0x55, 0xb6, 0x58, 0xb9, 0x99, 0x6e, 0x65, 0xc2,
+	0xe1, 0xd6, 0xe9, 0xc6, 0x1a, 0x55, 0x61, 0x5c, 0x5c, 0xdb, 0x9b, 0x98,
+	0x69, 0xd1, 0xb5, 0x98, 0x57, 0x27, 0x31, 0xc9, 0xd5, 0xc5, 0xc1, 0xa6,
+	0x1d, 0x1b, 0x6d, 0xd1, 0xd1, 0xc1, 0xd1, 0xd9, 0x66, 0x1a, 0xbd, 0xdd,
+	0x1d, 0x2f, 0x06, 0xda, 0x4b, 0xc5, 0x5d, 0x86, 0x1c, 0xe6, 0xdd, 0xa1,
+	0x97, 0x82, 0x61, 0x96, 0x21, 0xc9, 0xa4, 0x62, 0x1c, 0x9c, 0x58, 0x70,
+	0x6a, 0x6d, 0xca, 0x65, 0xd5, 0xcd, 0xa7, 0x77, 0x0b, 0xc9, 0xca, 0xe5,
+	0xc9, 0x96, 0x1d, 0x6f, 0x77, 0x29, 0x15, 0x59, 0x98, 0x75, 0x56, 0x1c,
+	0x5c, 0x58, 0x65, 0xd6, 0x69, 0x96, 0x58, 0x65, 0x61, 0xca, 0x64, 0x73,
+	0x47, 0x81, 0xa7, 0x47, 0x47, 0x36, 0x1c, 0x99, 0x73, 0x6d, 0xa6, 0x5a,
+	0x76, 0x71, 0x65, 0x86, 0xe5, 0x71, 0x65, 0xd5, 0xa6, 0x9b, 0x70, 0x6d,
+	0xcd, 0xc1, 0xc2, 0x6d, 0xc5, 0xc5, 0xc6, 0x66, 0x61, 0x87, 0x56, 0x9c,
+	0x58, 0x99, 0x73, 0x66, 0x72, 0x9c, 0x9d, 0x9c, 0x19, 0x91, 0xc9, 0x5e,
+	0x07, 0x6b, 0xd5, 0xc5, 0x98, 0x71, 0x76, 0x78, 0x19, 0x57, 0x06, 0x18,
+	0x9c, 0xdb, 0x74, 0x75, 0x1c, 0x5c, 0x1b, 0x74, 0x57, 0x81, 0x96, 0x5b,
+	0x6d, 0x51, 0xce, 0x73, 0x69, 0xdd, 0xa7, 0x76, 0x18, 0x18, 0x6d, 0xc2,
+	0x6d, 0xa6, 0x59, 0x74, 0x56, 0x5c, 0x9c, 0x9b, 0x9c, 0xa6, 0x0b, 0xe0,
+	0x1c, 0x2e, 0x5d, 0x9d, 0x5c, 0x9d, 0xa7, 0x82, 0xf6, 0x61, 0xd8, 0x47,
+	0x17, 0x19, 0x24, 0x89, 0x97, 0x46, 0x67, 0x37, 0x80, 0x70, 0x77, 0x69,
+	0xcd, 0xdd, 0xdd, 0xdd, 0x87, 0x71, 0x1d, 0xe4, 0x75, 0x78, 0x1e, 0x07,
+	0x81, 0xd1, 0x97, 0x81, 0xc1, 0x87, 0x55, 0x72, 0x49, 0xa5, 0x9b, 0x61,
+	0xca, 0x73, 0x57, 0x57, 0x37, 0x56, 0x9d, 0x5d, 0x19, 0x75, 0x70, 0x9c,
+	0x59, 0x65, 0xd2, 0x71, 0x75, 0x6d, 0x99, 0xd2, 0x1c, 0x5d, 0x9c, 0x21,
+	0xc1, 0xb5, 0x73, 0x71, 0x74, 0x69, 0xd1, 0x27, 0x75, 0x71, 0x6d, 0x5c,
+	0xe6, 0x5d, 0x26, 0xdc, 0xdd, 0x5d, 0x9b, 0x69, 0xc9, 0xd2, 0x25, 0x56,
+	0x9d, 0x67, 0x38, 0x9c, 0x9a, 0x76, 0x27, 0x21, 0x6e, 0xb1, 0x9c, 0x69,
+	0xa1, 0x86, 0x18, 0x65, 0xc9, 0xc5, 0x66, 0x25, 0x56, 0x56, 0x71, 0x89,
+	0x27, 0x16, 0xa2, 0x6a, 0x71, 0x72, 0x74, 0x6a, 0x6a, 0x9b, 0x72, 0x6d,
+	0xd2, 0x6d, 0xb6, 0xdd, 0x5b, 0x72, 0x1c, 0x9b, 0x76, 0x72, 0x71, 0x6e,
+	0x6a, 0x78, 0x1b, 0x78, 0x26, 0xe6, 0x82, 0x6c, 0x72, 0xbd, 0xdc, 0x5c,
+	0x5c, 0x9d, 0xda, 0x9c, 0x1d, 0xe6, 0x59, 0x9a, 0x46, 0x1b, 0x91, 0xd4,
+	0xb9, 0x72, 0xc4, 0x73, 0x9c, 0xaf, 0x03, 0x11, 0x94, 0x69, 0xc6, 0x66,
+	0x76, 0x76, 0x9c, 0x9d, 0x9b, 0x96, 0x58, 0x72, 0x66, 0x73, 0x62, 0x61,
+	0xca, 0x61, 0x27, 0x46, 0xe9, 0x97, 0x16, 0x1b, 0x61, 0x87, 0x49, 0xc9,
+	0xa6, 0x9c, 0x16, 0x77, 0x72, 0x89, 0xd1, 0x9c, 0xf2, 0x74, 0x6a, 0x58,
+	0x78, 0x2e, 0x9c, 0x9c, 0x67, 0x46, 0x1b, 0x73, 0x47, 0x17, 0x29, 0xd1,
+	0xc0, 0xd7, 0x07, 0x49, 0xa2, 0xa6, 0x71, 0xcb, 0x34, 0x78, 0x1d, 0xdd,
+	0xac, 0x9c, 0x27, 0x06, 0x18, 0x92, 0x61, 0xab, 0xc1, 0xa6, 0xa5, 0x9d,
+	0x17, 0x1d, 0x1e, 0x07, 0x6d, 0x71, 0x77, 0x77, 0x72, 0x76, 0x49, 0xb7,
+	0x47, 0x07, 0x47, 0x06, 0xdc, 0x9b, 0x76, 0x90, 0x78, 0x1b, 0xba, 0x72,
+	0x9d, 0xf1, 0xd1, 0xb2, 0x47, 0x5d, 0x66, 0xf6, 0x9c, 0xec, 0x9c, 0xdd,
+	0x9b, 0x56, 0x5c, 0x65, 0xa5, 0x61, 0xb9, 0xd2, 0x76, 0x60, 0x6d, 0xdd,
+	0xb9, 0x19, 0x70, 0x91, 0x5c, 0x5c, 0xe5, 0x62, 0x66, 0x6e, 0xc7, 0x47,
+	0x27, 0x81, 0xb9, 0xd5, 0xd6, 0x71, 0x78, 0x1b, 0x77, 0x9a, 0x92, 0xf0,
+	0x72, 0xbd, 0xe4, 0x70, 0x98, 0x65, 0x26, 0x1c, 0xdd, 0xe7, 0x47, 0x7b,
+	0xd2, 0x6a, 0x75, 0xb9, 0x99, 0x6a, 0x72, 0x75, 0x9c, 0x58, 0x76, 0x76,
+	0x65, 0xd9, 0x87, 0x54, 0x61, 0xc9, 0xb7, 0x36, 0x19, 0x77, 0x9a, 0x47,
+	0x57, 0x26, 0xe7, 0x37, 0x09, 0xca, 0x70, 0x84, 0x95, 0x87, 0x39, 0xc9,
+	0xa7, 0x14, 0x9c, 0x9c, 0x5c, 0x1d, 0xdc, 0x25, 0x70, 0x70, 0x78, 0x07,
+	0x81, 0xb7, 0x59, 0xc5, 0xcc, 0x86, 0x9d, 0x9c, 0xa1, 0x18, 0x73, 0x73,
+	0x87, 0x19, 0x1d, 0x5c, 0x18, 0x6d, 0xdd, 0xcd, 0x60, 0x44, 0x66, 0x47,
+	0x36, 0x6c, 0x66, 0xd9, 0xc6, 0x6c, 0x99, 0x70, 0x6e, 0x78, 0x05, 0x66,
+	0x59, 0xb9, 0xc2, 0x49, 0xc9, 0xda, 0x59, 0x89, 0xb6, 0xa7, 0x29, 0xd5,
+	0xc9, 0x89, 0xb7, 0x7d, 0x6e, 0x69, 0xd2, 0x22, 0x72, 0x71, 0x9d, 0x19,
+	0x71, 0xcf, 0x7c, 0xcc, 0xf1, 0x44, 0xcf, 0x2c, 0xdb, 0x9b, 0x2e, 0x27,
+	0x83, 0x1c, 0x12, 0x70, 0x78, 0x2d, 0x9c, 0xe7, 0x64, 0xba, 0x6e, 0x75,
+	0x99, 0x65, 0x89, 0xcd, 0x89, 0xce, 0x9a, 0x9c, 0xa7, 0x01, 0xd6, 0x71,
+	0xc6, 0x1c, 0xdc, 0x5d, 0x9a, 0x69, 0xe0, 0x77, 0x6f, 0x1c, 0x31, 0xb6,
+	0x9c, 0x9b, 0x70, 0x73, 0xb9, 0xc7, 0x07, 0x29, 0xdd, 0xdf, 0x39, 0x59,
+	0xc5, 0x92, 0xf0, 0x70, 0x64, 0x98, 0x72, 0xbc, 0x2c, 0x1d, 0xdd, 0x9b,
+	0x70, 0xb6, 0x73, 0xb9, 0x9c, 0xe7, 0x39, 0xc9, 0xce, 0x72, 0x9b, 0x73,
+	0x74, 0x9c, 0xe6, 0xaf, 0x47, 0x09, 0x1c, 0x9c, 0x99, 0x9e, 0x09, 0xb3,
+	0x1d, 0x5c, 0x9d, 0x9c, 0x27, 0x09, 0xc2, 0x65, 0xe0, 0x27, 0x07, 0x69,
+	0xc1, 0xe0, 0x22, 0x59, 0x9b, 0xc2, 0x66, 0xf2, 0x49, 0xc2, 0x06, 0x1c,
+	0xdb, 0x62, 0x49, 0xc9, 0xd1, 0xc9, 0xc9, 0xc5, 0x18, 0xc7, 0x82, 0x71,
+	0x84, 0xc7, 0x5c, 0x78, 0x1d, 0x26, 0xe6, 0x1d, 0xa5, 0x81, 0xd5, 0xb9,
+	0x5d, 0x9d, 0x99, 0x9d, 0x1d, 0xd5, 0xb6, 0xdd, 0xdc, 0xed, 0x78, 0x1c,
+	0x5b, 0x77, 0x77, 0x6d, 0xdd, 0xdc, 0x74, 0x6d, 0xd2, 0x74, 0x9d, 0x1d,
+	0x98, 0xbd, 0xa7, 0x49, 0xd2, 0x74, 0x94, 0x77, 0x75, 0x9d, 0x26, 0x85,
+	0x65, 0xce, 0x59, 0xc1, 0xe0, 0xbd, 0xa5, 0x98, 0xba, 0xb8, 0x6a, 0x74,
+	0x9d, 0x9c, 0x98, 0x9c, 0x5d, 0xef, 0x6b, 0x5d, 0x22, 0x27, 0x37, 0x19,
+	0xc5, 0x97, 0x1b, 0xd8, 0x0c, 0xf1, 0xce, 0xcc, 0xf0, 0x9d, 0xe7, 0x73,
+	0x4c, 0x74, 0x92, 0x73, 0xbc, 0x6a, 0x1d, 0xd5, 0x94, 0x56, 0x1a, 0x9d,
+	0xe7, 0x29, 0x96, 0xe7, 0x09, 0x96, 0xdb, 0x9d, 0x1b, 0x72, 0x1c, 0x9b,
+	0x9a, 0x72, 0x73, 0x66, 0xf0, 0x71, 0x75, 0x4b, 0x96, 0xdc, 0xa7, 0x27,
+	0x09, 0xc9, 0xc1, 0xc5, 0xc9, 0xd5, 0xc6, 0x76, 0x76, 0x75, 0x62, 0x18,
+	0x88, 0x69, 0xc1, 0xdc, 0x76, 0x8b, 0xc1, 0xce, 0x78, 0x1b, 0x70, 0x96,
+	0x6e, 0x6d, 0xce, 0xd7, 0x76, 0xe6, 0x5c, 0xda, 0x56, 0x1d, 0x9d, 0x9d,
+	0x9a, 0xc6, 0x1c, 0x16, 0x6e, 0x57, 0x46, 0x66, 0xda, 0x5d, 0x5c, 0xeb,
+	0x1e, 0x06, 0x59, 0x69, 0xd2, 0xf1, 0x61, 0x97, 0x66, 0x5d, 0xa7, 0x29,
+	0xa6, 0xef, 0x81, 0xa6, 0x9a, 0x6d, 0xc1, 0xd9, 0xc1, 0x5c, 0x5c, 0x25,
+	0x55, 0x78, 0x15, 0x96, 0x9d, 0x5a, 0x75, 0x61, 0x97, 0x19, 0x89, 0x87,
+	0x39, 0xa9, 0xac, 0x75, 0xc7, 0x1c, 0xea, 0x65, 0xd2, 0x76, 0x96, 0x62,
+	0x57, 0x82, 0xf1, 0xc7, 0x82, 0xe7, 0x1e, 0x07, 0x80, 0x78, 0x1d, 0xa7,
+	0x59, 0xc6, 0x69, 0xe0, 0x76, 0x77, 0xbd, 0x5e, 0x06, 0x73, 0x59, 0x65,
+	0x9c, 0xf7, 0x91, 0xb9, 0xd1, 0xc6, 0x75, 0x9c, 0xe7, 0x37, 0x39, 0xcd,
+	0xda, 0xe6, 0xc7, 0x3b, 0xc1, 0x87, 0x4b, 0xc1, 0x96, 0xd8, 0x76, 0x61,
+	0x51, 0x85, 0x73, 0x9e, 0x0c, 0xaf, 0x81, 0xd9, 0x99, 0x5a, 0x71, 0x9a,
+	0x8b, 0x5d, 0x64, 0x75, 0x61, 0x5b, 0xbc, 0xa7, 0x17, 0x59, 0xa6, 0x9e,
+	0x06, 0x1c, 0x27, 0x49, 0xd1, 0xd9, 0xd9, 0xdd, 0xe0, 0x75, 0x60, 0x9c,
+	0x9d, 0xd6, 0x96, 0x77, 0xbd, 0x31, 0xd5, 0x87, 0x36, 0xe7, 0x21, 0x1d,
+	0xd9, 0xbb, 0x59, 0xda, 0x66, 0x59, 0xc2, 0x73, 0x70, 0x9c, 0xdc, 0xa7,
+	0x39, 0x96, 0xe7, 0x66, 0xdb, 0x6d, 0xb6, 0xd9, 0x95, 0x89, 0xd1, 0xd5,
+	0xe0, 0x9b, 0x78, 0x27, 0x37, 0x67, 0x67, 0x39, 0xc2, 0x1c, 0x9d, 0x1d,
+	0x1d, 0x1c, 0x5c, 0x5c, 0x59, 0x73, 0x76, 0x61, 0xd2, 0x1d, 0xa7, 0x29,
+	0xca, 0x62, 0x59, 0x86, 0x9e, 0x09, 0xa7, 0x67, 0x81, 0x97, 0x57, 0x15,
+	0x75, 0x11, 0xc1, 0xa6, 0xb1, 0xc9, 0x9c, 0x71, 0x72, 0x5b, 0xd9, 0xc5,
+	0xbc, 0xa6, 0x16, 0x76, 0x55, 0xc6, 0x31, 0xce, 0xf2, 0x62, 0xf4, 0x9b,
+	0x74, 0x62, 0x74, 0x9c, 0x86, 0x25, 0x66, 0x62, 0x6c, 0x86, 0x16, 0x76,
+	0x59, 0x1c, 0xdc, 0x58, 0xba, 0x9d, 0x67, 0x1b, 0xa6, 0x67, 0x66, 0xe7,
+	0x07, 0x46, 0x18, 0x77, 0x9d, 0xa7, 0x69, 0x67, 0x57, 0x2c, 0x1c, 0x1c,
+	0x30, 0x65, 0xa6, 0xdd, 0xe6, 0x26, 0x5c, 0x71, 0xa7, 0x51, 0xd4, 0xc7,
+	0x57, 0x3c, 0x74, 0x6e, 0x6e, 0x59, 0xb6, 0x98, 0x56, 0x58, 0x9c, 0x56,
+	0x9a, 0x66, 0xe6, 0x56, 0x1a, 0x67, 0x3d, 0x92, 0x74, 0x9a, 0x9c, 0x66,
+	0x59, 0x70, 0x75, 0x71, 0x61, 0xd9, 0xb6, 0xe6, 0x5c, 0x5b, 0x9b, 0x12,
+	0x71, 0x71, 0x74, 0x9c, 0x27, 0x06, 0xa7, 0x69, 0xc2, 0x70, 0x1c, 0x31,
+	0xb6, 0x57, 0x3b, 0x74, 0x59, 0x84, 0xd4, 0x12, 0xf5, 0xbd, 0x6f, 0x5e,
+	0x1d, 0x59, 0xb8, 0x89, 0xda, 0xf5, 0x96, 0x56, 0xe7, 0x69, 0xda, 0x76,
+	0x65, 0x96, 0x9c, 0x59, 0x66, 0x71, 0xb9, 0x6a, 0xd7, 0x09, 0xc9, 0xb7,
+	0x09, 0xde, 0x78, 0x1a, 0x61, 0x59, 0x61, 0xdd, 0x69, 0xa6, 0x5d, 0xdd,
+	0xd8, 0x69, 0x9c, 0x6a, 0xf2, 0x9d, 0xe7, 0x71, 0x90, 0x21, 0xd2, 0x78,
+	0x18, 0xa6, 0x67, 0x61, 0x89, 0xa7, 0x55, 0x61, 0x66, 0x9a, 0x6a, 0x6e,
+	0x56, 0x9c, 0x11, 0x5b, 0xb7, 0x06, 0xd9, 0x6d, 0xb6, 0x95, 0x58, 0x91,
+	0x87, 0x55, 0x9a, 0x6d, 0x86, 0x11, 0x96, 0xd8, 0x9a, 0x5b, 0x25, 0x94,
+	0x6e, 0x77, 0x65, 0x6c, 0x95, 0x6c, 0x4b, 0x04, 0x6e, 0xc2, 0x98, 0x9c,
+	0xe6, 0xdd, 0x9e, 0x09, 0xb9, 0xc2, 0x78, 0x1c, 0x1d, 0x9b, 0x69, 0xc2,
+	0x73, 0x9c, 0x67, 0x81, 0xc2, 0x78, 0x1d, 0x1c, 0x67, 0x29, 0xcd, 0xa6,
+	0x15, 0x96, 0x1c, 0x56, 0x71, 0x69, 0x99, 0xe0, 0x9e, 0x06, 0x1a, 0x66,
+	0x49, 0xe0, 0x56, 0x5c, 0x9a, 0x72, 0x9d, 0x27, 0x41, 0xb0, 0x27, 0x82,
+	0x6a, 0x64, 0x61, 0xc9, 0xc9, 0xc9, 0x88, 0x9d, 0xe6, 0xc4, 0xbd, 0xe6,
+	0xdd, 0xe6, 0xdc, 0x24, 0xd7, 0x1b, 0x96, 0x26, 0xa6, 0x9e, 0x07, 0x78,
+	0x69, 0x18, 0x9c, 0xa5, 0x76, 0x75, 0x95, 0xa7, 0x04, 0x56, 0xe2, 0xd6,
+	0xd9, 0x6d, 0xb6, 0x95, 0x58, 0x73, 0x9b, 0x9b, 0x1a, 0x02, 0xd6, 0x67,
+	0x37, 0x16, 0x18, 0x46, 0x5c, 0x58, 0x9c, 0xd6, 0xd7, 0x27, 0x21, 0xbc,
+	0x74, 0x65, 0x73, 0x27, 0x19, 0x96, 0x1d, 0x5c, 0x9d, 0xdd, 0x64, 0x6a,
+	0xf3, 0x99, 0x9d, 0x26, 0x5b, 0x69, 0xca, 0x75, 0x5b, 0x9a, 0x57, 0x06,
+	0x8b, 0xe0, 0x71, 0xa6, 0x9d, 0xdd, 0xdd, 0x18, 0x73, 0xc6, 0x5a, 0x69,
+	0x9c, 0xf6, 0xb5, 0xd2, 0x49, 0xcd, 0x96, 0xa7, 0x69, 0xa5, 0x72, 0x72,
+	0x75, 0x9c, 0xe7, 0x31, 0xa0, 0x27, 0x57, 0x57, 0x46, 0xe7, 0x81, 0x82,
+	0x61, 0xbc, 0x61, 0xd1, 0xd2, 0x71, 0x56, 0x5e, 0x09, 0x1c, 0x64, 0x75,
+	0x65, 0xa7, 0x67, 0x18, 0x61, 0xd9, 0xdd, 0x67, 0x17, 0x27, 0x3b, 0xd5,
+	0x9b, 0x51, 0xdd, 0x95, 0xbc, 0x12, 0x73, 0x72, 0x68, 0x47, 0x1b, 0x8c,
+	0x4b, 0xc1, 0xc1, 0xe0, 0x78, 0x25, 0x9c, 0x67, 0x11, 0xa0, 0x26, 0x1e,
+	0x09, 0xd6, 0x99, 0x78, 0x27, 0x17, 0x45, 0x62, 0x71, 0x70, 0x87, 0x56,
+	0x5a, 0x65, 0x55, 0xc2, 0x46, 0x1a, 0x57, 0x46, 0xd8, 0x61, 0x19, 0x6d,
+	0x8b, 0x95, 0xb8, 0x78, 0x1e, 0x02, 0xf8, 0x1c, 0x31, 0xd1, 0xc6, 0x44,
+	0x87, 0x26, 0xad, 0x98, 0x62, 0xa7, 0x16, 0x98, 0x95, 0xc6, 0x61, 0x19,
+	0x72, 0x61, 0x86, 0x1c, 0x65, 0x59, 0xd1, 0x5a, 0x69, 0x99, 0x96, 0x5a,
+	0x76, 0x6d, 0xb9, 0xc8, 0x49, 0xa7, 0x19, 0xda, 0x71, 0x77, 0x69, 0xb6,
+	0x9e, 0x06, 0x27, 0x66, 0x99, 0x91, 0xe0, 0x9b, 0x9b, 0x19, 0x1a, 0x98,
+	0x71, 0x62, 0x59, 0x65, 0x96, 0x56, 0xde, 0x01, 0x25, 0x71, 0x78, 0x1e,
+	0x08, 0x6a, 0x70, 0x82, 0x34, 0x65, 0xe0, 0x9a, 0x9b, 0x76, 0x65, 0xd6,
+	0x62, 0x61, 0x86, 0x1c, 0x26, 0x21, 0x99, 0xb6, 0x0b, 0x1b, 0x91, 0xcd,
+	0x5c, 0x5a, 0x9b, 0x65, 0xd1, 0xd9, 0x85, 0x9d, 0x5c, 0x15, 0xd9, 0xd5,
+	0x8b, 0xe0, 0x9c, 0x5c, 0x71, 0x59, 0x86, 0xdd, 0x9d, 0x98, 0x62, 0x71,
+	0x69, 0xe0, 0x78, 0x16, 0x58, 0x74, 0x96, 0x70, 0x72, 0x6e, 0x47, 0x55,
+	0xb5, 0xa6, 0x9c, 0x1d, 0x5c, 0x9a, 0x9c, 0x27, 0x06, 0x1b, 0x9e, 0x07,
+	0x24, 0x73, 0x71, 0x87, 0x81, 0xa7, 0x47, 0x16, 0x58, 0x91, 0xc2, 0x62,
+	0x74, 0x72, 0x74, 0x73, 0x1c, 0x22, 0x6d, 0x97, 0x09, 0xc1, 0xa7, 0x57,
+	0x35, 0x65, 0xd9, 0xc4, 0x70, 0x73, 0x69, 0xc9, 0xc1, 0xdd, 0x85, 0x9d,
+	0x1c, 0x1c, 0x1c, 0xda, 0x61, 0xc1, 0x99, 0xd5, 0x97, 0x37, 0x71, 0x95,
+	0x74, 0x66, 0x70, 0x72, 0x57, 0x27, 0x27, 0x09, 0x89, 0x87, 0x67, 0x27,
+	0x2b, 0xcd, 0x1c, 0xdd, 0x26, 0xdd, 0x5d, 0x5d, 0x29, 0x67, 0x77, 0x63,
+	0x06, 0x1b, 0x99, 0x74, 0x75, 0x86, 0x9a, 0x9c, 0xdd, 0x16, 0x6a, 0x49,
+	0x1b, 0x70, 0x69, 0xc9, 0xce, 0x62, 0x1c, 0xd8, 0x49, 0x5c, 0x5b, 0x57,
+	0x67, 0x19, 0x52, 0x69, 0xa9, 0x87, 0x19, 0xc9, 0xa4, 0x66, 0x72, 0x73,
+	0x58, 0x74, 0x73, 0x89, 0xc1, 0xcb, 0x1d, 0x33, 0x8c, 0xf1, 0xce, 0x71,
+	0xcd, 0x8c, 0x77, 0x69, 0x1b, 0x9e, 0x07, 0x14, 0x77, 0x92, 0x69, 0xa7,
+	0x66, 0x96, 0x70, 0x61, 0xdd, 0xc1, 0x98, 0x9a, 0x9d, 0x59, 0x9c, 0xa6,
+	0x5c, 0xdc, 0x27, 0x26, 0x27, 0x47, 0x37, 0x44, 0x78, 0x27, 0x67, 0x09,
+	0x87, 0x78, 0x87, 0x09, 0x1d, 0x87, 0x56, 0xe7, 0x09, 0xe0, 0x73, 0x78,
+	0x1a, 0xb9, 0x71, 0x65, 0xc5, 0xc5, 0xd1, 0x96, 0x58, 0x96, 0x56, 0x5d,
+	0x5a, 0x99, 0x73, 0x65, 0xd2, 0x74, 0x74, 0x76, 0x70, 0x6d, 0x85, 0x98,
+	0x49, 0xdd, 0xda, 0x1c, 0x5c, 0xdd, 0x5d, 0x6d, 0x76, 0x72, 0x78, 0x1e,
+	0x07, 0x77, 0x39, 0xe0, 0x78, 0x21, 0xc1, 0xdd, 0xa7, 0x69, 0xc6, 0x1c,
+	0xd8, 0x78, 0x11, 0xc2, 0x70, 0x71, 0x78, 0x18, 0x9d, 0xe6, 0x1d, 0x18,
+	0x77, 0x71, 0x86, 0x26, 0x18, 0x70, 0x46, 0xda, 0x69, 0xd1, 0x98, 0x73,
+	0x95, 0xb6, 0x1b, 0x78, 0x25, 0x66, 0x19, 0xc7, 0x37, 0x16, 0x9a, 0x72,
+	0x69, 0xe0, 0x46, 0xdb, 0x6d, 0xb6, 0xda, 0x72, 0x66, 0x6a, 0x70, 0x75,
+	0x6d, 0xb9, 0xd6, 0x72, 0x9e, 0x09, 0xe0, 0x9e, 0x06, 0x27, 0x81, 0xa4,
+	0x9d, 0x1c, 0x24, 0x9a, 0x9c, 0x18, 0x92, 0x65, 0xda, 0x74, 0x92, 0x73,
+	0x99, 0x6d, 0xc1, 0xcd, 0xcb, 0x05, 0x74, 0x9c, 0xdd, 0x1a, 0x6d, 0xe0,
+	0x89, 0x89, 0x89, 0x86, 0x26, 0x1a, 0x46, 0xe6, 0xde, 0x05, 0x76, 0x49,
+	0xd5, 0xd6, 0x18, 0x49, 0x16, 0x99, 0x57, 0x19, 0x25, 0x65, 0x5c, 0x16,
+	0x46, 0xe7, 0x66, 0x1a, 0x49, 0xd9, 0xd6, 0x72, 0x6e, 0x73, 0x9d, 0x1a,
+	0x57, 0x78, 0x71, 0x46, 0xdc, 0x5b, 0x75, 0x77, 0x9d, 0xd2, 0x71, 0x46,
+	0x9d, 0x67, 0x36, 0x1d, 0xdc, 0x1d, 0x1a, 0x19, 0x78, 0x18, 0x69, 0xc5,
+	0x67, 0x57, 0x59, 0xdd, 0x85, 0x65, 0xd1, 0xb6, 0x1e, 0x07, 0x65, 0x69,
+	0x89, 0x1e, 0x08, 0x72, 0x6d, 0x96, 0x18, 0x62, 0x45, 0x6d, 0x5e, 0x06,
+	0x19, 0x78, 0x1d, 0x15, 0x96, 0x19, 0x71, 0xa9, 0x4c, 0x47, 0x17, 0x17,
+	0x05, 0x98, 0x71, 0x76, 0x47, 0x66, 0x1a, 0x6a, 0x61, 0xc2, 0x47, 0x16,
+	0xdb, 0x87, 0x77, 0x37, 0x07, 0x09, 0xb9, 0x21, 0xc9, 0xa6, 0xa6, 0x87,
+	0x37, 0x67, 0x66, 0x9a, 0x61, 0xc5, 0xc2, 0x78, 0x1d, 0x1d, 0xdc, 0x1c,
+	0x9c, 0x1e, 0x07, 0x06, 0x9d, 0x5e, 0x06, 0x1b, 0x73, 0x70, 0x71, 0x65,
+	0x85, 0x57, 0x37, 0x36, 0x27, 0x3c, 0x67, 0x3c, 0xaf, 0x22, 0x76, 0x65,
+	0x26, 0xd6, 0x77, 0xb2, 0xcb, 0x18, 0x6d, 0xa4, 0x73, 0x89, 0x95, 0xce,
+	0x5e, 0x08, 0x27, 0x66, 0xb1, 0x9c, 0xe4, 0x9c, 0x5c, 0xa7, 0x07, 0x19,
+	0xcf, 0x1d, 0x31, 0xce, 0xc9, 0xe0, 0xa9, 0xd5, 0xb7, 0x67, 0x76, 0x1e,
+	0x07, 0x07, 0x46, 0x2f, 0x07, 0x81, 0xd3, 0x3b, 0x41, 0x57, 0x1a, 0x57,
+	0x5c, 0x2f, 0x67, 0x19, 0x87, 0x49, 0x5d, 0x9d, 0x5c, 0x73, 0xab, 0xce,
+	0x71, 0xb6, 0xdb, 0x46, 0x26, 0x2e, 0xee, 0xae, 0x67, 0x3b, 0xa6, 0xdd,
+	0xde, 0x09, 0x6e, 0xe7, 0x56, 0x19, 0x69, 0xab, 0xc9, 0x59, 0x74, 0xbd,
+	0x29, 0xd9, 0xc9, 0xb7, 0x2b, 0xd1, 0xcd, 0x86, 0xdb, 0xa6, 0xe7, 0x27,
+	0x69, 0x18, 0x6d, 0xc5, 0xc1, 0xc2, 0x69, 0xc9, 0x96, 0x61, 0x88, 0x65,
+	0xd1, 0x89, 0xc1, 0xc9, 0xcd, 0xc1, 0xa8, 0x69, 0xb6, 0x1d, 0x9c, 0xdd,
+	0x59, 0xc4, 0x9c, 0x30, 0xc7, 0x81, 0x9b, 0xc7, 0x18, 0xd7, 0x46, 0x6f,
+	0x5b, 0xd1, 0xca, 0x75, 0x87, 0x6b, 0xe0, 0x74, 0x61, 0x89, 0xa9, 0x99,
+	0xd6, 0x6a, 0x65, 0xc2, 0x70, 0x6d, 0x86, 0x12, 0x69, 0xc6, 0x69, 0x96,
+	0x9b, 0x57, 0x47, 0x47, 0x44, 0x61, 0xb6, 0x1b, 0x72, 0x73, 0x70, 0x6e,
+	0x70, 0x73, 0x57, 0x24, 0x9d, 0x9d, 0x5d, 0x47, 0x17, 0x26, 0x9e, 0x0b,
+	0xda, 0xf8, 0x33, 0x89, 0xb6, 0xa7, 0x19, 0xce, 0x70, 0xd6, 0x33, 0xda,
+	0x73, 0xcf, 0x09, 0xe0, 0x71, 0xc6, 0x27, 0x82, 0xe9, 0xbc, 0x65, 0xca,
+	0x1d, 0x2a, 0x5b, 0xce, 0xc6, 0x6f, 0x4a, 0x9c, 0x67, 0x69, 0xe0, 0x9e,
+	0x05, 0xbc, 0x26, 0x27, 0x0b, 0xca, 0x60, 0x62, 0xf1, 0x70, 0x73, 0xba,
+	0x66, 0xe1, 0x18, 0x61, 0x9a, 0x75, 0x69, 0x87, 0x5b, 0xa7, 0x06, 0xee,
+	0x2f, 0x16, 0x1b, 0xbb, 0x70, 0x71, 0xbb, 0x75, 0x73, 0x95, 0xd5, 0xa7,
+	0x07, 0x05, 0x99, 0x99, 0x75, 0xbc, 0x5d, 0xdc, 0xdd, 0xaf, 0x27, 0x5c,
+	0xee, 0xf1, 0x95, 0xd7, 0x1d, 0xea, 0x41, 0xca, 0x65, 0x25, 0x95, 0xc1,
+	0x5c, 0x67, 0x47, 0x77, 0x82, 0x69, 0xc9, 0xa9, 0xa9, 0x86, 0x1d, 0x1c,
+	0x9d, 0x1d, 0x27, 0x06, 0x1c, 0xe6, 0x5d, 0xda, 0x73, 0x61, 0xd9, 0xb6,
+	0x5c, 0x15, 0xd7, 0x1c, 0xae, 0x9a, 0x6d, 0xcd, 0xe0, 0x77, 0x70, 0x74,
+	0x78, 0x18, 0x78, 0x1d, 0x1e, 0x07, 0x37, 0x19, 0xa6, 0x99, 0x9d, 0x9a,
+	0x65, 0xd7, 0x19, 0x57, 0x37, 0x07, 0x49, 0x0c, 0x71, 0x71, 0x65, 0xcd,
+	0xd9, 0xc5, 0xdd, 0x1d, 0x18, 0x69, 0xa7, 0x57, 0x0b, 0xd9, 0xe0, 0x72,
+	0x9a, 0xc1, 0xde, 0x65, 0xcd, 0xcd, 0xcd, 0xcd, 0xa4, 0x87, 0x37, 0x19,
+	0x1d, 0x1e, 0x07, 0x80, 0x74, 0x6d, 0xd1, 0xca, 0xea, 0x73, 0xbc, 0xa7,
+	0x81, 0x86, 0x65, 0x70, 0x74, 0x61, 0xe0, 0x4b, 0xd6, 0xdc, 0xf1, 0xc2,
+	0xed, 0xd3, 0x5c, 0x9c, 0x26, 0x5c, 0xa6, 0xae, 0xe6, 0x26, 0x26, 0xaf,
+	0x37, 0x81, 0x31, 0xe0, 0xbc, 0xdd, 0x2f, 0x67, 0x27, 0x06, 0x1c, 0x9c,
+	0xa7, 0x29, 0xde, 0x6a, 0xd7, 0x76, 0x1b, 0x9c, 0x1c, 0x1c, 0x6c, 0x60,
+	0x9e, 0x07, 0x3a, 0x65, 0xc1, 0x97, 0x57, 0x0b, 0xd7, 0x36, 0xb1, 0xe0,
+	0x66, 0x6e, 0x74, 0x9d, 0x2f, 0x83, 0x16, 0x70, 0xc5, 0xbc, 0x9c, 0x6e,
+	0xb1, 0x6e, 0x5b, 0xbd, 0x9c, 0xaf, 0x07, 0x47, 0x27, 0x2c, 0x71, 0x48,
+	0x85, 0xcf, 0x26, 0x18, 0x6d, 0x9b, 0xc3, 0x1a, 0x75, 0x66, 0xea, 0x6d,
+	0xbb, 0xb9, 0xe0, 0xc1, 0x8b, 0x59, 0x65, 0x8b, 0xe0, 0x9d, 0x56, 0xe6,
+	0xd6, 0x1c, 0x59, 0xa7, 0x06, 0xae, 0x5b, 0x72, 0x70, 0x70, 0xb9, 0xbd,
+	0x6e, 0xac, 0x9d, 0xe6, 0x1b, 0x6e, 0xed, 0x67, 0x59, 0xcb, 0x1b, 0x9c,
+	0x6f, 0x26, 0x9c, 0xa1, 0x6e, 0xdc, 0x27, 0x59, 0x86, 0x5a, 0xbc, 0xa6,
+	0x58, 0x77, 0x9c, 0x1a, 0xbd, 0xd5, 0x59, 0x9c, 0x98, 0x9a, 0x1c, 0x25,
+	0x6a, 0x70, 0x70, 0x5b, 0xa8, 0xba, 0x9b, 0xba, 0xba, 0x9c, 0x6c, 0x71,
+	0x78, 0x30, 0x74, 0x77, 0x99, 0x6a, 0x26, 0x24, 0x62, 0x74, 0x73, 0x75,
+	0xbc, 0x5e, 0x0b, 0xc5, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x76, 0xb1, 0x2d,
+	0x6a, 0x72, 0xa5, 0x57, 0x06, 0xe5, 0x96, 0xf5, 0x11, 0xc9, 0xca, 0xe3,
+	0x11, 0xc2, 0xf3, 0x46, 0xe6, 0xd6, 0xf8, 0x18, 0x61, 0xd1, 0x99, 0x24,
+	0x78, 0x19, 0x92, 0xe1, 0xb9, 0x99, 0x5e, 0x06, 0x99, 0x75, 0x70, 0x9d,
+	0xe1, 0xa6, 0xa9, 0x97, 0x77, 0x57, 0x26, 0x26, 0x1b, 0x73, 0x61, 0xab,
+	0xc1, 0xd5, 0xd5, 0xd1, 0xc1, 0x96, 0xdd, 0x58, 0x86, 0xd6, 0x6d, 0x59,
+	0x6e, 0x5b, 0xc1, 0x94, 0x6f, 0x16, 0x70, 0x75, 0x87, 0x15, 0x6a, 0x59,
+	0x1d, 0xda, 0x73, 0x78, 0x1b, 0x65, 0x1c, 0x19, 0x63, 0x19, 0x9b, 0x6a,
+	0x4b, 0x99, 0xa8, 0x71, 0x95, 0xb9, 0x55, 0x66, 0x5d, 0x5a, 0x61, 0x19,
+	0x77, 0x6d, 0xc1, 0x97, 0x1b, 0xdd, 0xc1, 0x96, 0x5b, 0x6d, 0x89, 0x5c,
+	0x67, 0x37, 0x06, 0x24, 0x54, 0x59, 0xc2, 0x66, 0x65, 0xd3, 0x12, 0x73,
+	0x9c, 0xa7, 0x39, 0x5c, 0x9c, 0xdd, 0x2d, 0xbc, 0x6f, 0x0b, 0x86, 0x19,
+	0x6d, 0xb5, 0xc4, 0x96, 0x66, 0x77, 0x56, 0x67, 0x76, 0xd6, 0xf6, 0xbb,
+	0xc6, 0xf3, 0xe0, 0xcf, 0x4b, 0xde, 0x4b, 0xdd, 0xc2, 0x6e, 0x6c, 0xcf,
+	0x81, 0xd2, 0x61, 0xc3, 0x13, 0x11, 0xcb, 0x12, 0xf7, 0xbd, 0xe7, 0x57,
+	0x41, 0x27, 0x59, 0xdd, 0xd6, 0xe6, 0x73, 0xb9, 0x65, 0x99, 0xda, 0x72,
+	0x5b, 0x6d, 0x9d, 0x5c, 0x9c, 0x1c, 0x5b, 0xbc, 0x67, 0x76, 0x19, 0xbc,
+	0x1a, 0xbc, 0x5d, 0xd9, 0x63, 0x1c, 0x1c, 0x1d, 0x1d, 0xdd, 0x1b, 0x65,
+	0xdd, 0x6f, 0x27, 0x1b, 0x87, 0x37, 0x17, 0x15, 0x65, 0x87, 0x05, 0x70,
+	0xbe, 0x01, 0x1b, 0x75, 0x6e, 0xf6, 0x65, 0xd6, 0xf6, 0x71, 0x6d, 0xcd,
+	0xa6, 0x26, 0x25, 0xbd, 0x9c, 0x5c, 0xdd, 0x27, 0x09, 0x99, 0xbb, 0xd6,
+	0x70, 0x6e, 0x6a, 0x69, 0xd9, 0xc1, 0xc1, 0x66, 0xa1, 0xc6, 0x46, 0x51,
+	0x86, 0x9e, 0x06, 0x5b, 0x73, 0x77, 0x70, 0xb5, 0xdc, 0xc6, 0xef, 0x2b,
+	0xcb, 0x18, 0x31, 0x9c, 0x9d, 0x5e, 0x07, 0x32, 0x70, 0x9d, 0x5a, 0xc7,
+	0x62, 0x73, 0x9c, 0x1e, 0x09, 0x65, 0xbd, 0xd1, 0xc9, 0xb9, 0xc1, 0x89,
+	0xc1, 0xc2, 0x70, 0xac, 0x57, 0x57, 0x47, 0x07, 0x44, 0x62, 0x69, 0xd2,
+	0x74, 0x76, 0x59, 0xcb, 0x57, 0x13, 0x25, 0xd6, 0x33, 0x17, 0x59, 0xcf,
+	0x39, 0xdd, 0xde, 0xed, 0xa7, 0x27, 0x25, 0x72, 0x72, 0x57, 0x27, 0x29,
+	0xe0, 0x9d, 0x66, 0xe6, 0xde, 0x04, 0x70, 0x74, 0x74, 0x57, 0x47, 0x45,
+	0x74, 0x74, 0x74, 0xce, 0x2f, 0x09, 0x89, 0xce, 0x75, 0x9d, 0xe7, 0x29,
+	0x9b, 0x8b, 0x8b, 0xde, 0x74, 0x98, 0xb9, 0xb6, 0xe6, 0xe6, 0x74, 0x27,
+	0x81, 0xd9, 0xaa, 0x27, 0x58, 0xb8, 0xb6, 0x49, 0x51, 0xc9, 0xbb, 0x96,
+	0x26, 0x5c, 0x2a, 0xae, 0x5d, 0x5d, 0x1c, 0x1d, 0x11, 0x89, 0xab, 0xa7,
+	0x7c, 0xcb, 0xb7, 0x81, 0x87, 0x39, 0x89, 0x9c, 0x70, 0x69, 0xab, 0xca,
+	0x26, 0x1d, 0xd9, 0x72, 0x9d, 0x67, 0x5b, 0xe0, 0xc7, 0x6b, 0xde, 0x75,
+	0xca, 0x73, 0x9c, 0x1e, 0x09, 0xde, 0x76, 0x6e, 0x62, 0x64, 0x9d, 0xa7,
+	0x76, 0xa7, 0x42, 0x75, 0x09, 0xde, 0x62, 0x66, 0x75, 0x62, 0x71, 0x9d,
+	0xda, 0x70, 0x72, 0x66, 0xf8, 0x1d, 0x5c, 0xe5, 0x71, 0x91, 0xc6, 0xd6,
+	0x66, 0x19, 0x66, 0x72, 0x9c, 0xb1, 0xb9, 0xb9, 0x89, 0xb9, 0xb7, 0x72,
+	0x6e, 0x56, 0x9c, 0xc7, 0x49, 0xb9, 0xa9, 0x67, 0x48, 0x47, 0x26, 0xe7,
+	0x56, 0x25, 0x70, 0x9b, 0x9a, 0x9c, 0x1d, 0x5d, 0x1c, 0x1d, 0x11, 0x89,
+	0x89, 0xdf, 0x1d, 0x9d, 0xdc, 0x9c, 0xdc, 0xd5, 0xd6, 0x71, 0x1c, 0xe1,
+	0xa7, 0x2a, 0x6d, 0x96, 0x67, 0x46, 0x16, 0x5c, 0x76, 0x9d, 0x27, 0x48,
+	0xbc, 0xc9, 0xd6, 0x71, 0x9d, 0x67, 0x59, 0xd4, 0x9a, 0x9d, 0x5a, 0x9c,
+	0x47, 0x69, 0x27, 0x49, 0xd2, 0x6e, 0x74, 0x47, 0x26, 0xe7, 0x56, 0x26,
+	0x9c, 0x27, 0x49, 0xd2, 0x70, 0x75, 0x74, 0x70, 0x74, 0x46, 0x26, 0x66,
+	0x49, 0xb9, 0xbc, 0x70, 0xc7, 0x83, 0x1a, 0xc6, 0xe7, 0x39, 0xb9, 0xce,
+	0x73, 0x9c, 0xc9, 0xc6, 0x73, 0x69, 0xe0, 0x27, 0x29, 0xce, 0x71, 0x9a,
+	0x99, 0x9a, 0x47, 0x26, 0xe7, 0x36, 0x27, 0x37, 0x09, 0xce, 0x73, 0x9c,
+	0xdd, 0x5d, 0x1c, 0x1d, 0x11, 0x89, 0xb9, 0xb9, 0xb9, 0xb9, 0xde, 0xb1,
+	0x87, 0x81, 0xd9, 0xcd, 0x71, 0xbb, 0x26, 0x2a, 0x77, 0x9d, 0xef, 0x1b,
+	0x89, 0xca, 0xa7, 0x5a, 0xaa, 0x1a, 0xa6, 0xa7, 0x21, 0xda, 0xa7, 0x82,
+	0x76, 0x99, 0x9d, 0x91, 0xc9, 0xba, 0x62, 0x6d, 0xc2, 0xa7, 0x1a, 0x75,
+	0x74, 0x70, 0x74, 0x46, 0x2d, 0x99, 0x76, 0x9d, 0xa7, 0x6b, 0xb9, 0x1c,
+	0x73, 0x67, 0x59, 0xd6, 0x75, 0x99, 0x6a, 0x75, 0x9c, 0x96, 0x65, 0xca,
+	0x6e, 0x6a, 0xf7, 0x9d, 0x5c, 0x5b, 0x96, 0x56, 0xe7, 0x29, 0xd0, 0x74,
+	0x6d, 0xd2, 0x76, 0x9d, 0x5d, 0x27, 0x67, 0x80, 0x74, 0x72, 0x6a, 0x72,
+	0x1d, 0x1c, 0xa7, 0x69, 0xd5, 0xda, 0x75, 0x47, 0x26, 0xe6, 0x58, 0x99,
+	0x70, 0x89, 0x27, 0x67, 0x57, 0x47, 0x07, 0x44, 0x63, 0x1e, 0x05, 0x9a,
+	0x91, 0x5c, 0x9e, 0x07, 0x57, 0x49, 0xb9, 0xd9, 0xc5, 0xb7, 0x82, 0x1b,
+	0x9c, 0xa7, 0x29, 0xdf, 0x1d, 0x1e, 0x0b, 0xe0, 0x62, 0x74, 0x9c, 0x67,
+	0x49, 0xd2, 0x64, 0x9c, 0xe7, 0x46, 0xa7, 0x01, 0xe0, 0x9b, 0x9d, 0x27,
+	0x39, 0xca, 0x73, 0x47, 0x26, 0xe6, 0x98, 0x9c, 0xdc, 0x27, 0x09, 0xc2,
+	0x74, 0x75, 0x74, 0x70, 0x74, 0x46, 0x26, 0x1c, 0x1c, 0xdd, 0x27, 0x29,
+	0xca, 0x72, 0xbb, 0xbc, 0x31, 0xce, 0x72, 0x9a, 0x9c, 0xa7, 0x29, 0xc8,
+	0x9c, 0x27, 0x26, 0xa4, 0x1d, 0xe7, 0x29, 0xc6, 0x6e, 0x6a, 0x6d, 0x1c,
+	0x9b, 0x99, 0x62, 0x72, 0x70, 0x9b, 0x9c, 0xa7, 0x27, 0x57, 0x47, 0x07,
+	0x44, 0x62, 0x69, 0xd4, 0xb9, 0x66, 0x72, 0x75, 0x95, 0x87, 0x58, 0x9d,
+	0xdc, 0x5d, 0xd9, 0x77, 0x57, 0x1a, 0x1c, 0x5c, 0x5a, 0x71, 0x61, 0x87,
+	0x29, 0x5c, 0x6f, 0x47, 0x27, 0x56, 0x67, 0x59, 0xd5, 0xa7, 0x7b, 0xd1,
+	0xc9, 0xc2, 0x74, 0x9c, 0x67, 0x49, 0xd1, 0xa1, 0xc1, 0x99, 0xb2, 0x71,
+	0x09, 0xc9, 0xc9, 0xa9, 0xc1, 0xd2, 0x74, 0x61, 0x86, 0x18, 0x69, 0xa9,
+	0xc6, 0x71, 0x72, 0x99, 0x98, 0x91, 0x15, 0x26, 0x9c, 0x15, 0xa5, 0x72,
+	0x78, 0x27, 0x49, 0xc1, 0xd1, 0xb7, 0x37, 0x81, 0xdd, 0xc1, 0xc9, 0xa9,
+	0xb9, 0xb7, 0x09, 0xc9, 0xd9, 0xc1, 0xc2, 0x70, 0x9a, 0x9c, 0x27, 0x06,
+	0x87, 0x66, 0x5d, 0x49, 0xc0, 0x26, 0xdc, 0x9a, 0x9c, 0x22, 0x65, 0x86,
+	0x18, 0x61, 0xa6, 0xa5, 0x9c, 0x1c, 0xa7, 0x08, 0x95, 0x15, 0x27, 0x07,
+	0x05, 0x69, 0x5c, 0x9e, 0x09, 0xc2, 0x70, 0x74, 0x6d, 0xce, 0x69, 0xc9,
+	0xc1, 0xc9, 0xa9, 0xc2, 0x70, 0xbd, 0xac, 0xb3, 0x32, 0xf0, 0xbe, 0x09,
+	0xda, 0x74, 0x9d, 0xa7, 0x67, 0x72, 0x75, 0x9b, 0x69, 0xe0, 0x24, 0x9c,
+	0x27, 0x39, 0x87, 0x02, 0x72, 0x6a, 0x6d, 0x15, 0x1b, 0x69, 0x5b, 0x59,
+	0xc2, 0x73, 0x72, 0x9d, 0x91, 0x94, 0x6d, 0xc4, 0x6d, 0x18, 0x9d, 0xdd,
+	0x86, 0x99, 0x77, 0x9c, 0xa7, 0x29, 0xc2, 0xeb, 0x3d, 0xe6, 0xe6, 0x66,
+	0xe6, 0xdc, 0x89, 0xb6, 0x5e, 0x02, 0x50, 0x99, 0x98, 0x6a, 0xaa, 0x61,
+	0x86, 0x18, 0x61, 0xa6, 0xa6, 0xa6, 0xdc, 0xa6, 0x66, 0xa7, 0x14, 0x54,
+	0x9c, 0x5c, 0x15, 0xa5, 0x72, 0x78, 0x2a, 0x9d, 0x1b, 0x9c, 0x27, 0x09,
+	0xc1, 0x89, 0xca, 0x72, 0x89, 0xcd, 0xc9, 0xe0, 0x95, 0xe0, 0x9c, 0xe7,
+	0x19, 0xcd, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xc5, 0xcd, 0xce, 0x59, 0xce,
+	0x69, 0xc5, 0xc6, 0xe1, 0xc9, 0xc9, 0xdd, 0xdd, 0xdd, 0xcd, 0xcd, 0xcd,
+	0xcd, 0xcd, 0xcd, 0xcd, 0xcd, 0xd5, 0xd5, 0xc9, 0xc9, 0xc9, 0xc9, 0xc9,
+	0xc9, 0xc9, 0xa7, 0x57, 0x57, 0x57, 0x26, 0x5c, 0x9c, 0x9c, 0x9c, 0x9c,
+	0x9a, 0x74, 0x74, 0xba, 0x97, 0x1a, 0xbb, 0xca, 0x22, 0x1c, 0xe7, 0x22,
+	0x77, 0x95, 0xa9, 0xb2, 0x74, 0x96, 0x49, 0xe0, 0x99, 0x99, 0x47, 0x26,
+	0xe7, 0x56, 0x27, 0x17, 0x09, 0xd6, 0x71, 0xba, 0x75, 0x74, 0x70, 0x74,
+	0x46, 0x27, 0x09, 0xc2, 0x70, 0x9c, 0x27, 0x09, 0xca, 0x72, 0x9a, 0x9c,
+	0x1d, 0xdd, 0x26, 0x9d, 0xa4, 0x6a, 0x68, 0x9c, 0xa7, 0x09, 0xc9, 0xcd,
+	0xa7, 0x37, 0x37, 0x37, 0x37, 0x36, 0x9c, 0xc7, 0x57, 0x5a, 0xc6, 0xdd,
+	0x07, 0x09, 0xd5, 0xc0, 0x78, 0x1e, 0x07, 0x81, 0xc5, 0xc5, 0xc4, 0x71,
+	0x71, 0x71, 0x1c, 0xdc, 0xd6, 0x71, 0x1c, 0x5b, 0x6d, 0xd1, 0xd1, 0xd1,
+	0xc1, 0xc0, 0x70, 0x70, 0x70, 0x72, 0x72, 0x9d, 0xa7, 0x54, 0x75, 0x59,
+	0xd9, 0xd9, 0xd9, 0xd8, 0x78, 0x19, 0x1d, 0xd9, 0x9c, 0x89, 0xcc, 0x1d,
+	0xdd, 0xda, 0x78, 0x2c, 0x76, 0x61, 0x86, 0x18, 0x69, 0xa9, 0x1e, 0x07,
+	0x29, 0xb8, 0xb1, 0x15, 0x26, 0xdc, 0x15, 0xa5, 0x72, 0x78, 0x1b, 0x9c,
+	0x1c, 0x27, 0x67, 0x07, 0x37, 0x24, 0x71, 0x57, 0x16, 0x66, 0xe6, 0xdb,
+	0x69, 0x07, 0x6b, 0xe0, 0x62, 0x70, 0x9a, 0x9c, 0x27, 0x07, 0x42, 0x6d,
+	0x97, 0x52, 0x70, 0x09, 0xa9, 0x96, 0xa7, 0x09, 0xc2, 0x56, 0x18, 0x61,
+	0x86, 0x9a, 0x78, 0x21, 0xca, 0x6e, 0x27, 0x04, 0x54, 0x9b, 0x70, 0x56,
+	0x95, 0xc9, 0xe0, 0x6e, 0x70, 0x70, 0x9c, 0x1c, 0x1c, 0xdc, 0x90, 0x74,
+	0x9a, 0x61, 0x99, 0xc2, 0x70, 0x6d, 0x94, 0x76, 0x49, 0x67, 0x09, 0xa9,
+	0xc2, 0x70, 0x90, 0x69, 0x97, 0x42, 0x70, 0x09, 0xa7, 0x36, 0xa7, 0x09,
+	0xc2, 0x6d, 0x86, 0x18, 0x61, 0xa6, 0xa5, 0x77, 0x72, 0x9b, 0x89, 0xc1,
+	0x15, 0x26, 0xdc, 0x15, 0xa5, 0x72, 0x78, 0x1b, 0x9c, 0x1c, 0x27, 0x07,
+	0x07, 0x37, 0x24, 0x72, 0x47, 0x81, 0x99, 0xb9, 0xb6, 0x5b, 0x46, 0xe6,
+	0x5d, 0x26, 0xe6, 0xa6, 0xd9, 0x78, 0x07, 0x56, 0x5d, 0x49, 0xb0, 0x99,
+	0x73, 0x6a, 0x6e, 0x6e, 0x65, 0x86, 0x18, 0x61, 0xa6, 0xa6, 0xde, 0x07,
+	0x27, 0x82, 0x26, 0xd1, 0x52, 0x69, 0xc1, 0x5a, 0x57, 0x27, 0x81, 0xb9,
+	0xb7, 0x09, 0xb7, 0x07, 0x37, 0x24, 0x72, 0x95, 0xc5, 0xa9, 0xb9, 0xb9,
+	0x59, 0x71, 0x9e, 0x0a, 0x9c, 0x67, 0x09, 0xc5, 0xd2, 0x41, 0xca, 0x56,
+	0x9d, 0x86, 0x26, 0xef, 0x81, 0xa9, 0xc2, 0x70, 0x69, 0xde, 0x6a, 0x6a,
+	0x46, 0x9c, 0x9b, 0x70, 0x61, 0x96, 0x9c, 0xd8, 0x70, 0x9c, 0x67, 0x05,
+	0x73, 0x72, 0x73, 0x75, 0x75, 0x72, 0xc5, 0xd1, 0x03, 0x38, 0x4d, 0x44,
+	0x19, 0x9d, 0x5c, 0x5d, 0x27, 0x49, 0x97, 0x78, 0x65, 0xd5, 0xc5, 0xde,
+	0x58, 0x9c, 0xa7, 0x29, 0xa9, 0xc1, 0xd6, 0x75, 0x9b, 0x9d, 0x67, 0x57,
+	0x66, 0x9d, 0x1a, 0x74, 0x77, 0x9d, 0x67, 0x49, 0xd5, 0xd5, 0xc4, 0x86,
+	0x64, 0x27, 0x60, 0x89, 0xa6, 0x9d, 0x66, 0xde, 0x06, 0x18, 0x61, 0x86,
+	0x9a, 0x9a, 0x98, 0x72, 0x92, 0x49, 0xc1, 0x15, 0x25, 0x70, 0x56, 0x95,
+	0xc9, 0xe0, 0x6e, 0x70, 0x70, 0x9d, 0x9c, 0x1b, 0x6d, 0xb7, 0x77, 0x27,
+	0x06, 0xe6, 0xe6, 0xe7, 0x17, 0x21, 0xb7, 0x17, 0x29, 0xc2, 0x6a, 0x70,
+	0x9c, 0x19, 0x26, 0xd9, 0x75, 0x27, 0x00, 0x9b, 0x98, 0x6a, 0x49, 0xc1,
+	0xdd, 0x86, 0x18, 0x61, 0xa6, 0xa7, 0x09, 0xc1, 0xc9, 0xe0, 0x89, 0xc1,
+	0x15, 0x26, 0x9c, 0x15, 0xa5, 0x98, 0x73, 0x19, 0x6e, 0x1b, 0x69, 0xa1,
+	0xa6, 0x9a, 0x6a, 0x6a, 0x69, 0x96, 0x87, 0x26, 0xd8, 0x71, 0x61, 0x89,
+	0xa9, 0x89, 0xa9, 0xa6, 0x49, 0x97, 0x66, 0x9d, 0x87, 0x47, 0x29, 0x66,
+	0xa7, 0x0a, 0x47, 0x26, 0xe7, 0x26, 0x1e, 0x07, 0x09, 0xb9, 0x27, 0x27,
+	0x57, 0x47, 0x07, 0x44, 0x63, 0x1c, 0x5d, 0x07, 0x68, 0x72, 0x75, 0x62,
+	0x6f, 0x12, 0xf8, 0x31, 0x96, 0x1e, 0x09, 0xd2, 0x62, 0x75, 0x74, 0x78,
+	0x1c, 0xe5, 0xc6, 0x27, 0x59, 0xd5, 0xb9, 0xce, 0x49, 0x65, 0x9c, 0x67,
+	0x49, 0xd1, 0x89, 0xd9, 0xa9, 0xda, 0x76, 0x6d, 0xc9, 0xcc, 0x95, 0xc9,
+	0xa9, 0xcc, 0x71, 0x92, 0x76, 0x9d, 0xa6, 0x67, 0x64, 0x72, 0x6e, 0x18,
+	0x87, 0x09, 0xc6, 0x59, 0xb7, 0x57, 0x47, 0x07, 0x44, 0x63, 0x1b, 0x91,
+	0xc1, 0xd5, 0xd1, 0xd6, 0x75, 0x91, 0x89, 0xa6, 0xa6, 0x27, 0x69, 0xc6,
+	0x71, 0xbd, 0x6f, 0x2c, 0x72, 0xbd, 0xe7, 0x59, 0xd2, 0x75, 0x95, 0xd0,
+	0x9d, 0x21, 0xa9, 0xa1, 0xe0, 0x9d, 0x67, 0x5a, 0x70, 0x27, 0x06, 0xa6,
+	0x51, 0x51, 0xb6, 0x95, 0xb5, 0x9d, 0xa9, 0xca, 0x76, 0x46, 0x52, 0x75,
+	0x6a, 0x70, 0x9c, 0x1d, 0xa7, 0x27, 0x69, 0x26, 0x31, 0xde, 0x6a, 0x61,
+	0x89, 0xa6, 0x87, 0x16, 0x5d, 0x87, 0x80, 0x24, 0x99, 0x75, 0xcf, 0x29,
+	0xb6, 0x64, 0x78, 0x29, 0xc9, 0xc5, 0xc5, 0xc5, 0xc5, 0x99, 0x97, 0x19,
+	0xa7, 0x67, 0x39, 0xb7, 0x02, 0x6d, 0xb9, 0xc3, 0x1d, 0x1d, 0x9d, 0x9d,
+	0x9d, 0x9d, 0x18, 0x74, 0x96, 0x6d, 0xa9, 0xc6, 0x71, 0x78, 0x22, 0xf4,
+	0x5a, 0x11, 0x27, 0x39, 0xc6, 0x73, 0x9c, 0xdd, 0x47, 0x82, 0x6d, 0xa7,
+	0x61, 0xca, 0x66, 0x72, 0x9c, 0xe7, 0x1b, 0x51, 0xc9, 0xb7, 0x76, 0x26,
+	0x9c, 0x27, 0x29, 0xb9, 0xd1, 0xd5, 0xd1, 0xc1, 0xd1, 0x18, 0x9d, 0x66,
+	0xa6, 0x9d, 0x9d, 0x84, 0x4b, 0x25, 0xb1, 0x26, 0x5a, 0x70, 0x9c, 0xa7,
+	0x25, 0xb9, 0x6e, 0xf0, 0x9d, 0x27, 0x29, 0xd2, 0x74, 0x74, 0x27, 0x37,
+	0x06, 0xa5, 0x26, 0x82, 0x72, 0x75, 0x75, 0x6d, 0xd6, 0x78, 0x12, 0x6e,
+	0x6a, 0x9c, 0x67, 0x49, 0xd2, 0x74, 0x76, 0x9c, 0x99, 0x77, 0x9d, 0x9d,
+	0x18, 0x9d, 0x9a, 0x72, 0x99, 0x99, 0x95, 0xc2, 0x71, 0x9c, 0x5e, 0x07,
+	0x37, 0x81, 0x26, 0x5c, 0x65, 0x77, 0x9c, 0xa6, 0xa7, 0x29, 0xc2, 0x72,
+	0x87, 0x12, 0x72, 0x6d, 0xa9, 0xb1, 0xc5, 0xca, 0x62, 0x6d, 0xd6, 0x76,
+	0x47, 0x26, 0xe6, 0xd8, 0x9c, 0x1c, 0x24, 0x96, 0x71, 0x75, 0x74, 0x70,
+	0x74, 0x46, 0x31, 0xc5, 0xc1, 0xc1, 0x26, 0x64, 0x6d, 0xe0, 0x77, 0x9c,
+	0x27, 0x0c, 0x31, 0x9c, 0x6a, 0xea, 0xdc, 0xee, 0x74, 0x9e, 0x09, 0xc2,
+	0x77, 0x9d, 0x9e, 0x07, 0x81, 0xe0, 0x9d, 0xe7, 0x67, 0x26, 0xe5, 0x27,
+	0x69, 0xdd, 0xa9, 0xc8, 0x9d, 0x5d, 0x1b, 0x70, 0x9c, 0x2a, 0x77, 0x78,
+	0x27, 0x39, 0x5c, 0xdc, 0x18, 0x9d, 0xe4, 0x9d, 0x75, 0x1b, 0x87, 0x57,
+	0x5b, 0x1c, 0x2e, 0xe7, 0x82, 0x78, 0x31, 0xd9, 0xdb, 0x18, 0x6e, 0xea,
+	0xf5, 0x65, 0x6f, 0x58, 0x62, 0x76, 0x9c, 0x27, 0x69, 0xd2, 0x76, 0x9c,
+	0x19, 0x27, 0x69, 0xa6, 0xa6, 0xc7, 0x77, 0x29, 0xd2, 0x72, 0x9d, 0x6e,
+	0xd1, 0xc9, 0xbb, 0xc1, 0x8a, 0x70, 0x89, 0x29, 0xd5, 0xd1, 0xc1, 0xd1,
+	0x18, 0x9c, 0x1c, 0x27, 0x07, 0x59, 0xb9, 0x59, 0x5b, 0xd1, 0xd5, 0x89,
+	0x1a, 0xbc, 0xd1, 0x98, 0x66, 0x65, 0xc1, 0xc1, 0xab, 0x27, 0x59, 0xd6,
+	0xe6, 0x78, 0x25, 0x74, 0x73, 0x77, 0xc7, 0x16, 0x1c, 0x84, 0x9d, 0xa7,
+	0x49, 0xda, 0x76, 0x94, 0x9d, 0x9c, 0xda, 0x9c, 0x49, 0xb9, 0xa9, 0xd6,
+	0x74, 0x89, 0xd1, 0x1c, 0x9b, 0x9d, 0x98, 0x78, 0x1c, 0x27, 0x19, 0xc6,
+	0x76, 0x75, 0x74, 0x70, 0x74, 0x46, 0x27, 0x09, 0xc1, 0x87, 0x38, 0x9d,
+	0x1c, 0x98, 0x9b, 0x11, 0x8b, 0x97, 0x67, 0x81, 0xc6, 0x57, 0x19, 0xd2,
+	0x74, 0xbb, 0xcd, 0xd6, 0x67, 0x59, 0xca, 0x75, 0x9d, 0x67, 0x52, 0x75,
+	0x99, 0x6a, 0x70, 0x27, 0x57, 0x82, 0x75, 0x9d, 0x25, 0x9d, 0x11, 0xc9,
+	0xb9, 0x96, 0x27, 0x17, 0x09, 0xb9, 0xd6, 0x70, 0x75, 0x74, 0x70, 0x74,
+	0x46, 0x26, 0x9d, 0x27, 0x37, 0x65, 0x9d, 0x33, 0x27, 0x6b, 0xe0, 0x5c,
+	0xe3, 0x38, 0x5c, 0x6f, 0x38, 0x9d, 0xdd, 0xee, 0xda, 0x72, 0x72, 0x57,
+	0x27, 0x25, 0x72, 0x72, 0x9e, 0x07, 0x57, 0x5b, 0x67, 0x7b, 0x6d, 0x98,
+	0x93, 0x1d, 0xee, 0x2a, 0xe1, 0xc6, 0xe0, 0x9c, 0x2e, 0x1a, 0x9c, 0xc7,
+	0x82, 0xe2, 0xc9, 0xde, 0x75, 0x9d, 0xd2, 0xf5, 0xb4, 0x61, 0xcd, 0xb6,
+	0x2d, 0xb5, 0xd1, 0xc9, 0xc9, 0xc5, 0x18, 0xc7, 0x82, 0xe6, 0x12, 0xef,
+	0x19, 0x74, 0xbb, 0x98, 0x76, 0x96, 0x07, 0x56, 0xe5, 0x76, 0x76, 0x66,
+	0x75, 0x77, 0x56, 0xdb, 0x77, 0x73, 0xc6, 0x9e, 0x07, 0x16, 0xdd, 0xdd,
+	0xdb, 0x77, 0x77, 0x1d, 0x1b, 0x74, 0xce, 0xe7, 0x59, 0xd6, 0x75, 0x9d,
+	0xcc, 0xf4, 0x72, 0x96, 0x4a, 0x76, 0x9d, 0xd9, 0x66, 0x19, 0xd5, 0xcf,
+	0x26, 0x98, 0xce, 0xd6, 0x72, 0x9b, 0x74, 0x1b, 0xcf, 0x4a, 0x9a, 0xbd,
+	0xdd, 0xb5, 0xca, 0x73, 0x9d, 0x67, 0x4b, 0x27, 0x59, 0xd6, 0xe3, 0x3d,
+	0xaf, 0x59, 0xc2, 0x6a, 0x71, 0x73, 0xc7, 0x19, 0xc2, 0x4d, 0x72, 0x78,
+	0x1a, 0x70, 0xc6, 0x6f, 0x07, 0x82, 0x65, 0xca, 0xf2, 0x8c, 0x35, 0x24,
+	0x91, 0xd1, 0xde, 0x9d, 0x26, 0x67, 0x81, 0xe0, 0x75, 0x56, 0x66, 0xd8,
+	0x77, 0x77, 0xce, 0xaf, 0x5c, 0xed, 0xd7, 0x1c, 0x67, 0x07, 0x67, 0x17,
+	0x6b, 0x1d, 0xb3, 0xc1, 0xe0, 0x76, 0x76, 0x75, 0x96, 0x57, 0x7b, 0x87,
+	0x79, 0x84, 0x9d, 0xdc, 0xaf, 0x49, 0xe0, 0x07, 0x07, 0x29, 0xd6, 0x74,
+	0x22, 0x66, 0x71, 0x72, 0x9c, 0xa7, 0x82, 0x55, 0x72, 0x93, 0x5c, 0xa7,
+	0x46, 0xb3, 0xdd, 0x71, 0xc5, 0x57, 0x1b, 0xb9, 0x9b, 0x78, 0x1e, 0x09,
+	0xca, 0x75, 0x70, 0x56, 0x64, 0x62, 0x76, 0x95, 0xda, 0x78, 0x1d, 0xde,
+	0x06, 0xa6, 0xae, 0xdd, 0xdd, 0x66, 0xa2, 0xe1, 0xe0, 0x9c, 0x1c, 0x9e,
+	0x07, 0x81, 0xc1, 0xe0, 0x9c, 0x0c, 0x71, 0x9c, 0x99, 0x77, 0x9d, 0xa7,
+	0x67, 0x47, 0x81, 0x66, 0xe7, 0x76, 0xa5, 0x26, 0x27, 0x5b, 0x1c, 0x61,
+	0xd5, 0xc5, 0xc5, 0xc4, 0x71, 0x71, 0x71, 0x71, 0x76, 0x9b, 0x98, 0x6d,
+	0xe0, 0x71, 0x6e, 0x75, 0x75, 0x6e, 0x65, 0x86, 0x18, 0x92, 0x70, 0x71,
+	0x77, 0x95, 0x97, 0x25, 0x91, 0xc6, 0x6a, 0x49, 0xd9, 0x89, 0x5c, 0x9e,
+	0x09, 0xc1, 0xd1, 0xa7, 0x56, 0x64, 0x99, 0xc6, 0x66, 0xa6, 0x98, 0x73,
+	0x72, 0x91, 0xce, 0x54, 0x69, 0xa7, 0x34, 0x96, 0x56, 0xaa, 0x72, 0xc7,
+	0x19, 0xa4, 0x27, 0x57, 0x81, 0xb7, 0x81, 0x2f, 0x7b, 0xda, 0x6e, 0x72,
+	0xbd, 0x22, 0x62, 0xf5, 0xbe, 0x0f, 0x10,
+};
+
+static unsigned char asset_cache[40660];
+
+shrink_asset_t asset = {
+	.codec = CODEC_MTF_ELIAS,
+	.data = asset_data,
+	.length = 35647,
+	.cache = asset_cache,
+	.size = 40660,
+};
@@ -0,0 +1,3343 @@
+/* generated by 'shrink -E', do not edit */
+#include "shrink.h"
+
+static const unsigned char asset_data[] = {
+	0xff, 0x25, 0x21, 0x73, 0x69, 0x73, 0x6b, 0x70, 0x6e, 0x2e, 0x37, 0x30,
+	0x09, 0x7c, 0x01, 0x4a, 0x72, 0x72, 0x73, 0x0c, 0x6f, 0x0f, 0x00, 0x0e,
+	0x06, 0x0e, 0x09, 0x07, 0x07, 0x04, 0x71, 0x02, 0x6d, 0x0a, 0x1d, 0x00,
+	0x35, 0x08, 0x5b, 0x50, 0x5b, 0x54, 0x06, 0x00, 0x60, 0x58, 0x60, 0x5a,
+	0x08, 0x5c, 0x0a, 0x45, 0x01, 0x0b, 0x13, 0x02, 0x14, 0x02, 0x75, 0x17,
+	0x13, 0x72, 0x14, 0x71, 0x04, 0x08, 0x06, 0x17, 0x02, 0x02, 0x20, 0x04,
+	0x03, 0x12, 0x03, 0x09, 0x0b, 0x0b, 0x20, 0x06, 0x1c, 0x0a, 0x19, 0x1b,
+	0x08, 0x0b, 0x1c, 0x00, 0x0a, 0x06, 0x0a, 0x09, 0x60, 0x04, 0x71, 0x08,
+	0x11, 0x01, 0x7a, 0x1b, 0x00, 0x1e, 0x08, 0x12, 0x6b, 0x1a, 0x64, 0x65,
+	0x04, 0x20, 0x01, 0x08, 0x00, 0x31, 0x12, 0x18, 0x0d, 0x10, 0x12, 0x18,
+	0x0e, 0x1d, 0x06, 0x09, 0x00, 0x09, 0x09, 0x03, 0x03, 0x09, 0xa0, 0x6d,
+	0x0a, 0x75, 0x07, 0x78, 0x19, 0x1b, 0x7b, 0x7b, 0x1c, 0x21, 0x0d, 0x73,
+	0x0d, 0x0c, 0x22, 0x02, 0x0e, 0x10, 0x06, 0x55, 0x08, 0x03, 0x10, 0x0e,
+	0x0a, 0x08, 0x08, 0x0b, 0x7a, 0x24, 0x0a, 0x03, 0x0a, 0xa8, 0x17, 0x00,
+	0x17, 0x17, 0x17, 0x16, 0x08, 0x10, 0x17, 0x11, 0x11, 0x13, 0x0d, 0x07,
+	0x17, 0x0e, 0x17, 0x17, 0x17, 0x16, 0x12, 0x0b, 0x0a, 0x78, 0x02, 0x0c,
+	0x0f, 0x0f, 0x15, 0x15, 0x03, 0x10, 0x0e, 0x0a, 0x08, 0x08, 0x0b, 0x17,
+	0x17, 0x0a, 0x03, 0x0a, 0xb7, 0x17, 0x00, 0x17, 0x17, 0x17, 0x16, 0x08,
+	0x10, 0x17, 0x11, 0x11, 0x13, 0x0d, 0x07, 0x0d, 0x16, 0x16, 0x16, 0x15,
+	0x11, 0x0a, 0x0f, 0x14, 0x09, 0x0f, 0x0f, 0x2c, 0x13, 0x00, 0x20, 0x08,
+	0x6a, 0x1d, 0x1d, 0x27, 0x2b, 0x2b, 0x21, 0x6f, 0x02, 0x23, 0x24, 0x0c,
+	0x00, 0x1e, 0x06, 0x11, 0x15, 0x79, 0x1a, 0x25, 0x16, 0x65, 0x13, 0x00,
+	0x01, 0x00, 0xce, 0x11, 0x21, 0x09, 0x18, 0x18, 0x21, 0x07, 0x07, 0x07,
+	0x1e, 0x29, 0x20, 0x00, 0x04, 0x18, 0x10, 0x05, 0x2c, 0x0c, 0x10, 0x1e,
+	0x00, 0x0e, 0x06, 0x0e, 0x09, 0x2c, 0x04, 0x2c, 0x08, 0x0d, 0x01, 0x2c,
+	0x18, 0x18, 0x30, 0x05, 0x07, 0x0a, 0x16, 0x03, 0x03, 0x03, 0x0e, 0x09,
+	0x14, 0x0d, 0x00, 0x1e, 0x06, 0x18, 0x18, 0x09, 0x07, 0x2b, 0x07, 0x6f,
+	0x04, 0x16, 0x0b, 0x15, 0x05, 0x31, 0x16, 0x7b, 0x05, 0x14, 0x14, 0x17,
+	0x10, 0x10, 0x05, 0x13, 0x0b, 0x02, 0x13, 0x0c, 0x00, 0x01, 0x00, 0x97,
+	0x22, 0x13, 0x04, 0x03, 0x72, 0x07, 0x1c, 0x0a, 0x0a, 0x06, 0x04, 0x0a,
+	0x02, 0x0d, 0x0d, 0x24, 0x12, 0x13, 0x09, 0x0a, 0x0f, 0x0d, 0x00, 0x03,
+	0x00, 0x8e, 0x0e, 0x12, 0x12, 0x0c, 0x2e, 0x17, 0x01, 0x21, 0x01, 0x67,
+	0x68, 0x6e, 0x2b, 0x10, 0x01, 0x10, 0x90, 0x08, 0x16, 0x0e, 0x06, 0x14,
+	0x14, 0x74, 0x10, 0x22, 0x17, 0x0b, 0x20, 0x04, 0x17, 0x17, 0x00, 0x01,
+	0x00, 0x90, 0x6c, 0x18, 0x05, 0x00, 0x24, 0x08, 0x06, 0x64, 0x00, 0x14,
+	0x0a, 0x06, 0x07, 0x35, 0x0c, 0x13, 0x01, 0x13, 0x9f, 0x0a, 0x07, 0x03,
+	0x1b, 0x11, 0x1b, 0x1b, 0x06, 0x10, 0x07, 0x04, 0x0e, 0x1d, 0x29, 0x6e,
+	0x19, 0x00, 0x00, 0x21, 0x07, 0x06, 0x08, 0x18, 0x17, 0x0a, 0x0f, 0x0d,
+	0x0e, 0x11, 0x15, 0x07, 0x01, 0x07, 0xff, 0x37, 0x0a, 0x26, 0x09, 0x0b,
+	0x08, 0x36, 0x25, 0x76, 0x2d, 0x00, 0x34, 0x04, 0x01, 0x66, 0x06, 0x03,
+	0x06, 0x06, 0x30, 0x06, 0x04, 0x01, 0x06, 0x06, 0x25, 0x19, 0x0c, 0x03,
+	0x06, 0x2d, 0x0a, 0x2a, 0x09, 0x04, 0x01, 0x05, 0x15, 0x12, 0x1e, 0x15,
+	0x15, 0x13, 0x13, 0x00, 0x14, 0x06, 0x0f, 0x09, 0x06, 0x03, 0x21, 0x17,
+	0x06, 0x06, 0x08, 0x08, 0x13, 0x09, 0x04, 0x04, 0x05, 0x06, 0x19, 0x03,
+	0x0a, 0x06, 0x0a, 0x39, 0x02, 0x1c, 0x20, 0x07, 0x09, 0x10, 0x02, 0x05,
+	0x16, 0x08, 0x02, 0x17, 0x0d, 0x30, 0x03, 0x03, 0x29, 0x00, 0x05, 0x08,
+	0x03, 0x0f, 0x0a, 0x04, 0x08, 0x07, 0x03, 0x02, 0x04, 0x0f, 0x0f, 0x03,
+	0x07, 0x09, 0x00, 0x0a, 0x08, 0x03, 0x13, 0x01, 0x06, 0x08, 0x04, 0x10,
+	0x03, 0x0b, 0x14, 0x04, 0x02, 0x0a, 0x02, 0x06, 0x0f, 0x0c, 0x03, 0x13,
+	0x04, 0x0a, 0x92, 0x0f, 0x21, 0x23, 0x06, 0x14, 0x00, 0x21, 0x0a, 0x0a,
+	0x04, 0x10, 0x0f, 0x0e, 0x21, 0x05, 0x0b, 0x0d, 0x07, 0x01, 0x07, 0xff,
+	0x21, 0x15, 0x16, 0x09, 0x11, 0x08, 0x09, 0x0c, 0x04, 0x03, 0x09, 0x09,
+	0x19, 0x06, 0x09, 0x13, 0x07, 0x09, 0x08, 0x13, 0x02, 0x02, 0x02, 0x01,
+	0x17, 0x06, 0x24, 0x0b, 0x05, 0x01, 0x18, 0x14, 0x03, 0x0a, 0x0f, 0x09,
+	0x03, 0x0a, 0x02, 0x02, 0x01, 0x0d, 0x0d, 0x0b, 0x0c, 0x01, 0x02, 0x0a,
+	0x05, 0x11, 0x0c, 0x0f, 0x25, 0x02, 0x0a, 0x18, 0x17, 0x07, 0x17, 0x14,
+	0x14, 0x03, 0x0e, 0x0e, 0x14, 0x0a, 0x0a, 0x01, 0x0e, 0x06, 0x05, 0x11,
+	0x02, 0x01, 0x11, 0x03, 0x11, 0x07, 0x08, 0x09, 0x0a, 0x08, 0x19, 0x11,
+	0x0c, 0x03, 0x09, 0x14, 0x17, 0x08, 0x0c, 0x0d, 0x05, 0x08, 0x06, 0x07,
+	0x03, 0x02, 0x02, 0x0c, 0x02, 0x16, 0x1d, 0x0d, 0x14, 0x0f, 0x02, 0x17,
+	0x00, 0x01, 0x01, 0x1d, 0x05, 0x01, 0x09, 0x18, 0x11, 0x0d, 0x1a, 0x08,
+	0x12, 0x14, 0x07, 0x05, 0x06, 0x02, 0x07, 0xff, 0x02, 0x03, 0x0a, 0x12,
+	0x07, 0x07, 0x18, 0x08, 0x33, 0x03, 0x18, 0x0b, 0x0a, 0x05, 0x32, 0x06,
+	0x35, 0x21, 0x03, 0x18, 0x05, 0x08, 0x17, 0x1e, 0x0a, 0x04, 0x15, 0x02,
+	0x00, 0x18, 0x03, 0x05, 0x11, 0x00, 0x04, 0x01, 0x21, 0x04, 0x09, 0x13,
+	0x18, 0x06, 0x19, 0x01, 0x37, 0x17, 0x02, 0x13, 0x1b, 0x06, 0x03, 0x0d,
+	0x15, 0x0e, 0x1c, 0x0e, 0x0e, 0x0e, 0x19, 0x19, 0x14, 0x04, 0x07, 0x05,
+	0x02, 0x1c, 0x34, 0x13, 0x16, 0x0e, 0x39, 0x21, 0x04, 0x02, 0x72, 0x14,
+	0x03, 0x12, 0x12, 0x20, 0x0b, 0x01, 0x0c, 0x41, 0x15, 0x0c, 0x10, 0x08,
+	0x08, 0x06, 0x03, 0x10, 0x02, 0x02, 0x04, 0x02, 0x02, 0x16, 0x1a, 0x03,
+	0x06, 0x0c, 0x02, 0x01, 0x02, 0x13, 0x09, 0x0e, 0x05, 0x1c, 0x1f, 0x1f,
+	0x1f, 0x03, 0x0e, 0x40, 0x06, 0x0e, 0x0f, 0x0e, 0x1f, 0x14, 0x09, 0x1d,
+	0x12, 0x07, 0x0a, 0xff, 0x17, 0x73, 0x03, 0x15, 0x00, 0x01, 0x17, 0x09,
+	0x01, 0x0d, 0x13, 0x0e, 0x1c, 0x17, 0x10, 0x0d, 0x04, 0x26, 0x23, 0x12,
+	0x00, 0x3c, 0x0a, 0x17, 0x2c, 0x1e, 0x3c, 0x03, 0x3c, 0x30, 0x08, 0x00,
+	0x21, 0x0d, 0x19, 0x12, 0x0b, 0x10, 0x02, 0x32, 0x13, 0x13, 0x17, 0x27,
+	0x20, 0x06, 0x1c, 0x00, 0x0b, 0x06, 0x17, 0x0b, 0x26, 0x23, 0x05, 0x0e,
+	0x01, 0x02, 0x2c, 0x28, 0x06, 0x10, 0x0b, 0x2c, 0x1f, 0x0a, 0x0a, 0x09,
+	0x07, 0x0a, 0x0d, 0x02, 0x11, 0x0e, 0x11, 0x11, 0x11, 0x0d, 0x07, 0x00,
+	0x07, 0x2e, 0x09, 0x0a, 0x27, 0x04, 0x2f, 0x31, 0x19, 0x00, 0x14, 0x04,
+	0x0f, 0x12, 0x16, 0x03, 0x13, 0x0d, 0x0e, 0x03, 0x31, 0x0b, 0x27, 0x22,
+	0x04, 0x1f, 0x18, 0x1d, 0x63, 0x19, 0x0c, 0x14, 0x08, 0x06, 0x15, 0x1a,
+	0x0e, 0x08, 0x0b, 0x04, 0x0f, 0x02, 0x10, 0x0b, 0x0a, 0x03, 0x24, 0xbe,
+	0x06, 0x2d, 0x09, 0x07, 0x05, 0x07, 0x0d, 0x08, 0x1b, 0x02, 0x02, 0x04,
+	0x08, 0x0a, 0x02, 0x1a, 0x1b, 0x04, 0x05, 0x00, 0x0a, 0x0a, 0x06, 0x03,
+	0x0a, 0x02, 0x08, 0x03, 0x16, 0x05, 0x1d, 0x02, 0x09, 0x02, 0x06, 0x07,
+	0x0b, 0x07, 0x19, 0x04, 0x0b, 0x12, 0x02, 0x11, 0x03, 0x0b, 0x13, 0x05,
+	0x03, 0x13, 0x0f, 0x06, 0x07, 0x0e, 0x08, 0x0d, 0x14, 0x05, 0x0e, 0x0e,
+	0x0e, 0x0d, 0x02, 0x0d, 0xff, 0x08, 0x0d, 0x0d, 0x0f, 0x04, 0x03, 0x0e,
+	0x0c, 0x0b, 0x03, 0x14, 0x0a, 0x14, 0x07, 0x07, 0x05, 0x04, 0x02, 0x14,
+	0x0f, 0x08, 0x05, 0x05, 0x13, 0x02, 0x03, 0x0c, 0x32, 0x09, 0x09, 0x05,
+	0x10, 0x0e, 0x0e, 0x1e, 0x04, 0x0a, 0x0a, 0x0a, 0x08, 0x14, 0x02, 0x08,
+	0x02, 0x06, 0x0c, 0x05, 0x02, 0x05, 0x02, 0x04, 0x03, 0x09, 0x0d, 0x08,
+	0x0e, 0x02, 0x02, 0x04, 0x01, 0x04, 0x02, 0x0a, 0x03, 0x08, 0x08, 0x08,
+	0x02, 0x0a, 0x02, 0x14, 0x08, 0x09, 0x07, 0x14, 0x04, 0x00, 0x67, 0x0b,
+	0x2b, 0x00, 0x01, 0x0c, 0x06, 0x08, 0x0d, 0x04, 0x01, 0x0b, 0x03, 0x1d,
+	0x12, 0x07, 0x00, 0x10, 0x10, 0x15, 0x09, 0x11, 0x09, 0x03, 0x10, 0x12,
+	0x09, 0x07, 0x0d, 0x0a, 0x10, 0x10, 0x0b, 0x10, 0x05, 0x02, 0x0b, 0x0a,
+	0x08, 0x03, 0x32, 0x03, 0x0e, 0x18, 0x07, 0x05, 0x03, 0x06, 0x02, 0x0b,
+	0xd4, 0x0c, 0x06, 0x15, 0x04, 0x07, 0x04, 0x05, 0x02, 0x01, 0x19, 0x04,
+	0x3f, 0x05, 0x0c, 0x14, 0x04, 0x0b, 0x07, 0x02, 0x15, 0x14, 0x03, 0x00,
+	0x12, 0x12, 0x05, 0x12, 0x22, 0x02, 0x07, 0x0a, 0x09, 0x11, 0x0f, 0x05,
+	0x06, 0x0d, 0x11, 0x08, 0x04, 0x0d, 0x07, 0x18, 0x03, 0x06, 0x33, 0x0a,
+	0x0a, 0x0e, 0x0e, 0x06, 0x0e, 0x1b, 0x02, 0x01, 0x08, 0x0f, 0x16, 0x12,
+	0x12, 0x04, 0x09, 0x09, 0x08, 0x09, 0x19, 0x02, 0x01, 0x07, 0x18, 0x12,
+	0x0b, 0x09, 0x0a, 0x00, 0x0a, 0x0a, 0x09, 0x0a, 0x10, 0x02, 0x01, 0x06,
+	0x0b, 0x02, 0x0b, 0xff, 0x05, 0x0b, 0x00, 0x0b, 0x0b, 0x0a, 0x0b, 0x13,
+	0x02, 0x18, 0x06, 0x07, 0x03, 0x20, 0x23, 0x23, 0x00, 0x0a, 0x0a, 0x05,
+	0x0a, 0x0b, 0x02, 0x0a, 0x0a, 0x0a, 0x03, 0x23, 0x04, 0x17, 0x03, 0x0c,
+	0x05, 0x03, 0x1d, 0x16, 0x1a, 0x06, 0x23, 0x05, 0x15, 0x15, 0x16, 0x19,
+	0x04, 0x09, 0x12, 0x12, 0x09, 0x12, 0x0d, 0x02, 0x0f, 0x11, 0x03, 0x03,
+	0x0d, 0x15, 0x0b, 0x1b, 0x06, 0x08, 0x2e, 0x03, 0x19, 0x00, 0x01, 0x08,
+	0x08, 0x0e, 0x11, 0x11, 0x11, 0x0b, 0x04, 0x11, 0x11, 0x11, 0x09, 0x0d,
+	0x1d, 0x02, 0x12, 0x10, 0x12, 0x03, 0x15, 0x19, 0x2b, 0x0a, 0x0a, 0x05,
+	0x0a, 0x13, 0x02, 0x0a, 0x0a, 0x0a, 0x03, 0x33, 0x11, 0x1e, 0x04, 0x08,
+	0x2c, 0x04, 0x02, 0x2a, 0x1d, 0x03, 0x13, 0x1c, 0x0a, 0x18, 0x03, 0x18,
+	0x05, 0x18, 0x18, 0x04, 0x18, 0x22, 0x08, 0x27, 0x05, 0x0a, 0x1e, 0xff,
+	0x04, 0x0e, 0x0d, 0x02, 0x0b, 0x02, 0x02, 0x03, 0x10, 0x02, 0x22, 0x02,
+	0x24, 0x06, 0x06, 0x03, 0x05, 0x08, 0x08, 0x03, 0x17, 0x04, 0x0a, 0x0e,
+	0x02, 0x08, 0x02, 0x05, 0x03, 0x23, 0x1f, 0x18, 0x00, 0x1b, 0x1b, 0x05,
+	0x10, 0x24, 0x02, 0x1c, 0x06, 0x09, 0x03, 0x01, 0x04, 0x0f, 0x02, 0x0b,
+	0x16, 0x02, 0x01, 0x05, 0x1f, 0x1f, 0x24, 0x00, 0x18, 0x04, 0x23, 0x12,
+	0x09, 0x1a, 0x04, 0x15, 0x13, 0x0d, 0x1b, 0x17, 0x0f, 0x11, 0x07, 0x06,
+	0x18, 0x04, 0x03, 0x01, 0x0a, 0x07, 0x0b, 0x11, 0x04, 0x01, 0x05, 0x07,
+	0x08, 0x02, 0x05, 0x07, 0x06, 0x03, 0x08, 0x02, 0x19, 0x01, 0x02, 0x01,
+	0x04, 0x09, 0x02, 0x17, 0x17, 0x07, 0x17, 0x17, 0x02, 0x01, 0x0b, 0x06,
+	0x03, 0x16, 0x16, 0x38, 0x09, 0x09, 0x05, 0x09, 0x1e, 0x02, 0x07, 0x07,
+	0x07, 0x03, 0x27, 0x09, 0x00, 0x1b, 0x0b, 0xff, 0x04, 0x1c, 0x16, 0x03,
+	0x03, 0x15, 0x04, 0x10, 0x05, 0x02, 0x14, 0x12, 0x15, 0x14, 0x2a, 0x09,
+	0x05, 0x05, 0x08, 0x0c, 0x04, 0x16, 0x16, 0x1a, 0x00, 0x03, 0x0b, 0x07,
+	0x0e, 0x0d, 0x08, 0x0d, 0x0e, 0x07, 0x0c, 0x0b, 0x02, 0x07, 0x07, 0x06,
+	0x0e, 0x02, 0x0a, 0x0a, 0x1a, 0x07, 0x06, 0x02, 0x01, 0x04, 0x04, 0x18,
+	0x18, 0x06, 0x18, 0x21, 0x02, 0x11, 0x0c, 0x10, 0x03, 0x0c, 0x1a, 0x03,
+	0x03, 0x03, 0x0b, 0x1b, 0x04, 0x04, 0x06, 0x02, 0x0f, 0x05, 0x02, 0x03,
+	0x04, 0x32, 0x2e, 0x33, 0x24, 0x03, 0x20, 0x05, 0x6e, 0x6d, 0x11, 0x25,
+	0x0c, 0x0f, 0x06, 0x01, 0x02, 0x0f, 0x0e, 0x0e, 0x04, 0x16, 0x04, 0x1e,
+	0x07, 0x03, 0x17, 0x1b, 0x03, 0x01, 0x1b, 0x16, 0x0c, 0x1c, 0x0c, 0x06,
+	0x0c, 0x09, 0x0b, 0x0b, 0x06, 0x06, 0x05, 0x1a, 0x1a, 0x08, 0x10, 0x2f,
+	0x02, 0x10, 0x11, 0xff, 0x0b, 0x09, 0x04, 0x09, 0x02, 0x19, 0x05, 0x02,
+	0x03, 0x04, 0x28, 0x0e, 0x0d, 0x10, 0x06, 0x06, 0x06, 0x05, 0x08, 0x04,
+	0x03, 0x15, 0x15, 0x0e, 0x12, 0x0c, 0x0e, 0x06, 0x02, 0x15, 0x03, 0x08,
+	0x1d, 0x01, 0x0a, 0x0c, 0x07, 0x07, 0x07, 0x03, 0x07, 0x06, 0x0c, 0x16,
+	0x07, 0x16, 0x1e, 0x02, 0x03, 0x03, 0x10, 0x0d, 0x11, 0x08, 0x0a, 0x16,
+	0x16, 0x09, 0x11, 0x09, 0x02, 0x09, 0x06, 0x07, 0x03, 0x24, 0x24, 0x26,
+	0x00, 0x03, 0x28, 0x13, 0x12, 0x21, 0x04, 0x15, 0x09, 0x1c, 0x01, 0x15,
+	0x06, 0x05, 0x0e, 0x15, 0x00, 0x0e, 0x06, 0x05, 0x02, 0x1d, 0x06, 0x18,
+	0x07, 0x00, 0x17, 0x03, 0x08, 0x03, 0x0b, 0x03, 0x01, 0x09, 0x23, 0x04,
+	0x03, 0x06, 0x09, 0x06, 0x0b, 0x19, 0x04, 0x03, 0x0c, 0x04, 0x19, 0x19,
+	0x0b, 0x08, 0x19, 0x19, 0x08, 0x19, 0x15, 0x02, 0x32, 0x13, 0x01, 0xff,
+	0x01, 0x01, 0x02, 0x1a, 0x08, 0x09, 0x03, 0x1a, 0x1a, 0x1a, 0x00, 0x03,
+	0x09, 0x1a, 0x11, 0x1a, 0x04, 0x1a, 0x13, 0x16, 0x01, 0x1e, 0x0c, 0x07,
+	0x01, 0x04, 0x0d, 0x07, 0x21, 0x20, 0x12, 0x02, 0x41, 0x02, 0x2c, 0x05,
+	0x1f, 0x0f, 0x22, 0x0b, 0x1d, 0x05, 0x0f, 0x0e, 0x02, 0x0e, 0x16, 0x05,
+	0x03, 0x04, 0x08, 0x10, 0x08, 0x04, 0x37, 0x02, 0x0b, 0x31, 0x04, 0x1a,
+	0x16, 0x46, 0x6c, 0x12, 0x25, 0x01, 0x02, 0x39, 0x20, 0x20, 0x09, 0x09,
+	0x73, 0x02, 0x21, 0x01, 0x27, 0x16, 0x17, 0x13, 0x12, 0x25, 0x06, 0x03,
+	0x26, 0x03, 0x04, 0x0f, 0x05, 0x27, 0x05, 0x06, 0x21, 0x09, 0x07, 0x21,
+	0x00, 0x07, 0x27, 0x27, 0x08, 0x09, 0x2e, 0x06, 0x06, 0x04, 0x0e, 0x02,
+	0x0f, 0x01, 0x47, 0x1d, 0x12, 0x03, 0x07, 0x0c, 0x0e, 0x12, 0x0f, 0x01,
+	0x1e, 0x04, 0x0f, 0x2f, 0x08, 0x1f, 0x04, 0xff, 0x1f, 0x1f, 0x04, 0x18,
+	0x0d, 0x2b, 0x1e, 0x1d, 0x1d, 0x1d, 0x07, 0x07, 0x3c, 0x02, 0x16, 0x01,
+	0x17, 0x13, 0x13, 0x1c, 0x10, 0x1e, 0x06, 0x03, 0x1a, 0x03, 0x04, 0x1e,
+	0x05, 0x1d, 0x05, 0x06, 0x19, 0x09, 0x07, 0x1a, 0x00, 0x07, 0x23, 0x05,
+	0x02, 0x1b, 0x08, 0x02, 0x0e, 0x01, 0x1f, 0x1c, 0x04, 0x0c, 0x1f, 0x0a,
+	0x06, 0x1e, 0x23, 0x02, 0x0b, 0x12, 0x0f, 0x01, 0x0a, 0x00, 0x0f, 0x01,
+	0x11, 0x06, 0x04, 0x0f, 0x02, 0x11, 0x0e, 0x0c, 0x04, 0x04, 0x21, 0x6f,
+	0x1c, 0x03, 0x20, 0x0c, 0x20, 0x20, 0x04, 0x1b, 0x1b, 0x44, 0x1f, 0x1f,
+	0x1f, 0x06, 0x06, 0x16, 0x02, 0x1f, 0x17, 0x15, 0x15, 0x0e, 0x1f, 0x06,
+	0x03, 0x16, 0x03, 0x04, 0x17, 0x05, 0x1f, 0x18, 0x04, 0x03, 0x0b, 0x0a,
+	0x03, 0x26, 0x1c, 0x0a, 0x08, 0x08, 0x08, 0x1f, 0x1c, 0x05, 0x1f, 0x1f,
+	0x05, 0x10, 0x07, 0xff, 0x02, 0x02, 0x01, 0x0f, 0x0a, 0x06, 0x1e, 0x02,
+	0x08, 0x1f, 0x07, 0x0f, 0x23, 0x09, 0x1d, 0x2e, 0x2e, 0x2e, 0x00, 0x04,
+	0x09, 0x09, 0x10, 0x08, 0x1c, 0x1c, 0x1c, 0x07, 0x1c, 0x0f, 0x02, 0x24,
+	0x01, 0x02, 0x09, 0x13, 0x19, 0x35, 0x05, 0x10, 0x10, 0x10, 0x00, 0x03,
+	0x08, 0x08, 0x1e, 0x02, 0x10, 0x09, 0x1d, 0x06, 0x2a, 0x15, 0x06, 0x17,
+	0x01, 0x09, 0x23, 0x06, 0x18, 0x01, 0x19, 0x2f, 0x0b, 0x02, 0x1c, 0x20,
+	0x1b, 0x0a, 0x0a, 0x0b, 0x09, 0x08, 0x20, 0x01, 0x0d, 0x1c, 0x04, 0x18,
+	0x01, 0x2a, 0x09, 0x2a, 0x03, 0x09, 0x0b, 0x02, 0x01, 0x22, 0x03, 0x16,
+	0x06, 0x16, 0x0c, 0x1e, 0x1e, 0x09, 0x1e, 0x16, 0x02, 0x0e, 0x19, 0x01,
+	0x02, 0x1e, 0x08, 0x17, 0x0f, 0x03, 0x03, 0x04, 0x05, 0x01, 0x22, 0x13,
+	0x10, 0x05, 0x22, 0x05, 0x0b, 0x04, 0x02, 0x09, 0x11, 0x00, 0x05, 0xff,
+	0x06, 0x05, 0x05, 0x09, 0x01, 0x06, 0x06, 0x02, 0x1f, 0x1f, 0x1f, 0x00,
+	0x03, 0x14, 0x1a, 0x06, 0x02, 0x15, 0x0b, 0x12, 0x06, 0x04, 0x06, 0x11,
+	0x05, 0x20, 0x05, 0x08, 0x06, 0x08, 0x05, 0x04, 0x03, 0x0f, 0x02, 0x05,
+	0x03, 0x1a, 0x04, 0x10, 0x17, 0x17, 0x07, 0x17, 0x2e, 0x02, 0x14, 0x01,
+	0x21, 0x09, 0x0a, 0x09, 0x0c, 0x05, 0x19, 0x16, 0x24, 0x1f, 0x08, 0x06,
+	0x0f, 0x00, 0x01, 0x13, 0x08, 0x0a, 0x14, 0x12, 0x02, 0x13, 0x06, 0x05,
+	0x19, 0x08, 0x02, 0x30, 0x17, 0x02, 0x04, 0x09, 0x02, 0x02, 0x05, 0x00,
+	0x06, 0x10, 0x04, 0x10, 0x05, 0x09, 0x00, 0x05, 0x0c, 0x05, 0x12, 0x01,
+	0x0d, 0x11, 0x0f, 0x03, 0x0b, 0x22, 0x03, 0x10, 0x0e, 0x22, 0x77, 0x79,
+	0x0f, 0x08, 0x00, 0x0e, 0x11, 0x0b, 0x27, 0x03, 0x26, 0x2a, 0x04, 0x1b,
+	0x1b, 0x10, 0x06, 0x15, 0x19, 0x28, 0x1e, 0xff, 0x1e, 0x09, 0x09, 0x4a,
+	0x02, 0x19, 0x01, 0x07, 0x17, 0x17, 0x17, 0x12, 0x05, 0x0e, 0x18, 0x1f,
+	0x03, 0x1c, 0x03, 0x1f, 0x0a, 0x0a, 0x12, 0x17, 0x00, 0x0c, 0x25, 0x14,
+	0x04, 0x0a, 0x01, 0x19, 0x0b, 0x0d, 0x04, 0x10, 0x01, 0x28, 0x09, 0x28,
+	0x03, 0x0f, 0x1f, 0x02, 0x04, 0x13, 0x03, 0x02, 0x0c, 0x0c, 0x05, 0x03,
+	0x0e, 0x21, 0x03, 0x16, 0x2b, 0x02, 0x0d, 0x01, 0x15, 0x07, 0x0b, 0x22,
+	0x0d, 0x04, 0x0a, 0x06, 0x12, 0x17, 0x02, 0x02, 0x01, 0x02, 0x08, 0x17,
+	0x0e, 0x1a, 0x1a, 0x06, 0x0f, 0x23, 0x02, 0x1a, 0x1a, 0x09, 0x10, 0x0b,
+	0x05, 0x01, 0x18, 0x0b, 0x03, 0x0d, 0x05, 0x01, 0x15, 0x28, 0x10, 0x09,
+	0x01, 0x06, 0x17, 0x0b, 0x13, 0x12, 0x04, 0x10, 0x1c, 0x02, 0x0b, 0x08,
+	0x02, 0x11, 0x26, 0x77, 0x03, 0x0c, 0x0f, 0x06, 0x12, 0x11, 0x09, 0x17,
+	0x07, 0x0e, 0x10, 0xc0, 0x02, 0x04, 0x01, 0x06, 0x02, 0x1e, 0x13, 0x08,
+	0x17, 0x17, 0x07, 0x12, 0x0f, 0x02, 0x2b, 0x06, 0x15, 0x11, 0x0d, 0x16,
+	0x06, 0x0f, 0x2b, 0x10, 0x19, 0x02, 0x02, 0x04, 0x10, 0x06, 0x02, 0x12,
+	0x0b, 0x20, 0x09, 0x19, 0x0a, 0x0d, 0x05, 0x15, 0x00, 0x0e, 0x16, 0x24,
+	0x0b, 0x03, 0x0e, 0x02, 0x17, 0x06, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03,
+	0x02, 0x0f, 0x08, 0x04, 0x08, 0x08, 0x05, 0x0d, 0x02, 0x0d, 0xff, 0x09,
+	0x0b, 0x00, 0x01, 0x0e, 0x1f, 0x09, 0x0b, 0x04, 0x00, 0x04, 0x05, 0x04,
+	0x09, 0x11, 0x0f, 0x12, 0x0f, 0x18, 0x09, 0x0b, 0x08, 0x0d, 0x04, 0x12,
+	0x06, 0x0d, 0x05, 0x03, 0x02, 0x0d, 0x03, 0x16, 0x20, 0x02, 0x0e, 0x05,
+	0x08, 0x15, 0x19, 0x19, 0x06, 0x08, 0x28, 0x02, 0x0a, 0x0f, 0x16, 0x0b,
+	0x16, 0x10, 0x16, 0x05, 0x16, 0x00, 0x08, 0x2b, 0x2b, 0x1d, 0x00, 0x03,
+	0x21, 0x16, 0x19, 0x21, 0x0d, 0x1b, 0x03, 0x06, 0x19, 0x01, 0x07, 0x07,
+	0x18, 0x12, 0x08, 0x04, 0x1a, 0x06, 0x10, 0x10, 0x09, 0x07, 0x09, 0x09,
+	0x1c, 0x07, 0x1d, 0x06, 0x15, 0x16, 0x04, 0x1d, 0x0b, 0x0e, 0x17, 0x04,
+	0x02, 0x11, 0x11, 0x06, 0x0d, 0x1c, 0x10, 0x1b, 0x1b, 0x09, 0x1b, 0x11,
+	0x02, 0x08, 0x08, 0x12, 0x13, 0x04, 0x0f, 0x0a, 0x1b, 0x01, 0x13, 0x0e,
+	0x1b, 0x06, 0x03, 0x08, 0x1c, 0x03, 0xff, 0x09, 0x0a, 0x06, 0x07, 0x07,
+	0x07, 0x15, 0x09, 0x08, 0x04, 0x0a, 0x01, 0x0b, 0x07, 0x04, 0x16, 0x06,
+	0x0d, 0x14, 0x06, 0x03, 0x05, 0x06, 0x19, 0x03, 0x03, 0x20, 0x36, 0x36,
+	0x28, 0x03, 0x1c, 0x05, 0x10, 0x07, 0x00, 0x13, 0x12, 0x04, 0x0e, 0x13,
+	0x19, 0x06, 0x05, 0x19, 0x19, 0x07, 0x19, 0x38, 0x02, 0x13, 0x07, 0x17,
+	0x09, 0x17, 0x18, 0x04, 0x06, 0x02, 0x17, 0x1c, 0x00, 0x01, 0x11, 0x04,
+	0x1e, 0x03, 0x0a, 0x12, 0x10, 0x05, 0x05, 0x11, 0x19, 0x19, 0x04, 0x0d,
+	0x01, 0x1a, 0x1b, 0x05, 0x0f, 0x04, 0x04, 0x02, 0x16, 0x0d, 0x0d, 0x03,
+	0x05, 0x06, 0x09, 0x03, 0x03, 0x18, 0x1b, 0x1b, 0x1b, 0x03, 0x1b, 0x05,
+	0x0b, 0x0b, 0x0b, 0x03, 0x0b, 0x0a, 0x2e, 0x02, 0x1c, 0x1c, 0x05, 0x1c,
+	0x35, 0x02, 0x1c, 0x09, 0x15, 0x19, 0x09, 0x05, 0x05, 0x05, 0x0c, 0x1e,
+	0x02, 0x0d, 0xb5, 0x19, 0x00, 0x06, 0x02, 0x25, 0x01, 0x04, 0x18, 0x04,
+	0x3a, 0x0c, 0x26, 0x14, 0x04, 0x0c, 0x20, 0x1c, 0x06, 0x10, 0x05, 0x1e,
+	0x0c, 0x3f, 0x21, 0x12, 0x21, 0x0b, 0x10, 0x06, 0x12, 0x00, 0x0b, 0x06,
+	0x0b, 0x0b, 0x02, 0x02, 0x0d, 0x11, 0x18, 0x18, 0x06, 0x18, 0x1a, 0x02,
+	0x27, 0x27, 0x27, 0x00, 0x03, 0x12, 0x0c, 0x12, 0x02, 0x12, 0xff, 0x00,
+	0x12, 0x06, 0x12, 0x09, 0x0d, 0x15, 0x19, 0x05, 0x09, 0x08, 0x06, 0x16,
+	0x0a, 0x0d, 0x06, 0x0d, 0x0d, 0x08, 0x05, 0x08, 0x00, 0x0d, 0x06, 0x0d,
+	0x0a, 0x04, 0x07, 0x06, 0x00, 0x0a, 0x04, 0x06, 0x0b, 0x04, 0x09, 0x04,
+	0x07, 0x09, 0x3c, 0x05, 0x14, 0x14, 0x06, 0x14, 0x0d, 0x02, 0x0c, 0x0a,
+	0x15, 0x03, 0x02, 0x27, 0x05, 0x19, 0x04, 0x10, 0x05, 0x0d, 0x05, 0x1d,
+	0x05, 0x01, 0x24, 0x0e, 0x03, 0x10, 0x06, 0x10, 0x04, 0x04, 0x06, 0x06,
+	0x03, 0x03, 0x12, 0x0c, 0x05, 0x0b, 0x02, 0x02, 0x04, 0x26, 0x05, 0x04,
+	0x1b, 0x10, 0x05, 0x26, 0x09, 0x02, 0x07, 0x0c, 0x09, 0x0b, 0x0a, 0x0a,
+	0x03, 0x06, 0x06, 0x0f, 0x07, 0x04, 0x01, 0x0f, 0x20, 0x06, 0x03, 0x04,
+	0x15, 0x15, 0x04, 0x15, 0x4a, 0x02, 0x1a, 0x11, 0x00, 0x02, 0x0f, 0x03,
+	0x15, 0x02, 0x03, 0x09, 0x10, 0x02, 0xff, 0x01, 0x10, 0x03, 0x14, 0x02,
+	0x02, 0x16, 0x05, 0x0e, 0x19, 0x06, 0x16, 0x03, 0x15, 0x0b, 0x06, 0x0f,
+	0x19, 0x12, 0x12, 0x04, 0x04, 0x05, 0x02, 0x2c, 0x01, 0x10, 0x08, 0x24,
+	0x03, 0x13, 0x11, 0x0f, 0x0f, 0x04, 0x06, 0x16, 0x1c, 0x14, 0x08, 0x04,
+	0x01, 0x05, 0x0c, 0x14, 0x18, 0x13, 0x09, 0x18, 0x06, 0x03, 0x03, 0x06,
+	0x06, 0x08, 0x17, 0x09, 0x07, 0x0a, 0x1d, 0x02, 0x01, 0x09, 0x17, 0x07,
+	0x04, 0x3b, 0x22, 0x29, 0x19, 0x00, 0x17, 0x05, 0x3f, 0x29, 0x3d, 0x4a,
+	0x03, 0x42, 0x05, 0x2c, 0x09, 0x2d, 0x08, 0x0a, 0x00, 0x09, 0x1e, 0x10,
+	0x16, 0x09, 0x1b, 0x1a, 0x15, 0x1a, 0x02, 0x18, 0x1c, 0x06, 0x03, 0x16,
+	0x1a, 0x1d, 0x03, 0x1c, 0x0b, 0x06, 0x26, 0x07, 0x05, 0x0b, 0x04, 0x01,
+	0x06, 0x02, 0x06, 0x07, 0x1e, 0x00, 0x07, 0x03, 0x00, 0x04, 0x0b, 0x06,
+	0x1e, 0x03, 0xff, 0x02, 0x08, 0x01, 0x20, 0x0b, 0x08, 0x0b, 0x05, 0x06,
+	0x01, 0x06, 0x02, 0x1f, 0x09, 0x11, 0x1f, 0x0e, 0x08, 0x09, 0x35, 0x16,
+	0x00, 0x1e, 0x0a, 0x2c, 0x1f, 0x21, 0x2c, 0x1d, 0x02, 0x20, 0x41, 0x09,
+	0x00, 0x4b, 0x14, 0x0f, 0x0b, 0x2a, 0x12, 0x12, 0x00, 0x03, 0x15, 0x12,
+	0x00, 0x18, 0x03, 0x45, 0x0c, 0x0d, 0x11, 0x04, 0x30, 0x17, 0x33, 0x09,
+	0x45, 0x09, 0x01, 0x2d, 0x07, 0x06, 0x01, 0x04, 0x28, 0x05, 0x02, 0x01,
+	0x03, 0x20, 0x13, 0x22, 0x24, 0x13, 0x13, 0x0c, 0x1e, 0x08, 0x23, 0x25,
+	0x0e, 0x02, 0x03, 0x07, 0x24, 0x02, 0x0c, 0x05, 0x0a, 0x01, 0x2f, 0x0b,
+	0x0b, 0x06, 0x0d, 0x23, 0x02, 0x08, 0x03, 0x0e, 0x09, 0x0b, 0x08, 0x01,
+	0x19, 0x26, 0x1e, 0x13, 0x14, 0x4b, 0x00, 0x15, 0x03, 0x01, 0x0d, 0x11,
+	0x08, 0x1c, 0x03, 0x03, 0x01, 0x07, 0x70, 0x00, 0x02, 0x10, 0x01, 0x10,
+	0xee, 0x0f, 0x10, 0x12, 0x17, 0x08, 0x08, 0x0b, 0x07, 0x01, 0x14, 0x07,
+	0x07, 0x06, 0x0a, 0x14, 0x02, 0x08, 0x03, 0x0b, 0x09, 0x0b, 0x08, 0x01,
+	0x0f, 0x14, 0x08, 0x0f, 0x0f, 0x00, 0x44, 0x44, 0x28, 0x05, 0x2b, 0x34,
+	0x0c, 0x11, 0x49, 0x1a, 0x00, 0x4b, 0x11, 0x16, 0x20, 0x06, 0x05, 0x00,
+	0x09, 0x1f, 0x13, 0x1e, 0x0d, 0x25, 0x03, 0x16, 0x00, 0x03, 0x1a, 0x26,
+	0x04, 0x04, 0x1d, 0x05, 0x0d, 0x01, 0x03, 0x04, 0x06, 0x1d, 0x05, 0x01,
+	0x13, 0x06, 0x40, 0x70, 0x08, 0x08, 0x08, 0x0c, 0x0d, 0x09, 0x04, 0x1c,
+	0x12, 0x17, 0x0d, 0x0a, 0x41, 0x0d, 0x03, 0x06, 0x0f, 0x03, 0x03, 0x03,
+	0x02, 0x14, 0x36, 0x01, 0x20, 0x13, 0x25, 0x07, 0x11, 0x12, 0x06, 0x08,
+	0x13, 0x0d, 0x13, 0x01, 0x13, 0xff, 0x0f, 0x13, 0x06, 0x26, 0x09, 0x22,
+	0x07, 0x19, 0x05, 0x0a, 0x0a, 0x04, 0x0a, 0x0a, 0x0a, 0x16, 0x0d, 0x14,
+	0x01, 0x09, 0x0c, 0x0c, 0x07, 0x02, 0x3d, 0x09, 0x03, 0x16, 0x05, 0x19,
+	0x0e, 0x18, 0x0c, 0x10, 0x00, 0x1a, 0x06, 0x0b, 0x0d, 0x0e, 0x01, 0x19,
+	0x19, 0x19, 0x03, 0x05, 0x19, 0x01, 0x0c, 0x03, 0x14, 0x11, 0x02, 0x03,
+	0x04, 0x0a, 0x24, 0x02, 0x08, 0x05, 0x05, 0x02, 0x01, 0x03, 0x18, 0x03,
+	0x17, 0x08, 0x05, 0x05, 0x12, 0x03, 0x19, 0x00, 0x03, 0x0b, 0x09, 0x7b,
+	0x0e, 0x06, 0x04, 0x04, 0x05, 0x18, 0x27, 0x11, 0x1e, 0x21, 0x27, 0x04,
+	0x01, 0x05, 0x06, 0x10, 0x13, 0x02, 0x1f, 0x0a, 0x02, 0x0c, 0x1c, 0x12,
+	0x07, 0x16, 0x12, 0x00, 0x07, 0x1c, 0x08, 0x04, 0x07, 0x03, 0x03, 0x0a,
+	0x03, 0x1a, 0x08, 0x16, 0x08, 0x06, 0x0f, 0x3e, 0x40, 0x1c, 0x3d, 0x13,
+	0x05, 0xdb, 0x01, 0x1f, 0x25, 0x0c, 0x00, 0x25, 0x18, 0x12, 0x23, 0x0e,
+	0x0e, 0x10, 0x02, 0x15, 0x02, 0x08, 0x00, 0x23, 0x12, 0x17, 0x1b, 0x02,
+	0x08, 0x1f, 0x04, 0x19, 0x00, 0x03, 0x0c, 0x02, 0x0a, 0x18, 0x04, 0x1a,
+	0x1e, 0x07, 0x06, 0x1b, 0x05, 0x0e, 0x0b, 0x0f, 0x03, 0x05, 0x06, 0x08,
+	0x1e, 0x0c, 0x01, 0x25, 0x06, 0x03, 0x1d, 0x0b, 0x03, 0x09, 0x23, 0x01,
+	0x11, 0x0e, 0x0e, 0x03, 0x05, 0x0c, 0x23, 0x02, 0x09, 0x10, 0x06, 0x25,
+	0x04, 0x0c, 0x05, 0x0c, 0x03, 0x0b, 0x07, 0x17, 0x22, 0x10, 0x0d, 0x14,
+	0x00, 0x07, 0x0a, 0x0a, 0x0a, 0x17, 0x01, 0x06, 0x0b, 0x02, 0x0b, 0xff,
+	0x05, 0x0b, 0x00, 0x0b, 0x01, 0x06, 0x06, 0x04, 0x04, 0x0e, 0x0f, 0x14,
+	0x04, 0x07, 0x25, 0x0d, 0x00, 0x35, 0x08, 0x3a, 0x14, 0x11, 0x00, 0x0a,
+	0x01, 0x2c, 0x07, 0x00, 0x4a, 0x0f, 0x10, 0x09, 0x14, 0x01, 0x10, 0x0a,
+	0x10, 0x00, 0x03, 0x01, 0x0b, 0x0f, 0x16, 0x04, 0x09, 0x07, 0x02, 0x14,
+	0x03, 0x13, 0x00, 0x0a, 0x0f, 0x15, 0x09, 0x16, 0x08, 0x05, 0x09, 0x0a,
+	0x15, 0x0f, 0x05, 0x19, 0x10, 0x0f, 0x10, 0x0c, 0x02, 0x0d, 0x13, 0x0d,
+	0x08, 0x11, 0x11, 0x05, 0x10, 0x0a, 0x0a, 0x0e, 0x07, 0x01, 0x1a, 0x0f,
+	0x03, 0x0e, 0x06, 0x0d, 0x07, 0x0e, 0x05, 0x03, 0x0a, 0x02, 0x08, 0x08,
+	0x06, 0x18, 0x04, 0x09, 0x1a, 0x16, 0x11, 0x0a, 0x3e, 0x01, 0x0b, 0x03,
+	0x07, 0x0e, 0x0c, 0x0c, 0x03, 0x28, 0x3a, 0x04, 0x02, 0x03, 0x12, 0x0e,
+	0x07, 0x0a, 0x03, 0x0a, 0x22, 0x0d, 0x00, 0xab, 0x22, 0x1e, 0x3d, 0x16,
+	0x0d, 0x19, 0x0a, 0x09, 0x23, 0x0e, 0x10, 0x06, 0x0b, 0x00, 0x3c, 0x22,
+	0x1e, 0x1f, 0x13, 0x1a, 0x16, 0x1e, 0x0b, 0x1e, 0x16, 0x07, 0x07, 0x11,
+	0x07, 0x12, 0x00, 0x12, 0x12, 0x19, 0x0a, 0x18, 0x12, 0x07, 0x05, 0x04,
+	0x1d, 0x03, 0x0d, 0x02, 0x0d, 0xa6, 0x05, 0x0d, 0x00, 0x0d, 0x0a, 0x0d,
+	0x0b, 0x10, 0x01, 0x1f, 0x05, 0x11, 0x08, 0x1a, 0x15, 0x00, 0x1a, 0x1a,
+	0x1a, 0x0d, 0x14, 0x0f, 0x0a, 0x0f, 0x1a, 0x0e, 0x1a, 0x15, 0x02, 0x10,
+	0x06, 0x10, 0x10, 0x0d, 0x17, 0x19, 0x01, 0x07, 0x03, 0x07, 0xe3, 0x0e,
+	0x16, 0x17, 0x05, 0x13, 0x13, 0x06, 0x13, 0x07, 0x13, 0x13, 0x0b, 0x13,
+	0x13, 0x0f, 0x13, 0x18, 0x02, 0x11, 0x06, 0x0e, 0x11, 0x0d, 0x0c, 0x11,
+	0x11, 0x05, 0x08, 0x08, 0x08, 0x03, 0x08, 0x08, 0x1e, 0x04, 0x18, 0x13,
+	0x00, 0x29, 0x12, 0x07, 0x0a, 0x17, 0x0c, 0x0d, 0x00, 0x19, 0x13, 0x11,
+	0x06, 0x06, 0x04, 0x04, 0x03, 0x0d, 0x08, 0x02, 0x14, 0x20, 0x05, 0x03,
+	0x06, 0x13, 0x02, 0x02, 0x01, 0x13, 0x11, 0x13, 0x18, 0x0a, 0x0a, 0x1a,
+	0x13, 0x00, 0x19, 0x16, 0x19, 0x0d, 0x15, 0x07, 0x0b, 0x0f, 0x19, 0x0f,
+	0x4d, 0x01, 0x10, 0x05, 0x10, 0x0f, 0x0c, 0x10, 0x1b, 0x01, 0x07, 0x4d,
+	0x01, 0x08, 0x02, 0x08, 0xff, 0x0e, 0x18, 0x19, 0x05, 0x13, 0x00, 0x1a,
+	0x12, 0x08, 0x12, 0x01, 0x0c, 0x0b, 0x0a, 0x02, 0x12, 0x0a, 0x0f, 0x03,
+	0x01, 0x02, 0x00, 0x02, 0x0c, 0x17, 0x19, 0x0b, 0x04, 0x06, 0x06, 0x02,
+	0x09, 0x03, 0x0f, 0x0e, 0x00, 0x0e, 0x07, 0x0d, 0x07, 0x40, 0x1d, 0x3e,
+	0x02, 0x03, 0x0b, 0x1f, 0x0b, 0x0c, 0x03, 0x10, 0x05, 0x04, 0x0f, 0x12,
+	0x04, 0x12, 0x05, 0x06, 0x03, 0x02, 0x14, 0x05, 0x1c, 0x14, 0x0f, 0x1e,
+	0x06, 0x03, 0x08, 0x03, 0x04, 0x20, 0x05, 0x0c, 0x12, 0x04, 0x03, 0x0e,
+	0x0c, 0x0f, 0x0f, 0x07, 0x05, 0x05, 0x0f, 0x02, 0x01, 0x05, 0x17, 0x04,
+	0x05, 0x05, 0x02, 0x07, 0x03, 0x0c, 0x04, 0x1f, 0x06, 0x03, 0x18, 0x1c,
+	0x0a, 0x06, 0x07, 0x0d, 0x11, 0x02, 0x03, 0x02, 0x12, 0x0f, 0x18, 0x09,
+	0x0a, 0x13, 0x10, 0x06, 0x06, 0x0b, 0x00, 0x01, 0x13, 0x0a, 0x03, 0x03,
+	0xff, 0x05, 0x0a, 0x06, 0x01, 0x0b, 0x04, 0x0e, 0x24, 0x14, 0x09, 0x04,
+	0x06, 0x0d, 0x0f, 0x04, 0x28, 0x14, 0x0a, 0x04, 0x04, 0x06, 0x01, 0x0d,
+	0x0f, 0x03, 0x0c, 0x00, 0x04, 0x05, 0x0a, 0x04, 0x0f, 0x02, 0x0e, 0x05,
+	0x22, 0x0b, 0x25, 0x01, 0x16, 0x03, 0x04, 0x03, 0x0d, 0x0d, 0x03, 0x01,
+	0x03, 0x3f, 0x09, 0x11, 0x05, 0x05, 0x14, 0x02, 0x07, 0x0e, 0x0e, 0x02,
+	0x15, 0x01, 0x03, 0x08, 0x14, 0x06, 0x14, 0x07, 0x0e, 0x03, 0x17, 0x06,
+	0x02, 0x05, 0x0a, 0x14, 0x16, 0x13, 0x06, 0x0e, 0x00, 0x01, 0x14, 0x08,
+	0x12, 0x0b, 0x02, 0x07, 0x0c, 0x08, 0x01, 0x15, 0x00, 0x08, 0x01, 0x05,
+	0x32, 0x17, 0x09, 0x12, 0x12, 0x05, 0x1b, 0x1d, 0x44, 0x02, 0x2d, 0x21,
+	0x05, 0x21, 0x07, 0x0d, 0x03, 0x13, 0x0f, 0x14, 0x04, 0x04, 0x09, 0x0b,
+	0x21, 0x02, 0x03, 0x16, 0x14, 0x0f, 0x10, 0x03, 0xc4, 0x15, 0x05, 0x13,
+	0x05, 0x0e, 0x0b, 0x1a, 0x19, 0x16, 0x09, 0x19, 0x1f, 0x0a, 0x13, 0x0d,
+	0x1d, 0x0a, 0x04, 0x1b, 0x08, 0x03, 0x06, 0x04, 0x0f, 0x04, 0x0e, 0x03,
+	0x14, 0x15, 0x03, 0x00, 0x07, 0x1b, 0x19, 0x06, 0x12, 0x06, 0x0a, 0x03,
+	0x07, 0x09, 0x02, 0x11, 0x09, 0x02, 0x1e, 0x0f, 0x1f, 0x04, 0x0e, 0x05,
+	0x08, 0x08, 0x02, 0x0f, 0x05, 0x12, 0x04, 0x10, 0x16, 0x11, 0x05, 0x0e,
+	0x00, 0x1b, 0x09, 0x37, 0x08, 0x03, 0x08, 0xff, 0x00, 0x0e, 0x0d, 0x0f,
+	0x17, 0x11, 0x17, 0x0b, 0x0f, 0x17, 0x09, 0x0f, 0x01, 0x0b, 0x0d, 0x14,
+	0x0e, 0x01, 0x13, 0x04, 0x0a, 0x1f, 0x08, 0x0a, 0x0b, 0x0a, 0x07, 0x01,
+	0x04, 0x01, 0x03, 0x11, 0x08, 0x04, 0x06, 0x04, 0x04, 0x0b, 0x0b, 0x06,
+	0x07, 0x00, 0x11, 0x06, 0x11, 0x09, 0x0d, 0x05, 0x02, 0x06, 0x03, 0x0a,
+	0x16, 0x04, 0x10, 0x0f, 0x09, 0x05, 0x10, 0x05, 0x09, 0x0f, 0x09, 0x0d,
+	0x02, 0x03, 0x04, 0x1f, 0x0e, 0x04, 0x0c, 0x04, 0x07, 0x0e, 0x12, 0x0f,
+	0x11, 0x11, 0x08, 0x12, 0x08, 0x16, 0x0b, 0x10, 0x05, 0x02, 0x11, 0x0b,
+	0x0c, 0x10, 0x09, 0x20, 0x0a, 0x1c, 0x1e, 0x0d, 0x02, 0x03, 0x17, 0x10,
+	0x0d, 0x14, 0x04, 0x11, 0x0e, 0x03, 0x04, 0x04, 0x03, 0x22, 0x02, 0x03,
+	0x14, 0x0f, 0x02, 0x03, 0x18, 0x03, 0x13, 0x17, 0x04, 0x04, 0x11, 0x02,
+	0x22, 0x0b, 0x15, 0xff, 0x15, 0x10, 0x05, 0x0b, 0x0c, 0x10, 0x03, 0x12,
+	0x15, 0x03, 0x1c, 0x09, 0x12, 0x0c, 0x0c, 0x08, 0x0e, 0x1a, 0x05, 0x11,
+	0x11, 0x19, 0x13, 0x08, 0x08, 0x02, 0x01, 0x19, 0x0b, 0x07, 0x11, 0x02,
+	0x09, 0x13, 0x07, 0x10, 0x14, 0x19, 0x0a, 0x1a, 0x15, 0x09, 0x0b, 0x02,
+	0x04, 0x03, 0x0d, 0x02, 0x15, 0x0c, 0x03, 0x00, 0x04, 0x12, 0x12, 0x15,
+	0x07, 0x0e, 0x06, 0x02, 0x10, 0x0a, 0x05, 0x03, 0x0b, 0x0a, 0x18, 0x0c,
+	0x10, 0x06, 0x09, 0x00, 0x05, 0x03, 0x07, 0x08, 0x0a, 0x05, 0x03, 0x0a,
+	0x04, 0x07, 0x03, 0x15, 0x12, 0x0c, 0x0a, 0x0c, 0x0c, 0x0c, 0x08, 0x0b,
+	0x00, 0x01, 0x13, 0x14, 0x01, 0x0e, 0x0e, 0x01, 0x0d, 0x18, 0x0b, 0x09,
+	0x03, 0x08, 0x05, 0x0c, 0x0f, 0x04, 0x11, 0x11, 0x08, 0x05, 0x16, 0x05,
+	0x12, 0x10, 0x02, 0x0c, 0x0c, 0x07, 0x12, 0x0e, 0x1c, 0x06, 0x29, 0xfe,
+	0x0f, 0x0c, 0x0f, 0x04, 0x0f, 0x0f, 0x0a, 0x05, 0x0f, 0x05, 0x0c, 0x10,
+	0x04, 0x05, 0x03, 0x11, 0x13, 0x06, 0x16, 0x0b, 0x08, 0x0f, 0x02, 0x02,
+	0x07, 0x05, 0x16, 0x05, 0x02, 0x06, 0x0e, 0x08, 0x03, 0x0b, 0x0b, 0x16,
+	0x14, 0x0a, 0x0b, 0x07, 0x00, 0x01, 0x0d, 0x16, 0x0c, 0x0e, 0x0c, 0x02,
+	0x0c, 0x0d, 0x03, 0x18, 0x18, 0x04, 0x0a, 0x0e, 0x02, 0x1b, 0x1c, 0x0f,
+	0x02, 0x03, 0x12, 0x06, 0x02, 0x18, 0x07, 0x0c, 0x03, 0x03, 0x10, 0x00,
+	0x10, 0x01, 0x01, 0x03, 0x04, 0x05, 0x02, 0x03, 0x04, 0x13, 0x04, 0x13,
+	0x0b, 0x13, 0x05, 0x0a, 0x00, 0x29, 0x14, 0x00, 0x29, 0x1a, 0x29, 0x05,
+	0x17, 0x08, 0x11, 0x11, 0x18, 0x11, 0x14, 0x24, 0x49, 0x36, 0x04, 0x04,
+	0x28, 0x49, 0x03, 0x03, 0x13, 0x02, 0x02, 0x16, 0x02, 0x21, 0x0c, 0x1f,
+	0x16, 0x13, 0x1a, 0x2b, 0x01, 0x07, 0x03, 0x07, 0xff, 0x14, 0x19, 0x1a,
+	0x05, 0x19, 0x19, 0x06, 0x19, 0x07, 0x19, 0x19, 0x0b, 0x19, 0x19, 0x0f,
+	0x13, 0x19, 0x19, 0x19, 0x04, 0x04, 0x1b, 0x02, 0x14, 0x09, 0x11, 0x14,
+	0x10, 0x0f, 0x14, 0x14, 0x05, 0x08, 0x08, 0x08, 0x03, 0x08, 0x08, 0x21,
+	0x04, 0x25, 0x16, 0x00, 0x3c, 0x1b, 0x0a, 0x19, 0x0c, 0x02, 0x4b, 0x4b,
+	0x14, 0x03, 0x0b, 0x0e, 0x06, 0x1d, 0x17, 0x13, 0x06, 0x03, 0x24, 0x19,
+	0x03, 0x08, 0x13, 0x02, 0x05, 0x08, 0x15, 0x0f, 0x1a, 0x06, 0x0a, 0x00,
+	0x01, 0x17, 0x08, 0x0b, 0x11, 0x02, 0x09, 0x0c, 0x0b, 0x07, 0x04, 0x25,
+	0x16, 0x07, 0x1c, 0x04, 0x23, 0x1b, 0x22, 0x02, 0x1b, 0x04, 0x2d, 0x06,
+	0x0a, 0x03, 0x05, 0x07, 0x0a, 0x02, 0x03, 0x0d, 0x12, 0x0b, 0x0c, 0x03,
+	0x0e, 0x05, 0x0e, 0x0f, 0x03, 0x00, 0x04, 0x06, 0x1b, 0x15, 0x0d, 0x08,
+	0x28, 0x14, 0x03, 0x14, 0xf6, 0x04, 0x0c, 0x0a, 0x02, 0x1e, 0x16, 0x0d,
+	0x17, 0x08, 0x08, 0x06, 0x03, 0x0e, 0x03, 0x04, 0x16, 0x0e, 0x00, 0x16,
+	0x16, 0x04, 0x08, 0x07, 0x0f, 0x11, 0x13, 0x02, 0x02, 0x04, 0x04, 0x0e,
+	0x02, 0x01, 0x0e, 0x0e, 0x0e, 0x09, 0x0e, 0x06, 0x03, 0x07, 0x03, 0x04,
+	0x04, 0x03, 0x0f, 0x19, 0x27, 0x04, 0x06, 0x06, 0x0d, 0x01, 0x06, 0x03,
+	0x13, 0x05, 0x08, 0x04, 0x02, 0x0d, 0x0f, 0x07, 0x03, 0x13, 0x05, 0x09,
+	0x10, 0x07, 0x05, 0x0e, 0x05, 0x0b, 0x03, 0x04, 0x09, 0x09, 0x03, 0x0a,
+	0x09, 0x05, 0x0a, 0x03, 0x08, 0x0b, 0x06, 0x1f, 0x05, 0x29, 0x09, 0x06,
+	0x28, 0x15, 0x05, 0x0a, 0x08, 0x02, 0x09, 0x02, 0x03, 0x0c, 0x08, 0x03,
+	0x04, 0x0e, 0x12, 0x04, 0x04, 0x17, 0x12, 0x08, 0x04, 0x04, 0x15, 0x10,
+	0x15, 0x03, 0x07, 0x01, 0x07, 0xff, 0x04, 0x1a, 0x0c, 0x0b, 0x05, 0x05,
+	0x11, 0x01, 0x09, 0x07, 0x04, 0x06, 0x04, 0x03, 0x11, 0x15, 0x0e, 0x0c,
+	0x05, 0x08, 0x06, 0x0d, 0x0e, 0x02, 0x0a, 0x0a, 0x05, 0x06, 0x0c, 0x15,
+	0x10, 0x07, 0x2d, 0x1b, 0x1c, 0x1d, 0x02, 0x2c, 0x05, 0x08, 0x12, 0x09,
+	0x17, 0x15, 0x0e, 0x17, 0x1e, 0x02, 0x0f, 0x17, 0x01, 0x11, 0x0b, 0x16,
+	0x0c, 0x07, 0x07, 0x08, 0x0c, 0x08, 0x07, 0x03, 0x13, 0x02, 0x02, 0x13,
+	0x02, 0x0a, 0x17, 0x07, 0x03, 0x16, 0x02, 0x19, 0x03, 0x06, 0x04, 0x02,
+	0x07, 0x08, 0x02, 0x0b, 0x0c, 0x08, 0x03, 0x18, 0x0c, 0x02, 0x0d, 0x05,
+	0x0a, 0x02, 0x04, 0x12, 0x05, 0x18, 0x0c, 0x0f, 0x03, 0x04, 0x05, 0x01,
+	0x0f, 0x1b, 0x1c, 0x10, 0x0f, 0x0d, 0x10, 0x03, 0x0b, 0x10, 0x1e, 0x16,
+	0x00, 0x25, 0x09, 0x05, 0x09, 0x20, 0x13, 0x10, 0x0b, 0x13, 0x0d, 0x02,
+	0x03, 0xff, 0x10, 0x08, 0x02, 0x0d, 0x02, 0x04, 0x03, 0x1f, 0x12, 0x03,
+	0x03, 0x07, 0x06, 0x1f, 0x03, 0x0a, 0x18, 0x05, 0x0e, 0x00, 0x08, 0x15,
+	0x18, 0x07, 0x07, 0x16, 0x11, 0x10, 0x04, 0x09, 0x05, 0x02, 0x0d, 0x04,
+	0x0f, 0x04, 0x0a, 0x05, 0x03, 0x17, 0x02, 0x11, 0x08, 0x08, 0x01, 0x03,
+	0x02, 0x08, 0x03, 0x02, 0x03, 0x16, 0x09, 0x02, 0x04, 0x0e, 0x0e, 0x0b,
+	0x03, 0x09, 0x10, 0x15, 0x0e, 0x0e, 0x11, 0x17, 0x09, 0x09, 0x0c, 0x00,
+	0x01, 0x09, 0x12, 0x0d, 0x0c, 0x06, 0x05, 0x03, 0x06, 0x0f, 0x0a, 0x05,
+	0x05, 0x08, 0x06, 0x07, 0x07, 0x02, 0x07, 0x10, 0x06, 0x0e, 0x04, 0x06,
+	0x08, 0x04, 0x17, 0x04, 0x34, 0x07, 0x04, 0x15, 0x04, 0x0b, 0x03, 0x10,
+	0x0d, 0x10, 0x10, 0x0b, 0x05, 0x0f, 0x00, 0x13, 0x0a, 0x16, 0x0b, 0x0f,
+	0x01, 0x05, 0x11, 0x0b, 0x09, 0x09, 0x0d, 0x06, 0x19, 0x95, 0x15, 0x06,
+	0x0f, 0x18, 0x05, 0x20, 0x0a, 0x12, 0x0d, 0x02, 0x17, 0x01, 0x03, 0x0c,
+	0x06, 0x10, 0x02, 0x29, 0x05, 0x04, 0x0d, 0x02, 0x0d, 0xff, 0x05, 0x12,
+	0x11, 0x02, 0x0b, 0x06, 0x09, 0x03, 0x13, 0x12, 0x07, 0x14, 0x0e, 0x13,
+	0x06, 0x1d, 0x05, 0x08, 0x11, 0x1e, 0x05, 0x04, 0x0d, 0x02, 0x0f, 0x0d,
+	0x0d, 0x05, 0x0b, 0x0b, 0x06, 0x07, 0x0a, 0x0d, 0x14, 0x07, 0x16, 0x0d,
+	0x05, 0x07, 0x1b, 0x07, 0x0c, 0x10, 0x04, 0x05, 0x06, 0x0c, 0x03, 0x09,
+	0x11, 0x0e, 0x1c, 0x07, 0x05, 0x0b, 0x06, 0x14, 0x08, 0x04, 0x05, 0x0b,
+	0x17, 0x02, 0x0b, 0x05, 0x05, 0x05, 0x09, 0x05, 0x0a, 0x02, 0x02, 0x04,
+	0x0a, 0x0a, 0x0a, 0x08, 0x04, 0x16, 0x1b, 0x02, 0x07, 0x0b, 0x05, 0x03,
+	0x17, 0x02, 0x10, 0x0f, 0x02, 0x09, 0x05, 0x17, 0x07, 0x04, 0x06, 0x01,
+	0x04, 0x0b, 0x09, 0x02, 0x16, 0x14, 0x0a, 0x03, 0x0d, 0x07, 0x1c, 0x03,
+	0x0b, 0x09, 0x09, 0x0b, 0x04, 0x1f, 0x0b, 0x13, 0x13, 0x11, 0x4b, 0x4b,
+	0x14, 0x0b, 0x13, 0x0f, 0x05, 0xff, 0x05, 0x13, 0x13, 0x13, 0x18, 0x06,
+	0x0e, 0x0f, 0x0e, 0x07, 0x17, 0x04, 0x19, 0x06, 0x08, 0x1a, 0x0f, 0x0f,
+	0x0f, 0x05, 0x07, 0x0b, 0x0b, 0x08, 0x02, 0x46, 0x07, 0x03, 0x1a, 0x1d,
+	0x19, 0x06, 0x11, 0x05, 0x0d, 0x03, 0x07, 0x03, 0x02, 0x0c, 0x05, 0x10,
+	0x11, 0x0e, 0x05, 0x16, 0x17, 0x0d, 0x09, 0x1b, 0x13, 0x06, 0x11, 0x19,
+	0x07, 0x09, 0x0b, 0x1a, 0x0f, 0x08, 0x04, 0x20, 0x17, 0x00, 0x25, 0x08,
+	0x04, 0x0b, 0x17, 0x25, 0x4a, 0x02, 0x03, 0x0e, 0x1e, 0x0f, 0x0d, 0x03,
+	0x11, 0x05, 0x25, 0x0a, 0x11, 0x06, 0x1c, 0x01, 0x03, 0x11, 0x06, 0x09,
+	0x0e, 0x04, 0x03, 0x15, 0x0b, 0x21, 0x0d, 0x0b, 0x06, 0x09, 0x00, 0x01,
+	0x1a, 0x08, 0x07, 0x17, 0x0b, 0x08, 0x02, 0x02, 0x1b, 0x05, 0x0d, 0x03,
+	0x02, 0x02, 0x09, 0x02, 0x08, 0x09, 0x0c, 0x0a, 0x0c, 0x0b, 0x0c, 0x05,
+	0x08, 0xff, 0x00, 0x01, 0x07, 0x08, 0x07, 0x10, 0x15, 0x1a, 0x02, 0x03,
+	0x0d, 0x10, 0x08, 0x0a, 0x08, 0x04, 0x04, 0x03, 0x04, 0x07, 0x09, 0x06,
+	0x02, 0x0a, 0x02, 0x0e, 0x08, 0x02, 0x02, 0x03, 0x02, 0x21, 0x07, 0x04,
+	0x0b, 0x1b, 0x05, 0x0e, 0x0b, 0x0d, 0x0c, 0x12, 0x11, 0x0a, 0x03, 0x07,
+	0x0e, 0x0a, 0x03, 0x03, 0x03, 0x01, 0x0f, 0x02, 0x0e, 0x02, 0x03, 0x09,
+	0x13, 0x02, 0x10, 0x04, 0x09, 0x03, 0x0c, 0x02, 0x07, 0x0c, 0x1c, 0x07,
+	0x06, 0x10, 0x05, 0x02, 0x0e, 0x0b, 0x13, 0x10, 0x0e, 0x0c, 0x0c, 0x0f,
+	0x13, 0x1b, 0x0c, 0x0d, 0x10, 0x0d, 0x02, 0x02, 0x09, 0x02, 0x03, 0x0c,
+	0x11, 0x02, 0x03, 0x05, 0x0a, 0x03, 0x07, 0x12, 0x0d, 0x12, 0x07, 0x15,
+	0x06, 0x12, 0x0b, 0x02, 0x16, 0x0a, 0x11, 0x0b, 0x0d, 0x01, 0x13, 0x0f,
+	0x0b, 0x03, 0x09, 0x0e, 0x0a, 0x04, 0x05, 0x1c, 0x0a, 0xc4, 0x0c, 0x05,
+	0x15, 0x09, 0x07, 0x00, 0x02, 0x05, 0x04, 0x01, 0x1d, 0x04, 0x0d, 0x09,
+	0x05, 0x03, 0x07, 0x16, 0x07, 0x1d, 0x05, 0x46, 0x0d, 0x02, 0x10, 0x0a,
+	0x0a, 0x08, 0x08, 0x18, 0x18, 0x03, 0x11, 0x03, 0x04, 0x08, 0x01, 0x06,
+	0x12, 0x17, 0x04, 0x1a, 0x12, 0x08, 0x05, 0x14, 0x05, 0x11, 0x14, 0x02,
+	0x0b, 0x0b, 0x06, 0x07, 0x0c, 0x18, 0x0f, 0x05, 0x08, 0x00, 0x01, 0x07,
+	0x08, 0x0e, 0x11, 0x03, 0x03, 0x0a, 0x01, 0x0a, 0xff, 0x07, 0x0a, 0x09,
+	0x08, 0x08, 0x07, 0x09, 0x09, 0x05, 0x04, 0x0b, 0x14, 0x02, 0x10, 0x0a,
+	0x0d, 0x03, 0x10, 0x07, 0x00, 0x09, 0x03, 0x09, 0x0a, 0x0e, 0x0e, 0x0e,
+	0x07, 0x09, 0x00, 0x01, 0x0e, 0x14, 0x12, 0x1e, 0x0f, 0x05, 0x0c, 0x0b,
+	0x19, 0x11, 0x0c, 0x02, 0x02, 0x04, 0x12, 0x0c, 0x02, 0x1a, 0x0e, 0x04,
+	0x05, 0x00, 0x09, 0x11, 0x06, 0x03, 0x0a, 0x02, 0x13, 0x01, 0x03, 0x05,
+	0x11, 0x0c, 0x06, 0x09, 0x07, 0x01, 0x22, 0x08, 0x17, 0x0b, 0x17, 0x0a,
+	0x04, 0x0c, 0x02, 0x19, 0x0d, 0x04, 0x01, 0x0b, 0x02, 0x02, 0x11, 0x05,
+	0x03, 0x04, 0x11, 0x05, 0x0e, 0x02, 0x02, 0x04, 0x0b, 0x0b, 0x0b, 0x08,
+	0x04, 0x24, 0x04, 0x06, 0x12, 0x04, 0x0d, 0x10, 0x11, 0x08, 0x14, 0x13,
+	0x09, 0x09, 0x10, 0x09, 0x4d, 0x16, 0x04, 0x09, 0x11, 0x04, 0x05, 0x12,
+	0x0d, 0x02, 0x06, 0x08, 0xff, 0x0c, 0x03, 0x01, 0x04, 0x17, 0x25, 0x04,
+	0x0d, 0x06, 0x0d, 0x19, 0x02, 0x04, 0x03, 0x11, 0x02, 0x0b, 0x09, 0x13,
+	0x17, 0x04, 0x18, 0x0d, 0x05, 0x14, 0x12, 0x03, 0x0f, 0x06, 0x10, 0x0a,
+	0x02, 0x02, 0x0d, 0x05, 0x03, 0x04, 0x17, 0x05, 0x13, 0x02, 0x02, 0x04,
+	0x17, 0x10, 0x0f, 0x08, 0x04, 0x08, 0x0d, 0x11, 0x04, 0x04, 0x06, 0x08,
+	0x16, 0x0c, 0x0f, 0x12, 0x06, 0x1a, 0x08, 0x00, 0x0a, 0x03, 0x1d, 0x03,
+	0x13, 0x0b, 0x0f, 0x01, 0x03, 0x12, 0x1e, 0x07, 0x04, 0x05, 0x02, 0x07,
+	0x06, 0x07, 0x05, 0x05, 0x01, 0x0f, 0x0c, 0x0f, 0x03, 0x10, 0x0c, 0x0a,
+	0x07, 0x06, 0x05, 0x11, 0x0f, 0x05, 0x03, 0x08, 0x02, 0x02, 0x03, 0x02,
+	0x0a, 0x0b, 0x14, 0x0b, 0x0d, 0x03, 0x0f, 0x06, 0x0b, 0x0d, 0x03, 0x03,
+	0x03, 0x01, 0x03, 0x06, 0x01, 0x22, 0x34, 0x07, 0x0a, 0x05, 0x06, 0x09,
+	0xff, 0x08, 0x0e, 0x15, 0x07, 0x15, 0x0f, 0x0f, 0x08, 0x0a, 0x05, 0x10,
+	0x07, 0x03, 0x0e, 0x04, 0x0f, 0x1b, 0x07, 0x3e, 0x05, 0x02, 0x0f, 0x08,
+	0x09, 0x18, 0x02, 0x02, 0x04, 0x14, 0x0d, 0x0f, 0x0c, 0x04, 0x18, 0x11,
+	0x10, 0x03, 0x08, 0x0b, 0x02, 0x18, 0x07, 0x02, 0x22, 0x0a, 0x14, 0x04,
+	0x0f, 0x19, 0x06, 0x08, 0x0f, 0x0a, 0x10, 0x02, 0x02, 0x04, 0x01, 0x04,
+	0x02, 0x0c, 0x03, 0x0d, 0x08, 0x13, 0x02, 0x14, 0x02, 0x06, 0x07, 0x08,
+	0x07, 0x03, 0x19, 0x07, 0x08, 0x00, 0x06, 0x05, 0x16, 0x11, 0x0e, 0x08,
+	0x04, 0x07, 0x21, 0x04, 0x08, 0x05, 0x06, 0x05, 0x09, 0x06, 0x17, 0x05,
+	0x49, 0x07, 0x16, 0x1c, 0x04, 0x12, 0x03, 0x09, 0x15, 0x06, 0x05, 0x03,
+	0x02, 0x11, 0x03, 0x18, 0x13, 0x05, 0x1c, 0x10, 0x06, 0x06, 0x0f, 0x13,
+	0x05, 0x0c, 0x08, 0x07, 0x15, 0x00, 0x0c, 0x06, 0xff, 0x0c, 0x09, 0x09,
+	0x0b, 0x03, 0x03, 0x12, 0x08, 0x02, 0x17, 0x02, 0x0a, 0x09, 0x0e, 0x01,
+	0x03, 0x0e, 0x17, 0x07, 0x24, 0x1d, 0x25, 0x02, 0x03, 0x07, 0x10, 0x19,
+	0x0b, 0x0a, 0x0b, 0x1a, 0x05, 0x03, 0x0c, 0x08, 0x1f, 0x09, 0x1b, 0x1d,
+	0x04, 0x02, 0x02, 0x06, 0x03, 0x15, 0x16, 0x05, 0x06, 0x03, 0x14, 0x0a,
+	0x06, 0x05, 0x08, 0x15, 0x02, 0x03, 0x04, 0x09, 0x18, 0x01, 0x17, 0x05,
+	0x05, 0x06, 0x08, 0x09, 0x04, 0x09, 0x07, 0x10, 0x07, 0x18, 0x06, 0x0f,
+	0x05, 0x04, 0x22, 0x14, 0x16, 0x12, 0x02, 0x17, 0x05, 0x02, 0x04, 0x1e,
+	0x02, 0x04, 0x04, 0x02, 0x04, 0x29, 0x02, 0x04, 0x04, 0x02, 0x04, 0x35,
+	0x02, 0x04, 0x19, 0x02, 0x04, 0x21, 0x02, 0x04, 0x06, 0x02, 0x04, 0x17,
+	0x02, 0x04, 0x04, 0x02, 0x04, 0x14, 0x02, 0x04, 0x04, 0x02, 0x04, 0x21,
+	0x02, 0x04, 0x04, 0x02, 0xf1, 0x04, 0x15, 0x02, 0x04, 0x04, 0x02, 0x04,
+	0x3f, 0x02, 0x03, 0x07, 0x06, 0x11, 0x03, 0x04, 0x06, 0x19, 0x02, 0x24,
+	0x23, 0x0e, 0x00, 0x3c, 0x15, 0x0b, 0x0a, 0x0f, 0x0c, 0x13, 0x0d, 0x05,
+	0x01, 0x0c, 0x17, 0x03, 0x1c, 0x00, 0x04, 0x1d, 0x03, 0x1a, 0x1c, 0x04,
+	0x09, 0x0c, 0x05, 0x05, 0x04, 0x05, 0x1c, 0x05, 0x03, 0x01, 0x06, 0x0d,
+	0x03, 0x1c, 0x1f, 0x02, 0x09, 0x01, 0x0b, 0x02, 0x0a, 0x0e, 0x09, 0x05,
+	0x3f, 0x2b, 0x4b, 0x4b, 0x00, 0x41, 0x04, 0x01, 0x05, 0x0b, 0x14, 0x0c,
+	0x09, 0x04, 0x0f, 0x0e, 0x0d, 0x13, 0x0f, 0x07, 0x00, 0x28, 0x07, 0x04,
+	0x08, 0x05, 0x08, 0x15, 0x17, 0x13, 0x05, 0x24, 0x0c, 0x03, 0x0d, 0x07,
+	0x14, 0x0b, 0x07, 0x27, 0x01, 0x0f, 0x0e, 0x17, 0x17, 0x09, 0x01, 0x09,
+	0xff, 0x28, 0x09, 0x13, 0x0d, 0x0b, 0x03, 0x05, 0x08, 0x0a, 0x1b, 0x03,
+	0x2e, 0x0b, 0x12, 0x05, 0x07, 0x13, 0x11, 0x07, 0x02, 0x06, 0x02, 0x09,
+	0x02, 0x04, 0x05, 0x2d, 0x05, 0x13, 0x07, 0x06, 0x03, 0x0f, 0x06, 0x02,
+	0x15, 0x05, 0x08, 0x04, 0x22, 0x05, 0x0a, 0x08, 0x02, 0x10, 0x02, 0x05,
+	0x03, 0x1d, 0x08, 0x0e, 0x00, 0x17, 0x07, 0x17, 0x07, 0x13, 0x08, 0x11,
+	0x16, 0x04, 0x03, 0x15, 0x0d, 0x18, 0x04, 0x0f, 0x05, 0x0a, 0x06, 0x02,
+	0x13, 0x08, 0x06, 0x02, 0x23, 0x10, 0x07, 0x0a, 0x11, 0x0c, 0x10, 0x0a,
+	0x05, 0x0b, 0x02, 0x04, 0x0b, 0x0b, 0x03, 0x06, 0x04, 0x11, 0x01, 0x04,
+	0x04, 0x07, 0x07, 0x02, 0x04, 0x07, 0x05, 0x03, 0x12, 0x02, 0x0d, 0x07,
+	0x03, 0x03, 0x10, 0x05, 0x02, 0x11, 0x01, 0x03, 0x19, 0x04, 0x0c, 0x07,
+	0x02, 0x01, 0x0b, 0x0b, 0x07, 0x0d, 0x13, 0x28, 0xff, 0x0e, 0x04, 0x0b,
+	0x01, 0x09, 0x01, 0x0c, 0x01, 0x03, 0x0c, 0x04, 0x44, 0x47, 0x12, 0x33,
+	0x04, 0x0f, 0x0f, 0x02, 0x02, 0x2c, 0x10, 0x15, 0x02, 0x02, 0x25, 0x18,
+	0x06, 0x17, 0x14, 0x16, 0x03, 0x07, 0x16, 0x12, 0x04, 0x04, 0x09, 0x0b,
+	0x02, 0x03, 0x04, 0x17, 0x04, 0x03, 0x03, 0x04, 0x34, 0x08, 0x08, 0x08,
+	0x04, 0x01, 0x16, 0x06, 0x03, 0x15, 0x0c, 0x0c, 0x20, 0x05, 0x05, 0x0c,
+	0x11, 0x02, 0x1d, 0x17, 0x0b, 0x06, 0x0c, 0x1a, 0x2d, 0x0c, 0x0c, 0x06,
+	0x06, 0x11, 0x0a, 0x1b, 0x10, 0x04, 0x10, 0x01, 0x04, 0x39, 0x72, 0x48,
+	0x38, 0x04, 0x11, 0x11, 0x0c, 0x08, 0x11, 0x05, 0x12, 0x0b, 0x13, 0x22,
+	0x04, 0x02, 0x04, 0x00, 0x05, 0x06, 0x07, 0x05, 0x1f, 0x3a, 0x73, 0x10,
+	0x3b, 0x0f, 0x74, 0x40, 0x12, 0x20, 0x0a, 0x0d, 0x0c, 0x19, 0x12, 0x02,
+	0x23, 0x1a, 0x1d, 0x07, 0xdd, 0x13, 0x06, 0x14, 0x15, 0x04, 0x08, 0x19,
+	0x16, 0x03, 0x09, 0x02, 0x0b, 0x08, 0x02, 0x0c, 0x07, 0x1d, 0x20, 0x09,
+	0x05, 0x02, 0x26, 0x23, 0x0d, 0x10, 0x0c, 0x09, 0x0d, 0x1c, 0x09, 0x10,
+	0x07, 0x0e, 0x03, 0x05, 0x08, 0x07, 0x41, 0x0e, 0x00, 0x41, 0x2c, 0x41,
+	0x12, 0x12, 0x0b, 0x09, 0x0f, 0x11, 0x0c, 0x35, 0x04, 0x20, 0x22, 0x21,
+	0x20, 0x06, 0x14, 0x06, 0x2c, 0x14, 0x10, 0x0f, 0x1a, 0x16, 0x05, 0x08,
+	0x08, 0x08, 0x03, 0x08, 0x08, 0x03, 0x25, 0x2d, 0x16, 0x16, 0x05, 0x16,
+	0x0d, 0x16, 0x16, 0x09, 0x16, 0x16, 0x0f, 0x16, 0x1c, 0x17, 0x16, 0x24,
+	0x17, 0x24, 0x02, 0x24, 0xff, 0x2a, 0x06, 0x1e, 0x03, 0x06, 0x0d, 0x1c,
+	0x11, 0x1c, 0x1c, 0x18, 0x03, 0x1c, 0x1c, 0x07, 0x07, 0x04, 0x07, 0x07,
+	0x07, 0x19, 0x1e, 0x1e, 0x05, 0x08, 0x22, 0x17, 0x1b, 0x21, 0x09, 0x01,
+	0x0d, 0x01, 0x20, 0x00, 0x3e, 0x1f, 0x0f, 0x0e, 0x0b, 0x29, 0x0e, 0x0b,
+	0x1f, 0x05, 0x05, 0x04, 0x20, 0x02, 0x0e, 0x02, 0x28, 0x03, 0x13, 0x0f,
+	0x0b, 0x08, 0x0f, 0x02, 0x07, 0x27, 0x07, 0x31, 0x34, 0x34, 0x34, 0x00,
+	0x34, 0x04, 0x01, 0x05, 0x2e, 0x10, 0x12, 0x03, 0x13, 0x0c, 0x0d, 0x14,
+	0x04, 0x36, 0x29, 0x12, 0x02, 0x23, 0x04, 0x14, 0x04, 0x07, 0x02, 0x13,
+	0x1f, 0x02, 0x01, 0x05, 0x10, 0x13, 0x13, 0x13, 0x00, 0x13, 0x04, 0x01,
+	0x2f, 0x06, 0x20, 0x11, 0x1f, 0x0b, 0x0f, 0x1d, 0x0f, 0x13, 0x04, 0x08,
+	0x07, 0x10, 0x10, 0x04, 0x11, 0x05, 0x05, 0x19, 0x02, 0x1c, 0x05, 0x1f,
+	0xff, 0x0a, 0x04, 0x05, 0x04, 0x04, 0x1d, 0x19, 0x01, 0x06, 0x04, 0x0f,
+	0x1d, 0x1f, 0x09, 0x39, 0x07, 0x30, 0x11, 0x04, 0x02, 0x02, 0x08, 0x02,
+	0x0d, 0x0c, 0x1e, 0x0f, 0x12, 0x0e, 0x09, 0x07, 0x05, 0x04, 0x04, 0x0a,
+	0x06, 0x03, 0x10, 0x07, 0x04, 0x01, 0x07, 0x07, 0x08, 0x0e, 0x04, 0x03,
+	0x15, 0x02, 0x0a, 0x0d, 0x0d, 0x14, 0x14, 0x0e, 0x0b, 0x06, 0x02, 0x09,
+	0x0e, 0x0d, 0x13, 0x0d, 0x0c, 0x0f, 0x06, 0x02, 0x08, 0x0d, 0x0d, 0x03,
+	0x0a, 0x0a, 0x0c, 0x04, 0x14, 0x05, 0x05, 0x09, 0x02, 0x0c, 0x30, 0x0b,
+	0x31, 0x0c, 0x05, 0x2d, 0x4f, 0x09, 0x34, 0x04, 0x15, 0x0d, 0x12, 0x03,
+	0x13, 0x12, 0x04, 0x02, 0x16, 0x06, 0x0d, 0x09, 0x13, 0x0d, 0x18, 0x16,
+	0x00, 0x48, 0x0c, 0x44, 0x01, 0x3c, 0x49, 0x3b, 0x03, 0x17, 0x0a, 0x1a,
+	0x03, 0x1e, 0x0d, 0x19, 0x15, 0x07, 0x01, 0x1c, 0xff, 0x06, 0x05, 0x08,
+	0x10, 0x15, 0x2a, 0x07, 0x08, 0x04, 0x06, 0x13, 0x07, 0x12, 0x00, 0x2b,
+	0x18, 0x0a, 0x0b, 0x24, 0x14, 0x24, 0x02, 0x01, 0x03, 0x02, 0x15, 0x15,
+	0x15, 0x05, 0x04, 0x01, 0x05, 0x0d, 0x1f, 0x02, 0x2c, 0x03, 0x0e, 0x01,
+	0x02, 0x11, 0x16, 0x24, 0x06, 0x05, 0x13, 0x02, 0x1b, 0x15, 0x15, 0x3b,
+	0x06, 0x1a, 0x14, 0x0e, 0x08, 0x3a, 0x23, 0x03, 0x0b, 0x04, 0x01, 0x17,
+	0x0b, 0x07, 0x00, 0x04, 0x25, 0x07, 0x12, 0x21, 0x08, 0x0c, 0x0e, 0x04,
+	0x10, 0x08, 0x12, 0x01, 0x0d, 0x06, 0x05, 0x1c, 0x13, 0x0d, 0x06, 0x11,
+	0x08, 0x0b, 0x01, 0x03, 0x09, 0x03, 0x0f, 0x0e, 0x0e, 0x03, 0x02, 0x03,
+	0x08, 0x1c, 0x08, 0x0c, 0x0a, 0x0a, 0x03, 0x03, 0x02, 0x05, 0x02, 0x07,
+	0x15, 0x03, 0x08, 0x06, 0x09, 0x0e, 0x10, 0x08, 0x09, 0x04, 0x03, 0x02,
+	0x0d, 0x08, 0x0e, 0x01, 0xff, 0x0e, 0x06, 0x05, 0x2d, 0x13, 0x0a, 0x05,
+	0x02, 0x04, 0x18, 0x1c, 0x40, 0x4f, 0x29, 0x03, 0x1c, 0x05, 0x01, 0x06,
+	0x09, 0x0e, 0x02, 0x14, 0x02, 0x0e, 0x15, 0x24, 0x05, 0x20, 0x12, 0x00,
+	0x02, 0x1b, 0x08, 0x15, 0x12, 0x14, 0x0c, 0x15, 0x04, 0x0d, 0x08, 0x17,
+	0x0e, 0x07, 0x09, 0x03, 0x06, 0x19, 0x01, 0x05, 0x1a, 0x19, 0x07, 0x0b,
+	0x1d, 0x05, 0x0a, 0x0c, 0x08, 0x02, 0x0e, 0x08, 0x07, 0x0f, 0x0d, 0x0d,
+	0x09, 0x07, 0x06, 0x08, 0x12, 0x03, 0x42, 0x05, 0x06, 0x0b, 0x04, 0x01,
+	0x06, 0x02, 0x10, 0x09, 0x11, 0x00, 0x07, 0x03, 0x00, 0x13, 0x05, 0x13,
+	0x0d, 0x00, 0x02, 0x0f, 0x08, 0x09, 0x09, 0x11, 0x10, 0x0c, 0x04, 0x07,
+	0x10, 0x0c, 0x00, 0x0d, 0x0e, 0x08, 0x05, 0x01, 0x1a, 0x04, 0x09, 0x05,
+	0x05, 0x02, 0x08, 0x1f, 0x0c, 0x08, 0x09, 0x06, 0x01, 0x0b, 0x15, 0x0f,
+	0xff, 0x02, 0x08, 0x15, 0x06, 0x0e, 0x07, 0x02, 0x17, 0x4d, 0x1b, 0x1b,
+	0x28, 0x47, 0x4e, 0x1d, 0x07, 0x01, 0x08, 0x20, 0x0b, 0x0b, 0x03, 0x0d,
+	0x0e, 0x11, 0x03, 0x1d, 0x17, 0x1a, 0x17, 0x07, 0x03, 0x04, 0x05, 0x0a,
+	0x19, 0x04, 0x05, 0x04, 0x08, 0x04, 0x04, 0x03, 0x15, 0x08, 0x28, 0x1a,
+	0x0e, 0x01, 0x28, 0x06, 0x0b, 0x04, 0x0f, 0x03, 0x1c, 0x10, 0x23, 0x1d,
+	0x0b, 0x0c, 0x0d, 0x11, 0x1f, 0x1d, 0x00, 0x28, 0x12, 0x05, 0x0c, 0x15,
+	0x1f, 0x16, 0x0f, 0x16, 0x0d, 0x10, 0x04, 0x07, 0x32, 0x12, 0x0b, 0x16,
+	0x07, 0x06, 0x2b, 0x06, 0x07, 0x0a, 0x15, 0x05, 0x03, 0x18, 0x0f, 0x02,
+	0x0e, 0x0c, 0x03, 0x13, 0x04, 0x17, 0x0c, 0x10, 0x0f, 0x04, 0x0d, 0x08,
+	0x03, 0x0f, 0x06, 0x0c, 0x0f, 0x48, 0x48, 0x0a, 0x09, 0x0a, 0x0c, 0x10,
+	0x04, 0x01, 0x03, 0x0c, 0x03, 0x0b, 0x0f, 0x11, 0xff, 0x03, 0x02, 0x03,
+	0x10, 0x06, 0x04, 0x12, 0x02, 0x04, 0x04, 0x09, 0x0f, 0x03, 0x03, 0x08,
+	0x07, 0x15, 0x01, 0x11, 0x04, 0x08, 0x05, 0x09, 0x19, 0x19, 0x09, 0x06,
+	0x0d, 0x00, 0x05, 0x03, 0x02, 0x07, 0x0b, 0x13, 0x07, 0x0e, 0x0c, 0x05,
+	0x0f, 0x05, 0x0f, 0x03, 0x0a, 0x06, 0x06, 0x07, 0x02, 0x02, 0x04, 0x07,
+	0x0a, 0x15, 0x0a, 0x05, 0x03, 0x04, 0x01, 0x03, 0x19, 0x1a, 0x1a, 0x08,
+	0x2b, 0x08, 0x02, 0x07, 0x10, 0x4d, 0x0c, 0x0a, 0x04, 0x04, 0x11, 0x06,
+	0x07, 0x14, 0x0d, 0x02, 0x03, 0x01, 0x03, 0x05, 0x03, 0x08, 0x06, 0x03,
+	0x07, 0x15, 0x10, 0x02, 0x11, 0x28, 0x0c, 0x13, 0x07, 0x08, 0x0a, 0x0c,
+	0x0c, 0x04, 0x06, 0x09, 0x05, 0x09, 0x1b, 0x15, 0x03, 0x1f, 0x1d, 0x26,
+	0x09, 0x0b, 0x1a, 0x20, 0x06, 0x01, 0x07, 0x14, 0x09, 0x10, 0x03, 0x05,
+	0x0a, 0x12, 0x14, 0x0a, 0xff, 0x0a, 0x0a, 0x06, 0x01, 0x07, 0x0b, 0x15,
+	0x07, 0x11, 0x14, 0x0e, 0x19, 0x06, 0x0f, 0x0c, 0x09, 0x0e, 0x09, 0x04,
+	0x0d, 0x05, 0x0a, 0x12, 0x04, 0x15, 0x08, 0x0b, 0x02, 0x02, 0x06, 0x15,
+	0x0b, 0x16, 0x0c, 0x0c, 0x09, 0x0c, 0x07, 0x0c, 0x0c, 0x04, 0x0b, 0x0b,
+	0x12, 0x04, 0x05, 0x05, 0x06, 0x0b, 0x16, 0x08, 0x08, 0x1c, 0x16, 0x05,
+	0x06, 0x03, 0x04, 0x10, 0x08, 0x16, 0x03, 0x04, 0x0c, 0x0e, 0x07, 0x03,
+	0x04, 0x0b, 0x09, 0x0b, 0x07, 0x02, 0x0e, 0x07, 0x0d, 0x13, 0x04, 0x13,
+	0x1a, 0x1a, 0x0b, 0x0c, 0x11, 0x06, 0x09, 0x03, 0x04, 0x0d, 0x04, 0x04,
+	0x0e, 0x03, 0x10, 0x0f, 0x06, 0x05, 0x15, 0x07, 0x03, 0x04, 0x12, 0x1c,
+	0x04, 0x04, 0x03, 0x04, 0x16, 0x19, 0x17, 0x0e, 0x07, 0x0a, 0x14, 0x19,
+	0x06, 0x01, 0x0a, 0x0a, 0x0d, 0x17, 0x03, 0x11, 0x17, 0x12, 0x0a, 0x03,
+	0xff, 0x04, 0x12, 0x0c, 0x04, 0x05, 0x03, 0x08, 0x10, 0x06, 0x05, 0x12,
+	0x07, 0x03, 0x04, 0x0b, 0x12, 0x04, 0x04, 0x03, 0x04, 0x02, 0x0e, 0x11,
+	0x0d, 0x0c, 0x0a, 0x10, 0x10, 0x06, 0x01, 0x13, 0x08, 0x10, 0x12, 0x0d,
+	0x08, 0x03, 0x04, 0x17, 0x0d, 0x02, 0x0c, 0x0e, 0x03, 0x00, 0x07, 0x13,
+	0x05, 0x1d, 0x1e, 0x09, 0x09, 0x14, 0x04, 0x05, 0x09, 0x03, 0x07, 0x16,
+	0x07, 0x0b, 0x12, 0x0d, 0x03, 0x08, 0x0a, 0x0d, 0x02, 0x06, 0x0a, 0x03,
+	0x00, 0x0d, 0x0a, 0x05, 0x0c, 0x0d, 0x09, 0x1a, 0x0c, 0x0c, 0x05, 0x2b,
+	0x07, 0x0b, 0x0b, 0x02, 0x07, 0x0f, 0x0c, 0x03, 0x1d, 0x04, 0x0a, 0x1b,
+	0x0e, 0x05, 0x06, 0x31, 0x10, 0x02, 0x17, 0x0f, 0x15, 0x14, 0x00, 0x42,
+	0x03, 0x1d, 0x07, 0x07, 0x0a, 0x01, 0x1a, 0x0b, 0x11, 0x07, 0x1d, 0x0f,
+	0x0d, 0x03, 0x05, 0x7c, 0x0d, 0x0d, 0x00, 0x19, 0xbb, 0x14, 0x06, 0x06,
+	0x39, 0x19, 0x1b, 0x0f, 0x05, 0x35, 0x05, 0x21, 0x18, 0x0a, 0x13, 0x0a,
+	0x0a, 0x03, 0x0b, 0x08, 0x76, 0x0e, 0x0e, 0x00, 0x05, 0x05, 0x0c, 0x08,
+	0x0c, 0x09, 0x15, 0x12, 0x05, 0x0b, 0x05, 0x08, 0x08, 0x04, 0x08, 0x12,
+	0x22, 0x1d, 0x03, 0x11, 0x11, 0x08, 0x11, 0x04, 0x0e, 0x04, 0x0d, 0x0a,
+	0x0d, 0x11, 0x11, 0x11, 0x00, 0x0b, 0x07, 0x0b, 0x01, 0x0b, 0xe6, 0x03,
+	0x0f, 0x0d, 0x04, 0x04, 0x06, 0x0d, 0x0d, 0x0c, 0x0c, 0x0c, 0x00, 0x16,
+	0x0b, 0x2f, 0x14, 0x1f, 0x08, 0x0c, 0x18, 0x04, 0x1f, 0x11, 0x10, 0x05,
+	0x1f, 0x06, 0x10, 0x08, 0x08, 0x0f, 0x0f, 0x0f, 0x00, 0x10, 0x12, 0x11,
+	0x11, 0x19, 0x03, 0x08, 0x0f, 0x0e, 0x0c, 0x19, 0x0d, 0x08, 0x03, 0x07,
+	0x09, 0x0d, 0x0d, 0x0d, 0x00, 0x18, 0x06, 0x06, 0x06, 0x08, 0x0a, 0x0e,
+	0x04, 0x04, 0x0a, 0x0e, 0x03, 0x0e, 0x0e, 0x07, 0x0a, 0x18, 0x13, 0x11,
+	0x04, 0x16, 0x06, 0x0a, 0x07, 0x0d, 0x02, 0x0e, 0x0b, 0x09, 0x09, 0x1c,
+	0x12, 0x12, 0x12, 0x00, 0x11, 0x09, 0x17, 0x11, 0x17, 0x0d, 0x11, 0x10,
+	0x06, 0x10, 0x04, 0x02, 0x10, 0x02, 0x10, 0xff, 0x0a, 0x1f, 0x0c, 0x06,
+	0x14, 0x0a, 0x14, 0x13, 0x13, 0x13, 0x00, 0x0e, 0x07, 0x06, 0x11, 0x1b,
+	0x15, 0x17, 0x10, 0x12, 0x0d, 0x02, 0x0e, 0x16, 0x00, 0x1b, 0x08, 0x1b,
+	0x07, 0x0d, 0x17, 0x0c, 0x0c, 0x16, 0x0b, 0x0c, 0x1b, 0x05, 0x0c, 0x08,
+	0x19, 0x0e, 0x17, 0x11, 0x06, 0x09, 0x04, 0x0a, 0x0c, 0x0a, 0x05, 0x0a,
+	0x0a, 0x0a, 0x07, 0x0a, 0x0a, 0x06, 0x1b, 0x0b, 0x0e, 0x04, 0x06, 0x11,
+	0x16, 0x16, 0x16, 0x00, 0x13, 0x07, 0x0d, 0x10, 0x0c, 0x13, 0x15, 0x0d,
+	0x06, 0x14, 0x02, 0x0d, 0x12, 0x00, 0x11, 0x14, 0x04, 0x05, 0x0f, 0x0f,
+	0x0f, 0x00, 0x07, 0x0e, 0x13, 0x0a, 0x0a, 0x12, 0x0f, 0x05, 0x16, 0x03,
+	0x05, 0x0c, 0x12, 0x0e, 0x18, 0x0e, 0x0e, 0x0e, 0x00, 0x44, 0x13, 0x0d,
+	0x1f, 0x00, 0x00, 0x14, 0x0b, 0x0f, 0x0c, 0x0c, 0x0e, 0x0e, 0x08, 0x1f,
+	0x06, 0x03, 0x0f, 0x9c, 0x16, 0x14, 0x0c, 0x00, 0x00, 0x07, 0x0d, 0x0e,
+	0x10, 0x10, 0x7d, 0x05, 0x07, 0x1c, 0x11, 0x0d, 0x14, 0x29, 0x16, 0x12,
+	0x16, 0x0c, 0x00, 0x0c, 0x07, 0x07, 0x05, 0x0b, 0x01, 0x0b, 0x85, 0x06,
+	0x06, 0x0b, 0x1d, 0x06, 0x03, 0x06, 0xff, 0x0c, 0x09, 0x09, 0x0f, 0x06,
+	0x1a, 0x1d, 0x04, 0x03, 0x08, 0x06, 0x03, 0x1f, 0x06, 0x14, 0x16, 0x03,
+	0x08, 0x05, 0x08, 0x08, 0x08, 0x03, 0x06, 0x03, 0x06, 0x08, 0x08, 0x04,
+	0x1d, 0x13, 0x13, 0x00, 0x2a, 0x11, 0x05, 0x0a, 0x26, 0x32, 0x33, 0x31,
+	0x31, 0x03, 0x2a, 0x05, 0x01, 0x06, 0x25, 0x13, 0x1f, 0x00, 0x03, 0x12,
+	0x12, 0x13, 0x14, 0x06, 0x02, 0x27, 0x0f, 0x07, 0x05, 0x06, 0x02, 0x07,
+	0x02, 0x06, 0x1b, 0x07, 0x2b, 0x08, 0x07, 0x09, 0x06, 0x25, 0x06, 0x0a,
+	0x05, 0x0c, 0x06, 0x03, 0x13, 0x04, 0x1a, 0x27, 0x0a, 0x05, 0x03, 0x04,
+	0x08, 0x0a, 0x04, 0x08, 0x0f, 0x05, 0x25, 0x05, 0x1b, 0x03, 0x13, 0x15,
+	0x17, 0x50, 0x16, 0x04, 0x01, 0x05, 0x0a, 0x14, 0x1a, 0x20, 0x11, 0x0f,
+	0x10, 0x03, 0x0e, 0x04, 0x0e, 0x09, 0x17, 0x05, 0x02, 0x07, 0x14, 0x06,
+	0x04, 0x01, 0xff, 0x04, 0x0b, 0x0b, 0x02, 0x11, 0x0a, 0x02, 0x05, 0x06,
+	0x00, 0x09, 0x01, 0x03, 0x21, 0x06, 0x06, 0x03, 0x06, 0x05, 0x00, 0x06,
+	0x01, 0x03, 0x19, 0x03, 0x0d, 0x14, 0x0e, 0x05, 0x0c, 0x09, 0x07, 0x05,
+	0x06, 0x06, 0x09, 0x07, 0x2f, 0x02, 0x08, 0x08, 0x17, 0x05, 0x07, 0x03,
+	0x0c, 0x07, 0x09, 0x08, 0x06, 0x10, 0x0c, 0x02, 0x01, 0x08, 0x03, 0x19,
+	0x02, 0x02, 0x04, 0x08, 0x12, 0x09, 0x2a, 0x05, 0x09, 0x06, 0x09, 0x10,
+	0x02, 0x0e, 0x0d, 0x29, 0x0b, 0x0e, 0x04, 0x10, 0x06, 0x02, 0x06, 0x0f,
+	0x0f, 0x0c, 0x21, 0x28, 0x11, 0x00, 0x21, 0x17, 0x11, 0x0b, 0x1d, 0x11,
+	0x03, 0x10, 0x0f, 0x04, 0x05, 0x03, 0x0e, 0x04, 0x03, 0x04, 0x1e, 0x07,
+	0x13, 0x0e, 0x09, 0x05, 0x06, 0x29, 0x12, 0x04, 0x13, 0x0a, 0x1a, 0x06,
+	0x19, 0x0a, 0x0d, 0x0b, 0x0e, 0x0a, 0x03, 0x06, 0x04, 0x0f, 0xff, 0x0b,
+	0x03, 0x04, 0x14, 0x20, 0x19, 0x05, 0x11, 0x06, 0x0b, 0x10, 0x02, 0x05,
+	0x19, 0x0b, 0x07, 0x0f, 0x05, 0x08, 0x03, 0x0e, 0x10, 0x04, 0x0f, 0x0e,
+	0x02, 0x0a, 0x0a, 0x02, 0x12, 0x1a, 0x09, 0x0c, 0x03, 0x04, 0x0a, 0x08,
+	0x0a, 0x16, 0x15, 0x0d, 0x0d, 0x09, 0x00, 0x0a, 0x07, 0x09, 0x0d, 0x0d,
+	0x02, 0x0c, 0x19, 0x13, 0x08, 0x03, 0x24, 0x05, 0x03, 0x15, 0x0a, 0x08,
+	0x04, 0x0f, 0x14, 0x02, 0x0c, 0x02, 0x07, 0x03, 0x03, 0x06, 0x00, 0x05,
+	0x03, 0x04, 0x05, 0x02, 0x0c, 0x05, 0x02, 0x0b, 0x0c, 0x07, 0x11, 0x08,
+	0x06, 0x03, 0x06, 0x07, 0x0a, 0x02, 0x05, 0x0b, 0x06, 0x03, 0x1e, 0x34,
+	0x36, 0x31, 0x21, 0x04, 0x01, 0x05, 0x0e, 0x18, 0x08, 0x15, 0x1e, 0x05,
+	0x08, 0x1a, 0x02, 0x16, 0x13, 0x09, 0x0f, 0x03, 0x19, 0x18, 0x0c, 0x07,
+	0x35, 0x34, 0x3c, 0x00, 0x03, 0x08, 0xff, 0x14, 0x10, 0x1a, 0x04, 0x01,
+	0x1a, 0x05, 0x05, 0x0a, 0x04, 0x1d, 0x06, 0x03, 0x0b, 0x02, 0x07, 0x0e,
+	0x08, 0x0f, 0x02, 0x02, 0x1c, 0x05, 0x02, 0x0a, 0x0b, 0x03, 0x01, 0x0b,
+	0x1f, 0x09, 0x1c, 0x04, 0x16, 0x0c, 0x07, 0x05, 0x07, 0x20, 0x1c, 0x04,
+	0x09, 0x05, 0x0d, 0x06, 0x0c, 0x05, 0x0c, 0x05, 0x1f, 0x03, 0x20, 0x20,
+	0x07, 0x0a, 0x04, 0x20, 0x02, 0x09, 0x0f, 0x0e, 0x05, 0x03, 0x0b, 0x04,
+	0x05, 0x18, 0x0b, 0x0c, 0x0d, 0x0f, 0x11, 0x0a, 0x09, 0x0e, 0x23, 0x0b,
+	0x04, 0x09, 0x12, 0x15, 0x0e, 0x00, 0x05, 0x11, 0x06, 0x04, 0x02, 0x02,
+	0x1a, 0x07, 0x07, 0x0e, 0x08, 0x08, 0x05, 0x1d, 0x07, 0x22, 0x0d, 0x0b,
+	0x13, 0x04, 0x02, 0x02, 0x02, 0x34, 0x12, 0x04, 0x17, 0x2d, 0x0b, 0x0e,
+	0x07, 0x0d, 0x0a, 0x12, 0x11, 0x04, 0x06, 0x02, 0x08, 0x10, 0x13, 0x0b,
+	0x04, 0x1b, 0xff, 0x07, 0x03, 0x03, 0x0a, 0x06, 0x04, 0x09, 0x01, 0x18,
+	0x0e, 0x1f, 0x00, 0x0c, 0x0e, 0x18, 0x09, 0x0f, 0x09, 0x02, 0x09, 0x0c,
+	0x12, 0x02, 0x03, 0x05, 0x08, 0x0d, 0x04, 0x04, 0x04, 0x09, 0x0d, 0x16,
+	0x06, 0x06, 0x0a, 0x03, 0x01, 0x19, 0x03, 0x02, 0x04, 0x11, 0x03, 0x0c,
+	0x0c, 0x02, 0x1a, 0x0d, 0x07, 0x07, 0x0d, 0x05, 0x0f, 0x0c, 0x0d, 0x03,
+	0x04, 0x02, 0x0c, 0x0b, 0x07, 0x12, 0x06, 0x07, 0x11, 0x08, 0x03, 0x22,
+	0x2a, 0x29, 0x2b, 0x2b, 0x03, 0x26, 0x05, 0x01, 0x13, 0x07, 0x11, 0x0d,
+	0x14, 0x03, 0x0d, 0x22, 0x0d, 0x10, 0x03, 0x06, 0x08, 0x06, 0x05, 0x04,
+	0x18, 0x04, 0x15, 0x00, 0x05, 0x17, 0x18, 0x09, 0x1a, 0x02, 0x04, 0x0c,
+	0x09, 0x07, 0x08, 0x04, 0x1a, 0x03, 0x03, 0x0b, 0x1e, 0x0c, 0x00, 0x1e,
+	0x0a, 0x06, 0x08, 0x1f, 0x0a, 0x10, 0x09, 0x0e, 0x03, 0x10, 0xe4, 0x0c,
+	0x06, 0x07, 0x1c, 0x06, 0x09, 0x21, 0x10, 0x05, 0x04, 0x07, 0x02, 0x13,
+	0x01, 0x02, 0x06, 0x0b, 0x03, 0x0b, 0x09, 0x02, 0x0a, 0x3b, 0x4a, 0x4a,
+	0x29, 0x29, 0x3c, 0x38, 0x32, 0x21, 0x2d, 0x18, 0x04, 0x04, 0x0b, 0x0c,
+	0x0d, 0x15, 0x13, 0x24, 0x14, 0x2b, 0x06, 0x36, 0x16, 0x28, 0x16, 0x04,
+	0x06, 0x04, 0x09, 0x01, 0x20, 0x18, 0x04, 0x05, 0x02, 0x1d, 0x05, 0x1e,
+	0x1c, 0x02, 0x0f, 0x0f, 0x27, 0x0b, 0x08, 0x09, 0x21, 0x07, 0x0a, 0x07,
+	0x2c, 0x1f, 0x0f, 0x10, 0x08, 0x02, 0x0c, 0x02, 0x08, 0x06, 0x01, 0x05,
+	0x29, 0x04, 0x26, 0x27, 0x1c, 0x29, 0x29, 0x03, 0x29, 0x05, 0x01, 0x28,
+	0x07, 0x1c, 0x26, 0x03, 0x26, 0xff, 0x24, 0x24, 0x10, 0x26, 0x26, 0x04,
+	0x04, 0x12, 0x12, 0x12, 0x07, 0x03, 0x03, 0x05, 0x05, 0x0d, 0x08, 0x04,
+	0x00, 0x05, 0x0e, 0x0f, 0x2a, 0x1b, 0x2b, 0x18, 0x24, 0x05, 0x20, 0x1f,
+	0x04, 0x24, 0x1a, 0x2d, 0x3e, 0x10, 0x00, 0x1c, 0x04, 0x01, 0x09, 0x07,
+	0x2b, 0x28, 0x23, 0x28, 0x04, 0x22, 0x06, 0x2c, 0x26, 0x07, 0x12, 0x04,
+	0x11, 0x11, 0x08, 0x03, 0x07, 0x13, 0x09, 0x13, 0x05, 0x05, 0x07, 0x07,
+	0x06, 0x02, 0x03, 0x0a, 0x06, 0x02, 0x0a, 0x06, 0x07, 0x07, 0x09, 0x02,
+	0x06, 0x08, 0x07, 0x01, 0x0c, 0x02, 0x0c, 0x05, 0x09, 0x04, 0x03, 0x03,
+	0x04, 0x0a, 0x0d, 0x08, 0x08, 0x05, 0x0a, 0x07, 0x07, 0x08, 0x26, 0x14,
+	0x2c, 0x0f, 0x08, 0x00, 0x07, 0x0c, 0x29, 0x27, 0x0a, 0x0c, 0x0c, 0x12,
+	0x06, 0x0f, 0x0b, 0x06, 0x06, 0x12, 0x0b, 0x03, 0x0a, 0x0f, 0x07, 0x07,
+	0x05, 0xe5, 0x10, 0x08, 0x07, 0x18, 0x0c, 0x03, 0x12, 0x0b, 0x05, 0x04,
+	0x04, 0x02, 0x07, 0x03, 0x05, 0x05, 0x04, 0x13, 0x0b, 0x09, 0x0d, 0x09,
+	0x01, 0x03, 0x0c, 0x2c, 0x07, 0x05, 0x12, 0x0b, 0x12, 0x08, 0x07, 0x0f,
+	0x07, 0x05, 0x01, 0x10, 0x05, 0x08, 0x00, 0x02, 0x0f, 0x13, 0x10, 0x0d,
+	0x11, 0x10, 0x0e, 0x06, 0x10, 0x00, 0x0a, 0x06, 0x0e, 0x0c, 0x06, 0x0d,
+	0x0d, 0x06, 0x06, 0x05, 0x32, 0x05, 0x07, 0x10, 0x04, 0x03, 0x01, 0x09,
+	0x0f, 0x07, 0x2e, 0x0c, 0x0c, 0x06, 0x02, 0x09, 0x0f, 0x06, 0x0a, 0x04,
+	0x06, 0x32, 0x07, 0x17, 0x06, 0x04, 0x03, 0x03, 0x05, 0x09, 0x01, 0x04,
+	0x14, 0x05, 0x0b, 0x07, 0x0b, 0x14, 0x07, 0x01, 0x07, 0xff, 0x11, 0x07,
+	0x16, 0x06, 0x08, 0x0f, 0x2b, 0x07, 0x26, 0x18, 0x06, 0x03, 0x08, 0x2e,
+	0x0a, 0x17, 0x02, 0x02, 0x19, 0x18, 0x0b, 0x07, 0x17, 0x01, 0x0d, 0x09,
+	0x10, 0x19, 0x05, 0x13, 0x06, 0x1c, 0x1f, 0x1f, 0x1f, 0x00, 0x1f, 0x04,
+	0x01, 0x05, 0x0c, 0x0f, 0x0b, 0x12, 0x0b, 0x0c, 0x15, 0x07, 0x15, 0x15,
+	0x06, 0x03, 0x19, 0x02, 0x13, 0x19, 0x05, 0x0b, 0x0c, 0x07, 0x16, 0x02,
+	0x07, 0x1c, 0x04, 0x05, 0x15, 0x02, 0x1d, 0x02, 0x06, 0x04, 0x04, 0x06,
+	0x0f, 0x06, 0x09, 0x04, 0x05, 0x07, 0x1a, 0x07, 0x18, 0x05, 0x07, 0x08,
+	0x03, 0x03, 0x2e, 0x05, 0x1a, 0x06, 0x0a, 0x07, 0x07, 0x0e, 0x06, 0x0d,
+	0x09, 0x10, 0x10, 0x0e, 0x09, 0x04, 0x02, 0x02, 0x06, 0x03, 0x21, 0x1a,
+	0x1a, 0x1a, 0x00, 0x26, 0x26, 0x28, 0x28, 0x04, 0x19, 0x05, 0x05, 0x02,
+	0x04, 0x29, 0x28, 0x2a, 0x0b, 0xff, 0x0c, 0x15, 0x15, 0x14, 0x03, 0x04,
+	0x0f, 0x0f, 0x0e, 0x00, 0x0e, 0x0e, 0x0f, 0x0e, 0x04, 0x0f, 0x05, 0x05,
+	0x3b, 0x2c, 0x04, 0x0a, 0x0b, 0x20, 0x0f, 0x19, 0x21, 0x1e, 0x1f, 0x21,
+	0x1e, 0x00, 0x0a, 0x1a, 0x1a, 0x0b, 0x07, 0x25, 0x1c, 0x1d, 0x03, 0x1a,
+	0x0e, 0x25, 0x07, 0x11, 0x1b, 0x07, 0x11, 0x09, 0x02, 0x09, 0x09, 0x09,
+	0x11, 0x2a, 0x09, 0x0a, 0x28, 0x08, 0x0e, 0x0d, 0x0d, 0x05, 0x04, 0x13,
+	0x02, 0x0a, 0x01, 0x0f, 0x0b, 0x08, 0x05, 0x01, 0x0e, 0x05, 0x08, 0x08,
+	0x0f, 0x04, 0x02, 0x0f, 0x0f, 0x0b, 0x0a, 0x0f, 0x09, 0x0e, 0x06, 0x04,
+	0x03, 0x08, 0x10, 0x0c, 0x03, 0x27, 0x1e, 0x1e, 0x1c, 0x00, 0x27, 0x04,
+	0x01, 0x17, 0x1f, 0x1f, 0x2b, 0x22, 0x03, 0x17, 0x29, 0x0c, 0x0f, 0x0f,
+	0x0f, 0x03, 0x1a, 0x15, 0x07, 0x06, 0x04, 0x27, 0x16, 0x03, 0x07, 0x05,
+	0x05, 0xb4, 0x15, 0x16, 0x02, 0x18, 0x06, 0x02, 0x2b, 0x2a, 0x1d, 0x03,
+	0x04, 0x07, 0x02, 0x02, 0x0e, 0x0a, 0x03, 0x0a, 0x09, 0x30, 0x04, 0x04,
+	0x07, 0x0b, 0x02, 0x08, 0x08, 0x05, 0x03, 0x29, 0x08, 0x1d, 0x1f, 0x09,
+	0x04, 0x2c, 0x06, 0x12, 0x1f, 0x09, 0x03, 0x05, 0x0a, 0x05, 0x0b, 0x04,
+	0x01, 0x03, 0x05, 0x1a, 0x06, 0x0c, 0x01, 0x0c, 0xff, 0x04, 0x09, 0x0f,
+	0x0a, 0x0b, 0x0c, 0x02, 0x03, 0x04, 0x06, 0x0e, 0x00, 0x02, 0x20, 0x03,
+	0x0a, 0x06, 0x08, 0x0b, 0x03, 0x01, 0x01, 0x2b, 0x07, 0x03, 0x03, 0x09,
+	0x06, 0x0e, 0x07, 0x0d, 0x07, 0x09, 0x0b, 0x02, 0x07, 0x12, 0x06, 0x0c,
+	0x08, 0x04, 0x24, 0x06, 0x24, 0x12, 0x05, 0x03, 0x05, 0x07, 0x25, 0x04,
+	0x04, 0x0c, 0x0f, 0x0a, 0x0e, 0x02, 0x0e, 0x0f, 0x09, 0x11, 0x18, 0x09,
+	0x0d, 0x04, 0x0d, 0x03, 0x09, 0x08, 0x14, 0x19, 0x0e, 0x05, 0x14, 0x0d,
+	0x30, 0x04, 0x0e, 0x05, 0x16, 0x0d, 0x04, 0x04, 0x04, 0x11, 0x03, 0x11,
+	0x0c, 0x03, 0x09, 0x06, 0x0a, 0x14, 0x08, 0x14, 0x0a, 0x06, 0x10, 0x04,
+	0x02, 0x02, 0x02, 0x03, 0x09, 0x0c, 0x03, 0x10, 0x04, 0x0d, 0x03, 0x16,
+	0x14, 0x13, 0x15, 0x05, 0x10, 0x06, 0x03, 0x0a, 0x03, 0x04, 0x04, 0x03,
+	0x07, 0x02, 0x09, 0x09, 0xff, 0x05, 0x03, 0x11, 0x06, 0x08, 0x00, 0x09,
+	0x11, 0x0a, 0x06, 0x1b, 0x0f, 0x04, 0x09, 0x15, 0x1a, 0x0d, 0x05, 0x06,
+	0x01, 0x02, 0x17, 0x08, 0x18, 0x11, 0x05, 0x0d, 0x0a, 0x13, 0x06, 0x02,
+	0x0e, 0x10, 0x11, 0x04, 0x18, 0x0d, 0x12, 0x05, 0x2d, 0x05, 0x15, 0x0c,
+	0x10, 0x09, 0x04, 0x02, 0x02, 0x0b, 0x03, 0x08, 0x13, 0x03, 0x03, 0x0b,
+	0x02, 0x15, 0x05, 0x10, 0x03, 0x05, 0x09, 0x09, 0x17, 0x15, 0x00, 0x17,
+	0x0c, 0x07, 0x07, 0x09, 0x14, 0x08, 0x09, 0x03, 0x0d, 0x12, 0x12, 0x07,
+	0x27, 0x08, 0x0e, 0x07, 0x19, 0x02, 0x0b, 0x15, 0x00, 0x06, 0x07, 0x15,
+	0x0a, 0x0a, 0x00, 0x13, 0x02, 0x03, 0x15, 0x05, 0x0e, 0x08, 0x02, 0x04,
+	0x05, 0x07, 0x00, 0x09, 0x19, 0x05, 0x16, 0x08, 0x11, 0x12, 0x04, 0x0d,
+	0x11, 0x0f, 0x11, 0x11, 0x02, 0x0b, 0x0f, 0x00, 0x2b, 0x2b, 0x10, 0x05,
+	0xff, 0x06, 0x09, 0x0a, 0x04, 0x14, 0x10, 0x03, 0x0e, 0x0e, 0x0c, 0x16,
+	0x06, 0x1b, 0x1a, 0x17, 0x05, 0x0d, 0x09, 0x11, 0x1a, 0x02, 0x05, 0x1b,
+	0x0c, 0x07, 0x13, 0x05, 0x08, 0x03, 0x0f, 0x0f, 0x04, 0x02, 0x0d, 0x03,
+	0x03, 0x16, 0x06, 0x16, 0x09, 0x00, 0x08, 0x07, 0x06, 0x09, 0x0d, 0x02,
+	0x0d, 0x0b, 0x09, 0x03, 0x07, 0x1c, 0x01, 0x03, 0x0d, 0x04, 0x13, 0x0c,
+	0x0b, 0x0c, 0x07, 0x07, 0x08, 0x09, 0x18, 0x08, 0x09, 0x10, 0x0b, 0x09,
+	0x09, 0x0e, 0x05, 0x0e, 0x0e, 0x02, 0x0e, 0x0e, 0x18, 0x13, 0x09, 0x20,
+	0x06, 0x06, 0x03, 0x15, 0x1a, 0x11, 0x09, 0x06, 0x0f, 0x0e, 0x02, 0x0a,
+	0x0e, 0x03, 0x15, 0x04, 0x0a, 0x0f, 0x02, 0x14, 0x05, 0x0f, 0x04, 0x03,
+	0x05, 0x05, 0x03, 0x0a, 0x02, 0x17, 0x03, 0x16, 0x03, 0x05, 0x04, 0x10,
+	0x06, 0x18, 0x0c, 0x06, 0x0f, 0x0a, 0x0c, 0x03, 0xff, 0x05, 0x0b, 0x08,
+	0x08, 0x03, 0x04, 0x20, 0x0b, 0x0b, 0x08, 0x04, 0x17, 0x08, 0x11, 0x0b,
+	0x0c, 0x01, 0x16, 0x06, 0x11, 0x0e, 0x09, 0x0f, 0x04, 0x0f, 0x04, 0x0d,
+	0x03, 0x1c, 0x06, 0x00, 0x12, 0x15, 0x05, 0x0b, 0x0c, 0x15, 0x07, 0x08,
+	0x09, 0x17, 0x02, 0x07, 0x10, 0x1a, 0x0c, 0x18, 0x05, 0x05, 0x14, 0x04,
+	0x03, 0x0a, 0x0b, 0x14, 0x00, 0x14, 0x02, 0x03, 0x0d, 0x05, 0x02, 0x03,
+	0x11, 0x1f, 0x1f, 0x05, 0x2a, 0x10, 0x02, 0x10, 0x0e, 0x02, 0x12, 0x0e,
+	0x03, 0x1b, 0x03, 0x0a, 0x16, 0x06, 0x02, 0x14, 0x01, 0x3f, 0x22, 0x09,
+	0x07, 0x05, 0x06, 0x09, 0x14, 0x05, 0x03, 0x04, 0x18, 0x03, 0x06, 0x11,
+	0x07, 0x0d, 0x06, 0x0b, 0x08, 0x0c, 0x05, 0x04, 0x09, 0x03, 0x18, 0x08,
+	0x02, 0x06, 0x01, 0x05, 0x00, 0x07, 0x03, 0x04, 0x04, 0x02, 0x07, 0x0b,
+	0x0b, 0x03, 0x28, 0x24, 0x01, 0x27, 0xff, 0x03, 0x28, 0x05, 0x01, 0x06,
+	0x0c, 0x08, 0x3b, 0x0b, 0x04, 0x0d, 0x0d, 0x1b, 0x01, 0x03, 0x17, 0x10,
+	0x14, 0x03, 0x14, 0x0b, 0x14, 0x17, 0x0b, 0x05, 0x0b, 0x05, 0x20, 0x03,
+	0x25, 0x2a, 0x32, 0x32, 0x1d, 0x30, 0x31, 0x2d, 0x2d, 0x1a, 0x35, 0x05,
+	0x02, 0x1c, 0x31, 0x00, 0x01, 0x1e, 0x0d, 0x0e, 0x15, 0x19, 0x21, 0x18,
+	0x1d, 0x17, 0x18, 0x03, 0x17, 0x04, 0x17, 0x29, 0x0a, 0x2e, 0x23, 0x0c,
+	0x28, 0x02, 0x04, 0x02, 0x1c, 0x09, 0x03, 0x01, 0x1e, 0x0d, 0x03, 0x29,
+	0x0c, 0x02, 0x2b, 0x0a, 0x11, 0x06, 0x09, 0x22, 0x07, 0x0a, 0x08, 0x22,
+	0x0b, 0x11, 0x03, 0x07, 0x05, 0x2c, 0x03, 0x05, 0x09, 0x0f, 0x09, 0x08,
+	0x05, 0x02, 0x02, 0x00, 0x05, 0x01, 0x2a, 0x04, 0x30, 0x06, 0x0e, 0x0e,
+	0x04, 0x02, 0x02, 0x02, 0x0c, 0x2d, 0x03, 0x09, 0x04, 0x06, 0x02, 0x13,
+	0x03, 0x0c, 0xff, 0x03, 0x17, 0x06, 0x03, 0x03, 0x26, 0x05, 0x09, 0x01,
+	0x3d, 0x04, 0x15, 0x03, 0x02, 0x12, 0x02, 0x05, 0x01, 0x06, 0x04, 0x00,
+	0x0c, 0x03, 0x08, 0x0c, 0x06, 0x02, 0x03, 0x03, 0x03, 0x0a, 0x03, 0x02,
+	0x05, 0x10, 0x11, 0x03, 0x18, 0x13, 0x06, 0x07, 0x09, 0x05, 0x07, 0x02,
+	0x07, 0x07, 0x13, 0x10, 0x00, 0x20, 0x09, 0x18, 0x0e, 0x18, 0x00, 0x01,
+	0x11, 0x04, 0x1a, 0x0e, 0x0b, 0x03, 0x05, 0x18, 0x02, 0x0f, 0x07, 0x10,
+	0x03, 0x0a, 0x06, 0x0a, 0x13, 0x11, 0x0a, 0x0b, 0x00, 0x17, 0x06, 0x0a,
+	0x09, 0x13, 0x04, 0x15, 0x08, 0x0d, 0x01, 0x0d, 0x06, 0x05, 0x09, 0x02,
+	0x0a, 0x09, 0x0d, 0x0b, 0x13, 0x07, 0x04, 0x30, 0x07, 0x0c, 0x0d, 0x07,
+	0x08, 0x1a, 0x0b, 0x06, 0x06, 0x0c, 0x16, 0x0d, 0x05, 0x05, 0x0c, 0x0c,
+	0x02, 0x11, 0x05, 0x01, 0x0b, 0x0f, 0x09, 0x1b, 0x06, 0x11, 0xff, 0x0a,
+	0x16, 0x01, 0x15, 0x10, 0x18, 0x06, 0x0f, 0x02, 0x0d, 0x03, 0x04, 0x0c,
+	0x0d, 0x00, 0x01, 0x0e, 0x04, 0x05, 0x29, 0x0c, 0x06, 0x16, 0x14, 0x05,
+	0x06, 0x12, 0x0e, 0x02, 0x05, 0x12, 0x0b, 0x31, 0x06, 0x17, 0x08, 0x01,
+	0x07, 0x18, 0x06, 0x07, 0x03, 0x1c, 0x07, 0x12, 0x12, 0x04, 0x02, 0x02,
+	0x09, 0x03, 0x08, 0x13, 0x12, 0x13, 0x07, 0x08, 0x0b, 0x04, 0x07, 0x1e,
+	0x10, 0x0b, 0x0d, 0x07, 0x06, 0x19, 0x25, 0x25, 0x1b, 0x0e, 0x0f, 0x00,
+	0x10, 0x09, 0x0c, 0x1e, 0x1a, 0x27, 0x0c, 0x12, 0x07, 0x07, 0x03, 0x1a,
+	0x19, 0x00, 0x1d, 0x14, 0x12, 0x08, 0x02, 0x0e, 0x14, 0x0a, 0x01, 0x03,
+	0x0e, 0x02, 0x14, 0x0c, 0x08, 0x0c, 0x14, 0x06, 0x07, 0x17, 0x05, 0x0b,
+	0x08, 0x04, 0x09, 0x16, 0x1b, 0x0c, 0x04, 0x07, 0x0b, 0x08, 0x04, 0x0c,
+	0x03, 0x10, 0x10, 0x00, 0x10, 0x08, 0xff, 0x19, 0x07, 0x15, 0x0a, 0x08,
+	0x03, 0x04, 0x05, 0x19, 0x09, 0x09, 0x00, 0x17, 0x02, 0x03, 0x13, 0x10,
+	0x06, 0x0b, 0x10, 0x0e, 0x03, 0x13, 0x1e, 0x0d, 0x11, 0x03, 0x17, 0x0c,
+	0x10, 0x10, 0x08, 0x05, 0x1c, 0x17, 0x08, 0x03, 0x19, 0x05, 0x33, 0x0b,
+	0x0f, 0x0f, 0x0f, 0x03, 0x05, 0x01, 0x1e, 0x01, 0x13, 0x0b, 0x0b, 0x16,
+	0x08, 0x0f, 0x08, 0x1c, 0x1d, 0x0f, 0x05, 0x08, 0x08, 0x18, 0x0b, 0x09,
+	0x15, 0x04, 0x1b, 0x0a, 0x0b, 0x17, 0x03, 0x0a, 0x0a, 0x0a, 0x15, 0x06,
+	0x0f, 0x05, 0x0b, 0x0a, 0x16, 0x10, 0x03, 0x06, 0x04, 0x0a, 0x0e, 0x03,
+	0x0a, 0x02, 0x05, 0x0e, 0x06, 0x06, 0x06, 0x09, 0x13, 0x02, 0x0f, 0x11,
+	0x11, 0x05, 0x10, 0x08, 0x04, 0x05, 0x17, 0x0f, 0x0c, 0x11, 0x0a, 0x03,
+	0x0b, 0x08, 0x0e, 0x14, 0x05, 0x11, 0x04, 0x02, 0x12, 0x0e, 0x0a, 0x04,
+	0x09, 0x06, 0xff, 0x03, 0x13, 0x07, 0x05, 0x11, 0x0a, 0x03, 0x05, 0x10,
+	0x1b, 0x1a, 0x05, 0x0d, 0x06, 0x0c, 0x0e, 0x02, 0x05, 0x1b, 0x0b, 0x07,
+	0x0c, 0x05, 0x1c, 0x09, 0x0e, 0x06, 0x00, 0x06, 0x0d, 0x06, 0x03, 0x0b,
+	0x02, 0x02, 0x0e, 0x05, 0x03, 0x04, 0x0e, 0x05, 0x1b, 0x02, 0x02, 0x04,
+	0x32, 0x11, 0x09, 0x13, 0x04, 0x30, 0x0a, 0x0d, 0x0b, 0x04, 0x0d, 0x12,
+	0x15, 0x18, 0x12, 0x11, 0x08, 0x06, 0x0c, 0x1e, 0x19, 0x19, 0x17, 0x14,
+	0x0c, 0x00, 0x0f, 0x09, 0x0c, 0x0e, 0x02, 0x03, 0x14, 0x06, 0x03, 0x0b,
+	0x05, 0x13, 0x02, 0x02, 0x06, 0x04, 0x00, 0x11, 0x01, 0x32, 0x1f, 0x05,
+	0x20, 0x0c, 0x02, 0x0c, 0x07, 0x0b, 0x0c, 0x03, 0x04, 0x11, 0x13, 0x02,
+	0x2a, 0x36, 0x2a, 0x00, 0x03, 0x07, 0x16, 0x10, 0x11, 0x04, 0x0c, 0x02,
+	0x21, 0x1e, 0x04, 0x07, 0x07, 0x07, 0x03, 0x0b, 0x0c, 0x1a, 0xff, 0x04,
+	0x04, 0x0a, 0x10, 0x1a, 0x09, 0x09, 0x06, 0x06, 0x06, 0x11, 0x05, 0x1d,
+	0x02, 0x02, 0x04, 0x0a, 0x0b, 0x02, 0x1e, 0x07, 0x17, 0x1c, 0x0a, 0x1d,
+	0x06, 0x05, 0x0a, 0x0a, 0x18, 0x0e, 0x00, 0x39, 0x0d, 0x14, 0x05, 0x08,
+	0x0e, 0x10, 0x0e, 0x06, 0x06, 0x0e, 0x1d, 0x1d, 0x0d, 0x13, 0x00, 0x11,
+	0x08, 0x1f, 0x09, 0x09, 0x0d, 0x0d, 0x21, 0x12, 0x13, 0x09, 0x03, 0x26,
+	0x05, 0x08, 0x08, 0x08, 0x03, 0x06, 0x03, 0x06, 0x08, 0x08, 0x04, 0x08,
+	0x06, 0x05, 0x05, 0x06, 0x11, 0x08, 0x05, 0x05, 0x11, 0x20, 0x0d, 0x04,
+	0x1e, 0x0d, 0x09, 0x0b, 0x15, 0x15, 0x00, 0x0c, 0x05, 0x19, 0x0f, 0x15,
+	0x0f, 0x0b, 0x05, 0x0a, 0x1b, 0x06, 0x02, 0x23, 0x06, 0x10, 0x0d, 0x08,
+	0x11, 0x03, 0x11, 0x11, 0x04, 0x11, 0x12, 0x16, 0x09, 0x09, 0x05, 0x11,
+	0x0f, 0x11, 0x0f, 0x11, 0x07, 0x06, 0x01, 0x0a, 0xff, 0x04, 0x11, 0x07,
+	0x11, 0x11, 0x04, 0x10, 0x21, 0x39, 0x15, 0x00, 0x0b, 0x14, 0x0c, 0x16,
+	0x0b, 0x03, 0x04, 0x0e, 0x15, 0x0d, 0x06, 0x03, 0x04, 0x06, 0x04, 0x06,
+	0x07, 0x06, 0x04, 0x05, 0x06, 0x07, 0x15, 0x04, 0x03, 0x19, 0x07, 0x0e,
+	0x0e, 0x04, 0x11, 0x15, 0x07, 0x0b, 0x04, 0x15, 0x0e, 0x02, 0x08, 0x08,
+	0x06, 0x03, 0x07, 0x0c, 0x24, 0x04, 0x04, 0x1d, 0x04, 0x1f, 0x03, 0x02,
+	0x06, 0x02, 0x10, 0x02, 0x08, 0x10, 0x0c, 0x0c, 0x1d, 0x06, 0x1e, 0x14,
+	0x00, 0x2b, 0x0b, 0x10, 0x01, 0x0c, 0x0b, 0x0f, 0x19, 0x12, 0x04, 0x05,
+	0x0f, 0x02, 0x02, 0x01, 0x16, 0x07, 0x03, 0x0f, 0x0f, 0x05, 0x15, 0x1f,
+	0x02, 0x17, 0x17, 0x03, 0x00, 0x0d, 0x14, 0x0c, 0x1d, 0x07, 0x02, 0x06,
+	0x0d, 0x0d, 0x04, 0x0d, 0x05, 0x02, 0x02, 0x01, 0x0c, 0x09, 0x10, 0x17,
+	0x0e, 0x0c, 0x16, 0x07, 0xff, 0x18, 0x07, 0x0a, 0x00, 0x0a, 0x1b, 0x03,
+	0x0f, 0x06, 0x0e, 0x05, 0x0d, 0x03, 0x11, 0x06, 0x02, 0x10, 0x09, 0x03,
+	0x13, 0x16, 0x10, 0x14, 0x12, 0x13, 0x13, 0x09, 0x03, 0x0a, 0x2a, 0x04,
+	0x06, 0x0d, 0x01, 0x01, 0x11, 0x05, 0x03, 0x06, 0x02, 0x01, 0x05, 0x04,
+	0x0c, 0x03, 0x09, 0x02, 0x14, 0x06, 0x15, 0x08, 0x03, 0x0f, 0x07, 0x05,
+	0x0d, 0x05, 0x03, 0x08, 0x04, 0x19, 0x06, 0x03, 0x07, 0x06, 0x0c, 0x16,
+	0x26, 0x1e, 0x04, 0x0f, 0x29, 0x0a, 0x1c, 0x0c, 0x2b, 0x0c, 0x11, 0x03,
+	0x08, 0x0c, 0x24, 0x15, 0x11, 0x05, 0x05, 0x11, 0x02, 0x11, 0x08, 0x19,
+	0x18, 0x04, 0x15, 0x05, 0x11, 0x1c, 0x19, 0x08, 0x08, 0x1b, 0x10, 0x09,
+	0x0b, 0x05, 0x19, 0x08, 0x02, 0x11, 0x0f, 0x06, 0x0b, 0x0d, 0x02, 0x14,
+	0x10, 0x06, 0x02, 0x03, 0x03, 0x03, 0x02, 0x06, 0x11, 0x10, 0x04, 0x04,
+	0xff, 0x0f, 0x02, 0x11, 0x03, 0x06, 0x0f, 0x0c, 0x03, 0x0c, 0x09, 0x05,
+	0x12, 0x02, 0x02, 0x04, 0x0b, 0x10, 0x02, 0x19, 0x0d, 0x04, 0x05, 0x00,
+	0x09, 0x0c, 0x06, 0x0d, 0x12, 0x07, 0x0c, 0x0a, 0x00, 0x05, 0x08, 0x0d,
+	0x09, 0x03, 0x04, 0x02, 0x12, 0x12, 0x02, 0x0b, 0x07, 0x05, 0x13, 0x09,
+	0x13, 0x09, 0x13, 0x03, 0x11, 0x07, 0x03, 0x1c, 0x05, 0x06, 0x11, 0x1d,
+	0x00, 0x01, 0x0b, 0x0e, 0x05, 0x0d, 0x12, 0x12, 0x11, 0x04, 0x0e, 0x07,
+	0x06, 0x03, 0x1d, 0x02, 0x0b, 0x05, 0x13, 0x03, 0x05, 0x13, 0x04, 0x19,
+	0x0d, 0x09, 0x0d, 0x06, 0x05, 0x03, 0x02, 0x11, 0x03, 0x02, 0x02, 0x0c,
+	0x09, 0x03, 0x05, 0x02, 0x29, 0x05, 0x11, 0x05, 0x15, 0x08, 0x02, 0x04,
+	0x08, 0x07, 0x03, 0x05, 0x02, 0x09, 0x0c, 0x02, 0x0a, 0x07, 0x05, 0x06,
+	0x10, 0x11, 0x05, 0x15, 0x12, 0x08, 0x06, 0x0b, 0xff, 0x06, 0x06, 0x18,
+	0x05, 0x01, 0x05, 0x09, 0x0a, 0x12, 0x07, 0x11, 0x0e, 0x0a, 0x05, 0x07,
+	0x01, 0x0f, 0x02, 0x15, 0x17, 0x09, 0x08, 0x06, 0x0c, 0x14, 0x06, 0x07,
+	0x08, 0x07, 0x02, 0x03, 0x0c, 0x06, 0x0e, 0x0e, 0x12, 0x04, 0x0e, 0x06,
+	0x1a, 0x08, 0x2b, 0x01, 0x03, 0x05, 0x10, 0x0b, 0x0f, 0x0b, 0x1e, 0x1e,
+	0x1e, 0x04, 0x10, 0x11, 0x11, 0x17, 0x06, 0x06, 0x13, 0x0d, 0x0e, 0x0d,
+	0x15, 0x0f, 0x03, 0x05, 0x04, 0x09, 0x17, 0x05, 0x06, 0x14, 0x04, 0x07,
+	0x02, 0x02, 0x01, 0x17, 0x02, 0x12, 0x06, 0x05, 0x06, 0x02, 0x02, 0x02,
+	0x01, 0x37, 0x35, 0x33, 0x2d, 0x7b, 0x05, 0x0f, 0x08, 0x0f, 0x0a, 0x21,
+	0x13, 0x03, 0x06, 0x16, 0x16, 0x16, 0x10, 0x06, 0x0a, 0x1a, 0x07, 0x16,
+	0x17, 0x04, 0x08, 0x0b, 0x0b, 0x21, 0x0a, 0x1a, 0x1c, 0x04, 0x1a, 0x0a,
+	0x0b, 0x0f, 0x11, 0x02, 0xfa, 0x01, 0x08, 0x06, 0x03, 0x01, 0x0b, 0x02,
+	0x02, 0x07, 0x04, 0x03, 0x03, 0x04, 0x01, 0x17, 0x0b, 0x1a, 0x0c, 0x0d,
+	0x1a, 0x1a, 0x0a, 0x15, 0x0b, 0x0b, 0x21, 0x02, 0x05, 0x26, 0x0d, 0x07,
+	0x0f, 0x05, 0x20, 0x09, 0x11, 0x06, 0x00, 0x06, 0x0d, 0x4a, 0x0f, 0x00,
+	0x2b, 0x05, 0x0b, 0x25, 0x07, 0x23, 0x01, 0x0f, 0x0d, 0x0e, 0x07, 0x0d,
+	0x12, 0x1b, 0x03, 0x05, 0x3e, 0x0d, 0x0d, 0x00, 0x1d, 0x14, 0x12, 0x0e,
+	0x07, 0x1b, 0x03, 0x04, 0x05, 0x1a, 0x16, 0x19, 0x10, 0x12, 0x2a, 0x0d,
+	0x0d, 0x00, 0x04, 0x0a, 0x2c, 0x06, 0x09, 0x10, 0x0e, 0x05, 0x0d, 0x0d,
+	0x05, 0x1b, 0x07, 0x19, 0x0d, 0x0d, 0x0d, 0x3d, 0x0b, 0x0e, 0x1d, 0x17,
+	0x0e, 0x09, 0x26, 0x0d, 0x03, 0x0f, 0x0f, 0x0e, 0x17, 0x05, 0x11, 0x10,
+	0x10, 0x00, 0x10, 0x09, 0x0b, 0x05, 0x0f, 0x01, 0x0f, 0xf2, 0x06, 0x06,
+	0x0f, 0x0b, 0x03, 0x0f, 0x0f, 0x2e, 0x03, 0x06, 0x0b, 0x0b, 0x0f, 0x07,
+	0x17, 0x11, 0x03, 0x29, 0x05, 0x08, 0x08, 0x08, 0x03, 0x06, 0x03, 0x06,
+	0x08, 0x08, 0x04, 0x08, 0x06, 0x05, 0x05, 0x06, 0x0f, 0x08, 0x05, 0x02,
+	0x0f, 0x0f, 0x0b, 0x06, 0x0f, 0x0f, 0x03, 0x09, 0x0f, 0x0d, 0x0c, 0x05,
+	0x0c, 0x0c, 0x18, 0x08, 0x0a, 0x0e, 0x12, 0x12, 0x00, 0x10, 0x05, 0x16,
+	0x0c, 0x0b, 0x0b, 0x0b, 0x0a, 0x06, 0x01, 0x0a, 0x03, 0x0c, 0x0e, 0x04,
+	0x0a, 0x07, 0x05, 0x02, 0x11, 0x11, 0x09, 0x06, 0x11, 0x0b, 0x03, 0x09,
+	0x11, 0x0d, 0x0c, 0x05, 0x0c, 0x0c, 0x11, 0x07, 0x1a, 0x04, 0x0f, 0x05,
+	0x0f, 0x0b, 0x10, 0x0b, 0x0a, 0x07, 0x06, 0x0e, 0x0a, 0x0a, 0x04, 0x0a,
+	0x12, 0x12, 0x00, 0x0c, 0x02, 0x0c, 0xff, 0x08, 0x0c, 0x0d, 0x0c, 0x0c,
+	0x04, 0x17, 0x07, 0x0e, 0x21, 0x04, 0x14, 0x2e, 0x18, 0x11, 0x00, 0x4b,
+	0x1b, 0x08, 0x20, 0x0f, 0x13, 0x23, 0x05, 0x0e, 0x00, 0x04, 0x14, 0x07,
+	0x1b, 0x10, 0x21, 0x01, 0x03, 0x03, 0x02, 0x02, 0x10, 0x06, 0x09, 0x04,
+	0x0a, 0x00, 0x0a, 0x11, 0x03, 0x03, 0x18, 0x06, 0x03, 0x05, 0x19, 0x13,
+	0x04, 0x23, 0x0e, 0x0b, 0x04, 0x04, 0x03, 0x03, 0x09, 0x03, 0x16, 0x06,
+	0x0d, 0x03, 0x03, 0x16, 0x06, 0x10, 0x02, 0x02, 0x0d, 0x05, 0x0b, 0x0c,
+	0x08, 0x03, 0x20, 0x0e, 0x02, 0x11, 0x0b, 0x05, 0x04, 0x04, 0x0e, 0x03,
+	0x15, 0x05, 0x02, 0x05, 0x05, 0x09, 0x09, 0x13, 0x00, 0x03, 0x0f, 0x09,
+	0x0d, 0x11, 0x04, 0x18, 0x12, 0x03, 0x1e, 0x06, 0x0c, 0x1e, 0x24, 0x1c,
+	0x13, 0x0e, 0x0c, 0x0f, 0x0a, 0x0c, 0x25, 0x0e, 0x2d, 0x04, 0x12, 0x03,
+	0x0d, 0x17, 0xff, 0x1a, 0x0c, 0x05, 0x11, 0x06, 0x15, 0x25, 0x02, 0x05,
+	0x1c, 0x0f, 0x07, 0x15, 0x05, 0x16, 0x09, 0x16, 0x06, 0x00, 0x06, 0x0d,
+	0x06, 0x0a, 0x0b, 0x07, 0x03, 0x05, 0x13, 0x13, 0x10, 0x04, 0x0f, 0x05,
+	0x0d, 0x00, 0x06, 0x1c, 0x03, 0x19, 0x0e, 0x05, 0x07, 0x1c, 0x13, 0x10,
+	0x03, 0x05, 0x10, 0x02, 0x16, 0x1a, 0x0a, 0x04, 0x0b, 0x07, 0x0e, 0x0b,
+	0x07, 0x26, 0x0d, 0x00, 0x22, 0x0c, 0x09, 0x08, 0x0c, 0x08, 0x09, 0x12,
+	0x06, 0x06, 0x1c, 0x1b, 0x19, 0x13, 0x0a, 0x15, 0x09, 0x24, 0x09, 0x09,
+	0x05, 0x0c, 0x06, 0x17, 0x1e, 0x14, 0x03, 0x1f, 0x05, 0x08, 0x08, 0x08,
+	0x03, 0x06, 0x03, 0x06, 0x08, 0x08, 0x04, 0x08, 0x06, 0x10, 0x09, 0x23,
+	0x05, 0x0f, 0x0b, 0x06, 0x0a, 0x0a, 0x18, 0x0c, 0x05, 0x0b, 0x14, 0x14,
+	0x00, 0x07, 0x07, 0x06, 0x0d, 0x07, 0x09, 0x02, 0x10, 0x14, 0xff, 0x0f,
+	0x06, 0x14, 0x0e, 0x03, 0x09, 0x24, 0x10, 0x0c, 0x05, 0x0c, 0x0c, 0x17,
+	0x08, 0x0a, 0x10, 0x04, 0x07, 0x0a, 0x04, 0x0e, 0x08, 0x05, 0x02, 0x0e,
+	0x0e, 0x09, 0x06, 0x0e, 0x0c, 0x03, 0x09, 0x0e, 0x0e, 0x0c, 0x05, 0x0c,
+	0x0c, 0x0e, 0x07, 0x11, 0x04, 0x0f, 0x11, 0x11, 0x00, 0x11, 0x0d, 0x12,
+	0x0d, 0x0c, 0x08, 0x0c, 0x0c, 0x19, 0x05, 0x11, 0x19, 0x06, 0x14, 0x0b,
+	0x24, 0x24, 0x0f, 0x00, 0x29, 0x1e, 0x1b, 0x0c, 0x00, 0x0e, 0x03, 0x0d,
+	0x09, 0x00, 0x05, 0x0c, 0x03, 0x03, 0x05, 0x04, 0x19, 0x04, 0x03, 0x1a,
+	0x17, 0x08, 0x14, 0x11, 0x08, 0x11, 0x08, 0x07, 0x08, 0x1c, 0x21, 0x02,
+	0x13, 0x0b, 0x21, 0x03, 0x10, 0x03, 0x0b, 0x10, 0x04, 0x0d, 0x0c, 0x02,
+	0x01, 0x0d, 0x1d, 0x0e, 0x11, 0x05, 0x05, 0x09, 0x02, 0x08, 0x05, 0x04,
+	0x03, 0x03, 0x04, 0x08, 0x09, 0x03, 0xff, 0x1a, 0x05, 0x04, 0x04, 0x02,
+	0x20, 0x0b, 0x13, 0x09, 0x06, 0x1d, 0x1d, 0x0f, 0x06, 0x06, 0x17, 0x07,
+	0x12, 0x0f, 0x0b, 0x3a, 0x31, 0x3c, 0x1a, 0x00, 0x3b, 0x04, 0x01, 0x05,
+	0x17, 0x10, 0x12, 0x1a, 0x16, 0x04, 0x05, 0x17, 0x0e, 0x11, 0x11, 0x02,
+	0x03, 0x04, 0x06, 0x25, 0x00, 0x02, 0x01, 0x14, 0x14, 0x00, 0x03, 0x04,
+	0x04, 0x02, 0x05, 0x16, 0x09, 0x16, 0x14, 0x04, 0x17, 0x06, 0x0d, 0x16,
+	0x11, 0x07, 0x02, 0x04, 0x07, 0x23, 0x01, 0x10, 0x1b, 0x04, 0x0a, 0x0c,
+	0x0c, 0x09, 0x07, 0x05, 0x0a, 0x13, 0x02, 0x12, 0x0c, 0x05, 0x19, 0x06,
+	0x06, 0x09, 0x13, 0x07, 0x08, 0x02, 0x0b, 0x08, 0x14, 0x04, 0x05, 0x13,
+	0x02, 0x1c, 0x05, 0x02, 0x0d, 0x04, 0x1d, 0x0a, 0x0f, 0x11, 0x07, 0x0a,
+	0x08, 0x04, 0x1c, 0x01, 0x0f, 0x0f, 0x0e, 0x0e, 0x06, 0x0c, 0x04, 0x09,
+	0x03, 0x07, 0xff, 0x05, 0x02, 0x02, 0x01, 0x02, 0x07, 0x0c, 0x05, 0x27,
+	0x05, 0x27, 0x13, 0x04, 0x03, 0x0b, 0x02, 0x09, 0x0e, 0x10, 0x06, 0x06,
+	0x0c, 0x0d, 0x16, 0x03, 0x09, 0x1f, 0x0e, 0x12, 0x03, 0x15, 0x11, 0x0a,
+	0x0c, 0x0a, 0x15, 0x13, 0x04, 0x0b, 0x06, 0x02, 0x10, 0x03, 0x0b, 0x0e,
+	0x01, 0x05, 0x01, 0x10, 0x1a, 0x05, 0x0b, 0x0a, 0x07, 0x03, 0x0b, 0x1a,
+	0x02, 0x0e, 0x0f, 0x09, 0x12, 0x0d, 0x04, 0x05, 0x0c, 0x09, 0x02, 0x09,
+	0x02, 0x05, 0x03, 0x0f, 0x04, 0x1a, 0x03, 0x13, 0x11, 0x08, 0x0a, 0x02,
+	0x04, 0x16, 0x0c, 0x14, 0x0b, 0x0d, 0x05, 0x07, 0x0b, 0x07, 0x0e, 0x11,
+	0x07, 0x07, 0x00, 0x0b, 0x0f, 0x0f, 0x0a, 0x43, 0x46, 0x02, 0x1a, 0x1b,
+	0x17, 0x0a, 0x18, 0x0e, 0x02, 0x0c, 0x00, 0x12, 0x0b, 0x03, 0x03, 0x09,
+	0x10, 0x16, 0x02, 0x09, 0x05, 0x33, 0x02, 0x03, 0x08, 0x11, 0xff, 0x07,
+	0x18, 0x11, 0x1c, 0x06, 0x4b, 0x49, 0x02, 0x09, 0x15, 0x10, 0x0d, 0x0f,
+	0x05, 0x0f, 0x0e, 0x03, 0x07, 0x05, 0x0e, 0x06, 0x1a, 0x09, 0x05, 0x1a,
+	0x10, 0x10, 0x03, 0x06, 0x19, 0x05, 0x0b, 0x11, 0x13, 0x09, 0x02, 0x02,
+	0x06, 0x07, 0x06, 0x0c, 0x03, 0x0a, 0x0a, 0x05, 0x19, 0x02, 0x02, 0x1e,
+	0x16, 0x00, 0x1e, 0x09, 0x09, 0x09, 0x12, 0x08, 0x0c, 0x0f, 0x0a, 0x0e,
+	0x0d, 0x04, 0x07, 0x27, 0x13, 0x0b, 0x13, 0x07, 0x06, 0x1d, 0x2d, 0x29,
+	0x0b, 0x0f, 0x09, 0x02, 0x01, 0x0a, 0x0b, 0x04, 0x1b, 0x01, 0x0e, 0x0f,
+	0x07, 0x03, 0x07, 0x06, 0x16, 0x01, 0x02, 0x03, 0x0e, 0x0e, 0x02, 0x03,
+	0x04, 0x10, 0x11, 0x02, 0x1d, 0x0a, 0x07, 0x21, 0x0b, 0x05, 0x03, 0x12,
+	0x02, 0x09, 0x0a, 0x06, 0x09, 0x04, 0x07, 0x04, 0x05, 0x02, 0x01, 0x03,
+	0x02, 0x13, 0x0d, 0x02, 0x15, 0x0f, 0xff, 0x04, 0x07, 0x02, 0x14, 0x08,
+	0x08, 0x07, 0x06, 0x08, 0x02, 0x03, 0x01, 0x03, 0x07, 0x03, 0x0e, 0x05,
+	0x06, 0x0d, 0x09, 0x05, 0x0b, 0x0e, 0x0e, 0x04, 0x0b, 0x06, 0x0f, 0x04,
+	0x09, 0x0f, 0x04, 0x05, 0x1e, 0x0a, 0x07, 0x0a, 0x02, 0x04, 0x0e, 0x0e,
+	0x03, 0x08, 0x08, 0x0e, 0x11, 0x0b, 0x01, 0x0b, 0x06, 0x05, 0x0f, 0x02,
+	0x0e, 0x0d, 0x06, 0x00, 0x0a, 0x03, 0x0c, 0x17, 0x06, 0x32, 0x0f, 0x02,
+	0x04, 0x0f, 0x07, 0x13, 0x25, 0x39, 0x38, 0x3b, 0x3b, 0x3b, 0x44, 0x2b,
+	0x07, 0x01, 0x0c, 0x24, 0x17, 0x12, 0x13, 0x14, 0x05, 0x16, 0x16, 0x02,
+	0x27, 0x12, 0x15, 0x05, 0x1b, 0x03, 0x04, 0x05, 0x0a, 0x16, 0x02, 0x1b,
+	0x07, 0x1b, 0x0c, 0x06, 0x01, 0x1b, 0x06, 0x0e, 0x0e, 0x0f, 0x23, 0x09,
+	0x0a, 0x0d, 0x07, 0x0c, 0x04, 0x06, 0x04, 0x04, 0x04, 0x1a, 0x03, 0x0f,
+	0x04, 0x04, 0xff, 0x04, 0x06, 0x11, 0x04, 0x11, 0x1d, 0x07, 0x0d, 0x08,
+	0x07, 0x0d, 0x04, 0x1b, 0x11, 0x0e, 0x25, 0x02, 0x11, 0x0d, 0x0d, 0x12,
+	0x10, 0x0c, 0x0e, 0x03, 0x0b, 0x06, 0x06, 0x01, 0x04, 0x0e, 0x00, 0x07,
+	0x03, 0x00, 0x04, 0x09, 0x06, 0x14, 0x03, 0x09, 0x11, 0x07, 0x03, 0x03,
+	0x02, 0x07, 0x02, 0x03, 0x11, 0x0a, 0x08, 0x0a, 0x05, 0x11, 0x11, 0x04,
+	0x0c, 0x10, 0x04, 0x05, 0x0f, 0x0a, 0x33, 0x06, 0x07, 0x0f, 0x04, 0x06,
+	0x0f, 0x0f, 0x03, 0x06, 0x0f, 0x00, 0x0c, 0x0d, 0x0c, 0x04, 0x08, 0x07,
+	0x09, 0x08, 0x06, 0x07, 0x03, 0x04, 0x31, 0x05, 0x08, 0x09, 0x13, 0x12,
+	0x06, 0x14, 0x09, 0x2d, 0x03, 0x0a, 0x21, 0x0a, 0x21, 0x16, 0x02, 0x0f,
+	0x11, 0x07, 0x03, 0x03, 0x02, 0x0d, 0x02, 0x01, 0x03, 0x11, 0x0d, 0x05,
+	0x03, 0x11, 0x0d, 0x0e, 0x18, 0x11, 0x16, 0x07, 0x10, 0x08, 0xff, 0x04,
+	0x14, 0x02, 0x0d, 0x0e, 0x06, 0x04, 0x04, 0x0d, 0x01, 0x0d, 0x04, 0x06,
+	0x17, 0x03, 0x06, 0x05, 0x13, 0x07, 0x0b, 0x06, 0x08, 0x05, 0x0e, 0x11,
+	0x02, 0x32, 0x04, 0x0a, 0x05, 0x04, 0x0d, 0x0b, 0x0e, 0x02, 0x11, 0x0c,
+	0x0e, 0x09, 0x12, 0x08, 0x03, 0x10, 0x04, 0x15, 0x03, 0x02, 0x05, 0x02,
+	0x01, 0x05, 0x07, 0x0b, 0x13, 0x13, 0x12, 0x08, 0x08, 0x01, 0x0d, 0x08,
+	0x09, 0x12, 0x0a, 0x00, 0x05, 0x03, 0x00, 0x12, 0x04, 0x08, 0x00, 0x18,
+	0x2e, 0x08, 0x10, 0x12, 0x0b, 0x03, 0x03, 0x01, 0x03, 0x0a, 0x2a, 0x04,
+	0x0d, 0x13, 0x16, 0x05, 0x07, 0x02, 0x05, 0x0b, 0x0c, 0x05, 0x05, 0x06,
+	0x09, 0x0a, 0x02, 0x0f, 0x08, 0x0a, 0x07, 0x0f, 0x08, 0x0f, 0x05, 0x07,
+	0x0b, 0x0b, 0x15, 0x08, 0x18, 0x15, 0x00, 0x33, 0x07, 0x0f, 0x0d, 0x0c,
+	0x0d, 0x17, 0x0a, 0x06, 0x06, 0x26, 0xff, 0x29, 0x08, 0x0c, 0x08, 0x02,
+	0x01, 0x1d, 0x14, 0x1a, 0x09, 0x15, 0x1d, 0x33, 0x11, 0x00, 0x2c, 0x10,
+	0x0c, 0x11, 0x17, 0x15, 0x12, 0x18, 0x11, 0x0d, 0x0e, 0x04, 0x11, 0x08,
+	0x2b, 0x02, 0x0b, 0x15, 0x07, 0x06, 0x15, 0x2c, 0x16, 0x04, 0x04, 0x14,
+	0x10, 0x2c, 0x0b, 0x0c, 0x1b, 0x06, 0x06, 0x03, 0x04, 0x0d, 0x0d, 0x0d,
+	0x0a, 0x07, 0x0d, 0x0d, 0x0d, 0x07, 0x0d, 0x00, 0x04, 0x09, 0x0a, 0x1f,
+	0x0a, 0x0f, 0x18, 0x0c, 0x0e, 0x09, 0x07, 0x11, 0x0f, 0x03, 0x03, 0x12,
+	0x03, 0x03, 0x02, 0x0c, 0x0b, 0x0a, 0x09, 0x10, 0x09, 0x02, 0x02, 0x1d,
+	0x17, 0x15, 0x11, 0x0b, 0x0e, 0x0e, 0x24, 0x20, 0x02, 0x0b, 0x10, 0x06,
+	0x03, 0x13, 0x41, 0x0e, 0x02, 0x03, 0x17, 0x0f, 0x0b, 0x03, 0x04, 0x06,
+	0x05, 0x02, 0x03, 0x10, 0x11, 0x0b, 0x09, 0x03, 0x09, 0x0e, 0x21, 0x07,
+	0x02, 0x0c, 0xdb, 0x00, 0x02, 0x27, 0x03, 0x0e, 0x17, 0x09, 0x08, 0x15,
+	0x21, 0x05, 0x27, 0x08, 0x01, 0x09, 0x1d, 0x0d, 0x0a, 0x03, 0x24, 0x03,
+	0x03, 0x0d, 0x04, 0x14, 0x02, 0x10, 0x13, 0x0f, 0x24, 0x11, 0x35, 0x1a,
+	0x00, 0x25, 0x05, 0x14, 0x08, 0x0b, 0x07, 0x12, 0x0d, 0x06, 0x06, 0x14,
+	0x1f, 0x03, 0x03, 0x0f, 0x0f, 0x21, 0x25, 0x0a, 0x0a, 0x0a, 0x08, 0x08,
+	0x0a, 0x0a, 0x0c, 0x0c, 0x1a, 0x06, 0x13, 0x19, 0x04, 0x03, 0x08, 0x06,
+	0x03, 0x20, 0x06, 0x10, 0x10, 0x03, 0x08, 0x05, 0x1f, 0x08, 0x0f, 0x0a,
+	0x20, 0x03, 0x08, 0x09, 0x07, 0x16, 0x0b, 0x05, 0x06, 0x04, 0x03, 0x04,
+	0xe7, 0x07, 0x03, 0x0c, 0x08, 0x10, 0x21, 0x18, 0x0a, 0x0e, 0x17, 0x17,
+	0x00, 0x0a, 0x0a, 0x0a, 0x0b, 0x16, 0x13, 0x13, 0x16, 0x0f, 0x02, 0x16,
+	0x1e, 0x13, 0x0b, 0x0b, 0x0b, 0x25, 0x0b, 0x12, 0x06, 0x06, 0x15, 0x0e,
+	0x0e, 0x13, 0x14, 0x15, 0x14, 0x05, 0x10, 0x09, 0x0e, 0x16, 0x0f, 0x05,
+	0x02, 0x13, 0x09, 0x0d, 0x06, 0x12, 0x18, 0x0a, 0x06, 0x14, 0x02, 0x04,
+	0x14, 0x0c, 0x08, 0x08, 0x0c, 0x09, 0x01, 0x0c, 0x10, 0x09, 0x14, 0x0f,
+	0x04, 0x13, 0x0a, 0x0a, 0x13, 0x04, 0x08, 0x13, 0x11, 0x13, 0x0a, 0x25,
+	0x17, 0x17, 0x0a, 0x11, 0x10, 0x0b, 0x16, 0x16, 0x0b, 0x06, 0x06, 0x15,
+	0x14, 0x06, 0x16, 0x00, 0x03, 0x17, 0x03, 0x08, 0x01, 0x08, 0xff, 0x06,
+	0x08, 0x0a, 0x0a, 0x11, 0x06, 0x13, 0x15, 0x04, 0x03, 0x08, 0x06, 0x03,
+	0x16, 0x06, 0x15, 0x0f, 0x03, 0x08, 0x05, 0x02, 0x05, 0x07, 0x0e, 0x08,
+	0x05, 0x02, 0x0e, 0x0e, 0x0b, 0x06, 0x0e, 0x0e, 0x0a, 0x06, 0x0c, 0x02,
+	0x04, 0x17, 0x0c, 0x08, 0x08, 0x0c, 0x09, 0x01, 0x0c, 0x0f, 0x1d, 0x0d,
+	0x08, 0x1d, 0x16, 0x16, 0x16, 0x00, 0x07, 0x12, 0x12, 0x08, 0x0e, 0x0e,
+	0x10, 0x24, 0x10, 0x05, 0x13, 0x19, 0x16, 0x24, 0x02, 0x16, 0x08, 0x0d,
+	0x14, 0x06, 0x07, 0x05, 0x13, 0x03, 0x03, 0x0f, 0x05, 0x08, 0x0d, 0x02,
+	0x21, 0x35, 0x35, 0x35, 0x00, 0x24, 0x04, 0x01, 0x05, 0x0b, 0x10, 0x02,
+	0x0b, 0x23, 0x1b, 0x02, 0x0b, 0x0e, 0x02, 0x01, 0x05, 0x09, 0x0c, 0x0c,
+	0x0c, 0x00, 0x0c, 0x04, 0x01, 0x05, 0x0e, 0x0a, 0x0c, 0x0a, 0x0e, 0x1a,
+	0x06, 0x2b, 0x17, 0x07, 0x18, 0x12, 0xe4, 0x24, 0x03, 0x06, 0x08, 0x1a,
+	0x08, 0x08, 0x13, 0x13, 0x09, 0x04, 0x26, 0x08, 0x29, 0x0c, 0x0e, 0x03,
+	0x1a, 0x29, 0x0e, 0x04, 0x12, 0x05, 0x0f, 0x01, 0x12, 0x04, 0x20, 0x01,
+	0x02, 0x01, 0x0f, 0x1a, 0x02, 0x05, 0x02, 0x0f, 0x21, 0x12, 0x05, 0x0a,
+	0x06, 0x0a, 0x09, 0x04, 0x03, 0x02, 0x02, 0x03, 0x12, 0x04, 0x0e, 0x03,
+	0x0a, 0x1d, 0x04, 0x0d, 0x08, 0x0c, 0x16, 0x04, 0x0f, 0x11, 0x0c, 0x03,
+	0x05, 0x16, 0x05, 0x10, 0x02, 0x02, 0x04, 0x01, 0x06, 0x0c, 0x02, 0x03,
+	0x03, 0x03, 0x0f, 0x16, 0x02, 0x27, 0x0c, 0x0b, 0x03, 0x11, 0x14, 0x09,
+	0x12, 0x05, 0x00, 0x14, 0x03, 0x17, 0x08, 0x15, 0x0e, 0x00, 0x06, 0x01,
+	0x06, 0xff, 0x05, 0x05, 0x0e, 0x04, 0x1e, 0x14, 0x08, 0x05, 0x16, 0x06,
+	0x05, 0x23, 0x07, 0x07, 0x15, 0x0c, 0x03, 0x09, 0x1f, 0x11, 0x17, 0x17,
+	0x14, 0x05, 0x06, 0x10, 0x10, 0x10, 0x0f, 0x04, 0x1c, 0x08, 0x0c, 0x08,
+	0x0b, 0x15, 0x1c, 0x06, 0x01, 0x07, 0x0f, 0x14, 0x02, 0x0b, 0x0b, 0x09,
+	0x03, 0x05, 0x19, 0x05, 0x0c, 0x02, 0x02, 0x18, 0x13, 0x0f, 0x11, 0x09,
+	0x14, 0x0a, 0x0a, 0x11, 0x02, 0x07, 0x02, 0x03, 0x13, 0x04, 0x01, 0x06,
+	0x01, 0x03, 0x04, 0x18, 0x05, 0x09, 0x07, 0x02, 0x0b, 0x0e, 0x09, 0x03,
+	0x08, 0x0d, 0x05, 0x0e, 0x02, 0x02, 0x04, 0x08, 0x19, 0x02, 0x26, 0x07,
+	0x04, 0x11, 0x03, 0x04, 0x03, 0x03, 0x06, 0x05, 0x04, 0x15, 0x01, 0x1a,
+	0x09, 0x0d, 0x00, 0x0c, 0x0f, 0x1d, 0x06, 0x3a, 0x0b, 0x14, 0x12, 0x04,
+	0x0d, 0x12, 0x09, 0x03, 0x05, 0x0d, 0x11, 0x06, 0x15, 0xff, 0x1b, 0x21,
+	0x21, 0x21, 0x00, 0x23, 0x23, 0x40, 0x31, 0x3f, 0x01, 0x34, 0x27, 0x0a,
+	0x10, 0x1a, 0x14, 0x0f, 0x13, 0x11, 0x05, 0x1b, 0x1b, 0x05, 0x1e, 0x02,
+	0x02, 0x04, 0x15, 0x18, 0x23, 0x03, 0x03, 0x01, 0x26, 0x02, 0x01, 0x1a,
+	0x0b, 0x04, 0x0a, 0x1e, 0x02, 0x0f, 0x19, 0x19, 0x19, 0x00, 0x19, 0x19,
+	0x18, 0x3e, 0x01, 0x41, 0x1a, 0x09, 0x0a, 0x18, 0x18, 0x15, 0x10, 0x18,
+	0x05, 0x14, 0x20, 0x04, 0x03, 0x29, 0x02, 0x1a, 0x07, 0x04, 0x2c, 0x07,
+	0x02, 0x15, 0x06, 0x29, 0x20, 0x19, 0x1d, 0x1d, 0x1d, 0x0e, 0x07, 0x02,
+	0x09, 0x11, 0x11, 0x0e, 0x05, 0x11, 0x05, 0x0e, 0x21, 0x00, 0x02, 0x05,
+	0x1d, 0x03, 0x09, 0x2c, 0x28, 0x06, 0x11, 0x10, 0x09, 0x09, 0x0b, 0x2e,
+	0x01, 0x0f, 0x07, 0x04, 0x06, 0x04, 0x03, 0x0d, 0x27, 0x31, 0x04, 0x04,
+	0x0f, 0x15, 0x02, 0x08, 0x08, 0xe0, 0x05, 0x03, 0x0c, 0x08, 0x13, 0x10,
+	0x09, 0x04, 0x0f, 0x06, 0x02, 0x08, 0x07, 0x23, 0x02, 0x04, 0x03, 0x0d,
+	0x02, 0x05, 0x04, 0x10, 0x0c, 0x04, 0x01, 0x03, 0x0c, 0x16, 0x1a, 0x31,
+	0x1b, 0x02, 0x07, 0x0e, 0x1b, 0x09, 0x0d, 0x03, 0x11, 0x05, 0x1a, 0x0f,
+	0x0c, 0x01, 0x31, 0x0d, 0x00, 0x31, 0x09, 0x08, 0x0a, 0x09, 0x07, 0x0f,
+	0x17, 0x06, 0x06, 0x0f, 0x22, 0x04, 0x0c, 0x12, 0x16, 0x1d, 0x02, 0x16,
+	0x07, 0x1e, 0x0c, 0x0c, 0x09, 0x0c, 0x0c, 0x06, 0x0c, 0x0e, 0x0e, 0x15,
+	0x06, 0x14, 0x18, 0x04, 0x03, 0x08, 0x06, 0x03, 0x0d, 0x06, 0x10, 0x11,
+	0x03, 0x08, 0x13, 0x13, 0x00, 0x0a, 0x01, 0x0a, 0xa2, 0x11, 0x0c, 0x19,
+	0x0b, 0x05, 0x0b, 0x11, 0x1c, 0x07, 0x1c, 0x10, 0x0c, 0x10, 0x0c, 0x0c,
+	0x04, 0x18, 0x0b, 0x11, 0x05, 0x03, 0x0f, 0x15, 0x09, 0x2c, 0x03, 0x10,
+	0x0b, 0x07, 0x1e, 0x0b, 0x05, 0x06, 0x04, 0x03, 0x04, 0xff, 0x03, 0x12,
+	0x00, 0x09, 0x08, 0x0c, 0x0c, 0x14, 0x14, 0x00, 0x00, 0x0e, 0x0b, 0x07,
+	0x0e, 0x0c, 0x03, 0x09, 0x0e, 0x0d, 0x14, 0x14, 0x18, 0x18, 0x04, 0x13,
+	0x19, 0x10, 0x03, 0x0d, 0x0d, 0x1e, 0x0c, 0x19, 0x13, 0x06, 0x16, 0x04,
+	0x10, 0x11, 0x05, 0x0f, 0x19, 0x00, 0x31, 0x16, 0x00, 0x10, 0x0e, 0x05,
+	0x11, 0x0f, 0x0a, 0x1b, 0x25, 0x10, 0x0f, 0x1a, 0x05, 0x0f, 0x0b, 0x11,
+	0x1a, 0x0a, 0x05, 0x18, 0x0e, 0x05, 0x0d, 0x13, 0x1e, 0x01, 0x18, 0x15,
+	0x06, 0x06, 0x02, 0x12, 0x04, 0x02, 0x03, 0x02, 0x07, 0x06, 0x03, 0x04,
+	0x0e, 0x00, 0x02, 0x0c, 0x06, 0x06, 0x03, 0x02, 0x09, 0x01, 0x03, 0x06,
+	0x04, 0x05, 0x06, 0x04, 0x03, 0x04, 0x08, 0x08, 0x03, 0x20, 0x0d, 0x0d,
+	0x0d, 0x09, 0x04, 0x05, 0x02, 0x0a, 0x02, 0x0b, 0x06, 0x21, 0x03, 0x05,
+	0x05, 0x15, 0x0c, 0x0c, 0x0c, 0xff, 0x06, 0x24, 0x2c, 0x36, 0x25, 0x03,
+	0x13, 0x1d, 0x06, 0x02, 0x20, 0x20, 0x0a, 0x04, 0x11, 0x05, 0x02, 0x15,
+	0x10, 0x13, 0x04, 0x04, 0x03, 0x11, 0x02, 0x06, 0x01, 0x14, 0x02, 0x11,
+	0x01, 0x20, 0x01, 0x07, 0x12, 0x06, 0x06, 0x0d, 0x2f, 0x18, 0x04, 0x09,
+	0x0e, 0x09, 0x02, 0x03, 0x01, 0x06, 0x0e, 0x17, 0x04, 0x03, 0x07, 0x02,
+	0x06, 0x1a, 0x01, 0x19, 0x06, 0x04, 0x0a, 0x0c, 0x06, 0x06, 0x0e, 0x19,
+	0x0c, 0x05, 0x0f, 0x19, 0x1b, 0x07, 0x05, 0x05, 0x0f, 0x2f, 0x0c, 0x33,
+	0x05, 0x02, 0x0f, 0x0a, 0x02, 0x08, 0x01, 0x10, 0x08, 0x09, 0x28, 0x06,
+	0x08, 0x07, 0x0f, 0x05, 0x19, 0x09, 0x0a, 0x06, 0x07, 0x03, 0x17, 0x14,
+	0x04, 0x0c, 0x02, 0x02, 0x04, 0x06, 0x06, 0x02, 0x13, 0x09, 0x0b, 0x14,
+	0x07, 0x05, 0x01, 0x0a, 0x02, 0x14, 0x06, 0x02, 0x19, 0x04, 0x08, 0x0c,
+	0x10, 0xff, 0x06, 0x0b, 0x00, 0x01, 0x17, 0x08, 0x0c, 0x10, 0x01, 0x0e,
+	0x0e, 0x10, 0x05, 0x19, 0x18, 0x05, 0x0f, 0x02, 0x17, 0x12, 0x02, 0x0c,
+	0x07, 0x1e, 0x15, 0x0d, 0x02, 0x03, 0x13, 0x12, 0x08, 0x0b, 0x03, 0x0e,
+	0x05, 0x10, 0x03, 0x0a, 0x11, 0x04, 0x07, 0x0c, 0x12, 0x06, 0x15, 0x0d,
+	0x04, 0x06, 0x13, 0x01, 0x07, 0x09, 0x14, 0x0e, 0x09, 0x0a, 0x07, 0x01,
+	0x19, 0x08, 0x1a, 0x10, 0x1a, 0x0a, 0x1a, 0x05, 0x2d, 0x05, 0x22, 0x05,
+	0x04, 0x15, 0x13, 0x11, 0x0c, 0x07, 0x15, 0x08, 0x22, 0x22, 0x05, 0x0a,
+	0x10, 0x17, 0x1d, 0x02, 0x1b, 0x08, 0x0d, 0x0e, 0x17, 0x0e, 0x09, 0x1b,
+	0x18, 0x02, 0x01, 0x17, 0x0d, 0x17, 0x08, 0x1a, 0x14, 0x07, 0x10, 0x04,
+	0x14, 0x04, 0x02, 0x18, 0x03, 0x33, 0x06, 0x06, 0x1e, 0x06, 0x03, 0x13,
+	0x0b, 0x1a, 0x08, 0x04, 0x03, 0x05, 0x15, 0x0d, 0x12, 0xff, 0x05, 0x0d,
+	0x05, 0x09, 0x07, 0x04, 0x03, 0x02, 0x02, 0x03, 0x0b, 0x04, 0x08, 0x03,
+	0x15, 0x15, 0x04, 0x1e, 0x0c, 0x0b, 0x15, 0x04, 0x16, 0x12, 0x0c, 0x05,
+	0x09, 0x06, 0x05, 0x06, 0x29, 0x07, 0x0e, 0x15, 0x16, 0x05, 0x09, 0x08,
+	0x0a, 0x17, 0x0c, 0x1a, 0x1d, 0x19, 0x07, 0x08, 0x10, 0x09, 0x09, 0x07,
+	0x04, 0x02, 0x02, 0x10, 0x0c, 0x14, 0x0b, 0x04, 0x1e, 0x07, 0x14, 0x03,
+	0x05, 0x03, 0x0b, 0x0a, 0x0a, 0x03, 0x09, 0x0c, 0x05, 0x0d, 0x02, 0x02,
+	0x04, 0x0d, 0x07, 0x07, 0x09, 0x04, 0x09, 0x03, 0x0d, 0x0a, 0x03, 0x0d,
+	0x06, 0x0d, 0x26, 0x1a, 0x09, 0x18, 0x0a, 0x00, 0x02, 0x0d, 0x0c, 0x03,
+	0x03, 0x33, 0x1f, 0x0d, 0x0b, 0x0b, 0x05, 0x32, 0x13, 0x04, 0x04, 0x08,
+	0x14, 0x3b, 0x05, 0x0c, 0x12, 0x0d, 0x11, 0x09, 0x09, 0x34, 0x1a, 0x45,
+	0x20, 0x10, 0x06, 0x06, 0x25, 0x89, 0x1c, 0x0d, 0x04, 0x04, 0x10, 0x05,
+	0x1c, 0x05, 0x0f, 0x01, 0x0f, 0xa0, 0x09, 0x09, 0x18, 0x14, 0x17, 0x0c,
+	0x08, 0x09, 0x08, 0x0e, 0x09, 0x2f, 0x15, 0x00, 0x2e, 0x05, 0x04, 0x06,
+	0x0a, 0x0a, 0x0d, 0x11, 0x06, 0x06, 0x21, 0x25, 0x14, 0x0d, 0x04, 0x11,
+	0x16, 0x0a, 0x01, 0x0a, 0xbe, 0x06, 0x0a, 0x0a, 0x0c, 0x0c, 0x22, 0x06,
+	0x0c, 0x1d, 0x04, 0x03, 0x08, 0x06, 0x03, 0x13, 0x03, 0x13, 0x07, 0x1e,
+	0x04, 0x08, 0x13, 0x13, 0x00, 0x0a, 0x08, 0x0a, 0x0a, 0x11, 0x0c, 0x22,
+	0x0a, 0x05, 0x0d, 0x11, 0x16, 0x07, 0x2f, 0x10, 0x0c, 0x10, 0x0c, 0x0c,
+	0x18, 0x14, 0x16, 0x13, 0x05, 0x22, 0x12, 0x17, 0x0a, 0x06, 0x03, 0x12,
+	0x0b, 0x07, 0x18, 0x0d, 0x05, 0x06, 0x04, 0x03, 0x04, 0xff, 0x03, 0x14,
+	0x00, 0x09, 0x08, 0x14, 0x0c, 0x16, 0x16, 0x00, 0x00, 0x0e, 0x0b, 0x07,
+	0x0e, 0x0c, 0x03, 0x09, 0x0e, 0x0d, 0x16, 0x16, 0x12, 0x12, 0x04, 0x13,
+	0x24, 0x10, 0x03, 0x0d, 0x0d, 0x2f, 0x0c, 0x19, 0x13, 0x06, 0x16, 0x04,
+	0x10, 0x11, 0x05, 0x0f, 0x19, 0x00, 0x2f, 0x16, 0x00, 0x30, 0x08, 0x09,
+	0x27, 0x0b, 0x09, 0x04, 0x29, 0x02, 0x11, 0x04, 0x02, 0x15, 0x13, 0x08,
+	0x07, 0x13, 0x06, 0x05, 0x10, 0x17, 0x03, 0x17, 0x1b, 0x04, 0x1b, 0x17,
+	0x15, 0x1a, 0x1a, 0x0a, 0x0f, 0x05, 0x08, 0x08, 0x0a, 0x0d, 0x20, 0x10,
+	0x02, 0x0e, 0x00, 0x01, 0x01, 0x04, 0x07, 0x06, 0x02, 0x09, 0x01, 0x13,
+	0x0b, 0x0a, 0x0d, 0x02, 0x05, 0x0b, 0x06, 0x0c, 0x03, 0x1f, 0x0c, 0x04,
+	0x0e, 0x0a, 0x02, 0x11, 0x02, 0x06, 0x11, 0x06, 0x05, 0x0e, 0x0e, 0x16,
+	0x02, 0x0b, 0x04, 0x28, 0x1a, 0xff, 0x07, 0x04, 0x02, 0x02, 0x0f, 0x05,
+	0x04, 0x04, 0x04, 0x29, 0x04, 0x0b, 0x06, 0x04, 0x03, 0x0e, 0x0e, 0x03,
+	0x13, 0x04, 0x13, 0x06, 0x02, 0x0e, 0x03, 0x0b, 0x2b, 0x04, 0x34, 0x0d,
+	0x09, 0x03, 0x20, 0x25, 0x2f, 0x02, 0x03, 0x09, 0x15, 0x0a, 0x13, 0x03,
+	0x0c, 0x05, 0x15, 0x03, 0x17, 0x07, 0x0f, 0x0c, 0x11, 0x00, 0x01, 0x01,
+	0x07, 0x13, 0x01, 0x1a, 0x0b, 0x1b, 0x06, 0x04, 0x05, 0x0d, 0x02, 0x1b,
+	0x16, 0x07, 0x07, 0x16, 0x19, 0x07, 0x04, 0x0e, 0x0a, 0x09, 0x0a, 0x11,
+	0x08, 0x03, 0x19, 0x0f, 0x08, 0x09, 0x08, 0x0f, 0x06, 0x04, 0x04, 0x02,
+	0x11, 0x0e, 0x03, 0x03, 0x0b, 0x06, 0x02, 0x2f, 0x1d, 0x02, 0x04, 0x01,
+	0x15, 0x05, 0x18, 0x0c, 0x0b, 0x0f, 0x1c, 0x2e, 0x23, 0x0a, 0x08, 0x00,
+	0x10, 0x0e, 0x05, 0x05, 0x02, 0x0b, 0x0c, 0x11, 0x0b, 0x04, 0x0d, 0x04,
+	0x02, 0xff, 0x02, 0x08, 0x03, 0x0c, 0x0b, 0x13, 0x04, 0x04, 0x1f, 0x08,
+	0x26, 0x04, 0x07, 0x11, 0x06, 0x08, 0x03, 0x15, 0x16, 0x0e, 0x11, 0x0d,
+	0x13, 0x0c, 0x07, 0x13, 0x13, 0x13, 0x0b, 0x08, 0x00, 0x0e, 0x12, 0x0b,
+	0x0e, 0x0e, 0x04, 0x1b, 0x17, 0x14, 0x1b, 0x10, 0x05, 0x0a, 0x00, 0x01,
+	0x01, 0x08, 0x10, 0x0b, 0x02, 0x01, 0x11, 0x05, 0x03, 0x1b, 0x05, 0x07,
+	0x07, 0x07, 0x05, 0x01, 0x04, 0x09, 0x07, 0x04, 0x03, 0x04, 0x02, 0x02,
+	0x05, 0x02, 0x19, 0x02, 0x05, 0x0d, 0x04, 0x05, 0x13, 0x07, 0x0d, 0x04,
+	0x10, 0x01, 0x1b, 0x0a, 0x0d, 0x00, 0x0a, 0x0d, 0x15, 0x09, 0x0f, 0x09,
+	0x02, 0x09, 0x0c, 0x0e, 0x02, 0x25, 0x09, 0x09, 0x0d, 0x02, 0x0f, 0x05,
+	0x10, 0x03, 0x01, 0x04, 0x05, 0x21, 0x05, 0x27, 0x0c, 0x12, 0x09, 0x04,
+	0x0b, 0x08, 0x02, 0x04, 0x02, 0x0d, 0x03, 0x04, 0x02, 0xff, 0x03, 0x09,
+	0x0b, 0x07, 0x06, 0x0d, 0x08, 0x02, 0x07, 0x0e, 0x06, 0x03, 0x13, 0x08,
+	0x09, 0x1b, 0x02, 0x0c, 0x0f, 0x26, 0x1b, 0x08, 0x05, 0x09, 0x0b, 0x15,
+	0x03, 0x0d, 0x0e, 0x01, 0x0b, 0x07, 0x06, 0x0e, 0x08, 0x14, 0x11, 0x0e,
+	0x0e, 0x04, 0x07, 0x16, 0x0d, 0x16, 0x00, 0x04, 0x0e, 0x05, 0x07, 0x04,
+	0x0b, 0x05, 0x05, 0x05, 0x03, 0x0b, 0x06, 0x02, 0x23, 0x04, 0x31, 0x0f,
+	0x21, 0x18, 0x04, 0x06, 0x08, 0x0a, 0x03, 0x09, 0x0f, 0x00, 0x03, 0x05,
+	0x02, 0x04, 0x04, 0x01, 0x16, 0x0c, 0x16, 0x13, 0x02, 0x05, 0x12, 0x06,
+	0x11, 0x08, 0x0a, 0x01, 0x03, 0x05, 0x06, 0x04, 0x03, 0x17, 0x02, 0x1a,
+	0x0a, 0x09, 0x0b, 0x07, 0x05, 0x09, 0x00, 0x01, 0x07, 0x12, 0x15, 0x24,
+	0x10, 0x05, 0x0c, 0x15, 0x17, 0x0a, 0x0a, 0x12, 0x05, 0x11, 0x03, 0x07,
+	0x03, 0x0f, 0x08, 0x02, 0x03, 0xb4, 0x11, 0x11, 0x0b, 0x04, 0x03, 0x07,
+	0x00, 0x05, 0x09, 0x04, 0x0b, 0x04, 0x02, 0x15, 0x0a, 0x05, 0x03, 0x01,
+	0x08, 0x0c, 0x08, 0x09, 0x10, 0x06, 0x09, 0x03, 0x0c, 0x05, 0x29, 0x10,
+	0x00, 0x29, 0x12, 0x45, 0x08, 0x0c, 0x0c, 0x10, 0x10, 0x22, 0x0e, 0x27,
+	0x28, 0x02, 0x02, 0x28, 0x08, 0x0f, 0x1c, 0x19, 0x06, 0x04, 0x01, 0x04,
+	0x85, 0x0e, 0x15, 0x09, 0x01, 0x07, 0x03, 0x07, 0xd6, 0x17, 0x12, 0x00,
+	0x12, 0x06, 0x0a, 0x0a, 0x02, 0x10, 0x0f, 0x0c, 0x11, 0x0d, 0x04, 0x11,
+	0x05, 0x11, 0x24, 0x16, 0x07, 0x00, 0x09, 0x0a, 0x04, 0x01, 0x0a, 0x0a,
+	0x04, 0x11, 0x11, 0x2a, 0x10, 0x10, 0x11, 0x19, 0x0f, 0x0d, 0x0c, 0x0c,
+	0x1a, 0x04, 0x04, 0x11, 0x1d, 0x03, 0x0e, 0x1b, 0x07, 0x0a, 0x10, 0x12,
+	0x14, 0x04, 0x25, 0x0d, 0x08, 0x16, 0x02, 0x04, 0x79, 0x01, 0x0e, 0x09,
+	0x08, 0x0e, 0x0d, 0x17, 0x17, 0x0d, 0x07, 0x00, 0x0c, 0x0b, 0x25, 0x79,
+	0x0b, 0x04, 0x19, 0x19, 0x26, 0x1a, 0x10, 0x1e, 0x14, 0x02, 0x08, 0x01,
+	0x08, 0xb5, 0x1c, 0x0d, 0x12, 0x27, 0x06, 0x08, 0x26, 0x25, 0x11, 0x04,
+	0x07, 0x05, 0x0c, 0x0d, 0x1f, 0x00, 0x1f, 0x1b, 0x1f, 0x19, 0x08, 0x0a,
+	0x09, 0x1f, 0x04, 0x04, 0x0f, 0x1f, 0x03, 0x0d, 0x1f, 0x07, 0x0a, 0x15,
+	0x1a, 0x1d, 0x04, 0x11, 0x0b, 0x05, 0x04, 0x0b, 0x0a, 0x1d, 0x1d, 0x09,
+	0x07, 0x00, 0x0c, 0x0f, 0x1d, 0x03, 0x0a, 0x04, 0x0a, 0xff, 0x07, 0x00,
+	0x0a, 0x0a, 0x04, 0x01, 0x0c, 0x0c, 0x06, 0x1c, 0x1c, 0x15, 0x00, 0x2b,
+	0x15, 0x26, 0x1d, 0x11, 0x0d, 0x0e, 0x00, 0x11, 0x11, 0x16, 0x0f, 0x0e,
+	0x01, 0x1e, 0x02, 0x08, 0x04, 0x08, 0x05, 0x04, 0x0a, 0x0b, 0x18, 0x09,
+	0x12, 0x06, 0x04, 0x25, 0x02, 0x19, 0x08, 0x05, 0x01, 0x03, 0x19, 0x02,
+	0x07, 0x03, 0x04, 0x03, 0x17, 0x0b, 0x04, 0x03, 0x01, 0x2b, 0x19, 0x11,
+	0x11, 0x06, 0x29, 0x06, 0x07, 0x0a, 0x02, 0x04, 0x2b, 0x01, 0x03, 0x0b,
+	0x04, 0x0d, 0x13, 0x0a, 0x07, 0x07, 0x07, 0x06, 0x15, 0x06, 0x11, 0x14,
+	0x02, 0x0b, 0x14, 0x17, 0x01, 0x0b, 0x05, 0x10, 0x0e, 0x0a, 0x0b, 0x0a,
+	0x03, 0x03, 0x11, 0x0a, 0x05, 0x04, 0x04, 0x01, 0x05, 0x02, 0x05, 0x05,
+	0x08, 0x05, 0x04, 0x14, 0x06, 0x0c, 0x03, 0x05, 0x05, 0x22, 0x03, 0x56,
+	0x06, 0x22, 0x19, 0x04, 0x18, 0xff, 0x0b, 0x0d, 0x03, 0x05, 0x13, 0x02,
+	0x06, 0x19, 0x04, 0x12, 0x0d, 0x0d, 0x00, 0x07, 0x16, 0x08, 0x03, 0x0c,
+	0x02, 0x0b, 0x01, 0x15, 0x03, 0x00, 0x18, 0x03, 0x02, 0x12, 0x02, 0x13,
+	0x03, 0x13, 0x19, 0x0b, 0x02, 0x17, 0x0b, 0x16, 0x03, 0x04, 0x0c, 0x0d,
+	0x12, 0x0b, 0x0f, 0x13, 0x03, 0x09, 0x07, 0x07, 0x07, 0x19, 0x08, 0x05,
+	0x0a, 0x06, 0x03, 0x45, 0x0e, 0x14, 0x03, 0x0c, 0x0b, 0x02, 0x11, 0x03,
+	0x0d, 0x01, 0x04, 0x09, 0x09, 0x0c, 0x07, 0x11, 0x06, 0x0c, 0x06, 0x04,
+	0x12, 0x0f, 0x04, 0x08, 0x10, 0x05, 0x02, 0x07, 0x04, 0x07, 0x03, 0x05,
+	0x05, 0x04, 0x04, 0x03, 0x0e, 0x15, 0x19, 0x04, 0x06, 0x09, 0x01, 0x17,
+	0x02, 0x0b, 0x00, 0x11, 0x02, 0x03, 0x15, 0x15, 0x0a, 0x12, 0x08, 0x0d,
+	0x0a, 0x0e, 0x03, 0x10, 0x06, 0x0f, 0x09, 0x05, 0x02, 0x05, 0x07, 0x07,
+	0x03, 0xff, 0x04, 0x0b, 0x11, 0x06, 0x08, 0x05, 0x02, 0x0d, 0x23, 0x02,
+	0x17, 0x05, 0x10, 0x00, 0x13, 0x0f, 0x12, 0x06, 0x0e, 0x0e, 0x0e, 0x03,
+	0x15, 0x07, 0x08, 0x04, 0x04, 0x0e, 0x02, 0x15, 0x14, 0x10, 0x07, 0x0e,
+	0x0b, 0x0e, 0x04, 0x09, 0x1f, 0x08, 0x0d, 0x04, 0x08, 0x0f, 0x13, 0x2d,
+	0x21, 0x0c, 0x0b, 0x00, 0x10, 0x04, 0x04, 0x11, 0x11, 0x0d, 0x0e, 0x15,
+	0x0b, 0x04, 0x17, 0x0b, 0x0d, 0x12, 0x0e, 0x02, 0x06, 0x14, 0x09, 0x0b,
+	0x04, 0x04, 0x01, 0x12, 0x12, 0x14, 0x0c, 0x07, 0x19, 0x13, 0x17, 0x07,
+	0x04, 0x19, 0x0f, 0x02, 0x19, 0x0b, 0x18, 0x0c, 0x04, 0x14, 0x08, 0x03,
+	0x18, 0x06, 0x0f, 0x12, 0x17, 0x17, 0x15, 0x10, 0x1b, 0x0f, 0x19, 0x15,
+	0x10, 0x01, 0x0f, 0x1d, 0x11, 0x1d, 0x09, 0x15, 0x13, 0x04, 0x14, 0x12,
+	0x0a, 0x14, 0x04, 0x1b, 0x01, 0x02, 0x04, 0x1a, 0x02, 0xd4, 0x0d, 0x16,
+	0x1b, 0x0f, 0x11, 0x03, 0x07, 0x0e, 0x02, 0x02, 0x0b, 0x1c, 0x06, 0x0b,
+	0x0c, 0x06, 0x0a, 0x03, 0x02, 0x19, 0x19, 0x03, 0x1c, 0x0a, 0x05, 0x11,
+	0x0b, 0x05, 0x09, 0x07, 0x1c, 0x03, 0x03, 0x01, 0x1c, 0x0e, 0x14, 0x03,
+	0x19, 0x05, 0x07, 0x03, 0x04, 0x0e, 0x02, 0x05, 0x05, 0x05, 0x02, 0x04,
+	0x18, 0x00, 0x01, 0x09, 0x06, 0x0d, 0x0e, 0x02, 0x02, 0x0c, 0x02, 0x14,
+	0x0a, 0x0e, 0x03, 0x0b, 0x0d, 0x06, 0x03, 0x04, 0x02, 0x05, 0x0f, 0x02,
+	0x0b, 0x0b, 0x18, 0x15, 0x2c, 0x0c, 0x0d, 0x0a, 0x0b, 0x02, 0x01, 0x02,
+	0xe3, 0x0d, 0x02, 0x34, 0x17, 0x0f, 0x00, 0x11, 0x0b, 0x12, 0x31, 0x06,
+	0x01, 0x20, 0x08, 0x0a, 0x11, 0x02, 0x02, 0x0c, 0x02, 0x03, 0x0d, 0x11,
+	0x03, 0x0c, 0x0e, 0x0d, 0x19, 0x04, 0x0f, 0x14, 0x14, 0x0a, 0x04, 0x08,
+	0x15, 0x02, 0x03, 0x0b, 0x0b, 0x03, 0x0a, 0x0d, 0x16, 0x09, 0x0a, 0x01,
+	0x0c, 0x06, 0x09, 0x09, 0x05, 0x02, 0x03, 0x02, 0x08, 0x00, 0x0b, 0x12,
+	0x03, 0x05, 0x0b, 0x0f, 0x15, 0x1d, 0x03, 0x01, 0x07, 0x0c, 0x0c, 0x0b,
+	0x03, 0x03, 0x02, 0x19, 0x08, 0x07, 0x01, 0x03, 0x09, 0x0d, 0x06, 0x05,
+	0x0b, 0x18, 0x07, 0x07, 0x25, 0x17, 0x45, 0x30, 0x39, 0x37, 0x45, 0x1c,
+	0x06, 0x01, 0x08, 0x0f, 0x04, 0x0f, 0xb3, 0x2a, 0x08, 0x04, 0x1c, 0x05,
+	0x03, 0x1a, 0x06, 0x02, 0x14, 0x05, 0x19, 0x16, 0x04, 0x02, 0x06, 0x04,
+	0x27, 0x0b, 0x09, 0x06, 0x05, 0x05, 0x02, 0x02, 0x1c, 0x02, 0x18, 0x0b,
+	0x07, 0x07, 0x33, 0x1b, 0x00, 0x2c, 0x05, 0x12, 0x12, 0x0b, 0x0c, 0x0d,
+	0x28, 0x20, 0x12, 0x00, 0x11, 0x03, 0x15, 0x11, 0x25, 0x0c, 0x03, 0x0c,
+	0xc6, 0x09, 0x0c, 0x0c, 0x00, 0x0c, 0x03, 0x20, 0x08, 0x12, 0x16, 0x0f,
+	0x02, 0x1f, 0x0c, 0x0c, 0x04, 0x10, 0x01, 0x0e, 0x08, 0x07, 0x08, 0x14,
+	0x10, 0x18, 0x2c, 0x15, 0x15, 0x2b, 0x13, 0x0f, 0x08, 0x0e, 0x09, 0x0d,
+	0x0d, 0x05, 0x0f, 0x15, 0x13, 0x15, 0x0a, 0x00, 0x15, 0x03, 0x0b, 0x12,
+	0x0b, 0x13, 0x0b, 0x07, 0x1a, 0x15, 0x05, 0x0e, 0x05, 0x0e, 0x0e, 0x0e,
+	0x0c, 0x0e, 0x0a, 0x00, 0x0e, 0x03, 0x0c, 0x0f, 0x17, 0x06, 0x15, 0x01,
+	0x15, 0xa5, 0x0d, 0x0d, 0x09, 0x09, 0x10, 0x10, 0x10, 0x06, 0x06, 0x10,
+	0x0e, 0x06, 0x19, 0x23, 0x23, 0x07, 0x0b, 0x14, 0x06, 0x0b, 0x0b, 0x05,
+	0x0b, 0x0b, 0x0b, 0x11, 0x14, 0x00, 0x14, 0x03, 0x0b, 0x0f, 0x14, 0x06,
+	0x24, 0x03, 0x0d, 0x03, 0x0d, 0x8c, 0x0b, 0x27, 0x0e, 0x11, 0x03, 0x0e,
+	0x0b, 0x0e, 0x06, 0x06, 0x06, 0x16, 0x01, 0x16, 0x93, 0x0d, 0x0d, 0x0b,
+	0x0b, 0x10, 0x10, 0x10, 0x06, 0x06, 0x10, 0x10, 0x1c, 0x1c, 0x04, 0x02,
+	0x1a, 0x16, 0x17, 0x0b, 0x01, 0x0b, 0x8f, 0x08, 0x0b, 0x0b, 0x17, 0x14,
+	0x00, 0x0a, 0x03, 0x0f, 0x0f, 0x16, 0x06, 0x17, 0x03, 0x0d, 0x03, 0x0d,
+	0x8c, 0x0b, 0x17, 0x0e, 0x17, 0x03, 0x0e, 0x0b, 0x0e, 0x06, 0x06, 0x06,
+	0x17, 0x01, 0x17, 0x05, 0x10, 0x01, 0x0d, 0x85, 0x03, 0x10, 0x10, 0x10,
+	0x0c, 0x03, 0x0c, 0x8b, 0x09, 0x16, 0x0c, 0x18, 0x14, 0x15, 0x17, 0x0f,
+	0x01, 0x17, 0x0e, 0x04, 0x0e, 0x8a, 0x0b, 0x0d, 0x00, 0x0c, 0x03, 0x0c,
+	0x10, 0x10, 0x06, 0x16, 0x01, 0x16, 0x94, 0x0d, 0x0d, 0x09, 0x09, 0x10,
+	0x10, 0x10, 0x06, 0x06, 0x10, 0x0e, 0x0d, 0x10, 0x00, 0x10, 0x03, 0x1e,
+	0x1c, 0x13, 0x0c, 0x03, 0x0c, 0xff, 0x09, 0x0c, 0x0c, 0x00, 0x0c, 0x03,
+	0x0e, 0x0e, 0x13, 0x06, 0x13, 0x13, 0x13, 0x00, 0x3a, 0x06, 0x17, 0x1b,
+	0x0e, 0x02, 0x17, 0x0d, 0x00, 0x01, 0x15, 0x06, 0x1a, 0x10, 0x1a, 0x03,
+	0x18, 0x14, 0x0a, 0x01, 0x17, 0x17, 0x0a, 0x02, 0x06, 0x2a, 0x05, 0x15,
+	0x06, 0x04, 0x0f, 0x01, 0x15, 0x18, 0x09, 0x09, 0x1d, 0x11, 0x09, 0x06,
+	0x07, 0x0f, 0x0e, 0x02, 0x03, 0x25, 0x35, 0x38, 0x27, 0x3c, 0x46, 0x30,
+	0x1f, 0x31, 0x1c, 0x05, 0x02, 0x37, 0x3b, 0x00, 0x01, 0x3c, 0x0d, 0x28,
+	0x0f, 0x15, 0x16, 0x00, 0x21, 0x2d, 0x03, 0x1b, 0x1a, 0x1c, 0x1e, 0x26,
+	0x31, 0x05, 0x2e, 0x08, 0x01, 0x0b, 0x1b, 0x1c, 0x0a, 0x03, 0x1d, 0x07,
+	0x0e, 0x03, 0x06, 0x0c, 0x03, 0x1e, 0x24, 0x0f, 0x06, 0x0a, 0x07, 0x02,
+	0x21, 0x01, 0x13, 0x05, 0x0a, 0x0c, 0x0b, 0x11, 0x11, 0x1b, 0x1b, 0x24,
+	0x0d, 0xff, 0x24, 0x04, 0x04, 0x12, 0x0c, 0x15, 0x16, 0x00, 0x48, 0x08,
+	0x0d, 0x2c, 0x12, 0x08, 0x11, 0x12, 0x06, 0x13, 0x02, 0x2d, 0x03, 0x26,
+	0x09, 0x04, 0x03, 0x27, 0x14, 0x03, 0x09, 0x16, 0x0b, 0x02, 0x03, 0x04,
+	0x19, 0x00, 0x18, 0x03, 0x15, 0x18, 0x06, 0x03, 0x24, 0x36, 0x32, 0x03,
+	0x2a, 0x0b, 0x0b, 0x03, 0x10, 0x13, 0x0d, 0x03, 0x05, 0x01, 0x18, 0x04,
+	0x0f, 0x12, 0x0e, 0x09, 0x1c, 0x1b, 0x1b, 0x12, 0x05, 0x12, 0x09, 0x05,
+	0x05, 0x03, 0x0a, 0x20, 0x0c, 0x15, 0x0d, 0x09, 0x11, 0x02, 0x1b, 0x0f,
+	0x11, 0x11, 0x16, 0x0f, 0x0a, 0x17, 0x06, 0x02, 0x0b, 0x02, 0x0b, 0x0e,
+	0x09, 0x07, 0x06, 0x11, 0x05, 0x05, 0x04, 0x0e, 0x05, 0x1a, 0x0a, 0x04,
+	0x05, 0x04, 0x02, 0x06, 0x35, 0x15, 0x02, 0x1b, 0x01, 0x12, 0x10, 0x04,
+	0x08, 0x08, 0x06, 0x06, 0x0e, 0x09, 0x05, 0x0c, 0x06, 0xff, 0x06, 0x05,
+	0x0b, 0x0c, 0x04, 0x01, 0x0e, 0x01, 0x03, 0x04, 0x1b, 0x05, 0x03, 0x03,
+	0x02, 0x08, 0x13, 0x03, 0x04, 0x18, 0x10, 0x04, 0x06, 0x0f, 0x14, 0x15,
+	0x0f, 0x05, 0x09, 0x10, 0x11, 0x18, 0x18, 0x18, 0x0f, 0x09, 0x0c, 0x13,
+	0x10, 0x0a, 0x03, 0x18, 0x0f, 0x07, 0x01, 0x03, 0x02, 0x0d, 0x03, 0x02,
+	0x03, 0x16, 0x07, 0x14, 0x15, 0x11, 0x05, 0x11, 0x11, 0x02, 0x07, 0x0a,
+	0x14, 0x04, 0x12, 0x07, 0x1d, 0x07, 0x1c, 0x0d, 0x02, 0x05, 0x0b, 0x00,
+	0x2e, 0x07, 0x04, 0x05, 0x0a, 0x05, 0x03, 0x1a, 0x0d, 0x05, 0x06, 0x04,
+	0x03, 0x0b, 0x02, 0x10, 0x01, 0x45, 0x45, 0x3d, 0x09, 0x07, 0x09, 0x1a,
+	0x08, 0x12, 0x00, 0x12, 0x13, 0x01, 0x23, 0x04, 0x06, 0x15, 0x17, 0x0e,
+	0x04, 0x0f, 0x17, 0x03, 0x09, 0x06, 0x34, 0x13, 0x13, 0x05, 0x20, 0x15,
+	0x06, 0x0d, 0x06, 0x05, 0x12, 0xff, 0x1f, 0x0f, 0x04, 0x09, 0x05, 0x13,
+	0x0e, 0x02, 0x0f, 0x02, 0x0f, 0x03, 0x0b, 0x11, 0x09, 0x03, 0x03, 0x1b,
+	0x02, 0x08, 0x04, 0x20, 0x03, 0x0a, 0x06, 0x02, 0x07, 0x19, 0x02, 0x06,
+	0x04, 0x16, 0x1d, 0x30, 0x30, 0x30, 0x1f, 0x2e, 0x30, 0x24, 0x24, 0x43,
+	0x05, 0x39, 0x09, 0x05, 0x05, 0x40, 0x33, 0x39, 0x0d, 0x11, 0x37, 0x4d,
+	0x29, 0x38, 0x04, 0x21, 0x1b, 0x17, 0x1a, 0x04, 0x1f, 0x27, 0x21, 0x03,
+	0x20, 0x02, 0x04, 0x23, 0x07, 0x05, 0x25, 0x09, 0x03, 0x25, 0x04, 0x06,
+	0x03, 0x02, 0x1f, 0x24, 0x28, 0x0a, 0x2c, 0x05, 0x1d, 0x0a, 0x08, 0x0f,
+	0x04, 0x07, 0x0a, 0x09, 0x03, 0x10, 0x0a, 0x02, 0x23, 0x02, 0x00, 0x2c,
+	0x01, 0x11, 0x04, 0x07, 0x0a, 0x26, 0x25, 0x12, 0x0e, 0x04, 0x12, 0x07,
+	0x3d, 0x0a, 0x15, 0x14, 0x12, 0x05, 0x0f, 0x0d, 0x03, 0x09, 0x04, 0x01,
+	0x09, 0xff, 0x08, 0x03, 0x01, 0x11, 0x0f, 0x03, 0x06, 0x09, 0x02, 0x08,
+	0x01, 0x04, 0x06, 0x12, 0x05, 0x03, 0x03, 0x0b, 0x05, 0x05, 0x06, 0x08,
+	0x03, 0x27, 0x09, 0x07, 0x03, 0x05, 0x01, 0x16, 0x0a, 0x00, 0x13, 0x07,
+	0x0e, 0x05, 0x0e, 0x07, 0x14, 0x08, 0x09, 0x05, 0x09, 0x0b, 0x02, 0x07,
+	0x0f, 0x05, 0x03, 0x06, 0x08, 0x0c, 0x06, 0x04, 0x28, 0x06, 0x13, 0x14,
+	0x0c, 0x14, 0x07, 0x08, 0x15, 0x09, 0x0a, 0x0d, 0x14, 0x03, 0x05, 0x12,
+	0x08, 0x11, 0x00, 0x0d, 0x06, 0x17, 0x07, 0x44, 0x09, 0x0a, 0x16, 0x2a,
+	0x05, 0x03, 0x04, 0x07, 0x03, 0x37, 0x14, 0x0c, 0x06, 0x0e, 0x2e, 0x44,
+	0x03, 0x2f, 0x00, 0x01, 0x08, 0x0a, 0x1a, 0x04, 0x15, 0x11, 0x0f, 0x0a,
+	0x07, 0x08, 0x03, 0x04, 0x03, 0x03, 0x0c, 0x05, 0x1a, 0x04, 0x16, 0x1a,
+	0x07, 0x08, 0x01, 0x14, 0x05, 0x32, 0x0e, 0x02, 0x0b, 0xff, 0x01, 0x0a,
+	0x09, 0x08, 0x08, 0x05, 0x0d, 0x19, 0x0c, 0x1b, 0x09, 0x46, 0x01, 0x09,
+	0x04, 0x02, 0x4a, 0x4c, 0x02, 0x12, 0x16, 0x06, 0x03, 0x33, 0x0c, 0x14,
+	0x15, 0x0f, 0x11, 0x06, 0x08, 0x08, 0x02, 0x11, 0x05, 0x08, 0x19, 0x07,
+	0x05, 0x03, 0x0b, 0x0e, 0x0a, 0x09, 0x05, 0x4d, 0x0e, 0x2b, 0x0d, 0x24,
+	0x37, 0x0c, 0x22, 0x08, 0x09, 0x23, 0x07, 0x24, 0x11, 0x05, 0x10, 0x08,
+	0x02, 0x17, 0x03, 0x03, 0x08, 0x04, 0x03, 0x03, 0x02, 0x13, 0x06, 0x04,
+	0x13, 0x09, 0x1a, 0x37, 0x07, 0x05, 0x01, 0x15, 0x05, 0x0a, 0x1a, 0x05,
+	0x02, 0x05, 0x02, 0x01, 0x02, 0x04, 0x1b, 0x0a, 0x1d, 0x05, 0x2d, 0x01,
+	0x11, 0x0e, 0x07, 0x08, 0x07, 0x03, 0x05, 0x04, 0x0f, 0x02, 0x10, 0x03,
+	0x0f, 0x01, 0x04, 0x1f, 0x07, 0x11, 0x07, 0x0a, 0x06, 0x0a, 0x06, 0x04,
+	0x2c, 0x08, 0x03, 0x0b, 0x06, 0xc8, 0x0a, 0x27, 0x2f, 0x2f, 0x14, 0x05,
+	0x0b, 0x09, 0x05, 0x05, 0x0f, 0x1f, 0x1e, 0x05, 0x0c, 0x0d, 0x41, 0x17,
+	0x00, 0x41, 0x0c, 0x0f, 0x0d, 0x11, 0x09, 0x09, 0x11, 0x06, 0x06, 0x11,
+	0x0f, 0x11, 0x04, 0x09, 0x08, 0x04, 0x2b, 0x0f, 0x04, 0x30, 0x05, 0x0b,
+	0x0b, 0x08, 0x0b, 0x0b, 0x0a, 0x0b, 0x04, 0x09, 0x08, 0x04, 0x02, 0x0c,
+	0x10, 0x04, 0x1d, 0x03, 0x0d, 0x0a, 0x04, 0x08, 0x1c, 0x03, 0x18, 0x18,
+	0x07, 0x15, 0x23, 0x05, 0x06, 0x04, 0x03, 0x04, 0xd1, 0x24, 0x0b, 0x02,
+	0x0b, 0x05, 0x0b, 0x0b, 0x07, 0x03, 0x0b, 0x0b, 0x07, 0x03, 0x2e, 0x41,
+	0x18, 0x18, 0x09, 0x05, 0x11, 0x07, 0x0b, 0x16, 0x16, 0x06, 0x06, 0x16,
+	0x15, 0x16, 0x04, 0x09, 0x08, 0x04, 0x10, 0x10, 0x04, 0x17, 0x05, 0x0b,
+	0x0b, 0x08, 0x0b, 0x0b, 0x0a, 0x0b, 0x04, 0x09, 0x08, 0x04, 0x02, 0x0c,
+	0x17, 0x04, 0x14, 0x03, 0x14, 0x0a, 0x04, 0x08, 0x0f, 0x03, 0x0f, 0x14,
+	0x07, 0x03, 0x08, 0x02, 0x08, 0x03, 0x08, 0x08, 0x08, 0x03, 0x08, 0x08,
+	0x07, 0x17, 0x17, 0x05, 0x06, 0x04, 0x03, 0x04, 0x82, 0x0b, 0x17, 0x02,
+	0x17, 0x8e, 0x0f, 0x09, 0x0f, 0x0f, 0x0b, 0x03, 0x0f, 0x0f, 0x0d, 0x0f,
+	0x0f, 0x05, 0x06, 0x04, 0x03, 0x04, 0xae, 0x08, 0x16, 0x16, 0x0a, 0x06,
+	0x16, 0x15, 0x16, 0x04, 0x16, 0x08, 0x04, 0x18, 0x0f, 0x00, 0x07, 0x18,
+	0x05, 0x0b, 0x0b, 0x09, 0x0b, 0x06, 0x09, 0x0b, 0x04, 0x0b, 0x08, 0x04,
+	0x02, 0x0c, 0x17, 0x04, 0x18, 0x03, 0x13, 0x0a, 0x04, 0x08, 0x10, 0x03,
+	0x0f, 0x13, 0x07, 0x03, 0x17, 0x01, 0x17, 0xb2, 0x09, 0x05, 0x0e, 0x07,
+	0x0b, 0x13, 0x13, 0x06, 0x06, 0x13, 0x12, 0x13, 0x04, 0x09, 0x08, 0x04,
+	0x01, 0x05, 0x04, 0x15, 0x15, 0x04, 0x0a, 0x0a, 0x05, 0x0a, 0x07, 0x08,
+	0x0a, 0x04, 0x0a, 0x08, 0x04, 0x02, 0x0b, 0x15, 0x04, 0x15, 0x03, 0x15,
+	0x0a, 0x04, 0x08, 0x15, 0x03, 0x15, 0x15, 0x07, 0x03, 0x15, 0x01, 0x15,
+	0xa7, 0x09, 0x05, 0x0e, 0x07, 0x0b, 0x13, 0x13, 0x06, 0x06, 0x13, 0x12,
+	0x13, 0x04, 0x09, 0x08, 0x04, 0x1a, 0x18, 0x13, 0x04, 0x0b, 0x16, 0x02,
+	0x02, 0x0c, 0x09, 0x0c, 0x0c, 0x0a, 0x0c, 0x04, 0x0c, 0x08, 0x04, 0x02,
+	0x0d, 0x16, 0x04, 0x12, 0x01, 0x12, 0xa7, 0x09, 0x0c, 0x09, 0x09, 0x08,
+	0x0e, 0x0e, 0x06, 0x06, 0x0e, 0x0d, 0x0e, 0x04, 0x09, 0x08, 0x04, 0x20,
+	0x12, 0x05, 0x16, 0x09, 0x12, 0x07, 0x0c, 0x0c, 0x06, 0x05, 0x0c, 0x0a,
+	0x0c, 0x04, 0x0c, 0x08, 0x04, 0x02, 0x0d, 0x12, 0x04, 0x12, 0x01, 0x12,
+	0xba, 0x09, 0x0c, 0x09, 0x09, 0x08, 0x0e, 0x0e, 0x06, 0x06, 0x0e, 0x0d,
+	0x0e, 0x04, 0x09, 0x08, 0x04, 0x18, 0x14, 0x04, 0x03, 0x02, 0x08, 0x14,
+	0x0a, 0x2d, 0x13, 0x09, 0x0d, 0x04, 0x0b, 0x07, 0x0d, 0x0a, 0x0d, 0x04,
+	0x0c, 0x08, 0x04, 0x02, 0x0e, 0x13, 0x04, 0x19, 0x03, 0x0f, 0x0a, 0x04,
+	0x08, 0x15, 0x03, 0x19, 0x19, 0x07, 0x18, 0x1a, 0x05, 0x06, 0x04, 0x03,
+	0x04, 0x82, 0x1b, 0x1a, 0x01, 0x1a, 0xba, 0x0c, 0x08, 0x11, 0x08, 0x0e,
+	0x16, 0x16, 0x06, 0x06, 0x16, 0x15, 0x16, 0x04, 0x09, 0x08, 0x04, 0x0f,
+	0x13, 0x04, 0x03, 0x14, 0x09, 0x19, 0x0b, 0x19, 0x19, 0x0a, 0x0e, 0x04,
+	0x0c, 0x07, 0x0e, 0x0a, 0x0e, 0x04, 0x0c, 0x08, 0x04, 0x02, 0x0f, 0x19,
+	0x04, 0x19, 0x03, 0x0f, 0x0a, 0x04, 0x08, 0x11, 0x03, 0x11, 0x19, 0x07,
+	0x19, 0x19, 0x05, 0x06, 0x04, 0x03, 0x04, 0x82, 0x0b, 0x19, 0x02, 0x19,
+	0xba, 0x0d, 0x09, 0x11, 0x09, 0x0f, 0x16, 0x16, 0x06, 0x06, 0x16, 0x15,
+	0x16, 0x04, 0x09, 0x08, 0x04, 0x1a, 0x16, 0x04, 0x03, 0x12, 0x1a, 0x21,
+	0x00, 0x01, 0x1a, 0x08, 0x0e, 0x0e, 0x0b, 0x0e, 0x0e, 0x0a, 0x0e, 0x04,
+	0x0c, 0x08, 0x04, 0x02, 0x0f, 0x15, 0x04, 0x1a, 0x03, 0x10, 0x0a, 0x04,
+	0x08, 0x10, 0x03, 0x1a, 0x1a, 0x07, 0x1a, 0x1a, 0x05, 0x06, 0x04, 0x03,
+	0x04, 0x03, 0x1a, 0xba, 0x0c, 0x08, 0x11, 0x08, 0x0e, 0x16, 0x16, 0x06,
+	0x06, 0x16, 0x15, 0x16, 0x04, 0x09, 0x08, 0x04, 0x0f, 0x13, 0x04, 0x03,
+	0x03, 0x18, 0x19, 0x00, 0x01, 0x19, 0x07, 0x0d, 0x0d, 0x0a, 0x0d, 0x0d,
+	0x0a, 0x0d, 0x04, 0x0c, 0x08, 0x04, 0x02, 0x0e, 0x19, 0x04, 0x19, 0x03,
+	0x19, 0x0a, 0x04, 0x08, 0x10, 0x03, 0x11, 0x19, 0x07, 0x19, 0x19, 0x05,
+	0x06, 0x04, 0x03, 0x04, 0x82, 0x0b, 0x19, 0x01, 0x19, 0xff, 0x00, 0x34,
+	0x16, 0x0d, 0x08, 0x0c, 0x0e, 0x14, 0x16, 0x18, 0x01, 0x1c, 0x06, 0x08,
+	0x04, 0x13, 0x03, 0x1a, 0x08, 0x12, 0x01, 0x02, 0x05, 0x0a, 0x05, 0x14,
+	0x0c, 0x1c, 0x01, 0x08, 0x03, 0x02, 0x02, 0x23, 0x09, 0x03, 0x0a, 0x18,
+	0x08, 0x3c, 0x19, 0x04, 0x1a, 0x04, 0x02, 0x1a, 0x0f, 0x08, 0x04, 0x02,
+	0x02, 0x01, 0x03, 0x12, 0x12, 0x05, 0x02, 0x05, 0x10, 0x11, 0x09, 0x03,
+	0x10, 0x06, 0x1f, 0x0c, 0x11, 0x11, 0x07, 0x11, 0x0d, 0x04, 0x0f, 0x16,
+	0x1e, 0x02, 0x14, 0x0d, 0x09, 0x08, 0x0b, 0x01, 0x02, 0x0e, 0x0f, 0x00,
+	0x11, 0x0f, 0x3e, 0x13, 0x09, 0x01, 0x0b, 0x02, 0x10, 0x3e, 0x05, 0x01,
+	0x16, 0x07, 0x03, 0x07, 0x06, 0x01, 0x00, 0x12, 0x1c, 0x03, 0x07, 0x05,
+	0x01, 0x07, 0x07, 0x03, 0x07, 0x05, 0x01, 0x0d, 0x18, 0x17, 0x08, 0x06,
+	0x01, 0x08, 0x08, 0x0f, 0x15, 0xff, 0x17, 0x03, 0x12, 0x13, 0x02, 0x10,
+	0x0e, 0x11, 0x02, 0x01, 0x03, 0x08, 0x0c, 0x05, 0x03, 0x0e, 0x11, 0x10,
+	0x14, 0x0b, 0x14, 0x07, 0x0d, 0x16, 0x04, 0x0f, 0x0a, 0x0e, 0x13, 0x07,
+	0x04, 0x04, 0x13, 0x0b, 0x04, 0x01, 0x0d, 0x01, 0x0c, 0x13, 0x05, 0x01,
+	0x06, 0x10, 0x08, 0x0d, 0x03, 0x05, 0x11, 0x0c, 0x11, 0x10, 0x0d, 0x08,
+	0x0a, 0x07, 0x01, 0x08, 0x0a, 0x07, 0x06, 0x03, 0x03, 0x07, 0x09, 0x11,
+	0x04, 0x17, 0x03, 0x06, 0x0c, 0x1c, 0x26, 0x06, 0x0c, 0x0a, 0x07, 0x00,
+	0x07, 0x0b, 0x0e, 0x0d, 0x06, 0x01, 0x07, 0x13, 0x07, 0x02, 0x08, 0x0e,
+	0x03, 0x0e, 0x04, 0x0e, 0x03, 0x0b, 0x0e, 0x0d, 0x05, 0x38, 0x16, 0x16,
+	0x19, 0x0a, 0x0a, 0x06, 0x17, 0x0d, 0x19, 0x0c, 0x04, 0x12, 0x07, 0x02,
+	0x06, 0x06, 0x15, 0x0e, 0x04, 0x14, 0x06, 0x11, 0x00, 0x03, 0x0c, 0x03,
+	0x0c, 0xff, 0x05, 0x04, 0x03, 0x26, 0x08, 0x03, 0x18, 0x0d, 0x01, 0x05,
+	0x06, 0x08, 0x05, 0x10, 0x09, 0x08, 0x19, 0x0f, 0x15, 0x09, 0x04, 0x15,
+	0x08, 0x04, 0x03, 0x02, 0x10, 0x02, 0x02, 0x17, 0x0e, 0x0e, 0x1d, 0x02,
+	0x12, 0x00, 0x01, 0x01, 0x18, 0x05, 0x01, 0x06, 0x0a, 0x10, 0x01, 0x0d,
+	0x07, 0x09, 0x1b, 0x06, 0x09, 0x0e, 0x17, 0x0d, 0x02, 0x08, 0x05, 0x0f,
+	0x08, 0x1b, 0x16, 0x0b, 0x03, 0x01, 0x08, 0x07, 0x07, 0x01, 0x17, 0x04,
+	0x0d, 0x01, 0x04, 0x15, 0x15, 0x07, 0x15, 0x08, 0x0c, 0x0d, 0x04, 0x09,
+	0x08, 0x02, 0x15, 0x05, 0x18, 0x0b, 0x0e, 0x13, 0x07, 0x31, 0x01, 0x03,
+	0x0a, 0x00, 0x24, 0x03, 0x08, 0x0a, 0x0c, 0x05, 0x04, 0x10, 0x02, 0x1a,
+	0x03, 0x02, 0x13, 0x05, 0x07, 0x13, 0x01, 0x34, 0x0e, 0x07, 0x05, 0x09,
+	0x03, 0x11, 0x01, 0x04, 0x14, 0x14, 0x0d, 0x14, 0x08, 0xff, 0x0a, 0x0d,
+	0x04, 0x09, 0x17, 0x16, 0x06, 0x0c, 0x0c, 0x14, 0x0d, 0x11, 0x0b, 0x13,
+	0x00, 0x03, 0x02, 0x11, 0x12, 0x1b, 0x0f, 0x16, 0x0a, 0x07, 0x0c, 0x0c,
+	0x03, 0x03, 0x07, 0x02, 0x07, 0x13, 0x08, 0x02, 0x09, 0x17, 0x12, 0x13,
+	0x07, 0x09, 0x07, 0x08, 0x02, 0x0b, 0x0b, 0x0d, 0x13, 0x04, 0x0f, 0x03,
+	0x1b, 0x0e, 0x0d, 0x01, 0x12, 0x06, 0x1f, 0x04, 0x0f, 0x1a, 0x04, 0x0c,
+	0x0c, 0x0f, 0x03, 0x09, 0x02, 0x0d, 0x05, 0x04, 0x0f, 0x0f, 0x02, 0x0c,
+	0x03, 0x17, 0x08, 0x16, 0x08, 0x05, 0x01, 0x08, 0x09, 0x13, 0x1f, 0x1f,
+	0x07, 0x00, 0x21, 0x0e, 0x06, 0x0d, 0x1f, 0x41, 0x32, 0x40, 0x35, 0x03,
+	0x23, 0x05, 0x01, 0x06, 0x1a, 0x10, 0x02, 0x09, 0x02, 0x1d, 0x02, 0x1d,
+	0x05, 0x1a, 0x1d, 0x00, 0x15, 0x08, 0x08, 0x07, 0x1b, 0x02, 0x07, 0x16,
+	0x01, 0x1e, 0x05, 0x06, 0x04, 0xff, 0x1a, 0x02, 0x02, 0x13, 0x04, 0x03,
+	0x07, 0x0d, 0x03, 0x00, 0x1c, 0x04, 0x0d, 0x07, 0x02, 0x1f, 0x08, 0x0b,
+	0x0f, 0x02, 0x04, 0x11, 0x1a, 0x0a, 0x01, 0x05, 0x05, 0x1b, 0x13, 0x06,
+	0x01, 0x07, 0x06, 0x0b, 0x0b, 0x08, 0x08, 0x09, 0x0e, 0x19, 0x04, 0x04,
+	0x06, 0x0b, 0x01, 0x03, 0x07, 0x07, 0x04, 0x07, 0x20, 0x0a, 0x05, 0x08,
+	0x06, 0x03, 0x0c, 0x0b, 0x1d, 0x08, 0x16, 0x0e, 0x05, 0x01, 0x06, 0x17,
+	0x01, 0x04, 0x10, 0x20, 0x0e, 0x10, 0x01, 0x18, 0x06, 0x0a, 0x0e, 0x16,
+	0x14, 0x03, 0x04, 0x11, 0x05, 0x08, 0x02, 0x03, 0x06, 0x16, 0x03, 0x0b,
+	0x11, 0x01, 0x21, 0x01, 0x19, 0x28, 0x08, 0x06, 0x0a, 0x15, 0x0c, 0x01,
+	0x04, 0x1a, 0x02, 0x10, 0x10, 0x04, 0x05, 0x0a, 0x0c, 0x0d, 0x12, 0x08,
+	0x19, 0x06, 0x0c, 0x0a, 0x08, 0x0e, 0x0e, 0x0b, 0x21, 0x18, 0x04, 0x1a,
+	0x08, 0xff, 0x07, 0x13, 0x04, 0x0a, 0x08, 0x01, 0x07, 0x07, 0x12, 0x04,
+	0x14, 0x05, 0x02, 0x19, 0x12, 0x10, 0x01, 0x07, 0x07, 0x0f, 0x19, 0x06,
+	0x01, 0x07, 0x0d, 0x09, 0x02, 0x0c, 0x0d, 0x01, 0x24, 0x0f, 0x09, 0x07,
+	0x16, 0x01, 0x0f, 0x14, 0x21, 0x15, 0x00, 0x4f, 0x10, 0x13, 0x0c, 0x0e,
+	0x0c, 0x04, 0x04, 0x03, 0x11, 0x42, 0x49, 0x3d, 0x00, 0x14, 0x04, 0x01,
+	0x05, 0x02, 0x1f, 0x24, 0x24, 0x24, 0x03, 0x06, 0x05, 0x01, 0x06, 0x13,
+	0x18, 0x02, 0x1b, 0x02, 0x0d, 0x24, 0x04, 0x16, 0x01, 0x1d, 0x02, 0x07,
+	0x19, 0x18, 0x20, 0x06, 0x02, 0x05, 0x04, 0x1f, 0x09, 0x05, 0x23, 0x0c,
+	0x0a, 0x00, 0x04, 0x06, 0x05, 0x27, 0x7e, 0x43, 0x40, 0x0e, 0x36, 0x06,
+	0x10, 0x09, 0x26, 0x01, 0x1e, 0x03, 0x06, 0x02, 0x0f, 0x06, 0x24, 0x03,
+	0x21, 0x02, 0x08, 0x20, 0x07, 0x03, 0x05, 0x16, 0x2b, 0xff, 0x08, 0x05,
+	0x03, 0x02, 0x15, 0x16, 0x00, 0x07, 0x26, 0x03, 0x09, 0x0e, 0x0e, 0x07,
+	0x06, 0x0b, 0x02, 0x05, 0x22, 0x06, 0x03, 0x0a, 0x04, 0x08, 0x09, 0x2c,
+	0x25, 0x06, 0x2c, 0x09, 0x09, 0x03, 0x1e, 0x42, 0x26, 0x22, 0x21, 0x04,
+	0x01, 0x05, 0x02, 0x22, 0x24, 0x24, 0x06, 0x03, 0x06, 0x05, 0x01, 0x06,
+	0x22, 0x12, 0x0b, 0x01, 0x03, 0x10, 0x14, 0x2a, 0x1a, 0x14, 0x22, 0x01,
+	0x16, 0x1a, 0x29, 0x0b, 0x1b, 0x26, 0x1e, 0x1c, 0x04, 0x1f, 0x05, 0x07,
+	0x02, 0x01, 0x26, 0x03, 0x04, 0x10, 0x0c, 0x02, 0x11, 0x10, 0x12, 0x04,
+	0x12, 0x05, 0x05, 0x1d, 0x07, 0x1d, 0x1d, 0x0c, 0x05, 0x04, 0x0b, 0x13,
+	0x0a, 0x0e, 0x0a, 0x05, 0x06, 0x13, 0x06, 0x0c, 0x1e, 0x05, 0x03, 0x09,
+	0x00, 0x0f, 0x05, 0x03, 0x06, 0x0b, 0x04, 0x11, 0x07, 0x16, 0x06, 0x14,
+	0x03, 0x08, 0x03, 0x12, 0x0c, 0xff, 0x0d, 0x05, 0x16, 0x10, 0x0b, 0x14,
+	0x0f, 0x06, 0x0c, 0x08, 0x08, 0x0e, 0x0e, 0x15, 0x06, 0x06, 0x08, 0x02,
+	0x1f, 0x00, 0x01, 0x01, 0x07, 0x02, 0x06, 0x17, 0x08, 0x0c, 0x0c, 0x04,
+	0x09, 0x06, 0x02, 0x12, 0x0c, 0x17, 0x0a, 0x17, 0x17, 0x07, 0x0a, 0x01,
+	0x04, 0x13, 0x03, 0x03, 0x03, 0x08, 0x2c, 0x0c, 0x03, 0x0a, 0x02, 0x12,
+	0x14, 0x06, 0x0f, 0x04, 0x0e, 0x06, 0x07, 0x05, 0x04, 0x02, 0x02, 0x0c,
+	0x06, 0x05, 0x04, 0x14, 0x0c, 0x07, 0x13, 0x0b, 0x0d, 0x11, 0x2d, 0x08,
+	0x03, 0x0a, 0x0c, 0x0c, 0x03, 0x0a, 0x15, 0x15, 0x03, 0x16, 0x04, 0x02,
+	0x13, 0x10, 0x09, 0x11, 0x19, 0x0c, 0x0c, 0x0c, 0x08, 0x03, 0x07, 0x0f,
+	0x08, 0x0c, 0x01, 0x09, 0x09, 0x06, 0x14, 0x04, 0x04, 0x05, 0x12, 0x04,
+	0x05, 0x03, 0x05, 0x0e, 0x0c, 0x02, 0x06, 0x07, 0x0d, 0x0e, 0x18, 0x09,
+	0x0d, 0xff, 0x07, 0x2d, 0x0f, 0x04, 0x28, 0x08, 0x09, 0x0d, 0x04, 0x11,
+	0x06, 0x04, 0x0e, 0x02, 0x04, 0x05, 0x02, 0x03, 0x0c, 0x02, 0x07, 0x0b,
+	0x0b, 0x08, 0x10, 0x09, 0x0f, 0x0b, 0x08, 0x03, 0x07, 0x07, 0x0d, 0x04,
+	0x12, 0x10, 0x29, 0x07, 0x09, 0x09, 0x06, 0x03, 0x09, 0x04, 0x0c, 0x0e,
+	0x1c, 0x05, 0x03, 0x14, 0x00, 0x0a, 0x05, 0x03, 0x06, 0x0d, 0x04, 0x0f,
+	0x07, 0x05, 0x02, 0x11, 0x03, 0x01, 0x0b, 0x08, 0x11, 0x02, 0x06, 0x0c,
+	0x09, 0x08, 0x11, 0x09, 0x08, 0x0a, 0x16, 0x18, 0x0b, 0x0b, 0x0a, 0x00,
+	0x0a, 0x06, 0x0a, 0x09, 0x05, 0x11, 0x00, 0x05, 0x0a, 0x01, 0x03, 0x05,
+	0x03, 0x15, 0x25, 0x07, 0x08, 0x0a, 0x02, 0x19, 0x05, 0x02, 0x10, 0x09,
+	0x0b, 0x0b, 0x0b, 0x01, 0x01, 0x0f, 0x15, 0x12, 0x15, 0x07, 0x09, 0x12,
+	0x13, 0x11, 0x0f, 0x10, 0x05, 0x31, 0x3e, 0x2c, 0x24, 0xff, 0x36, 0x34,
+	0x03, 0x21, 0x37, 0x01, 0x33, 0x28, 0x09, 0x0a, 0x0e, 0x12, 0x02, 0x0f,
+	0x0e, 0x10, 0x1d, 0x17, 0x1e, 0x14, 0x07, 0x08, 0x04, 0x06, 0x04, 0x25,
+	0x05, 0x0e, 0x16, 0x06, 0x1f, 0x04, 0x23, 0x03, 0x0a, 0x00, 0x03, 0x0d,
+	0x06, 0x0e, 0x1b, 0x1b, 0x0c, 0x06, 0x0e, 0x06, 0x03, 0x03, 0x06, 0x08,
+	0x00, 0x10, 0x09, 0x03, 0x07, 0x0a, 0x04, 0x0a, 0x07, 0x04, 0x03, 0x1b,
+	0x1f, 0x0a, 0x05, 0x04, 0x1d, 0x02, 0x09, 0x01, 0x0f, 0x08, 0x03, 0x01,
+	0x0a, 0x0b, 0x05, 0x05, 0x04, 0x07, 0x1d, 0x07, 0x0f, 0x0a, 0x07, 0x1e,
+	0x25, 0x06, 0x06, 0x08, 0x0b, 0x09, 0x0f, 0x25, 0x09, 0x13, 0x13, 0x06,
+	0x0f, 0x02, 0x04, 0x16, 0x0e, 0x0b, 0x09, 0x10, 0x05, 0x0c, 0x07, 0x06,
+	0x03, 0x28, 0x2b, 0x31, 0x1f, 0x00, 0x2a, 0x04, 0x01, 0x05, 0x02, 0x1e,
+	0x2c, 0x2c, 0x25, 0x03, 0x06, 0xff, 0x05, 0x01, 0x06, 0x13, 0x13, 0x1d,
+	0x00, 0x1d, 0x12, 0x17, 0x12, 0x07, 0x1d, 0x12, 0x02, 0x0b, 0x19, 0x03,
+	0x00, 0x07, 0x06, 0x03, 0x16, 0x03, 0x03, 0x0d, 0x06, 0x01, 0x07, 0x04,
+	0x09, 0x07, 0x03, 0x05, 0x06, 0x15, 0x04, 0x09, 0x09, 0x1b, 0x07, 0x17,
+	0x03, 0x1d, 0x05, 0x0c, 0x0a, 0x01, 0x1f, 0x0f, 0x00, 0x44, 0x1e, 0x0c,
+	0x0e, 0x0e, 0x09, 0x03, 0x0d, 0x1d, 0x06, 0x0e, 0x07, 0x10, 0x1d, 0x15,
+	0x2b, 0x12, 0x05, 0x03, 0x05, 0x14, 0x0a, 0x02, 0x13, 0x02, 0x05, 0x0e,
+	0x0e, 0x03, 0x16, 0x08, 0x16, 0x10, 0x0b, 0x01, 0x29, 0x06, 0x11, 0x04,
+	0x0d, 0x03, 0x06, 0x09, 0x02, 0x17, 0x0e, 0x05, 0x04, 0x04, 0x05, 0x08,
+	0x02, 0x03, 0x06, 0x0a, 0x0d, 0x01, 0x07, 0x21, 0x06, 0x04, 0x09, 0x02,
+	0x18, 0x13, 0x10, 0x0f, 0x09, 0x09, 0x2b, 0x18, 0x11, 0x19, 0x09, 0x01,
+	0x03, 0xff, 0x19, 0x23, 0x0a, 0x09, 0x0b, 0x0c, 0x02, 0x02, 0x02, 0x0b,
+	0x0d, 0x0e, 0x03, 0x19, 0x05, 0x01, 0x15, 0x16, 0x00, 0x15, 0x05, 0x09,
+	0x14, 0x15, 0x06, 0x06, 0x23, 0x06, 0x0d, 0x0c, 0x1c, 0x07, 0x2d, 0x01,
+	0x17, 0x06, 0x0f, 0x07, 0x04, 0x03, 0x09, 0x0c, 0x19, 0x07, 0x0c, 0x01,
+	0x0e, 0x06, 0x05, 0x10, 0x02, 0x0a, 0x03, 0x11, 0x05, 0x04, 0x07, 0x03,
+	0x10, 0x03, 0x06, 0x0c, 0x0c, 0x03, 0x17, 0x10, 0x07, 0x1a, 0x0b, 0x1a,
+	0x14, 0x0f, 0x0d, 0x10, 0x11, 0x0c, 0x16, 0x25, 0x05, 0x06, 0x01, 0x1d,
+	0x05, 0x11, 0x01, 0x04, 0x14, 0x11, 0x06, 0x03, 0x04, 0x03, 0x06, 0x04,
+	0x11, 0x05, 0x11, 0x07, 0x06, 0x05, 0x08, 0x02, 0x01, 0x12, 0x09, 0x03,
+	0x0d, 0x02, 0x0f, 0x10, 0x12, 0x00, 0x01, 0x01, 0x02, 0x05, 0x0a, 0x12,
+	0x02, 0x1b, 0x0c, 0x0a, 0x0d, 0x09, 0x09, 0x1c, 0x1b, 0xff, 0x10, 0x1c,
+	0x09, 0x01, 0x03, 0x0a, 0x45, 0x12, 0x0a, 0x01, 0x13, 0x11, 0x13, 0x01,
+	0x04, 0x0f, 0x07, 0x04, 0x0f, 0x07, 0x02, 0x03, 0x0c, 0x03, 0x0e, 0x03,
+	0x13, 0x09, 0x15, 0x06, 0x13, 0x06, 0x13, 0x13, 0x14, 0x17, 0x0f, 0x09,
+	0x18, 0x0c, 0x06, 0x08, 0x0a, 0x18, 0x08, 0x06, 0x07, 0x07, 0x0f, 0x10,
+	0x03, 0x03, 0x06, 0x0d, 0x00, 0x17, 0x11, 0x06, 0x06, 0x02, 0x08, 0x07,
+	0x11, 0x0a, 0x10, 0x00, 0x06, 0x0f, 0x05, 0x12, 0x10, 0x1e, 0x05, 0x1d,
+	0x05, 0x10, 0x0d, 0x04, 0x03, 0x0c, 0x07, 0x11, 0x06, 0x02, 0x10, 0x12,
+	0x10, 0x0d, 0x1b, 0x09, 0x1d, 0x07, 0x06, 0x0a, 0x08, 0x04, 0x0f, 0x06,
+	0x01, 0x06, 0x0f, 0x0d, 0x0f, 0x05, 0x0c, 0x0a, 0x0a, 0x16, 0x0e, 0x10,
+	0x08, 0x07, 0x17, 0x0b, 0x08, 0x01, 0x02, 0x09, 0x16, 0x05, 0x03, 0x03,
+	0x08, 0x12, 0x09, 0x05, 0x06, 0xff, 0x09, 0x09, 0x17, 0x07, 0x06, 0x06,
+	0x11, 0x14, 0x02, 0x04, 0x04, 0x07, 0x03, 0x1b, 0x26, 0x26, 0x26, 0x00,
+	0x1e, 0x04, 0x01, 0x05, 0x02, 0x23, 0x26, 0x26, 0x26, 0x03, 0x06, 0x05,
+	0x01, 0x18, 0x07, 0x0d, 0x0d, 0x0d, 0x03, 0x06, 0x2f, 0x0e, 0x0a, 0x09,
+	0x04, 0x01, 0x05, 0x02, 0x0a, 0x0c, 0x0c, 0x06, 0x03, 0x06, 0x05, 0x01,
+	0x06, 0x17, 0x1b, 0x19, 0x18, 0x17, 0x03, 0x15, 0x06, 0x18, 0x02, 0x18,
+	0x17, 0x09, 0x18, 0x1f, 0x1f, 0x0b, 0x20, 0x0c, 0x16, 0x19, 0x0d, 0x19,
+	0x19, 0x04, 0x03, 0x0e, 0x0e, 0x07, 0x20, 0x04, 0x24, 0x0b, 0x0c, 0x01,
+	0x1e, 0x09, 0x0b, 0x01, 0x04, 0x06, 0x10, 0x13, 0x02, 0x05, 0x0d, 0x06,
+	0x03, 0x06, 0x10, 0x0d, 0x03, 0x0d, 0x05, 0x03, 0x11, 0x08, 0x08, 0x06,
+	0x01, 0x0f, 0x21, 0x07, 0x25, 0x01, 0x0b, 0x25, 0x17, 0x00, 0x26, 0x08,
+	0x05, 0xff, 0x09, 0x1a, 0x1f, 0x22, 0x22, 0x00, 0x1d, 0x04, 0x01, 0x05,
+	0x18, 0x18, 0x0d, 0x01, 0x18, 0x0a, 0x12, 0x01, 0x04, 0x17, 0x07, 0x1d,
+	0x07, 0x16, 0x03, 0x02, 0x17, 0x05, 0x16, 0x04, 0x1c, 0x09, 0x02, 0x08,
+	0x12, 0x05, 0x06, 0x05, 0x09, 0x06, 0x09, 0x0b, 0x02, 0x0b, 0x19, 0x05,
+	0x03, 0x04, 0x1a, 0x0e, 0x08, 0x04, 0x19, 0x04, 0x05, 0x0c, 0x04, 0x28,
+	0x0c, 0x03, 0x0b, 0x06, 0x0a, 0x26, 0x2c, 0x2c, 0x13, 0x28, 0x09, 0x00,
+	0x0a, 0x21, 0x1d, 0x0f, 0x0d, 0x0c, 0x15, 0x02, 0x0f, 0x10, 0x14, 0x0f,
+	0x12, 0x0c, 0x05, 0x0c, 0x24, 0x2b, 0x02, 0x0e, 0x04, 0x02, 0x04, 0x46,
+	0x02, 0x03, 0x09, 0x14, 0x2a, 0x03, 0x04, 0x2b, 0x01, 0x02, 0x05, 0x05,
+	0x05, 0x03, 0x1c, 0x18, 0x1b, 0x04, 0x1b, 0x13, 0x10, 0x10, 0x08, 0x12,
+	0x13, 0x04, 0x03, 0x04, 0x0c, 0x1b, 0x04, 0x04, 0x27, 0xac, 0x0b, 0x0c,
+	0x05, 0x06, 0x09, 0x06, 0x02, 0x08, 0x18, 0x10, 0x28, 0x2a, 0x2a, 0x16,
+	0x03, 0x1f, 0x1f, 0x25, 0x25, 0x25, 0x00, 0x09, 0x3a, 0x0b, 0x00, 0x3a,
+	0x21, 0x1c, 0x12, 0x12, 0x11, 0x18, 0x15, 0x06, 0x06, 0x21, 0x0f, 0x24,
+	0x24, 0x08, 0x00, 0x32, 0x01, 0x09, 0x03, 0x09, 0xff, 0x0b, 0x0b, 0x0f,
+	0x06, 0x1a, 0x23, 0x04, 0x03, 0x08, 0x06, 0x03, 0x1d, 0x03, 0x1e, 0x07,
+	0x20, 0x04, 0x08, 0x13, 0x13, 0x00, 0x20, 0x08, 0x11, 0x0c, 0x2c, 0x03,
+	0x08, 0x09, 0x0c, 0x02, 0x05, 0x0a, 0x03, 0x08, 0x06, 0x08, 0x05, 0x08,
+	0x03, 0x07, 0x08, 0x07, 0x02, 0x39, 0x09, 0x03, 0x09, 0x06, 0x09, 0x09,
+	0x09, 0x03, 0x08, 0x09, 0x07, 0x23, 0x33, 0x3a, 0x0e, 0x00, 0x2d, 0x17,
+	0x0b, 0x0c, 0x08, 0x02, 0x02, 0x02, 0x24, 0x01, 0x21, 0x01, 0x2a, 0x1a,
+	0x04, 0x0c, 0x00, 0x0e, 0x03, 0x05, 0x04, 0x02, 0x15, 0x12, 0x11, 0x11,
+	0x06, 0x06, 0x01, 0x0a, 0x56, 0x00, 0x02, 0x17, 0x1e, 0x05, 0x0e, 0x00,
+	0x04, 0x19, 0x0d, 0x27, 0x0f, 0x07, 0x07, 0x05, 0x05, 0x18, 0x07, 0x1b,
+	0x09, 0x14, 0x12, 0x14, 0x11, 0x1d, 0x20, 0x00, 0x0d, 0x20, 0x08, 0x00,
+	0x55, 0x26, 0x2c, 0x0e, 0xff, 0x0e, 0x03, 0x2c, 0x03, 0x03, 0x2c, 0x02,
+	0x1e, 0x19, 0x48, 0x55, 0x14, 0x07, 0x12, 0x12, 0x02, 0x31, 0x0f, 0x15,
+	0x15, 0x06, 0x06, 0x15, 0x32, 0x05, 0x1a, 0x00, 0x32, 0x09, 0x01, 0x10,
+	0x0b, 0x1a, 0x06, 0x1b, 0x02, 0x03, 0x03, 0x03, 0x0d, 0x03, 0x02, 0x19,
+	0x00, 0x02, 0x21, 0x31, 0x02, 0x07, 0x07, 0x1d, 0x03, 0x0c, 0x08, 0x11,
+	0x01, 0x1e, 0x05, 0x07, 0x01, 0x04, 0x0b, 0x07, 0x06, 0x02, 0x02, 0x1f,
+	0x0b, 0x08, 0x09, 0x13, 0x0d, 0x0a, 0x07, 0x0b, 0x04, 0x06, 0x04, 0x18,
+	0x09, 0x09, 0x14, 0x0b, 0x08, 0x0c, 0x03, 0x02, 0x03, 0x0a, 0x01, 0x05,
+	0x02, 0x03, 0x0e, 0x06, 0x02, 0x03, 0x0a, 0x03, 0x07, 0x34, 0x04, 0x09,
+	0x08, 0x04, 0x10, 0x0d, 0x28, 0x24, 0x12, 0x0a, 0x0c, 0x05, 0x08, 0x08,
+	0x0e, 0x0b, 0x0b, 0x07, 0x04, 0x03, 0x33, 0x11, 0x02, 0x0b, 0x07, 0x03,
+	0xff, 0x25, 0x04, 0x0a, 0x07, 0x02, 0x0a, 0x02, 0x05, 0x03, 0x14, 0x0d,
+	0x05, 0x0e, 0x02, 0x0c, 0x11, 0x18, 0x07, 0x33, 0x0a, 0x16, 0x14, 0x04,
+	0x13, 0x15, 0x0e, 0x16, 0x15, 0x0f, 0x09, 0x16, 0x12, 0x11, 0x15, 0x12,
+	0x12, 0x0c, 0x05, 0x08, 0x08, 0x15, 0x0e, 0x04, 0x03, 0x03, 0x05, 0x06,
+	0x03, 0x02, 0x04, 0x03, 0x02, 0x0d, 0x15, 0x07, 0x05, 0x06, 0x02, 0x19,
+	0x12, 0x24, 0x0a, 0x00, 0x15, 0x11, 0x17, 0x00, 0x1a, 0x07, 0x01, 0x08,
+	0x0e, 0x10, 0x0e, 0x03, 0x03, 0x34, 0x01, 0x0e, 0x0d, 0x02, 0x1a, 0x02,
+	0x06, 0x06, 0x11, 0x17, 0x09, 0x13, 0x14, 0x15, 0x04, 0x06, 0x06, 0x02,
+	0x07, 0x03, 0x20, 0x01, 0x37, 0x22, 0x25, 0x1b, 0x30, 0x22, 0x26, 0x04,
+	0x02, 0x07, 0x0e, 0x1e, 0x02, 0x44, 0x42, 0x02, 0x0f, 0x05, 0x02, 0x04,
+	0x44, 0x02, 0x2d, 0x18, 0x06, 0x12, 0x04, 0x0a, 0x9a, 0x0c, 0x2a, 0x02,
+	0x03, 0x0a, 0x0c, 0x02, 0x3e, 0x28, 0x02, 0x1b, 0x24, 0x25, 0x03, 0x08,
+	0x0a, 0x12, 0x02, 0x03, 0x0a, 0x0a, 0x02, 0x11, 0x53, 0x02, 0x11, 0x01,
+	0x11, 0x8d, 0x04, 0x09, 0x0b, 0x11, 0x02, 0x03, 0x0b, 0x0b, 0x02, 0x48,
+	0x11, 0x02, 0x0b, 0x01, 0x0b, 0xff, 0x04, 0x09, 0x17, 0x01, 0x02, 0x0a,
+	0x0a, 0x17, 0x15, 0x33, 0x0c, 0x06, 0x0b, 0x0b, 0x02, 0x1e, 0x1c, 0x03,
+	0x1e, 0x03, 0x17, 0x27, 0x06, 0x02, 0x06, 0x1f, 0x1a, 0x08, 0x09, 0x22,
+	0x05, 0x07, 0x0f, 0x10, 0x0b, 0x03, 0x08, 0x0a, 0x29, 0x03, 0x05, 0x0a,
+	0x14, 0x09, 0x08, 0x28, 0x06, 0x22, 0x31, 0x00, 0x02, 0x28, 0x05, 0x09,
+	0x10, 0x02, 0x0d, 0x2c, 0x12, 0x07, 0x2a, 0x04, 0x10, 0x03, 0x14, 0x05,
+	0x0e, 0x03, 0x10, 0x10, 0x03, 0x03, 0x03, 0x02, 0x09, 0x0d, 0x27, 0x0a,
+	0x05, 0x05, 0x19, 0x23, 0x17, 0x0f, 0x04, 0x0f, 0x06, 0x08, 0x15, 0x15,
+	0x0d, 0x4a, 0x14, 0x02, 0x0e, 0x0e, 0x0b, 0x09, 0x04, 0x05, 0x17, 0x02,
+	0x03, 0x11, 0x0d, 0x03, 0x17, 0x17, 0x00, 0x02, 0x0e, 0x10, 0x29, 0x0b,
+	0x0c, 0x01, 0x10, 0x06, 0x05, 0x15, 0x02, 0x16, 0x02, 0x0b, 0x14, 0x1a,
+	0x05, 0xff, 0x18, 0x12, 0x0a, 0x03, 0x0b, 0x02, 0x07, 0x03, 0x01, 0x4d,
+	0x17, 0x02, 0x15, 0x14, 0x0e, 0x09, 0x0a, 0x0d, 0x0c, 0x0a, 0x02, 0x04,
+	0x02, 0x06, 0x14, 0x09, 0x18, 0x13, 0x0a, 0x13, 0x0f, 0x10, 0x01, 0x13,
+	0x0a, 0x10, 0x04, 0x0f, 0x03, 0x0e, 0x0d, 0x09, 0x0a, 0x00, 0x04, 0x0a,
+	0x0c, 0x02, 0x03, 0x04, 0x07, 0x2f, 0x05, 0x13, 0x06, 0x21, 0x06, 0x09,
+	0x10, 0x04, 0x0c, 0x01, 0x17, 0x01, 0x0e, 0x12, 0x1b, 0x15, 0x09, 0x0f,
+	0x0d, 0x13, 0x1b, 0x15, 0x00, 0x34, 0x0e, 0x05, 0x0c, 0x0f, 0x02, 0x15,
+	0x02, 0x03, 0x12, 0x09, 0x0b, 0x1e, 0x07, 0x03, 0x05, 0x0d, 0x02, 0x0f,
+	0x1e, 0x02, 0x13, 0x11, 0x06, 0x2e, 0x02, 0x03, 0x0a, 0x17, 0x12, 0x14,
+	0x2e, 0x07, 0x01, 0x08, 0x03, 0x0b, 0x06, 0x10, 0x09, 0x09, 0x03, 0x11,
+	0x07, 0x04, 0x03, 0x02, 0x0f, 0x1c, 0x04, 0x0d, 0x10, 0xec, 0x16, 0x05,
+	0x06, 0x0b, 0x1f, 0x02, 0x0a, 0x0c, 0x11, 0x06, 0x0a, 0x0a, 0x06, 0x04,
+	0x04, 0x14, 0x0e, 0x03, 0x03, 0x0f, 0x08, 0x04, 0x0b, 0x0f, 0x17, 0x04,
+	0x16, 0x0c, 0x02, 0x0b, 0x0a, 0x0a, 0x04, 0x0b, 0x0d, 0x05, 0x0e, 0x06,
+	0x0b, 0x0e, 0x04, 0x07, 0x01, 0x13, 0x3f, 0x2b, 0x3c, 0x2a, 0x17, 0x05,
+	0x01, 0x06, 0x10, 0x08, 0x12, 0x0f, 0x15, 0x11, 0x18, 0x07, 0x1b, 0x08,
+	0x16, 0x14, 0x04, 0x02, 0x02, 0x02, 0x09, 0x12, 0x15, 0x03, 0x18, 0x0d,
+	0x15, 0x04, 0x04, 0x05, 0x16, 0x02, 0x03, 0x0a, 0x0d, 0x03, 0x0e, 0x0c,
+	0x1f, 0x09, 0x0a, 0x01, 0x20, 0x06, 0x05, 0x09, 0x0e, 0x09, 0x09, 0x0b,
+	0x06, 0x09, 0x05, 0x19, 0x07, 0x0c, 0x08, 0x06, 0x14, 0x18, 0x02, 0x18,
+	0xff, 0x05, 0x01, 0x06, 0x0b, 0x08, 0x0a, 0x03, 0x13, 0x0e, 0x02, 0x01,
+	0x22, 0x16, 0x1b, 0x06, 0x13, 0x07, 0x04, 0x12, 0x13, 0x04, 0x05, 0x14,
+	0x0a, 0x03, 0x0c, 0x02, 0x07, 0x08, 0x06, 0x03, 0x0a, 0x05, 0x01, 0x09,
+	0x09, 0x00, 0x09, 0x05, 0x03, 0x1e, 0x01, 0x0a, 0x05, 0x02, 0x17, 0x02,
+	0x0e, 0x06, 0x05, 0x0c, 0x02, 0x03, 0x1c, 0x06, 0x02, 0x1c, 0x00, 0x01,
+	0x01, 0x04, 0x0c, 0x0b, 0x01, 0x0d, 0x05, 0x07, 0x03, 0x1c, 0x19, 0x00,
+	0x44, 0x1a, 0x0d, 0x0e, 0x06, 0x09, 0x0b, 0x0a, 0x10, 0x01, 0x1b, 0x0d,
+	0x04, 0x03, 0x15, 0x00, 0x14, 0x05, 0x07, 0x05, 0x21, 0x14, 0x0a, 0x03,
+	0x11, 0x03, 0x12, 0x0a, 0x04, 0x07, 0x09, 0x02, 0x03, 0x14, 0x08, 0x15,
+	0x0b, 0x04, 0x05, 0x1d, 0x03, 0x07, 0x20, 0x02, 0x0b, 0x0c, 0x06, 0x18,
+	0x06, 0x05, 0x00, 0x08, 0x03, 0x0c, 0x0c, 0x03, 0xff, 0x0c, 0x00, 0x07,
+	0x04, 0x14, 0x04, 0x03, 0x13, 0x14, 0x18, 0x0a, 0x0d, 0x01, 0x14, 0x06,
+	0x05, 0x0a, 0x17, 0x14, 0x06, 0x04, 0x0c, 0x00, 0x0b, 0x0d, 0x08, 0x04,
+	0x02, 0x02, 0x0a, 0x02, 0x02, 0x13, 0x02, 0x0a, 0x04, 0x15, 0x07, 0x06,
+	0x0e, 0x04, 0x06, 0x13, 0x08, 0x03, 0x02, 0x06, 0x23, 0x07, 0x16, 0x14,
+	0x02, 0x08, 0x02, 0x0d, 0x03, 0x0e, 0x07, 0x03, 0x0a, 0x03, 0x06, 0x05,
+	0x04, 0x13, 0x06, 0x03, 0x1b, 0x22, 0x33, 0x3f, 0x1f, 0x03, 0x1f, 0x05,
+	0x01, 0x06, 0x0d, 0x0b, 0x02, 0x0d, 0x02, 0x0c, 0x0d, 0x03, 0x14, 0x03,
+	0x0d, 0x0f, 0x07, 0x15, 0x08, 0x1c, 0x08, 0x07, 0x1f, 0x19, 0x00, 0x21,
+	0x03, 0x08, 0x08, 0x0b, 0x02, 0x17, 0x01, 0x02, 0x15, 0x03, 0x1e, 0x0e,
+	0x05, 0x07, 0x05, 0x05, 0x02, 0x03, 0x12, 0x13, 0x13, 0x02, 0x01, 0x03,
+	0x19, 0x06, 0x1e, 0x25, 0xff, 0x0c, 0x05, 0x04, 0x01, 0x1c, 0x02, 0x05,
+	0x0e, 0x07, 0x01, 0x0b, 0x1e, 0x07, 0x07, 0x18, 0x18, 0x03, 0x0d, 0x09,
+	0x04, 0x04, 0x01, 0x15, 0x08, 0x09, 0x17, 0x12, 0x0e, 0x10, 0x0a, 0x01,
+	0x0b, 0x1f, 0x09, 0x08, 0x0f, 0x0a, 0x05, 0x03, 0x0a, 0x03, 0x0b, 0x04,
+	0x02, 0x13, 0x0c, 0x16, 0x08, 0x12, 0x08, 0x1e, 0x0b, 0x03, 0x02, 0x06,
+	0x09, 0x03, 0x05, 0x1a, 0x03, 0x03, 0x20, 0x01, 0x0d, 0x09, 0x02, 0x0e,
+	0x02, 0x08, 0x06, 0x05, 0x08, 0x02, 0x06, 0x01, 0x14, 0x0b, 0x07, 0x00,
+	0x15, 0x04, 0x1b, 0x11, 0x15, 0x12, 0x09, 0x0d, 0x08, 0x0d, 0x08, 0x20,
+	0x05, 0x0a, 0x20, 0x04, 0x03, 0x17, 0x02, 0x09, 0x15, 0x08, 0x07, 0x04,
+	0x06, 0x0b, 0x04, 0x03, 0x03, 0x01, 0x12, 0x03, 0x04, 0x05, 0x04, 0x03,
+	0x05, 0x08, 0x04, 0x04, 0x0a, 0x04, 0x03, 0x03, 0x09, 0x0d, 0x15, 0x1b,
+	0xff, 0x06, 0x1a, 0x0a, 0x07, 0x1a, 0x07, 0x17, 0x04, 0x04, 0x16, 0x04,
+	0x01, 0x45, 0x14, 0x14, 0x04, 0x08, 0x09, 0x18, 0x07, 0x19, 0x09, 0x33,
+	0x19, 0x14, 0x0d, 0x1a, 0x03, 0x0c, 0x06, 0x09, 0x09, 0x02, 0x10, 0x02,
+	0x02, 0x0c, 0x0d, 0x00, 0x1a, 0x0a, 0x17, 0x07, 0x15, 0x09, 0x09, 0x0f,
+	0x0a, 0x14, 0x0d, 0x0d, 0x07, 0x07, 0x01, 0x08, 0x0f, 0x11, 0x04, 0x0a,
+	0x0a, 0x0a, 0x0c, 0x03, 0x18, 0x05, 0x0d, 0x0f, 0x04, 0x0e, 0x06, 0x02,
+	0x0c, 0x2a, 0x09, 0x14, 0x10, 0x04, 0x17, 0x01, 0x1a, 0x08, 0x19, 0x07,
+	0x12, 0x0d, 0x04, 0x03, 0x03, 0x13, 0x13, 0x0f, 0x04, 0x09, 0x09, 0x07,
+	0x03, 0x01, 0x07, 0x06, 0x10, 0x03, 0x02, 0x06, 0x05, 0x1a, 0x06, 0x0b,
+	0x03, 0x04, 0x09, 0x02, 0x11, 0x05, 0x14, 0x09, 0x04, 0x15, 0x0e, 0x07,
+	0x15, 0x02, 0x07, 0x08, 0x0c, 0x07, 0x0a, 0x0e, 0xff, 0x05, 0x02, 0x03,
+	0x16, 0x03, 0x15, 0x03, 0x03, 0x05, 0x04, 0x10, 0x05, 0x05, 0x0c, 0x04,
+	0x0a, 0x08, 0x06, 0x03, 0x11, 0x00, 0x10, 0x12, 0x07, 0x07, 0x0f, 0x1a,
+	0x14, 0x0e, 0x12, 0x03, 0x0d, 0x05, 0x05, 0x0d, 0x08, 0x02, 0x02, 0x04,
+	0x0c, 0x0e, 0x07, 0x03, 0x18, 0x09, 0x00, 0x03, 0x03, 0x0f, 0x07, 0x02,
+	0x02, 0x06, 0x03, 0x0a, 0x04, 0x0b, 0x02, 0x04, 0x11, 0x0b, 0x12, 0x0a,
+	0x0e, 0x1b, 0x09, 0x0d, 0x09, 0x04, 0x03, 0x05, 0x28, 0x0f, 0x08, 0x10,
+	0x13, 0x05, 0x06, 0x0e, 0x14, 0x07, 0x11, 0x10, 0x01, 0x01, 0x15, 0x06,
+	0x12, 0x06, 0x08, 0x03, 0x0e, 0x11, 0x05, 0x0c, 0x02, 0x02, 0x04, 0x04,
+	0x10, 0x14, 0x04, 0x08, 0x08, 0x06, 0x1e, 0x41, 0x27, 0x24, 0x21, 0x04,
+	0x01, 0x05, 0x02, 0x22, 0x26, 0x26, 0x06, 0x03, 0x06, 0x05, 0x01, 0x06,
+	0x13, 0x13, 0x0d, 0x10, 0xff, 0x04, 0x02, 0x0e, 0x0e, 0x03, 0x06, 0x06,
+	0x12, 0x12, 0x07, 0x05, 0x08, 0x12, 0x02, 0x03, 0x09, 0x09, 0x03, 0x0b,
+	0x10, 0x40, 0x40, 0x00, 0x0e, 0x04, 0x01, 0x05, 0x02, 0x0f, 0x12, 0x12,
+	0x12, 0x03, 0x06, 0x05, 0x01, 0x28, 0x07, 0x03, 0x04, 0x04, 0x02, 0x01,
+	0x03, 0x1f, 0x10, 0x0d, 0x1f, 0x04, 0x14, 0x04, 0x11, 0x17, 0x02, 0x13,
+	0x00, 0x07, 0x1e, 0x07, 0x06, 0x14, 0x17, 0x0a, 0x04, 0x07, 0x1a, 0x1b,
+	0x05, 0x1c, 0x01, 0x08, 0x20, 0x07, 0x06, 0x0e, 0x0f, 0x03, 0x05, 0x0b,
+	0x0d, 0x03, 0x0e, 0x06, 0x0a, 0x09, 0x04, 0x22, 0x0a, 0x03, 0x03, 0x09,
+	0x07, 0x02, 0x0b, 0x1f, 0x1d, 0x09, 0x0b, 0x03, 0x01, 0x0b, 0x08, 0x07,
+	0x01, 0x0c, 0x08, 0x10, 0x04, 0x01, 0x04, 0x0c, 0x11, 0x02, 0x46, 0x04,
+	0x02, 0x0d, 0x0d, 0x07, 0x12, 0x1e, 0x0c, 0x13, 0x07, 0x0c, 0x08, 0x04,
+	0xff, 0x0c, 0x10, 0x04, 0x05, 0x11, 0x14, 0x0c, 0x08, 0x0f, 0x05, 0x08,
+	0x24, 0x09, 0x08, 0x0e, 0x14, 0x08, 0x0e, 0x05, 0x15, 0x05, 0x0f, 0x05,
+	0x15, 0x0d, 0x06, 0x0f, 0x05, 0x0c, 0x0d, 0x15, 0x09, 0x02, 0x15, 0x03,
+	0x03, 0x06, 0x12, 0x05, 0x04, 0x11, 0x03, 0x07, 0x09, 0x14, 0x08, 0x0d,
+	0x14, 0x02, 0x09, 0x0b, 0x0a, 0x03, 0x07, 0x0b, 0x13, 0x0c, 0x0b, 0x01,
+	0x13, 0x06, 0x21, 0x03, 0x08, 0x05, 0x0a, 0x09, 0x07, 0x23, 0x08, 0x0e,
+	0x0e, 0x02, 0x0c, 0x07, 0x02, 0x0d, 0x09, 0x06, 0x03, 0x0f, 0x07, 0x06,
+	0x16, 0x08, 0x13, 0x13, 0x0d, 0x0e, 0x03, 0x01, 0x08, 0x07, 0x02, 0x14,
+	0x0e, 0x0b, 0x08, 0x04, 0x10, 0x0f, 0x0f, 0x04, 0x0f, 0x06, 0x0c, 0x04,
+	0x0a, 0x08, 0x08, 0x1b, 0x0f, 0x00, 0x2c, 0x0b, 0x05, 0x05, 0x01, 0x09,
+	0x08, 0x03, 0x03, 0x03, 0x0f, 0x04, 0x0f, 0x12, 0xff, 0x04, 0x04, 0x12,
+	0x07, 0x07, 0x04, 0x18, 0x08, 0x07, 0x0f, 0x04, 0x07, 0x16, 0x02, 0x14,
+	0x0a, 0x12, 0x0b, 0x06, 0x27, 0x05, 0x0d, 0x16, 0x08, 0x13, 0x10, 0x05,
+	0x0c, 0x04, 0x14, 0x03, 0x17, 0x0b, 0x10, 0x01, 0x10, 0x3e, 0x07, 0x10,
+	0x0f, 0x05, 0x13, 0x04, 0x1e, 0x21, 0x21, 0x21, 0x03, 0x0f, 0x1b, 0x06,
+	0x0f, 0x0b, 0x16, 0x0b, 0x0c, 0x16, 0x0d, 0x1c, 0x1b, 0x0b, 0x07, 0x04,
+	0x00, 0x04, 0x0b, 0x0b, 0x03, 0x16, 0x1d, 0x02, 0x02, 0x01, 0x0b, 0x14,
+	0x1d, 0x06, 0x1d, 0x19, 0x06, 0x17, 0x04, 0x1d, 0x13, 0x1a, 0x00, 0x03,
+	0x1c, 0x14, 0x0d, 0x03, 0x1b, 0x09, 0x02, 0x07, 0x16, 0x13, 0x09, 0x05,
+	0x03, 0x01, 0x09, 0x08, 0x02, 0x13, 0x08, 0x10, 0x14, 0x02, 0x05, 0x0f,
+	0x06, 0x03, 0x0b, 0x07, 0x03, 0x07, 0x04, 0x0d, 0x1d, 0x02, 0x08, 0x08,
+	0x08, 0x09, 0x04, 0x0c, 0xff, 0x03, 0x0e, 0x13, 0x0a, 0x01, 0x11, 0x06,
+	0x05, 0x07, 0x16, 0x01, 0x02, 0x10, 0x11, 0x0a, 0x03, 0x15, 0x01, 0x0d,
+	0x09, 0x09, 0x0b, 0x12, 0x12, 0x03, 0x03, 0x01, 0x0b, 0x0b, 0x03, 0x0a,
+	0x00, 0x04, 0x04, 0x09, 0x3a, 0x13, 0x16, 0x0f, 0x00, 0x4e, 0x07, 0x1a,
+	0x1d, 0x1d, 0x1d, 0x03, 0x24, 0x07, 0x00, 0x1c, 0x19, 0x0b, 0x18, 0x01,
+	0x0a, 0x11, 0x03, 0x03, 0x03, 0x16, 0x1c, 0x1c, 0x03, 0x0b, 0x0e, 0x0e,
+	0x0e, 0x03, 0x0e, 0x05, 0x0b, 0x1e, 0x01, 0x13, 0x15, 0x02, 0x1c, 0x02,
+	0x0e, 0x1e, 0x07, 0x24, 0x27, 0x27, 0x0d, 0x26, 0x04, 0x01, 0x05, 0x2b,
+	0x06, 0x26, 0x20, 0x04, 0x08, 0x0a, 0x03, 0x26, 0x17, 0x19, 0x06, 0x0c,
+	0x05, 0x23, 0x18, 0x22, 0x14, 0x04, 0x09, 0x2b, 0x08, 0x15, 0x04, 0x06,
+	0x03, 0x12, 0x0e, 0x29, 0x18, 0x00, 0x14, 0x04, 0x01, 0x05, 0x14, 0x09,
+	0xff, 0x02, 0x11, 0x25, 0x26, 0x14, 0x04, 0x11, 0x27, 0x22, 0x0f, 0x13,
+	0x14, 0x0a, 0x02, 0x06, 0x12, 0x0c, 0x21, 0x0d, 0x0b, 0x0c, 0x05, 0x09,
+	0x07, 0x0a, 0x09, 0x04, 0x15, 0x15, 0x24, 0x09, 0x23, 0x19, 0x0b, 0x03,
+	0x11, 0x0b, 0x0e, 0x27, 0x05, 0x02, 0x05, 0x0c, 0x27, 0x02, 0x20, 0x05,
+	0x03, 0x13, 0x04, 0x09, 0x09, 0x08, 0x03, 0x10, 0x13, 0x06, 0x01, 0x03,
+	0x02, 0x0c, 0x03, 0x02, 0x03, 0x03, 0x03, 0x08, 0x03, 0x20, 0x08, 0x06,
+	0x04, 0x04, 0x03, 0x09, 0x02, 0x09, 0x0a, 0x16, 0x01, 0x07, 0x0d, 0x01,
+	0x01, 0x07, 0x13, 0x09, 0x16, 0x17, 0x02, 0x1e, 0x17, 0x10, 0x0d, 0x10,
+	0x05, 0x02, 0x01, 0x0d, 0x03, 0x0e, 0x03, 0x0e, 0x05, 0x0f, 0x0e, 0x10,
+	0x04, 0x05, 0x05, 0x0a, 0x0f, 0x0f, 0x10, 0x0b, 0x09, 0x03, 0x06, 0x13,
+	0x04, 0x03, 0x18, 0x04, 0x27, 0x0b, 0x0e, 0x0a, 0xff, 0x0c, 0x18, 0x21,
+	0x07, 0x26, 0x13, 0x08, 0x08, 0x01, 0x0c, 0x08, 0x06, 0x1d, 0x20, 0x20,
+	0x20, 0x00, 0x20, 0x04, 0x01, 0x05, 0x15, 0x08, 0x12, 0x03, 0x1d, 0x0b,
+	0x02, 0x1a, 0x0c, 0x03, 0x1d, 0x04, 0x10, 0x17, 0x18, 0x12, 0x1d, 0x0c,
+	0x13, 0x0c, 0x06, 0x06, 0x03, 0x04, 0x01, 0x18, 0x09, 0x1d, 0x10, 0x18,
+	0x1a, 0x1d, 0x07, 0x10, 0x11, 0x00, 0x0c, 0x0d, 0x1c, 0x04, 0x1b, 0x0c,
+	0x13, 0x0f, 0x10, 0x01, 0x1f, 0x04, 0x1f, 0x14, 0x08, 0x03, 0x0e, 0x02,
+	0x0e, 0x1f, 0x11, 0x02, 0x11, 0x0a, 0x18, 0x13, 0x07, 0x09, 0x07, 0x08,
+	0x02, 0x1a, 0x1d, 0x1d, 0x1d, 0x00, 0x1d, 0x04, 0x01, 0x05, 0x17, 0x18,
+	0x02, 0x10, 0x10, 0x0c, 0x14, 0x00, 0x1a, 0x05, 0x05, 0x0e, 0x00, 0x06,
+	0x03, 0x08, 0x10, 0x02, 0x07, 0x08, 0x05, 0x12, 0x0a, 0x1b, 0x09, 0x11,
+	0x08, 0x0a, 0x09, 0x06, 0xff, 0x03, 0x12, 0x06, 0x08, 0x0c, 0x0a, 0x0b,
+	0x07, 0x00, 0x09, 0x06, 0x0c, 0x09, 0x06, 0x13, 0x0b, 0x06, 0x06, 0x1e,
+	0x06, 0x05, 0x07, 0x18, 0x03, 0x07, 0x16, 0x0b, 0x03, 0x0c, 0x02, 0x0b,
+	0x0f, 0x0b, 0x02, 0x0e, 0x0b, 0x0b, 0x0f, 0x07, 0x09, 0x07, 0x08, 0x02,
+	0x0b, 0x0b, 0x05, 0x03, 0x06, 0x06, 0x09, 0x0b, 0x0b, 0x06, 0x0f, 0x00,
+	0x05, 0x03, 0x07, 0x07, 0x03, 0x0d, 0x06, 0x04, 0x0f, 0x0b, 0x08, 0x04,
+	0x1a, 0x0d, 0x11, 0x0a, 0x0a, 0x1e, 0x05, 0x0b, 0x0b, 0x1c, 0x09, 0x02,
+	0x0c, 0x0f, 0x0f, 0x0f, 0x0a, 0x23, 0x07, 0x09, 0x08, 0x08, 0x12, 0x02,
+	0x11, 0x05, 0x08, 0x0a, 0x11, 0x05, 0x0a, 0x11, 0x02, 0x09, 0x08, 0x05,
+	0x03, 0x01, 0x0c, 0x09, 0x00, 0x0b, 0x1c, 0x05, 0x45, 0x0a, 0x08, 0x14,
+	0x04, 0x25, 0x27, 0x27, 0x26, 0x03, 0x1e, 0x05, 0x1a, 0x13, 0x0e, 0x03,
+	0xff, 0x10, 0x13, 0x05, 0x17, 0x00, 0x10, 0x1a, 0x00, 0x28, 0x00, 0x07,
+	0x28, 0x22, 0x0e, 0x05, 0x00, 0x23, 0x12, 0x0d, 0x07, 0x07, 0x1d, 0x1b,
+	0x03, 0x09, 0x05, 0x03, 0x28, 0x16, 0x08, 0x06, 0x0b, 0x05, 0x1f, 0x18,
+	0x1a, 0x09, 0x15, 0x07, 0x27, 0x05, 0x03, 0x2c, 0x17, 0x05, 0x04, 0x09,
+	0x02, 0x21, 0x1f, 0x03, 0x18, 0x08, 0x23, 0x06, 0x0c, 0x04, 0x10, 0x01,
+	0x23, 0x04, 0x08, 0x04, 0x02, 0x0e, 0x09, 0x0f, 0x0c, 0x09, 0x04, 0x0d,
+	0x06, 0x01, 0x14, 0x06, 0x00, 0x04, 0x03, 0x00, 0x09, 0x23, 0x03, 0x06,
+	0x0e, 0x07, 0x0a, 0x07, 0x18, 0x0b, 0x23, 0x07, 0x11, 0x11, 0x0f, 0x0b,
+	0x08, 0x05, 0x11, 0x02, 0x02, 0x02, 0x01, 0x1c, 0x04, 0x0b, 0x17, 0x07,
+	0x17, 0x06, 0x07, 0x05, 0x13, 0x03, 0x05, 0x05, 0x07, 0x03, 0x10, 0x02,
+	0x23, 0x01, 0x08, 0x06, 0x02, 0x07, 0x06, 0x0d, 0xff, 0x0d, 0x05, 0x05,
+	0x04, 0x11, 0x08, 0x02, 0x04, 0x10, 0x02, 0x0a, 0x05, 0x0c, 0x0f, 0x04,
+	0x05, 0x10, 0x02, 0x39, 0x34, 0x4f, 0x18, 0x04, 0x06, 0x0a, 0x02, 0x0a,
+	0x0a, 0x0b, 0x17, 0x15, 0x16, 0x14, 0x07, 0x14, 0x05, 0x0f, 0x00, 0x12,
+	0x0b, 0x03, 0x0a, 0x16, 0x07, 0x15, 0x15, 0x0d, 0x08, 0x04, 0x07, 0x14,
+	0x02, 0x0a, 0x10, 0x10, 0x0b, 0x0d, 0x20, 0x06, 0x1f, 0x18, 0x0a, 0x0a,
+	0x04, 0x02, 0x02, 0x02, 0x0c, 0x04, 0x0c, 0x09, 0x04, 0x02, 0x21, 0x07,
+	0x06, 0x00, 0x03, 0x0a, 0x05, 0x12, 0x09, 0x02, 0x05, 0x1d, 0x0e, 0x03,
+	0x11, 0x11, 0x05, 0x09, 0x07, 0x2d, 0x06, 0x04, 0x0e, 0x05, 0x03, 0x16,
+	0x02, 0x0f, 0x14, 0x06, 0x06, 0x16, 0x0e, 0x05, 0x0f, 0x09, 0x06, 0x06,
+	0x08, 0x03, 0x0d, 0x0d, 0x05, 0x04, 0x04, 0x02, 0x0e, 0x02, 0x16, 0x04,
+	0x1b, 0x01, 0x0b, 0x06, 0xff, 0x15, 0x06, 0x31, 0x0d, 0x07, 0x17, 0x06,
+	0x05, 0x0e, 0x08, 0x03, 0x01, 0x03, 0x14, 0x15, 0x04, 0x10, 0x04, 0x09,
+	0x0e, 0x02, 0x0e, 0x0a, 0x04, 0x15, 0x04, 0x08, 0x03, 0x02, 0x02, 0x08,
+	0x02, 0x02, 0x04, 0x02, 0x0f, 0x05, 0x1e, 0x09, 0x0d, 0x04, 0x01, 0x05,
+	0x0d, 0x07, 0x02, 0x09, 0x0c, 0x06, 0x13, 0x15, 0x02, 0x0b, 0x15, 0x06,
+	0x06, 0x07, 0x0b, 0x19, 0x02, 0x04, 0x04, 0x07, 0x03, 0x0c, 0x0c, 0x05,
+	0x01, 0x03, 0x02, 0x05, 0x03, 0x02, 0x03, 0x04, 0x0e, 0x07, 0x00, 0x07,
+	0x10, 0x0e, 0x06, 0x12, 0x0e, 0x11, 0x04, 0x04, 0x0a, 0x0c, 0x0c, 0x02,
+	0x03, 0x0c, 0x03, 0x03, 0x01, 0x1a, 0x04, 0x07, 0x09, 0x02, 0x05, 0x0e,
+	0x02, 0x1d, 0x1d, 0x4a, 0x03, 0x1a, 0x1a, 0x07, 0x11, 0x0f, 0x05, 0x17,
+	0x0e, 0x16, 0x03, 0x08, 0x06, 0x17, 0x01, 0x04, 0x06, 0x0d, 0x11, 0x04,
+	0xff, 0x01, 0x07, 0x0a, 0x12, 0x16, 0x0c, 0x04, 0x18, 0x0d, 0x0e, 0x1a,
+	0x04, 0x00, 0x1a, 0x19, 0x02, 0x0a, 0x0a, 0x0c, 0x03, 0x04, 0x0b, 0x19,
+	0x0c, 0x07, 0x05, 0x12, 0x0b, 0x03, 0x08, 0x04, 0x07, 0x06, 0x02, 0x19,
+	0x0d, 0x09, 0x1a, 0x07, 0x02, 0x05, 0x08, 0x0c, 0x06, 0x13, 0x04, 0x17,
+	0x17, 0x17, 0x03, 0x07, 0x07, 0x09, 0x07, 0x04, 0x08, 0x01, 0x09, 0x19,
+	0x04, 0x03, 0x16, 0x12, 0x18, 0x0f, 0x11, 0x0c, 0x0b, 0x0a, 0x0b, 0x05,
+	0x09, 0x17, 0x03, 0x06, 0x01, 0x03, 0x07, 0x12, 0x02, 0x08, 0x0c, 0x18,
+	0x0d, 0x09, 0x04, 0x01, 0x1a, 0x06, 0x08, 0x0e, 0x02, 0x02, 0x0b, 0x02,
+	0x02, 0x0a, 0x02, 0x0c, 0x08, 0x03, 0x00, 0x07, 0x04, 0x06, 0x10, 0x05,
+	0x0c, 0x04, 0x08, 0x05, 0x02, 0x04, 0x04, 0x0c, 0x0c, 0x0c, 0x04, 0x0a,
+	0x06, 0x0d, 0x01, 0x0e, 0x10, 0x09, 0x03, 0x08, 0xd3, 0x0f, 0x02, 0x09,
+	0x07, 0x0b, 0x01, 0x18, 0x11, 0x00, 0x1d, 0x10, 0x0e, 0x08, 0x01, 0x0b,
+	0x0f, 0x0c, 0x0b, 0x04, 0x01, 0x05, 0x01, 0x0a, 0x0b, 0x01, 0x03, 0x12,
+	0x06, 0x00, 0x20, 0x11, 0x04, 0x04, 0x12, 0x04, 0x09, 0x04, 0x08, 0x0c,
+	0x05, 0x07, 0x13, 0x05, 0x11, 0x0a, 0x13, 0x03, 0x0c, 0x01, 0x02, 0x13,
+	0x10, 0x03, 0x05, 0x06, 0x02, 0x0e, 0x0a, 0x0c, 0x0d, 0x09, 0x0a, 0x05,
+	0x0c, 0x42, 0x13, 0x00, 0x44, 0x0a, 0x28, 0x0d, 0x21, 0x00, 0x09, 0x0f,
+	0x14, 0x06, 0x2b, 0x1d, 0x10, 0x10, 0x04, 0x00, 0x03, 0x00, 0x91, 0x2a,
+	0x08, 0x04, 0x01, 0x03, 0x06, 0x06, 0x04, 0x06, 0x30, 0x10, 0x30, 0x10,
+	0x10, 0x1c, 0x34, 0x00, 0x08, 0x00, 0x83, 0x01, 0x01, 0x00, 0x16, 0x00,
+	0xa5, 0x01, 0x03, 0x03, 0x59, 0x0c, 0x21, 0x21, 0x21, 0x08, 0x02, 0x3c,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x06, 0x01, 0x2c, 0x1c, 0x10, 0x10, 0x1c,
+	0x14, 0x1c, 0x07, 0x16, 0x03, 0x06, 0x01, 0x03, 0x11, 0x00, 0x00, 0x00,
+	0x01, 0x00, 0x04, 0x00, 0x86, 0x0a, 0x11, 0x11, 0x04, 0x0f, 0x00, 0x08,
+	0x00, 0x83, 0x01, 0x01, 0x00, 0x16, 0x00, 0xca, 0x01, 0x03, 0x00, 0x41,
+	0x19, 0x19, 0x08, 0x0a, 0x21, 0x10, 0x17, 0x04, 0x1f, 0x1d, 0x12, 0x03,
+	0x10, 0x01, 0x02, 0x13, 0x29, 0x01, 0x0a, 0x09, 0x01, 0x01, 0x07, 0x0c,
+	0x07, 0x02, 0x09, 0x02, 0x24, 0x0c, 0x0b, 0x0b, 0x01, 0x03, 0x09, 0x0a,
+	0x04, 0x0c, 0x21, 0x10, 0x00, 0x13, 0x0a, 0x21, 0x0d, 0x21, 0x00, 0x0c,
+	0x0f, 0x12, 0x06, 0x21, 0x21, 0x0f, 0x0f, 0x04, 0x19, 0x08, 0x04, 0x01,
+	0x03, 0x06, 0x06, 0x04, 0x06, 0x0d, 0x0d, 0x17, 0x18, 0x00, 0x08, 0x00,
+	0x83, 0x01, 0x01, 0x00, 0x05, 0x00, 0x8c, 0x01, 0x03, 0x03, 0x19, 0x09,
+	0x41, 0x06, 0x20, 0x1f, 0x2c, 0x05, 0x00, 0x02, 0x00, 0x83, 0x06, 0x01,
+	0x0d, 0x01, 0x0d, 0x8a, 0x04, 0x00, 0x00, 0x00, 0x05, 0x0c, 0x0c, 0x0d,
+	0x0c, 0x00, 0x08, 0x00, 0x83, 0x01, 0x01, 0x00, 0x05, 0x00, 0xff, 0x01,
+	0x03, 0x00, 0x1d, 0x12, 0x07, 0x08, 0x18, 0x00, 0x15, 0x01, 0x03, 0x02,
+	0x19, 0x00, 0x24, 0x04, 0x1a, 0x05, 0x1d, 0x1d, 0x02, 0x17, 0x01, 0x07,
+	0x08, 0x1a, 0x00, 0x04, 0x0b, 0x1a, 0x06, 0x29, 0x15, 0x15, 0x0f, 0x04,
+	0x0c, 0x0d, 0x02, 0x08, 0x0b, 0x06, 0x03, 0x0d, 0x03, 0x20, 0x00, 0x01,
+	0x2b, 0x04, 0x0b, 0x0b, 0x02, 0x07, 0x20, 0x0c, 0x03, 0x11, 0x02, 0x53,
+	0x13, 0x0f, 0x0f, 0x01, 0x08, 0x05, 0x07, 0x0f, 0x06, 0x12, 0x0c, 0x05,
+	0x0a, 0x06, 0x0e, 0x10, 0x02, 0x11, 0x12, 0x0b, 0x01, 0x15, 0x09, 0x11,
+	0x04, 0x0a, 0x0f, 0x16, 0x09, 0x44, 0x0c, 0x14, 0x03, 0x07, 0x14, 0x08,
+	0x03, 0x01, 0x12, 0x16, 0x07, 0x0f, 0x14, 0x04, 0x2c, 0x07, 0x11, 0x03,
+	0x05, 0x03, 0x01, 0x08, 0x08, 0x08, 0x03, 0x08, 0x06, 0x08, 0x07, 0x0b,
+	0x06, 0x13, 0x2b, 0x10, 0x05, 0x01, 0xff, 0x0d, 0x05, 0x16, 0x18, 0x0c,
+	0x06, 0x14, 0x0f, 0x02, 0x11, 0x0b, 0x0f, 0x2f, 0x01, 0x12, 0x09, 0x06,
+	0x1b, 0x01, 0x08, 0x3a, 0x05, 0x1a, 0x07, 0x14, 0x05, 0x06, 0x0b, 0x10,
+	0x03, 0x19, 0x06, 0x06, 0x27, 0x11, 0x07, 0x08, 0x1b, 0x13, 0x11, 0x03,
+	0x14, 0x0b, 0x1c, 0x08, 0x02, 0x0a, 0x19, 0x02, 0x05, 0x06, 0x08, 0x09,
+	0x02, 0x05, 0x0e, 0x10, 0x0b, 0x01, 0x03, 0x0c, 0x09, 0x04, 0x09, 0x07,
+	0x19, 0x03, 0x04, 0x07, 0x06, 0x02, 0x03, 0x05, 0x03, 0x08, 0x05, 0x0b,
+	0x04, 0x04, 0x04, 0x06, 0x03, 0x16, 0x07, 0x03, 0x07, 0x18, 0x15, 0x03,
+	0x17, 0x01, 0x0a, 0x08, 0x12, 0x10, 0x13, 0x04, 0x0d, 0x05, 0x0a, 0x03,
+	0x18, 0x03, 0x06, 0x13, 0x06, 0x08, 0x02, 0x02, 0x15, 0x01, 0x10, 0x0b,
+	0x07, 0x0f, 0x02, 0x07, 0x01, 0x05, 0x0c, 0x01, 0x01, 0x09, 0x0b, 0x07,
+	0x13, 0x03, 0xff, 0x16, 0x00, 0x0e, 0x05, 0x0e, 0x2d, 0x07, 0x0a, 0x19,
+	0x16, 0x02, 0x03, 0x09, 0x11, 0x0d, 0x0e, 0x02, 0x02, 0x04, 0x0b, 0x01,
+	0x08, 0x0e, 0x04, 0x08, 0x0f, 0x06, 0x05, 0x06, 0x03, 0x07, 0x0d, 0x1c,
+	0x04, 0x37, 0x2a, 0x38, 0x36, 0x00, 0x38, 0x04, 0x01, 0x05, 0x09, 0x0c,
+	0x1e, 0x0b, 0x0f, 0x04, 0x04, 0x12, 0x06, 0x15, 0x13, 0x05, 0x05, 0x18,
+	0x01, 0x1f, 0x15, 0x13, 0x14, 0x14, 0x01, 0x15, 0x0d, 0x0a, 0x04, 0x15,
+	0x0a, 0x00, 0x32, 0x1a, 0x0c, 0x0f, 0x06, 0x11, 0x10, 0x1e, 0x05, 0x11,
+	0x06, 0x0b, 0x20, 0x02, 0x03, 0x04, 0x11, 0x01, 0x0f, 0x0f, 0x01, 0x01,
+	0x07, 0x0b, 0x13, 0x08, 0x0d, 0x11, 0x03, 0x03, 0x29, 0x01, 0x03, 0x1c,
+	0x00, 0x0a, 0x01, 0x03, 0x0a, 0x09, 0x02, 0x0a, 0x03, 0x1c, 0x03, 0x09,
+	0x05, 0x02, 0x05, 0x05, 0x02, 0x1d, 0x09, 0x0c, 0x03, 0x0a, 0xff, 0x02,
+	0x04, 0x07, 0x0a, 0x04, 0x05, 0x10, 0x02, 0x08, 0x22, 0x02, 0x00, 0x08,
+	0x05, 0x0d, 0x01, 0x0a, 0x03, 0x08, 0x03, 0x2a, 0x05, 0x54, 0x17, 0x0d,
+	0x11, 0x09, 0x13, 0x01, 0x03, 0x0d, 0x0c, 0x04, 0x11, 0x18, 0x0c, 0x18,
+	0x09, 0x06, 0x06, 0x01, 0x04, 0x13, 0x07, 0x02, 0x10, 0x13, 0x02, 0x15,
+	0x02, 0x05, 0x04, 0x0b, 0x05, 0x03, 0x03, 0x02, 0x07, 0x02, 0x0c, 0x06,
+	0x12, 0x06, 0x04, 0x24, 0x07, 0x0b, 0x19, 0x04, 0x03, 0x1a, 0x0a, 0x03,
+	0x06, 0x0b, 0x0e, 0x0e, 0x07, 0x07, 0x07, 0x03, 0x00, 0x03, 0x05, 0x05,
+	0x11, 0x08, 0x04, 0x0d, 0x0b, 0x02, 0x08, 0x1c, 0x0c, 0x07, 0x0b, 0x05,
+	0x0a, 0x08, 0x02, 0x15, 0x19, 0x15, 0x0e, 0x05, 0x05, 0x06, 0x0e, 0x10,
+	0x05, 0x04, 0x02, 0x02, 0x02, 0x0b, 0x02, 0x0d, 0x11, 0x04, 0x07, 0x08,
+	0x02, 0x19, 0x02, 0x00, 0x06, 0x04, 0xff, 0x04, 0x01, 0x09, 0x07, 0x03,
+	0x1b, 0x0f, 0x1c, 0x0c, 0x03, 0x0c, 0x01, 0x05, 0x12, 0x03, 0x13, 0x03,
+	0x12, 0x09, 0x03, 0x14, 0x0c, 0x0c, 0x18, 0x12, 0x00, 0x38, 0x00, 0x09,
+	0x22, 0x22, 0x22, 0x00, 0x05, 0x00, 0x22, 0x04, 0x04, 0x04, 0x00, 0x22,
+	0x04, 0x01, 0x06, 0x17, 0x0e, 0x0f, 0x17, 0x10, 0x10, 0x17, 0x07, 0x11,
+	0x05, 0x02, 0x02, 0x11, 0x08, 0x03, 0x0b, 0x18, 0x16, 0x1c, 0x07, 0x02,
+	0x08, 0x0b, 0x19, 0x17, 0x27, 0x0a, 0x08, 0x06, 0x19, 0x1e, 0x06, 0x0d,
+	0x0f, 0x00, 0x0b, 0x06, 0x0b, 0x13, 0x0f, 0x01, 0x0b, 0x23, 0x0e, 0x0c,
+	0x08, 0x13, 0x0f, 0x06, 0x0a, 0x07, 0x02, 0x04, 0x03, 0x0b, 0x00, 0x02,
+	0x0c, 0x02, 0x00, 0x18, 0x10, 0x05, 0x0a, 0x10, 0x10, 0x07, 0x07, 0x00,
+	0x0c, 0x06, 0x10, 0x0b, 0x0e, 0x0c, 0x14, 0x05, 0x09, 0x07, 0x12, 0x14,
+	0x0d, 0x0b, 0xff, 0x1a, 0x0b, 0x20, 0x05, 0x0e, 0x13, 0x04, 0x23, 0x0c,
+	0x0c, 0x26, 0x04, 0x19, 0x06, 0x02, 0x02, 0x1e, 0x0f, 0x11, 0x1a, 0x02,
+	0x14, 0x13, 0x07, 0x06, 0x15, 0x02, 0x15, 0x01, 0x07, 0x07, 0x16, 0x16,
+	0x02, 0x0f, 0x0a, 0x07, 0x0f, 0x0e, 0x09, 0x03, 0x04, 0x09, 0x03, 0x05,
+	0x11, 0x0b, 0x0e, 0x07, 0x0c, 0x0b, 0x09, 0x0e, 0x17, 0x16, 0x0f, 0x0b,
+	0x06, 0x06, 0x06, 0x05, 0x0c, 0x13, 0x05, 0x07, 0x14, 0x04, 0x05, 0x17,
+	0x0c, 0x0d, 0x00, 0x0f, 0x0c, 0x06, 0x01, 0x02, 0x18, 0x01, 0x02, 0x01,
+	0x0d, 0x0f, 0x02, 0x09, 0x06, 0x0b, 0x13, 0x02, 0x02, 0x0c, 0x03, 0x04,
+	0x05, 0x05, 0x02, 0x05, 0x08, 0x0d, 0x09, 0x0f, 0x05, 0x06, 0x04, 0x04,
+	0x02, 0x06, 0x09, 0x08, 0x03, 0x12, 0x06, 0x0b, 0x06, 0x02, 0x0b, 0x08,
+	0x0e, 0x0c, 0x13, 0x18, 0x0a, 0x18, 0x0d, 0x0d, 0x14, 0x0e, 0xff, 0x0c,
+	0x11, 0x00, 0x04, 0x0a, 0x01, 0x0c, 0x0f, 0x02, 0x0a, 0x17, 0x02, 0x10,
+	0x15, 0x02, 0x00, 0x06, 0x05, 0x10, 0x14, 0x00, 0x02, 0x12, 0x0b, 0x02,
+	0x08, 0x0f, 0x08, 0x03, 0x1a, 0x0f, 0x0f, 0x0e, 0x07, 0x02, 0x09, 0x0c,
+	0x0c, 0x0f, 0x13, 0x0a, 0x08, 0x06, 0x16, 0x17, 0x06, 0x0d, 0x16, 0x00,
+	0x0b, 0x06, 0x0b, 0x1a, 0x0f, 0x01, 0x0b, 0x0d, 0x12, 0x18, 0x07, 0x0b,
+	0x09, 0x10, 0x12, 0x0f, 0x0d, 0x0a, 0x05, 0x02, 0x02, 0x02, 0x0d, 0x02,
+	0x06, 0x06, 0x0e, 0x16, 0x13, 0x02, 0x04, 0x0e, 0x08, 0x0e, 0x0a, 0x09,
+	0x0d, 0x14, 0x02, 0x0b, 0x03, 0x15, 0x03, 0x0e, 0x09, 0x0a, 0x14, 0x07,
+	0x0c, 0x0a, 0x07, 0x06, 0x10, 0x04, 0x03, 0x01, 0x10, 0x07, 0x0b, 0x0f,
+	0x04, 0x01, 0x05, 0x07, 0x06, 0x03, 0x03, 0x09, 0x06, 0x0c, 0x03, 0x0b,
+	0x04, 0x0f, 0x07, 0x11, 0x0d, 0x06, 0xff, 0x0a, 0x0d, 0x0c, 0x03, 0x01,
+	0x25, 0x08, 0x0e, 0x0b, 0x04, 0x0e, 0x06, 0x10, 0x08, 0x0f, 0x10, 0x04,
+	0x07, 0x0f, 0x08, 0x12, 0x09, 0x0b, 0x0b, 0x06, 0x02, 0x09, 0x10, 0x0e,
+	0x0c, 0x16, 0x0c, 0x34, 0x0e, 0x07, 0x11, 0x0a, 0x14, 0x07, 0x34, 0x1b,
+	0x10, 0x00, 0x18, 0x20, 0x20, 0x20, 0x00, 0x1b, 0x04, 0x01, 0x0f, 0x16,
+	0x13, 0x15, 0x10, 0x16, 0x04, 0x11, 0x06, 0x11, 0x17, 0x04, 0x03, 0x05,
+	0x16, 0x05, 0x01, 0x03, 0x17, 0x0a, 0x04, 0x09, 0x04, 0x17, 0x08, 0x18,
+	0x01, 0x02, 0x01, 0x06, 0x0c, 0x02, 0x0c, 0x06, 0x09, 0x05, 0x09, 0x09,
+	0x04, 0x02, 0x0c, 0x07, 0x03, 0x0c, 0x15, 0x07, 0x0d, 0x17, 0x0a, 0x0c,
+	0x03, 0x17, 0x00, 0x06, 0x08, 0x1a, 0x0a, 0x09, 0x01, 0x0f, 0x07, 0x0d,
+	0x03, 0x0c, 0x16, 0x01, 0x0c, 0x0c, 0x05, 0x02, 0x0f, 0x09, 0x08, 0x09,
+	0x0c, 0x0c, 0xd4, 0x03, 0x04, 0x09, 0x03, 0x07, 0x03, 0x08, 0x08, 0x04,
+	0x0d, 0x05, 0x04, 0x0c, 0x0a, 0x09, 0x05, 0x06, 0x1d, 0x0b, 0x07, 0x07,
+	0x11, 0x23, 0x06, 0x09, 0x04, 0x13, 0x01, 0x02, 0x01, 0x0d, 0x0f, 0x02,
+	0x07, 0x06, 0x0b, 0x0e, 0x00, 0x21, 0x03, 0x03, 0x0f, 0x03, 0x06, 0x04,
+	0x0c, 0x14, 0x05, 0x08, 0x32, 0x13, 0x00, 0x2c, 0x29, 0x4f, 0x2b, 0x15,
+	0x08, 0x0a, 0x0b, 0x39, 0x0d, 0x14, 0x01, 0x14, 0x01, 0x14, 0x14, 0x02,
+	0x06, 0x39, 0x04, 0x04, 0x15, 0x19, 0x0b, 0x04, 0x1a, 0x13, 0x13, 0x13,
+	0x21, 0x12, 0x00, 0x17, 0x00, 0x83, 0x01, 0x01, 0x00, 0x0b, 0x00, 0xb5,
+	0x01, 0x03, 0x03, 0x30, 0x0d, 0x33, 0x01, 0x14, 0x0b, 0x14, 0x03, 0x00,
+	0x00, 0x05, 0x01, 0x16, 0x00, 0x01, 0x05, 0x05, 0x05, 0x03, 0x28, 0x10,
+	0x18, 0x05, 0x05, 0x01, 0x03, 0x10, 0x06, 0x09, 0x01, 0x45, 0x01, 0x09,
+	0x06, 0x07, 0x03, 0x1c, 0x16, 0x08, 0x13, 0x05, 0x1b, 0x06, 0x00, 0x0a,
+	0x11, 0x11, 0x12, 0x13, 0x00, 0x17, 0x00, 0x83, 0x01, 0x01, 0x00, 0x0b,
+	0x00, 0xd0, 0x01, 0x03, 0x03, 0x12, 0x00, 0x06, 0x1f, 0x0b, 0x16, 0x03,
+	0x11, 0x01, 0x04, 0x19, 0x0f, 0x03, 0x0e, 0x1f, 0x16, 0x13, 0x19, 0x08,
+	0x14, 0x07, 0x28, 0x03, 0x03, 0x2b, 0x0a, 0x19, 0x13, 0x13, 0x00, 0x32,
+	0x12, 0x12, 0x0b, 0x0a, 0x01, 0x0a, 0x0d, 0x10, 0x0b, 0x11, 0x06, 0x05,
+	0x06, 0x06, 0x0c, 0x02, 0x06, 0x09, 0x0f, 0x1a, 0x0b, 0x04, 0x01, 0x05,
+	0x09, 0x07, 0x1c, 0x0e, 0x00, 0x16, 0x31, 0x18, 0x1c, 0x0e, 0x11, 0x0a,
+	0x29, 0x03, 0x03, 0x0d, 0x12, 0x0d, 0x12, 0x07, 0x1f, 0x13, 0x01, 0x13,
+	0x89, 0x0b, 0x04, 0x1e, 0x13, 0x13, 0x13, 0x16, 0x13, 0x00, 0x12, 0x00,
+	0xa0, 0x01, 0x03, 0x03, 0x1d, 0x0d, 0x1d, 0x01, 0x15, 0x0b, 0x14, 0x03,
+	0x00, 0x00, 0x05, 0x01, 0x38, 0x01, 0x05, 0x05, 0x05, 0x03, 0x03, 0x1d,
+	0x03, 0x16, 0x04, 0x07, 0x0a, 0x0a, 0x0b, 0x0c, 0x00, 0x12, 0x00, 0xff,
+	0x01, 0x03, 0x00, 0x2e, 0x20, 0x08, 0x08, 0x01, 0x11, 0x14, 0x14, 0x14,
+	0x04, 0x18, 0x06, 0x2e, 0x05, 0x03, 0x26, 0x1d, 0x05, 0x1a, 0x15, 0x04,
+	0x08, 0x04, 0x05, 0x07, 0x18, 0x0f, 0x00, 0x18, 0x11, 0x06, 0x11, 0x11,
+	0x09, 0x03, 0x0f, 0x0c, 0x10, 0x15, 0x02, 0x0c, 0x12, 0x1b, 0x12, 0x17,
+	0x09, 0x06, 0x11, 0x02, 0x02, 0x06, 0x01, 0x08, 0x01, 0x07, 0x13, 0x02,
+	0x3c, 0x0d, 0x0d, 0x28, 0x09, 0x05, 0x08, 0x02, 0x29, 0x22, 0x0c, 0x04,
+	0x04, 0x1c, 0x09, 0x02, 0x07, 0x0d, 0x01, 0x05, 0x01, 0x0d, 0x0d, 0x02,
+	0x0d, 0x07, 0x0d, 0x08, 0x07, 0x10, 0x02, 0x02, 0x12, 0x05, 0x03, 0x0c,
+	0x0a, 0x0e, 0x04, 0x04, 0x23, 0x04, 0x0c, 0x0f, 0x05, 0x05, 0x04, 0x07,
+	0x17, 0x03, 0x00, 0x00, 0x0a, 0x0a, 0x06, 0x03, 0x0c, 0x02, 0x14, 0x0d,
+	0x03, 0x03, 0x14, 0x05, 0x10, 0x0a, 0x16, 0xff, 0x0b, 0x32, 0x02, 0x05,
+	0x17, 0x0c, 0x09, 0x03, 0x08, 0x14, 0x25, 0x11, 0x10, 0x05, 0x16, 0x03,
+	0x28, 0x00, 0x08, 0x0f, 0x05, 0x09, 0x0f, 0x02, 0x05, 0x03, 0x14, 0x00,
+	0x06, 0x11, 0x05, 0x08, 0x0b, 0x02, 0x0b, 0x12, 0x02, 0x02, 0x0e, 0x07,
+	0x03, 0x16, 0x15, 0x32, 0x0c, 0x03, 0x03, 0x0c, 0x05, 0x0e, 0x09, 0x0f,
+	0x07, 0x11, 0x23, 0x06, 0x09, 0x09, 0x07, 0x17, 0x0d, 0x17, 0x45, 0x17,
+	0x08, 0x2f, 0x11, 0x09, 0x0e, 0x09, 0x09, 0x06, 0x16, 0x13, 0x05, 0x03,
+	0x0c, 0x05, 0x08, 0x03, 0x12, 0x06, 0x10, 0x10, 0x05, 0x12, 0x08, 0x07,
+	0x11, 0x0d, 0x03, 0x0d, 0x0b, 0x05, 0x12, 0x0a, 0x02, 0x05, 0x04, 0x09,
+	0x03, 0x16, 0x06, 0x07, 0x06, 0x02, 0x0c, 0x08, 0x09, 0x0e, 0x1d, 0x09,
+	0x03, 0x04, 0x09, 0x03, 0x07, 0x10, 0x02, 0x02, 0x09, 0x02, 0x0b, 0x34,
+	0x18, 0x09, 0x12, 0xff, 0x05, 0x06, 0x0d, 0x02, 0x01, 0x0d, 0x02, 0x04,
+	0x05, 0x03, 0x12, 0x09, 0x02, 0x16, 0x06, 0x00, 0x00, 0x08, 0x11, 0x07,
+	0x0f, 0x04, 0x04, 0x04, 0x07, 0x03, 0x12, 0x0e, 0x06, 0x01, 0x02, 0x07,
+	0x0b, 0x05, 0x03, 0x03, 0x08, 0x12, 0x09, 0x05, 0x06, 0x09, 0x09, 0x0c,
+	0x07, 0x06, 0x06, 0x0d, 0x0e, 0x04, 0x18, 0x02, 0x02, 0x04, 0x0b, 0x01,
+	0x0f, 0x0a, 0x11, 0x01, 0x02, 0x01, 0x0b, 0x0d, 0x02, 0x05, 0x33, 0x07,
+	0x02, 0x0a, 0x0b, 0x15, 0x11, 0x0c, 0x01, 0x03, 0x0a, 0x06, 0x07, 0x02,
+	0x14, 0x03, 0x11, 0x0b, 0x04, 0x11, 0x09, 0x11, 0x33, 0x07, 0x03, 0x0a,
+	0x14, 0x03, 0x00, 0x00, 0x03, 0x05, 0x0b, 0x02, 0x03, 0x14, 0x03, 0x03,
+	0x11, 0x05, 0x20, 0x06, 0x0c, 0x0d, 0x10, 0x02, 0x03, 0x24, 0x14, 0x12,
+	0x0a, 0x05, 0x05, 0x0b, 0x01, 0x08, 0x05, 0x05, 0x05, 0x06, 0x06, 0xff,
+	0x05, 0x06, 0x20, 0x03, 0x03, 0x17, 0x06, 0x05, 0x07, 0x10, 0x02, 0x02,
+	0x0d, 0x04, 0x03, 0x04, 0x05, 0x05, 0x15, 0x02, 0x02, 0x1b, 0x05, 0x1f,
+	0x08, 0x08, 0x03, 0x08, 0x07, 0x07, 0x08, 0x02, 0x02, 0x04, 0x0d, 0x0f,
+	0x13, 0x03, 0x00, 0x00, 0x06, 0x0f, 0x09, 0x19, 0x07, 0x1e, 0x03, 0x19,
+	0x07, 0x13, 0x05, 0x0b, 0x0e, 0x04, 0x12, 0x01, 0x0d, 0x05, 0x19, 0x19,
+	0x14, 0x0b, 0x06, 0x1f, 0x06, 0x0a, 0x03, 0x02, 0x07, 0x0c, 0x02, 0x18,
+	0x0b, 0x06, 0x03, 0x05, 0x0a, 0x07, 0x0d, 0x0d, 0x0b, 0x07, 0x02, 0x02,
+	0x10, 0x05, 0x04, 0x04, 0x04, 0x03, 0x14, 0x14, 0x05, 0x13, 0x02, 0x02,
+	0x04, 0x0b, 0x11, 0x02, 0x0d, 0x01, 0x0a, 0x09, 0x13, 0x01, 0x02, 0x01,
+	0x0e, 0x0f, 0x02, 0x05, 0x0c, 0x05, 0x14, 0x03, 0x00, 0x00, 0x08, 0x01,
+	0x13, 0x0b, 0x0c, 0x08, 0x07, 0x06, 0x05, 0xff, 0x16, 0x08, 0x2d, 0x02,
+	0x09, 0x4e, 0x0b, 0x19, 0x0a, 0x04, 0x0b, 0x13, 0x03, 0x03, 0x01, 0x1b,
+	0x0e, 0x05, 0x04, 0x07, 0x13, 0x03, 0x14, 0x02, 0x02, 0x04, 0x13, 0x11,
+	0x06, 0x08, 0x04, 0x05, 0x0a, 0x0a, 0x03, 0x0a, 0x13, 0x0b, 0x0b, 0x07,
+	0x05, 0x18, 0x03, 0x0c, 0x00, 0x08, 0x0c, 0x05, 0x09, 0x09, 0x08, 0x0c,
+	0x04, 0x02, 0x0b, 0x07, 0x03, 0x18, 0x07, 0x15, 0x06, 0x02, 0x07, 0x08,
+	0x15, 0x0a, 0x1f, 0x13, 0x15, 0x3b, 0x02, 0x0c, 0x2f, 0x0b, 0x00, 0x0e,
+	0x14, 0x14, 0x03, 0x05, 0x01, 0x0d, 0x02, 0x0b, 0x06, 0x12, 0x0f, 0x18,
+	0x00, 0x05, 0x07, 0x13, 0x06, 0x03, 0x05, 0x11, 0x0a, 0x14, 0x07, 0x05,
+	0x15, 0x03, 0x0a, 0x00, 0x08, 0x0b, 0x05, 0x1a, 0x0a, 0x08, 0x0b, 0x04,
+	0x14, 0x01, 0x1a, 0x04, 0x07, 0x06, 0x0d, 0x1b, 0x06, 0x10, 0x0c, 0x02,
+	0x0c, 0x21, 0x0e, 0xff, 0x0c, 0x11, 0x05, 0x01, 0x05, 0x09, 0x09, 0x0c,
+	0x0e, 0x06, 0x02, 0x0b, 0x02, 0x02, 0x03, 0x06, 0x16, 0x04, 0x00, 0x00,
+	0x0f, 0x05, 0x0f, 0x0f, 0x0a, 0x0a, 0x06, 0x49, 0x0e, 0x08, 0x08, 0x04,
+	0x0a, 0x14, 0x09, 0x04, 0x00, 0x03, 0x1a, 0x17, 0x0d, 0x33, 0x02, 0x08,
+	0x3d, 0x15, 0x02, 0x08, 0x11, 0x09, 0x11, 0x01, 0x04, 0x0b, 0x0d, 0x02,
+	0x11, 0x12, 0x02, 0x0f, 0x02, 0x07, 0x07, 0x04, 0x07, 0x06, 0x18, 0x11,
+	0x0b, 0x05, 0x0c, 0x06, 0x06, 0x01, 0x0b, 0x0c, 0x22, 0x06, 0x0a, 0x15,
+	0x05, 0x02, 0x03, 0x15, 0x0e, 0x02, 0x0b, 0x02, 0x02, 0x05, 0x03, 0x05,
+	0x0d, 0x04, 0x27, 0x01, 0x17, 0x0d, 0x16, 0x03, 0x11, 0x07, 0x07, 0x01,
+	0x06, 0x08, 0x05, 0x01, 0x0e, 0x04, 0x03, 0x05, 0x06, 0x0b, 0x1e, 0x05,
+	0x0c, 0x00, 0x15, 0x17, 0x00, 0x23, 0x0a, 0x05, 0x0a, 0x0d, 0x02, 0xff,
+	0x08, 0x09, 0x03, 0x03, 0x0a, 0x2a, 0x09, 0x00, 0x2a, 0x0b, 0x09, 0x46,
+	0x07, 0x07, 0x17, 0x0a, 0x02, 0x19, 0x06, 0x11, 0x0e, 0x07, 0x03, 0x10,
+	0x12, 0x06, 0x04, 0x04, 0x18, 0x14, 0x01, 0x08, 0x01, 0x06, 0x17, 0x02,
+	0x2b, 0x03, 0x04, 0x03, 0x0c, 0x06, 0x07, 0x05, 0x0a, 0x02, 0x06, 0x0b,
+	0x0a, 0x03, 0x01, 0x06, 0x14, 0x08, 0x14, 0x04, 0x0e, 0x11, 0x13, 0x17,
+	0x02, 0x09, 0x35, 0x06, 0x0e, 0x08, 0x04, 0x0f, 0x0c, 0x02, 0x04, 0x01,
+	0x0f, 0x04, 0x04, 0x19, 0x12, 0x08, 0x06, 0x21, 0x06, 0x12, 0x03, 0x02,
+	0x07, 0x0a, 0x02, 0x11, 0x0b, 0x06, 0x03, 0x05, 0x0a, 0x07, 0x04, 0x12,
+	0x0a, 0x03, 0x08, 0x12, 0x14, 0x00, 0x0a, 0x09, 0x0b, 0x10, 0x07, 0x1d,
+	0x16, 0x02, 0x0e, 0x0d, 0x02, 0x02, 0x11, 0x02, 0x09, 0x01, 0x08, 0x04,
+	0x0c, 0x06, 0x02, 0x0c, 0x0b, 0x07, 0x15, 0xff, 0x24, 0x09, 0x02, 0x0f,
+	0x0c, 0x01, 0x02, 0x01, 0x06, 0x0a, 0x02, 0x16, 0x06, 0x00, 0x00, 0x0b,
+	0x11, 0x04, 0x06, 0x04, 0x0b, 0x1e, 0x06, 0x1d, 0x02, 0x02, 0x04, 0x01,
+	0x07, 0x07, 0x03, 0x10, 0x04, 0x0b, 0x0f, 0x0a, 0x14, 0x06, 0x03, 0x05,
+	0x02, 0x05, 0x07, 0x0e, 0x01, 0x02, 0x08, 0x04, 0x05, 0x0c, 0x02, 0x07,
+	0x09, 0x04, 0x04, 0x04, 0x02, 0x0a, 0x08, 0x03, 0x11, 0x07, 0x0f, 0x06,
+	0x02, 0x07, 0x08, 0x11, 0x0b, 0x11, 0x1e, 0x0a, 0x07, 0x0e, 0x02, 0x02,
+	0x09, 0x02, 0x02, 0x0e, 0x02, 0x08, 0x01, 0x17, 0x04, 0x05, 0x0e, 0x0a,
+	0x06, 0x05, 0x09, 0x13, 0x08, 0x00, 0x00, 0x07, 0x10, 0x08, 0x0d, 0x04,
+	0x0e, 0x12, 0x06, 0x13, 0x02, 0x02, 0x04, 0x01, 0x07, 0x0b, 0x02, 0x03,
+	0x0b, 0x0d, 0x03, 0x0a, 0x0d, 0x06, 0x05, 0x06, 0x11, 0x08, 0x04, 0x05,
+	0x01, 0x03, 0x07, 0xff, 0x07, 0x04, 0x15, 0x0e, 0x2c, 0x02, 0x09, 0x2c,
+	0x0a, 0x0c, 0x13, 0x0a, 0x05, 0x01, 0x04, 0x0a, 0x03, 0x10, 0x0f, 0x05,
+	0x10, 0x02, 0x02, 0x04, 0x0e, 0x07, 0x0f, 0x0f, 0x01, 0x03, 0x05, 0x09,
+	0x04, 0x2c, 0x14, 0x2c, 0x09, 0x0e, 0x14, 0x08, 0x0e, 0x04, 0x02, 0x0c,
+	0x0a, 0x03, 0x17, 0x07, 0x0c, 0x06, 0x02, 0x07, 0x08, 0x0d, 0x0d, 0x17,
+	0x17, 0x0a, 0x0b, 0x29, 0x09, 0x0b, 0x0b, 0x02, 0x0a, 0x19, 0x07, 0x0b,
+	0x03, 0x02, 0x08, 0x26, 0x13, 0x05, 0x1a, 0x05, 0x06, 0x04, 0x1c, 0x1d,
+	0x08, 0x10, 0x1c, 0x07, 0x00, 0x00, 0x12, 0x19, 0x02, 0x0f, 0x15, 0x07,
+	0x03, 0x05, 0x0c, 0x15, 0x04, 0x17, 0x07, 0x06, 0x13, 0x08, 0x10, 0x0c,
+	0x01, 0x03, 0x05, 0x07, 0x04, 0x07, 0x07, 0x04, 0x07, 0x07, 0x02, 0x03,
+	0x27, 0x07, 0x07, 0x01, 0x03, 0x14, 0x12, 0x02, 0x06, 0x08, 0x05, 0xc8,
+	0x06, 0x01, 0x1c, 0x10, 0x2b, 0x02, 0x07, 0x20, 0x05, 0x1d, 0x01, 0x0d,
+	0x0a, 0x05, 0x13, 0x0a, 0x13, 0x15, 0x04, 0x11, 0x06, 0x08, 0x09, 0x04,
+	0x21, 0x01, 0x17, 0x11, 0x06, 0x12, 0x16, 0x05, 0x0e, 0x02, 0x00, 0x02,
+	0x03, 0x05, 0x08, 0x07, 0x07, 0x05, 0x05, 0x0a, 0x02, 0x15, 0x0d, 0x08,
+	0x04, 0x07, 0x0d, 0x0d, 0x16, 0x12, 0x14, 0x00, 0x43, 0x12, 0x0a, 0x07,
+	0x0c, 0x0e, 0x16, 0x0a, 0x03, 0x57, 0x0f, 0x07, 0x07, 0x11, 0x0c, 0x04,
+	0x01, 0x04, 0xff, 0x0a, 0x08, 0x0f, 0x00, 0x11, 0x06, 0x11, 0x0a, 0x0b,
+	0x0e, 0x2b, 0x7c, 0x1f, 0x04, 0x3a, 0x0d, 0x17, 0x0e, 0x13, 0x05, 0x18,
+	0x3a, 0x07, 0x01, 0x08, 0x04, 0x05, 0x15, 0x12, 0x03, 0x14, 0x11, 0x14,
+	0x0d, 0x0c, 0x06, 0x14, 0x00, 0x14, 0x06, 0x14, 0x44, 0x05, 0x02, 0x09,
+	0x04, 0x18, 0x04, 0x08, 0x0b, 0x12, 0x1a, 0x21, 0x07, 0x05, 0x0b, 0x10,
+	0x10, 0x10, 0x1a, 0x04, 0x10, 0x0b, 0x0d, 0x0d, 0x03, 0x0e, 0x0a, 0x06,
+	0x20, 0x05, 0x06, 0x07, 0x03, 0x23, 0x02, 0x0c, 0x0c, 0x06, 0x03, 0x1e,
+	0x0e, 0x10, 0x00, 0x01, 0x21, 0x0b, 0x13, 0x12, 0x07, 0x10, 0x1f, 0x11,
+	0x00, 0x06, 0x06, 0x02, 0x0d, 0x06, 0x16, 0x07, 0x0d, 0x08, 0x11, 0x0c,
+	0x08, 0x01, 0x02, 0x04, 0x2c, 0x14, 0x00, 0x35, 0x0f, 0x12, 0x0f, 0x11,
+	0x07, 0x0e, 0x27, 0x03, 0x0b, 0x00, 0x34, 0x20, 0x08, 0x07, 0xff, 0x1a,
+	0x0e, 0x3f, 0x11, 0x17, 0x00, 0x05, 0x1a, 0x0d, 0x17, 0x0c, 0x17, 0x03,
+	0x05, 0x1b, 0x18, 0x04, 0x1a, 0x29, 0x06, 0x56, 0x18, 0x18, 0x00, 0x1c,
+	0x0a, 0x08, 0x06, 0x12, 0x01, 0x0a, 0x0c, 0x18, 0x0e, 0x06, 0x07, 0x0f,
+	0x07, 0x0c, 0x08, 0x08, 0x1c, 0x09, 0x08, 0x01, 0x03, 0x09, 0x1f, 0x08,
+	0x11, 0x0c, 0x07, 0x1d, 0x17, 0x56, 0x06, 0x04, 0x09, 0x02, 0x02, 0x04,
+	0x0f, 0x03, 0x1b, 0x05, 0x0b, 0x11, 0x05, 0x0e, 0x08, 0x07, 0x0c, 0x0c,
+	0x03, 0x0c, 0x0b, 0x13, 0x13, 0x00, 0x10, 0x0c, 0x09, 0x07, 0x06, 0x0b,
+	0x03, 0x1d, 0x06, 0x06, 0x1a, 0x0f, 0x04, 0x05, 0x18, 0x03, 0x16, 0x03,
+	0x0a, 0x0a, 0x0a, 0x03, 0x12, 0x06, 0x00, 0x1c, 0x10, 0x06, 0x06, 0x02,
+	0x0b, 0x07, 0x1f, 0x1b, 0x0c, 0x00, 0x06, 0x0c, 0x45, 0x12, 0x00, 0x12,
+	0x00, 0x12, 0x06, 0x09, 0x1f, 0x10, 0xff, 0x09, 0x13, 0x17, 0x13, 0x11,
+	0x07, 0x4c, 0x01, 0x38, 0x31, 0x4a, 0x01, 0x02, 0x50, 0x01, 0x4f, 0x01,
+	0x25, 0x38, 0x49, 0x47, 0x05, 0x43, 0x43, 0x0a, 0x53, 0x07, 0x06, 0x29,
+	0x0d, 0x29, 0x1a, 0x1a, 0x00, 0x00, 0x22, 0x1e, 0x15, 0x29, 0x02, 0x02,
+	0x07, 0x22, 0x01, 0x1c, 0x01, 0x05, 0x06, 0x27, 0x1f, 0x07, 0x01, 0x03,
+	0x1c, 0x29, 0x07, 0x1f, 0x1f, 0x04, 0x1f, 0x08, 0x1f, 0x06, 0x12, 0x01,
+	0x0c, 0x0e, 0x0c, 0x22, 0x22, 0x13, 0x13, 0x00, 0x00, 0x11, 0x0a, 0x06,
+	0x22, 0x0c, 0x0b, 0x01, 0x04, 0x0f, 0x03, 0x26, 0x06, 0x10, 0x25, 0x14,
+	0x04, 0x05, 0x13, 0x07, 0x06, 0x13, 0x0a, 0x0a, 0x06, 0x27, 0x02, 0x12,
+	0x12, 0x01, 0x03, 0x05, 0x08, 0x04, 0x0f, 0x07, 0x06, 0x0a, 0x0c, 0x0b,
+	0x0b, 0x12, 0x12, 0x12, 0x00, 0x29, 0x09, 0x0c, 0x09, 0x0b, 0x02, 0x03,
+	0x19, 0x07, 0xe2, 0x07, 0x00, 0x00, 0x0b, 0x19, 0x0f, 0x16, 0x02, 0x02,
+	0x07, 0x01, 0x12, 0x09, 0x03, 0x16, 0x16, 0x13, 0x0d, 0x07, 0x05, 0x14,
+	0x08, 0x14, 0x06, 0x01, 0x03, 0x05, 0x09, 0x04, 0x06, 0x08, 0x14, 0x02,
+	0x05, 0x08, 0x06, 0x03, 0x11, 0x0e, 0x00, 0x28, 0x0b, 0x06, 0x06, 0x02,
+	0x17, 0x07, 0x28, 0x10, 0x10, 0x00, 0x06, 0x0e, 0x16, 0x14, 0x14, 0x00,
+	0x00, 0x13, 0x0c, 0x12, 0x08, 0x11, 0x0c, 0x01, 0x04, 0x0a, 0x03, 0x18,
+	0x06, 0x13, 0x0f, 0x12, 0x04, 0x05, 0x3d, 0x01, 0x15, 0x09, 0x13, 0x11,
+	0x01, 0x03, 0x0c, 0x0c, 0x04, 0x06, 0x05, 0x15, 0x0a, 0x0c, 0x19, 0x13,
+	0x13, 0x13, 0x00, 0x19, 0x02, 0x01, 0x02, 0xb1, 0x00, 0x4a, 0x0c, 0x0e,
+	0x09, 0x2b, 0x1a, 0x0f, 0x05, 0x17, 0x00, 0x16, 0x06, 0x0e, 0x11, 0x03,
+	0x04, 0x02, 0x08, 0x18, 0x0a, 0x14, 0x04, 0x18, 0x14, 0x07, 0x15, 0x04,
+	0x01, 0x05, 0x04, 0x0a, 0x04, 0x07, 0x0b, 0x0a, 0x0e, 0x0e, 0x0e, 0x0b,
+	0x00, 0x0e, 0x06, 0x09, 0x1d, 0x0a, 0x0a, 0x04, 0x0a, 0x02, 0x0a, 0xff,
+	0x00, 0x0a, 0x06, 0x0a, 0x09, 0x03, 0x04, 0x02, 0x16, 0x03, 0x09, 0x01,
+	0x0e, 0x08, 0x19, 0x06, 0x1a, 0x2c, 0x02, 0x05, 0x11, 0x06, 0x15, 0x0b,
+	0x0f, 0x03, 0x00, 0x09, 0x07, 0x0e, 0x13, 0x02, 0x09, 0x09, 0x06, 0x03,
+	0x08, 0x02, 0x13, 0x11, 0x12, 0x06, 0x06, 0x08, 0x09, 0x05, 0x03, 0x09,
+	0x05, 0x08, 0x03, 0x11, 0x06, 0x12, 0x19, 0x05, 0x0c, 0x08, 0x07, 0x13,
+	0x0d, 0x03, 0x0d, 0x0b, 0x36, 0x06, 0x3b, 0x11, 0x0a, 0x00, 0x11, 0x15,
+	0x0e, 0x0e, 0x07, 0x17, 0x07, 0x02, 0x0c, 0x0b, 0x09, 0x03, 0x0e, 0x0e,
+	0x05, 0x0e, 0x06, 0x05, 0x09, 0x12, 0x08, 0x07, 0x07, 0x12, 0x15, 0x15,
+	0x0f, 0x0f, 0x0c, 0x09, 0x09, 0x09, 0x13, 0x02, 0x01, 0x0c, 0x0b, 0x0d,
+	0x04, 0x03, 0x04, 0x0f, 0x03, 0x00, 0x11, 0x04, 0x14, 0x15, 0x02, 0x0b,
+	0x03, 0x12, 0x07, 0x0c, 0x08, 0x09, 0x00, 0xff, 0x0e, 0x06, 0x0e, 0x15,
+	0x10, 0x00, 0x49, 0x00, 0x0c, 0x27, 0x43, 0x12, 0x0b, 0x08, 0x11, 0x02,
+	0x01, 0x06, 0x29, 0x49, 0x1a, 0x00, 0x0b, 0x00, 0x28, 0x16, 0x08, 0x07,
+	0x01, 0x0b, 0x0b, 0x02, 0x0b, 0x0b, 0x02, 0x01, 0x05, 0x36, 0x0c, 0x0c,
+	0x0c, 0x00, 0x36, 0x04, 0x01, 0x05, 0x18, 0x12, 0x15, 0x17, 0x19, 0x0e,
+	0x06, 0x29, 0x4e, 0x2f, 0x4c, 0x24, 0x18, 0x03, 0x51, 0x31, 0x13, 0x13,
+	0x13, 0x00, 0x54, 0x0a, 0x2f, 0x0d, 0x1f, 0x20, 0x02, 0x10, 0x1c, 0x1a,
+	0x03, 0x04, 0x13, 0x14, 0x04, 0x04, 0x03, 0x04, 0x02, 0x19, 0x0e, 0x0e,
+	0x0e, 0x00, 0x19, 0x04, 0x01, 0x05, 0x08, 0x1c, 0x22, 0x02, 0x22, 0x0e,
+	0x20, 0x10, 0x1f, 0x08, 0x11, 0x1d, 0x2d, 0x03, 0x07, 0x04, 0x09, 0x03,
+	0x25, 0x06, 0x07, 0x26, 0x05, 0x13, 0x08, 0x07, 0x15, 0x15, 0x03, 0x0f,
+	0x0b, 0x07, 0x07, 0xff, 0x07, 0x06, 0x20, 0x04, 0x03, 0x01, 0x0a, 0x07,
+	0x0b, 0x22, 0x04, 0x01, 0x25, 0x06, 0x33, 0x01, 0x0f, 0x05, 0x08, 0x0f,
+	0x0e, 0x0e, 0x06, 0x24, 0x12, 0x07, 0x08, 0x0b, 0x05, 0x12, 0x05, 0x08,
+	0x08, 0x04, 0x10, 0x07, 0x00, 0x02, 0x0e, 0x0a, 0x02, 0x07, 0x07, 0x11,
+	0x03, 0x29, 0x04, 0x04, 0x04, 0x14, 0x01, 0x0d, 0x03, 0x06, 0x25, 0x2e,
+	0x48, 0x03, 0x0f, 0x09, 0x06, 0x0f, 0x04, 0x02, 0x02, 0x08, 0x03, 0x10,
+	0x02, 0x0d, 0x10, 0x2b, 0x11, 0x08, 0x07, 0x19, 0x05, 0x18, 0x01, 0x19,
+	0x09, 0x06, 0x01, 0x04, 0x11, 0x2c, 0x08, 0x0f, 0x0e, 0x0f, 0x1a, 0x02,
+	0x04, 0x04, 0x16, 0x0f, 0x0f, 0x11, 0x05, 0x18, 0x05, 0x0c, 0x0f, 0x10,
+	0x07, 0x00, 0x2c, 0x07, 0x18, 0x11, 0x02, 0x05, 0x01, 0x06, 0x02, 0x12,
+	0x0f, 0x0f, 0x05, 0x0b, 0x14, 0x02, 0x16, 0x4e, 0x19, 0x0c, 0x0d, 0xff,
+	0x0a, 0x0d, 0x16, 0x23, 0x09, 0x16, 0x03, 0x02, 0x0b, 0x0c, 0x11, 0x00,
+	0x01, 0x16, 0x08, 0x15, 0x06, 0x0c, 0x0c, 0x02, 0x12, 0x15, 0x02, 0x20,
+	0x29, 0x0b, 0x0e, 0x06, 0x0e, 0x4a, 0x35, 0x03, 0x18, 0x00, 0x01, 0x23,
+	0x09, 0x01, 0x0a, 0x19, 0x12, 0x10, 0x11, 0x01, 0x04, 0x0f, 0x1b, 0x0a,
+	0x12, 0x06, 0x1b, 0x1c, 0x07, 0x09, 0x08, 0x05, 0x03, 0x07, 0x04, 0x06,
+	0x04, 0x04, 0x18, 0x1c, 0x0f, 0x08, 0x04, 0x04, 0x04, 0x05, 0x1a, 0x05,
+	0x0c, 0x0a, 0x0c, 0x05, 0x0a, 0x09, 0x0b, 0x19, 0x02, 0x05, 0x18, 0x0c,
+	0x07, 0x15, 0x05, 0x03, 0x0d, 0x04, 0x03, 0x0a, 0x0e, 0x05, 0x11, 0x06,
+	0x05, 0x02, 0x04, 0x0c, 0x00, 0x16, 0x08, 0x09, 0x06, 0x0d, 0x0f, 0x02,
+	0x0e, 0x03, 0x07, 0x3c, 0x11, 0x00, 0x32, 0x1a, 0x25, 0x10, 0x0c, 0x0b,
+	0x16, 0x02, 0x01, 0x0c, 0x42, 0x03, 0x0d, 0x95, 0x01, 0x0c, 0x01, 0x06,
+	0x11, 0x02, 0x06, 0x0a, 0x04, 0x04, 0x0e, 0x09, 0x10, 0x04, 0x24, 0x10,
+	0x10, 0x10, 0x26, 0x1d, 0x00, 0x2f, 0x00, 0x83, 0x01, 0x01, 0x00, 0x0a,
+	0x00, 0xcc, 0x01, 0x03, 0x03, 0x4b, 0x0d, 0x4e, 0x01, 0x1a, 0x0b, 0x14,
+	0x03, 0x00, 0x00, 0x05, 0x01, 0x24, 0x00, 0x01, 0x05, 0x05, 0x05, 0x03,
+	0x25, 0x10, 0x18, 0x05, 0x05, 0x01, 0x03, 0x10, 0x06, 0x09, 0x01, 0x45,
+	0x01, 0x09, 0x06, 0x07, 0x03, 0x23, 0x16, 0x08, 0x13, 0x05, 0x1c, 0x06,
+	0x28, 0x1d, 0x08, 0x00, 0x03, 0x10, 0x0f, 0x26, 0x03, 0x0f, 0x01, 0x1a,
+	0x06, 0x0e, 0x08, 0x07, 0x17, 0x25, 0x03, 0x20, 0x00, 0x01, 0x08, 0x00,
+	0x09, 0x18, 0x18, 0x19, 0x08, 0x00, 0x2f, 0x00, 0x83, 0x01, 0x01, 0x00,
+	0x0a, 0x00, 0xfa, 0x01, 0x03, 0x00, 0x34, 0x11, 0x15, 0x08, 0x01, 0x15,
+	0x1d, 0x19, 0x1d, 0x04, 0x1e, 0x06, 0x05, 0x0e, 0x03, 0x00, 0x12, 0x05,
+	0x12, 0x06, 0x08, 0x09, 0x02, 0x04, 0x21, 0x19, 0x02, 0x04, 0x0b, 0x08,
+	0x02, 0x1a, 0x07, 0x0b, 0x01, 0x14, 0x02, 0x09, 0x06, 0x03, 0x03, 0x16,
+	0x05, 0x03, 0x03, 0x0a, 0x0e, 0x0f, 0x05, 0x20, 0x0e, 0x10, 0x03, 0x07,
+	0x10, 0x02, 0x0a, 0x05, 0x0e, 0x0e, 0x04, 0x06, 0x06, 0x02, 0x0b, 0x0a,
+	0x10, 0x03, 0x0e, 0x08, 0x1e, 0x23, 0x07, 0x14, 0x38, 0x08, 0x00, 0x05,
+	0x0a, 0x09, 0x0f, 0x04, 0x04, 0x01, 0x0c, 0x08, 0x0b, 0x0b, 0x0d, 0x08,
+	0x05, 0x05, 0x02, 0x01, 0x0d, 0x07, 0x03, 0x0a, 0x05, 0x12, 0x04, 0x04,
+	0x14, 0x0a, 0x06, 0x08, 0x07, 0x0a, 0x13, 0x08, 0x25, 0x09, 0x11, 0x0e,
+	0x02, 0x08, 0x12, 0x02, 0x2f, 0x01, 0x2f, 0xff, 0x00, 0x30, 0x32, 0x32,
+	0x3c, 0x33, 0x04, 0x08, 0x09, 0x29, 0x2e, 0x0d, 0x11, 0x15, 0x05, 0x2a,
+	0x2a, 0x0b, 0x18, 0x40, 0x05, 0x0a, 0x0a, 0x20, 0x1b, 0x0b, 0x22, 0x1c,
+	0x19, 0x22, 0x10, 0x2b, 0x1c, 0x0c, 0x32, 0x21, 0x10, 0x1f, 0x02, 0x04,
+	0x21, 0x0d, 0x0c, 0x21, 0x17, 0x05, 0x06, 0x08, 0x22, 0x02, 0x0e, 0x13,
+	0x05, 0x23, 0x0a, 0x23, 0x01, 0x11, 0x09, 0x01, 0x01, 0x47, 0x03, 0x06,
+	0x15, 0x0e, 0x06, 0x01, 0x03, 0x0d, 0x14, 0x11, 0x0e, 0x04, 0x05, 0x05,
+	0x02, 0x0e, 0x24, 0x11, 0x11, 0x04, 0x10, 0x0a, 0x04, 0x07, 0x04, 0x06,
+	0x16, 0x02, 0x0c, 0x0b, 0x0e, 0x03, 0x06, 0x0c, 0x13, 0x04, 0x17, 0x18,
+	0x15, 0x09, 0x04, 0x08, 0x14, 0x09, 0x02, 0x03, 0x0d, 0x12, 0x0e, 0x13,
+	0x04, 0x01, 0x05, 0x16, 0x08, 0x09, 0x0f, 0x04, 0x15, 0x07, 0x13, 0x0d,
+	0x04, 0x12, 0x04, 0xff, 0x09, 0x03, 0x05, 0x03, 0x04, 0x01, 0x02, 0x01,
+	0x0d, 0x0d, 0x02, 0x0e, 0x28, 0x11, 0x00, 0x20, 0x09, 0x08, 0x06, 0x09,
+	0x01, 0x02, 0x01, 0x09, 0x09, 0x02, 0x05, 0x0a, 0x0f, 0x0f, 0x0f, 0x04,
+	0x14, 0x01, 0x17, 0x07, 0x09, 0x17, 0x07, 0x07, 0x06, 0x0c, 0x09, 0x07,
+	0x08, 0x13, 0x05, 0x14, 0x06, 0x02, 0x49, 0x06, 0x0f, 0x05, 0x1a, 0x05,
+	0x0f, 0x0b, 0x0b, 0x10, 0x02, 0x04, 0x34, 0x27, 0x27, 0x27, 0x00, 0x34,
+	0x04, 0x01, 0x05, 0x14, 0x0e, 0x1b, 0x01, 0x0f, 0x04, 0x1f, 0x02, 0x10,
+	0x13, 0x1f, 0x0f, 0x07, 0x1c, 0x13, 0x09, 0x12, 0x03, 0x1b, 0x1a, 0x04,
+	0x0b, 0x09, 0x0e, 0x03, 0x0c, 0x17, 0x02, 0x18, 0x0a, 0x19, 0x0d, 0x09,
+	0x0a, 0x05, 0x0c, 0x07, 0x07, 0x0a, 0x03, 0x08, 0x08, 0x07, 0x0f, 0x1c,
+	0x08, 0x2b, 0x19, 0x06, 0x03, 0x13, 0x0f, 0x0a, 0x0c, 0x0b, 0x01, 0xff,
+	0x03, 0x0c, 0x06, 0x0f, 0x04, 0x08, 0x0e, 0x0d, 0x05, 0x0b, 0x08, 0x04,
+	0x04, 0x0a, 0x05, 0x04, 0x09, 0x07, 0x03, 0x06, 0x02, 0x05, 0x00, 0x03,
+	0x0a, 0x08, 0x0e, 0x07, 0x04, 0x04, 0x04, 0x06, 0x03, 0x04, 0x10, 0x20,
+	0x20, 0x05, 0x12, 0x13, 0x0d, 0x10, 0x09, 0x0e, 0x10, 0x0d, 0x08, 0x08,
+	0x0e, 0x05, 0x0f, 0x14, 0x08, 0x04, 0x0f, 0x11, 0x03, 0x09, 0x11, 0x0a,
+	0x03, 0x09, 0x0b, 0x05, 0x04, 0x0b, 0x09, 0x05, 0x0b, 0x07, 0x0c, 0x0d,
+	0x04, 0x00, 0x01, 0x1c, 0x04, 0x06, 0x06, 0x02, 0x13, 0x06, 0x04, 0x0b,
+	0x0e, 0x05, 0x11, 0x20, 0x0e, 0x0e, 0x0a, 0x05, 0x01, 0x03, 0x08, 0x0e,
+	0x02, 0x09, 0x09, 0x1f, 0x07, 0x0e, 0x03, 0x02, 0x05, 0x10, 0x0a, 0x03,
+	0x04, 0x02, 0x2b, 0x05, 0x04, 0x0d, 0x0d, 0x03, 0x05, 0x14, 0x04, 0x09,
+	0x16, 0x09, 0x14, 0x0f, 0x0f, 0x0a, 0x33, 0x9d, 0x09, 0x00, 0x2e, 0x21,
+	0x12, 0x0e, 0x0e, 0x08, 0x09, 0x14, 0x10, 0x34, 0x0f, 0x0f, 0x03, 0x32,
+	0x02, 0x1e, 0x12, 0x12, 0x0d, 0x04, 0x16, 0x12, 0x12, 0x12, 0x1e, 0x30,
+	0x00, 0x33, 0x00, 0x83, 0x01, 0x01, 0x00, 0x0b, 0x00, 0xd4, 0x01, 0x03,
+	0x03, 0x31, 0x0d, 0x34, 0x01, 0x18, 0x0b, 0x16, 0x03, 0x00, 0x00, 0x05,
+	0x01, 0x2c, 0x00, 0x01, 0x05, 0x05, 0x05, 0x03, 0x10, 0x10, 0x12, 0x10,
+	0x05, 0x05, 0x0e, 0x01, 0x09, 0x01, 0x0a, 0x01, 0x34, 0x01, 0x0b, 0x0b,
+	0x07, 0x03, 0x15, 0x18, 0x0a, 0x13, 0x05, 0x1c, 0x06, 0x2e, 0x19, 0x08,
+	0x00, 0x03, 0x12, 0x1e, 0x2c, 0x03, 0x0f, 0x01, 0x20, 0x07, 0x1a, 0x03,
+	0x04, 0x01, 0x2d, 0x20, 0x0d, 0x10, 0x0d, 0x0b, 0x0b, 0x07, 0x1b, 0x00,
+	0x00, 0x01, 0x00, 0x00, 0x09, 0x1b, 0x1b, 0x04, 0x18, 0x00, 0x33, 0x00,
+	0x83, 0x01, 0x01, 0x00, 0x0b, 0x00, 0xa5, 0x01, 0x03, 0x00, 0x26, 0x13,
+	0x0b, 0x08, 0x01, 0x15, 0x1c, 0x1c, 0x12, 0x04, 0x20, 0x06, 0x1d, 0x10,
+	0x04, 0x01, 0x03, 0x15, 0x01, 0x18, 0x1a, 0x15, 0x06, 0x08, 0x06, 0x05,
+	0x06, 0x03, 0x08, 0x0c, 0x03, 0x08, 0x02, 0x09, 0x01, 0x09, 0xa2, 0x0a,
+	0x07, 0x0b, 0x24, 0x02, 0x07, 0x09, 0x09, 0x1b, 0x0d, 0x0a, 0x06, 0x02,
+	0x05, 0x0b, 0x04, 0x0d, 0x0c, 0x05, 0x09, 0x07, 0x24, 0x10, 0x07, 0x0b,
+	0x04, 0x09, 0x04, 0x04, 0x09, 0x01, 0x04, 0x09, 0x03, 0x01, 0x03, 0xff,
+	0x05, 0x12, 0x0a, 0x05, 0x04, 0x0a, 0x05, 0x06, 0x2f, 0x24, 0x2c, 0x2c,
+	0x00, 0x30, 0x32, 0x32, 0x29, 0x40, 0x40, 0x09, 0x0a, 0x0f, 0x15, 0x0d,
+	0x10, 0x12, 0x11, 0x05, 0x11, 0x07, 0x07, 0x14, 0x02, 0x05, 0x01, 0x06,
+	0x18, 0x16, 0x03, 0x22, 0x44, 0x29, 0x03, 0x29, 0x26, 0x02, 0x1e, 0x0f,
+	0x1e, 0x0c, 0x1f, 0x11, 0x12, 0x2e, 0x08, 0x02, 0x1f, 0x08, 0x03, 0x29,
+	0x11, 0x14, 0x14, 0x07, 0x05, 0x0b, 0x02, 0x02, 0x13, 0x09, 0x06, 0x22,
+	0x02, 0x04, 0x06, 0x01, 0x15, 0x0e, 0x09, 0x21, 0x08, 0x17, 0x06, 0x07,
+	0x10, 0x0b, 0x02, 0x13, 0x05, 0x05, 0x01, 0x2f, 0x04, 0x06, 0x00, 0x11,
+	0x0c, 0x29, 0x26, 0x08, 0x26, 0x10, 0x0d, 0x0b, 0x04, 0x09, 0x03, 0x0b,
+	0x01, 0x12, 0x05, 0x05, 0x06, 0x13, 0x0f, 0x03, 0x07, 0x12, 0x13, 0x06,
+	0x04, 0x09, 0x13, 0x04, 0x08, 0x07, 0x14, 0xff, 0x10, 0x11, 0x0c, 0x00,
+	0x08, 0x18, 0x0f, 0x04, 0x0b, 0x18, 0x14, 0x11, 0x01, 0x03, 0x04, 0x2f,
+	0x0b, 0x04, 0x0f, 0x07, 0x0b, 0x07, 0x04, 0x04, 0x04, 0x17, 0x0a, 0x09,
+	0x0a, 0x08, 0x08, 0x02, 0x11, 0x04, 0x03, 0x07, 0x02, 0x11, 0x11, 0x03,
+	0x03, 0x10, 0x05, 0x05, 0x05, 0x0d, 0x17, 0x04, 0x05, 0x13, 0x0e, 0x0c,
+	0x04, 0x07, 0x19, 0x02, 0x0e, 0x13, 0x0f, 0x0d, 0x0a, 0x11, 0x05, 0x09,
+	0x07, 0x15, 0x08, 0x08, 0x11, 0x0b, 0x0d, 0x03, 0x06, 0x08, 0x04, 0x00,
+	0x36, 0x07, 0x0e, 0x28, 0x06, 0x0c, 0x08, 0x02, 0x02, 0x01, 0x0f, 0x09,
+	0x03, 0x05, 0x04, 0x04, 0x09, 0x0e, 0x03, 0x0f, 0x06, 0x12, 0x0e, 0x14,
+	0x07, 0x0c, 0x06, 0x19, 0x04, 0x00, 0x3d, 0x00, 0x09, 0x23, 0x05, 0x16,
+	0x01, 0x0b, 0x10, 0x05, 0x3d, 0x0f, 0x00, 0x16, 0x06, 0x05, 0x05, 0x2a,
+	0x2a, 0x2a, 0x00, 0xde, 0x0d, 0x00, 0x3d, 0x0b, 0x07, 0x01, 0x07, 0x1f,
+	0x02, 0x1d, 0x0a, 0x04, 0x1b, 0x0f, 0x02, 0x14, 0x0f, 0x02, 0x01, 0x1a,
+	0x1e, 0x07, 0x08, 0x05, 0x11, 0x05, 0x37, 0x05, 0x04, 0x1a, 0x02, 0x1a,
+	0x0a, 0x03, 0x08, 0x08, 0x06, 0x04, 0x04, 0x02, 0x0f, 0x0e, 0x20, 0x1d,
+	0x0a, 0x08, 0x06, 0x06, 0x03, 0x1b, 0x0a, 0x05, 0x05, 0x05, 0x0a, 0x02,
+	0x0a, 0x07, 0x10, 0x01, 0x0b, 0x06, 0x05, 0x02, 0x02, 0x02, 0x01, 0x1c,
+	0x04, 0x03, 0x08, 0x05, 0x13, 0x04, 0x15, 0x0b, 0x11, 0x06, 0x09, 0x07,
+	0x0d, 0x10, 0x08, 0x0a, 0x0e, 0x35, 0x03, 0x0f, 0x04, 0x07, 0x07, 0x0b,
+	0x03, 0x07, 0x01, 0x07, 0xff, 0x04, 0x07, 0x1e, 0x01, 0x0c, 0x09, 0x24,
+	0x05, 0x07, 0x05, 0x0b, 0x10, 0x04, 0x0d, 0x08, 0x10, 0x07, 0x04, 0x06,
+	0x0d, 0x0f, 0x07, 0x07, 0x0b, 0x0c, 0x07, 0x0b, 0x01, 0x16, 0x17, 0x14,
+	0x00, 0x03, 0x10, 0x0d, 0x05, 0x01, 0x02, 0x01, 0x08, 0x0d, 0x02, 0x1f,
+	0x06, 0x23, 0x11, 0x04, 0x03, 0x07, 0x02, 0x16, 0x01, 0x0c, 0x0f, 0x16,
+	0x12, 0x0d, 0x00, 0x12, 0x06, 0x05, 0x09, 0x04, 0x05, 0x09, 0x13, 0x09,
+	0x06, 0x06, 0x27, 0x28, 0x3d, 0x21, 0x1e, 0x36, 0x03, 0x2e, 0x2e, 0x24,
+	0x24, 0x24, 0x00, 0x25, 0x0a, 0x2a, 0x0d, 0x1f, 0x20, 0x22, 0x17, 0x18,
+	0x05, 0x13, 0x1b, 0x04, 0x03, 0x23, 0x07, 0x06, 0x06, 0x16, 0x20, 0x20,
+	0x08, 0x08, 0x24, 0x05, 0x04, 0x28, 0x04, 0x07, 0x1d, 0x02, 0x02, 0x0c,
+	0x08, 0x03, 0x1c, 0x08, 0x05, 0x08, 0x06, 0x05, 0x0c, 0x0b, 0x0c, 0x06,
+	0xff, 0x09, 0x08, 0x0d, 0x1f, 0x0c, 0x1f, 0x0a, 0x05, 0x01, 0x20, 0x04,
+	0x09, 0x0b, 0x0a, 0x01, 0x03, 0x0b, 0x06, 0x03, 0x02, 0x02, 0x04, 0x0c,
+	0x0c, 0x03, 0x29, 0x06, 0x06, 0x0d, 0x08, 0x04, 0x26, 0x06, 0x0c, 0x06,
+	0x06, 0x03, 0x12, 0x07, 0x0b, 0x0b, 0x04, 0x02, 0x02, 0x0b, 0x03, 0x01,
+	0x07, 0x10, 0x06, 0x08, 0x04, 0x22, 0x06, 0x0a, 0x07, 0x05, 0x03, 0x01,
+	0x05, 0x07, 0x07, 0x03, 0x03, 0x07, 0x05, 0x13, 0x03, 0x00, 0x10, 0x03,
+	0x0b, 0x0b, 0x04, 0x03, 0x25, 0x0c, 0x11, 0x06, 0x13, 0x13, 0x0d, 0x26,
+	0x0d, 0x09, 0x0e, 0x14, 0x09, 0x09, 0x0a, 0x11, 0x11, 0x0e, 0x05, 0x08,
+	0x0a, 0x02, 0x03, 0x09, 0x04, 0x09, 0x07, 0x02, 0x15, 0x0c, 0x07, 0x0b,
+	0x04, 0x0c, 0x09, 0x0b, 0x01, 0x08, 0x05, 0x0f, 0x2a, 0x07, 0x0d, 0x09,
+	0x07, 0x0d, 0x04, 0x0b, 0x0b, 0x03, 0x04, 0x02, 0xff, 0x27, 0x05, 0x39,
+	0x01, 0x07, 0x05, 0x0d, 0x08, 0x0d, 0x09, 0x06, 0x11, 0x0d, 0x11, 0x1a,
+	0x04, 0x17, 0x13, 0x12, 0x03, 0x0d, 0x0d, 0x08, 0x01, 0x0d, 0x05, 0x04,
+	0x14, 0x08, 0x05, 0x04, 0x19, 0x02, 0x00, 0x0e, 0x09, 0x0c, 0x01, 0x02,
+	0x03, 0x04, 0x03, 0x0e, 0x0c, 0x0a, 0x08, 0x08, 0x08, 0x0b, 0x09, 0x08,
+	0x04, 0x04, 0x08, 0x03, 0x0f, 0x03, 0x05, 0x03, 0x03, 0x0f, 0x02, 0x08,
+	0x16, 0x05, 0x03, 0x13, 0x02, 0x17, 0x01, 0x0a, 0x06, 0x02, 0x0a, 0x06,
+	0x09, 0x0a, 0x04, 0x0c, 0x19, 0x05, 0x0f, 0x0c, 0x0f, 0x0f, 0x02, 0x04,
+	0x09, 0x09, 0x12, 0x17, 0x04, 0x0d, 0x0e, 0x19, 0x0e, 0x0e, 0x05, 0x05,
+	0x0d, 0x0a, 0x14, 0x14, 0x0f, 0x05, 0x07, 0x07, 0x02, 0x06, 0x02, 0x0d,
+	0x0b, 0x19, 0x0b, 0x37, 0x0b, 0x00, 0x33, 0x22, 0x0c, 0x0b, 0x06, 0x17,
+	0x09, 0x12, 0x09, 0x09, 0x84, 0x09, 0x1b, 0x33, 0x00, 0x16, 0x00, 0xa4,
+	0x01, 0x03, 0x03, 0x34, 0x0f, 0x37, 0x01, 0x13, 0x0e, 0x0e, 0x03, 0x00,
+	0x00, 0x05, 0x01, 0x4d, 0x01, 0x05, 0x05, 0x05, 0x03, 0x0c, 0x03, 0x03,
+	0x0f, 0x0f, 0x0f, 0x05, 0x06, 0x00, 0x09, 0x0c, 0x0c, 0x0d, 0x0e, 0x00,
+	0x16, 0x00, 0x96, 0x01, 0x03, 0x00, 0x03, 0x34, 0x0a, 0x16, 0x08, 0x2c,
+	0x0e, 0x17, 0x0f, 0x0e, 0x16, 0x1b, 0x09, 0x15, 0x0d, 0x0d, 0x0e, 0x0f,
+	0x00, 0x37, 0x00, 0xa5, 0x01, 0x03, 0x03, 0x10, 0x0e, 0x38, 0x01, 0x14,
+	0x0f, 0x0e, 0x03, 0x00, 0x00, 0x05, 0x01, 0x05, 0x01, 0x05, 0x05, 0x05,
+	0x03, 0x00, 0x00, 0x05, 0x01, 0x16, 0x00, 0x01, 0x05, 0x05, 0x05, 0x03,
+	0x1e, 0x03, 0x11, 0x04, 0x11, 0x01, 0x11, 0x9e, 0x08, 0x10, 0x01, 0x0b,
+	0x01, 0x0c, 0x01, 0x34, 0x01, 0x0d, 0x0c, 0x0b, 0x03, 0x16, 0x09, 0x0b,
+	0x22, 0x05, 0x1f, 0x06, 0x0c, 0x01, 0x35, 0x01, 0x0c, 0x14, 0x14, 0x15,
+	0x06, 0x00, 0x37, 0x00, 0x99, 0x01, 0x03, 0x00, 0x03, 0x29, 0x0c, 0x23,
+	0x01, 0x14, 0x0c, 0x0a, 0x19, 0x11, 0x16, 0x04, 0x05, 0x11, 0x16, 0x08,
+	0x19, 0x0d, 0x0d, 0x0e, 0x0f, 0x00, 0x31, 0x00, 0xbf, 0x01, 0x03, 0x03,
+	0x10, 0x0e, 0x19, 0x01, 0x16, 0x0f, 0x0e, 0x03, 0x00, 0x00, 0x05, 0x01,
+	0x18, 0x01, 0x05, 0x05, 0x05, 0x03, 0x00, 0x00, 0x05, 0x01, 0x14, 0x01,
+	0x05, 0x05, 0x05, 0x03, 0x02, 0x0f, 0x19, 0x0f, 0x34, 0x05, 0x09, 0x01,
+	0x1a, 0x01, 0x09, 0x08, 0x09, 0x03, 0x1a, 0x08, 0x0a, 0x1a, 0x05, 0x1a,
+	0x06, 0x13, 0x01, 0x0e, 0x01, 0x00, 0x0c, 0x12, 0x12, 0x13, 0x06, 0x00,
+	0x31, 0x00, 0xff, 0x01, 0x03, 0x00, 0x26, 0x06, 0x1e, 0x0d, 0x1b, 0x01,
+	0x19, 0x0d, 0x05, 0x11, 0x1a, 0x02, 0x05, 0x03, 0x10, 0x10, 0x06, 0x05,
+	0x13, 0x05, 0x03, 0x07, 0x04, 0x1d, 0x04, 0x04, 0x06, 0x04, 0x02, 0x02,
+	0x08, 0x03, 0x17, 0x02, 0x26, 0x0b, 0x27, 0x17, 0x08, 0x07, 0x0e, 0x05,
+	0x0f, 0x01, 0x23, 0x09, 0x06, 0x01, 0x04, 0x0e, 0x27, 0x08, 0x02, 0x25,
+	0x02, 0x05, 0x28, 0x01, 0x1b, 0x03, 0x0a, 0x01, 0x09, 0x12, 0x07, 0x03,
+	0x13, 0x28, 0x05, 0x08, 0x04, 0x0d, 0x08, 0x04, 0x22, 0x14, 0x18, 0x16,
+	0x0f, 0x08, 0x0d, 0x0d, 0x11, 0x09, 0x08, 0x05, 0x06, 0x0c, 0x0f, 0x16,
+	0x0a, 0x02, 0x17, 0x06, 0x0e, 0x07, 0x02, 0x0b, 0x05, 0x08, 0x19, 0x04,
+	0x33, 0x0b, 0x04, 0x03, 0x01, 0x05, 0x10, 0x07, 0x0c, 0x04, 0x0e, 0x06,
+	0x0e, 0x02, 0x0e, 0x04, 0x0c, 0x05, 0x05, 0x0a, 0x04, 0x03, 0xff, 0x06,
+	0x02, 0x16, 0x01, 0x0e, 0x06, 0x05, 0x09, 0x09, 0x09, 0x04, 0x05, 0x0c,
+	0x0c, 0x08, 0x05, 0x08, 0x19, 0x08, 0x0b, 0x04, 0x09, 0x05, 0x09, 0x09,
+	0x0a, 0x12, 0x0e, 0x03, 0x18, 0x15, 0x07, 0x09, 0x0d, 0x09, 0x0b, 0x0e,
+	0x10, 0x04, 0x05, 0x06, 0x0d, 0x04, 0x04, 0x03, 0x14, 0x03, 0x0c, 0x0b,
+	0x05, 0x05, 0x05, 0x0f, 0x0d, 0x0f, 0x07, 0x04, 0x05, 0x05, 0x10, 0x02,
+	0x06, 0x05, 0x01, 0x07, 0x03, 0x03, 0x04, 0x02, 0x0a, 0x0a, 0x05, 0x15,
+	0x04, 0x15, 0x09, 0x17, 0x05, 0x04, 0x11, 0x01, 0x06, 0x02, 0x20, 0x06,
+	0x03, 0x03, 0x0f, 0x05, 0x03, 0x03, 0x0a, 0x11, 0x0b, 0x19, 0x06, 0x10,
+	0x03, 0x09, 0x05, 0x02, 0x15, 0x09, 0x09, 0x29, 0x0d, 0x14, 0x0a, 0x02,
+	0x13, 0x09, 0x13, 0x14, 0x0c, 0x04, 0x13, 0x07, 0x10, 0x0e, 0x0c, 0x02,
+	0x03, 0x0c, 0x07, 0x07, 0x08, 0x04, 0xff, 0x09, 0x14, 0x02, 0x03, 0x08,
+	0x08, 0x01, 0x03, 0x04, 0x02, 0x0d, 0x04, 0x0d, 0x15, 0x06, 0x05, 0x05,
+	0x02, 0x11, 0x05, 0x13, 0x00, 0x19, 0x04, 0x19, 0x10, 0x05, 0x03, 0x0c,
+	0x0f, 0x09, 0x0c, 0x0b, 0x0f, 0x12, 0x08, 0x05, 0x08, 0x01, 0x06, 0x06,
+	0x0e, 0x02, 0x04, 0x10, 0x10, 0x00, 0x02, 0x05, 0x06, 0x14, 0x05, 0x0a,
+	0x09, 0x06, 0x08, 0x04, 0x02, 0x08, 0x02, 0x1b, 0x0a, 0x10, 0x09, 0x00,
+	0x35, 0x00, 0x07, 0x2a, 0x07, 0x0b, 0x16, 0x04, 0x28, 0x0f, 0x04, 0x04,
+	0x0e, 0x05, 0x3b, 0x05, 0x0f, 0x11, 0x14, 0x13, 0x09, 0x09, 0x0e, 0x00,
+	0x15, 0x05, 0x0b, 0x0b, 0x16, 0x0e, 0x08, 0x08, 0x04, 0x12, 0x0d, 0x04,
+	0x04, 0x07, 0x05, 0x19, 0x05, 0x0e, 0x0e, 0x0b, 0x06, 0x09, 0x07, 0x03,
+	0x06, 0x16, 0x02, 0x05, 0x02, 0x04, 0x07, 0x04, 0x04, 0x03, 0x0f, 0x0b,
+	0x1e, 0x16, 0xc8, 0x07, 0x05, 0x2d, 0x15, 0x34, 0x2c, 0x3c, 0x33, 0x33,
+	0x3a, 0x06, 0x06, 0x35, 0x53, 0x09, 0x0a, 0x38, 0x4b, 0x2f, 0x36, 0x04,
+	0x2c, 0x2c, 0x11, 0x16, 0x18, 0x05, 0x19, 0x04, 0x02, 0x02, 0x01, 0x02,
+	0x18, 0x1c, 0x06, 0x21, 0x28, 0x04, 0x05, 0x1c, 0x07, 0x08, 0x01, 0x1d,
+	0x20, 0x21, 0x00, 0x07, 0x1f, 0x21, 0x06, 0x08, 0x08, 0x0e, 0x02, 0x2a,
+	0x04, 0x04, 0x06, 0x29, 0x03, 0x0f, 0x2c, 0x01, 0x0d, 0x12, 0x04, 0x18,
+	0x1c, 0x1c, 0x21, 0x01, 0x21, 0xff, 0x37, 0x26, 0x28, 0x45, 0x37, 0x3a,
+	0x0c, 0x0d, 0x24, 0x4d, 0x36, 0x24, 0x04, 0x24, 0x13, 0x21, 0x16, 0x1d,
+	0x05, 0x2b, 0x2b, 0x05, 0x04, 0x04, 0x02, 0x1f, 0x06, 0x03, 0x08, 0x22,
+	0x23, 0x2c, 0x31, 0x05, 0x4e, 0x0b, 0x0b, 0x0b, 0x28, 0x20, 0x0c, 0x24,
+	0x23, 0x09, 0x27, 0x25, 0x02, 0x04, 0x02, 0x02, 0x03, 0x02, 0x04, 0x05,
+	0x33, 0x05, 0x0f, 0x33, 0x02, 0x3b, 0x39, 0x4f, 0x2f, 0x04, 0x08, 0x0a,
+	0x0f, 0x0e, 0x0d, 0x04, 0x10, 0x36, 0x07, 0x24, 0x19, 0x05, 0x03, 0x02,
+	0x12, 0x06, 0x02, 0x03, 0x07, 0x03, 0x02, 0x18, 0x11, 0x00, 0x17, 0x08,
+	0x14, 0x05, 0x16, 0x1a, 0x02, 0x0b, 0x0f, 0x02, 0x06, 0x2c, 0x01, 0x10,
+	0x1c, 0x04, 0x1c, 0x02, 0x06, 0x05, 0x2d, 0x05, 0x0f, 0x0e, 0x02, 0x0a,
+	0x1b, 0x0a, 0x07, 0x0c, 0x01, 0x04, 0x09, 0x06, 0x07, 0x1a, 0x02, 0x04,
+	0x04, 0xff, 0x02, 0x11, 0x06, 0x04, 0x0a, 0x05, 0x05, 0x18, 0x44, 0x02,
+	0x0f, 0x0f, 0x05, 0x08, 0x07, 0x05, 0x14, 0x02, 0x02, 0x0b, 0x0c, 0x12,
+	0x18, 0x14, 0x05, 0x16, 0x05, 0x30, 0x0a, 0x16, 0x01, 0x14, 0x06, 0x0a,
+	0x12, 0x03, 0x03, 0x10, 0x03, 0x1f, 0x18, 0x04, 0x10, 0x11, 0x02, 0x02,
+	0x11, 0x18, 0x03, 0x07, 0x03, 0x02, 0x16, 0x0f, 0x12, 0x30, 0x04, 0x06,
+	0x06, 0x02, 0x08, 0x09, 0x03, 0x19, 0x10, 0x08, 0x04, 0x0f, 0x16, 0x08,
+	0x14, 0x0a, 0x09, 0x03, 0x07, 0x0c, 0x08, 0x03, 0x11, 0x0a, 0x00, 0x05,
+	0x03, 0x0a, 0x03, 0x19, 0x0f, 0x0a, 0x12, 0x04, 0x16, 0x12, 0x08, 0x05,
+	0x14, 0x0c, 0x06, 0x0a, 0x05, 0x16, 0x10, 0x13, 0x0b, 0x02, 0x04, 0x07,
+	0x02, 0x07, 0x03, 0x31, 0x0a, 0x05, 0x06, 0x06, 0x05, 0x07, 0x12, 0x02,
+	0x04, 0x04, 0x08, 0x02, 0x16, 0x02, 0x0e, 0x05, 0x09, 0xff, 0x11, 0x03,
+	0x03, 0x04, 0x20, 0x0b, 0x02, 0x05, 0x05, 0x02, 0x01, 0x16, 0x14, 0x15,
+	0x06, 0x0c, 0x09, 0x10, 0x0b, 0x16, 0x0f, 0x04, 0x08, 0x03, 0x02, 0x12,
+	0x0c, 0x06, 0x0c, 0x11, 0x0e, 0x17, 0x07, 0x09, 0x06, 0x12, 0x12, 0x04,
+	0x0f, 0x0f, 0x0b, 0x03, 0x01, 0x06, 0x0c, 0x16, 0x0c, 0x04, 0x03, 0x05,
+	0x03, 0x0c, 0x17, 0x19, 0x0a, 0x1d, 0x06, 0x1d, 0x0c, 0x0a, 0x03, 0x09,
+	0x09, 0x11, 0x04, 0x17, 0x05, 0x05, 0x14, 0x02, 0x24, 0x24, 0x02, 0x33,
+	0x05, 0x35, 0x03, 0x13, 0x0b, 0x0b, 0x03, 0x05, 0x09, 0x02, 0x0f, 0x0d,
+	0x0d, 0x1b, 0x17, 0x12, 0x15, 0x16, 0x08, 0x1b, 0x1d, 0x02, 0x0a, 0x0a,
+	0x0a, 0x03, 0x1d, 0x02, 0x01, 0x06, 0x19, 0x1c, 0x05, 0x0b, 0x0e, 0x07,
+	0x10, 0x1e, 0x05, 0x1e, 0x12, 0x0d, 0x0d, 0x04, 0x02, 0x02, 0x07, 0x03,
+	0x07, 0x02, 0x0e, 0x14, 0x0b, 0xff, 0x11, 0x08, 0x07, 0x0c, 0x07, 0x03,
+	0x00, 0x0a, 0x14, 0x1e, 0x05, 0x06, 0x04, 0x05, 0x02, 0x1e, 0x12, 0x1f,
+	0x09, 0x13, 0x08, 0x06, 0x07, 0x10, 0x05, 0x03, 0x0c, 0x0e, 0x06, 0x06,
+	0x17, 0x07, 0x04, 0x05, 0x10, 0x07, 0x03, 0x01, 0x36, 0x0e, 0x19, 0x03,
+	0x0e, 0x0d, 0x02, 0x0c, 0x03, 0x02, 0x0f, 0x02, 0x17, 0x20, 0x0c, 0x10,
+	0x10, 0x01, 0x02, 0x18, 0x08, 0x0e, 0x14, 0x16, 0x03, 0x0a, 0x06, 0x03,
+	0x07, 0x0d, 0x05, 0x03, 0x07, 0x09, 0x01, 0x03, 0x0b, 0x08, 0x06, 0x07,
+	0x04, 0x0d, 0x0c, 0x07, 0x05, 0x03, 0x05, 0x0a, 0x0c, 0x20, 0x14, 0x00,
+	0x20, 0x15, 0x06, 0x0b, 0x0c, 0x18, 0x0f, 0x0e, 0x02, 0x02, 0x04, 0x14,
+	0x0d, 0x02, 0x1c, 0x0d, 0x05, 0x09, 0x04, 0x10, 0x0f, 0x08, 0x19, 0x14,
+	0x06, 0x14, 0x07, 0x0b, 0x0e, 0x02, 0x0a, 0x0f, 0x06, 0x03, 0x0a, 0x0a,
+	0x05, 0xcb, 0x04, 0x13, 0x0c, 0x05, 0x09, 0x07, 0x15, 0x04, 0x0c, 0x03,
+	0x04, 0x08, 0x09, 0x07, 0x00, 0x04, 0x0f, 0x0a, 0x02, 0x09, 0x0c, 0x15,
+	0x12, 0x0d, 0x06, 0x0b, 0x00, 0x01, 0x0f, 0x08, 0x09, 0x11, 0x02, 0x0d,
+	0x10, 0x06, 0x14, 0x36, 0x34, 0x2d, 0x2d, 0x03, 0x08, 0x15, 0x1c, 0x0a,
+	0x09, 0x0f, 0x05, 0x15, 0x04, 0x1f, 0x03, 0x03, 0x03, 0x02, 0x02, 0x11,
+	0x02, 0x08, 0x01, 0x16, 0x04, 0x04, 0x05, 0x04, 0x15, 0x0a, 0x3d, 0x10,
+	0x00, 0x3b, 0x1d, 0x3b, 0x00, 0x3c, 0x00, 0xca, 0x01, 0x03, 0x03, 0x3c,
+	0x08, 0x0c, 0x0c, 0x0b, 0x10, 0x10, 0x0f, 0x05, 0x06, 0x1b, 0x0f, 0x1e,
+	0x1d, 0x09, 0x05, 0x0b, 0x01, 0x07, 0x0b, 0x04, 0x0b, 0x0b, 0x0b, 0x05,
+	0x12, 0x07, 0x08, 0x01, 0x1d, 0x05, 0x08, 0x0d, 0x19, 0x05, 0x08, 0x0a,
+	0x0c, 0x1e, 0x07, 0x06, 0x06, 0x0a, 0x01, 0x1d, 0x0e, 0x0d, 0x06, 0x0c,
+	0x09, 0x0c, 0x0b, 0x08, 0x30, 0x08, 0x17, 0x03, 0x0e, 0x05, 0x07, 0x0e,
+	0x0a, 0x0e, 0x30, 0x07, 0x0f, 0x15, 0x15, 0x16, 0x17, 0x00, 0x3c, 0x00,
+	0xff, 0x01, 0x03, 0x00, 0x1b, 0x12, 0x12, 0x0a, 0x09, 0x0d, 0x17, 0x16,
+	0x1f, 0x11, 0x18, 0x06, 0x15, 0x17, 0x02, 0x01, 0x13, 0x19, 0x05, 0x06,
+	0x19, 0x06, 0x06, 0x03, 0x24, 0x01, 0x0c, 0x04, 0x0a, 0x0a, 0x0a, 0x07,
+	0x04, 0x02, 0x0a, 0x02, 0x0f, 0x01, 0x06, 0x20, 0x05, 0x09, 0x1d, 0x05,
+	0x1a, 0x03, 0x07, 0x09, 0x06, 0x05, 0x02, 0x0a, 0x1a, 0x0c, 0x02, 0x1b,
+	0x01, 0x14, 0x08, 0x04, 0x08, 0x08, 0x06, 0x06, 0x11, 0x09, 0x05, 0x0c,
+	0x06, 0x25, 0x06, 0x04, 0x15, 0x17, 0x02, 0x02, 0x0e, 0x06, 0x03, 0x12,
+	0x22, 0x03, 0x13, 0x08, 0x05, 0x03, 0x0b, 0x07, 0x03, 0x03, 0x04, 0x0d,
+	0x02, 0x03, 0x09, 0x05, 0x0d, 0x01, 0x04, 0x06, 0x07, 0x02, 0x16, 0x0b,
+	0x06, 0x06, 0x04, 0x08, 0x04, 0x02, 0x11, 0x02, 0x06, 0x05, 0x19, 0x05,
+	0x3c, 0x01, 0x04, 0x13, 0x08, 0x08, 0x0c, 0x05, 0xff, 0x15, 0x09, 0x14,
+	0x15, 0x07, 0x06, 0x06, 0x0c, 0x10, 0x02, 0x3f, 0x08, 0x0f, 0x05, 0x04,
+	0x06, 0x0c, 0x10, 0x03, 0x0b, 0x05, 0x14, 0x19, 0x13, 0x06, 0x0d, 0x08,
+	0x07, 0x10, 0x0c, 0x17, 0x0b, 0x08, 0x07, 0x02, 0x02, 0x08, 0x02, 0x1a,
+	0x02, 0x06, 0x0a, 0x04, 0x06, 0x0c, 0x02, 0x10, 0x12, 0x08, 0x08, 0x0f,
+	0x05, 0x04, 0x0a, 0x08, 0x0a, 0x10, 0x0f, 0x05, 0x08, 0x07, 0x07, 0x0a,
+	0x02, 0x08, 0x0b, 0x00, 0x02, 0x13, 0x08, 0x10, 0x19, 0x04, 0x03, 0x0b,
+	0x0c, 0x03, 0x0d, 0x02, 0x0d, 0x0f, 0x04, 0x17, 0x07, 0x12, 0x28, 0x13,
+	0x05, 0x04, 0x0c, 0x07, 0x03, 0x0f, 0x0b, 0x0b, 0x14, 0x13, 0x04, 0x0e,
+	0x04, 0x09, 0x10, 0x08, 0x0d, 0x03, 0x0b, 0x03, 0x05, 0x02, 0x0b, 0x03,
+	0x04, 0x12, 0x09, 0x06, 0x09, 0x05, 0x05, 0x07, 0x11, 0x03, 0x0b, 0x06,
+	0x07, 0x03, 0x12, 0x09, 0xff, 0x02, 0x12, 0x13, 0x05, 0x06, 0x0b, 0x0b,
+	0x05, 0x09, 0x18, 0x08, 0x25, 0x0d, 0x02, 0x06, 0x01, 0x2f, 0x05, 0x01,
+	0x02, 0x29, 0x0c, 0x29, 0x03, 0x0d, 0x0d, 0x0b, 0x02, 0x03, 0x0e, 0x06,
+	0x0d, 0x06, 0x04, 0x13, 0x0c, 0x12, 0x04, 0x04, 0x11, 0x08, 0x14, 0x2b,
+	0x04, 0x2b, 0x0b, 0x0e, 0x03, 0x14, 0x08, 0x20, 0x10, 0x04, 0x10, 0x18,
+	0x0f, 0x02, 0x03, 0x07, 0x0e, 0x20, 0x01, 0x05, 0x05, 0x05, 0x11, 0x04,
+	0x1f, 0x05, 0x1d, 0x1a, 0x07, 0x05, 0x0b, 0x08, 0x06, 0x09, 0x01, 0x0a,
+	0x06, 0x04, 0x01, 0x0b, 0x07, 0x03, 0x0d, 0x1e, 0x05, 0x08, 0x02, 0x02,
+	0x04, 0x04, 0x14, 0x02, 0x33, 0x24, 0x0f, 0x02, 0x03, 0x13, 0x0e, 0x02,
+	0x0e, 0x01, 0x02, 0x03, 0x2e, 0x0a, 0x0e, 0x05, 0x0b, 0x0b, 0x02, 0x04,
+	0x04, 0x0e, 0x17, 0x09, 0x09, 0x22, 0x04, 0x07, 0x09, 0x09, 0x02, 0x10,
+	0xff, 0x1a, 0x0d, 0x08, 0x1e, 0x05, 0x43, 0x3c, 0x40, 0x39, 0x00, 0x43,
+	0x04, 0x01, 0x26, 0x06, 0x09, 0x08, 0x21, 0x03, 0x14, 0x04, 0x27, 0x11,
+	0x13, 0x05, 0x04, 0x01, 0x02, 0x0e, 0x16, 0x07, 0x16, 0x05, 0x14, 0x14,
+	0x02, 0x04, 0x04, 0x09, 0x03, 0x03, 0x07, 0x1e, 0x04, 0x04, 0x04, 0x07,
+	0x02, 0x04, 0x0a, 0x0b, 0x06, 0x04, 0x03, 0x0b, 0x02, 0x05, 0x06, 0x03,
+	0x07, 0x04, 0x03, 0x0a, 0x17, 0x04, 0x0b, 0x09, 0x06, 0x0b, 0x0e, 0x16,
+	0x1b, 0x07, 0x05, 0x04, 0x06, 0x29, 0x01, 0x1d, 0x04, 0x01, 0x02, 0x0f,
+	0x28, 0x0b, 0x03, 0x0f, 0x06, 0x09, 0x04, 0x04, 0x03, 0x10, 0x0b, 0x07,
+	0x05, 0x04, 0x07, 0x1a, 0x11, 0x21, 0x09, 0x0c, 0x06, 0x18, 0x1b, 0x1b,
+	0x1b, 0x00, 0x1b, 0x04, 0x01, 0x05, 0x07, 0x13, 0x0e, 0x0b, 0x1a, 0x04,
+	0x0b, 0x27, 0x18, 0x00, 0x40, 0x00, 0x09, 0x0e, 0xff, 0x0e, 0x50, 0x05,
+	0x00, 0x0e, 0x04, 0x04, 0x04, 0x0e, 0x04, 0x01, 0x06, 0x1a, 0x13, 0x02,
+	0x17, 0x15, 0x0e, 0x03, 0x10, 0x12, 0x15, 0x23, 0x04, 0x32, 0x2b, 0x33,
+	0x2e, 0x03, 0x04, 0x0a, 0x0a, 0x16, 0x01, 0x03, 0x20, 0x03, 0x0c, 0x1d,
+	0x04, 0x0e, 0x07, 0x07, 0x03, 0x15, 0x15, 0x45, 0x3a, 0x04, 0x0b, 0x20,
+	0x0a, 0x15, 0x13, 0x13, 0x25, 0x07, 0x04, 0x15, 0x16, 0x10, 0x0f, 0x0a,
+	0x1d, 0x07, 0x12, 0x0d, 0x02, 0x04, 0x01, 0x20, 0x0a, 0x0a, 0x07, 0x07,
+	0x04, 0x05, 0x05, 0x09, 0x1c, 0x2a, 0x22, 0x04, 0x10, 0x09, 0x0e, 0x08,
+	0x05, 0x24, 0x02, 0x0d, 0x01, 0x05, 0x07, 0x22, 0x0b, 0x02, 0x0d, 0x0e,
+	0x07, 0x19, 0x13, 0x09, 0x05, 0x11, 0x02, 0x0d, 0x09, 0x06, 0x09, 0x09,
+	0x29, 0x05, 0x06, 0x01, 0x13, 0x00, 0x04, 0x03, 0x03, 0x09, 0x02, 0x09,
+	0x0b, 0x09, 0x14, 0x04, 0x9d, 0x08, 0x04, 0x0d, 0x1a, 0x04, 0x02, 0x08,
+	0x0f, 0x06, 0x04, 0x03, 0x11, 0x0f, 0x11, 0x02, 0x02, 0x04, 0x13, 0x06,
+	0x11, 0x10, 0x11, 0x05, 0x0d, 0x14, 0x12, 0x09, 0x11, 0x08, 0x01, 0x08,
+	0xff, 0x03, 0x03, 0x02, 0x05, 0x10, 0x0a, 0x03, 0x0f, 0x06, 0x10, 0x06,
+	0x02, 0x10, 0x08, 0x0d, 0x0b, 0x13, 0x09, 0x07, 0x0b, 0x05, 0x02, 0x03,
+	0x08, 0x0d, 0x02, 0x04, 0x0b, 0x00, 0x0c, 0x01, 0x03, 0x06, 0x0b, 0x02,
+	0x15, 0x08, 0x04, 0x09, 0x04, 0x02, 0x02, 0x07, 0x03, 0x10, 0x0b, 0x05,
+	0x04, 0x04, 0x02, 0x05, 0x0a, 0x02, 0x03, 0x14, 0x0a, 0x15, 0x00, 0x01,
+	0x0b, 0x0d, 0x05, 0x0c, 0x07, 0x23, 0x13, 0x1c, 0x08, 0x10, 0x0e, 0x09,
+	0x09, 0x01, 0x08, 0x0d, 0x11, 0x02, 0x04, 0x03, 0x02, 0x02, 0x39, 0x01,
+	0x12, 0x0d, 0x04, 0x07, 0x04, 0x06, 0x13, 0x0a, 0x03, 0x15, 0x0a, 0x0c,
+	0x10, 0x04, 0x16, 0x17, 0x02, 0x0b, 0x05, 0x02, 0x2a, 0x1e, 0x1e, 0x24,
+	0x3f, 0x3f, 0x2e, 0x3e, 0x3a, 0x2b, 0x09, 0x0a, 0x39, 0x3d, 0x36, 0x3a,
+	0x04, 0x1b, 0x1b, 0x12, 0x1b, 0x04, 0x1b, 0x02, 0xd9, 0x02, 0x03, 0x23,
+	0x1e, 0x03, 0x1c, 0x07, 0x25, 0x06, 0x02, 0x18, 0x1e, 0x0a, 0x1d, 0x25,
+	0x22, 0x09, 0x06, 0x0b, 0x0d, 0x26, 0x0d, 0x09, 0x01, 0x0f, 0x09, 0x0d,
+	0x07, 0x04, 0x05, 0x03, 0x02, 0x01, 0x0f, 0x04, 0x03, 0x08, 0x04, 0x05,
+	0x0c, 0x02, 0x04, 0x0a, 0x26, 0x02, 0x03, 0x08, 0x08, 0x03, 0x05, 0x20,
+	0x05, 0x20, 0x02, 0x02, 0x04, 0x0a, 0x0a, 0x0b, 0x02, 0x03, 0x09, 0x08,
+	0x21, 0x03, 0x01, 0x12, 0x10, 0x0c, 0x04, 0x0a, 0x07, 0x03, 0x09, 0x04,
+	0x13, 0x0b, 0x13, 0x03, 0x22, 0x06, 0x08, 0x3b, 0x15, 0x00, 0x3a, 0x27,
+	0x36, 0x00, 0x2f, 0x00, 0x91, 0x01, 0x03, 0x03, 0x3b, 0x09, 0x1c, 0x01,
+	0x19, 0x0f, 0x0a, 0x0b, 0x1a, 0x05, 0x27, 0x27, 0x27, 0x26, 0x02, 0x26,
+	0x89, 0x08, 0x0f, 0x01, 0x28, 0x01, 0x0d, 0x1e, 0x02, 0x0c, 0x05, 0x0c,
+	0x98, 0x08, 0x10, 0x1d, 0x0c, 0x03, 0x1b, 0x0d, 0x1d, 0x12, 0x1f, 0x05,
+	0x18, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x13, 0x18, 0x18, 0x04, 0x19,
+	0x00, 0x2f, 0x00, 0x85, 0x01, 0x03, 0x00, 0x29, 0x0a, 0x02, 0x0a, 0xff,
+	0x43, 0x01, 0x0d, 0x06, 0x02, 0x27, 0x3e, 0x00, 0x02, 0x21, 0x27, 0x09,
+	0x03, 0x07, 0x23, 0x03, 0x03, 0x14, 0x1f, 0x05, 0x04, 0x0c, 0x1f, 0x06,
+	0x0b, 0x0b, 0x3e, 0x03, 0x06, 0x2e, 0x28, 0x09, 0x19, 0x04, 0x0a, 0x06,
+	0x04, 0x0d, 0x04, 0x03, 0x12, 0x06, 0x19, 0x06, 0x02, 0x12, 0x26, 0x13,
+	0x13, 0x12, 0x09, 0x03, 0x04, 0x09, 0x03, 0x08, 0x0b, 0x0b, 0x03, 0x0b,
+	0x0a, 0x06, 0x04, 0x0c, 0x05, 0x29, 0x05, 0x0c, 0x17, 0x05, 0x0a, 0x03,
+	0x0e, 0x0c, 0x27, 0x05, 0x09, 0x01, 0x06, 0x0e, 0x07, 0x02, 0x04, 0x03,
+	0x02, 0x02, 0x14, 0x14, 0x30, 0x1a, 0x04, 0x23, 0x13, 0x11, 0x0d, 0x04,
+	0x09, 0x04, 0x04, 0x03, 0x12, 0x0f, 0x13, 0x06, 0x02, 0x12, 0x08, 0x0e,
+	0x0f, 0x14, 0x09, 0x06, 0x11, 0x02, 0x14, 0x2a, 0x2f, 0x00, 0x03, 0x0b,
+	0x0f, 0x0f, 0x03, 0x01, 0x0c, 0x0e, 0x0e, 0xff, 0x0f, 0x04, 0x0e, 0x06,
+	0x0c, 0x09, 0x0f, 0x04, 0x02, 0x03, 0x04, 0x04, 0x15, 0x01, 0x0f, 0x0b,
+	0x16, 0x2b, 0x03, 0x08, 0x0e, 0x08, 0x07, 0x07, 0x02, 0x0b, 0x19, 0x19,
+	0x07, 0x14, 0x05, 0x10, 0x07, 0x07, 0x1b, 0x04, 0x04, 0x10, 0x02, 0x0d,
+	0x0d, 0x09, 0x0d, 0x04, 0x02, 0x02, 0x08, 0x03, 0x2e, 0x20, 0x4d, 0x02,
+	0x03, 0x0a, 0x0e, 0x08, 0x09, 0x03, 0x0d, 0x05, 0x2f, 0x07, 0x25, 0x4a,
+	0x42, 0x29, 0x44, 0x3f, 0x34, 0x2e, 0x38, 0x50, 0x2f, 0x04, 0x04, 0x32,
+	0x32, 0x27, 0x04, 0x04, 0x16, 0x0c, 0x38, 0x00, 0x06, 0x01, 0x10, 0x37,
+	0x13, 0x3e, 0x1b, 0x00, 0x1a, 0x25, 0x24, 0x29, 0x02, 0x1c, 0x1b, 0x26,
+	0x09, 0x03, 0x1e, 0x02, 0x26, 0x06, 0x02, 0x04, 0x04, 0x02, 0x02, 0x03,
+	0x24, 0x03, 0x23, 0x23, 0x05, 0x28, 0x02, 0x04, 0x03, 0x06, 0x02, 0x30,
+	0x0f, 0x09, 0x00, 0xff, 0x01, 0x26, 0x04, 0x06, 0x2b, 0x02, 0x05, 0x08,
+	0x06, 0x03, 0x2a, 0x0d, 0x05, 0x01, 0x03, 0x03, 0x27, 0x05, 0x0b, 0x04,
+	0x10, 0x04, 0x07, 0x03, 0x0d, 0x09, 0x09, 0x06, 0x10, 0x09, 0x06, 0x2a,
+	0x12, 0x08, 0x08, 0x2c, 0x05, 0x21, 0x03, 0x07, 0x15, 0x0f, 0x02, 0x07,
+	0x0e, 0x03, 0x03, 0x12, 0x08, 0x07, 0x0e, 0x0e, 0x06, 0x2c, 0x07, 0x11,
+	0x07, 0x14, 0x0a, 0x12, 0x0a, 0x0f, 0x0e, 0x00, 0x0f, 0x03, 0x09, 0x08,
+	0x01, 0x0c, 0x0f, 0x09, 0x0d, 0x04, 0x0f, 0x06, 0x0e, 0x05, 0x00, 0x18,
+	0x0f, 0x04, 0x11, 0x18, 0x02, 0x2a, 0x0b, 0x07, 0x0b, 0x0b, 0x19, 0x06,
+	0x13, 0x2c, 0x14, 0x05, 0x1b, 0x05, 0x0b, 0x16, 0x1a, 0x12, 0x10, 0x05,
+	0x03, 0x13, 0x02, 0x05, 0x02, 0x02, 0x0e, 0x07, 0x09, 0x04, 0x04, 0x05,
+	0x0e, 0x00, 0x09, 0x05, 0x09, 0x00, 0x01, 0x03, 0x05, 0x14, 0x06, 0xff,
+	0x05, 0x02, 0x03, 0x0c, 0x04, 0x0e, 0x14, 0x08, 0x16, 0x05, 0x1b, 0x0f,
+	0x13, 0x05, 0x09, 0x05, 0x0a, 0x03, 0x03, 0x0b, 0x06, 0x40, 0x04, 0x04,
+	0x11, 0x1c, 0x02, 0x08, 0x08, 0x05, 0x03, 0x0f, 0x08, 0x0a, 0x06, 0x02,
+	0x08, 0x11, 0x10, 0x11, 0x14, 0x09, 0x16, 0x41, 0x3b, 0x03, 0x2a, 0x0a,
+	0x38, 0x19, 0x1a, 0x05, 0x0e, 0x12, 0x12, 0x03, 0x12, 0x02, 0x12, 0x12,
+	0x03, 0x03, 0x10, 0x05, 0x1c, 0x03, 0x00, 0x1b, 0x17, 0x04, 0x0a, 0x0a,
+	0x05, 0x03, 0x04, 0x04, 0x07, 0x0e, 0x15, 0x20, 0x05, 0x1a, 0x17, 0x02,
+	0x08, 0x18, 0x1b, 0x04, 0x0a, 0x04, 0x02, 0x0a, 0x00, 0x01, 0x19, 0x07,
+	0x04, 0x11, 0x08, 0x02, 0x0f, 0x07, 0x0e, 0x04, 0x0e, 0x41, 0x03, 0x08,
+	0x14, 0x08, 0x1d, 0x0b, 0x0d, 0x06, 0x06, 0x05, 0x0d, 0x11, 0x14, 0x03,
+	0x10, 0x06, 0x04, 0x12, 0x08, 0x13, 0x09, 0xf3, 0x07, 0x1b, 0x34, 0x1b,
+	0x03, 0x1b, 0x12, 0x1b, 0x1b, 0x04, 0x10, 0x0d, 0x10, 0x03, 0x1e, 0x17,
+	0x08, 0x0f, 0x11, 0x0f, 0x06, 0x02, 0x09, 0x1c, 0x11, 0x04, 0x1a, 0x0c,
+	0x06, 0x1b, 0x03, 0x1f, 0x0a, 0x06, 0x18, 0x0a, 0x0a, 0x1d, 0x04, 0x05,
+	0x07, 0x02, 0x1c, 0x0f, 0x03, 0x0c, 0x05, 0x21, 0x06, 0x21, 0x0f, 0x0f,
+	0x03, 0x22, 0x02, 0x01, 0x08, 0x09, 0x1d, 0x05, 0x10, 0x12, 0x07, 0x15,
+	0x04, 0x14, 0x04, 0x02, 0x0f, 0x03, 0x1f, 0x06, 0x06, 0x05, 0x13, 0x10,
+	0x02, 0x13, 0x0d, 0x0e, 0x20, 0x0a, 0x1f, 0x0a, 0x07, 0x08, 0x04, 0x06,
+	0x04, 0x04, 0x16, 0x10, 0x02, 0x23, 0x2b, 0x26, 0x2b, 0x2b, 0x2b, 0x20,
+	0x2f, 0x1b, 0x31, 0x09, 0x28, 0x21, 0x22, 0x12, 0x13, 0x1f, 0x10, 0x07,
+	0x32, 0x3d, 0x12, 0x06, 0x12, 0xff, 0x56, 0x3c, 0x0d, 0x0e, 0x20, 0x1c,
+	0x23, 0x03, 0x22, 0x1c, 0x20, 0x1e, 0x00, 0x04, 0x40, 0x1f, 0x05, 0x1f,
+	0x02, 0x22, 0x00, 0x01, 0x01, 0x40, 0x05, 0x01, 0x06, 0x09, 0x21, 0x01,
+	0x1d, 0x07, 0x09, 0x03, 0x05, 0x04, 0x1d, 0x0c, 0x02, 0x03, 0x1e, 0x05,
+	0x02, 0x3a, 0x01, 0x2b, 0x04, 0x19, 0x03, 0x07, 0x29, 0x0f, 0x03, 0x47,
+	0x2a, 0x3b, 0x03, 0x09, 0x09, 0x09, 0x05, 0x26, 0x38, 0x0a, 0x07, 0x0e,
+	0x11, 0x2b, 0x02, 0x03, 0x25, 0x25, 0x25, 0x03, 0x0c, 0x13, 0x02, 0x12,
+	0x01, 0x1d, 0x0a, 0x28, 0x03, 0x2a, 0x03, 0x1e, 0x2b, 0x02, 0x0f, 0x0e,
+	0x06, 0x1f, 0x0a, 0x07, 0x32, 0x07, 0x02, 0x05, 0x06, 0x1b, 0x06, 0x08,
+	0x04, 0x1f, 0x12, 0x12, 0x25, 0x00, 0x20, 0x04, 0x01, 0x2c, 0x06, 0x22,
+	0x2d, 0x0c, 0x03, 0x0b, 0x04, 0x24, 0x05, 0x05, 0x05, 0x15, 0x04, 0x04,
+	0x0f, 0xff, 0x04, 0x05, 0x17, 0x23, 0x12, 0x18, 0x05, 0x0b, 0x02, 0x1c,
+	0x0b, 0x03, 0x03, 0x08, 0x05, 0x01, 0x0b, 0x02, 0x07, 0x13, 0x17, 0x04,
+	0x22, 0x04, 0x05, 0x08, 0x06, 0x04, 0x03, 0x09, 0x04, 0x09, 0x09, 0x04,
+	0x01, 0x08, 0x02, 0x06, 0x08, 0x09, 0x04, 0x03, 0x03, 0x1e, 0x0b, 0x00,
+	0x42, 0x00, 0x07, 0x29, 0x0f, 0x0f, 0x07, 0x04, 0x16, 0x02, 0x11, 0x05,
+	0x02, 0x0e, 0x09, 0x00, 0x08, 0x19, 0x04, 0x08, 0x0f, 0x07, 0x0a, 0x04,
+	0x04, 0x08, 0x02, 0x09, 0x05, 0x02, 0x03, 0x04, 0x3e, 0x21, 0x2e, 0x37,
+	0x03, 0x04, 0x35, 0x2b, 0x03, 0x06, 0x06, 0x06, 0x03, 0x30, 0x30, 0x12,
+	0x04, 0x38, 0x31, 0x02, 0x03, 0x09, 0x34, 0x0c, 0x0f, 0x0e, 0x02, 0x1c,
+	0x1a, 0x12, 0x03, 0x13, 0x13, 0x14, 0x04, 0x08, 0x1b, 0x09, 0x20, 0x08,
+	0x04, 0x06, 0x04, 0x03, 0x03, 0x1e, 0x27, 0x20, 0x06, 0xff, 0x05, 0x05,
+	0x06, 0x02, 0x0b, 0x20, 0x20, 0x0d, 0x1e, 0x0f, 0x10, 0x07, 0x41, 0x30,
+	0x02, 0x23, 0x31, 0x0e, 0x09, 0x04, 0x0d, 0x0c, 0x0d, 0x10, 0x2a, 0x06,
+	0x05, 0x13, 0x07, 0x07, 0x01, 0x0b, 0x38, 0x35, 0x0d, 0x13, 0x0d, 0x06,
+	0x01, 0x02, 0x0d, 0x0b, 0x0b, 0x04, 0x0a, 0x04, 0x0d, 0x07, 0x10, 0x11,
+	0x0f, 0x00, 0x01, 0x2d, 0x0a, 0x14, 0x06, 0x0d, 0x12, 0x02, 0x0b, 0x01,
+	0x11, 0x11, 0x11, 0x06, 0x11, 0x10, 0x06, 0x43, 0x08, 0x0e, 0x16, 0x0d,
+	0x14, 0x06, 0x09, 0x10, 0x09, 0x26, 0x17, 0x09, 0x0c, 0x04, 0x00, 0x02,
+	0x09, 0x08, 0x01, 0x18, 0x12, 0x06, 0x0d, 0x03, 0x29, 0x06, 0x28, 0x0b,
+	0x08, 0x03, 0x10, 0x07, 0x0a, 0x10, 0x05, 0x19, 0x06, 0x05, 0x1c, 0x04,
+	0x03, 0x0d, 0x10, 0x07, 0x11, 0x09, 0x06, 0x09, 0x12, 0x08, 0x07, 0x09,
+	0x02, 0x17, 0x11, 0x12, 0x0f, 0xff, 0x04, 0x1e, 0x15, 0x21, 0x02, 0x16,
+	0x28, 0x02, 0x21, 0x3e, 0x24, 0x06, 0x3e, 0x34, 0x28, 0x28, 0x2b, 0x3e,
+	0x1e, 0x04, 0x04, 0x0a, 0x2a, 0x0a, 0x0a, 0x02, 0x03, 0x05, 0x05, 0x04,
+	0x0a, 0x07, 0x0c, 0x2a, 0x11, 0x14, 0x22, 0x15, 0x1b, 0x32, 0x01, 0x19,
+	0x1c, 0x23, 0x08, 0x35, 0x27, 0x08, 0x07, 0x04, 0x1e, 0x08, 0x0b, 0x04,
+	0x0b, 0x06, 0x02, 0x23, 0x07, 0x2d, 0x19, 0x2e, 0x18, 0x03, 0x0f, 0x05,
+	0x01, 0x07, 0x00, 0x02, 0x23, 0x0b, 0x0a, 0x00, 0x02, 0x04, 0x1f, 0x03,
+	0x21, 0x26, 0x02, 0x07, 0x0f, 0x06, 0x2b, 0x01, 0x05, 0x05, 0x0a, 0x06,
+	0x0a, 0x10, 0x02, 0x04, 0x09, 0x06, 0x02, 0x25, 0x04, 0x26, 0x27, 0x04,
+	0x03, 0x01, 0x06, 0x0a, 0x03, 0x0a, 0x08, 0x2c, 0x0c, 0x0f, 0x06, 0x05,
+	0x06, 0x2e, 0x08, 0x08, 0x0d, 0x1a, 0x07, 0x06, 0x07, 0x08, 0x17, 0x29,
+	0x02, 0xff, 0x19, 0x11, 0x06, 0x04, 0x0b, 0x12, 0x0d, 0x02, 0x04, 0x03,
+	0x09, 0x02, 0x05, 0x04, 0x0d, 0x10, 0x04, 0x01, 0x03, 0x0c, 0x14, 0x09,
+	0x0d, 0x11, 0x11, 0x14, 0x06, 0x0c, 0x00, 0x0d, 0x06, 0x12, 0x0c, 0x13,
+	0x05, 0x06, 0x19, 0x04, 0x15, 0x13, 0x02, 0x3e, 0x12, 0x0f, 0x07, 0x06,
+	0x0b, 0x00, 0x3b, 0x50, 0x0b, 0x09, 0x48, 0x05, 0x10, 0x10, 0x18, 0x00,
+	0x0c, 0x06, 0x0f, 0x02, 0x16, 0x01, 0x0c, 0x01, 0x0a, 0x0d, 0x06, 0x05,
+	0x04, 0x0d, 0x04, 0x05, 0x05, 0x04, 0x07, 0x2e, 0x02, 0x13, 0x08, 0x02,
+	0x1a, 0x08, 0x07, 0x0e, 0x31, 0x45, 0x19, 0x00, 0x24, 0x05, 0x25, 0x12,
+	0x1b, 0x09, 0x10, 0x0d, 0x0d, 0x04, 0x1b, 0x04, 0x08, 0x04, 0x15, 0x07,
+	0x03, 0x04, 0x07, 0x0e, 0x05, 0x05, 0x12, 0x06, 0x07, 0x07, 0x02, 0x07,
+	0x1c, 0x06, 0x03, 0x06, 0x0b, 0x10, 0x00, 0x04, 0x09, 0xff, 0x01, 0x12,
+	0x19, 0x02, 0x07, 0x16, 0x02, 0x0a, 0x1d, 0x02, 0x00, 0x06, 0x05, 0x04,
+	0x0b, 0x04, 0x03, 0x18, 0x0e, 0x0e, 0x06, 0x04, 0x01, 0x08, 0x0f, 0x14,
+	0x10, 0x10, 0x10, 0x00, 0x0b, 0x10, 0x01, 0x0e, 0x10, 0x02, 0x0c, 0x1e,
+	0x0d, 0x07, 0x0b, 0x08, 0x03, 0x05, 0x0e, 0x13, 0x13, 0x11, 0x0a, 0x05,
+	0x06, 0x06, 0x11, 0x02, 0x02, 0x01, 0x08, 0x05, 0x17, 0x1e, 0x08, 0x06,
+	0x05, 0x06, 0x10, 0x10, 0x09, 0x09, 0x05, 0x19, 0x07, 0x08, 0x08, 0x06,
+	0x15, 0x04, 0x02, 0x03, 0x09, 0x0c, 0x02, 0x41, 0x0a, 0x0a, 0x10, 0x04,
+	0x08, 0x0c, 0x14, 0x03, 0x0a, 0x04, 0x1b, 0x08, 0x0a, 0x05, 0x08, 0x08,
+	0x04, 0x16, 0x18, 0x0d, 0x0a, 0x16, 0x08, 0x08, 0x03, 0x0f, 0x08, 0x0e,
+	0x18, 0x08, 0x0c, 0x04, 0x08, 0x03, 0x07, 0x02, 0x01, 0x0e, 0x0e, 0x05,
+	0x06, 0x05, 0x3e, 0x0c, 0x02, 0xff, 0x35, 0x41, 0x03, 0x03, 0x03, 0x36,
+	0x02, 0x0f, 0x0e, 0x02, 0x03, 0x41, 0x02, 0x11, 0x0f, 0x0f, 0x0c, 0x04,
+	0x14, 0x0e, 0x1a, 0x01, 0x15, 0x03, 0x07, 0x02, 0x1a, 0x06, 0x0d, 0x03,
+	0x02, 0x04, 0x09, 0x09, 0x03, 0x01, 0x03, 0x17, 0x09, 0x2a, 0x18, 0x20,
+	0x07, 0x28, 0x0b, 0x1d, 0x10, 0x1c, 0x09, 0x0c, 0x07, 0x1a, 0x15, 0x04,
+	0x03, 0x04, 0x0f, 0x09, 0x05, 0x05, 0x12, 0x06, 0x07, 0x07, 0x02, 0x07,
+	0x1c, 0x06, 0x03, 0x4a, 0x2a, 0x32, 0x03, 0x1f, 0x15, 0x08, 0x08, 0x04,
+	0x02, 0x02, 0x08, 0x03, 0x18, 0x0d, 0x03, 0x20, 0x07, 0x0f, 0x12, 0x0e,
+	0x08, 0x05, 0x0f, 0x11, 0x05, 0x08, 0x1d, 0x06, 0x08, 0x19, 0x04, 0x03,
+	0x14, 0x0b, 0x0f, 0x03, 0x02, 0x22, 0x02, 0x03, 0x10, 0x06, 0x29, 0x04,
+	0x0d, 0x10, 0x04, 0x19, 0x07, 0x07, 0x03, 0x06, 0x11, 0x07, 0x23, 0x04,
+	0x1b, 0xff, 0x05, 0x17, 0x08, 0x08, 0x05, 0x0a, 0x16, 0x0e, 0x0b, 0x04,
+	0x08, 0x11, 0x11, 0x14, 0x10, 0x04, 0x0b, 0x0b, 0x07, 0x03, 0x12, 0x0a,
+	0x05, 0x0a, 0x04, 0x04, 0x05, 0x04, 0x0b, 0x02, 0x00, 0x0a, 0x05, 0x04,
+	0x08, 0x04, 0x03, 0x0a, 0x02, 0x10, 0x19, 0x0b, 0x08, 0x1d, 0x07, 0x05,
+	0x03, 0x05, 0x03, 0x09, 0x0f, 0x05, 0x07, 0x09, 0x01, 0x07, 0x08, 0x07,
+	0x1d, 0x0a, 0x08, 0x10, 0x0f, 0x05, 0x02, 0x15, 0x15, 0x0d, 0x0f, 0x08,
+	0x06, 0x1b, 0x14, 0x1b, 0x03, 0x11, 0x0c, 0x06, 0x03, 0x0c, 0x09, 0x0c,
+	0x05, 0x05, 0x12, 0x18, 0x07, 0x08, 0x13, 0x07, 0x12, 0x12, 0x05, 0x14,
+	0x14, 0x0c, 0x11, 0x04, 0x04, 0x02, 0x0c, 0x0d, 0x01, 0x04, 0x05, 0x04,
+	0x03, 0x16, 0x04, 0x0c, 0x06, 0x04, 0x03, 0x36, 0x21, 0x00, 0x02, 0x18,
+	0x0b, 0x0a, 0x12, 0x2e, 0x12, 0x06, 0x1c, 0x11, 0x13, 0xff, 0x0c, 0x07,
+	0x00, 0x05, 0x08, 0x10, 0x04, 0x10, 0x04, 0x19, 0x0c, 0x06, 0x19, 0x02,
+	0x0a, 0x05, 0x04, 0x08, 0x08, 0x03, 0x09, 0x12, 0x1c, 0x04, 0x04, 0x1e,
+	0x0d, 0x05, 0x26, 0x05, 0x05, 0x03, 0x07, 0x02, 0x09, 0x09, 0x05, 0x03,
+	0x07, 0x06, 0x06, 0x06, 0x04, 0x01, 0x0b, 0x0a, 0x07, 0x1e, 0x0d, 0x21,
+	0x07, 0x30, 0x0f, 0x09, 0x07, 0x1a, 0x01, 0x19, 0x0c, 0x07, 0x0d, 0x03,
+	0x04, 0x03, 0x04, 0x06, 0x1b, 0x05, 0x05, 0x1c, 0x06, 0x07, 0x07, 0x02,
+	0x07, 0x11, 0x06, 0x03, 0x03, 0x10, 0x10, 0x04, 0x06, 0x04, 0x07, 0x04,
+	0x13, 0x04, 0x07, 0x04, 0x0a, 0x07, 0x11, 0x11, 0x00, 0x28, 0x0c, 0x04,
+	0x07, 0x15, 0x0d, 0x08, 0x0a, 0x0d, 0x05, 0x1a, 0x17, 0x03, 0x08, 0x04,
+	0x11, 0x09, 0x02, 0x04, 0x0a, 0x05, 0x03, 0x05, 0x18, 0x05, 0x10, 0x02,
+	0x02, 0x04, 0x0c, 0x0b, 0x02, 0xff, 0x03, 0x08, 0x08, 0x03, 0x03, 0x0a,
+	0x08, 0x04, 0x04, 0x09, 0x0a, 0x02, 0x06, 0x07, 0x05, 0x03, 0x22, 0x11,
+	0x18, 0x0d, 0x05, 0x0c, 0x1a, 0x07, 0x02, 0x0b, 0x02, 0x0e, 0x0b, 0x02,
+	0x15, 0x04, 0x07, 0x06, 0x04, 0x17, 0x04, 0x06, 0x03, 0x03, 0x05, 0x00,
+	0x06, 0x14, 0x05, 0x06, 0x06, 0x12, 0x06, 0x02, 0x17, 0x0a, 0x0f, 0x04,
+	0x0a, 0x05, 0x1e, 0x11, 0x04, 0x04, 0x04, 0x0c, 0x03, 0x1b, 0x0b, 0x19,
+	0x15, 0x17, 0x05, 0x11, 0x00, 0x0d, 0x0a, 0x0e, 0x19, 0x0c, 0x2e, 0x17,
+	0x0d, 0x0f, 0x04, 0x09, 0x04, 0x0d, 0x0d, 0x17, 0x0d, 0x06, 0x06, 0x14,
+	0x07, 0x0f, 0x02, 0x03, 0x04, 0x12, 0x10, 0x04, 0x0b, 0x04, 0x07, 0x01,
+	0x11, 0x11, 0x0a, 0x03, 0x14, 0x08, 0x08, 0x16, 0x04, 0x08, 0x01, 0x23,
+	0x07, 0x0d, 0x0a, 0x17, 0x0a, 0x0a, 0x0a, 0x08, 0x11, 0x0a, 0x08, 0x29,
+	0x10, 0xff, 0x05, 0x06, 0x0f, 0x0c, 0x03, 0x01, 0x0f, 0x17, 0x03, 0x09,
+	0x03, 0x03, 0x03, 0x0b, 0x08, 0x02, 0x1a, 0x0f, 0x13, 0x00, 0x01, 0x13,
+	0x0a, 0x08, 0x06, 0x10, 0x1b, 0x02, 0x08, 0x07, 0x1b, 0x11, 0x04, 0x06,
+	0x0c, 0x10, 0x0d, 0x04, 0x1a, 0x04, 0x1b, 0x01, 0x10, 0x03, 0x04, 0x06,
+	0x12, 0x0f, 0x03, 0x05, 0x0b, 0x14, 0x0b, 0x05, 0x0c, 0x06, 0x0d, 0x0e,
+	0x02, 0x05, 0x0f, 0x0b, 0x07, 0x0f, 0x15, 0x13, 0x03, 0x08, 0x05, 0x08,
+	0x09, 0x11, 0x05, 0x0b, 0x04, 0x05, 0x0f, 0x14, 0x02, 0x03, 0x13, 0x13,
+	0x01, 0x02, 0x12, 0x0a, 0x05, 0x03, 0x11, 0x07, 0x15, 0x0b, 0x04, 0x13,
+	0x18, 0x02, 0x05, 0x01, 0x12, 0x02, 0x07, 0x04, 0x11, 0x07, 0x06, 0x05,
+	0x0b, 0x0c, 0x03, 0x0b, 0x0e, 0x06, 0x05, 0x04, 0x04, 0x04, 0x0d, 0x0b,
+	0x06, 0x05, 0x14, 0x14, 0x07, 0x04, 0x05, 0x18, 0x06, 0xa6, 0x02, 0x07,
+	0x02, 0x0b, 0x0a, 0x08, 0x03, 0x11, 0x03, 0x0e, 0x10, 0x0b, 0x15, 0x19,
+	0x09, 0x06, 0x08, 0x0e, 0x0e, 0x02, 0x05, 0x0c, 0x12, 0x0b, 0x14, 0x06,
+	0x0f, 0x00, 0x01, 0x12, 0x1b, 0x09, 0x23, 0x0c, 0x02, 0x28, 0x44, 0x00,
+	0x01, 0x00, 0xff, 0x02, 0x08, 0x0f, 0x0c, 0x0c, 0x17, 0x0c, 0x05, 0x06,
+	0x06, 0x01, 0x02, 0x03, 0x0f, 0x0f, 0x0b, 0x0e, 0x06, 0x07, 0x09, 0x01,
+	0x0f, 0x12, 0x04, 0x1c, 0x15, 0x03, 0x18, 0x04, 0x06, 0x01, 0x1a, 0x02,
+	0x0f, 0x17, 0x0f, 0x05, 0x07, 0x07, 0x06, 0x02, 0x03, 0x11, 0x0f, 0x09,
+	0x07, 0x11, 0x17, 0x0c, 0x11, 0x08, 0x04, 0x09, 0x06, 0x10, 0x03, 0x04,
+	0x09, 0x1b, 0x02, 0x14, 0x17, 0x41, 0x03, 0x09, 0x10, 0x0a, 0x03, 0x08,
+	0x11, 0x05, 0x0b, 0x02, 0x02, 0x04, 0x0d, 0x0c, 0x02, 0x3a, 0x5b, 0x02,
+	0x08, 0x0e, 0x02, 0x07, 0x0b, 0x0b, 0x03, 0x09, 0x0f, 0x0c, 0x0c, 0x07,
+	0x1d, 0x06, 0x14, 0x1f, 0x01, 0x08, 0x08, 0x0f, 0x07, 0x06, 0x1b, 0x45,
+	0x10, 0x03, 0x0f, 0x10, 0x1a, 0x03, 0x3f, 0x41, 0x41, 0x3b, 0x00, 0x41,
+	0x04, 0x01, 0x12, 0x1b, 0x12, 0x11, 0x20, 0x0a, 0x13, 0x13, 0xba, 0x02,
+	0x1e, 0x06, 0x05, 0x18, 0x04, 0x03, 0x15, 0x02, 0x02, 0x23, 0x12, 0x18,
+	0x05, 0x05, 0x32, 0x1f, 0x48, 0x0d, 0x3a, 0x50, 0x0f, 0x22, 0x12, 0x00,
+	0x43, 0x00, 0x0a, 0x44, 0x0e, 0x1b, 0x13, 0x04, 0x34, 0x14, 0x22, 0x27,
+	0x16, 0x29, 0x04, 0x18, 0x01, 0x19, 0x17, 0x0f, 0x00, 0x2f, 0x26, 0x05,
+	0x0c, 0x2a, 0x10, 0x10, 0x10, 0x04, 0x02, 0x05, 0x0f, 0x01, 0x0f, 0xff,
+	0x04, 0x0f, 0x01, 0x0f, 0x0f, 0x09, 0x01, 0x09, 0x07, 0x04, 0x14, 0x23,
+	0x0d, 0x05, 0x09, 0x08, 0x34, 0x32, 0x3d, 0x2e, 0x37, 0x33, 0x03, 0x40,
+	0x40, 0x1b, 0x06, 0x1b, 0x07, 0x29, 0x09, 0x37, 0x0c, 0x22, 0x12, 0x02,
+	0x14, 0x01, 0x19, 0x12, 0x17, 0x44, 0x06, 0x18, 0x07, 0x31, 0x05, 0x08,
+	0x18, 0x18, 0x09, 0x03, 0x16, 0x19, 0x07, 0x1b, 0x0e, 0x0c, 0x1e, 0x20,
+	0x0e, 0x0d, 0x45, 0x02, 0x0b, 0x0f, 0x0b, 0x1f, 0x03, 0x0b, 0x0f, 0x0d,
+	0x0c, 0x2b, 0x05, 0x09, 0x0d, 0x0c, 0x03, 0x15, 0x13, 0x1a, 0x02, 0x03,
+	0x0a, 0x15, 0x08, 0x12, 0x03, 0x0f, 0x05, 0x05, 0x2a, 0x06, 0x0d, 0x04,
+	0x07, 0x03, 0x02, 0x02, 0x06, 0x02, 0x16, 0x16, 0x09, 0x04, 0x06, 0x05,
+	0x03, 0x05, 0x02, 0x03, 0x0e, 0x0e, 0x03, 0x1e, 0x1c, 0x1b, 0x19, 0x03,
+	0x04, 0x21, 0x07, 0x0a, 0x0e, 0x09, 0x0c, 0xff, 0x25, 0x07, 0x09, 0x19,
+	0x09, 0x09, 0x04, 0x09, 0x0e, 0x1b, 0x3a, 0x33, 0x35, 0x06, 0x08, 0x07,
+	0x25, 0x00, 0x01, 0x0d, 0x04, 0x26, 0x03, 0x15, 0x1f, 0x12, 0x1d, 0x06,
+	0x02, 0x19, 0x0a, 0x10, 0x04, 0x11, 0x05, 0x02, 0x59, 0x19, 0x05, 0x16,
+	0x03, 0x09, 0x05, 0x02, 0x0d, 0x05, 0x1a, 0x0a, 0x02, 0x04, 0x06, 0x06,
+	0x02, 0x07, 0x0d, 0x00, 0x0e, 0x01, 0x03, 0x04, 0x0c, 0x0f, 0x0f, 0x03,
+	0x04, 0x0a, 0x07, 0x05, 0x00, 0x08, 0x03, 0x0d, 0x0c, 0x05, 0x05, 0x06,
+	0x0b, 0x08, 0x05, 0x0e, 0x14, 0x0d, 0x0b, 0x1b, 0x20, 0x0f, 0x0e, 0x04,
+	0x0f, 0x0a, 0x11, 0x0b, 0x10, 0x11, 0x04, 0x08, 0x01, 0x0d, 0x05, 0x10,
+	0x20, 0x0c, 0x0b, 0x06, 0x2f, 0x38, 0x0b, 0x04, 0x04, 0x1a, 0x11, 0x15,
+	0x17, 0x04, 0x1a, 0x1a, 0x3d, 0x03, 0x09, 0x06, 0x02, 0x04, 0x1b, 0x01,
+	0x19, 0x03, 0x12, 0xff, 0x05, 0x02, 0x09, 0x02, 0x0a, 0x0c, 0x04, 0x09,
+	0x02, 0x24, 0x02, 0x03, 0x0d, 0x13, 0x03, 0x09, 0x04, 0x03, 0x13, 0x02,
+	0x04, 0x15, 0x08, 0x1a, 0x33, 0x35, 0x35, 0x29, 0x00, 0x35, 0x04, 0x01,
+	0x09, 0x1c, 0x0c, 0x0c, 0x1d, 0x12, 0x04, 0x05, 0x1d, 0x05, 0x05, 0x03,
+	0x11, 0x0e, 0x06, 0x01, 0x13, 0x15, 0x05, 0x13, 0x12, 0x0b, 0x05, 0x13,
+	0x07, 0x02, 0x07, 0x07, 0x15, 0x0d, 0x06, 0x1e, 0x09, 0x08, 0x0a, 0x07,
+	0x06, 0x09, 0x04, 0x03, 0x0e, 0x02, 0x00, 0x0e, 0x01, 0x01, 0x23, 0x04,
+	0x26, 0x05, 0x1f, 0x1e, 0x04, 0x11, 0x0c, 0x11, 0x05, 0x0a, 0x05, 0x05,
+	0x04, 0x0b, 0x0b, 0x0d, 0x05, 0x10, 0x0e, 0x04, 0x08, 0x19, 0x08, 0x13,
+	0x07, 0x4b, 0x18, 0x26, 0x3d, 0x00, 0x04, 0x0f, 0x09, 0x16, 0x00, 0x01,
+	0x0f, 0x0f, 0x05, 0x0e, 0x03, 0x04, 0x03, 0x02, 0x02, 0x24, 0x07, 0xff,
+	0x05, 0x17, 0x04, 0x10, 0x17, 0x08, 0x0e, 0x01, 0x13, 0x11, 0x0b, 0x06,
+	0x04, 0x0d, 0x14, 0x0b, 0x02, 0x03, 0x0e, 0x02, 0x03, 0x06, 0x02, 0x03,
+	0x04, 0x08, 0x19, 0x04, 0x07, 0x04, 0x07, 0x01, 0x0d, 0x02, 0x0f, 0x06,
+	0x06, 0x03, 0x0f, 0x19, 0x07, 0x0d, 0x0c, 0x02, 0x07, 0x0c, 0x02, 0x07,
+	0x07, 0x00, 0x15, 0x0b, 0x03, 0x0b, 0x07, 0x0b, 0x03, 0x06, 0x08, 0x0b,
+	0x09, 0x08, 0x0b, 0x04, 0x07, 0x01, 0x04, 0x03, 0x18, 0x12, 0x03, 0x17,
+	0x04, 0x0e, 0x04, 0x04, 0x23, 0x19, 0x09, 0x04, 0x04, 0x02, 0x06, 0x02,
+	0x19, 0x0d, 0x0e, 0x24, 0x04, 0x06, 0x13, 0x04, 0x02, 0x10, 0x04, 0x0b,
+	0x0b, 0x04, 0x0b, 0x0f, 0x05, 0x0c, 0x0c, 0x02, 0x24, 0x22, 0x24, 0x03,
+	0x0c, 0x12, 0x18, 0x03, 0x03, 0x0d, 0x09, 0x3b, 0x0c, 0x05, 0x16, 0x08,
+	0x02, 0x0e, 0x11, 0x05, 0x18, 0x06, 0x06, 0xff, 0x18, 0x27, 0x07, 0x08,
+	0x0c, 0x17, 0x09, 0x03, 0x01, 0x13, 0x19, 0x05, 0x08, 0x04, 0x10, 0x06,
+	0x1a, 0x0c, 0x0a, 0x0e, 0x04, 0x08, 0x01, 0x11, 0x16, 0x05, 0x09, 0x04,
+	0x12, 0x16, 0x02, 0x15, 0x26, 0x00, 0x1d, 0x03, 0x32, 0x0c, 0x08, 0x03,
+	0x1c, 0x0e, 0x13, 0x0c, 0x04, 0x0c, 0x0c, 0x02, 0x10, 0x03, 0x14, 0x12,
+	0x07, 0x05, 0x08, 0x02, 0x02, 0x07, 0x03, 0x27, 0x0b, 0x06, 0x1c, 0x06,
+	0x05, 0x0b, 0x02, 0x02, 0x08, 0x19, 0x2b, 0x0d, 0x0d, 0x0d, 0x0a, 0x06,
+	0x05, 0x08, 0x08, 0x1a, 0x02, 0x26, 0x05, 0x11, 0x08, 0x06, 0x06, 0x3c,
+	0x14, 0x1b, 0x27, 0x09, 0x01, 0x11, 0x0b, 0x0b, 0x0e, 0x02, 0x09, 0x02,
+	0x11, 0x0d, 0x0c, 0x04, 0x21, 0x06, 0x02, 0x13, 0x00, 0x11, 0x09, 0x04,
+	0x08, 0x09, 0x02, 0x1b, 0x06, 0x02, 0x05, 0x05, 0x05, 0x11, 0x05, 0x07,
+	0x06, 0x13, 0x0b, 0xff, 0x07, 0x0c, 0x04, 0x02, 0x02, 0x06, 0x03, 0x08,
+	0x1e, 0x05, 0x1e, 0x02, 0x02, 0x13, 0x16, 0x00, 0x1a, 0x09, 0x09, 0x09,
+	0x17, 0x2e, 0x2e, 0x02, 0x03, 0x0c, 0x0c, 0x0b, 0x0d, 0x03, 0x13, 0x05,
+	0x24, 0x21, 0x1b, 0x0c, 0x15, 0x05, 0x09, 0x0e, 0x0a, 0x04, 0x04, 0x0c,
+	0x15, 0x07, 0x09, 0x15, 0x0b, 0x03, 0x13, 0x02, 0x03, 0x06, 0x07, 0x06,
+	0x16, 0x0f, 0x15, 0x0e, 0x05, 0x3b, 0x3b, 0x02, 0x0e, 0x0b, 0x09, 0x20,
+	0x00, 0x0e, 0x0f, 0x06, 0x04, 0x20, 0x0a, 0x05, 0x05, 0x05, 0x1e, 0x2d,
+	0x2d, 0x2c, 0x00, 0x21, 0x04, 0x01, 0x21, 0x06, 0x0b, 0x1a, 0x16, 0x1f,
+	0x4c, 0x15, 0x13, 0x10, 0x08, 0x08, 0x03, 0x02, 0x11, 0x03, 0x03, 0x04,
+	0x0a, 0x05, 0x04, 0x04, 0x02, 0x04, 0x1b, 0x12, 0x03, 0x0e, 0x11, 0x11,
+	0x11, 0x00, 0x11, 0x04, 0x01, 0x05, 0x06, 0x11, 0x23, 0x18, 0x13, 0xff,
+	0x04, 0x14, 0x06, 0x0c, 0x0f, 0x0f, 0x03, 0x15, 0x06, 0x03, 0x00, 0x03,
+	0x10, 0x09, 0x02, 0x09, 0x02, 0x1b, 0x16, 0x00, 0x37, 0x00, 0x05, 0x2c,
+	0x0f, 0x0c, 0x0c, 0x29, 0x0c, 0x1f, 0x01, 0x09, 0x00, 0x24, 0x10, 0x10,
+	0x0b, 0x20, 0x24, 0x0d, 0x02, 0x03, 0x10, 0x23, 0x13, 0x0c, 0x03, 0x10,
+	0x05, 0x13, 0x03, 0x0a, 0x0e, 0x04, 0x05, 0x04, 0x07, 0x03, 0x15, 0x03,
+	0x1f, 0x0a, 0x16, 0x09, 0x09, 0x00, 0x07, 0x14, 0x0a, 0x13, 0x0b, 0x11,
+	0x0e, 0x04, 0x26, 0x1d, 0x08, 0x04, 0x06, 0x02, 0x0b, 0x0b, 0x0a, 0x10,
+	0x0c, 0x05, 0x06, 0x0b, 0x06, 0x03, 0x08, 0x0b, 0x0d, 0x1f, 0x07, 0x05,
+	0x05, 0x05, 0x02, 0x26, 0x03, 0x03, 0x0a, 0x11, 0x04, 0x0b, 0x06, 0x03,
+	0x20, 0x18, 0x09, 0x0d, 0x0d, 0x06, 0x07, 0x0b, 0x3e, 0x04, 0x04, 0x12,
+	0x04, 0x2b, 0x04, 0x0e, 0x05, 0x11, 0x02, 0xff, 0x0f, 0x03, 0x11, 0x12,
+	0x08, 0x05, 0x0d, 0x0c, 0x06, 0x08, 0x01, 0x1b, 0x06, 0x06, 0x0a, 0x04,
+	0x10, 0x11, 0x0a, 0x03, 0x04, 0x08, 0x17, 0x11, 0x04, 0x0b, 0x04, 0x16,
+	0x0b, 0x0b, 0x11, 0x06, 0x07, 0x0b, 0x14, 0x03, 0x01, 0x0b, 0x0e, 0x00,
+	0x03, 0x08, 0x0f, 0x02, 0x17, 0x03, 0x09, 0x09, 0x05, 0x05, 0x0e, 0x0a,
+	0x07, 0x11, 0x10, 0x0b, 0x10, 0x00, 0x17, 0x16, 0x02, 0x07, 0x09, 0x0a,
+	0x0b, 0x12, 0x02, 0x03, 0x01, 0x03, 0x08, 0x03, 0x2f, 0x30, 0x33, 0x33,
+	0x03, 0x0c, 0x05, 0x0a, 0x0d, 0x02, 0x14, 0x0a, 0x0a, 0x0b, 0x02, 0x02,
+	0x05, 0x05, 0x04, 0x06, 0x02, 0x11, 0x02, 0x11, 0x11, 0x06, 0x07, 0x10,
+	0x00, 0x07, 0x10, 0x09, 0x02, 0x02, 0x14, 0x00, 0x0d, 0x03, 0x0b, 0x04,
+	0x15, 0x03, 0x2a, 0x09, 0x02, 0x05, 0x0e, 0x0e, 0x0b, 0x05, 0x07, 0x06,
+	0x18, 0x05, 0x0d, 0xff, 0x03, 0x05, 0x0a, 0x09, 0x09, 0x04, 0x0e, 0x04,
+	0x06, 0x0e, 0x15, 0x09, 0x0a, 0x07, 0x06, 0x01, 0x02, 0x17, 0x10, 0x0c,
+	0x22, 0x05, 0x2c, 0x05, 0x0f, 0x1b, 0x0a, 0x15, 0x12, 0x07, 0x0c, 0x0f,
+	0x0b, 0x03, 0x03, 0x08, 0x01, 0x0c, 0x1b, 0x07, 0x06, 0x0a, 0x07, 0x0b,
+	0x08, 0x02, 0x11, 0x09, 0x0a, 0x01, 0x0a, 0x00, 0x08, 0x01, 0x05, 0x0b,
+	0x08, 0x11, 0x12, 0x04, 0x1f, 0x21, 0x29, 0x02, 0x13, 0x04, 0x23, 0x06,
+	0x0b, 0x03, 0x17, 0x14, 0x0d, 0x22, 0x1b, 0x13, 0x15, 0x07, 0x12, 0x13,
+	0x0a, 0x41, 0x1a, 0x00, 0x10, 0x06, 0x04, 0x08, 0x13, 0x07, 0x0d, 0x16,
+	0x18, 0x1c, 0x08, 0x06, 0x12, 0x09, 0x03, 0x07, 0x08, 0x19, 0x04, 0x02,
+	0x17, 0x3d, 0x06, 0x04, 0x0c, 0x09, 0x06, 0x08, 0x0c, 0x0c, 0x07, 0x19,
+	0x07, 0x02, 0x1d, 0x03, 0x08, 0x13, 0x04, 0x07, 0x0a, 0x0a, 0x03, 0xff,
+	0x07, 0x09, 0x07, 0x05, 0x11, 0x11, 0x06, 0x07, 0x15, 0x0c, 0x0b, 0x12,
+	0x05, 0x09, 0x12, 0x0a, 0x03, 0x1d, 0x09, 0x15, 0x18, 0x07, 0x11, 0x12,
+	0x0c, 0x08, 0x02, 0x08, 0x02, 0x11, 0x11, 0x07, 0x0b, 0x0e, 0x05, 0x03,
+	0x0d, 0x0c, 0x02, 0x03, 0x02, 0x0d, 0x06, 0x03, 0x04, 0x05, 0x03, 0x03,
+	0x06, 0x06, 0x17, 0x04, 0x04, 0x03, 0x04, 0x02, 0x06, 0x06, 0x05, 0x03,
+	0x0b, 0x0c, 0x03, 0x03, 0x0b, 0x02, 0x0c, 0x05, 0x0b, 0x03, 0x0f, 0x06,
+	0x1c, 0x09, 0x0f, 0x10, 0x02, 0x13, 0x03, 0x0e, 0x06, 0x06, 0x05, 0x0f,
+	0x0f, 0x04, 0x28, 0x37, 0x2c, 0x22, 0x2a, 0x04, 0x01, 0x05, 0x15, 0x08,
+	0x2f, 0x11, 0x0d, 0x05, 0x18, 0x02, 0x03, 0x03, 0x14, 0x15, 0x12, 0x19,
+	0x04, 0x0a, 0x0a, 0x10, 0x14, 0x12, 0x0a, 0x0b, 0x15, 0x08, 0x06, 0x05,
+	0x05, 0x03, 0x0b, 0x16, 0x09, 0x09, 0x07, 0xff, 0x16, 0x0e, 0x18, 0x08,
+	0x02, 0x08, 0x02, 0x18, 0x19, 0x07, 0x0b, 0x0e, 0x05, 0x03, 0x0d, 0x0c,
+	0x02, 0x03, 0x02, 0x0d, 0x06, 0x03, 0x0c, 0x0c, 0x02, 0x0f, 0x06, 0x07,
+	0x0e, 0x09, 0x08, 0x0a, 0x07, 0x0e, 0x0e, 0x02, 0x07, 0x06, 0x0c, 0x07,
+	0x00, 0x04, 0x06, 0x03, 0x02, 0x0a, 0x03, 0x03, 0x04, 0x04, 0x0e, 0x0e,
+	0x08, 0x04, 0x0a, 0x11, 0x19, 0x10, 0x05, 0x0c, 0x02, 0x10, 0x0a, 0x04,
+	0x04, 0x08, 0x03, 0x16, 0x18, 0x2d, 0x2d, 0x00, 0x19, 0x04, 0x01, 0x05,
+	0x0b, 0x0b, 0x0b, 0x1f, 0x12, 0x04, 0x17, 0x06, 0x02, 0x03, 0x13, 0x1a,
+	0x0e, 0x07, 0x06, 0x05, 0x1a, 0x11, 0x03, 0x08, 0x0b, 0x03, 0x11, 0x04,
+	0x19, 0x01, 0x14, 0x05, 0x17, 0x1d, 0x21, 0x0d, 0x06, 0x29, 0x10, 0x03,
+	0x00, 0x0f, 0x19, 0x05, 0x0a, 0x04, 0x0b, 0x06, 0x1c, 0x0d, 0x1a, 0x1d,
+	0x08, 0x0c, 0x2b, 0xff, 0x0e, 0x16, 0x04, 0x12, 0x08, 0x0c, 0x03, 0x1e,
+	0x0c, 0x0d, 0x0d, 0x07, 0x13, 0x16, 0x18, 0x08, 0x02, 0x08, 0x02, 0x1e,
+	0x13, 0x07, 0x0b, 0x13, 0x05, 0x1b, 0x1e, 0x1e, 0x46, 0x1e, 0x04, 0x01,
+	0x05, 0x1c, 0x0d, 0x1d, 0x18, 0x1b, 0x05, 0x18, 0x16, 0x0e, 0x04, 0x14,
+	0x15, 0x11, 0x1b, 0x1b, 0x09, 0x0a, 0x1b, 0x14, 0x00, 0x1b, 0x04, 0x07,
+	0x1b, 0x0c, 0x03, 0x05, 0x0b, 0x07, 0x04, 0x04, 0x13, 0x16, 0x16, 0x1f,
+	0x00, 0x16, 0x04, 0x01, 0x05, 0x10, 0x15, 0x1e, 0x15, 0x15, 0x0b, 0x0e,
+	0x00, 0x01, 0x01, 0x07, 0x10, 0x10, 0x04, 0x03, 0x17, 0x11, 0x1c, 0x17,
+	0x0c, 0x04, 0x05, 0x08, 0x03, 0x02, 0x01, 0x2c, 0x08, 0x0b, 0x04, 0x09,
+	0x06, 0x0b, 0x03, 0x01, 0x03, 0x14, 0x06, 0x15, 0x05, 0x0a, 0x05, 0x07,
+	0x0d, 0x04, 0x1e, 0x01, 0x1d, 0x02, 0x0b, 0x1a, 0x06, 0x06, 0x04, 0xff,
+	0x02, 0x06, 0x1f, 0x0b, 0x03, 0x0d, 0x04, 0x1a, 0x10, 0x12, 0x07, 0x07,
+	0x0b, 0x06, 0x08, 0x0a, 0x04, 0x03, 0x14, 0x08, 0x06, 0x04, 0x04, 0x0e,
+	0x0b, 0x02, 0x01, 0x0c, 0x12, 0x05, 0x13, 0x12, 0x06, 0x12, 0x0c, 0x09,
+	0x15, 0x02, 0x04, 0x0d, 0x0a, 0x20, 0x0a, 0x0c, 0x05, 0x04, 0x01, 0x06,
+	0x04, 0x03, 0x0f, 0x04, 0x07, 0x03, 0x16, 0x03, 0x10, 0x20, 0x02, 0x06,
+	0x08, 0x08, 0x03, 0x04, 0x0c, 0x14, 0x04, 0x15, 0x00, 0x2d, 0x06, 0x10,
+	0x06, 0x16, 0x13, 0x0c, 0x04, 0x05, 0x05, 0x10, 0x02, 0x0b, 0x0b, 0x0f,
+	0x16, 0x00, 0x0d, 0x0a, 0x06, 0x04, 0x07, 0x02, 0x37, 0x14, 0x0c, 0x13,
+	0x13, 0x17, 0x0a, 0x08, 0x00, 0x01, 0x0a, 0x08, 0x09, 0x0e, 0x0e, 0x02,
+	0x02, 0x14, 0x02, 0x05, 0x0b, 0x07, 0x08, 0x04, 0x11, 0x04, 0x06, 0x03,
+	0x0f, 0x06, 0x03, 0x03, 0x06, 0x0d, 0x0f, 0xff, 0x10, 0x00, 0x06, 0x0e,
+	0x06, 0x04, 0x0a, 0x0b, 0x03, 0x09, 0x14, 0x07, 0x14, 0x01, 0x06, 0x04,
+	0x08, 0x0d, 0x11, 0x22, 0x09, 0x10, 0x0f, 0x02, 0x13, 0x0f, 0x07, 0x04,
+	0x0b, 0x05, 0x0a, 0x04, 0x02, 0x03, 0x07, 0x11, 0x0e, 0x06, 0x05, 0x19,
+	0x05, 0x03, 0x08, 0x04, 0x0c, 0x08, 0x0d, 0x03, 0x07, 0x0d, 0x07, 0x05,
+	0x18, 0x05, 0x12, 0x09, 0x02, 0x12, 0x03, 0x06, 0x01, 0x03, 0x02, 0x0c,
+	0x03, 0x02, 0x03, 0x0c, 0x06, 0x02, 0x04, 0x0f, 0x0c, 0x0a, 0x03, 0x09,
+	0x0b, 0x06, 0x10, 0x10, 0x13, 0x10, 0x09, 0x09, 0x0b, 0x00, 0x01, 0x09,
+	0x13, 0x07, 0x05, 0x09, 0x05, 0x13, 0x0a, 0x04, 0x0b, 0x0a, 0x0f, 0x06,
+	0x0a, 0x08, 0x0f, 0x0c, 0x11, 0x03, 0x0f, 0x03, 0x02, 0x15, 0x05, 0x0d,
+	0x0d, 0x0e, 0x10, 0x0d, 0x0f, 0x0d, 0x0a, 0x00, 0x08, 0x13, 0x12, 0x04,
+	0x0b, 0x0c, 0x05, 0xff, 0x15, 0x02, 0x02, 0x11, 0x02, 0x11, 0x0d, 0x07,
+	0x0a, 0x04, 0x0f, 0x04, 0x06, 0x03, 0x15, 0x06, 0x03, 0x03, 0x06, 0x0f,
+	0x11, 0x0d, 0x00, 0x06, 0x0f, 0x06, 0x09, 0x08, 0x15, 0x05, 0x05, 0x16,
+	0x0e, 0x0b, 0x04, 0x14, 0x16, 0x0c, 0x0f, 0x10, 0x0d, 0x12, 0x0b, 0x08,
+	0x14, 0x01, 0x0e, 0x0c, 0x01, 0x01, 0x19, 0x03, 0x06, 0x07, 0x04, 0x14,
+	0x02, 0x02, 0x06, 0x02, 0x02, 0x0e, 0x02, 0x13, 0x12, 0x03, 0x05, 0x13,
+	0x17, 0x06, 0x0d, 0x21, 0x10, 0x07, 0x04, 0x08, 0x05, 0x02, 0x09, 0x11,
+	0x0a, 0x18, 0x16, 0x10, 0x09, 0x29, 0x08, 0x2b, 0x10, 0x08, 0x07, 0x04,
+	0x23, 0x28, 0x2c, 0x02, 0x03, 0x05, 0x05, 0x0a, 0x03, 0x0a, 0x0c, 0x0d,
+	0x04, 0x04, 0x0a, 0x05, 0x19, 0x18, 0x10, 0x04, 0x12, 0x0b, 0x08, 0x19,
+	0x09, 0x0b, 0x0a, 0x02, 0x0e, 0x23, 0x59, 0x03, 0x04, 0x15, 0x02, 0xff,
+	0x0b, 0x0a, 0x02, 0x15, 0x09, 0x0c, 0x03, 0x1f, 0x0d, 0x02, 0x19, 0x09,
+	0x06, 0x0e, 0x05, 0x01, 0x05, 0x0a, 0x08, 0x0a, 0x07, 0x04, 0x07, 0x01,
+	0x0b, 0x10, 0x10, 0x0a, 0x05, 0x0a, 0x05, 0x13, 0x04, 0x00, 0x09, 0x08,
+	0x09, 0x08, 0x02, 0x09, 0x0c, 0x04, 0x05, 0x00, 0x06, 0x09, 0x17, 0x13,
+	0x00, 0x30, 0x00, 0x09, 0x3f, 0x08, 0x1e, 0x08, 0x19, 0x2e, 0x04, 0x02,
+	0x46, 0x0f, 0x03, 0x13, 0x0e, 0x0c, 0x00, 0x07, 0x11, 0x09, 0x0c, 0x0c,
+	0x08, 0x0c, 0x04, 0x0c, 0x07, 0x04, 0x02, 0x0c, 0x0c, 0x03, 0x0c, 0x0c,
+	0x0a, 0x01, 0x04, 0x13, 0x04, 0x13, 0x12, 0x03, 0x05, 0x14, 0x08, 0x06,
+	0x08, 0x03, 0x07, 0x02, 0x06, 0x01, 0x08, 0x0c, 0x0d, 0x01, 0x02, 0x05,
+	0x06, 0x15, 0x0b, 0x05, 0x07, 0x0a, 0x15, 0x03, 0x08, 0x0a, 0x0c, 0x09,
+	0x06, 0x0c, 0x14, 0x09, 0x3a, 0x06, 0x02, 0xff, 0x16, 0x06, 0x0a, 0x0e,
+	0x04, 0x08, 0x04, 0x06, 0x03, 0x1b, 0x0b, 0x26, 0x08, 0x17, 0x03, 0x08,
+	0x20, 0x08, 0x18, 0x0f, 0x04, 0x25, 0x0b, 0x0d, 0x0c, 0x09, 0x13, 0x00,
+	0x0c, 0x12, 0x06, 0x09, 0x0b, 0x08, 0x05, 0x06, 0x22, 0x24, 0x07, 0x16,
+	0x23, 0x08, 0x03, 0x09, 0x02, 0x02, 0x01, 0x03, 0x0a, 0x0e, 0x0b, 0x05,
+	0x07, 0x10, 0x07, 0x0c, 0x05, 0x05, 0x03, 0x10, 0x0e, 0x02, 0x03, 0x03,
+	0x03, 0x18, 0x06, 0x04, 0x08, 0x02, 0x00, 0x09, 0x03, 0x08, 0x03, 0x00,
+	0x03, 0x03, 0x0a, 0x03, 0x1e, 0x01, 0x04, 0x0a, 0x10, 0x0c, 0x07, 0x0e,
+	0x05, 0x05, 0x15, 0x14, 0x0b, 0x13, 0x0f, 0x0a, 0x00, 0x09, 0x08, 0x11,
+	0x05, 0x0f, 0x0d, 0x0f, 0x09, 0x12, 0x08, 0x25, 0x13, 0x10, 0x12, 0x02,
+	0x04, 0x29, 0x2e, 0x2c, 0x2e, 0x2c, 0x04, 0x01, 0x05, 0x13, 0x12, 0x1c,
+	0x03, 0x06, 0x14, 0xff, 0x0c, 0x06, 0x0f, 0x21, 0x45, 0x03, 0x15, 0x00,
+	0x01, 0x08, 0x14, 0x0b, 0x11, 0x18, 0x0d, 0x0b, 0x04, 0x1d, 0x07, 0x1a,
+	0x14, 0x09, 0x05, 0x04, 0x07, 0x08, 0x02, 0x18, 0x05, 0x07, 0x00, 0x01,
+	0x18, 0x04, 0x05, 0x07, 0x20, 0x1b, 0x23, 0x0b, 0x05, 0x13, 0x09, 0x08,
+	0x0a, 0x1a, 0x05, 0x03, 0x22, 0x12, 0x11, 0x0e, 0x01, 0x0e, 0x11, 0x0b,
+	0x07, 0x06, 0x06, 0x0b, 0x03, 0x28, 0x34, 0x34, 0x1a, 0x03, 0x08, 0x05,
+	0x0d, 0x23, 0x02, 0x10, 0x11, 0x0a, 0x0f, 0x0c, 0x05, 0x07, 0x11, 0x10,
+	0x20, 0x04, 0x2b, 0x0d, 0x10, 0x10, 0x10, 0x03, 0x3e, 0x3e, 0x2a, 0x17,
+	0x2a, 0x04, 0x04, 0x25, 0x25, 0x08, 0x0b, 0x0c, 0x18, 0x0f, 0x1e, 0x1c,
+	0x05, 0x0e, 0x10, 0x10, 0x09, 0x03, 0x0d, 0x0d, 0x10, 0x10, 0x10, 0x04,
+	0x04, 0x06, 0x0f, 0x2a, 0x30, 0x2e, 0x0d, 0x12, 0x3f, 0x02, 0x26, 0xff,
+	0x25, 0x04, 0x02, 0x1a, 0x04, 0x03, 0x16, 0x16, 0x16, 0x03, 0x04, 0x06,
+	0x07, 0x03, 0x02, 0x1c, 0x04, 0x3f, 0x1a, 0x05, 0x1b, 0x1e, 0x1e, 0x26,
+	0x02, 0x04, 0x0a, 0x1f, 0x2d, 0x0b, 0x04, 0x01, 0x0f, 0x07, 0x07, 0x04,
+	0x27, 0x2d, 0x23, 0x07, 0x04, 0x02, 0x09, 0x02, 0x02, 0x06, 0x04, 0x03,
+	0x24, 0x14, 0x06, 0x14, 0x07, 0x23, 0x0c, 0x25, 0x08, 0x10, 0x05, 0x02,
+	0x02, 0x03, 0x02, 0x08, 0x0a, 0x06, 0x16, 0x13, 0x05, 0x0b, 0x06, 0x02,
+	0x13, 0x02, 0x09, 0x0a, 0x00, 0x09, 0x0c, 0x08, 0x07, 0x05, 0x03, 0x0b,
+	0x06, 0x06, 0x0b, 0x0b, 0x07, 0x0b, 0x0d, 0x02, 0x13, 0x05, 0x2e, 0x0b,
+	0x0b, 0x27, 0x06, 0x05, 0x01, 0x28, 0x02, 0x0d, 0x00, 0x03, 0x0a, 0x16,
+	0x0d, 0x10, 0x04, 0x0f, 0x13, 0x04, 0x03, 0x10, 0x09, 0x05, 0x01, 0x03,
+	0x10, 0x09, 0x08, 0x03, 0x07, 0x05, 0x16, 0xff, 0x09, 0x14, 0x0c, 0x0a,
+	0x05, 0x0e, 0x07, 0x29, 0x09, 0x24, 0x09, 0x04, 0x03, 0x0c, 0x2e, 0x09,
+	0x11, 0x02, 0x02, 0x04, 0x13, 0x0c, 0x02, 0x03, 0x08, 0x08, 0x03, 0x04,
+	0x0c, 0x15, 0x04, 0x04, 0x03, 0x04, 0x02, 0x10, 0x09, 0x14, 0x00, 0x0a,
+	0x01, 0x0f, 0x05, 0x0b, 0x0b, 0x0a, 0x03, 0x09, 0x04, 0x0a, 0x06, 0x05,
+	0x04, 0x05, 0x0d, 0x08, 0x04, 0x03, 0x06, 0x12, 0x08, 0x04, 0x0c, 0x05,
+	0x05, 0x06, 0x07, 0x06, 0x0a, 0x07, 0x07, 0x16, 0x08, 0x08, 0x08, 0x14,
+	0x13, 0x03, 0x0c, 0x05, 0x08, 0x03, 0x14, 0x0a, 0x04, 0x19, 0x19, 0x0d,
+	0x07, 0x04, 0x11, 0x09, 0x02, 0x0f, 0x0d, 0x2c, 0x08, 0x04, 0x10, 0x08,
+	0x0d, 0x0f, 0x04, 0x02, 0x07, 0x03, 0x03, 0x1a, 0x06, 0x0b, 0x0c, 0x00,
+	0x08, 0x07, 0x06, 0x0b, 0x02, 0x0f, 0x04, 0x04, 0x06, 0x06, 0x02, 0x01,
+	0x0a, 0x1a, 0x05, 0xff, 0x0e, 0x05, 0x0e, 0x03, 0x03, 0x00, 0x03, 0x06,
+	0x07, 0x16, 0x05, 0x04, 0x04, 0x0b, 0x02, 0x04, 0x09, 0x09, 0x06, 0x19,
+	0x13, 0x00, 0x2f, 0x00, 0x07, 0x24, 0x0d, 0x0c, 0x09, 0x0d, 0x1f, 0x2d,
+	0x03, 0x0d, 0x00, 0x01, 0x08, 0x08, 0x11, 0x11, 0x10, 0x14, 0x0b, 0x04,
+	0x1a, 0x0f, 0x00, 0x07, 0x0e, 0x05, 0x0a, 0x0e, 0x0e, 0x0e, 0x03, 0x0e,
+	0x00, 0x01, 0x0e, 0x11, 0x0c, 0x0f, 0x0f, 0x0f, 0x0b, 0x04, 0x0f, 0x07,
+	0x03, 0x0c, 0x02, 0x09, 0x01, 0x15, 0x02, 0x16, 0x03, 0x09, 0x1a, 0x02,
+	0x0c, 0x0a, 0x0c, 0x05, 0x0c, 0x0b, 0x04, 0x0c, 0x07, 0x18, 0x04, 0x04,
+	0x0b, 0x18, 0x0c, 0x06, 0x04, 0x1b, 0x10, 0x08, 0x0d, 0x07, 0x10, 0x07,
+	0x06, 0x02, 0x0a, 0x08, 0x0b, 0x05, 0x0b, 0x01, 0x1e, 0x02, 0x08, 0x06,
+	0x02, 0x0a, 0x14, 0x0b, 0x16, 0x0a, 0x0c, 0x0d, 0x06, 0x05, 0x09, 0xff,
+	0x0b, 0x10, 0x12, 0x02, 0x05, 0x0c, 0x1a, 0x10, 0x19, 0x05, 0x0d, 0x00,
+	0x19, 0x00, 0x02, 0x25, 0x34, 0x35, 0x05, 0x00, 0x03, 0x03, 0x03, 0x04,
+	0x09, 0x08, 0x02, 0x13, 0x12, 0x02, 0x04, 0x02, 0x18, 0x10, 0x11, 0x18,
+	0x05, 0x10, 0x15, 0x18, 0x09, 0x0b, 0x05, 0x15, 0x20, 0x06, 0x09, 0x06,
+	0x0b, 0x16, 0x06, 0x06, 0x0c, 0x06, 0x09, 0x00, 0x09, 0x06, 0x0d, 0x09,
+	0x08, 0x06, 0x15, 0x1f, 0x06, 0x0f, 0x16, 0x15, 0x00, 0x00, 0x16, 0x00,
+	0x09, 0x2e, 0x08, 0x08, 0x09, 0x0e, 0x05, 0x17, 0x0e, 0x14, 0x04, 0x15,
+	0x01, 0x03, 0x06, 0x11, 0x0c, 0x00, 0x24, 0x09, 0x31, 0x0a, 0x19, 0x27,
+	0x00, 0x31, 0x04, 0x01, 0x05, 0x08, 0x14, 0x1d, 0x0d, 0x19, 0x0d, 0x06,
+	0x12, 0x12, 0x10, 0x09, 0x04, 0x1a, 0x03, 0x13, 0x09, 0x13, 0x01, 0x1b,
+	0x06, 0x20, 0x04, 0x08, 0x03, 0x06, 0x03, 0xff, 0x03, 0x0b, 0x19, 0x05,
+	0x05, 0x07, 0x02, 0x1e, 0x09, 0x10, 0x1b, 0x04, 0x49, 0x0b, 0x05, 0x12,
+	0x10, 0x0f, 0x25, 0x09, 0x08, 0x1b, 0x03, 0x06, 0x0a, 0x01, 0x08, 0x09,
+	0x1b, 0x07, 0x00, 0x57, 0x0b, 0x15, 0x00, 0x20, 0x14, 0x39, 0x42, 0x00,
+	0x0f, 0x0e, 0x0d, 0x21, 0x17, 0x17, 0x03, 0x03, 0x11, 0x13, 0x05, 0x27,
+	0x05, 0x05, 0x12, 0x1b, 0x02, 0x3b, 0x0f, 0x0d, 0x58, 0x0e, 0x0e, 0x09,
+	0x0d, 0x01, 0x16, 0x0b, 0x07, 0x0b, 0x07, 0x06, 0x09, 0x06, 0x0d, 0x11,
+	0x00, 0x0f, 0x06, 0x25, 0x09, 0x1e, 0x3b, 0x06, 0x00, 0x11, 0x0c, 0x54,
+	0x2d, 0x1a, 0x21, 0x1a, 0x0d, 0x06, 0x02, 0x04, 0x08, 0x12, 0x20, 0x02,
+	0x03, 0x06, 0x1b, 0x1d, 0x03, 0x00, 0x06, 0x0e, 0x06, 0x11, 0x04, 0x07,
+	0x11, 0x02, 0x08, 0x0a, 0x12, 0x03, 0x14, 0x16, 0x21, 0x0b, 0x09, 0x0f,
+	0x06, 0x1c, 0x0c, 0xff, 0x18, 0x0f, 0x06, 0x0e, 0x15, 0x11, 0x27, 0x09,
+	0x2e, 0x11, 0x07, 0x13, 0x04, 0x01, 0x13, 0x0a, 0x0e, 0x1b, 0x0e, 0x2b,
+	0x15, 0x1c, 0x24, 0x14, 0x05, 0x19, 0x0c, 0x18, 0x03, 0x0d, 0x0d, 0x04,
+	0x0d, 0x03, 0x0c, 0x01, 0x03, 0x09, 0x06, 0x0a, 0x03, 0x04, 0x0e, 0x15,
+	0x01, 0x0c, 0x09, 0x06, 0x1a, 0x07, 0x19, 0x17, 0x10, 0x01, 0x12, 0x03,
+	0x0a, 0x19, 0x05, 0x08, 0x01, 0x19, 0x08, 0x07, 0x0e, 0x07, 0x12, 0x07,
+	0x07, 0x0f, 0x00, 0x0f, 0x06, 0x0c, 0x18, 0x0a, 0x00, 0x10, 0x05, 0x0d,
+	0x09, 0x10, 0x01, 0x03, 0x0a, 0x0a, 0x10, 0x08, 0x11, 0x0c, 0x07, 0x03,
+	0x06, 0x0e, 0x0a, 0x02, 0x10, 0x00, 0x01, 0x01, 0x04, 0x11, 0x0a, 0x04,
+	0x21, 0x04, 0x22, 0x18, 0x16, 0x00, 0x14, 0x07, 0x06, 0x1f, 0x00, 0x02,
+	0x04, 0x12, 0x16, 0x17, 0x11, 0x19, 0x0d, 0x12, 0x13, 0x16, 0x05, 0xff,
+	0x19, 0x1c, 0x09, 0x03, 0x16, 0x0e, 0x56, 0x15, 0x0b, 0x10, 0x10, 0x19,
+	0x08, 0x1b, 0x04, 0x08, 0x4e, 0x41, 0x48, 0x01, 0x01, 0x49, 0x42, 0x24,
+	0x21, 0x23, 0x1f, 0x37, 0x01, 0x17, 0x0f, 0x22, 0x1a, 0x1d, 0x01, 0x25,
+	0x06, 0x1c, 0x14, 0x04, 0x03, 0x1a, 0x03, 0x1a, 0x20, 0x05, 0x19, 0x17,
+	0x00, 0x0c, 0x18, 0x33, 0x0a, 0x08, 0x0d, 0x05, 0x05, 0x0f, 0x0e, 0x06,
+	0x37, 0x36, 0x05, 0x09, 0x06, 0x07, 0x0a, 0x24, 0x37, 0x09, 0x1e, 0x0e,
+	0x44, 0x02, 0x18, 0x04, 0x00, 0x27, 0x07, 0x04, 0x00, 0x13, 0x09, 0x27,
+	0x21, 0x00, 0x0e, 0x0d, 0x06, 0x07, 0x22, 0x1a, 0x24, 0x1a, 0x1a, 0x19,
+	0x0a, 0x19, 0x16, 0x0a, 0x0b, 0x1a, 0x15, 0x2b, 0x07, 0x11, 0x09, 0x09,
+	0x04, 0x1f, 0x16, 0x00, 0x3c, 0x09, 0x0d, 0x07, 0x17, 0x17, 0x14, 0x0f,
+	0x00, 0x17, 0x0d, 0x17, 0x0f, 0x00, 0x10, 0xff, 0x12, 0x14, 0x27, 0x14,
+	0x29, 0x01, 0x17, 0x10, 0x00, 0x03, 0x0a, 0x06, 0x03, 0x11, 0x19, 0x0b,
+	0x09, 0x09, 0x08, 0x01, 0x03, 0x3f, 0x18, 0x10, 0x01, 0x3c, 0x3f, 0x0b,
+	0x16, 0x13, 0x0d, 0x12, 0x10, 0x00, 0x0c, 0x06, 0x12, 0x0d, 0x0d, 0x04,
+	0x1b, 0x0e, 0x02, 0x06, 0x06, 0x0e, 0x0a, 0x22, 0x0f, 0x08, 0x06, 0x0e,
+	0x0e, 0x06, 0x0e, 0x0e, 0x00, 0x0b, 0x06, 0x0b, 0x1b, 0x1b, 0x0d, 0x03,
+	0x2d, 0x1b, 0x1b, 0x1b, 0x12, 0x00, 0x0e, 0x0c, 0x1b, 0x15, 0x00, 0x02,
+	0x04, 0x0a, 0x12, 0x17, 0x0f, 0x2d, 0x12, 0x13, 0x25, 0x23, 0x05, 0x1b,
+	0x1d, 0x09, 0x03, 0x18, 0x0e, 0x2d, 0x22, 0x0b, 0x10, 0x10, 0x1a, 0x08,
+	0x18, 0x04, 0x08, 0x2d, 0x00, 0x00, 0x00, 0x48, 0x46, 0x00, 0x47, 0x1e,
+	0x1e, 0x00, 0x50, 0x3b, 0x11, 0x1a, 0x28, 0x20, 0x10, 0x0e, 0x02, 0x04,
+	0x01, 0x02, 0x03, 0xff, 0x05, 0x1e, 0x19, 0x14, 0x06, 0x17, 0x14, 0x06,
+	0x06, 0x1b, 0x06, 0x09, 0x00, 0x09, 0x06, 0x15, 0x09, 0x0a, 0x04, 0x27,
+	0x08, 0x0c, 0x01, 0x24, 0x06, 0x09, 0x19, 0x07, 0x19, 0x07, 0x08, 0x09,
+	0x0c, 0x08, 0x1d, 0x0d, 0x0c, 0x03, 0x10, 0x03, 0x10, 0x10, 0x05, 0x07,
+	0x0e, 0x00, 0x0d, 0x10, 0x27, 0x0a, 0x1f, 0x06, 0x07, 0x12, 0x16, 0x16,
+	0x0a, 0x22, 0x0e, 0x06, 0x14, 0x0a, 0x05, 0x02, 0x03, 0x0d, 0x0d, 0x0d,
+	0x05, 0x33, 0x07, 0x02, 0x16, 0x12, 0x0b, 0x04, 0x16, 0x05, 0x02, 0x52,
+	0x45, 0x3f, 0x04, 0x04, 0x05, 0x0b, 0x28, 0x03, 0x04, 0x0d, 0x04, 0x0d,
+	0x19, 0x15, 0x06, 0x2f, 0x05, 0x05, 0x05, 0x06, 0x07, 0x0d, 0x07, 0x02,
+	0x08, 0x07, 0x12, 0x02, 0x02, 0x0f, 0x02, 0x04, 0x05, 0x0c, 0x05, 0x0c,
+	0x03, 0x04, 0x08, 0x13, 0x13, 0x0a, 0x15, 0x15, 0x3c, 0x38, 0x45, 0xf9,
+	0x14, 0x0b, 0x1d, 0x12, 0x13, 0x12, 0x0f, 0x28, 0x3f, 0x24, 0x3f, 0x0f,
+	0x00, 0x0f, 0x0d, 0x1c, 0x18, 0x15, 0x0f, 0x0d, 0x0e, 0x2c, 0x0f, 0x04,
+	0x42, 0x04, 0x04, 0x04, 0x4e, 0x11, 0x06, 0x1b, 0x08, 0x1c, 0x1a, 0x1a,
+	0x0a, 0x1a, 0x0d, 0x24, 0x21, 0x0a, 0x27, 0x03, 0x0b, 0x27, 0x04, 0x06,
+	0x03, 0x0d, 0x03, 0x02, 0x01, 0x03, 0x02, 0x0a, 0x1f, 0x40, 0x2f, 0x0d,
+	0x04, 0x12, 0x05, 0x08, 0x15, 0x10, 0x22, 0x0c, 0x11, 0x0c, 0x03, 0x02,
+	0x06, 0x29, 0x18, 0x0c, 0x15, 0x05, 0x0f, 0x03, 0x07, 0x1b, 0x1b, 0x0d,
+	0x0d, 0x0e, 0x0f, 0x0c, 0x03, 0x00, 0x19, 0x0e, 0x02, 0x20, 0x02, 0x1e,
+	0x2b, 0x3c, 0x03, 0x0a, 0x06, 0x19, 0x00, 0x01, 0x0e, 0x04, 0x26, 0x02,
+	0x1d, 0x14, 0x12, 0x17, 0x1a, 0x07, 0x1a, 0x09, 0x1a, 0x14, 0x06, 0x1d,
+	0x06, 0x02, 0x06, 0xff, 0x04, 0x12, 0x03, 0x1b, 0x0c, 0x0f, 0x16, 0x0f,
+	0x1a, 0x0d, 0x0d, 0x0a, 0x17, 0x10, 0x09, 0x0b, 0x0b, 0x0b, 0x08, 0x08,
+	0x08, 0x04, 0x0a, 0x0d, 0x03, 0x0b, 0x10, 0x0d, 0x19, 0x19, 0x13, 0x12,
+	0x13, 0x05, 0x0f, 0x15, 0x0d, 0x0f, 0x04, 0x0c, 0x08, 0x02, 0x0c, 0x00,
+	0x01, 0x07, 0x05, 0x05, 0x39, 0x04, 0x38, 0x09, 0x02, 0x2d, 0x08, 0x06,
+	0x40, 0x13, 0x02, 0x1d, 0x02, 0x02, 0x33, 0x3a, 0x29, 0x03, 0x2b, 0x16,
+	0x0b, 0x03, 0x1b, 0x19, 0x00, 0x03, 0x12, 0x04, 0x13, 0x16, 0x00, 0x10,
+	0x03, 0x02, 0x1d, 0x02, 0x11, 0x0a, 0x08, 0x03, 0x25, 0x1c, 0x18, 0x25,
+	0x04, 0x1d, 0x06, 0x17, 0x0b, 0x03, 0x03, 0x0e, 0x1d, 0x1d, 0x12, 0x1c,
+	0x09, 0x30, 0x07, 0x07, 0x30, 0x04, 0x05, 0x06, 0x0e, 0x13, 0x14, 0x08,
+	0x35, 0x0c, 0x00, 0x0c, 0x00, 0x3c, 0x0a, 0x3b, 0x06, 0x16, 0x12, 0xff,
+	0x16, 0x05, 0x03, 0x02, 0x04, 0x03, 0x18, 0x02, 0x20, 0x05, 0x04, 0x24,
+	0x12, 0x03, 0x05, 0x04, 0x4d, 0x01, 0x1b, 0x15, 0x18, 0x14, 0x04, 0x07,
+	0x0c, 0x08, 0x03, 0x0d, 0x06, 0x06, 0x14, 0x08, 0x06, 0x16, 0x00, 0x01,
+	0x18, 0x08, 0x0b, 0x17, 0x17, 0x05, 0x1d, 0x17, 0x17, 0x00, 0x07, 0x36,
+	0x04, 0x02, 0x46, 0x0b, 0x02, 0x13, 0x01, 0x51, 0x00, 0x01, 0x2c, 0x2c,
+	0x2c, 0x7c, 0x04, 0x23, 0x10, 0x1d, 0x2c, 0x12, 0x12, 0x06, 0x1d, 0x1d,
+	0x1d, 0x04, 0x04, 0x05, 0x08, 0x04, 0x04, 0x18, 0x24, 0x05, 0x22, 0x07,
+	0x19, 0x06, 0x07, 0x1e, 0x1f, 0x05, 0x03, 0x02, 0x04, 0x03, 0x0e, 0x02,
+	0x20, 0x05, 0x04, 0x0e, 0x0e, 0x03, 0x05, 0x04, 0x35, 0x29, 0x1e, 0x1e,
+	0x00, 0x04, 0x00, 0x00, 0x00, 0x10, 0x0b, 0x1f, 0x03, 0x20, 0x04, 0x1d,
+	0x00, 0x03, 0x15, 0x0c, 0x02, 0x03, 0x02, 0xff, 0x15, 0x05, 0x05, 0x16,
+	0x12, 0x05, 0x07, 0x01, 0x02, 0x06, 0x22, 0x30, 0x06, 0x04, 0x06, 0x06,
+	0x05, 0x02, 0x02, 0x03, 0x11, 0x03, 0x0c, 0x02, 0x15, 0x06, 0x03, 0x03,
+	0x01, 0x04, 0x06, 0x03, 0x15, 0x02, 0x21, 0x12, 0x12, 0x00, 0x06, 0x1e,
+	0x04, 0x02, 0x21, 0x12, 0x02, 0x21, 0x01, 0x21, 0x00, 0x01, 0x06, 0x21,
+	0x00, 0x20, 0x03, 0x1a, 0x16, 0x0d, 0x0f, 0x16, 0x17, 0x1f, 0x07, 0x0d,
+	0x06, 0x05, 0x07, 0x1a, 0x18, 0x1f, 0x07, 0x1f, 0x0b, 0x08, 0x19, 0x1a,
+	0x05, 0x03, 0x02, 0x04, 0x03, 0x08, 0x02, 0x18, 0x05, 0x04, 0x1f, 0x1f,
+	0x03, 0x05, 0x04, 0x11, 0x1f, 0x02, 0x04, 0x09, 0x05, 0x09, 0x1b, 0x1b,
+	0x00, 0x06, 0x00, 0x00, 0x00, 0x1f, 0x15, 0x14, 0x00, 0x03, 0x09, 0x09,
+	0x09, 0x03, 0x10, 0x1e, 0x16, 0x00, 0x01, 0x2e, 0x16, 0x0e, 0x16, 0x07,
+	0x11, 0x58, 0x24, 0xff, 0x03, 0x15, 0x15, 0x0f, 0x0e, 0x10, 0x05, 0x01,
+	0x03, 0x19, 0x12, 0x0d, 0x0c, 0x12, 0x05, 0x07, 0x01, 0x02, 0x06, 0x10,
+	0x22, 0x06, 0x04, 0x06, 0x06, 0x05, 0x02, 0x02, 0x03, 0x0a, 0x16, 0x16,
+	0x00, 0x05, 0x00, 0x00, 0x00, 0x22, 0x04, 0x1a, 0x08, 0x03, 0x03, 0x01,
+	0x04, 0x08, 0x03, 0x1a, 0x02, 0x22, 0x09, 0x09, 0x00, 0x06, 0x3b, 0x04,
+	0x02, 0x41, 0x18, 0x14, 0x03, 0x0c, 0x09, 0x0e, 0x0c, 0x11, 0x05, 0x2a,
+	0x14, 0x1b, 0x14, 0x06, 0x05, 0x09, 0x1c, 0x02, 0x24, 0x20, 0x02, 0x07,
+	0x05, 0x00, 0x2f, 0x08, 0x20, 0x05, 0x0e, 0x0e, 0x0b, 0x03, 0x0a, 0x34,
+	0x05, 0x05, 0x04, 0x4d, 0x22, 0x0b, 0x11, 0x1a, 0x04, 0x05, 0x1d, 0x15,
+	0x02, 0x09, 0x09, 0x0c, 0x1a, 0x1a, 0x00, 0x05, 0x00, 0x00, 0x00, 0x1c,
+	0x0c, 0x0b, 0x06, 0x1f, 0x03, 0x00, 0x13, 0x06, 0x33, 0x0b, 0x0b, 0xff,
+	0x18, 0x02, 0x04, 0x0f, 0x11, 0x08, 0x11, 0x0c, 0x04, 0x05, 0x0d, 0x08,
+	0x10, 0x03, 0x0d, 0x0e, 0x02, 0x18, 0x09, 0x0a, 0x2c, 0x04, 0x22, 0x01,
+	0x0e, 0x04, 0x02, 0x27, 0x01, 0x1a, 0x09, 0x05, 0x00, 0x01, 0x08, 0x23,
+	0x31, 0x27, 0x07, 0x0f, 0x0f, 0x12, 0x18, 0x18, 0x00, 0x05, 0x00, 0x00,
+	0x00, 0x13, 0x0f, 0x1c, 0x20, 0x04, 0x0f, 0x18, 0x0b, 0x02, 0x03, 0x18,
+	0x07, 0x10, 0x0c, 0x04, 0x05, 0x04, 0x02, 0x02, 0x07, 0x11, 0x03, 0x05,
+	0x02, 0x0b, 0x06, 0x03, 0x03, 0x01, 0x04, 0x06, 0x03, 0x24, 0x02, 0x23,
+	0x0f, 0x0f, 0x00, 0x2f, 0x07, 0x3b, 0x08, 0x11, 0x01, 0x10, 0x09, 0x05,
+	0x22, 0x13, 0x03, 0x20, 0x18, 0x05, 0x03, 0x12, 0x08, 0x13, 0x01, 0x04,
+	0x09, 0x03, 0x03, 0x03, 0x08, 0x12, 0x02, 0x1b, 0x02, 0x05, 0x05, 0x04,
+	0x14, 0x04, 0x05, 0x0d, 0x06, 0x06, 0x19, 0x9b, 0x00, 0x01, 0x15, 0x08,
+	0x1d, 0x18, 0x0e, 0x05, 0x06, 0x05, 0x0f, 0x03, 0x1d, 0x05, 0x04, 0x11,
+	0x0f, 0x16, 0x16, 0x00, 0x04, 0x00, 0x05, 0x13, 0x08, 0x03, 0x12, 0x02,
+	0x12, 0xff, 0x06, 0x0f, 0x00, 0x01, 0x12, 0x08, 0x0f, 0x0f, 0x10, 0x05,
+	0x17, 0x10, 0x00, 0x10, 0x50, 0x04, 0x0f, 0x15, 0x16, 0x0d, 0x04, 0x0c,
+	0x13, 0x13, 0x03, 0x03, 0x07, 0x13, 0x10, 0x04, 0x16, 0x03, 0x00, 0x21,
+	0x06, 0x11, 0x0a, 0x02, 0x08, 0x05, 0x16, 0x04, 0x0b, 0x0d, 0x03, 0x02,
+	0x1c, 0x07, 0x02, 0x0d, 0x0c, 0x03, 0x2f, 0x18, 0x08, 0x32, 0x04, 0x10,
+	0x06, 0x0d, 0x0d, 0x03, 0x03, 0x18, 0x05, 0x0f, 0x0f, 0x02, 0x12, 0x10,
+	0x0b, 0x12, 0x17, 0x09, 0x06, 0x11, 0x0c, 0x02, 0x22, 0x05, 0x05, 0x07,
+	0x0c, 0x09, 0x05, 0x17, 0x17, 0x03, 0x06, 0x1f, 0x09, 0x01, 0x0a, 0x08,
+	0x10, 0x0f, 0x05, 0x0b, 0x08, 0x04, 0x03, 0x11, 0x07, 0x13, 0x1b, 0x09,
+	0x0b, 0x0a, 0x00, 0x07, 0x10, 0x16, 0x04, 0x07, 0x17, 0x05, 0x0c, 0x0a,
+	0x02, 0x04, 0x0d, 0x08, 0x00, 0x07, 0x0a, 0x05, 0x09, 0xff, 0x07, 0x0e,
+	0x03, 0x02, 0x1b, 0x07, 0x07, 0x0a, 0x05, 0x03, 0x07, 0x04, 0x1c, 0x04,
+	0x0a, 0x0e, 0x00, 0x04, 0x02, 0x0b, 0x04, 0x17, 0x09, 0x02, 0x09, 0x09,
+	0x07, 0x13, 0x13, 0x0d, 0x09, 0x09, 0x2a, 0x01, 0x0a, 0x0b, 0x16, 0x0c,
+	0x0c, 0x0b, 0x20, 0x02, 0x1e, 0x0d, 0x00, 0x30, 0x03, 0x06, 0x14, 0x0b,
+	0x0c, 0x10, 0x05, 0x05, 0x1a, 0x0b, 0x02, 0x15, 0x11, 0x11, 0x06, 0x07,
+	0x05, 0x09, 0x0a, 0x13, 0x10, 0x0a, 0x03, 0x01, 0x12, 0x08, 0x06, 0x02,
+	0x0d, 0x08, 0x12, 0x01, 0x15, 0x05, 0x13, 0x08, 0x19, 0x05, 0x01, 0x04,
+	0x19, 0x0a, 0x02, 0x10, 0x0b, 0x0a, 0x10, 0x17, 0x09, 0x3b, 0x43, 0x48,
+	0x44, 0x3a, 0x03, 0x3e, 0x05, 0x01, 0x06, 0x1f, 0x08, 0x01, 0x0e, 0x11,
+	0x15, 0x05, 0x0d, 0x05, 0x02, 0x17, 0x03, 0x0e, 0x07, 0x04, 0x10, 0x15,
+	0x1c, 0x04, 0x19, 0x14, 0x0a, 0xf9, 0x07, 0x19, 0x03, 0x1b, 0x0a, 0x0b,
+	0x01, 0x0f, 0x1d, 0x07, 0x13, 0x0e, 0x10, 0x10, 0x07, 0x11, 0x0d, 0x00,
+	0x0c, 0x06, 0x17, 0x1f, 0x0a, 0x0f, 0x05, 0x24, 0x08, 0x04, 0x08, 0x08,
+	0x0b, 0x04, 0x04, 0x03, 0x12, 0x12, 0x04, 0x0c, 0x05, 0x14, 0x0a, 0x04,
+	0x0b, 0x1b, 0x0b, 0x0d, 0x07, 0x06, 0x03, 0x02, 0x13, 0x01, 0x1e, 0x0d,
+	0x10, 0x08, 0x0a, 0x0c, 0x0c, 0x22, 0x0d, 0x09, 0x0f, 0x0f, 0x0e, 0x0a,
+	0x1f, 0x0f, 0x10, 0x07, 0x0e, 0x05, 0x0d, 0x18, 0x10, 0x0a, 0x03, 0x0f,
+	0x01, 0x07, 0x17, 0x08, 0x0f, 0x03, 0x1e, 0x13, 0x0b, 0x03, 0x0e, 0x08,
+	0x10, 0x03, 0x13, 0x03, 0x07, 0x01, 0x06, 0x05, 0x05, 0x0b, 0x04, 0x10,
+	0x0a, 0x12, 0x06, 0x03, 0x06, 0x0f, 0x12, 0x04, 0x10, 0x04, 0x3a, 0x08,
+	0x05, 0x05, 0x09, 0x05, 0x0f, 0x01, 0x06, 0x02, 0x06, 0xff, 0x05, 0x09,
+	0x04, 0x15, 0x17, 0x0c, 0x06, 0x06, 0x1c, 0x19, 0x1f, 0x1f, 0x1f, 0x03,
+	0x1f, 0x05, 0x01, 0x1b, 0x07, 0x11, 0x15, 0x17, 0x03, 0x11, 0x14, 0x0d,
+	0x1b, 0x11, 0x1a, 0x14, 0x06, 0x07, 0x0a, 0x09, 0x30, 0x02, 0x0b, 0x1a,
+	0x0b, 0x05, 0x06, 0x0f, 0x10, 0x13, 0x13, 0x13, 0x03, 0x13, 0x05, 0x01,
+	0x06, 0x16, 0x0f, 0x02, 0x0d, 0x01, 0x1c, 0x0c, 0x10, 0x03, 0x01, 0x11,
+	0x02, 0x20, 0x04, 0x02, 0x08, 0x11, 0x12, 0x04, 0x02, 0x07, 0x02, 0x11,
+	0x06, 0x1d, 0x03, 0x05, 0x01, 0x1d, 0x0c, 0x19, 0x06, 0x1a, 0x1b, 0x05,
+	0x02, 0x0e, 0x10, 0x08, 0x01, 0x06, 0x08, 0x06, 0x0c, 0x0e, 0x1e, 0x01,
+	0x18, 0x01, 0x05, 0x0c, 0x1a, 0x03, 0x0e, 0x07, 0x0b, 0x05, 0x00, 0x04,
+	0x0f, 0x03, 0x05, 0x08, 0x02, 0x1c, 0x0c, 0x1e, 0x03, 0x02, 0x04, 0x0b,
+	0x06, 0x03, 0x0f, 0x0d, 0x02, 0xff, 0x05, 0x03, 0x11, 0x0f, 0x10, 0x09,
+	0x06, 0x04, 0x03, 0x03, 0x03, 0x11, 0x02, 0x06, 0x02, 0x0f, 0x03, 0x04,
+	0x0f, 0x0b, 0x02, 0x04, 0x03, 0x04, 0x08, 0x20, 0x12, 0x00, 0x31, 0x08,
+	0x08, 0x07, 0x02, 0x13, 0x08, 0x0d, 0x01, 0x0d, 0x03, 0x05, 0x05, 0x13,
+	0x07, 0x11, 0x08, 0x06, 0x06, 0x10, 0x0e, 0x0a, 0x07, 0x07, 0x16, 0x11,
+	0x10, 0x09, 0x05, 0x05, 0x15, 0x00, 0x0a, 0x0d, 0x0d, 0x05, 0x05, 0x03,
+	0x08, 0x07, 0x1f, 0x0b, 0x0e, 0x07, 0x09, 0x07, 0x0f, 0x07, 0x05, 0x0c,
+	0x0f, 0x03, 0x06, 0x0a, 0x07, 0x08, 0x04, 0x03, 0x02, 0x02, 0x0a, 0x0a,
+	0x03, 0x1a, 0x34, 0x49, 0x29, 0x00, 0x1d, 0x04, 0x01, 0x16, 0x02, 0x1e,
+	0x21, 0x21, 0x21, 0x03, 0x06, 0x05, 0x01, 0x0a, 0x10, 0x14, 0x02, 0x44,
+	0x0f, 0x10, 0x00, 0x1d, 0x05, 0x34, 0x44, 0x00, 0x18, 0x09, 0x17, 0x08,
+	0x1a, 0xff, 0x3b, 0x3a, 0x21, 0x1f, 0x20, 0x1c, 0x06, 0x0d, 0x0e, 0x03,
+	0x0f, 0x07, 0x0b, 0x03, 0x27, 0x0f, 0x0b, 0x46, 0x01, 0x00, 0x02, 0x02,
+	0x35, 0x02, 0x0c, 0x30, 0x2d, 0x08, 0x13, 0x0b, 0x12, 0x0d, 0x0c, 0x08,
+	0x45, 0x2a, 0x18, 0x22, 0x22, 0x22, 0x00, 0x03, 0x13, 0x26, 0x25, 0x24,
+	0x1a, 0x25, 0x06, 0x0e, 0x0f, 0x12, 0x26, 0x1c, 0x03, 0x04, 0x05, 0x05,
+	0x29, 0x02, 0x04, 0x0b, 0x2b, 0x20, 0x0d, 0x09, 0x06, 0x09, 0x2b, 0x0a,
+	0x03, 0x06, 0x06, 0x20, 0x06, 0x19, 0x0d, 0x11, 0x03, 0x06, 0x08, 0x07,
+	0x07, 0x15, 0x09, 0x04, 0x04, 0x10, 0x03, 0x10, 0x04, 0x0b, 0x03, 0x17,
+	0x09, 0x0a, 0x07, 0x05, 0x10, 0x05, 0x06, 0x03, 0x0d, 0x0a, 0x0c, 0x04,
+	0x31, 0x17, 0x30, 0x3f, 0x04, 0x28, 0x33, 0x5b, 0x04, 0x2c, 0x2b, 0x09,
+	0x1c, 0x10, 0x0d, 0x2f, 0x0b, 0x03, 0x03, 0x15, 0x14, 0xff, 0x1c, 0x15,
+	0x14, 0x07, 0x17, 0x06, 0x03, 0x03, 0x01, 0x15, 0x08, 0x15, 0x04, 0x05,
+	0x06, 0x02, 0x0b, 0x0b, 0x0b, 0x01, 0x03, 0x06, 0x03, 0x06, 0x09, 0x0a,
+	0x07, 0x06, 0x17, 0x0a, 0x02, 0x09, 0x01, 0x1d, 0x0c, 0x0c, 0x00, 0x08,
+	0x09, 0x05, 0x0f, 0x2d, 0x2f, 0x43, 0x16, 0x05, 0x18, 0x1a, 0x17, 0x53,
+	0x4d, 0x1a, 0x47, 0x1f, 0x08, 0x33, 0x1f, 0x25, 0x06, 0x34, 0x09, 0x10,
+	0x0b, 0x20, 0x12, 0x2a, 0x21, 0x04, 0x2b, 0x20, 0x18, 0x1d, 0x1f, 0x1f,
+	0x02, 0x27, 0x13, 0x17, 0x29, 0x13, 0x00, 0x03, 0x28, 0x07, 0x0a, 0x25,
+	0x04, 0x23, 0x01, 0x03, 0x03, 0x04, 0x20, 0x0c, 0x05, 0x03, 0x0c, 0x25,
+	0x07, 0x06, 0x23, 0x28, 0x03, 0x06, 0x26, 0x07, 0x08, 0x26, 0x0c, 0x0a,
+	0x12, 0x0c, 0x05, 0x07, 0x07, 0x02, 0x14, 0x14, 0x0c, 0x28, 0x0e, 0x0a,
+	0x0d, 0x29, 0x0c, 0x46, 0x28, 0xdd, 0x12, 0x0c, 0x3e, 0x20, 0x11, 0x00,
+	0x09, 0x14, 0x01, 0x12, 0x12, 0x07, 0x02, 0x08, 0x1b, 0x0e, 0x0f, 0x15,
+	0x09, 0x05, 0x15, 0x13, 0x03, 0x0b, 0x09, 0x0b, 0x0b, 0x17, 0x03, 0x0a,
+	0x14, 0x0e, 0x05, 0x0a, 0x03, 0x0d, 0x06, 0x04, 0x07, 0x02, 0x0c, 0x39,
+	0x25, 0x05, 0x06, 0x0a, 0x0f, 0x0e, 0x07, 0x0b, 0x0f, 0x03, 0x0f, 0x0b,
+	0x0f, 0x0a, 0x08, 0x15, 0x05, 0x04, 0x1d, 0x05, 0x04, 0x0c, 0x34, 0x02,
+	0x0a, 0x07, 0x0b, 0x11, 0x00, 0x38, 0x08, 0x04, 0x0a, 0x0d, 0x08, 0x0e,
+	0x01, 0x0b, 0x03, 0x05, 0x05, 0x0c, 0x07, 0x2d, 0x0f, 0x09, 0x15, 0x30,
+	0x0e, 0x14, 0x0a, 0x01, 0x0a, 0xff, 0x05, 0x01, 0x10, 0x0a, 0x08, 0x11,
+	0x0b, 0x0f, 0x0f, 0x00, 0x0b, 0x06, 0x0b, 0x09, 0x25, 0x1a, 0x29, 0x1f,
+	0x03, 0x04, 0x12, 0x07, 0x0b, 0x03, 0x0f, 0x01, 0x2c, 0x22, 0x48, 0x30,
+	0x26, 0x0b, 0x59, 0x07, 0x14, 0x09, 0x15, 0x26, 0x13, 0x13, 0x15, 0x2a,
+	0x0f, 0x01, 0x3f, 0x2a, 0x0b, 0x2d, 0x09, 0x07, 0x03, 0x09, 0x09, 0x19,
+	0x1e, 0x15, 0x22, 0x0e, 0x03, 0x06, 0x17, 0x07, 0x08, 0x21, 0x03, 0x00,
+	0x1f, 0x0a, 0x20, 0x04, 0x07, 0x04, 0x0c, 0x07, 0x2c, 0x42, 0x20, 0x3f,
+	0x04, 0x16, 0x1b, 0x1b, 0x2f, 0x32, 0x17, 0x32, 0x29, 0x08, 0x25, 0x32,
+	0x24, 0x06, 0x2d, 0x09, 0x27, 0x0b, 0x09, 0x09, 0x38, 0x01, 0x10, 0x10,
+	0x02, 0x49, 0x03, 0x03, 0x06, 0x04, 0x27, 0x35, 0x0c, 0x04, 0x25, 0x16,
+	0x06, 0x26, 0x1f, 0x30, 0x03, 0x22, 0x04, 0x04, 0x03, 0x2f, 0x1c, 0x02,
+	0x24, 0xd4, 0x22, 0x03, 0x08, 0x04, 0x20, 0x07, 0x05, 0x24, 0x06, 0x09,
+	0x07, 0x07, 0x24, 0x2c, 0x25, 0x21, 0x1e, 0x13, 0x06, 0x06, 0x26, 0x02,
+	0x1c, 0x19, 0x36, 0x18, 0x29, 0x05, 0x09, 0x10, 0x02, 0x26, 0x07, 0x1c,
+	0x13, 0x04, 0x05, 0x29, 0x14, 0x03, 0x0e, 0x17, 0x05, 0x2e, 0x02, 0x02,
+	0x04, 0x19, 0x03, 0x15, 0x00, 0x07, 0x12, 0x05, 0x17, 0x07, 0x02, 0x25,
+	0x10, 0x25, 0x16, 0x25, 0x25, 0x18, 0x21, 0x08, 0x0f, 0x30, 0x0b, 0x0e,
+	0x14, 0x05, 0x10, 0x13, 0x11, 0x03, 0x1b, 0x0a, 0x0c, 0x28, 0x0f, 0x28,
+	0x06, 0x0e, 0x02, 0x0e, 0xff, 0x05, 0x31, 0x22, 0x05, 0x19, 0x20, 0x02,
+	0x02, 0x07, 0x06, 0x12, 0x12, 0x2c, 0x00, 0x01, 0x09, 0x09, 0x23, 0x31,
+	0x07, 0x2a, 0x01, 0x06, 0x16, 0x02, 0x2f, 0x03, 0x03, 0x0b, 0x04, 0x11,
+	0x11, 0x0f, 0x04, 0x11, 0x23, 0x06, 0x14, 0x12, 0x0f, 0x05, 0x04, 0x0c,
+	0x07, 0x1e, 0x10, 0x05, 0x05, 0x20, 0x04, 0x0e, 0x0c, 0x09, 0x03, 0x13,
+	0x06, 0x0a, 0x03, 0x05, 0x27, 0x0c, 0x0c, 0x0b, 0x07, 0x04, 0x06, 0x0c,
+	0x03, 0x10, 0x06, 0x02, 0x16, 0x02, 0x04, 0x06, 0x12, 0x27, 0x04, 0x01,
+	0x06, 0x32, 0x17, 0x0c, 0x10, 0x08, 0x02, 0x05, 0x12, 0x11, 0x0e, 0x05,
+	0x0a, 0x0f, 0x06, 0x04, 0x01, 0x07, 0x04, 0x03, 0x34, 0x16, 0x05, 0x11,
+	0x24, 0x15, 0x10, 0x08, 0x12, 0x06, 0x12, 0x02, 0x02, 0x14, 0x0c, 0x05,
+	0x03, 0x01, 0x04, 0x0e, 0x06, 0x07, 0x04, 0x08, 0x2e, 0x07, 0x04, 0x04,
+	0xff, 0x06, 0x06, 0x03, 0x12, 0x08, 0x1a, 0x07, 0x03, 0x11, 0x02, 0x01,
+	0x02, 0x17, 0x14, 0x14, 0x0b, 0x31, 0x1a, 0x19, 0x1a, 0x12, 0x09, 0x0a,
+	0x0b, 0x22, 0x28, 0x27, 0x23, 0x03, 0x04, 0x06, 0x06, 0x02, 0x31, 0x12,
+	0x14, 0x1e, 0x02, 0x04, 0x1e, 0x06, 0x02, 0x2d, 0x26, 0x36, 0x4f, 0x4b,
+	0x2e, 0x11, 0x2e, 0x07, 0x16, 0x16, 0x00, 0x4f, 0x0b, 0x13, 0x07, 0x31,
+	0x31, 0x09, 0x31, 0x2e, 0x2e, 0x1c, 0x0b, 0x00, 0x01, 0x1c, 0x1e, 0x0c,
+	0x24, 0x1a, 0x24, 0x04, 0x04, 0x1d, 0x19, 0x02, 0x22, 0x22, 0x1c, 0x09,
+	0x07, 0x08, 0x06, 0x28, 0x1e, 0x03, 0x04, 0x27, 0x05, 0x28, 0x0e, 0x04,
+	0x03, 0x37, 0x07, 0x0b, 0x0e, 0x0b, 0x06, 0x04, 0x0e, 0x02, 0x29, 0x08,
+	0x23, 0x0a, 0x08, 0x08, 0x02, 0x04, 0x03, 0x07, 0x02, 0x07, 0x2f, 0x00,
+	0x01, 0x06, 0x0c, 0x06, 0x2d, 0x04, 0x0c, 0x2d, 0xff, 0x08, 0x06, 0x0a,
+	0x05, 0x03, 0x13, 0x12, 0x2d, 0x08, 0x0a, 0x0b, 0x17, 0x14, 0x16, 0x2c,
+	0x17, 0x06, 0x15, 0x15, 0x0d, 0x07, 0x07, 0x02, 0x15, 0x10, 0x08, 0x11,
+	0x04, 0x01, 0x03, 0x05, 0x0f, 0x04, 0x06, 0x0a, 0x0e, 0x07, 0x22, 0x0e,
+	0x00, 0x36, 0x29, 0x29, 0x33, 0x00, 0x34, 0x40, 0x0c, 0x0f, 0x0a, 0x00,
+	0x17, 0x1c, 0x05, 0x3d, 0x00, 0x1a, 0x17, 0x0f, 0x12, 0x12, 0x2e, 0x01,
+	0x09, 0x06, 0x17, 0x03, 0x17, 0x07, 0x17, 0x20, 0x32, 0x0c, 0x0b, 0x07,
+	0x0b, 0x01, 0x03, 0x15, 0x0b, 0x1b, 0x0d, 0x02, 0x19, 0x52, 0x31, 0x40,
+	0x02, 0x53, 0x41, 0x02, 0x54, 0x4a, 0x1e, 0x0e, 0x26, 0x05, 0x09, 0x09,
+	0x02, 0x09, 0x09, 0x02, 0x09, 0x09, 0x1f, 0x1c, 0x16, 0x16, 0x0f, 0x01,
+	0x07, 0x0b, 0x0b, 0x02, 0x0b, 0x0b, 0x02, 0x0b, 0x0b, 0x0b, 0x43, 0x27,
+	0x13, 0x1a, 0x1c, 0x1e, 0xff, 0x19, 0x14, 0x23, 0x23, 0x2e, 0x1b, 0x13,
+	0x24, 0x22, 0x24, 0x24, 0x1b, 0x00, 0x1f, 0x0d, 0x05, 0x20, 0x00, 0x1c,
+	0x10, 0x23, 0x22, 0x11, 0x12, 0x01, 0x09, 0x06, 0x24, 0x03, 0x14, 0x07,
+	0x20, 0x20, 0x24, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x15, 0x25, 0x0e,
+	0x41, 0x26, 0x0f, 0x03, 0x0a, 0x13, 0x14, 0x37, 0x05, 0x05, 0x29, 0x10,
+	0x13, 0x0e, 0x04, 0x09, 0x1c, 0x1c, 0x2f, 0x3d, 0x2e, 0x1c, 0x40, 0x1a,
+	0x17, 0x0f, 0x1e, 0x1d, 0x06, 0x13, 0x14, 0x00, 0x1d, 0x1e, 0x05, 0x1b,
+	0x00, 0x1c, 0x00, 0x00, 0x1e, 0x13, 0x14, 0x1c, 0x03, 0x18, 0x1e, 0x05,
+	0x07, 0x09, 0x04, 0x2f, 0x0c, 0x0a, 0x12, 0x08, 0x11, 0x08, 0x22, 0x04,
+	0x13, 0x04, 0x04, 0x19, 0x19, 0x36, 0x16, 0x13, 0x16, 0x16, 0x0e, 0x00,
+	0x16, 0x12, 0x05, 0x0a, 0x00, 0x0b, 0x16, 0x15, 0x12, 0x1b, 0x10, 0x01,
+	0xf8, 0x09, 0x06, 0x1c, 0x03, 0x12, 0x07, 0x16, 0x15, 0x17, 0x0c, 0x0b,
+	0x07, 0x0b, 0x01, 0x03, 0x13, 0x1e, 0x3d, 0x0e, 0x09, 0x0a, 0x0a, 0x02,
+	0x0c, 0x18, 0x00, 0x0a, 0x10, 0x05, 0x09, 0x20, 0x06, 0x04, 0x04, 0x1b,
+	0x03, 0x02, 0x12, 0x3d, 0x1b, 0x1b, 0x10, 0x2a, 0x00, 0x1c, 0x18, 0x1c,
+	0x1c, 0x1c, 0x00, 0x15, 0x1c, 0x05, 0x18, 0x00, 0x0d, 0x11, 0x1b, 0x1b,
+	0x16, 0x1b, 0x01, 0x09, 0x06, 0x1c, 0x03, 0x15, 0x07, 0x1b, 0x1b, 0x17,
+	0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x14, 0x14, 0x00, 0x16, 0x16, 0x37,
+	0x3f, 0x35, 0x36, 0x1a, 0x16, 0x1a, 0x1a, 0x1a, 0x00, 0x18, 0x1a, 0x05,
+	0x0f, 0x00, 0x19, 0x1a, 0x18, 0x15, 0x14, 0x15, 0x01, 0x09, 0x06, 0x1a,
+	0x03, 0x1a, 0x07, 0x1a, 0x1a, 0x1a, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03,
+	0x16, 0x01, 0x16, 0xff, 0x1e, 0x20, 0x33, 0x0f, 0x0d, 0x0a, 0x02, 0x36,
+	0x21, 0x13, 0x20, 0x1e, 0x1e, 0x28, 0x23, 0x19, 0x20, 0x1c, 0x20, 0x20,
+	0x20, 0x00, 0x05, 0x20, 0x05, 0x19, 0x00, 0x0d, 0x20, 0x1f, 0x1d, 0x14,
+	0x1d, 0x01, 0x09, 0x06, 0x20, 0x03, 0x16, 0x07, 0x20, 0x18, 0x20, 0x0c,
+	0x0b, 0x07, 0x0b, 0x01, 0x03, 0x22, 0x14, 0x0d, 0x1d, 0x1d, 0x26, 0x11,
+	0x08, 0x42, 0x1c, 0x1c, 0x1c, 0x14, 0x05, 0x1c, 0x19, 0x02, 0x14, 0x09,
+	0x16, 0x15, 0x2e, 0x1c, 0x08, 0x06, 0x12, 0x12, 0x06, 0x19, 0x1b, 0x00,
+	0x0b, 0x06, 0x0b, 0x1d, 0x1c, 0x0b, 0x1d, 0x0f, 0x00, 0x0b, 0x09, 0x05,
+	0x19, 0x00, 0x0b, 0x09, 0x1d, 0x1c, 0x0d, 0x1c, 0x01, 0x09, 0x06, 0x14,
+	0x03, 0x14, 0x07, 0x10, 0x11, 0x1d, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03,
+	0x3f, 0x02, 0x15, 0x11, 0x02, 0x09, 0x0f, 0x0c, 0x0b, 0x16, 0x1d, 0xff,
+	0x08, 0x06, 0x0f, 0x10, 0x06, 0x19, 0x19, 0x1e, 0x3b, 0x0f, 0x2f, 0x03,
+	0x1b, 0x18, 0x1b, 0x1b, 0x14, 0x00, 0x1a, 0x1b, 0x05, 0x17, 0x00, 0x0f,
+	0x16, 0x1b, 0x1a, 0x19, 0x1a, 0x01, 0x09, 0x06, 0x15, 0x03, 0x1a, 0x07,
+	0x17, 0x17, 0x1b, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x13, 0x07, 0x0a,
+	0x0b, 0x19, 0x19, 0x19, 0x26, 0x27, 0x3a, 0x19, 0x15, 0x19, 0x19, 0x19,
+	0x00, 0x17, 0x19, 0x05, 0x11, 0x00, 0x0e, 0x19, 0x18, 0x16, 0x15, 0x16,
+	0x01, 0x09, 0x06, 0x14, 0x03, 0x19, 0x07, 0x16, 0x19, 0x19, 0x0c, 0x0b,
+	0x07, 0x0b, 0x01, 0x03, 0x15, 0x0c, 0x00, 0x24, 0x04, 0x19, 0x0c, 0x12,
+	0x03, 0x0c, 0x10, 0x1e, 0x08, 0x0e, 0x04, 0x0e, 0x02, 0x08, 0x20, 0x00,
+	0x08, 0x08, 0x05, 0x08, 0x03, 0x03, 0x09, 0x12, 0x08, 0x2b, 0x09, 0x0c,
+	0x04, 0x1c, 0x1c, 0x05, 0x0e, 0x2b, 0x09, 0x95, 0x07, 0x1b, 0x18, 0x1b,
+	0x1b, 0x05, 0x00, 0x07, 0x04, 0x16, 0x00, 0x18, 0x00, 0x00, 0x19, 0x09,
+	0x05, 0x17, 0x0b, 0x1b, 0x03, 0x01, 0x03, 0xb7, 0x05, 0x05, 0x18, 0x18,
+	0x09, 0x14, 0x13, 0x11, 0x01, 0x02, 0x01, 0x15, 0x07, 0x02, 0x05, 0x02,
+	0x09, 0x0f, 0x1b, 0x17, 0x0b, 0x06, 0x0a, 0x0f, 0x0e, 0x07, 0x09, 0x05,
+	0x16, 0x16, 0x07, 0x19, 0x0d, 0x07, 0x07, 0x17, 0x15, 0x17, 0x17, 0x05,
+	0x00, 0x0d, 0x04, 0x0c, 0x00, 0x17, 0x00, 0x00, 0x16, 0x09, 0x05, 0x17,
+	0x10, 0x14, 0x03, 0x01, 0x03, 0xec, 0x05, 0x05, 0x12, 0x17, 0x09, 0x17,
+	0x10, 0x12, 0x01, 0x02, 0x01, 0x17, 0x07, 0x02, 0x05, 0x02, 0x09, 0x0f,
+	0x17, 0x17, 0x0b, 0x06, 0x0a, 0x15, 0x09, 0x07, 0x09, 0x05, 0x17, 0x17,
+	0x2d, 0x21, 0x21, 0x41, 0x27, 0x2f, 0x1d, 0x1b, 0x1d, 0x1d, 0x0e, 0x00,
+	0x1c, 0x16, 0x05, 0x0f, 0x00, 0x11, 0x17, 0x1a, 0x13, 0x07, 0x00, 0x19,
+	0x05, 0x16, 0x01, 0x02, 0x01, 0x06, 0x05, 0x02, 0x06, 0x02, 0x17, 0x1a,
+	0x09, 0x1d, 0x01, 0x04, 0x01, 0x06, 0x08, 0x00, 0x06, 0x01, 0x03, 0x1e,
+	0x0d, 0x00, 0x05, 0x04, 0x0e, 0x19, 0x19, 0x17, 0x25, 0x4e, 0x16, 0x14,
+	0x16, 0x16, 0x09, 0x00, 0x16, 0x04, 0x0f, 0x00, 0x12, 0x00, 0x00, 0x14,
+	0x13, 0x05, 0x20, 0x20, 0x13, 0x03, 0x01, 0x03, 0xa6, 0x05, 0x05, 0x15,
+	0x16, 0x09, 0x14, 0x15, 0x18, 0x01, 0x02, 0x01, 0x18, 0x07, 0x02, 0x05,
+	0x02, 0x09, 0x0f, 0x20, 0x20, 0x0b, 0x06, 0x17, 0x17, 0x17, 0x03, 0x19,
+	0x19, 0x10, 0x1a, 0x09, 0x0f, 0x12, 0x0f, 0x1a, 0x18, 0x1a, 0x08, 0x03,
+	0x08, 0x8e, 0x0a, 0x0a, 0x12, 0x1a, 0x15, 0x08, 0x08, 0x23, 0x09, 0x09,
+	0x0e, 0x0e, 0x0e, 0x0a, 0x05, 0x0a, 0x83, 0x0c, 0x0c, 0x09, 0x04, 0x09,
+	0x87, 0x05, 0x0c, 0x0c, 0x0c, 0x09, 0x04, 0x09, 0x02, 0x09, 0xaa, 0x05,
+	0x0b, 0x0b, 0x25, 0x12, 0x35, 0x26, 0x40, 0x10, 0x10, 0x10, 0x0a, 0x19,
+	0x00, 0x1e, 0x12, 0x05, 0x16, 0x00, 0x1b, 0x12, 0x11, 0x1f, 0x14, 0x14,
+	0x01, 0x09, 0x06, 0x1c, 0x03, 0x18, 0x07, 0x1c, 0x18, 0x25, 0x0c, 0x0b,
+	0x07, 0x0b, 0x01, 0x03, 0x17, 0x02, 0x17, 0x92, 0x19, 0x19, 0x15, 0x17,
+	0x0e, 0x0b, 0x15, 0x0d, 0x11, 0x05, 0x15, 0x00, 0x19, 0x17, 0x19, 0x0a,
+	0x05, 0x0a, 0x02, 0x0a, 0xc6, 0x05, 0x0a, 0x00, 0x0c, 0x0c, 0x20, 0x36,
+	0x0b, 0x00, 0x07, 0x1c, 0x07, 0x00, 0x0f, 0x0f, 0x0f, 0x08, 0x08, 0x08,
+	0x00, 0x08, 0x08, 0x08, 0x00, 0x0a, 0x0a, 0x02, 0x18, 0x00, 0x08, 0x06,
+	0x06, 0x0b, 0x0b, 0x0b, 0x07, 0x07, 0x00, 0x07, 0x07, 0x07, 0x09, 0x09,
+	0x1d, 0x1c, 0x01, 0x0c, 0x02, 0x1d, 0x0d, 0x0d, 0x0d, 0x00, 0x0f, 0x04,
+	0x00, 0x0e, 0x04, 0x19, 0x00, 0x1a, 0x00, 0x00, 0x0e, 0x0e, 0x05, 0x0f,
+	0x21, 0x0d, 0x03, 0x01, 0x03, 0xbb, 0x05, 0x05, 0x11, 0x0f, 0x09, 0x16,
+	0x10, 0x21, 0x01, 0x02, 0x01, 0x16, 0x07, 0x02, 0x05, 0x02, 0x09, 0x0f,
+	0x06, 0x17, 0x07, 0x1d, 0x07, 0x0a, 0x09, 0x01, 0x08, 0x02, 0x08, 0x04,
+	0x16, 0x16, 0x06, 0x05, 0x01, 0x00, 0x0d, 0x2f, 0x03, 0x17, 0x15, 0x17,
+	0x17, 0x0b, 0x00, 0x16, 0x04, 0x0c, 0x00, 0x17, 0x00, 0x00, 0x15, 0x14,
+	0x05, 0x17, 0x17, 0x12, 0x03, 0x01, 0x03, 0xbb, 0x05, 0x05, 0x0f, 0x10,
+	0x09, 0x16, 0x10, 0x17, 0x01, 0x02, 0x01, 0x16, 0x07, 0x02, 0x05, 0x02,
+	0x09, 0x0f, 0x06, 0x17, 0x07, 0x17, 0x07, 0x0a, 0x09, 0x01, 0x00, 0x0b,
+	0x15, 0x03, 0x04, 0x17, 0x17, 0x06, 0x04, 0x01, 0x0d, 0x01, 0x12, 0x17,
+	0x15, 0x17, 0x17, 0x11, 0x00, 0x05, 0x04, 0x0b, 0x00, 0x17, 0x00, 0x00,
+	0x15, 0x0a, 0x05, 0x17, 0x17, 0x16, 0x03, 0x01, 0x03, 0xba, 0x05, 0x05,
+	0x12, 0x0e, 0x09, 0x16, 0x10, 0x17, 0x01, 0x02, 0x01, 0x16, 0x07, 0x02,
+	0x05, 0x02, 0x09, 0x0f, 0x06, 0x17, 0x07, 0x17, 0x07, 0x0a, 0x09, 0x01,
+	0x09, 0x01, 0x0f, 0x04, 0x16, 0x16, 0x04, 0x06, 0x01, 0x06, 0x14, 0x0b,
+	0x16, 0x15, 0x16, 0x04, 0x0f, 0x00, 0x0c, 0x04, 0x0c, 0x00, 0x16, 0x00,
+	0x00, 0x14, 0x0a, 0x05, 0x16, 0x16, 0x14, 0x03, 0x01, 0x03, 0xff, 0x05,
+	0x05, 0x16, 0x0f, 0x09, 0x0f, 0x10, 0x16, 0x01, 0x02, 0x01, 0x15, 0x07,
+	0x02, 0x05, 0x02, 0x09, 0x0f, 0x06, 0x16, 0x07, 0x16, 0x07, 0x0a, 0x09,
+	0x01, 0x09, 0x12, 0x08, 0x05, 0x16, 0x16, 0x12, 0x04, 0x08, 0x1f, 0x20,
+	0x18, 0x17, 0x18, 0x0b, 0x11, 0x00, 0x09, 0x12, 0x05, 0x0d, 0x00, 0x03,
+	0x16, 0x2f, 0x05, 0x17, 0x17, 0x05, 0x0e, 0x15, 0x15, 0x11, 0x05, 0x09,
+	0x06, 0x07, 0x03, 0x04, 0x05, 0x0a, 0x03, 0x07, 0x18, 0x17, 0x02, 0x0a,
+	0x09, 0x0a, 0x0c, 0x0c, 0x09, 0x32, 0x50, 0x01, 0x00, 0x00, 0x43, 0x01,
+	0x51, 0x01, 0x00, 0x04, 0x1c, 0x08, 0x0b, 0x1b, 0x14, 0x0e, 0x10, 0x04,
+	0x0c, 0x08, 0x0e, 0x12, 0x10, 0x19, 0x19, 0x15, 0x17, 0x0c, 0x1c, 0x16,
+	0x1c, 0x1c, 0x0d, 0x05, 0x0b, 0x05, 0x0b, 0x0e, 0x1c, 0x1b, 0x1c, 0x0c,
+	0x08, 0x00, 0x10, 0x04, 0x11, 0x00, 0x8a, 0x1d, 0x00, 0x00, 0x10, 0x15,
+	0x05, 0x0c, 0x16, 0x0f, 0x03, 0x01, 0x03, 0xba, 0x05, 0x05, 0x15, 0x13,
+	0x09, 0x11, 0x11, 0x17, 0x01, 0x02, 0x01, 0x12, 0x07, 0x02, 0x05, 0x02,
+	0x09, 0x0f, 0x06, 0x17, 0x07, 0x1d, 0x07, 0x06, 0x06, 0x06, 0x0e, 0x09,
+	0x07, 0x06, 0x16, 0x16, 0x18, 0x09, 0x00, 0x06, 0x08, 0x09, 0x17, 0x15,
+	0x17, 0x17, 0x04, 0x00, 0x16, 0x04, 0x0c, 0x00, 0x17, 0x00, 0x00, 0x16,
+	0x13, 0x05, 0x11, 0x17, 0x0e, 0x03, 0x01, 0x03, 0x9b, 0x05, 0x05, 0x17,
+	0x17, 0x09, 0x0f, 0x10, 0x17, 0x01, 0x02, 0x01, 0x15, 0x07, 0x02, 0x05,
+	0x02, 0x13, 0x0a, 0x00, 0x04, 0x06, 0x10, 0x06, 0x05, 0x05, 0x00, 0x05,
+	0x01, 0x05, 0xff, 0x15, 0x15, 0x04, 0x05, 0x00, 0x09, 0x06, 0x03, 0x08,
+	0x03, 0x03, 0x15, 0x13, 0x15, 0x15, 0x04, 0x00, 0x14, 0x0d, 0x05, 0x0d,
+	0x00, 0x0b, 0x09, 0x12, 0x15, 0x17, 0x20, 0x01, 0x09, 0x06, 0x19, 0x03,
+	0x0f, 0x07, 0x16, 0x11, 0x19, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x38,
+	0x0b, 0x00, 0x0d, 0x10, 0x09, 0x0c, 0x03, 0x16, 0x31, 0x2f, 0x34, 0x03,
+	0x0f, 0x1b, 0x13, 0x1c, 0x0b, 0x0f, 0x0a, 0x12, 0x33, 0x1c, 0x1c, 0x06,
+	0x1a, 0x11, 0x12, 0x12, 0x18, 0x1b, 0x1b, 0x03, 0x1d, 0x05, 0x1d, 0x1d,
+	0x06, 0x09, 0x0a, 0x00, 0x12, 0x09, 0x05, 0x1a, 0x00, 0x08, 0x11, 0x1d,
+	0x1d, 0x14, 0x1d, 0x01, 0x09, 0x06, 0x10, 0x03, 0x10, 0x07, 0x18, 0x12,
+	0x16, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x36, 0x11, 0x07, 0x0c, 0x0b,
+	0x0c, 0x1c, 0x11, 0x03, 0x15, 0x05, 0x13, 0x1d, 0x18, 0x18, 0xc9, 0x2c,
+	0x29, 0x39, 0x2e, 0x1c, 0x1b, 0x1c, 0x12, 0x0b, 0x00, 0x1b, 0x10, 0x05,
+	0x15, 0x00, 0x0f, 0x1c, 0x1c, 0x20, 0x07, 0x00, 0x17, 0x05, 0x14, 0x01,
+	0x02, 0x01, 0x06, 0x05, 0x02, 0x06, 0x02, 0x1d, 0x20, 0x09, 0x1d, 0x01,
+	0x04, 0x01, 0x1c, 0x05, 0x17, 0x17, 0x0d, 0x19, 0x0d, 0x11, 0x13, 0x3e,
+	0x15, 0x13, 0x03, 0x15, 0x05, 0x00, 0x08, 0x04, 0x0d, 0x00, 0x0f, 0x00,
+	0x00, 0x11, 0x14, 0x0c, 0x49, 0x16, 0x04, 0x11, 0x0f, 0x20, 0x09, 0x08,
+	0x01, 0x08, 0x8e, 0x04, 0x14, 0x08, 0x15, 0x0d, 0x0a, 0x16, 0x07, 0x00,
+	0x16, 0x06, 0x17, 0x3b, 0x0d, 0x01, 0x0d, 0xff, 0x0b, 0x03, 0x0b, 0x12,
+	0x16, 0x05, 0x18, 0x18, 0x0f, 0x10, 0x2b, 0x02, 0x20, 0x00, 0x01, 0x01,
+	0x1a, 0x18, 0x1a, 0x1a, 0x0c, 0x00, 0x0f, 0x16, 0x05, 0x0d, 0x00, 0x09,
+	0x14, 0x19, 0x1a, 0x18, 0x22, 0x01, 0x09, 0x06, 0x0e, 0x03, 0x15, 0x07,
+	0x19, 0x16, 0x1b, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x1c, 0x15, 0x15,
+	0x0d, 0x0d, 0x00, 0x01, 0x01, 0x21, 0x12, 0x21, 0x01, 0x14, 0x05, 0x07,
+	0x19, 0x19, 0x02, 0x24, 0x06, 0x27, 0x1b, 0x19, 0x1b, 0x1b, 0x0b, 0x00,
+	0x1a, 0x07, 0x05, 0x12, 0x00, 0x15, 0x00, 0x00, 0x19, 0x0c, 0x0c, 0x06,
+	0x0c, 0x1f, 0x01, 0x16, 0x15, 0x20, 0x08, 0x1b, 0x1b, 0x1b, 0x0d, 0x19,
+	0x04, 0x0e, 0x1d, 0x0b, 0x03, 0x1d, 0x05, 0x09, 0x14, 0x14, 0x12, 0x07,
+	0x18, 0x18, 0x0f, 0x0a, 0x0f, 0x01, 0x14, 0x08, 0x12, 0x0e, 0x19, 0x15,
+	0x19, 0x17, 0x19, 0xff, 0x10, 0x08, 0x00, 0x19, 0x06, 0x05, 0x16, 0x00,
+	0x08, 0x09, 0x13, 0x16, 0x0c, 0x1d, 0x01, 0x09, 0x06, 0x16, 0x03, 0x17,
+	0x07, 0x11, 0x12, 0x18, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x38, 0x07,
+	0x07, 0x01, 0x14, 0x11, 0x06, 0x0f, 0x0e, 0x17, 0x17, 0x30, 0x34, 0x35,
+	0x25, 0x22, 0x46, 0x1b, 0x1f, 0x17, 0x1e, 0x1d, 0x0f, 0x0f, 0x0f, 0x1e,
+	0x1d, 0x09, 0x06, 0x12, 0x00, 0x1d, 0x1e, 0x05, 0x19, 0x00, 0x1c, 0x0b,
+	0x06, 0x07, 0x17, 0x20, 0x1e, 0x0f, 0x1a, 0x12, 0x0a, 0x07, 0x03, 0x1e,
+	0x11, 0x1c, 0x51, 0x06, 0x10, 0x0c, 0x0c, 0x21, 0x07, 0x26, 0x1f, 0x1f,
+	0x3d, 0x0d, 0x33, 0x06, 0x25, 0x2c, 0x04, 0x02, 0x2c, 0x10, 0x03, 0x1d,
+	0x17, 0x1d, 0x1b, 0x1d, 0x17, 0x04, 0x00, 0x1d, 0x15, 0x05, 0x16, 0x00,
+	0x0e, 0x09, 0x1b, 0x19, 0x1c, 0x26, 0x01, 0x09, 0x06, 0x27, 0x03, 0xff,
+	0x20, 0x07, 0x10, 0x11, 0x20, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x17,
+	0x07, 0x17, 0x0c, 0x16, 0x12, 0x04, 0x02, 0x2b, 0x0c, 0x03, 0x11, 0x05,
+	0x2a, 0x01, 0x04, 0x10, 0x04, 0x14, 0x07, 0x07, 0x05, 0x21, 0x1c, 0x1c,
+	0x24, 0x1f, 0x12, 0x0b, 0x0a, 0x0e, 0x38, 0x03, 0x09, 0x00, 0x01, 0x1d,
+	0x1b, 0x1d, 0x1d, 0x12, 0x00, 0x1d, 0x0a, 0x05, 0x18, 0x00, 0x16, 0x15,
+	0x1c, 0x1b, 0x10, 0x1b, 0x01, 0x09, 0x06, 0x1d, 0x03, 0x0f, 0x07, 0x18,
+	0x18, 0x1d, 0x0c, 0x0b, 0x07, 0x0b, 0x01, 0x03, 0x17, 0x17, 0x03, 0x0a,
+	0x10, 0x1b, 0x09, 0x03, 0x16, 0x00, 0x01, 0x03, 0x24, 0x0d, 0x0f, 0x08,
+	0x12, 0x08, 0x1b, 0x1b, 0x26, 0x42, 0x54, 0x1c, 0x19, 0x1c, 0x1c, 0x1c,
+	0x00, 0x1c, 0x14, 0x05, 0x17, 0x00, 0x1c, 0x0f, 0x1c, 0x1b, 0x12, 0x1b,
+	0x01, 0x09, 0x06, 0x14, 0x03, 0x18, 0x07, 0xff, 0x16, 0x1c, 0x17, 0x0c,
+	0x0b, 0x07, 0x0b, 0x01, 0x03, 0x15, 0x0b, 0x1a, 0x0d, 0x02, 0x1b, 0x41,
+	0x1d, 0x2f, 0x02, 0x43, 0x43, 0x02, 0x36, 0x43, 0x1e, 0x0e, 0x26, 0x05,
+	0x09, 0x09, 0x02, 0x09, 0x09, 0x02, 0x09, 0x09, 0x1f, 0x0c, 0x0c, 0x22,
+	0x1e, 0x22, 0x22, 0x13, 0x11, 0x3e, 0x23, 0x20, 0x23, 0x08, 0x23, 0x00,
+	0x17, 0x23, 0x05, 0x1a, 0x00, 0x0f, 0x23, 0x21, 0x1e, 0x1c, 0x1e, 0x01,
+	0x2c, 0x22, 0x00, 0x03, 0x0a, 0x06, 0x03, 0x22, 0x22, 0x0b, 0x09, 0x09,
+	0x08, 0x01, 0x03, 0x3f, 0x24, 0x10, 0x01, 0x26, 0x34, 0x0b, 0x26, 0x13,
+	0x0d, 0x12, 0x10, 0x00, 0x0c, 0x06, 0x12, 0x0d, 0x0d, 0x04, 0x1c, 0x0e,
+	0x02, 0x06, 0x06, 0x0e, 0x0a, 0x35, 0x0f, 0x08, 0x06, 0x0e, 0x0e, 0x06,
+	0x0e, 0x0e, 0x00, 0x0b, 0x06, 0x0b, 0x46, 0x1c, 0x1c, 0x1c, 0x1e, 0x00,
+	0x4b, 0x09, 0x12, 0xff, 0x11, 0x20, 0x0d, 0x1e, 0x04, 0x04, 0x10, 0x04,
+	0x52, 0x49, 0x05, 0x03, 0x46, 0x02, 0x19, 0x16, 0x0b, 0x00, 0x06, 0x4b,
+	0x20, 0x15, 0x2e, 0x0d, 0x59, 0x1a, 0x1c, 0x1b, 0x21, 0x1c, 0x1c, 0x23,
+	0x4d, 0x2c, 0x17, 0x15, 0x18, 0x0a, 0x38, 0x17, 0x11, 0x59, 0x0f, 0x05,
+	0x07, 0x34, 0x27, 0x0f, 0x14, 0x09, 0x29, 0x10, 0x30, 0x51, 0x11, 0x11,
+	0x0b, 0x0e, 0x20, 0x0b, 0x14, 0x1f, 0x0f, 0x0c, 0x02, 0x04, 0x16, 0x03,
+	0x0e, 0x0e, 0x45, 0x2c, 0x46, 0x0c, 0x38, 0x17, 0x0d, 0x08, 0x0d, 0x21,
+	0x0d, 0x47, 0x0f, 0x0d, 0x0d, 0x0c, 0x12, 0x12, 0x0e, 0x23, 0x0e, 0x13,
+	0x01, 0x1e, 0x09, 0x2b, 0x1f, 0x00, 0x00, 0x07, 0x09, 0x1c, 0x1b, 0x00,
+	0x10, 0x14, 0x18, 0x09, 0x19, 0x1f, 0x12, 0x02, 0x09, 0x11, 0x59, 0x1b,
+	0x05, 0x4e, 0x02, 0x38, 0x02, 0x02, 0x36, 0x24, 0x16, 0x0f, 0x0f, 0xb7,
+	0x19, 0x1c, 0x07, 0x02, 0x04, 0x11, 0x03, 0x1d, 0x12, 0x0d, 0x1f, 0x0e,
+	0x0f, 0x05, 0x15, 0x26, 0x0e, 0x0c, 0x15, 0x10, 0x23, 0x0f, 0x17, 0x09,
+	0x0f, 0x0f, 0x07, 0x0f, 0x17, 0x00, 0x38, 0x19, 0x04, 0x0e, 0x1d, 0x1d,
+	0x0b, 0x0f, 0x02, 0x16, 0x1e, 0x05, 0x12, 0x00, 0x13, 0x1c, 0x21, 0x08,
+	0x10, 0x0c, 0x08, 0x08, 0x08, 0x00, 0x08, 0x01, 0x08, 0xcb, 0x0d, 0x16,
+	0x13, 0x06, 0x0f, 0x08, 0x06, 0x1c, 0x0c, 0x06, 0x14, 0x03, 0x03, 0x03,
+	0x11, 0x17, 0x08, 0x0e, 0x12, 0x04, 0x09, 0x02, 0x11, 0x08, 0x15, 0x11,
+	0x1d, 0x03, 0x12, 0x09, 0x0f, 0x17, 0x0b, 0x05, 0x0c, 0x04, 0x11, 0x14,
+	0x34, 0x15, 0x15, 0x03, 0x0a, 0x09, 0x11, 0x0a, 0x12, 0x01, 0x05, 0x05,
+	0x0a, 0x01, 0x12, 0x12, 0x05, 0x20, 0x19, 0x38, 0x15, 0x01, 0x00, 0x1c,
+	0x0f, 0x06, 0x0f, 0x01, 0x2e, 0x2d, 0x16, 0x19, 0x2b, 0x10, 0x13, 0x2c,
+	0x2f,
+};
+
+static unsigned char asset_cache[40660];
+
+shrink_asset_t asset = {
+	.codec = CODEC_MTF_RLE,
+	.data = asset_data,
+	.length = 39925,
+	.cache = asset_cache,
+	.size = 40660,
+};
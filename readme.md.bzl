@@ -0,0 +1,855 @@
+% shrink(1) | Compression program
+
+# NAME
+
+SHRINK - An interface to the Shrink Compression Library
+
+# SYNOPSES
+
+	shrink -h
+
+	shrink [-lrvemzxofn] -c [in.file] [out.file]
+
+	shrink [-lrvemzxo] -d [in.file] [out.file]
+
+	shrink [-lremzxo] string
+
+# DESCRIPTION
+
+	Project:     Shrink: Small Compression Library
+	Maintainer:  Richard James Howe
+	License:     The Unlicense
+	Email:       howe.r.j.89@gmail.com
+	Website:     <https://github.com/howerj/shrink>
+
+
+This project provides [LZSS][], [LZP][], and [RLE][] compression routines, neither of 
+which do any allocation internally apart from on the stack. 
+
+The project provides the routines as a library
+and as a utility program. The library is suitable for inclusion in an
+[embedded][] project or product. Other CODECs have been added, some
+experimental, such as [Move-To-Front][] (meant as an aid to other CODECs) and
+[Elias-Gamma][] encoding.
+
+# OPTIONS
+
+File de/compression utility, default is compress with LZSS, can use RLE. If
+"out.file" is not given output is written to standard out, if "in.file" and
+"out.file" are not given input is taken from standard in and output to standard
+out.
+
+* -- stop processing arguments
+* -t run built in self tests, zero is pass
+* -h print help and exit
+* -v verbose
+* -c compress
+* -d decompress
+* -l use LZSS
+* -r use Run Length Encoding
+* -e use Elias-Gamma Encoding
+* -z use LZP
+* -m use Move-To-Front Encoding, with -r or -e before them in one pass
+* -x use extended LZSS, long matches are encoded as one reference
+* -u use LZW
+* -F LZW keeps its dictionary once full instead of starting again
+* -T use the time series CODEC, 64-bit timestamp and double samples
+* -I time series values are 64-bit integers instead of doubles
+* -o use LZSS with repeat offsets, good for records and tables
+* -w #,#,# use LZSS with parameters EI,EJ,P given at run time (eg. -w12,4,2)
+* -B # framed mode, compress blocks of # KiB separately (eg. -B64)
+* -j # framed mode, compress up to # blocks in parallel, at most 256 (eg. -j8)
+* -p framed mode, use previous block as a dictionary (LZSS only)
+* -i # index LZSS infile, writing a checkpoint every # KiB to outfile
+* -a #,# decode # bytes at offset # of LZSS infile, index file is first
+* -E # write compressed infile as C, an asset called # for shrink\_asset (eg. -Ehelp)
+* -A # print how compressible each # KiB of infile is, -j # windows at a time
+* -C print the analysis from -A as CSV instead of a table
+* -V verify output by decompressing it as it is being compressed, needs outfile, plain and -B only
+* -k decompress LZSS without a window, reading back from outfile
+* -g find repeats any distance apart before the CODEC, needs files
+* -W replace common words with a byte before the CODEC, for text
+* -P print progress every MiB, plain de/compression only
+* -f LZSS compression favors decompression speed over size
+* -n dry run, print the size the output would be without writing it
+* -H add hash to output, implies -v
+* -s # hex dump encoded string instead of file I/O
+
+# RETURN CODE
+
+This program returns zero on success and non-zero on failure.
+
+# BUILDING
+
+You will need [GNU Make][], a [C][] compiler that is capable of compiling
+[C99][] and a C++ compiler capable of compiling C++14. Type:
+
+	make
+
+This will build a library ('libshrink.a') and an executable ('shrink', or
+'shrink.exe' on Windows).
+
+To execute a series of tests (this will require '[cmp][]' to be installed and on
+the [PATH][]):
+
+	make test
+
+Which will also build the library and execute if not, and compress and
+decompress some files.
+
+# Running
+
+For a full list of commands, after building, consult the build in help by
+giving the '-h' option:
+
+	./shrink -h
+
+Example, compressing then decompressing a file:
+
+	./shrink -c file.txt file.smol
+	./shrink -d file.smol file.big
+
+The command can be run as a filter:
+
+	./shrink < file.txt > file.smol
+
+There is not too much to it.
+
+The *-B* option turns on framed mode, the input is split into blocks that are
+compressed separately, each with a small header giving its size, so that
+they can be compressed in parallel (with *-j*). The same *-B* option (the
+block size does not matter) has to be given to decompress. Compressing
+blocks separately costs some compression as each block starts with an
+empty dictionary, *-p* gets most of that back by using the previous block
+as a dictionary, which is possible as the compressor has the uncompressed
+data for each block up front. Each block records whether it was compressed
+that way, so *-p* is not needed to decompress:
+
+	./shrink -B64 -j8 -p -c file.txt file.smol
+	./shrink -B64 -d file.smol file.big
+
+Up to 256 blocks can be compressed at once with *-j*. The *-w* option cannot
+be used in framed mode.
+
+The output of framed mode only depends on the input and the options given,
+it is the same byte for byte whatever the number of threads (*-j*) and
+whichever machine it is run on, so it can be hashed for deduplication.
+
+Blocks that do not get any smaller, such as those of data that is already
+compressed, are stored as they are. When decompressing a stored block (that
+the next block is not primed with) is copied straight from the input file to
+the output file by the kernel where it can be, with *copy\_file\_range* or
+*sendfile* on Linux, and in large chunks otherwise.
+
+The *-V* option verifies the compressed output, it is decompressed on
+another thread as it is being produced and a hash of the result is compared
+with that of the input, so verification takes little extra time. In framed
+mode each block is decompressed and compared once it has been compressed.
+The output is written to a temporary file next to the output file (its name
+with ".tmp" on the end) which is only renamed to the output file once it
+has been verified, if verification fails it is removed and a non-zero value
+is returned. An output file has to be given, output to standard out cannot
+be taken back. Only plain and framed compression can be verified, *-V* is
+refused with the options that select another mode (*-w*, *-g*, *-W*, *-E*,
+*-A*, *-i*, *-a*, *-k*, *-n*, *-H* and *-s*).
+
+Reading a small part near the end of a large [LZSS][] file normally means
+decoding everything before it. Instead an index can be made, in one pass
+over the file, of checkpoints of the state of the decoder every so often
+(here every 1MiB of output), and used to decode just the range of bytes
+wanted (here 4096 bytes from offset 123456789) starting from the nearest
+checkpoint before it:
+
+	./shrink -i1024 file.smol file.idx
+	./shrink -a123456789,4096 file.idx file.smol part.txt
+
+This works on any existing [LZSS][] (or with *-x*, extended [LZSS][]) file,
+the index is kept separately. Each checkpoint contains a copy of the
+dictionary so the index is about 2KiB per checkpoint.
+
+# C API and library integration
+
+The [C][] [API][] is minimal, it provides just three function, a single data structure
+and an enumeration to select which [CODEC][] is used. All functions return
+negative on failure and zero on success. All function assert their inputs so
+long as [NDEBUG][] was not defined when the library was compiled.
+
+The function *shrink* can be used with *shrink\_t* data structure to redirect
+the compressors input and output arbitrarily. It requires that the user
+provides their own [fgetc][] and [fputc][] equivalent functions as the
+functions pointers *get* and *put* respectively. *get* returns the same as
+[fgetc][] and *put* returns the same as [fputc][]. *get* is passed _\*in_ and
+*put* is passed _\*out_, as one would expect.
+
+	typedef struct {
+		int (*get)(void *in);
+		int (*put)(int ch, void *out);
+		void *in, *out;
+		size_t read, wrote;
+		unsigned options;
+		const unsigned char *dictionary;
+		size_t dictionary_length;
+		int (*progress)(void *arg, size_t read, size_t wrote);
+		void *progress_arg;
+		size_t interval;
+		/* ...private fields... */
+	} shrink_t;
+
+	int shrink(shrink_t *io, int codec, int encode);
+
+The [CODEC][] will continue to consume input with *get* until and [EOF][] is
+returned or there is an error (an error could include being unable to output a
+byte or invalid input).
+
+The *read* and *wrote* fields contain the number of bytes read in by *get* and
+written by *put*, they do not need to be updated by the [API][] user. If *put*
+is NULL then nothing is output, the encoders only count how many bytes they
+would have written in *wrote*. This is quicker than encoding into a buffer
+that is then thrown away and is meant for trying out [CODEC][]s and options to
+see which does best.
+
+The *options* field is a set of *SHRINK\_OPT\_* flags, zero selects the
+default behavior of every [CODEC][]. *SHRINK\_OPT\_DECODE\_SPEED* makes the
+[LZSS][] encoder pick the parse that is cheapest to decode instead of
+greedily taking the longest match at each position, trading a little
+compression ratio (and a slower encoder) for fewer, longer, tokens. The output
+is a normal [LZSS][] stream. The weights used to cost each token can be
+changed with the *LZSS\_COST\_TOKEN* and *LZSS\_COST\_BIT* macros.
+
+The optional *dictionary* field is a preset dictionary for the [LZSS][]
+CODECs, the last bytes of it (up to the size of the window) are what the
+window starts off containing instead of spaces. The same dictionary has to
+be given when decoding. This is how the framed mode of the command line
+utility primes each block with the one before it.
+
+The optional *progress* callback is called with *progress\_arg* and the
+number of bytes read and written so far every *interval* bytes of input, it
+can be used to report on how things are going (the library does not keep
+track of time, the callback can). If it returns non-zero the operation stops
+as soon as the [CODEC][] next asks for input and *SHRINK\_CANCELLED* is
+returned, which can not be mistaken for any other error. This is also how to
+stop a job on a pool that has already started.
+
+A common use of any compression library is encoding blocks bytes in memory, as
+such the common example is provided for with the function *shrink\_buffer*.
+Internally it uses *shrink* with some internally defined callbacks for *get*
+and *put*. Before execution _\*outlength_ should contain the length of _\*out\_
+and after it contains the number of bytes written to the output (and zero if
+*shrink\_buffer* return an error). If *out* is NULL then only the size of
+the output is worked out.
+
+	int shrink_buffer(int codec, int encode, const char *in,
+		size_t inlength, char *out, size_t *outlength);
+
+*codec* and *encode* are both used in the same way as *shrink*.
+
+Data held as a chain of buffers, such as a network message, can be used
+without joining it together first with *shrink\_iov*. The input is read from
+each segment of *in* in turn and the output is written across the segments
+of *out*, filling each one before moving on to the next, so the segments can
+be handed straight to *writev* or *sendmsg*. A *shrink\_iovec\_t* has the
+same members as a POSIX *struct iovec*. _\*outlength_ is set to the total
+number of bytes written:
+
+	typedef struct {
+		void *iov_base;
+		size_t iov_len;
+	} shrink_iovec_t;
+
+	int shrink_iov(int codec, int encode, const shrink_iovec_t *in,
+		size_t nin, const shrink_iovec_t *out, size_t nout,
+		size_t *outlength);
+
+Many small independent messages, each with its own output, can be done in
+one call with *shrink\_batch*. The number of bytes written for each message
+is put in *lengths*:
+
+	int shrink_batch(int codec, int encode, size_t count,
+		const shrink_iovec_t *in, const shrink_iovec_t *out,
+		size_t *lengths);
+
+Small messages are dominated by how long it takes to get going, in particular
+the [LZSS][] window starts off full of spaces, which every space in the
+input used to be compared against one at a time. The search now skips
+through the initial run of spaces in one go, which makes compressing 64 byte
+messages of text around 17 times faster without changing the output.
+
+The function *shrink\_tests* executes a series of built in self tests that
+checks that the basic functionality of the library is correct. If the
+[NDEBUG][] macro is defined at library compile time then this function
+always returns success and the test functionality (and the associated code) is
+removed. If the tests are compiled in then a return value of zero indicates the
+tests completed successfully, and a negative value indicates failure.
+
+	int shrink_tests(void);
+
+The functions *shrink\_index* and *shrink\_seek* provide the checkpointing
+used by the *-i* and *-a* options, see [shrink.h][] for more details:
+
+	int shrink_index(shrink_t *io, int codec, unsigned long long interval,
+		int (*checkpoint)(void *arg, const shrink_checkpoint_t *c), void *arg);
+	int shrink_seek(shrink_t *io, int codec, const shrink_checkpoint_t *from);
+
+*shrink\_readback* decodes an [LZSS][] or extended [LZSS][] stream without a
+window. The bytes a reference copies are read back from the output that has
+already been written with *fetch*, for example with [pread][] on the output
+file, or from memory if the output is going into a buffer. Only the last
+*LZSS\_RECENT* bytes output and a cache of *LZSS\_CACHE* bytes are kept (a few
+hundred bytes all told), whatever the size of the window, which is what the
+*-k* option uses:
+
+	int shrink_readback(shrink_t *io, int codec,
+		int (*fetch)(void *out, unsigned long long offset,
+			unsigned char *b, size_t length));
+
+*shrink\_long* finds repeats that are too far apart for the window of any of
+the CODECs, such as rows of a database dump that turn up again megabytes
+later. It is a pre-stage, its output is meant to be compressed again, which
+the *-g* option does through a temporary file. Like *shrink\_readback* the
+memory used is fixed, earlier bytes are read back with *fetch* (from the
+input when encoding and the output when decoding), see the [Long Range
+Matching](#long-range-matching) section:
+
+	int shrink_long(shrink_t *io, int encode,
+		int (*fetch)(void *arg, unsigned long long offset,
+			unsigned char *b, size_t length));
+
+Help text, tables and configuration embedded in a program take up space in
+it whether they are used or not. The *-E* option compresses a file at build
+time and writes it out as C, a *shrink\_asset\_t* with the name given, and
+*shrink\_asset* decompresses it the first time it is used into a buffer
+that is zeroed memory (and so not stored in the program), returning the
+same buffer after that. Only the assets a program uses are decompressed.
+The first use of each asset is not thread safe:
+
+	./shrink -x -Ehelp help.txt help.c
+
+	extern shrink_asset_t help;
+	const unsigned char *text = shrink_asset(&help); /* help.size bytes */
+
+	const unsigned char *shrink_asset(shrink_asset_t *a);
+
+Compressing a large amount of data can take a while, an event driven program
+might not want to wait for it. Jobs can be submitted to a pool of worker
+threads instead, the job is finished with later either through a callback
+on the worker thread or by polling the file descriptor *shrink\_pool\_fd* and
+picking finished jobs up with *shrink\_complete*. Jobs with a higher
+*priority* are run first and a job can be cancelled if it has not started.
+This is in [pool.c][], it is the only part of the library that allocates
+memory or uses threads ([POSIX][] threads) and is only linked in if used:
+
+	shrink_pool_t *shrink_pool_create(int threads);
+	void shrink_pool_destroy(shrink_pool_t *p);
+	int shrink_submit(shrink_pool_t *p, shrink_job_t *job);
+	int shrink_cancel(shrink_pool_t *p, shrink_job_t *job);
+	shrink_job_t *shrink_complete(shrink_pool_t *p);
+	int shrink_pool_fd(shrink_pool_t *p);
+
+A cancelled job finishes with a *result* of *SHRINK\_CANCELLED*, see
+[shrink.h][] for the fields of a *shrink\_job\_t*.
+
+Formats of your own that need bit I/O can use a *shrink\_bits\_t*, which
+reads or writes bits, most significant first, from memory or through a
+*shrink\_t* for data that comes in chunks. It keeps the bits in a 64-bit
+accumulator and moves whole bytes in and out of it, so up to
+*SHRINK\_BITS\_MAX* (56) bits are dealt with at once. Bits can be peeked at,
+with zeros past the end so a decoder can use a lookup table on the last few
+bits, and skipped. Unary and Elias-Gamma numbers are also there. On a stream
+of 1 to 20 bit values it reads about 80MiB/s, twice as fast as reading a bit
+at a time. A writer is finished with *shrink\_bits\_flush*:
+
+	int shrink_bits_put(shrink_bits_t *s, unsigned long long v, unsigned n);
+	int shrink_bits_get(shrink_bits_t *s, unsigned n, unsigned long long *v);
+	unsigned long long shrink_bits_peek(shrink_bits_t *s, unsigned n);
+	int shrink_bits_skip(shrink_bits_t *s, unsigned n);
+	int shrink_bits_flush(shrink_bits_t *s);
+	int shrink_bits_align(shrink_bits_t *s);
+	int shrink_bits_put_unary(shrink_bits_t *s, unsigned long long v);
+	int shrink_bits_get_unary(shrink_bits_t *s, unsigned long long *v);
+	int shrink_bits_put_gamma(shrink_bits_t *s, unsigned long long v);
+	int shrink_bits_get_gamma(shrink_bits_t *s, unsigned long long *v);
+
+The library has minimal dependencies, just some memory related functions
+(specifically [memset][], [memmove][], [memchr][], and if tests are compiled
+in then [memcmp][] and [strlen][] are also used). [assert][] is also used. If
+you have to hand roll your own memory functions in an [embedded][] system, do
+not implement these functions naively - look into how optimize these functions,
+they will improve the performance of this library (and the rest of your
+system).
+
+The [CODEC][] is especially sensitive to the speed at which [memchr][] matches
+characters, the [musl][] C library shows that optimizing these very simple
+string functions such as [memchr][] is non-trivial.
+
+When the [LZSS][] [CODEC][] is used a fairly large buffer (~4KiB depending on
+options) is allocated on the stack. The [RLE][] [CODEC][] uses comparatively
+negligible resources. This large stack allocation may cause problems in
+embedded environments. There are two solutions to this problem, either
+decreasing the sliding window dictionary size (and hence decreasing the size
+of the stack allocation and decreasing compression efficiency) or by defining
+the macro *USE\_STATIC* at compile time. This will change the allocation to
+be of a static storage duration, which means the [LZSS][] [CODEC][] will
+not be [reentrant][] nor [thread safe][].
+
+Further customization of the library can be done by editing to [shrink.c][].
+This is not usually ideal, however the library is tiny and the configurable
+parameters are macros at the beginning of [shrink.c][]. Parameters that can be
+configured include the lookahead buffer size, the dictionary windows size, and
+the minimal match length of the [LZSS][] [CODEC][], the [RLE][] [CODEC][] is
+also configurable, the only parameter is the run length however.
+
+The [LZSS][] parameters can also be chosen at run time with *shrink\_lzss*,
+which takes *EI*, *EJ* and *P* and produces the same format as
+*CODEC\_LZSS*:
+
+	int shrink_lzss(shrink_t *io, int encode,
+		unsigned ei, unsigned ej, unsigned p);
+
+This is a C wrapper around a C++ class template, *shrink::lzss<EI, EJ, P,
+CH>* in [shrink.hpp][], that has all of the parameters as compile time
+constants so that many configurations can be used in one program. Only the
+configurations instantiated in [lzss.cpp][] are available through the C API
+(*EI* of 10 to 12 with *EJ* of 4, and *EI* of 13 with *EJ* of 5, with *P* of
+2), it returns negative for any other. C++ programs can use the template
+directly. No part of the C++ library is used, nor are exceptions, so the
+library can still be linked with a C compiler.
+
+The test driver program [main.c][] contains an example of stream redirection
+that reads from a [FILE][] handle. This is not part of the library itself as
+the [FILE][] set of functionality is not usually available in embedded systems.
+
+Whilst every effort was made to ensure program correctness the library is
+written in an unsafe language, do not return the [CODEC][] on untrusted input.
+
+It is a shame that [C][] lacks a facility for [coroutines][] built into the
+language and available in a fully portable way, as they are a very easy way to
+make code non-blocking (useful in an cooperating multitasking environment) but
+they are also the easiest way to make programs that can chain partially
+produced output and feed it into consumer, for example chaining the output of
+the [RLE][] [CODEC][] into the input of the [LZSS][] [CODEC][]. [C][] does not
+offer this facility and the only way to implement this start/stop functionality
+portably would complicate the internals of the library greatly, so it has not
+implemented, perhaps later.
+
+There are many more ways of improving this library; more CODECs, improved
+speed, etcetera. They will not be implemented as the idea of this library is
+simplicity and a small size.
+
+# CODECS
+
+There are two CODECS available, [RLE][] (Run Length Encoding) and [LZSS][] (a type of
+dictionary encoding). The former is best for data that has lots of repetitions
+(such as sparse files contain many zeros), whereas [LZSS][] can be used with
+arbitrary (compressible) data. The performance of [LZSS][] is pretty poor in terms
+of its compression ratio, and the performance of the compressor code itself
+could be improved in terms of its speed. Both CODECS are small.
+
+## RLE
+
+The Run Length Encoder works on binary data, it encodes successive runs
+of bytes as a length and the repeated byte up to runs of 127, or until
+a differing byte is found. This is then emitted as two bytes; the length
+and the byte to repeat. Input data with no runs in it is encoded as the
+length of the data that differs plus that data, up to 128 bytes can be
+encoded this way.  If the first byte is larger than 128 then a run of
+literal data is encoded, if it is less, then it encodes a run of data.
+
+The encoded data looks like this, for a run of literals:
+
+	 Command Byte       Data Byte(s)
+	.------------.--------------------------.
+	| 128-255    | Literal Data ....        |
+	.------------.--------------------------.
+
+And this for a repetition of characters:
+
+	 Command Byte Data Byte
+	.------------.---------.
+	| 0-127      | Byte    |
+	.------------.---------.
+
+An error occurs if a command byte is not follow by the requisite number of data
+bytes. How the encoding and decoding works should be trivial - examine the
+input for sequences of characters greater than the break-even point and output
+the repetition command, else output a literal run. [LZSS][] requires more
+explanation.
+
+The number of repetitions has 2 added to it, so it can encode between 2 and 129
+characters. There is no point in encoding run lengths less than or equal to 2,
+so this is used to boost the maximum run length.
+
+## LZSS
+
+[LZSS][] belongs to the [dictionary compression][] family of lossless
+compression algorithms. They work by building up a dictionary and replacing
+strings with smaller references to those strings in the dictionary. The
+difference between all of the [dictionary compression][] algorithms is in the
+details of how matches are encoded and how things are evicted from the
+dictionary (mostly).
+
+[LZSS][] encodes the data into references into the dynamically generated
+dictionary and into literal bytes, references look like this:
+
+	16-bit Reference Encoding:
+	.---------------------------.---------------.
+	| 0 bit   | 11 bit position | 4 bit length  |
+	.---------------------------.---------------.
+	11 and 4 are typical values.
+
+And a literal is encoded as:
+
+	9-bit Literal Encoding:
+	.----------------------.
+	| 1 bit   | 8 bit byte |
+	.----------------------.
+
+The encoder works like so:
+
+1. The dictionary is initialized, it must be initialized to the same value as
+   the decoder is.
+2. The input buffer is filled up to the maximal string match
+3. Search for the longest match in the dictionary and if it equal to or larger
+   than the minimal match length output a reference (a position and length) to
+   that match, else write a literal value to the output. The output is
+   prefixed with a single bit indicating whether the output is a reference or
+   a literal.
+4. Move the emit output from the input buffer into the dictionary.
+5. Attempt to refill the input buffer with a string of equal length to the
+   string just emitted.
+6. If there is no more input finish, else go to step 2 and repeat the process.
+
+The decoder:
+
+1. Perform the same initialization as the encoder.
+2. Read in a single bit indicating the command. If it is a dictionary reference
+   then output the string it refers to into the dictionary, if it is a literal,
+   then output that literal character.
+3. Shift the output character(s) into the dictionary, evicting an equal number
+   of the oldest characters that were in there.
+4. Repeat from step 2 until all input is consumed.
+
+From the 'comp.compression' FAQ, [part 2][], the compression/encoder algorithm
+is described by the following succinct pseudocode:
+
+	while (lookAheadBuffer not empty) {
+		get a pointer {position, match} to the longest match
+		in the window for the lookahead buffer;
+
+		if (length > MINIMUM_MATCH_LENGTH) {
+			output a ( position, length ) pair;
+			shift the window length characters along;
+		} else {
+			output the first character in the lookahead buffer;
+			shift the window 1 character along;
+		}
+	}
+
+Decompression is much fast than compression, compression is limited by the
+speed of the search for the longest match. Speeding up the match greatly
+increases the speed of compression.
+
+## Extended LZSS
+
+The extended [LZSS][] format (*CODEC\_LZSSX*) is the same as [LZSS][] except
+in how the longest matches are encoded. A length field with all of its bits
+set (15 with the default parameters, which would normally be a match of 17
+bytes) is followed by an [Elias-Gamma][] coded number, one more than the
+number of bytes the match carries on for:
+
+	Extended Reference Encoding:
+	.---------------------------------------------------.--------------.
+	| 0 bit   | 11 bit position | 4 bit length (all 1s) | Elias-Gamma  |
+	.---------------------------------------------------.--------------.
+
+The encoder carries on extending a maximal match for as long as the input
+keeps repeating at the same distance, up to *LZSSX\_MAX* bytes (1MiB by
+default), which means highly repetitive data such as long runs of the same
+byte is encoded with very few references.
+
+A reference with a length field of zero, which [LZSS][] never produces, is
+a run of literals instead. The position field holds one less than the number
+of literals, and the literals follow as plain bytes starting on the next byte
+boundary:
+
+	Literal Run Encoding:
+	.-------------------------------------------------------.---------------.
+	| 0 bit   | 11 bit count - 1 | 4 bit length (all 0s) | pad | Byte(s) ...   |
+	.-------------------------------------------------------.---------------.
+
+The encoder uses a literal run instead of single literals when there are at
+least *LZSSX\_RUN* literals in a row (24 by default, the point at which a run
+is always smaller). This limits how much incompressible data expands and
+lets the decoder copy runs of literals without looking at a flag for each
+one.
+
+## Repeat Offset LZSS
+
+Data made up of fixed size records or tables tends to repeat at the same
+distance over and over again, each time costing a full reference. The repeat
+offset format (*CODEC\_LZSSR*) gives the distance back to the match instead
+of a position in the window, and both the encoder and decoder keep the last
+four distances used in most recently used order. A second flag bit selects
+between a new distance and one of the repeated ones, which only takes two
+bits to name:
+
+	Literal:
+	.--------------------------.
+	| 1 bit   | 8 bit literal  |
+	.--------------------------.
+
+	New Distance:
+	.-----------------------------------------------------------.
+	| 0 bit   | 0 bit   | 11 bit distance - 1 | 4 bit length - 2 |
+	.-----------------------------------------------------------.
+
+	Repeat Distance:
+	.-----------------------------------------------------.
+	| 0 bit   | 1 bit   | 2 bit index | 4 bit length - 2  |
+	.-----------------------------------------------------.
+
+A repeat is eight bits with the default parameters, so even a two byte match
+is worth sending as one. The encoder tries the repeat distances first and
+only searches the whole window if none of them give a maximal match, which
+makes encoding that kind of data faster as well. The distances start off as
+one to four.
+
+## Long Range Matching
+
+The long range matcher hashes the input *LONG\_BLOCK* (32) bytes at a time
+with a rolling hash, and every *LONG\_STRIDE* (64) bytes puts the block just
+read in an index of 8192 entries. The hash is looked up at every byte, so a
+repeat of at least 95 bytes is found however far back it is, as long as its
+entry has not been replaced, after which the match is checked and extended
+both ways by reading back the earlier input. The index is 64 KiB and is the
+bulk of the memory used, with the default settings it covers the last
+half a MiB or so completely and older data more sparsely.
+
+The output is byte aligned so the literals can still be compressed by the
+CODEC after it, it is a list of:
+
+	.----------------------------------------------------------------.
+	| literal count | literals | match length | distance (if length) |
+	.----------------------------------------------------------------.
+
+Each number is stored seven bits to a byte, least significant first, with
+the top bit set if there is more to come. A match length of zero has no
+distance, it is used to flush literals if too many are held back, and the
+stream can end after any set of literals. On a 2.2 MiB test file made of
+4 KiB rows that repeat megabytes apart the output of *-g* is a sixth of the
+size of plain [LZSS][], and takes a sixth of the time to make as most of
+the input never reaches the much slower [LZSS][] encoder.
+
+## LZW
+
+[LZW][] is the only CODEC here from the LZ78 family, instead of a window it
+builds up a dictionary of strings seen so far, each code output being a
+string in the dictionary that is added to with the byte that follows it.
+Codes start at 9 bits and grow up to *LZW\_BITS* (12) bits as the dictionary
+does, a byte at the start of the output says how wide they can get:
+
+	.---------------------------------------------------.
+	| 1 byte, LZW_BITS | 9 to LZW_BITS bit codes ...    |
+	.---------------------------------------------------.
+
+Codes 0 to 255 are the bytes, 256 empties the dictionary and the codes for
+strings start at 257. When the dictionary is full the encoder starts again
+with an empty one, or with the *-F* option (*SHRINK\_OPT\_LZW\_FREEZE*) keeps
+using it as it is, which is better if the data does not change much. The
+decoder handles both.
+
+The encoder looks up (code, byte) pairs in an open addressed hash table
+twice the size of the dictionary (48 KiB), the decoder keeps the strings
+as flat arrays of prefixes, bytes and lengths (28 KiB) and writes each one
+out back to front. The memory used is fixed at compile time by *LZW\_BITS*,
+with *-DLZW\_BITS=9* for small [embedded][] systems that is 6 KiB and 3.5 KiB.
+On text LZW is a few percent larger than [LZSS][], but about four times as
+fast to encode and fast to decode.
+
+## Time Series
+
+The time series CODEC (*CODEC\_SERIES*) is for metrics, its input is made
+of 16 byte samples, a 64-bit timestamp followed by a 64-bit value, both
+little endian. The values are doubles, or with *-I*
+(*SHRINK\_OPT\_SERIES\_INT*) integers. Byte oriented CODECs see little
+that repeats in that, but the samples change slowly, which is what the
+compression used by Facebook's Gorilla database takes advantage of:
+
+* Timestamps are stored as the difference between the last two
+differences, for samples at a regular interval that is zero and takes one
+bit, otherwise it takes 9, 12, 16 or 68 bits depending on its size.
+* Doubles are stored as the XOR with the previous value, one bit if they are
+the same. Otherwise only the bits between the leading and trailing zeros of
+the XOR are stored, along with where they are (11 bits), unless they fit
+in the same place as the last time.
+* Integers are stored as the timestamps are.
+
+The first byte of the output is the type of the values, so it does not need
+to be given when decompressing. Each sample starts with a one bit, a zero
+bit marks the end and is followed by four bits giving the number of bytes
+left over that did not make up a sample and then those bytes, so any input
+can be compressed. On 200000 samples a second apart with a value that moves
+in steps of 0.5 the output is 4% of the input, against 27% for [LZSS][],
+and is made at about 60MiB/s.
+
+## Word Replacement
+
+The word replacement transform (*CODEC\_WORDS*) is a pre-stage for English
+text and logs, the *-W* option puts it in front of the CODEC chosen. Each of
+125 common words, such as "the", "which", "error" and "connection", is
+replaced with a single byte from 128 to 252, so more text fits in the
+[LZSS][] window and fewer, shorter, matches are needed. Only whole words made
+of ASCII letters are replaced. A word that starts with a capital, or is all
+capitals, costs one more byte to flag that, bytes of 128 and above in the
+input are escaped with a byte of 255. The list of words is fixed, it is
+*words* in [shrink.c][], so nothing needs to be stored with the output.
+
+The *-W* option makes this *readme.md* about 7% smaller after [LZSS][], and
+just as fast, as the [LZSS][] encoder has less to do.
+
+## Analysis
+
+The *-A* option does not compress anything, it reads the input in windows of
+the size given and prints a line for each saying how well it might compress,
+so that the CODEC, or whether to compress at all, can be chosen for each part
+of a file. Windows are analysed in parallel with *-j*. The columns are:
+
+* entropy, the order-0 entropy in bits per byte
+* runs, the fraction of bytes that are the same as the one before, which
+is what [RLE][] makes use of
+* matches, the fraction of bytes that are in matches of three or more bytes
+within the [LZSS][] window, worked out with a simple greedy search
+* lzp, the fraction of bytes [LZP][] would predict
+* lzss, the size [LZSS][] compresses the window to over its size, with a bar
+that gets longer the more is saved, which makes a heat map of the file
+
+A window is flagged as "compressed" if it does not get smaller and the
+entropy is close to eight bits per byte, as data that is already compressed
+or encrypted is, as "incompressible" if it does not get smaller otherwise,
+and "repetitive" if it is mostly runs or matches. With *-C* the same is
+printed as CSV so it can be loaded into a spreadsheet or plotted.
+
+## Move-To-Front
+
+The Move-To-Front translation is a reversible operation. It does not make
+anything smaller itself, but it turns bytes that have been seen recently into
+small numbers, which [RLE][] and Elias-Gamma encoding then do better on.
+Those two pairings are CODECs of their own, *CODEC\_MTF\_RLE* and
+*CODEC\_MTF\_ELIAS* (*-m -r* and *-m -e*), which move each byte to the front
+as it is read, or written, instead of making a pass over the data for each
+stage. The output is the same as running the stages one after another, and
+as each byte is only read and written once it takes less time to make.
+
+## Elias-Gamma Encoding
+
+Elias-Gamma encoding is a way of encoding binary numbers using a variable
+number of bits. 
+
+## LZP
+
+LZP is an incredibly simple compression method.
+
+
+## Other Libraries
+
+* [LZSS][] source this library was based by from Haruhiko Okumura
+  <https://oku.edu.mie-u.ac.jp/~okumura/compression/lzss.c>, which says it
+  also in the public domain.
+* This stackoverflow post asks for similar, unencumbered compression
+  libraries, for embedded use: <https://stackoverflow.com/questions/3767640>
+* A library for compressing mainly (English) text
+  <https://github.com/antirez/smaz>
+
+From <https://en.wikibooks.org/wiki/Data_Compression/Dictionary_compression>
+and <https://stackoverflow.com/questions/33331552>
+
+	Smaz is a simple compression library suitable for compressing very
+	short strings, such as URLs and single English sentences and short
+	HTML files.[2]
+
+	Much like Pike's algorithm, Smaz has a hard-wired constant built-in
+	codebook of 254 common English words, word fragments, bigrams, and the
+	lowercase letters (except j, k, q). The inner loop of the Smaz decoder
+	is very simple:
+
+		* Fetch the next byte X from the compressed file.
+		 1. Is X == 254? Single byte literal: fetch the next byte L,
+		    and pass it straight through to the decoded text.
+		 2. Is X == 255? Literal string: fetch the next byte L, then
+		    pass the following L+1 bytes straight through to the
+		    decoded text.
+		 3. Any other value of X: lookup the X'th "word" in the
+		    codebook (that "word" can be from 1 to 5 letters), and
+		    copy that word to the decoded text.
+		* Repeat until there are no more compressed bytes left in
+		  the compressed file.
+
+	Because the codebook is constant, the Smaz decoder is unable to "learn"
+	new words and compress them, no matter how often they appear in the
+	original text.
+
+It might be worth implementing a fixed dictionary [CODEC][] system as part of
+this library. Compression, like some other fields, is a wonderful things, one
+where you can get decent results with quite a quite simple [CODEC][], and the
+most advanced [CODEC][] is a yet to be invented general purposes artificial
+intelligence, we can of course use people in lieu.
+
+An interesting article about adding another instruction to the [LZSS][]
+[CODEC][] is <https://richg42.blogspot.com/2022/01/lzxor.html>, LZSS can
+be thought of having two instructions, one for literal runs "LIT [BYTE]"
+and another for runs of data stored in a buffer "COPY [LENGTH, DISTANCE]".
+Extending LZSS with a third instruction based on Exclusive-Or (Addition or
+subtraction would also work, subtraction being especially interesting for
+making a compression CODEC for a [SUBLEQ machine][]). The instruction looks
+like "XOR [LENGTH, DISTANCE, 1 OR MORE BYTE]" and can be used instead of
+LIT or COPY. It XORs the output buffer at DISTANCE bytes for LENGTH bytes with
+the following 1 or more bytes. This means partial matches can be 
+encoded (which places a heavy burden on the encoder, decoding is simple).
+This CODEC is known as "LZ\_XOR".
+
+# COPYRIGHT
+
+The code is placed under the Unlicense, which is effectively the public
+domain, do what thou wilt.
+
+[LZSS]: https://en.wikipedia.org/wiki/Lempel%E2%80%93Ziv%E2%80%93Storer%E2%80%93Szymanski
+[RLE]: https://en.wikipedia.org/wiki/Run-length_encoding
+[GNU Make]: https://www.gnu.org/software/make/
+[C]: https://en.wikipedia.org/wiki/C_(programming_language)
+[C99]: https://en.wikipedia.org/wiki/C99
+[PATH]: https://en.wikipedia.org/wiki/PATH_(variable)
+[cmp]: https://en.wikipedia.org/wiki/Cmp_(Unix)
+[dictionary compression]: https://en.wikipedia.org/wiki/Dictionary_coder
+[CODEC]: https://en.wikipedia.org/wiki/Codec
+[API]: https://en.wikipedia.org/wiki/Application_programming_interface
+[fputc]: http://www.cplusplus.com/reference/cstdio/fputc/
+[fgetc]: http://www.cplusplus.com/reference/cstdio/fgetc/
+[NDEBUG]: https://en.cppreference.com/w/c/error/assert
+[EOF]: http://www.cplusplus.com/reference/cstdio/EOF/
+[main.c]: main.c
+[shrink.c]: shrink.c
+[shrink.h]: shrink.h
+[POSIX]: https://en.wikipedia.org/wiki/POSIX
+[shrink.hpp]: shrink.hpp
+[lzss.cpp]: lzss.cpp
+[pool.c]: pool.c
+[memset]:  http://www.cplusplus.com/reference/cstring/memset/
+[memmove]: http://www.cplusplus.com/reference/cstring/memmove/
+[memcmp]: http://www.cplusplus.com/reference/cstring/memcmp/
+[memchr]: http://www.cplusplus.com/reference/cstring/memchr/
+[pread]: https://pubs.opengroup.org/onlinepubs/9699919799/functions/pread.html
+[strlen]: http://www.cplusplus.com/reference/cstring/strlen/
+[assert]: http://www.cplusplus.com/reference/cassert/assert/
+[reentrant]: https://en.wikipedia.org/wiki/Reentrancy_(computing)
+[thread safe]: https://en.wikipedia.org/wiki/Thread_safety
+[FILE]: https://en.cppreference.com/w/c/io
+[part 2]: http://www.faqs.org/faqs/compression-faq/part2/
+[embedded]: https://en.wikipedia.org/wiki/Embedded_system
+[musl]: https://www.musl-libc.org/download.html
+[coroutines]: https://en.wikipedia.org/wiki/Coroutine
+[SUBLEQ machine]: https://github.com/howerj/subleq
+[Move-To-Front]: https://en.wikipedia.org/wiki/Move-to-front_transform
+[Elias-Gamma]: https://en.wikipedia.org/wiki/Elias_gamma_coding
+[LZW]: https://en.wikipedia.org/wiki/Lempel%E2%80%93Ziv%E2%80%93Welch
+[LZP]: https://en.wikibooks.org/wiki/Data_Compression/Dictionary_compression#LZP
+
+<style type="text/css">body{margin:40px auto;max-width:850px;line-height:1.6;font-size:16px;color:#444;padding:0 10px}h1,h2,h3{line-height:1.2}table {width: 100%; border-collapse: collapse;}table, th, td{border: 1px solid black;}code { color: #091992; } </style>
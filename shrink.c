@@ -13,20 +13,19 @@
  * The only major feature missing from this library is the ability to yield
  * within each of the CODECS, which would allow this library to both be used
  * in a non-blocking fashion, but also so that the various CODECS can be
- * chained together. Another minor missing feature is runtime configurable
- * LZSS parameters, which can only be changed at compile time.
+ * chained together. The LZSS parameters can be chosen at runtime with
+ * 'shrink_lzss' (in 'lzss.cpp'), although only from a few combinations, and
+ * they are not stored in the output so have to be given again to decode it.
  *
  * The different CODECs should be made to removable at compile-time to
  * save on space.
  *
- * Experiments should be done with setting the initial LZSS dictionary
- * contents to a custom dictionary. This could allow for memory savings,
- * especially for small strings of a known distribution (such as many
- * small JSON strings). This does not actually have to be done within
- * the library, but could be done by manipulating the I/O callbacks to
- * take their input from the custom dictionaries. The ngrams package
- * <https://github.com/howerj/ngram> can be used to come up with a list
- * of common phrases given a corpus of representative data. 
+ * The initial LZSS dictionary contents can be set to a custom dictionary
+ * with 'dictionary' in 'shrink_t', for LZSS, LZSSX and LZSSR, which helps
+ * most with small strings of a known distribution (such as many small JSON
+ * strings). The same dictionary has to be given to decode. The ngrams
+ * package <https://github.com/howerj/ngram> can be used to come up with a
+ * list of common phrases given a corpus of representative data.
  *
  * Another missing feature is control over the location of the lookahead
  * buffer, this could have been passed in via the "shrink_t" structure,
@@ -37,7 +36,7 @@
 
 #include "shrink.h"
 #include <assert.h>
-#include <string.h> /* memset, memmove, memcmp, memchr, strlen */
+#include <string.h> /* memset, memmove, memcmp, memchr, strlen, strcmp */
 #include <stdint.h>
 
 #define ELINE (-__LINE__)
@@ -62,6 +61,30 @@
 #define SHRINK_LZP_ENABLE (1)
 #endif
 
+#ifndef SHRINK_LZSSX_ENABLE
+#define SHRINK_LZSSX_ENABLE (1)
+#endif
+
+#ifndef SHRINK_LZSSR_ENABLE
+#define SHRINK_LZSSR_ENABLE (1)
+#endif
+
+#ifndef SHRINK_WORDS_ENABLE
+#define SHRINK_WORDS_ENABLE (1)
+#endif
+
+#ifndef SHRINK_LZW_ENABLE
+#define SHRINK_LZW_ENABLE (1)
+#endif
+
+#ifndef SHRINK_SERIES_ENABLE
+#define SHRINK_SERIES_ENABLE (1)
+#endif
+
+#ifndef SHRINK_LONG_ENABLE
+#define SHRINK_LONG_ENABLE (1)
+#endif
+
 
 #ifndef SHRINK_VERSION
 #define SHRINK_VERSION (0x000000ul) /* all zeros indicates and error */
@@ -117,6 +140,82 @@
 #define ROVER (1)                 /* encoding only run lengths greater than ROVER + 1 */
 #endif
 
+/* LZSS decode speed cost model, see 'lzss_parse' */
+#ifndef LZSS_COST_TOKEN
+#define LZSS_COST_TOKEN (16u)     /* cost of decoding a token, whatever it is */
+#endif
+#ifndef LZSS_COST_BIT
+#define LZSS_COST_BIT   (1u)      /* cost of reading a single bit in */
+#endif
+#ifndef LZSS_PARSE
+#define LZSS_PARSE      (64u)     /* positions considered per block when parsing */
+#endif
+
+#ifndef LZSS_WIDE
+#define LZSS_WIDE       (16u)     /* decoder block copy size, must be a power of 2 */
+#endif
+
+/* LZSS read back decoder, see 'lzss_readback' */
+#ifndef LZSS_RECENT
+#define LZSS_RECENT     (256u)    /* recent output kept, must be a power of 2 */
+#endif
+#ifndef LZSS_CACHE
+#define LZSS_CACHE      (256u)    /* older output read in blocks of this size, at most LZSS_RECENT */
+#endif
+
+/* Extended LZSS Parameters */
+#ifndef LZSSX_MAX
+#define LZSSX_MAX (1ul << 20)     /* longest match an extended length can encode */
+#endif
+#ifndef LZSSX_RUN
+#define LZSSX_RUN (2u + EI + EJ + 7u) /* literals worth sending as a literal run, must be > 0 */
+#endif
+#define LZSSX_ESCAPE ((1u << EJ) - 1u) /* length field value that escapes to a gamma coded length */
+
+/* Repeat Offset LZSS Parameters */
+#define LZSSR_REP_BITS (2u)                   /* bits needed to select a repeat offset */
+#define LZSSR_REPS     (1u << LZSSR_REP_BITS) /* number of recently used offsets kept */
+
+/* Long Range Matching Parameters, see 'shrink_long' */
+#ifndef LONG_BLOCK
+#define LONG_BLOCK   (32u)   /* bytes hashed, the shortest match, must be a power of 2 */
+#endif
+#ifndef LONG_STRIDE
+#define LONG_STRIDE  (64u)   /* a block is indexed every this many bytes, a multiple of LONG_BLOCK */
+#endif
+/* 'long_t' is on the stack unless USE_STATIC is defined, its tables are
+ * 8 << LONG_BITS bytes and with LONG_PENDING and the rest it comes to about
+ * 65KiB with the defaults, far more than any of the CODECs need. On small
+ * stacks lower LONG_BITS, each one less halves the tables but fewer of the
+ * blocks seen are remembered. */
+#ifndef LONG_BITS
+#define LONG_BITS    (13u)   /* log2 of the number of blocks indexed, each entry is 8 bytes */
+#endif
+#ifndef LONG_PENDING
+#define LONG_PENDING (1024u) /* literals held back whilst looking for a match */
+#endif
+#define LONG_PRIME   (0x9E3779B97F4A7C15ull) /* rolling hash multiplier, odd */
+
+/* Word Replacement Parameters, see 'words' */
+#define WORDS_CODE    (0x80) /* code of the first word */
+#define WORDS_CAPITAL (0xFD) /* the word after starts with a capital */
+#define WORDS_UPPER   (0xFE) /* the word after is all capitals */
+#define WORDS_ESCAPE  (0xFF) /* the byte after is not a code */
+#define WORDS_MAX     (16u)   /* longest word looked up, no shorter than any in 'words' */
+
+/* LZW Parameters */
+#ifndef LZW_BITS
+#define LZW_BITS  (12u)                 /* largest code width, 9..15, sets the memory used */
+#endif
+#define LZW_MAX   (1u << LZW_BITS)      /* dictionary size */
+#define LZW_HASH  (LZW_MAX * 2u)        /* encoder hash table size */
+#define LZW_CLEAR (256)                 /* code to empty the dictionary */
+#define LZW_FIRST (257u)                /* first code for a string */
+
+/* Time Series Parameters */
+#define SERIES_SAMPLE (16u) /* 64-bit timestamp, then a 64-bit value */
+enum { SERIES_DOUBLE = 'D', SERIES_INT = 'I', };
+
 #define MIN(X, Y) ((X) < (Y) ? (X) : (Y))
 
 enum { REFERENCE, LITERAL };
@@ -131,17 +230,25 @@ typedef struct {
 } buffer_t;
 
 typedef struct {
-	uint8_t buffer[N * 2];
+	const shrink_iovec_t *v;
+	size_t n, i, used; /* segments, current segment, bytes used in it */
+} iov_t;
+
+typedef struct {
+	uint8_t buffer[(N * 2) + LZSS_WIDE]; /* the decoder may write past N * 2 */
 	shrink_t *io;
 	bit_buffer_t bit;
+	int extended;     /* extended format, long matches and literal runs */
+	unsigned pending; /* extended format, literals not yet output */
+	unsigned run;     /* encoder, 'buffer[0]' to 'buffer[run - 1]' are still CH from 'init' */
 } lzss_t;
 
 int shrink_version(unsigned long *version) {
 	assert(version);
 	unsigned long options = 0;
-	options |= DEBUGGING << 0;
-	options |= STATIC_ON << 1;
-	*version = (options << 24) | SHRINK_VERSION;
+	options |= DEBUGGING ? SHRINK_VERSION_DEBUG : 0;
+	options |= STATIC_ON ? SHRINK_VERSION_STATIC : 0;
+	*version = options | SHRINK_VERSION;
 	return SHRINK_VERSION == 0 ? -1 : 0;
 }
 
@@ -163,22 +270,90 @@ static int buffer_put(const int ch, void *out) {
 	return b->b[b->used++] = ch;
 }
 
+static int iov_get(void *in) {
+	iov_t *v = in;
+	assert(v);
+	for (; v->i < v->n; v->i++, v->used = 0)
+		if (v->used < v->v[v->i].iov_len)
+			return ((unsigned char*)v->v[v->i].iov_base)[v->used++];
+	return ELINE;
+}
+
+static int iov_put(const int ch, void *out) {
+	iov_t *v = out;
+	assert(v);
+	for (; v->i < v->n; v->i++, v->used = 0)
+		if (v->used < v->v[v->i].iov_len)
+			return ((unsigned char*)v->v[v->i].iov_base)[v->used++] = ch;
+	return ELINE;
+}
+
+/* The 'progress' callback is checked for here as everything reads its input
+ * through 'get', once it has asked to stop 'get' returns an error from then
+ * on, which the CODECs deal with as they would any other, and 'stop' turns
+ * the result into SHRINK_CANCELLED. */
+static int progress(shrink_t *io) {
+	assert(io);
+	if (io->cancelled)
+		return SHRINK_CANCELLED;
+	if (io->progress(io->progress_arg, io->read, io->wrote)) {
+		io->cancelled = 1;
+		return SHRINK_CANCELLED;
+	}
+	io->mark = io->read;
+	return 0;
+}
+
+static void start(shrink_t *io) {
+	assert(io);
+	io->mark = io->read;
+	io->cancelled = 0;
+}
+
+static int stop(shrink_t *io, const int r) {
+	assert(io);
+	return io->cancelled ? SHRINK_CANCELLED : r;
+}
+
 static int get(shrink_t *io) {
 	assert(io);
+	if (io->progress && (io->read - io->mark) >= io->interval)
+		if (progress(io) < 0)
+			return SHRINK_CANCELLED;
 	const int r = io->get(io->in);
 	io->read += r >= 0;
 	assert(r <= 255);
 	return r;
 }
 
+/* If there is no 'put' callback the output is only counted, see
+ * 'shrink_t' in 'shrink.h', this is used to find out how big the output
+ * would be without producing it. */
 static int put(const int ch, shrink_t *io) {
 	assert(io);
+	if (!io->put) {
+		io->wrote++;
+		return ch;
+	}
 	const int r = io->put(ch, io->out);
 	io->wrote += r >= 0;
 	assert(r <= 255);
 	return r;
 }
 
+static int put_block(shrink_t *io, const uint8_t *b, const size_t length) {
+	assert(io);
+	assert(b);
+	if (!io->put) {
+		io->wrote += length;
+		return 0;
+	}
+	for (size_t k = 0; k < length; k++)
+		if (put(b[k], io) != b[k])
+			return ELINE;
+	return 0;
+}
+
 static int bit_buffer_put_bit(shrink_t *io, bit_buffer_t *bit, const unsigned one) {
 	assert(io);
 	assert(bit);
@@ -195,6 +370,48 @@ static int bit_buffer_put_bit(shrink_t *io, bit_buffer_t *bit, const unsigned on
 	return 0;
 }
 
+static unsigned bit_buffer_free(const unsigned mask) { /* bits left in the byte, 'mask' is the next */
+	assert(mask && mask <= 128u);
+	unsigned free = 1;
+	for (unsigned m = mask; m >>= 1;)
+		free++;
+	return free;
+}
+
+/* Output the lowest 'n' bits of 'v', most significant bit first. When only
+ * counting the bits are not assembled into bytes, the position within the
+ * current byte is all that needs to be kept track of. */
+static int bit_buffer_put_bits(shrink_t *io, bit_buffer_t *bit, const unsigned long v, unsigned n) {
+	assert(io);
+	assert(bit);
+	assert(n <= 32u);
+	if (!io->put) {
+		const unsigned free = bit_buffer_free(bit->mask);
+		if (n < free) {
+			bit->mask >>= n;
+			return 0;
+		}
+		n -= free;
+		io->wrote += 1ul + (n / 8u);
+		bit->mask = 128u >> (n % 8u);
+		return 0;
+	}
+	while (n) { /* as many bits as will fit in the current byte at a time */
+		assert(bit->mask && bit->mask <= 128u);
+		const unsigned free = bit_buffer_free(bit->mask), take = MIN(n, free);
+		n -= take;
+		bit->buffer |= ((v >> n) & ((1u << take) - 1u)) << (free - take);
+		bit->mask >>= take;
+		if (!bit->mask) {
+			if (put(bit->buffer, io) < 0)
+				return ELINE;
+			bit->buffer = 0;
+			bit->mask   = 128;
+		}
+	}
+	return 0;
+}
+
 static int bit_buffer_get_n_bits(shrink_t *io, bit_buffer_t *bit, unsigned n) {
 	assert(io);
 	assert(bit);
@@ -226,43 +443,294 @@ static int bit_buffer_flush(shrink_t *io, bit_buffer_t *bit) {
 	return 0;
 }
 
+static int bit_buffer_align(shrink_t *io, bit_buffer_t *bit) { /* for the writer */
+	assert(io);
+	assert(bit);
+	if (bit->mask != 128) {
+		if (put(bit->buffer, io) < 0)
+			return ELINE;
+		bit->buffer = 0;
+		bit->mask   = 128;
+	}
+	return 0;
+}
+
+/* Elias Gamma code for 'v' (which must be non-zero), the number of bits
+ * after the leading one is sent in unary as a run of ones ended by a zero,
+ * followed by those bits. This is the same as the Elias CODEC uses. */
+static int bit_buffer_put_gamma(shrink_t *io, bit_buffer_t *bit, const unsigned long v) {
+	assert(io);
+	assert(bit);
+	assert(v > 0);
+	int n = 0;
+	for (unsigned long t = v; t >>= 1;)
+		n++;
+	for (int i = 0; i < n; i++)
+		if (bit_buffer_put_bit(io, bit, 1) < 0)
+			return ELINE;
+	if (bit_buffer_put_bit(io, bit, 0) < 0)
+		return ELINE;
+	return bit_buffer_put_bits(io, bit, v, n);
+}
+
+static long bit_buffer_get_gamma(shrink_t *io, bit_buffer_t *bit) {
+	assert(io);
+	assert(bit);
+	int n = 0;
+	for (;;) {
+		const int b = bit_buffer_get_n_bits(io, bit, 1);
+		if (b < 0)
+			return ELINE;
+		if (b == 0)
+			break;
+		if (++n > 30)
+			return ELINE;
+	}
+	long v = 1;
+	while (n--) {
+		const int b = bit_buffer_get_n_bits(io, bit, 1);
+		if (b < 0)
+			return ELINE;
+		v = (v << 1) | b;
+	}
+	return v;
+}
+
+/* The first 'length' bytes of the window are the initial dictionary, the
+ * tail of the preset dictionary given in 'io' if there is one, with 'CH'
+ * before it. */
 static int init(lzss_t *l, const size_t length) {
 	assert(l);
+	assert(l->io);
 	assert(length < sizeof l->buffer);
-	memset(l->buffer, CH, length);
+	const shrink_t *io = l->io;
+	const size_t d = io->dictionary ? MIN(io->dictionary_length, length) : 0;
+	memset(l->buffer, CH, length - d);
+	l->run = length - d;
+	if (d)
+		memcpy(&l->buffer[length - d], io->dictionary + io->dictionary_length - d, d);
 	return 0;
 }
 
 static int output_literal(lzss_t *l, const unsigned ch) {
 	assert(l);
-	if (bit_buffer_put_bit(l->io, &l->bit, LITERAL) < 0)
+	return bit_buffer_put_bits(l->io, &l->bit, (LITERAL << 8) | ch, 9);
+}
+
+static int output_reference(lzss_t *l, const unsigned position, const unsigned long length) {
+	assert(l);
+	assert(position < (1 << EI));
+	implies(!l->extended, length < ((1 << EJ) + P));
+	const unsigned code = l->extended ? MIN(length, LZSSX_ESCAPE) : length;
+	const unsigned long token = ((unsigned long)REFERENCE << (EI + EJ)) | ((unsigned long)position << EJ) | code;
+	if (bit_buffer_put_bits(l->io, &l->bit, token, 1 + EI + EJ) < 0)
 		return ELINE;
-	for (unsigned mask = 256; mask >>= 1; )
-		if (bit_buffer_put_bit(l->io, &l->bit, ch & mask) < 0)
-			return ELINE;
+	if (code == LZSSX_ESCAPE && l->extended)
+		return bit_buffer_put_gamma(l->io, &l->bit, length - LZSSX_ESCAPE + 1ul);
 	return 0;
 }
 
-static int output_reference(lzss_t *l, const unsigned position, const unsigned length) {
+static unsigned lzss_match(const lzss_t *l, const unsigned s, const unsigned r, const unsigned bufferend, unsigned *position) {
 	assert(l);
-	assert(position < (1 << EI));
-	assert(length < ((1 << EJ) + P));
-	if (bit_buffer_put_bit(l->io, &l->bit, REFERENCE) < 0)
+	assert(position);
+	assert(r < bufferend);
+	unsigned x = 0, y = 1;
+	const int ch = l->buffer[r];
+	const unsigned f1 = (F <= bufferend - r) ? F : bufferend - r;
+	for (unsigned i = s; i < r; i++) { /* search for longest match */
+		assert(r >= r - i);
+		const uint8_t *m = memchr(&l->buffer[i], ch, r - i); /* match first char */
+		if (!m)
+			break;
+		assert(i < sizeof l->buffer);
+		i += m - &l->buffer[i];
+		unsigned j = 1;
+		for (j = 1; j < f1; j++) { /* run of matches */
+			assert((i + j) < sizeof l->buffer);
+			assert((r + j) < sizeof l->buffer);
+			if (l->buffer[i + j] != l->buffer[r + j])
+				break;
+		}
+		if (j > y) {
+			x = i; /* match position */
+			y = j; /* match length */
+		}
+		if ((y + P - 1) > F) /* maximum length reach, stop search */
+			break;
+		if ((i + j) < l->run) /* the same match at each position until it reaches the end of the run */
+			i = l->run - j - 1u;
+	}
+	*position = x;
+	return y;
+}
+
+/* In the extended format literals are held back until the next reference,
+ * a long enough run of them is cheaper to send as a literal run token: a
+ * reference with a length field of zero (which LZSS never uses) and the run
+ * length in the position field, followed by the bytes themselves starting
+ * on the next byte boundary. They are pending at 'buffer[r - pending]' to
+ * 'buffer[r - 1]'. */
+static int output_literals(lzss_t *l, const unsigned r) {
+	assert(l);
+	assert(l->extended);
+	assert(r >= l->pending);
+	const unsigned n = l->pending;
+	const uint8_t *b = &l->buffer[r - n];
+	l->pending = 0;
+	if (n < LZSSX_RUN) {
+		for (unsigned k = 0; k < n; k++)
+			if (output_literal(l, b[k]) < 0)
+				return ELINE;
+		return 0;
+	}
+	assert(n <= N);
+	if (output_reference(l, n - 1u, 0) < 0)
+		return ELINE;
+	if (bit_buffer_align(l->io, &l->bit) < 0)
 		return ELINE;
-	for (unsigned mask = N; mask >>= 1;)
-		if (bit_buffer_put_bit(l->io, &l->bit, position & mask) < 0)
+	return put_block(l->io, b, n);
+}
+
+static int lzss_emit(lzss_t *l, const unsigned r, const unsigned position, const unsigned long length) {
+	assert(l);
+	if (length <= P) { /* is match worth it? Not worth it... */
+		if (!l->extended)
+			return output_literal(l, l->buffer[r]);
+		if (++l->pending >= N)
+			return output_literals(l, r + 1u);
+		return 0;
+	}
+	if (l->extended)
+		if (output_literals(l, r) < 0)
 			return ELINE;
-	for (unsigned mask = 1 << EJ; mask >>= 1; )
-		if (bit_buffer_put_bit(l->io, &l->bit, length & mask) < 0)
+	/* L'Oreal: Because you're worth it. */
+	return output_reference(l, position & (N - 1u), length - P);
+}
+
+static void lzss_slide(lzss_t *l, unsigned *r, unsigned *bufferend) { /* move and refill buffer */
+	assert(l);
+	assert(r);
+	assert(bufferend);
+	BUILD_BUG_ON(sizeof l->buffer < N);
+	memmove(l->buffer, l->buffer + N, N);
+	l->run = 0;
+	assert(*bufferend - N < *bufferend);
+	assert((*r - N) < *r);
+	*bufferend -= N;
+	*r -= N;
+	while (*bufferend < (N * 2u)) {
+		int c = get(l->io);
+		if (c < 0)
+			break;
+		assert(*bufferend < sizeof(l->buffer));
+		l->buffer[(*bufferend)++] = c;
+	}
+}
+
+/* In the extended format a maximal match found at 'r' is not limited by the
+ * lookahead buffer, it carries on comparing against the byte the same
+ * distance back, moving the buffer along as needed, for up to LZSSX_MAX
+ * bytes. On return 'r' is one past the end of the match, which has been
+ * output. */
+static int lzss_extend(lzss_t *l, const unsigned position, unsigned *r, unsigned *bufferend) {
+	assert(l);
+	assert(r);
+	assert(bufferend);
+	assert(l->extended);
+	assert(position < *r);
+	if (output_literals(l, *r) < 0) /* the buffer might be about to move */
+		return ELINE;
+	const unsigned distance = *r - position;
+	unsigned long y = F;
+	unsigned q = *r + F;
+	assert(distance <= (N - F));
+	for (; y < LZSSX_MAX; y++, q++) {
+		if (q >= *bufferend) {
+			if (*bufferend < (N * 2u)) /* no more input */
+				break;
+			lzss_slide(l, &q, bufferend);
+			if (q >= *bufferend)
+				break;
+		}
+		assert(q >= distance);
+		if (l->buffer[q] != l->buffer[q - distance])
+			break;
+	}
+	*r = q;
+	return output_reference(l, position & (N - 1u), y - P);
+}
+
+/* The decoder pays a fixed price to dispatch on each token plus a price for
+ * each bit it pulls from the input, the bytes produced are the same whatever
+ * the parse. 'lzss_parse' finds the cheapest parse of a block of up to
+ * LZSS_PARSE positions under that model, instead of greedily taking the
+ * longest match, which favours fewer and longer tokens over isolated
+ * literals and short references. The output is a standard LZSS stream. */
+#define LZSS_COST_LITERAL   (LZSS_COST_TOKEN + (LZSS_COST_BIT * (1u + 8u)))
+#define LZSS_COST_REFERENCE (LZSS_COST_TOKEN + (LZSS_COST_BIT * (1u + EI + EJ)))
+
+static int lzss_parse(lzss_t *l, unsigned *rp, unsigned *bufferend) {
+	assert(l);
+	assert(rp);
+	assert(bufferend);
+	unsigned r = *rp, e = r + LZSS_PARSE;
+	uint16_t length[LZSS_PARSE], position[LZSS_PARSE];
+	uint32_t cost[LZSS_PARSE + 1];
+	BUILD_BUG_ON(LZSS_PARSE < 1);
+	BUILD_BUG_ON(LZSS_PARSE > ((N * 2u) - F));
+	e = MIN(e, *bufferend);
+	e = MIN(e, (N * 2u) - F); /* every position in the block must have a full lookahead */
+	assert(r < e);
+
+	for (unsigned q = r; q < e; q++) {
+		unsigned x = 0;
+		length[q - r]   = lzss_match(l, q - (N - F), q, *bufferend, &x);
+		position[q - r] = x;
+	}
+
+	cost[e - r] = 0; /* anything past the block is treated as free */
+	for (unsigned q = e; q-- > r;) {
+		const unsigned k = q - r, longest = length[k];
+		uint32_t best = LZSS_COST_LITERAL + cost[k + 1];
+		unsigned choice = 1;
+		for (unsigned y = P + 1; y <= longest; y++) {
+			const uint32_t c = LZSS_COST_REFERENCE + ((k + y) < (e - r) ? cost[k + y] : 0);
+			if (c <= best) { /* prefer the longer copy when costs are even */
+				best = c;
+				choice = y;
+			}
+		}
+		cost[k]   = best;
+		length[k] = choice;
+	}
+
+	/* The parse is least certain towards the end of the block, so unless
+	 * that is the end of the input those positions are parsed again with
+	 * the next block. */
+	const unsigned stop = (e == *bufferend || (e - r) <= F) ? e : e - F;
+	while (r < stop) {
+		const unsigned k = r - *rp, x = position[k], y = length[k];
+		if (l->extended && y == F) { /* the match may carry on past the block */
+			const int e = lzss_extend(l, x, &r, bufferend);
+			*rp = r;
+			return e;
+		}
+		if (lzss_emit(l, r, x, y) < 0)
 			return ELINE;
+		r += y;
+	}
+	*rp = r;
 	return 0;
 }
 
-static int shrink_lzss_encode(shrink_t *io) {
+static int lzss_encode(shrink_t *io, const int extended) {
 	assert(io);
 	STATIC lzss_t l = { .bit = { .mask = 128, }, };
 	l.io = io; /* need because of STATIC */
+	l.extended = extended;
+	l.pending = 0;
 	unsigned bufferend = 0;
+	const int speed = !!(io->options & SHRINK_OPT_DECODE_SPEED);
 
 	if (init(&l, N - F) < 0)
 		return ELINE;
@@ -274,81 +742,164 @@ static int shrink_lzss_encode(shrink_t *io) {
 		l.buffer[bufferend] = c;
 	}
 
-	for (unsigned r = N - F, s = 0; r < bufferend; ) {
-		unsigned x = 0, y = 1;
-		const int ch = l.buffer[r];
-		for (unsigned i = s; i < r; i++) { /* search for longest match */
-			assert(r >= r - i);
-			uint8_t *m = memchr(&l.buffer[i], ch, r - i); /* match first char */
-			if (!m)
-				break;
-			assert(i < sizeof l.buffer);
-			i += m - &l.buffer[i];
-			const unsigned f1 = (F <= bufferend - r) ? F : bufferend - r;
-			unsigned j = 1;
-			for (j = 1; j < f1; j++) { /* run of matches */
-				assert((i + j) < sizeof l.buffer);
-				assert((r + j) < sizeof l.buffer);
-				if (l.buffer[i + j] != l.buffer[r + j])
-					break;
-			}
-			if (j > y) {
-				x = i; /* match position */
-				y = j; /* match length */
+	/* The search window for 'r' starts at 'r - (N - F)' */
+	for (unsigned r = N - F; r < bufferend; ) {
+		if (speed) {
+			if (lzss_parse(&l, &r, &bufferend) < 0)
+				return ELINE;
+		} else {
+			unsigned x = 0, y = lzss_match(&l, r - (N - F), r, bufferend, &x);
+			if (y <= P)
+				y = 1;
+			if (extended && y == F) {
+				if (lzss_extend(&l, x, &r, &bufferend) < 0)
+					return ELINE;
+			} else {
+				if (lzss_emit(&l, r, x, y) < 0)
+					return ELINE;
+				assert((r + y) > r);
+				r += y;
 			}
-			if ((y + P - 1) > F) /* maximum length reach, stop search */
-				break;
 		}
-		if (y <= P) { /* is match worth it? */
-			y = 1;
-			if (output_literal(&l, ch) < 0) /* Not worth it */
+		if (r >= ((N * 2u) - F)) {
+			if (extended && output_literals(&l, r) < 0)
 				return ELINE;
-		} else { /* L'Oreal: Because you're worth it. */
-			if (output_reference(&l, x & (N - 1u), y - P) < 0)
-				return ELINE;
-		}
-		assert((r + y) > r);
-		assert((s + y) > s);
-		r += y;
-		s += y;
-		if (r >= ((N * 2u) - F)) { /* move and refill buffer */
-			BUILD_BUG_ON(sizeof l.buffer < N);
-			memmove(l.buffer, l.buffer + N, N);
-			assert(bufferend - N < bufferend);
-			assert((r - N) < r);
-			assert((s - N) < s);
-			bufferend -= N;
-			r -= N;
-			s -= N;
-			while (bufferend < (N * 2u)) {
-				int c = get(l.io);
-				if (c < 0)
-					break;
-				assert(bufferend < sizeof(l.buffer));
-				l.buffer[bufferend++] = c;
-			}
+			lzss_slide(&l, &r, &bufferend);
 		}
 	}
+	if (extended && output_literals(&l, bufferend) < 0)
+		return ELINE;
 	return bit_buffer_flush(l.io, &l.bit);
 }
 
-static int shrink_lzss_decode(shrink_t *io) {
+static int shrink_lzss_encode(shrink_t *io) {
+	return lzss_encode(io, 0);
+}
+
+static int shrink_lzssx_encode(shrink_t *io) {
+	return lzss_encode(io, 1);
+}
+
+/* The decoder keeps its window linear in 'l->buffer', the last N bytes
+ * written are always 'buffer[w - N]' to 'buffer[w - 1]' and the byte at
+ * 'buffer[w - N + k]' is what the encoder calls position '(r + k) % N'. When
+ * there is no more room the window is moved back down to the start of the
+ * buffer, which means a match is never split by wrapping around a ring. */
+static void lzss_window(lzss_t *l, unsigned *w) {
+	assert(l);
+	assert(w);
+	assert(*w >= N);
+	memmove(l->buffer, l->buffer + *w - N, N);
+	*w = N;
+}
+
+/* Copy 'length' bytes that start 'distance' bytes back, which may overlap
+ * with the bytes being written. Distance one is a run of a single byte,
+ * short distances replicate the pattern in ever doubling blocks, and longer
+ * distances are copied in fixed sized blocks which may write up to
+ * LZSS_WIDE - 1 bytes past the end of the copy (hence the margin at the end
+ * of the buffer). */
+static void lzss_copy(uint8_t *dst, const unsigned distance, const unsigned length) {
+	assert(dst);
+	assert(distance > 0);
+	const uint8_t *src = dst - distance;
+	if (distance == 1) {
+		memset(dst, *src, length);
+	} else if (distance >= LZSS_WIDE) {
+		for (unsigned k = 0; k < length; k += LZSS_WIDE)
+			memcpy(dst + k, src + k, LZSS_WIDE);
+	} else if (distance >= (LZSS_WIDE / 2u)) {
+		for (unsigned k = 0; k < length; k += LZSS_WIDE / 2u)
+			memcpy(dst + k, src + k, LZSS_WIDE / 2u);
+	} else if (distance >= length) {
+		memcpy(dst, src, length);
+	} else {
+		memcpy(dst, src, distance);
+		for (unsigned k = distance; k < length;) {
+			const unsigned n = MIN(k, length - k); /* 'k' is always a multiple of 'distance' */
+			memcpy(dst + k, dst, n);
+			k += n;
+		}
+	}
+}
+
+static int lzss_output(shrink_t *io, const uint8_t *b, const unsigned length) {
+	return put_block(io, b, length);
+}
+
+/* Optional checkpointing of the decoder, every 'interval' bytes of output
+ * the state of the decoder is passed to 'checkpoint', which can be used to
+ * start decoding from that point later on. */
+typedef struct {
+	int (*checkpoint)(void *arg, const shrink_checkpoint_t *c);
+	void *arg;
+	unsigned long long interval;
+} lzss_index_t;
+
+static unsigned bit_buffer_remaining(const bit_buffer_t *bit) { /* for the reader */
+	assert(bit);
+	unsigned n = 0;
+	for (unsigned m = bit->mask; m; m >>= 1)
+		n++;
+	return n;
+}
+
+static int lzss_decode(shrink_t *io, const int extended, const shrink_checkpoint_t *from, const lzss_index_t *index) {
 	assert(io);
 	STATIC lzss_t l = { .bit = { .mask = 0, }, };
 	l.io = io; /* need because of STATIC */
+	l.bit.mask = 0;
+	l.extended = extended;
+	const size_t read = io->read, wrote = io->wrote;
+	unsigned long long base = 0, offset = 0, next = 0;
+	unsigned r = N - F, w = N;
+	int c = 0;
 
-	if (init(&l, N - F) < 0)
-		return ELINE;
+	if (from) { /* 'io' is at the byte containing the bit we start from */
+		if (from->window_length != N || from->position >= N)
+			return ELINE;
+		memcpy(l.buffer, from->window, N);
+		r = from->position;
+		base = from->bit / 8ull;
+		offset = from->offset;
+		next = offset + (index ? index->interval : 0);
+		if (from->bit % 8ull) {
+			if ((c = get(l.io)) < 0)
+				return ELINE;
+			l.bit.buffer = c;
+			l.bit.mask = 128u >> (from->bit % 8ull);
+		}
+	} else {
+		if (init(&l, N - F) < 0) /* positions 0 to N - F - 1 ... */
+			return ELINE;
+		memmove(l.buffer + F, l.buffer, N - F); /* ...are the last bytes of the window */
+		memset(l.buffer, 0, F);
+	}
 
-	int c = 0;
-	for (unsigned r = N - F; (c = bit_buffer_get_n_bits(l.io, &l.bit, 1)) >= 0; ) {
+	for (;;) {
+		if (index && (offset + (io->wrote - wrote)) >= next) {
+			const shrink_checkpoint_t cp = {
+				.bit = ((base + (io->read - read)) * 8ull) - bit_buffer_remaining(&l.bit),
+				.offset = offset + (io->wrote - wrote),
+				.position = r,
+				.window = &l.buffer[w - N],
+				.window_length = N,
+			};
+			if (index->checkpoint(index->arg, &cp) < 0)
+				return ELINE;
+			next = cp.offset + index->interval;
+		}
+		if ((c = bit_buffer_get_n_bits(l.io, &l.bit, 1)) < 0)
+			break;
 		if (c == LITERAL) { /* control bit: literal, emit a byte */
 			if ((c = bit_buffer_get_n_bits(l.io, &l.bit, 8)) < 0)
 				break;
 			if (put(c, l.io) != c)
 				return ELINE;
-			l.buffer[r++] = c;
-			r &= (N - 1u); /* wrap around */
+			if (w >= (N * 2u))
+				lzss_window(&l, &w);
+			l.buffer[w++] = c;
+			r = (r + 1u) & (N - 1u); /* wrap around */
 			continue;
 		}
 		const int i = bit_buffer_get_n_bits(l.io, &l.bit, EI); /* position */
@@ -357,61 +908,406 @@ static int shrink_lzss_decode(shrink_t *io) {
 		const int j = bit_buffer_get_n_bits(l.io, &l.bit, EJ); /* length */
 		if (j < 0)
 			break;
-		for (unsigned k = 0; k < j + P; k++) { /* copy (pos,len) to output and dictionary */
-			c = l.buffer[(i + k) & (N - 1)];
-			if (put(c, l.io) != c)
+		if (extended && j == 0) { /* literal run, starting on next byte boundary */
+			l.bit.mask = 0;
+			for (unsigned n = i + 1u; n;) {
+				if (w >= (N * 2u))
+					lzss_window(&l, &w);
+				const unsigned m = MIN(n, (N * 2u) - w);
+				for (unsigned k = 0; k < m; k++) {
+					if ((c = get(l.io)) < 0)
+						return ELINE;
+					l.buffer[w + k] = c;
+				}
+				if (lzss_output(l.io, &l.buffer[w], m) < 0)
+					return ELINE;
+				w += m;
+				n -= m;
+			}
+			r = (r + i + 1u) & (N - 1u);
+			continue;
+		}
+		unsigned long length = j + P;
+		if (extended && j == LZSSX_ESCAPE) {
+			const long ext = bit_buffer_get_gamma(l.io, &l.bit);
+			if (ext < 0)
+				break;
+			length += ext - 1ul;
+			if (length > LZSSX_MAX)
+				return ELINE;
+		}
+		const unsigned distance = ((r - i - 1u) & (N - 1u)) + 1u;
+		r = (r + length) & (N - 1u);
+		while (length) { /* copy (pos,len) to output and dictionary */
+			if (w >= (N * 2u))
+				lzss_window(&l, &w);
+			const unsigned n = MIN(length, (N * 2u) - w);
+			assert(w >= distance);
+			lzss_copy(&l.buffer[w], distance, n);
+			if (lzss_output(l.io, &l.buffer[w], n) < 0)
 				return ELINE;
-			l.buffer[r++] = c;
-			r &= (N - 1u); /* wrap around */
+			w += n;
+			length -= n;
 		}
 	}
 	return 0;
 }
 
-static int rle_write_buf(shrink_t *io, uint8_t *buf, const int idx) {
-	assert(io);
-	assert(buf);
-	assert(idx >= 0);
-	if (idx == 0)
-		return 0;
-	if (put(idx + RL, io) < 0)
-		return ELINE;
-	for (int i = 0; i < idx; i++)
-		if (put(buf[i], io) < 0)
+static int shrink_lzss_decode(shrink_t *io) {
+	return lzss_decode(io, 0, NULL, NULL);
+}
+
+static int shrink_lzssx_decode(shrink_t *io) {
+	return lzss_decode(io, 1, NULL, NULL);
+}
+
+/* The read back decoder has no window, references are resolved by reading
+ * the bytes back from what has already been output with 'fetch', so the
+ * memory used does not depend on the window size. The last LZSS_RECENT
+ * bytes output are kept, which covers runs and other short distance
+ * matches, anything further back goes through a cache of LZSS_CACHE bytes.
+ * Bytes from before the start of the output come from the initial window. */
+typedef struct {
+	shrink_t *io;
+	int (*fetch)(void *out, unsigned long long offset, unsigned char *b, size_t length);
+	uint8_t recent[LZSS_RECENT], cache[LZSS_CACHE];
+	unsigned long long wrote, cached; /* bytes output, offset of 'cache' */
+	int valid;                        /* 'cache' holds something */
+} lzss_readback_t;
+
+static int readback_byte(lzss_readback_t *b, const unsigned distance) {
+	assert(b);
+	assert(distance > 0 && distance <= N);
+	if (distance > b->wrote) {
+		const unsigned long long k = distance - b->wrote; /* one is the last byte of the initial window */
+		if (k > (N - F))
+			return 0;
+		const shrink_t *io = b->io;
+		const size_t d = io->dictionary ? MIN(io->dictionary_length, N - F) : 0;
+		return k <= d ? io->dictionary[io->dictionary_length - k] : CH;
+	}
+	if (distance <= LZSS_RECENT)
+		return b->recent[(b->wrote - distance) & (LZSS_RECENT - 1u)];
+	const unsigned long long s = b->wrote - distance; /* 's + LZSS_CACHE' is never past the output */
+	if (!b->valid || s < b->cached || s >= (b->cached + LZSS_CACHE)) {
+		if (b->fetch(b->io->out, s, b->cache, LZSS_CACHE) < 0)
 			return ELINE;
-	return 0;
+		b->cached = s;
+		b->valid = 1;
+	}
+	return b->cache[s - b->cached];
 }
 
-static int rle_write_run(shrink_t *io, const int count, const int ch) {
-	assert(io);
-	assert(ch >= 0 && ch < 256);
-	assert(count >= 0);
-	if (put(count, io) < 0)
-		return ELINE;
-	if (put(ch, io) < 0)
+static int readback_put(lzss_readback_t *b, const int ch) {
+	assert(b);
+	if (put(ch, b->io) != ch)
 		return ELINE;
-	return 0;
+	b->recent[b->wrote++ & (LZSS_RECENT - 1u)] = ch;
+	return ch;
 }
 
-static int shrink_rle_encode(shrink_t *io) { /* this could do with simplifying... */
+static int lzss_readback(shrink_t *io, const int extended, int (*fetch)(void *out, unsigned long long offset, unsigned char *b, size_t length)) {
 	assert(io);
-	uint8_t buf[RL] = { 0, }; /* buffer to store data with no runs */
-	int idx = 0, prev = -1;
-	for (int c = 0; (c = get(io)) >= 0; prev = c) {
-		if (c == prev) { /* encode runs of data */
-			int j = 0, k = 0;  /* count of runs */
-			if (idx == 1 && buf[0] == c) {
-				k++;
-				idx = 0;
-			}
-again:
-			for (j = k; (c = get(io)) == prev && j < RL + ROVER; j++)
-				/*loop does everything*/;
-			k = 0;
-			if (j > ROVER) { /* run length is worth encoding */
-				if (idx >= 1) { /* output any existing data */
-					if (rle_write_buf(io, buf, idx) < 0)
-						return ELINE;
+	assert(fetch);
+	BUILD_BUG_ON(LZSS_CACHE > LZSS_RECENT);
+	BUILD_BUG_ON((LZSS_RECENT - 1u) & LZSS_RECENT);
+	STATIC lzss_readback_t b;
+	b.io = io; /* need because of STATIC */
+	b.fetch = fetch;
+	b.wrote = 0;
+	b.valid = 0;
+	bit_buffer_t bit = { .mask = 0, };
+	unsigned r = N - F;
+	for (;;) {
+		int c = 0;
+		if ((c = bit_buffer_get_n_bits(io, &bit, 1)) < 0)
+			break;
+		if (c == LITERAL) {
+			if ((c = bit_buffer_get_n_bits(io, &bit, 8)) < 0)
+				break;
+			if (readback_put(&b, c) < 0)
+				return ELINE;
+			r = (r + 1u) & (N - 1u);
+			continue;
+		}
+		const int i = bit_buffer_get_n_bits(io, &bit, EI);
+		if (i < 0)
+			break;
+		const int j = bit_buffer_get_n_bits(io, &bit, EJ);
+		if (j < 0)
+			break;
+		if (extended && j == 0) { /* literal run */
+			bit.mask = 0;
+			for (int n = 0; n <= i; n++) {
+				if ((c = get(io)) < 0)
+					return ELINE;
+				if (readback_put(&b, c) < 0)
+					return ELINE;
+			}
+			r = (r + i + 1u) & (N - 1u);
+			continue;
+		}
+		unsigned long length = j + P;
+		if (extended && j == LZSSX_ESCAPE) {
+			const long ext = bit_buffer_get_gamma(io, &bit);
+			if (ext < 0)
+				break;
+			length += ext - 1ul;
+			if (length > LZSSX_MAX)
+				return ELINE;
+		}
+		const unsigned distance = ((r - i - 1u) & (N - 1u)) + 1u;
+		r = (r + length) & (N - 1u);
+		for (; length; length--) {
+			if ((c = readback_byte(&b, distance)) < 0)
+				return ELINE;
+			if (readback_put(&b, c) < 0)
+				return ELINE;
+		}
+	}
+	return 0;
+}
+
+/* The repeat offset format is LZSS with references given as a distance back
+ * from the current position instead of a position in the ring, and with the
+ * last LZSSR_REPS distances used kept in most recently used order by both
+ * the encoder and decoder. A reference that uses one of those distances
+ * again only needs to send which one it is, which makes data that repeats
+ * at a fixed stride, such as tables of fixed size records, much cheaper to
+ * encode. The tokens are:
+ *
+ *	1 [8 bit literal]
+ *	0 0 [EI bit distance - 1] [EJ bit length - P]
+ *	0 1 [LZSSR_REP_BITS bit index] [EJ bit length - P]
+ *
+ * A repeat offset reference can be as short as P bytes, as it is smaller
+ * than the P literals it replaces. */
+static void lzssr_use(unsigned *rep, const unsigned k, const unsigned distance) {
+	assert(rep);
+	assert(k < LZSSR_REPS);
+	memmove(rep + 1, rep, k * sizeof (*rep));
+	rep[0] = distance;
+}
+
+static unsigned lzssr_match(const lzss_t *l, const unsigned distance, const unsigned r, const unsigned bufferend) {
+	assert(l);
+	assert(r < bufferend);
+	assert(distance <= r);
+	const unsigned f1 = MIN(F, bufferend - r);
+	unsigned j = 0;
+	for (j = 0; j < f1; j++)
+		if (l->buffer[r + j] != l->buffer[r + j - distance])
+			break;
+	return j;
+}
+
+static int shrink_lzssr_encode(shrink_t *io) {
+	assert(io);
+	STATIC lzss_t l = { .bit = { .mask = 128, }, };
+	l.io = io; /* need because of STATIC */
+	l.extended = 0;
+	l.pending = 0;
+	unsigned bufferend = 0, rep[LZSSR_REPS] = { 0, };
+	for (unsigned k = 0; k < LZSSR_REPS; k++)
+		rep[k] = k + 1u;
+
+	if (init(&l, N - F) < 0)
+		return ELINE;
+
+	for (bufferend = N - F; bufferend < N * 2u; bufferend++) {
+		const int c = get(l.io);
+		if (c < 0)
+			break;
+		l.buffer[bufferend] = c;
+	}
+
+	for (unsigned r = N - F; r < bufferend; ) {
+		unsigned k = 0, y = 0;
+		for (unsigned i = 0; i < LZSSR_REPS; i++) { /* repeat offsets first... */
+			const unsigned m = lzssr_match(&l, rep[i], r, bufferend);
+			if (m > y) {
+				k = i;
+				y = m;
+			}
+		}
+		unsigned x = 0, z = 0;
+		if (y < F) /* ...a full search is only needed if they are not good enough */
+			z = lzss_match(&l, r - (N - F), r, bufferend, &x);
+		if (z > P && z > (y + 1u)) { /* worth the longer token */
+			const unsigned distance = r - x;
+			assert(distance > 0 && distance <= (N - F));
+			const unsigned long token = ((unsigned long)(distance - 1u) << EJ) | (z - P);
+			if (bit_buffer_put_bits(l.io, &l.bit, REFERENCE << 1, 2) < 0)
+				return ELINE;
+			if (bit_buffer_put_bits(l.io, &l.bit, token, EI + EJ) < 0)
+				return ELINE;
+			lzssr_use(rep, LZSSR_REPS - 1u, distance);
+			r += z;
+		} else if (y >= P) {
+			const unsigned long token = ((unsigned long)k << EJ) | (y - P);
+			if (bit_buffer_put_bits(l.io, &l.bit, (REFERENCE << 1) | 1u, 2) < 0)
+				return ELINE;
+			if (bit_buffer_put_bits(l.io, &l.bit, token, LZSSR_REP_BITS + EJ) < 0)
+				return ELINE;
+			lzssr_use(rep, k, rep[k]);
+			r += y;
+		} else {
+			if (output_literal(&l, l.buffer[r]) < 0)
+				return ELINE;
+			r++;
+		}
+		if (r >= ((N * 2u) - F))
+			lzss_slide(&l, &r, &bufferend);
+	}
+	return bit_buffer_flush(l.io, &l.bit);
+}
+
+static int shrink_lzssr_decode(shrink_t *io) {
+	assert(io);
+	STATIC lzss_t l = { .bit = { .mask = 0, }, };
+	l.io = io; /* need because of STATIC */
+	l.bit.mask = 0;
+	unsigned w = N, rep[LZSSR_REPS] = { 0, };
+	for (unsigned k = 0; k < LZSSR_REPS; k++)
+		rep[k] = k + 1u;
+
+	if (init(&l, N - F) < 0) /* see 'lzss_decode' */
+		return ELINE;
+	memmove(l.buffer + F, l.buffer, N - F);
+	memset(l.buffer, 0, F);
+
+	for (;;) {
+		int c = 0;
+		if ((c = bit_buffer_get_n_bits(l.io, &l.bit, 1)) < 0)
+			break;
+		if (c == LITERAL) {
+			if ((c = bit_buffer_get_n_bits(l.io, &l.bit, 8)) < 0)
+				break;
+			if (put(c, l.io) != c)
+				return ELINE;
+			if (w >= (N * 2u))
+				lzss_window(&l, &w);
+			l.buffer[w++] = c;
+			continue;
+		}
+		const int repeat = bit_buffer_get_n_bits(l.io, &l.bit, 1);
+		if (repeat < 0)
+			break;
+		unsigned distance = 0;
+		if (repeat) {
+			const int k = bit_buffer_get_n_bits(l.io, &l.bit, LZSSR_REP_BITS);
+			if (k < 0)
+				break;
+			distance = rep[k];
+			lzssr_use(rep, k, distance);
+		} else {
+			const int i = bit_buffer_get_n_bits(l.io, &l.bit, EI);
+			if (i < 0)
+				break;
+			distance = i + 1u;
+			lzssr_use(rep, LZSSR_REPS - 1u, distance);
+		}
+		const int j = bit_buffer_get_n_bits(l.io, &l.bit, EJ);
+		if (j < 0)
+			break;
+		const unsigned length = j + P;
+		if ((w + length) > (N * 2u))
+			lzss_window(&l, &w);
+		assert(w >= distance);
+		lzss_copy(&l.buffer[w], distance, length);
+		if (lzss_output(l.io, &l.buffer[w], length) < 0)
+			return ELINE;
+		w += length;
+	}
+	return 0;
+}
+
+#define ELEM (256)
+
+static int mtf_init(unsigned char *model) {
+	assert(model);
+	for (size_t i = 0; i < ELEM; i++)
+		model[i] = i;
+	return 0;
+}
+
+static int mtf_find(const unsigned char *model, int ch) {
+	assert(model);
+	const unsigned char *m = memchr(model, ch, ELEM);
+	return m ? m - model : -1;
+}
+
+static int mtf_update(unsigned char *model, const int index) {
+	assert(model);
+	assert(index >= 0 && index < ELEM);
+	const int m = model[index];
+	memmove(model + 1, model, index);
+	model[0] = m;
+	return index;
+}
+
+/* The fused CODECs, CODEC_MTF_RLE and CODEC_MTF_ELIAS, pass each byte
+ * through the Move-To-Front model as it is read, or written, instead of
+ * running CODEC_MTF as a stage of its own. The output is the same as if it
+ * were. 'model' is NULL when the CODEC is used on its own. */
+static int mtf_get(shrink_t *io, unsigned char *model) {
+	assert(io);
+	const int ch = get(io);
+	return ch < 0 || !model ? ch : mtf_update(model, mtf_find(model, ch));
+}
+
+static int mtf_put(const int index, shrink_t *io, unsigned char *model) {
+	assert(io);
+	assert(index >= 0 && index < ELEM);
+	if (!model)
+		return put(index, io) != index ? ELINE : 0;
+	const int e = model[index];
+	memmove(model + 1, model, index);
+	model[0] = e;
+	return put(e, io) != e ? ELINE : 0;
+}
+
+static int rle_write_buf(shrink_t *io, uint8_t *buf, const int idx) {
+	assert(io);
+	assert(buf);
+	assert(idx >= 0);
+	if (idx == 0)
+		return 0;
+	if (put(idx + RL, io) < 0)
+		return ELINE;
+	return put_block(io, buf, idx);
+}
+
+static int rle_write_run(shrink_t *io, const int count, const int ch) {
+	assert(io);
+	assert(ch >= 0 && ch < 256);
+	assert(count >= 0);
+	if (put(count, io) < 0)
+		return ELINE;
+	if (put(ch, io) < 0)
+		return ELINE;
+	return 0;
+}
+
+static int rle_encode(shrink_t *io, unsigned char *model) { /* this could do with simplifying... */
+	assert(io);
+	uint8_t buf[RL] = { 0, }; /* buffer to store data with no runs */
+	int idx = 0, prev = -1;
+	for (int c = 0; (c = mtf_get(io, model)) >= 0; prev = c) {
+		if (c == prev) { /* encode runs of data */
+			int j = 0, k = 0;  /* count of runs */
+			if (idx == 1 && buf[0] == c) {
+				k++;
+				idx = 0;
+			}
+again:
+			for (j = k; (c = mtf_get(io, model)) == prev && j < RL + ROVER; j++)
+				/*loop does everything*/;
+			k = 0;
+			if (j > ROVER) { /* run length is worth encoding */
+				if (idx >= 1) { /* output any existing data */
+					if (rle_write_buf(io, buf, idx) < 0)
+						return ELINE;
 					idx = 0;
 				}
 				if (rle_write_run(io, j - ROVER, prev) < 0)
@@ -447,7 +1343,7 @@ end: /* no more input */
 	return 0;
 }
 
-static int shrink_rle_decode(shrink_t *io) {
+static int rle_decode(shrink_t *io, unsigned char *model) {
 	assert(io);
 	for (int c = 0, count = 0; (c = get(io)) >= 0;) {
 		if (c > RL) { /* process run of literal data */
@@ -455,7 +1351,7 @@ static int shrink_rle_decode(shrink_t *io) {
 			for (int i = 0; i < count; i++) {
 				if ((c = get(io)) < 0)
 					return ELINE;
-				if (put(c, io) != c)
+				if (mtf_put(c, io, model) < 0)
 					return ELINE;
 			}
 			continue;
@@ -465,12 +1361,31 @@ static int shrink_rle_decode(shrink_t *io) {
 		if ((c = get(io)) < 0)
 			return ELINE;
 		for (int i = 0; i < count; i++)
-			if (put(c, io) != c)
+			if (mtf_put(c, io, model) < 0)
 				return ELINE;
 	}
 	return 0;
 }
 
+static int shrink_rle_encode(shrink_t *io) { return rle_encode(io, NULL); }
+static int shrink_rle_decode(shrink_t *io) { return rle_decode(io, NULL); }
+
+static int shrink_mtf_rle_encode(shrink_t *io) {
+	assert(io);
+	unsigned char model[ELEM];
+	if (mtf_init(model) < 0)
+		return -1;
+	return rle_encode(io, model);
+}
+
+static int shrink_mtf_rle_decode(shrink_t *io) {
+	assert(io);
+	unsigned char model[ELEM];
+	if (mtf_init(model) < 0)
+		return -1;
+	return rle_decode(io, model);
+}
+
 static int gamma_size(unsigned v) {
 	int sz = 1;
 	
@@ -499,52 +1414,52 @@ of functions that can be reused throughout this code. */
 #define ELIAS_BITS (4)
 #define ELIAS_TERMINAL (1 + (1 << ELIAS_BITS))
 
-static int shrink_elias_encode(shrink_t *io) {
-	assert(io);
-	bit_buffer_t buf = { .mask = 128, }, ibuf = { .mask = 0, };
-	for (int end = 0;!end;) {
-		int c = bit_buffer_get_n_bits(io, &ibuf, ELIAS_BITS);
-		if (c < 0) {
-			c = ELIAS_TERMINAL;
-			end = 1;
-		}
-		const int bit_sz = (gamma_size(c) - 1) / 2;
-		int bit_msk = 1;
-
-		for (int x = 0; x < bit_sz; x++) {
-			if (bit_buffer_put_bit(io, &buf, 1) < 0)
-				return ELINE;
-			bit_msk <<= 1;
-		}
-		if (bit_buffer_put_bit(io, &buf, 0) < 0)
-			return ELINE;
-		c++;
-		bit_msk >>= 1;
+static unsigned long elias_code(const int c, unsigned *length) { /* the prefix and value as one */
+	assert(length);
+	assert(c >= 0 && c <= ELIAS_TERMINAL);
+	const unsigned bit_sz = (gamma_size(c) - 1) / 2;
+	*length = (bit_sz * 2u) + 1u;
+	return ((((1ul << bit_sz) - 1ul) << 1) << bit_sz) | ((c + 1ul) & ((1ul << bit_sz) - 1ul));
+}
 
-		for (int x = 0; x < bit_sz; x++) {
-			if (bit_buffer_put_bit(io, &buf, c & bit_msk) < 0)
-				return ELINE;
-			bit_msk >>= 1;
-		}
+/* Input is taken a byte, two values, at a time, the most significant
+ * nibble first, so the terminal value is only ever after the last byte.
+ * The codes for both nibbles of each byte are worked out beforehand so
+ * each byte is a single write. */
+static int elias_encode(shrink_t *io, unsigned char *model) {
+	assert(io);
+	BUILD_BUG_ON(ELIAS_BITS != 4);
+	bit_buffer_t buf = { .mask = 128, };
+	uint32_t codes[256];
+	uint8_t lengths[256];
+	for (int i = 0; i < 256; i++) {
+		unsigned hi = 0, lo = 0;
+		const unsigned long h = elias_code(i >> ELIAS_BITS, &hi), l = elias_code(i & 0xF, &lo);
+		codes[i] = (h << lo) | l;
+		lengths[i] = hi + lo;
 	}
+	for (int c = 0; (c = mtf_get(io, model)) >= 0;)
+		if (bit_buffer_put_bits(io, &buf, codes[c], lengths[c]) < 0)
+			return ELINE;
+	unsigned length = 0;
+	const unsigned long terminal = elias_code(ELIAS_TERMINAL, &length);
+	if (bit_buffer_put_bits(io, &buf, terminal, length) < 0)
+		return ELINE;
 	if (bit_buffer_flush(io, &buf) < 0)
 		return ELINE;
 	return 0;
 }
 
-static int shrink_elias_decode(shrink_t *io) {
+static int elias_decode(shrink_t *io, unsigned char *model) {
 	assert(io);
-	bit_buffer_t buf = { .mask = 0, }, obuf = { .mask = 128, };
-	for (;;) {
+	bit_buffer_t buf = { .mask = 0, };
+	for (int byte = 0, nibbles = 0;;) {
 		int v = 1;
 		int bit_count = 0;
 		for (;;) {
 			const int r = bit_buffer_get_n_bits(io, &buf, 1);
-			if (r < 0) {
-				if (bit_count > 0)
-					return ELINE;
-				break;
-			}
+			if (r < 0) /* the terminal value is missing */
+				return ELINE;
 			if (r == 0)
 				break;
 			/*assert(bit_count < INT_MAX);*/
@@ -563,41 +1478,36 @@ static int shrink_elias_decode(shrink_t *io) {
 		v--;
 		assert(v >= 0);
 		assert(v <= ELIAS_TERMINAL);
-		for (int x = 0; x < ELIAS_BITS; x++) {
-			if (bit_buffer_put_bit(io, &obuf, v & (1 << (ELIAS_BITS - 1))) < 0)
+		if (v >= (1 << ELIAS_BITS))
+			return ELINE;
+		byte = (byte << ELIAS_BITS) | v;
+		if (++nibbles == 2) {
+			if (mtf_put(byte, io, model) < 0)
 				return ELINE;
-			v <<= 1;
+			byte = 0;
+			nibbles = 0;
 		}
 	}
-	if (bit_buffer_flush(io, &obuf) < 0)
-		return ELINE;
 	return 0;
 }
 
-#define ELEM (256)
-
-static int mtf_init(unsigned char *model) {
-	assert(model);
-	for (size_t i = 0; i < ELEM; i++)
-		model[i] = i;
-	return 0;
-}
+static int shrink_elias_encode(shrink_t *io) { return elias_encode(io, NULL); }
+static int shrink_elias_decode(shrink_t *io) { return elias_decode(io, NULL); }
 
-static int mtf_find(const unsigned char *model, int ch) {
-	assert(model);
-	for (size_t i = 0; i < ELEM; i++)
-		if (ch == model[i])
-			return i;
-	return -1;
+static int shrink_mtf_elias_encode(shrink_t *io) {
+	assert(io);
+	unsigned char model[ELEM];
+	if (mtf_init(model) < 0)
+		return -1;
+	return elias_encode(io, model);
 }
 
-static int mtf_update(unsigned char *model, const int index) {
-	assert(model);
-	assert(index >= 0 && index < ELEM);
-	const int m = model[index];
-	memmove(model + 1, model, index);
-	model[0] = m;
-	return index;
+static int shrink_mtf_elias_decode(shrink_t *io) {
+	assert(io);
+	unsigned char model[ELEM];
+	if (mtf_init(model) < 0)
+		return -1;
+	return elias_decode(io, model);
 }
 
 static int shrink_mtf_encode(shrink_t *io) {
@@ -605,6 +1515,11 @@ static int shrink_mtf_encode(shrink_t *io) {
 	unsigned char model[ELEM];
 	if (mtf_init(model) < 0)
 		return -1;
+	if (!io->put) { /* one byte out for each byte in, the model is not needed */
+		while (get(io) >= 0)
+			io->wrote++;
+		return 0;
+	}
 	for (int ch = 0; (ch = get(io)) >= 0;)
 		if (put(mtf_update(model, mtf_find(model, ch)), io) < 0)
 			return -1;
@@ -678,11 +1593,9 @@ int shrink_lzp_encode(shrink_t *io) {
 		}
 		if (i > 0) {
 			buf[0] = mask;
-			for (int k = 0; k < j; k++) {
-				assert(k < (int)sizeof (buf));
-				if (put(buf[k], io) < 0)
-					return ELINE;
-			}
+			assert(j <= (int)sizeof (buf));
+			if (put_block(io, buf, j) < 0)
+				return ELINE;
 		}
 		if (ch < 0)
 			break;
@@ -718,61 +1631,1253 @@ int shrink_lzp_decode(shrink_t *io) {
 			hash = lzp_hash(hash, ch);
 		}
 		if (j > 0) {
-			for (int k = 0; k < j; k++) {
-				assert(k < (int)sizeof(buf));
-				if (put(buf[k], io) < 0)
-					return ELINE;
-			}
+			assert(j <= (int)sizeof(buf));
+			if (put_block(io, buf, j) < 0)
+				return ELINE;
 		}
 	}
 	return 0;
 }
 
-int shrink(shrink_t *io, const int codec, const int encode) {
+/* The long range matcher is a pre-stage for the other CODECs, which cannot
+ * see further back than their window. The input is hashed a block of
+ * LONG_BLOCK bytes at a time with a rolling hash, and every LONG_STRIDE bytes
+ * the block just read is put in a fixed size index. The hash is looked up
+ * at every position, so any repeat of at least LONG_BLOCK + LONG_STRIDE - 1
+ * bytes is found no matter how far back it is, as long as its entry has not
+ * been replaced. Matches are checked, and extended in both directions, by
+ * reading the earlier input back with 'fetch', so the memory used is fixed.
+ * The output is byte aligned so that the literals can be compressed by the
+ * next stage, it is made of:
+ *
+ *	[literal count] [literals] [match length] [distance]
+ *
+ * Repeated until the end of the input, with each number stored seven bits
+ * at a time, least significant first, with the top bit set on all but the
+ * last byte. A match length of zero has no distance and is used to flush
+ * literals when there are too many held back. The stream can end after the
+ * literals. The decoder reads the matches back from its output. */
+typedef struct {
+	shrink_t *io;
+	int (*fetch)(void *arg, unsigned long long offset, unsigned char *b, size_t length);
+	uint32_t block[1u << LONG_BITS], tag[1u << LONG_BITS]; /* block number plus one, zero if empty, and hash check */
+	uint8_t recent[LONG_BLOCK], pending[LONG_PENDING], cache[LZSS_CACHE];
+	size_t npending, ncached;
+	unsigned long long position, cached; /* bytes read, offset of 'cache' */
+	uint64_t hash, out; /* hash of the last LONG_BLOCK bytes, LONG_PRIME to the power of LONG_BLOCK */
+} long_t;
+
+static int long_put_number(shrink_t *io, unsigned long long n) {
 	assert(io);
-	/* N.B. Dead code elimination should remove unused
-	 * CODECs, even with no optimizations on. */
-	switch (codec) {
-	case CODEC_RLE:   if (!SHRINK_RLE_ENABLE)   return -1; return encode ? shrink_rle_encode(io)   : shrink_rle_decode(io);
-	case CODEC_LZSS:  if (!SHRINK_LZSS_ENABLE)  return -1; return encode ? shrink_lzss_encode(io)  : shrink_lzss_decode(io);
-	case CODEC_ELIAS: if (!SHRINK_ELIAS_ENABLE) return -1; return encode ? shrink_elias_encode(io) : shrink_elias_decode(io);
-	case CODEC_MTF:   if (!SHRINK_MTF_ENABLE)   return -1; return encode ? shrink_mtf_encode(io)   : shrink_mtf_decode(io);
-	case CODEC_LZP:   if (!SHRINK_LZP_ENABLE)   return -1; return encode ? shrink_lzp_encode(io)   : shrink_lzp_decode(io);
+	for (; n >= 0x80u; n >>= 7)
+		if (put((n & 0x7Fu) | 0x80u, io) < 0)
+			return ELINE;
+	return put(n, io) < 0 ? ELINE : 0;
+}
+
+static int long_get_number(shrink_t *io, unsigned long long *n) { /* one on end of input */
+	assert(io);
+	assert(n);
+	*n = 0;
+	for (unsigned shift = 0;; shift += 7) {
+		const int c = get(io);
+		if (c < 0)
+			return shift ? ELINE : 1;
+		if (shift > 63 || (shift == 63 && (c & 0x7F) > 1))
+			return ELINE;
+		*n |= (unsigned long long)(c & 0x7F) << shift;
+		if (!(c & 0x80))
+			return 0;
 	}
-	never;
-	return ELINE;
 }
 
-int shrink_buffer(const int codec, const int encode, const char *in, const size_t inlength, char *out, size_t *outlength) {
-	assert(in);
-	assert(out);
-	assert(outlength);
-	buffer_t ib = { .b = (unsigned char*)in,  .used = 0, .length = inlength, };
-	buffer_t ob = { .b = (unsigned char*)out, .used = 0, .length = *outlength, };
-	shrink_t io = { .get = buffer_get, .put = buffer_put, .in  = &ib, .out = &ob, };
-	const int r = shrink(&io, codec, encode);
-	*outlength = r == 0 ? io.wrote : 0;
-	return r;
+static unsigned long_slot(const uint64_t hash) {
+	return (hash * LONG_PRIME) >> (64u - LONG_BITS);
 }
 
-#define TBUFL (512u)
+static void long_roll(long_t *l, const int ch) {
+	assert(l);
+	const unsigned k = l->position & (LONG_BLOCK - 1u);
+	l->hash = (l->hash * LONG_PRIME) + (unsigned)ch - (l->out * l->recent[k]);
+	l->recent[k] = ch;
+	l->position++;
+}
 
-static inline int test(const int codec, const char *msg, const size_t msglen) {
-	assert(msg);
-	char compressed[TBUFL] = { 0, }, decompressed[TBUFL] = { 0, };
-	size_t complen = sizeof compressed, decomplen = sizeof decompressed;
+static void long_index(long_t *l) {
+	assert(l);
+	if (l->position < LONG_BLOCK || (l->position % LONG_STRIDE))
+		return;
+	const unsigned long long b = (l->position - LONG_BLOCK) / LONG_BLOCK;
+	if (b >= UINT32_MAX)
+		return;
+	const unsigned i = long_slot(l->hash);
+	l->block[i] = b + 1u;
+	l->tag[i] = (uint32_t)l->hash;
+}
+
+/* The last LONG_BLOCK bytes read are the end of 'pending', look for an
+ * earlier block with the same contents. */
+static int long_find(long_t *l, unsigned long long *from) {
+	assert(l);
+	assert(from);
+	assert(l->npending >= LONG_BLOCK);
+	const unsigned i = long_slot(l->hash);
+	if (!l->block[i] || l->tag[i] != (uint32_t)l->hash)
+		return 0;
+	const unsigned long long c = (l->block[i] - 1ull) * LONG_BLOCK;
+	assert((c + LONG_BLOCK) < l->position);
+	if (l->fetch(l->io->in, c, l->cache, LONG_BLOCK) < 0)
+		return ELINE;
+	l->cached = c;
+	l->ncached = LONG_BLOCK;
+	*from = c;
+	return !memcmp(l->cache, &l->pending[l->npending - LONG_BLOCK], LONG_BLOCK);
+}
+
+static int long_byte(long_t *l, const unsigned long long offset) {
+	assert(l);
+	assert(offset < l->position);
+	if (offset < l->cached || offset >= (l->cached + l->ncached)) {
+		const size_t n = MIN(LZSS_CACHE, l->position - offset);
+		if (l->fetch(l->io->in, offset, l->cache, n) < 0)
+			return ELINE;
+		l->cached = offset;
+		l->ncached = n;
+	}
+	return l->cache[offset - l->cached];
+}
+
+static int long_literals(long_t *l, const size_t n) {
+	assert(l);
+	assert(n <= l->npending);
+	if (long_put_number(l->io, n) < 0 || put_block(l->io, l->pending, n) < 0)
+		return ELINE;
+	memmove(l->pending, &l->pending[n], l->npending - n);
+	l->npending -= n;
+	return 0;
+}
+
+static int long_encode(shrink_t *io, int (*fetch)(void *arg, unsigned long long offset, unsigned char *b, size_t length)) {
+	assert(io);
+	assert(fetch);
+	BUILD_BUG_ON((LONG_BLOCK - 1u) & LONG_BLOCK);
+	BUILD_BUG_ON(LONG_STRIDE % LONG_BLOCK);
+	BUILD_BUG_ON(LONG_PENDING <= LONG_BLOCK);
+	BUILD_BUG_ON(LZSS_CACHE < LONG_BLOCK);
+	BUILD_BUG_ON(LONG_BITS > 24);
+	STATIC long_t l;
+	memset(l.block, 0, sizeof (l.block));
+	memset(l.recent, 0, sizeof (l.recent));
+	l.io = io; /* need because of STATIC */
+	l.fetch = fetch;
+	l.npending = 0;
+	l.ncached = 0;
+	l.position = 0;
+	l.cached = 0;
+	l.hash = 0;
+	l.out = 1;
+	for (unsigned k = 0; k < LONG_BLOCK; k++)
+		l.out *= LONG_PRIME;
+	for (;;) {
+		const int ch = get(io);
+		if (ch < 0)
+			break;
+		l.pending[l.npending++] = ch;
+		long_roll(&l, ch);
+		unsigned long long from = 0;
+		const int found = l.npending >= LONG_BLOCK ? long_find(&l, &from) : 0;
+		if (found < 0)
+			return found;
+		if (found) {
+			const size_t most = MIN(MIN(l.npending - LONG_BLOCK, from), LZSS_CACHE);
+			size_t back = 0;
+			if (most) {
+				if (fetch(io->in, from - most, l.cache, most) < 0)
+					return ELINE;
+				l.ncached = 0;
+				while (back < most && l.cache[most - back - 1u] == l.pending[l.npending - LONG_BLOCK - back - 1u])
+					back++;
+			}
+			if (long_literals(&l, l.npending - LONG_BLOCK - back) < 0)
+				return ELINE;
+			const unsigned long long distance = l.position - LONG_BLOCK - from;
+			unsigned long long length = LONG_BLOCK + back;
+			l.npending = 0;
+			long_index(&l);
+			int c = 0;
+			while ((c = get(io)) >= 0) {
+				const int m = long_byte(&l, l.position - distance);
+				if (m < 0)
+					return m;
+				if (m != c)
+					break;
+				long_roll(&l, c);
+				long_index(&l);
+				length++;
+			}
+			if (long_put_number(io, length) < 0 || long_put_number(io, distance) < 0)
+				return ELINE;
+			if (c < 0)
+				break;
+			l.pending[l.npending++] = c;
+			long_roll(&l, c);
+		}
+		long_index(&l);
+		if (l.npending == LONG_PENDING) /* keep enough to find a match with */
+			if (long_literals(&l, LONG_PENDING - (LONG_BLOCK - 1u)) < 0 || long_put_number(io, 0) < 0)
+				return ELINE;
+	}
+	if (l.npending)
+		if (long_literals(&l, l.npending) < 0)
+			return ELINE;
+	return 0;
+}
+
+static int long_decode(shrink_t *io, int (*fetch)(void *arg, unsigned long long offset, unsigned char *b, size_t length)) {
+	assert(io);
+	assert(fetch);
+	uint8_t cache[LZSS_CACHE];
+	unsigned long long wrote = 0;
+	for (;;) {
+		unsigned long long n = 0, distance = 0;
+		int r = long_get_number(io, &n);
+		if (r)
+			return r < 0 ? r : 0;
+		for (; n; n--, wrote++) {
+			const int c = get(io);
+			if (c < 0 || put(c, io) != c)
+				return ELINE;
+		}
+		if ((r = long_get_number(io, &n)))
+			return r < 0 ? r : 0;
+		if (!n)
+			continue;
+		if (long_get_number(io, &distance) || !distance || distance > wrote)
+			return ELINE;
+		while (n) {
+			const size_t k = MIN(MIN(n, distance), LZSS_CACHE);
+			if (fetch(io->out, wrote - distance, cache, k) < 0 || put_block(io, cache, k) < 0)
+				return ELINE;
+			n -= k;
+			wrote += k;
+		}
+	}
+}
+
+/* The word replacement transform is a pre-stage for text, it replaces common
+ * words with a single byte so that the CODEC after it sees more text in its
+ * window and can find longer matches. Bytes below WORDS_CODE are output as
+ * they are, the bytes from WORDS_CODE up to WORDS_CAPITAL are the words in
+ * 'words', WORDS_CAPITAL and WORDS_UPPER come before a word to say that its
+ * first letter or all of it is in capitals, and WORDS_ESCAPE comes before a
+ * byte from the input that is WORDS_CODE or above. Only whole words are
+ * replaced, a word being the longest run of ASCII letters. */
+static const char *words[] = { /* in order, the position is the code */
+	"about", "after", "all", "also", "and", "any", "are", "because", "been",
+	"before", "being", "between", "bit", "block", "buffer", "but", "byte",
+	"bytes", "call", "can", "change", "client", "code", "compression", "config",
+	"connection", "could", "data", "debug", "default", "each", "error", "even",
+	"failed", "false", "file", "first", "for", "from", "function", "get", "had",
+	"has", "have", "how", "http", "https", "index", "info", "input", "int",
+	"into", "its", "just", "length", "library", "like", "line", "long", "made",
+	"make", "many", "match", "may", "message", "more", "most", "must", "new",
+	"not", "now", "null", "number", "one", "only", "other", "our", "out",
+	"output", "over", "read", "request", "response", "return", "run", "same",
+	"server", "should", "size", "some", "such", "than", "that", "the", "their",
+	"them", "then", "there", "these", "they", "this", "time", "true", "two",
+	"use", "used", "user", "value", "very", "warning", "was", "way", "were",
+	"what", "when", "where", "which", "while", "who", "will", "with", "would",
+	"write", "you", "your",
+};
+
+static int words_letter(const int ch) {
+	return (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z');
+}
+
+static int words_lower(const int ch) {
+	return (ch >= 'A' && ch <= 'Z') ? ch - 'A' + 'a' : ch;
+}
+
+static int words_find(const char *w) {
+	assert(w);
+	int l = 0, h = (sizeof (words) / sizeof (words[0])) - 1;
+	while (l <= h) {
+		const int m = l + ((h - l) / 2), c = strcmp(w, words[m]);
+		if (c == 0)
+			return m;
+		if (c < 0)
+			h = m - 1;
+		else
+			l = m + 1;
+	}
+	return -1;
+}
+
+static int words_flush(shrink_t *io, const uint8_t *w, const size_t n) {
+	assert(io);
+	assert(w);
+	assert(n <= WORDS_MAX);
+	char lower[WORDS_MAX + 1];
+	size_t upper = 0;
+	for (size_t k = 0; k < n; k++) {
+		lower[k] = words_lower(w[k]);
+		upper += lower[k] != w[k];
+	}
+	lower[n] = '\0';
+	const int k = words_find(lower), capital = upper == 1 && lower[0] != w[0];
+	if (k < 0 || (upper && !capital && upper != n))
+		return put_block(io, w, n);
+	if (upper && put(capital ? WORDS_CAPITAL : WORDS_UPPER, io) < 0)
+		return ELINE;
+	return put(WORDS_CODE + k, io) < 0 ? ELINE : 0;
+}
+
+static int shrink_words_encode(shrink_t *io) {
+	assert(io);
+	BUILD_BUG_ON((sizeof (words) / sizeof (words[0])) != (WORDS_CAPITAL - WORDS_CODE));
+	uint8_t w[WORDS_MAX];
+	size_t n = 0;
+	for (int inside = 0;;) { /* 'inside' a word too long to be replaced */
+		const int ch = get(io);
+		if (ch >= 0 && words_letter(ch)) {
+			if (!inside && n < WORDS_MAX) {
+				w[n++] = ch;
+				continue;
+			}
+			if (put_block(io, w, n) < 0 || put(ch, io) < 0)
+				return ELINE;
+			n = 0;
+			inside = 1;
+			continue;
+		}
+		if (n && words_flush(io, w, n) < 0)
+			return ELINE;
+		n = 0;
+		inside = 0;
+		if (ch < 0)
+			break;
+		if (ch >= WORDS_CODE && put(WORDS_ESCAPE, io) < 0)
+			return ELINE;
+		if (put(ch, io) < 0)
+			return ELINE;
+	}
+	return 0;
+}
+
+static int shrink_words_decode(shrink_t *io) {
+	assert(io);
+	for (;;) {
+		int ch = get(io);
+		if (ch < 0)
+			break;
+		const int escaped = ch == WORDS_ESCAPE;
+		if (escaped && (ch = get(io)) < 0)
+			return ELINE;
+		if (ch < WORDS_CODE || escaped) {
+			if (put(ch, io) != ch)
+				return ELINE;
+			continue;
+		}
+		const int flag = ch;
+		if ((flag == WORDS_CAPITAL || flag == WORDS_UPPER) && (ch = get(io)) < 0)
+			return ELINE;
+		if (ch < WORDS_CODE || ch >= WORDS_CAPITAL)
+			return ELINE;
+		const char *s = words[ch - WORDS_CODE];
+		for (size_t k = 0; s[k]; k++) {
+			const int c = (flag == WORDS_UPPER || (flag == WORDS_CAPITAL && k == 0)) ? s[k] - 'a' + 'A' : s[k];
+			if (put(c, io) != c)
+				return ELINE;
+		}
+	}
+	return 0;
+}
+
+/* LZW builds a dictionary of strings as it goes, each code output is a
+ * string already in the dictionary and adds that string plus the byte after
+ * it to the dictionary. The first byte of the output is the largest code
+ * width used, codes 0 to 255 are the bytes, LZW_CLEAR empties the dictionary
+ * and codes start at 9 bits wide and grow as the dictionary does. Once the
+ * dictionary is full the encoder either empties it with LZW_CLEAR, or with
+ * SHRINK_OPT_LZW_FREEZE, carries on with it as it is, the decoder does not
+ * need to know which.
+ *
+ * The encoder finds (prefix, byte) pairs with an open addressed hash table
+ * twice the size of the dictionary, the decoder keeps the prefix, last byte,
+ * first byte and length of each string in flat arrays, so a string can be
+ * written out back to front straight into a buffer. The memory used is
+ * fixed by LZW_BITS. */
+typedef struct {
+	uint32_t key[LZW_HASH];  /* prefix and byte */
+	uint16_t code[LZW_HASH]; /* zero if empty */
+} lzw_encoder_t;
+
+typedef struct {
+	uint16_t prefix[LZW_MAX], length[LZW_MAX];
+	uint8_t last[LZW_MAX], first[LZW_MAX];
+	uint8_t string[LZW_MAX];
+} lzw_decoder_t;
+
+static unsigned lzw_width(const unsigned next) {
+	unsigned w = 9;
+	while ((1u << w) < next)
+		w++;
+	return w;
+}
+
+static unsigned lzw_slot(const uint32_t key) {
+	return (uint32_t)(key * 2654435761ul) >> (32u - (LZW_BITS + 1u));
+}
+
+static int shrink_lzw_encode(shrink_t *io) {
+	assert(io);
+	BUILD_BUG_ON(LZW_BITS < 9 || LZW_BITS > 15);
+	STATIC lzw_encoder_t e;
+	memset(e.code, 0, sizeof (e.code));
+	const int freeze = !!(io->options & SHRINK_OPT_LZW_FREEZE);
+	bit_buffer_t bit = { .mask = 128, };
+	unsigned next = LZW_FIRST;
+	if (put(LZW_BITS, io) < 0)
+		return ELINE;
+	int w = get(io);
+	if (w < 0)
+		return 0;
+	for (;;) {
+		const int k = get(io);
+		if (k < 0)
+			break;
+		const uint32_t key = ((uint32_t)w << 8) | (unsigned)k;
+		unsigned i = lzw_slot(key);
+		while (e.code[i] && e.key[i] != key)
+			i = (i + 1u) & (LZW_HASH - 1u);
+		if (e.code[i]) {
+			w = e.code[i];
+			continue;
+		}
+		if (bit_buffer_put_bits(io, &bit, w, lzw_width(next)) < 0)
+			return ELINE;
+		if (next < LZW_MAX) {
+			e.key[i] = key;
+			e.code[i] = next++;
+			if (next == LZW_MAX && !freeze) {
+				if (bit_buffer_put_bits(io, &bit, LZW_CLEAR, lzw_width(next)) < 0)
+					return ELINE;
+				memset(e.code, 0, sizeof (e.code));
+				next = LZW_FIRST;
+			}
+		}
+		w = k;
+	}
+	if (bit_buffer_put_bits(io, &bit, w, lzw_width(next)) < 0)
+		return ELINE;
+	return bit_buffer_flush(io, &bit);
+}
+
+static int shrink_lzw_decode(shrink_t *io) {
+	assert(io);
+	STATIC lzw_decoder_t d;
+	const int bits = get(io);
+	if (bits < 9 || bits > (int)LZW_BITS)
+		return ELINE;
+	const unsigned max = 1u << bits;
+	bit_buffer_t bit = { .mask = 0, };
+	unsigned count = LZW_FIRST;
+	int prev = -1;
+	for (unsigned i = 0; i < 256u; i++) {
+		d.length[i] = 1;
+		d.last[i] = i;
+		d.first[i] = i;
+	}
+	for (;;) {
+		const unsigned expected = MIN(count + (prev >= 0), max);
+		const int code = bit_buffer_get_n_bits(io, &bit, lzw_width(expected));
+		if (code < 0)
+			break;
+		if (code == LZW_CLEAR) {
+			count = LZW_FIRST;
+			prev = -1;
+			continue;
+		}
+		if ((unsigned)code > count || ((unsigned)code == count && prev < 0))
+			return ELINE;
+		if (prev >= 0 && count < max) { /* 'code' might be this entry */
+			d.prefix[count] = prev;
+			d.first[count] = d.first[prev];
+			d.last[count] = d.first[(unsigned)code < count ? code : prev];
+			d.length[count] = d.length[prev] + 1u;
+			count++;
+		}
+		if ((unsigned)code >= count)
+			return ELINE;
+		const unsigned length = d.length[code];
+		for (unsigned c = code, j = length; j; c = d.prefix[c])
+			d.string[--j] = d.last[c];
+		if (put_block(io, d.string, length) < 0)
+			return ELINE;
+		prev = code;
+	}
+	return 0;
+}
+
+/* The time series CODEC is for samples that are a 64-bit timestamp and a
+ * 64-bit value, both little endian, such as metrics taken at a regular
+ * interval. As in Facebook's Gorilla the timestamps are stored as the
+ * difference between the last two differences, which is usually zero, and
+ * the values as the XOR with the last one, which for a double that changes
+ * slowly has many leading and trailing zero bits, only the bits in between
+ * are stored. With SHRINK_OPT_SERIES_INT the values are integers and are
+ * stored as the timestamps are. The first byte of the output is the value
+ * type (SERIES_DOUBLE or SERIES_INT), each sample is preceded by a one bit
+ * and the end by a zero bit, four bits of length and any bytes left over
+ * that do not make up a whole sample:
+ *
+ *	First sample:    [64 bit timestamp] [64 bit value]
+ *	Difference:      0 | 10 [7 bits] | 110 [9 bits] | 1110 [12 bits] | 1111 [64 bits]
+ *	XOR:             0 (same) | 10 [bits in last window] | 11 [5 bit leading zeros] [6 bit length - 1] [bits]
+ *
+ * Differences are two's complement and XOR windows are only reused if the
+ * bits that are set fit in them. */
+typedef struct {
+	uint64_t time, delta;       /* last timestamp, and the difference between it and the one before */
+	uint64_t value, step;       /* as above for values */
+	unsigned leading, trailing; /* zeros either side of the last XOR window, 'trailing' is 64 if none */
+} series_t;
+
+static int series_put(shrink_t *io, bit_buffer_t *bit, const uint64_t v, const unsigned n) {
+	assert(io);
+	assert(bit);
+	assert(n <= 64u);
+	if (n > 32u && bit_buffer_put_bits(io, bit, (unsigned long)(v >> 32), n - 32u) < 0)
+		return ELINE;
+	return bit_buffer_put_bits(io, bit, (unsigned long)(v & 0xFFFFFFFFul), MIN(n, 32u));
+}
+
+static int series_get(shrink_t *io, bit_buffer_t *bit, unsigned n, uint64_t *v) {
+	assert(io);
+	assert(bit);
+	assert(v);
+	assert(n <= 64u);
+	*v = 0;
+	while (n) {
+		const unsigned take = MIN(n, 8u);
+		const int b = bit_buffer_get_n_bits(io, bit, take);
+		if (b < 0)
+			return ELINE;
+		*v = (*v << take) | (unsigned)b;
+		n -= take;
+	}
+	return 0;
+}
+
+static uint64_t series_load(const uint8_t *b) {
+	assert(b);
+	uint64_t v = 0;
+	for (unsigned i = 8; i--;)
+		v = (v << 8) | b[i];
+	return v;
+}
+
+static void series_store(uint8_t *b, uint64_t v) {
+	assert(b);
+	for (unsigned i = 0; i < 8u; i++, v >>= 8)
+		b[i] = v & 0xFFu;
+}
+
+static unsigned series_leading(uint64_t x) {
+	assert(x);
+	unsigned n = 0;
+	for (unsigned s = 32; s; s >>= 1)
+		if (!(x >> (64u - s))) {
+			n += s;
+			x <<= s;
+		}
+	return n;
+}
+
+static unsigned series_trailing(uint64_t x) {
+	assert(x);
+	unsigned n = 0;
+	for (unsigned s = 32; s; s >>= 1)
+		if (!(x & ((UINT64_C(1) << s) - 1u))) {
+			n += s;
+			x >>= s;
+		}
+	return n;
+}
+
+static const unsigned series_widths[] = { 7, 9, 12, 64, }; /* of differences, after 1 to 4 one bits */
+
+static int series_put_difference(shrink_t *io, bit_buffer_t *bit, const uint64_t d) {
+	assert(io);
+	assert(bit);
+	if (!d)
+		return bit_buffer_put_bits(io, bit, 0, 1);
+	for (unsigned i = 0; i < 3u; i++) {
+		const unsigned w = series_widths[i];
+		if ((d + (UINT64_C(1) << (w - 1u))) < (UINT64_C(1) << w)) { /* fits, as a signed number */
+			if (bit_buffer_put_bits(io, bit, (4ul << i) - 2ul, i + 2u) < 0)
+				return ELINE;
+			return series_put(io, bit, d, w);
+		}
+	}
+	if (bit_buffer_put_bits(io, bit, 0xF, 4) < 0)
+		return ELINE;
+	return series_put(io, bit, d, 64);
+}
+
+static int series_get_difference(shrink_t *io, bit_buffer_t *bit, uint64_t *d) {
+	assert(io);
+	assert(bit);
+	assert(d);
+	unsigned ones = 0;
+	for (int b = 0; ones < 4u; ones++) {
+		if ((b = bit_buffer_get_n_bits(io, bit, 1)) < 0)
+			return ELINE;
+		if (!b)
+			break;
+	}
+	*d = 0;
+	if (!ones)
+		return 0;
+	const unsigned w = series_widths[ones - 1u];
+	if (series_get(io, bit, w, d) < 0)
+		return ELINE;
+	if (w < 64u && (*d >> (w - 1u))) /* sign extend */
+		*d |= ~((UINT64_C(1) << w) - 1u);
+	return 0;
+}
+
+static int series_put_xor(shrink_t *io, bit_buffer_t *bit, series_t *s, const uint64_t v) {
+	assert(io);
+	assert(bit);
+	assert(s);
+	const uint64_t x = v ^ s->value;
+	s->value = v;
+	if (!x)
+		return bit_buffer_put_bits(io, bit, 0, 1);
+	const unsigned leading = MIN(series_leading(x), 31u), trailing = series_trailing(x);
+	if (s->trailing < 64u && leading >= s->leading && trailing >= s->trailing) {
+		if (bit_buffer_put_bits(io, bit, 2, 2) < 0)
+			return ELINE;
+		return series_put(io, bit, x >> s->trailing, 64u - s->leading - s->trailing);
+	}
+	const unsigned length = 64u - leading - trailing;
+	if (bit_buffer_put_bits(io, bit, (3ul << 11) | (leading << 6) | (length - 1u), 13) < 0)
+		return ELINE;
+	s->leading = leading;
+	s->trailing = trailing;
+	return series_put(io, bit, x >> trailing, length);
+}
+
+static int series_get_xor(shrink_t *io, bit_buffer_t *bit, series_t *s) {
+	assert(io);
+	assert(bit);
+	assert(s);
+	int b = bit_buffer_get_n_bits(io, bit, 1);
+	if (b <= 0)
+		return b;
+	if ((b = bit_buffer_get_n_bits(io, bit, 1)) < 0)
+		return ELINE;
+	if (b) {
+		const int w = bit_buffer_get_n_bits(io, bit, 11);
+		if (w < 0)
+			return ELINE;
+		const unsigned leading = w >> 6, length = (w & 63u) + 1u;
+		if ((leading + length) > 64u)
+			return ELINE;
+		s->leading = leading;
+		s->trailing = 64u - leading - length;
+	} else if (s->trailing >= 64u) {
+		return ELINE;
+	}
+	uint64_t x = 0;
+	if (series_get(io, bit, 64u - s->leading - s->trailing, &x) < 0)
+		return ELINE;
+	s->value ^= x << s->trailing;
+	return 0;
+}
+
+static int shrink_series_encode(shrink_t *io) {
+	assert(io);
+	const int integer = !!(io->options & SHRINK_OPT_SERIES_INT);
+	series_t s = { .trailing = 64, };
+	bit_buffer_t bit = { .mask = 128, };
+	if (put(integer ? SERIES_INT : SERIES_DOUBLE, io) < 0)
+		return ELINE;
+	for (int first = 1;; first = 0) {
+		uint8_t b[SERIES_SAMPLE];
+		unsigned n = 0;
+		for (int c = 0; n < SERIES_SAMPLE && (c = get(io)) >= 0; n++)
+			b[n] = c;
+		if (n < SERIES_SAMPLE) {
+			if (bit_buffer_put_bits(io, &bit, n, 5) < 0) /* a zero bit, then the length */
+				return ELINE;
+			for (unsigned i = 0; i < n; i++)
+				if (bit_buffer_put_bits(io, &bit, b[i], 8) < 0)
+					return ELINE;
+			return bit_buffer_flush(io, &bit);
+		}
+		const uint64_t t = series_load(b), v = series_load(b + 8);
+		if (bit_buffer_put_bits(io, &bit, 1, 1) < 0)
+			return ELINE;
+		if (first) {
+			if (series_put(io, &bit, t, 64) < 0 || series_put(io, &bit, v, 64) < 0)
+				return ELINE;
+			s.time = t;
+			s.value = v;
+			continue;
+		}
+		const uint64_t delta = t - s.time, step = v - s.value;
+		if (series_put_difference(io, &bit, delta - s.delta) < 0)
+			return ELINE;
+		s.time = t;
+		s.delta = delta;
+		if (integer) {
+			if (series_put_difference(io, &bit, step - s.step) < 0)
+				return ELINE;
+			s.value = v;
+			s.step = step;
+		} else if (series_put_xor(io, &bit, &s, v) < 0) {
+			return ELINE;
+		}
+	}
+}
+
+static int shrink_series_decode(shrink_t *io) {
+	assert(io);
+	const int type = get(io);
+	if (type != SERIES_DOUBLE && type != SERIES_INT)
+		return ELINE;
+	series_t s = { .trailing = 64, };
+	bit_buffer_t bit = { .mask = 0, };
+	for (int first = 1;; first = 0) {
+		uint8_t b[SERIES_SAMPLE];
+		int more = bit_buffer_get_n_bits(io, &bit, 1);
+		if (more < 0)
+			return ELINE;
+		if (!more) {
+			const int n = bit_buffer_get_n_bits(io, &bit, 4);
+			if (n < 0 || n >= (int)SERIES_SAMPLE)
+				return ELINE;
+			for (int i = 0; i < n; i++) {
+				const int c = bit_buffer_get_n_bits(io, &bit, 8);
+				if (c < 0)
+					return ELINE;
+				b[i] = c;
+			}
+			return put_block(io, b, n);
+		}
+		if (first) {
+			if (series_get(io, &bit, 64, &s.time) < 0 || series_get(io, &bit, 64, &s.value) < 0)
+				return ELINE;
+		} else {
+			uint64_t d = 0;
+			if (series_get_difference(io, &bit, &d) < 0)
+				return ELINE;
+			s.delta += d;
+			s.time += s.delta;
+			if (type == SERIES_INT) {
+				if (series_get_difference(io, &bit, &d) < 0)
+					return ELINE;
+				s.step += d;
+				s.value += s.step;
+			} else if (series_get_xor(io, &bit, &s) < 0) {
+				return ELINE;
+			}
+		}
+		series_store(b, s.time);
+		series_store(b + 8, s.value);
+		if (put_block(io, b, SERIES_SAMPLE) < 0)
+			return ELINE;
+	}
+}
+
+static int codec_op(shrink_t *io, const int codec, const int encode) {
+	assert(io);
+	/* N.B. Dead code elimination should remove unused
+	 * CODECs, even with no optimizations on. */
+	switch (codec) {
+	case CODEC_RLE:   if (!SHRINK_RLE_ENABLE)   return -1; return encode ? shrink_rle_encode(io)   : shrink_rle_decode(io);
+	case CODEC_LZSS:  if (!SHRINK_LZSS_ENABLE)  return -1; return encode ? shrink_lzss_encode(io)  : shrink_lzss_decode(io);
+	case CODEC_ELIAS: if (!SHRINK_ELIAS_ENABLE) return -1; return encode ? shrink_elias_encode(io) : shrink_elias_decode(io);
+	case CODEC_MTF:   if (!SHRINK_MTF_ENABLE)   return -1; return encode ? shrink_mtf_encode(io)   : shrink_mtf_decode(io);
+	case CODEC_LZP:   if (!SHRINK_LZP_ENABLE)   return -1; return encode ? shrink_lzp_encode(io)   : shrink_lzp_decode(io);
+	case CODEC_LZSSX: if (!SHRINK_LZSSX_ENABLE) return -1; return encode ? shrink_lzssx_encode(io) : shrink_lzssx_decode(io);
+	case CODEC_LZSSR: if (!SHRINK_LZSSR_ENABLE) return -1; return encode ? shrink_lzssr_encode(io) : shrink_lzssr_decode(io);
+	case CODEC_WORDS: if (!SHRINK_WORDS_ENABLE) return -1; return encode ? shrink_words_encode(io) : shrink_words_decode(io);
+	case CODEC_LZW:   if (!SHRINK_LZW_ENABLE)   return -1; return encode ? shrink_lzw_encode(io)   : shrink_lzw_decode(io);
+	case CODEC_SERIES: if (!SHRINK_SERIES_ENABLE) return -1; return encode ? shrink_series_encode(io) : shrink_series_decode(io);
+	case CODEC_MTF_RLE:   if (!SHRINK_MTF_ENABLE || !SHRINK_RLE_ENABLE)   return -1; return encode ? shrink_mtf_rle_encode(io)   : shrink_mtf_rle_decode(io);
+	case CODEC_MTF_ELIAS: if (!SHRINK_MTF_ENABLE || !SHRINK_ELIAS_ENABLE) return -1; return encode ? shrink_mtf_elias_encode(io) : shrink_mtf_elias_decode(io);
+	}
+	never;
+	return ELINE;
+}
+
+int shrink(shrink_t *io, const int codec, const int encode) {
+	assert(io);
+	start(io);
+	return stop(io, codec_op(io, codec, encode));
+}
+
+int shrink_buffer(const int codec, const int encode, const char *in, const size_t inlength, char *out, size_t *outlength) {
+	assert(in);
+	assert(outlength);
+	buffer_t ib = { .b = (unsigned char*)in,  .used = 0, .length = inlength, };
+	buffer_t ob = { .b = (unsigned char*)out, .used = 0, .length = *outlength, };
+	shrink_t io = { .get = buffer_get, .put = out ? buffer_put : NULL, .in  = &ib, .out = &ob, };
+	const int r = shrink(&io, codec, encode);
+	*outlength = r == 0 ? io.wrote : 0;
+	return r;
+}
+
+int shrink_iov(const int codec, const int encode, const shrink_iovec_t *in, const size_t nin, const shrink_iovec_t *out, const size_t nout, size_t *outlength) {
+	assert(in || !nin);
+	assert(out || !nout);
+	assert(outlength);
+	iov_t iv = { .v = in, .n = nin, }, ov = { .v = out, .n = nout, };
+	shrink_t io = { .get = iov_get, .put = iov_put, .in = &iv, .out = &ov, };
+	const int r = shrink(&io, codec, encode);
+	*outlength = r == 0 ? io.wrote : 0;
+	return r;
+}
+
+int shrink_batch(const int codec, const int encode, const size_t count, const shrink_iovec_t *in, const shrink_iovec_t *out, size_t *lengths) {
+	assert(in || !count);
+	assert(out || !count);
+	assert(lengths || !count);
+	buffer_t ib = { .b = NULL, }, ob = { .b = NULL, };
+	shrink_t io = { .get = buffer_get, .put = buffer_put, .in = &ib, .out = &ob, };
+	for (size_t k = 0; k < count; k++) {
+		ib = (buffer_t) { .b = in[k].iov_base,  .used = 0, .length = in[k].iov_len, };
+		ob = (buffer_t) { .b = out[k].iov_base, .used = 0, .length = out[k].iov_len, };
+		io.read = 0;
+		io.wrote = 0;
+		const int r = shrink(&io, codec, encode);
+		lengths[k] = r == 0 ? io.wrote : 0;
+		if (r < 0)
+			return r;
+	}
+	return 0;
+}
+
+/* The accumulator of a writer holds fewer than eight bits between calls, the
+ * rest are written out as soon as they make up a byte. A reader fills its
+ * accumulator with as many bytes as it will take from memory, but from a
+ * 'shrink_t' only with as many as it needs, so it never reads more of a
+ * stream than the bits it has been asked for. */
+static unsigned long long bits_mask(const unsigned n) {
+	assert(n < 64u);
+	return (1ull << n) - 1ull;
+}
+
+static int bits_fill(shrink_bits_t *s, const unsigned n) {
+	assert(s);
+	assert(n <= SHRINK_BITS_MAX);
+	if (s->in) {
+		while (s->count < (64u - 8u) && s->used < s->length) {
+			s->acc = (s->acc << 8) | s->in[s->used++];
+			s->count += 8u;
+		}
+		return s->count < n ? ELINE : 0;
+	}
+	while (s->count < n) {
+		const int ch = s->io ? get(s->io) : -1;
+		if (ch < 0)
+			return ELINE;
+		s->acc = (s->acc << 8) | (unsigned)ch;
+		s->count += 8u;
+	}
+	return 0;
+}
+
+int shrink_bits_put(shrink_bits_t *s, const unsigned long long v, const unsigned n) {
+	assert(s);
+	if (n > SHRINK_BITS_MAX || s->count >= 8u)
+		return ELINE;
+	s->acc = (s->acc << n) | (v & bits_mask(n));
+	s->count += n;
+	if (s->out) {
+		if ((s->used + (s->count / 8u)) > s->length)
+			return ELINE;
+		while (s->count >= 8u) {
+			s->count -= 8u;
+			s->out[s->used++] = s->acc >> s->count;
+		}
+		return 0;
+	}
+	if (!s->io)
+		return ELINE;
+	while (s->count >= 8u) {
+		s->count -= 8u;
+		const int ch = (s->acc >> s->count) & 0xFFu;
+		if (put(ch, s->io) != ch)
+			return ELINE;
+	}
+	return 0;
+}
+
+unsigned long long shrink_bits_peek(shrink_bits_t *s, const unsigned n) {
+	assert(s);
+	if (n > SHRINK_BITS_MAX)
+		return 0;
+	if (s->count < n)
+		(void)bits_fill(s, n);
+	if (s->count < n) /* past the end */
+		return (s->acc << (n - s->count)) & bits_mask(n);
+	return (s->acc >> (s->count - n)) & bits_mask(n);
+}
+
+int shrink_bits_skip(shrink_bits_t *s, const unsigned n) {
+	assert(s);
+	if (n > SHRINK_BITS_MAX || (s->count < n && bits_fill(s, n) < 0))
+		return ELINE;
+	s->count -= n;
+	return 0;
+}
+
+int shrink_bits_get(shrink_bits_t *s, const unsigned n, unsigned long long *v) {
+	assert(s);
+	assert(v);
+	*v = 0;
+	if (n > SHRINK_BITS_MAX || (s->count < n && bits_fill(s, n) < 0))
+		return ELINE;
+	s->count -= n;
+	*v = (s->acc >> s->count) & bits_mask(n);
+	return 0;
+}
+
+int shrink_bits_flush(shrink_bits_t *s) {
+	assert(s);
+	if (s->count >= 8u)
+		return ELINE;
+	if (s->count && shrink_bits_put(s, 0, 8u - s->count) < 0)
+		return ELINE;
+	return 0;
+}
+
+int shrink_bits_align(shrink_bits_t *s) {
+	assert(s);
+	s->count -= s->count % 8u;
+	if (s->in) { /* give back whole bytes read ahead */
+		assert(s->used >= (s->count / 8u));
+		s->used -= s->count / 8u;
+		s->count = 0;
+	}
+	return 0;
+}
+
+/* Count the bits the same as 'one' and consume the one after them. */
+static int bits_run(shrink_bits_t *s, const unsigned one, unsigned long long *v) {
+	assert(s);
+	assert(v);
+	*v = 0;
+	for (;;) {
+		if (!s->count && bits_fill(s, 1) < 0)
+			return ELINE;
+		const unsigned long long x = (one ? ~s->acc : s->acc) & bits_mask(s->count);
+		if (!x) { /* all of them, there may be more */
+			*v += s->count;
+			s->count = 0;
+			continue;
+		}
+		unsigned h = s->count - 1u;
+		while (!((x >> h) & 1u))
+			h--;
+		*v += s->count - 1u - h;
+		s->count = h;
+		return 0;
+	}
+}
+
+int shrink_bits_put_unary(shrink_bits_t *s, unsigned long long v) {
+	assert(s);
+	for (; v >= SHRINK_BITS_MAX; v -= SHRINK_BITS_MAX)
+		if (shrink_bits_put(s, bits_mask(SHRINK_BITS_MAX), SHRINK_BITS_MAX) < 0)
+			return ELINE;
+	return shrink_bits_put(s, bits_mask(v) << 1, v + 1u);
+}
+
+int shrink_bits_get_unary(shrink_bits_t *s, unsigned long long *v) {
+	return bits_run(s, 1, v);
+}
+
+int shrink_bits_put_gamma(shrink_bits_t *s, const unsigned long long v) {
+	assert(s);
+	if (v < 1u || v > bits_mask(SHRINK_BITS_MAX))
+		return ELINE;
+	unsigned n = 1;
+	while (v >> n)
+		n++;
+	if (shrink_bits_put(s, 0, n - 1u) < 0)
+		return ELINE;
+	return shrink_bits_put(s, v, n);
+}
+
+int shrink_bits_get_gamma(shrink_bits_t *s, unsigned long long *v) {
+	assert(s);
+	assert(v);
+	unsigned long long zeros = 0, rest = 0;
+	if (bits_run(s, 0, &zeros) < 0)
+		return ELINE;
+	if (zeros >= SHRINK_BITS_MAX || shrink_bits_get(s, zeros, &rest) < 0)
+		return ELINE;
+	*v = (1ull << zeros) | rest;
+	return 0;
+}
+
+const unsigned char *shrink_asset(shrink_asset_t *a) {
+	assert(a);
+	enum { ASSET_NEW, ASSET_READY, ASSET_FAILED, };
+	if (a->state == ASSET_NEW) {
+		size_t length = a->size;
+		const int r = shrink_buffer(a->codec, 0, (const char*)a->data, a->length, (char*)a->cache, &length);
+		a->state = (r < 0 || length != a->size || !a->cache) ? ASSET_FAILED : ASSET_READY;
+	}
+	return a->state == ASSET_READY ? a->cache : NULL;
+}
+
+int shrink_long(shrink_t *io, const int encode, int (*fetch)(void *arg, unsigned long long offset, unsigned char *b, size_t length)) {
+	assert(io);
+	assert(fetch);
+	if (!SHRINK_LONG_ENABLE)
+		return -1;
+	start(io);
+	return stop(io, encode ? long_encode(io, fetch) : long_decode(io, fetch));
+}
+
+int shrink_index(shrink_t *io, const int codec, const unsigned long long interval, int (*checkpoint)(void *arg, const shrink_checkpoint_t *c), void *arg) {
+	assert(io);
+	assert(checkpoint);
+	const lzss_index_t index = { .checkpoint = checkpoint, .arg = arg, .interval = interval ? interval : 1, };
+	start(io);
+	if (codec == CODEC_LZSS  && SHRINK_LZSS_ENABLE)
+		return stop(io, lzss_decode(io, 0, NULL, &index));
+	if (codec == CODEC_LZSSX && SHRINK_LZSSX_ENABLE)
+		return stop(io, lzss_decode(io, 1, NULL, &index));
+	return -1;
+}
+
+int shrink_seek(shrink_t *io, const int codec, const shrink_checkpoint_t *from) {
+	assert(io);
+	assert(from);
+	start(io);
+	if (codec == CODEC_LZSS  && SHRINK_LZSS_ENABLE)
+		return stop(io, lzss_decode(io, 0, from, NULL));
+	if (codec == CODEC_LZSSX && SHRINK_LZSSX_ENABLE)
+		return stop(io, lzss_decode(io, 1, from, NULL));
+	return -1;
+}
+
+int shrink_readback(shrink_t *io, const int codec, int (*fetch)(void *out, unsigned long long offset, unsigned char *b, size_t length)) {
+	assert(io);
+	assert(fetch);
+	start(io);
+	if (codec == CODEC_LZSS  && SHRINK_LZSS_ENABLE)
+		return stop(io, lzss_readback(io, 0, fetch));
+	if (codec == CODEC_LZSSX && SHRINK_LZSSX_ENABLE)
+		return stop(io, lzss_readback(io, 1, fetch));
+	return -1;
+}
+
+#define TBUFL (512u)
+
+/* returns the compressed length on success */
+static inline long test(const int codec, const unsigned options, const char *dictionary, const char *msg, const size_t msglen) {
+	assert(msg);
+	char compressed[TBUFL] = { 0, }, decompressed[TBUFL] = { 0, };
+	size_t complen = sizeof compressed, decomplen = sizeof decompressed;
 	if (msglen > TBUFL)
 		return ELINE;
-	const int r1 = shrink_buffer(codec, 1, msg,        msglen,  compressed,   &complen);
+	buffer_t ib = { .b = (unsigned char*)msg,        .used = 0, .length = msglen, };
+	buffer_t ob = { .b = (unsigned char*)compressed, .used = 0, .length = complen, };
+	shrink_t io = {
+		.get = buffer_get, .put = buffer_put, .in = &ib, .out = &ob, .options = options,
+		.dictionary = (const unsigned char*)dictionary, .dictionary_length = dictionary ? strlen(dictionary) : 0,
+	};
+	const int r1 = shrink(&io, codec, 1);
 	if (r1 < 0)
 		return r1;
-	const int r2 = shrink_buffer(codec, 0, compressed, complen, decompressed, &decomplen);
+	complen = io.wrote;
+	ib.used = 0; /* counting only must give the same size */
+	io.put = NULL;
+	io.read = 0;
+	io.wrote = 0;
+	if (shrink(&io, codec, 1) < 0 || io.wrote != complen)
+		return ELINE;
+	io.put = buffer_put;
+	buffer_t cb = { .b = (unsigned char*)compressed,   .used = 0, .length = complen, };
+	buffer_t db = { .b = (unsigned char*)decompressed, .used = 0, .length = decomplen, };
+	io.in = &cb;
+	io.out = &db;
+	io.read = 0;
+	io.wrote = 0;
+	const int r2 = shrink(&io, codec, 0);
 	if (r2 < 0)
 		return r2;
+	decomplen = io.wrote;
 	if (msglen != decomplen)
 		return ELINE;
 	if (memcmp(msg, decompressed, msglen))
 		return ELINE;
+	return complen;
+}
+
+typedef struct {
+	shrink_checkpoint_t c;
+	uint8_t window[N];
+	unsigned long long want; /* keep last checkpoint at or before this */
+} test_checkpoint_t;
+
+static int test_checkpoint(void *arg, const shrink_checkpoint_t *c) {
+	assert(arg);
+	assert(c);
+	test_checkpoint_t *t = arg;
+	if (c->window_length != N)
+		return ELINE;
+	if (c->offset <= t->want) {
+		t->c = *c;
+		memcpy(t->window, c->window, N);
+		t->c.window = t->window;
+	}
+	return 0;
+}
+
+/* decode from a checkpoint part way through 'msg' */
+static inline int test_seek(const int codec, const char *msg, const size_t msglen) {
+	assert(msg);
+	char compressed[TBUFL] = { 0, }, decompressed[TBUFL] = { 0, };
+	size_t complen = sizeof compressed;
+	test_checkpoint_t t = { .want = msglen / 2, };
+	if (msglen > TBUFL)
+		return ELINE;
+	if (shrink_buffer(codec, 1, msg, msglen, compressed, &complen) < 0)
+		return ELINE;
+	buffer_t cb = { .b = (unsigned char*)compressed,   .used = 0, .length = complen, };
+	buffer_t db = { .b = (unsigned char*)decompressed, .used = 0, .length = sizeof decompressed, };
+	shrink_t io = { .get = buffer_get, .put = buffer_put, .in = &cb, .out = &db, };
+	if (shrink_index(&io, codec, msglen / 8, test_checkpoint, &t) < 0)
+		return ELINE;
+	if (io.wrote != msglen || !t.c.window || t.c.offset == 0)
+		return ELINE;
+	cb.used = t.c.bit / 8;
+	db.used = 0;
+	if (shrink_seek(&io, codec, &t.c) < 0)
+		return ELINE;
+	if (db.used != (msglen - t.c.offset))
+		return ELINE;
+	if (memcmp(msg + t.c.offset, decompressed, db.used))
+		return ELINE;
+	return 0;
+}
+
+static int test_fetch(void *out, const unsigned long long offset, unsigned char *b, const size_t length) {
+	buffer_t *o = out;
+	assert(o);
+	assert(b);
+	if ((offset + length) > o->used)
+		return ELINE;
+	memcpy(b, o->b + offset, length);
+	return 0;
+}
+
+/* decode without a window, reading back from the output */
+static inline int test_readback(const int codec, const char *dictionary, const char *msg, const size_t msglen) {
+	assert(msg);
+	char compressed[TBUFL] = { 0, }, decompressed[TBUFL] = { 0, };
+	if (msglen > TBUFL)
+		return ELINE;
+	buffer_t ib = { .b = (unsigned char*)msg,          .used = 0, .length = msglen, };
+	buffer_t cb = { .b = (unsigned char*)compressed,   .used = 0, .length = sizeof compressed, };
+	buffer_t db = { .b = (unsigned char*)decompressed, .used = 0, .length = sizeof decompressed, };
+	shrink_t io = {
+		.get = buffer_get, .put = buffer_put, .in = &ib, .out = &cb,
+		.dictionary = (const unsigned char*)dictionary, .dictionary_length = dictionary ? strlen(dictionary) : 0,
+	};
+	if (shrink(&io, codec, 1) < 0)
+		return ELINE;
+	cb.length = cb.used;
+	cb.used = 0;
+	io.in = &cb;
+	io.out = &db;
+	if (shrink_readback(&io, codec, test_fetch) < 0)
+		return ELINE;
+	if (db.used != msglen || memcmp(msg, decompressed, msglen))
+		return ELINE;
+	return 0;
+}
+
+/* long range matching, reading back from the input and then the output */
+static inline long test_long(const char *msg, const size_t msglen) {
+	assert(msg);
+	char coded[TBUFL + 16] = { 0, }, decoded[TBUFL] = { 0, };
+	if (msglen > TBUFL)
+		return ELINE;
+	buffer_t ib = { .b = (unsigned char*)msg,     .used = 0, .length = msglen, };
+	buffer_t cb = { .b = (unsigned char*)coded,   .used = 0, .length = sizeof coded, };
+	buffer_t db = { .b = (unsigned char*)decoded, .used = 0, .length = sizeof decoded, };
+	shrink_t io = { .get = buffer_get, .put = buffer_put, .in = &ib, .out = &cb, };
+	if (shrink_long(&io, 1, test_fetch) < 0)
+		return ELINE;
+	cb.length = cb.used;
+	cb.used = 0;
+	io.in = &cb;
+	io.out = &db;
+	if (shrink_long(&io, 0, test_fetch) < 0)
+		return ELINE;
+	if (db.used != msglen || memcmp(msg, decoded, msglen))
+		return ELINE;
+	return cb.length;
+}
+
+static int test_progress(void *arg, const size_t read, const size_t wrote) {
+	assert(arg);
+	(void)wrote;
+	size_t *calls = arg;
+	if (read < (*calls * 64u)) /* should be called every 64 bytes */
+		return -1;
+	return ++*calls > 3;
+}
+
+/* stop part way through with the 'progress' callback */
+static inline int test_cancel(const int codec, const char *msg, const size_t msglen) {
+	assert(msg);
+	char compressed[TBUFL] = { 0, };
+	size_t calls = 0;
+	buffer_t ib = { .b = (unsigned char*)msg,        .used = 0, .length = msglen, };
+	buffer_t ob = { .b = (unsigned char*)compressed, .used = 0, .length = sizeof compressed, };
+	shrink_t io = {
+		.get = buffer_get, .put = buffer_put, .in = &ib, .out = &ob,
+		.progress = test_progress, .progress_arg = &calls, .interval = 64,
+	};
+	if (shrink(&io, codec, 1) != SHRINK_CANCELLED || calls != 4 || io.read >= msglen)
+		return ELINE;
+	return 0;
+}
+
+/* compress 'msg' from segments into segments, the same as 'shrink_buffer' */
+static inline int test_iov(const int codec, const char *msg, const size_t msglen) {
+	assert(msg);
+	char compressed[TBUFL] = { 0, }, segmented[TBUFL] = { 0, };
+	size_t complen = sizeof compressed, seglen = 0;
+	if (msglen > TBUFL)
+		return ELINE;
+	if (shrink_buffer(codec, 1, msg, msglen, compressed, &complen) < 0)
+		return ELINE;
+	const size_t h = msglen / 2;
+	const shrink_iovec_t in[] = {
+		{ .iov_base = (char*)msg,           .iov_len = h / 2, },
+		{ .iov_base = NULL,                 .iov_len = 0, },
+		{ .iov_base = (char*)msg + (h / 2), .iov_len = msglen - (h / 2), },
+	}, out[] = {
+		{ .iov_base = segmented,            .iov_len = 7, },
+		{ .iov_base = segmented + 7,        .iov_len = 0, },
+		{ .iov_base = segmented + 7,        .iov_len = sizeof (segmented) - 7, },
+	};
+	if (shrink_iov(codec, 1, in, sizeof (in) / sizeof (in[0]), out, sizeof (out) / sizeof (out[0]), &seglen) < 0)
+		return ELINE;
+	if (seglen != complen || memcmp(compressed, segmented, complen))
+		return ELINE;
 	return 0;
 }
 
@@ -800,11 +2905,230 @@ int shrink_tests(void) {
 	};
 
 	for (size_t i = 0; i < (sizeof ts / sizeof (ts[0])); i++)
-		for (int j = CODEC_RLE; j <= CODEC_LZP; j++) {
-			const int r = test(j, ts[i], strlen(ts[i]) + 1);
+		for (int j = CODEC_RLE; j <= CODEC_MTF_ELIAS; j++) {
+			const long r = test(j, 0, NULL, ts[i], strlen(ts[i]) + 1);
+			if (r < 0)
+				return r;
+		}
+
+	for (size_t i = 0; i < (sizeof ts / sizeof (ts[0])); i++) {
+		const long r1 = test(CODEC_LZSS,  SHRINK_OPT_DECODE_SPEED, NULL, ts[i], strlen(ts[i]) + 1);
+		if (r1 < 0)
+			return r1;
+		const long r2 = test(CODEC_LZSSX, SHRINK_OPT_DECODE_SPEED, NULL, ts[i], strlen(ts[i]) + 1);
+		if (r2 < 0)
+			return r2;
+	}
+
+	for (int j = CODEC_LZSS; j <= CODEC_LZSSX; j += CODEC_LZSSX - CODEC_LZSS) { /* primed with itself */
+		const long r1 = test(j, 0, NULL,  ts[3], strlen(ts[3]) + 1);
+		const long r2 = test(j, 0, ts[3], ts[3], strlen(ts[3]) + 1);
+		if (r1 < 0)
+			return r1;
+		if (r2 < 0)
+			return r2;
+		if (r2 >= r1)
+			return ELINE;
+	}
+
+	for (int j = CODEC_LZSS; j <= CODEC_LZSSX; j += CODEC_LZSSX - CODEC_LZSS) {
+		const int r = test_seek(j, ts[3], strlen(ts[3]) + 1);
+		if (r < 0)
+			return r;
+	}
+
+	for (size_t i = 0; i < (sizeof ts / sizeof (ts[0])); i++)
+		for (int j = CODEC_RLE; j <= CODEC_MTF_ELIAS; j++) {
+			const int r = test_iov(j, ts[i], strlen(ts[i]) + 1);
 			if (r < 0)
 				return r;
 		}
+
+	for (int j = CODEC_RLE; j <= CODEC_MTF_ELIAS; j++) {
+		char batched[4][TBUFL];
+		shrink_iovec_t in[4], out[4];
+		size_t lengths[4] = { 0, };
+		for (size_t i = 0; i < 4; i++) {
+			in[i]  = (shrink_iovec_t) { .iov_base = ts[i],      .iov_len = strlen(ts[i]) + 1, };
+			out[i] = (shrink_iovec_t) { .iov_base = batched[i], .iov_len = sizeof (batched[i]), };
+		}
+		if (shrink_batch(j, 1, 4, in, out, lengths) < 0)
+			return ELINE;
+		for (size_t i = 0; i < 4; i++) {
+			char compressed[TBUFL];
+			size_t complen = sizeof compressed;
+			if (shrink_buffer(j, 1, ts[i], strlen(ts[i]) + 1, compressed, &complen) < 0)
+				return ELINE;
+			if (complen != lengths[i] || memcmp(compressed, batched[i], complen))
+				return ELINE;
+		}
+	}
+
+	char far[TBUFL] = { 0, }; /* matches further back than LZSS_RECENT */
+	for (size_t i = 0, x = 1; i < 300; i++, x = (x * 1103515245ul) + 12345ul)
+		far[i] = 'a' + ((x >> 16) % 26u);
+	memcpy(far + 300, far, sizeof (far) - 300);
+	for (int j = CODEC_LZSS; j <= CODEC_LZSSX; j += CODEC_LZSSX - CODEC_LZSS) {
+		const int r1 = test_readback(j, NULL, far, sizeof far);
+		const int r2 = test_readback(j, ts[3], ts[3], strlen(ts[3]) + 1);
+		if (r1 < 0)
+			return r1;
+		if (r2 < 0)
+			return r2;
+	}
+
+	for (size_t i = 0; i < (sizeof ts / sizeof (ts[0])); i++) {
+		const long r = test_long(ts[i], strlen(ts[i]) + 1);
+		if (r < 0)
+			return r;
+	}
+	const long rl = test_long(far, sizeof far);
+	if (rl < 0)
+		return rl;
+	if ((size_t)rl >= (sizeof (far) - 200u)) /* the repeat is found */
+		return ELINE;
+
+	static const char *text = "The THE the tHe Thé \x80\xFF\xFD then, Connection failed\n\
+		Thecompressionlibraryfailed ERROR: request";
+	const long rw = test(CODEC_WORDS, 0, NULL, text, strlen(text) + 1);
+	if (rw < 0)
+		return rw;
+	if ((size_t)rw >= strlen(text)) /* common words are replaced */
+		return ELINE;
+	for (size_t i = 1; i < (sizeof (words) / sizeof (words[0])); i++)
+		if (strcmp(words[i - 1], words[i]) >= 0 || strlen(words[i]) > WORDS_MAX)
+			return ELINE;
+
+	for (int j = CODEC_RLE; j <= CODEC_MTF_ELIAS; j++) { /* decompressed once, when first used */
+		char compressed[TBUFL] = { 0, };
+		unsigned char cache[TBUFL] = { 0, };
+		size_t complen = sizeof compressed;
+		const size_t length = strlen(ts[3]) + 1;
+		if (shrink_buffer(j, 1, ts[3], length, compressed, &complen) < 0)
+			return ELINE;
+		shrink_asset_t a = { .codec = j, .data = (unsigned char*)compressed, .length = complen, .cache = cache, .size = length, };
+		if (shrink_asset(&a) != cache || memcmp(cache, ts[3], length))
+			return ELINE;
+		compressed[0] ^= 0x55; /* not looked at again */
+		if (shrink_asset(&a) != cache)
+			return ELINE;
+		shrink_asset_t b = { .codec = j, .data = (unsigned char*)compressed, .length = complen, .cache = cache, .size = length + 1, };
+		if (shrink_asset(&b) || shrink_asset(&b))
+			return ELINE;
+	}
+
+	static char big[LZW_MAX * 4u], coded[LZW_MAX * 8u], decoded[LZW_MAX * 4u]; /* fills the LZW dictionary */
+	for (size_t i = 0, x = 1; i < sizeof big; i++, x = (x * 1103515245ul) + 12345ul)
+		big[i] = 'a' + ((x >> 16) % 26u);
+	for (unsigned options = 0; options <= SHRINK_OPT_LZW_FREEZE; options += SHRINK_OPT_LZW_FREEZE) {
+		buffer_t ib = { .b = (unsigned char*)big,     .used = 0, .length = sizeof big, };
+		buffer_t cb = { .b = (unsigned char*)coded,   .used = 0, .length = sizeof coded, };
+		buffer_t db = { .b = (unsigned char*)decoded, .used = 0, .length = sizeof decoded, };
+		shrink_t io = { .get = buffer_get, .put = buffer_put, .in = &ib, .out = &cb, .options = options, };
+		if (shrink(&io, CODEC_LZW, 1) < 0 || cb.used >= sizeof big)
+			return ELINE;
+		cb.length = cb.used;
+		cb.used = 0;
+		io.in = &cb;
+		io.out = &db;
+		if (shrink(&io, CODEC_LZW, 0) < 0 || db.used != sizeof big || memcmp(big, decoded, sizeof big))
+			return ELINE;
+	}
+
+	for (unsigned options = 0; options <= SHRINK_OPT_SERIES_INT; options += SHRINK_OPT_SERIES_INT) {
+		char samples[SERIES_SAMPLE * 30u + 3u] = { 0, }; /* regular, with the odd late one */
+		for (unsigned i = 0; i < 30u; i++) {
+			const double d = 20.0 + ((i % 5u) * 0.5) + (i == 17u ? 1e-3 : 0.0);
+			uint64_t v = 1000u + (i * 3u) + (i == 11u ? 70000u : 0u);
+			if (!options)
+				memcpy(&v, &d, sizeof v);
+			series_store((uint8_t*)samples + (i * SERIES_SAMPLE), 1600000000u + (i * 10u) + (i % 7u == 3u) + (i == 23u ? 300u : 0u));
+			series_store((uint8_t*)samples + (i * SERIES_SAMPLE) + 8, v);
+		}
+		const long r = test(CODEC_SERIES, options, NULL, samples, sizeof samples);
+		if (r < 0)
+			return r;
+		if ((size_t)r >= (sizeof (samples) / 4u))
+			return ELINE;
+	}
+
+	for (size_t i = 0; i < (sizeof ts / sizeof (ts[0])); i++) { /* fused CODECs are the same as the stages in turn */
+		const int fused[][2] = { { CODEC_MTF_RLE, CODEC_RLE, }, { CODEC_MTF_ELIAS, CODEC_ELIAS, }, };
+		for (size_t j = 0; j < (sizeof fused / sizeof (fused[0])); j++) {
+			char mtf[TBUFL] = { 0, }, staged[TBUFL] = { 0, }, once[TBUFL] = { 0, };
+			size_t mtflen = sizeof mtf, stagedlen = sizeof staged, oncelen = sizeof once;
+			if (shrink_buffer(CODEC_MTF, 1, ts[i], strlen(ts[i]) + 1, mtf, &mtflen) < 0)
+				return ELINE;
+			if (shrink_buffer(fused[j][1], 1, mtf, mtflen, staged, &stagedlen) < 0)
+				return ELINE;
+			if (shrink_buffer(fused[j][0], 1, ts[i], strlen(ts[i]) + 1, once, &oncelen) < 0)
+				return ELINE;
+			if (stagedlen != oncelen || memcmp(staged, once, oncelen))
+				return ELINE;
+		}
+	}
+
+	for (int stream = 0; stream < 2; stream++) { /* bit streams, over memory and a 'shrink_t' */
+		unsigned char bits[TBUFL * 4u] = { 0, };
+		buffer_t bb = { .b = bits, .used = 0, .length = sizeof bits, };
+		shrink_t bio = { .get = buffer_get, .put = buffer_put, .in = &bb, .out = &bb, };
+		shrink_bits_t w = { .out = stream ? NULL : bits, .length = sizeof bits, .io = &bio, };
+		for (unsigned i = 0; i <= SHRINK_BITS_MAX; i++)
+			if (shrink_bits_put(&w, 0x9E3779B97F4A7C15ull >> i, i) < 0 || shrink_bits_put_unary(&w, i * 3u) < 0 || shrink_bits_put_gamma(&w, (i * 1234567ull) + 1u) < 0)
+				return ELINE;
+		if (shrink_bits_flush(&w) < 0 || shrink_bits_put(&w, 0xA5u, 8) < 0 || shrink_bits_put(&w, 1, SHRINK_BITS_MAX + 1u) == 0)
+			return ELINE;
+		const size_t written = stream ? bb.used : w.used;
+		shrink_bits_t r = { .in = stream ? NULL : bits, .length = written, .io = &bio, };
+		bb = (buffer_t) { .b = bits, .used = 0, .length = written, };
+		for (unsigned i = 0; i <= SHRINK_BITS_MAX; i++) {
+			unsigned long long v = 0, u = 0, g = 0;
+			if (shrink_bits_peek(&r, i) != ((0x9E3779B97F4A7C15ull >> i) & ((1ull << i) - 1ull)))
+				return ELINE;
+			if (shrink_bits_get(&r, i, &v) < 0 || shrink_bits_get_unary(&r, &u) < 0 || shrink_bits_get_gamma(&r, &g) < 0)
+				return ELINE;
+			if (v != ((0x9E3779B97F4A7C15ull >> i) & ((1ull << i) - 1ull)) || u != (i * 3u) || g != ((i * 1234567ull) + 1u))
+				return ELINE;
+		}
+		unsigned long long v = 0;
+		if (shrink_bits_align(&r) < 0 || shrink_bits_peek(&r, 12) != 0xA50u || shrink_bits_skip(&r, 8) < 0)
+			return ELINE;
+		if (shrink_bits_get(&r, 1, &v) == 0 || shrink_bits_get_unary(&r, &v) == 0)
+			return ELINE;
+		if (!stream && r.used != written)
+			return ELINE;
+	}
+
+	char records[TBUFL] = { 0, }; /* fixed size records, repeat offsets should help */
+	for (size_t i = 0; i < sizeof records; i++)
+		records[i] = "id=00 name=sam;\n"[i % 16u];
+	for (size_t i = 0; i < sizeof records; i += 16u) {
+		records[i + 3] = 'a' + ((i / 16u) % 26u);
+		records[i + 4] = 'a' + ((i / 7u) % 26u);
+	}
+	const long r1 = test(CODEC_LZSS,  0, NULL, records, sizeof records);
+	const long r2 = test(CODEC_LZSSR, 0, NULL, records, sizeof records);
+	if (r1 < 0)
+		return r1;
+	if (r2 < 0)
+		return r2;
+	if (r2 >= r1)
+		return ELINE;
+
+	for (int j = CODEC_RLE; j <= CODEC_MTF_ELIAS; j++) {
+		const int r = test_cancel(j, records, sizeof records);
+		if (r < 0)
+			return r;
+	}
+
+	char run[TBUFL] = { 0, }; /* exercises long matches in the extended format */
+	memset(run, 'a', sizeof (run) / 2);
+	memset(run + (sizeof (run) / 2), 'b', sizeof (run) / 4);
+	for (int j = CODEC_RLE; j <= CODEC_MTF_ELIAS; j++) {
+		const long r = test(j, 0, NULL, run, sizeof run);
+		if (r < 0)
+			return r;
+	}
 	return 0;
 }
 
@@ -18,19 +18,186 @@ extern "C" {
 
 typedef struct {
 	int (*get)(void *in);          /* return negative on error, a byte (0-255) otherwise */
-	int (*put)(int ch, void *out); /* return ch on no error */
+	int (*put)(int ch, void *out); /* return ch on no error, NULL to only count output in 'wrote' */
 	void *in, *out;                /* passed to 'get' and 'put' respectively */
 	size_t read, wrote;            /* read only, bytes 'get' and 'put' respectively */
+	unsigned options;              /* SHRINK_OPT_* flags, zero for the defaults */
+	const unsigned char *dictionary; /* optional LZSS/LZSSX/LZSSR preset dictionary, its tail primes the window */
+	size_t dictionary_length;
+	int (*progress)(void *arg, size_t read, size_t wrote); /* optional, non-zero return stops with SHRINK_CANCELLED */
+	void *progress_arg;            /* passed to 'progress' */
+	size_t interval;               /* bytes read between calls to 'progress' */
+	size_t mark;                   /* private */
+	int cancelled;                 /* private */
 } shrink_t; /**< I/O abstraction, use to redirect to wherever you want... */
 
-enum { CODEC_RLE, CODEC_LZSS, CODEC_ELIAS, CODEC_MTF, CODEC_LZP, };
+enum { CODEC_RLE, CODEC_LZSS, CODEC_ELIAS, CODEC_MTF, CODEC_LZP, CODEC_LZSSX, CODEC_LZSSR, CODEC_WORDS, CODEC_LZW, CODEC_SERIES, CODEC_MTF_RLE, CODEC_MTF_ELIAS, };
+
+enum {
+	SHRINK_OPT_DECODE_SPEED = 1u << 0, /* LZSS encoder favours fewer, longer, tokens to speed up decoding */
+	SHRINK_OPT_LZW_FREEZE   = 1u << 1, /* LZW encoder keeps a full dictionary instead of starting again */
+	SHRINK_OPT_SERIES_INT   = 1u << 2, /* time series values are 64-bit integers, not doubles */
+};
+
+#define SHRINK_CANCELLED (-32767) /* returned when stopped by 'progress', or for a cancelled job */
+
+typedef struct shrink_pool shrink_pool_t; /**< a pool of worker threads, see 'pool.c' */
+
+typedef struct shrink_job {
+	shrink_t io;               /* I/O for the job, the callbacks are called on a worker thread */
+	int codec, encode;         /* as for 'shrink' */
+	int priority;              /* higher priority jobs are run first */
+	void (*complete)(struct shrink_job *job); /* called on the worker when done, optional */
+	void *arg;                 /* for use by 'complete' */
+	int result;                /* read only, result of 'shrink' or SHRINK_CANCELLED */
+	struct shrink_job *next;   /* private */
+	int state;                 /* private, zero to begin with */
+} shrink_job_t; /**< a job to run asynchronously on a pool */
+
+typedef struct {
+	unsigned long long bit;      /* position in the encoded input, in bits */
+	unsigned long long offset;   /* position in the decoded output, in bytes */
+	unsigned position;           /* position in the dictionary of the oldest byte in 'window' */
+	const unsigned char *window; /* the dictionary, oldest byte first */
+	size_t window_length;
+} shrink_checkpoint_t; /**< state of the LZSS decoder between two tokens */
+
+typedef struct {
+	int codec;                 /* CODEC 'data' was compressed with */
+	const unsigned char *data; /* the compressed asset */
+	size_t length;             /* of 'data' */
+	unsigned char *cache;      /* decompressed to on first use, 'size' bytes */
+	size_t size;               /* decompressed size */
+	int state;                 /* private, zero to begin with */
+} shrink_asset_t; /**< an asset embedded in a program, see 'shrink_asset' */
+
+typedef struct {
+	const unsigned char *in;  /* memory read from, or NULL to use 'io->get' */
+	unsigned char *out;       /* memory written to, or NULL to use 'io->put' */
+	size_t length, used;      /* of 'in' or 'out', and bytes of it used */
+	shrink_t *io;             /* stream used when 'in' or 'out' is NULL */
+	unsigned long long acc;   /* private, bits not yet written or read */
+	unsigned count;           /* private, number of bits in 'acc' */
+} shrink_bits_t; /**< a bit stream reader or writer, most significant bit first, see 'shrink_bits_put' */
+
+typedef struct {
+	void *iov_base; /* start of segment */
+	size_t iov_len; /* length of segment in bytes */
+} shrink_iovec_t; /**< a segment of a scatter/gather list, with the same members as a POSIX 'struct iovec' */
 
 /* negative on error, zero on success */
 SHRINK_API int shrink(shrink_t *io, int codec, int encode);
 SHRINK_API int shrink_buffer(int codec, int encode, const char *in, size_t inlength, char *out, size_t *outlength);
 SHRINK_API int shrink_tests(void);
+
+/* As 'shrink_buffer' but the input is taken from the 'nin' segments in 'in'
+ * one after another, and the output is written across the 'nout' segments
+ * of 'out', filling each in turn. '*outlength' is set to the total number of
+ * bytes written, which is zero on error. */
+SHRINK_API int shrink_iov(int codec, int encode, const shrink_iovec_t *in, size_t nin, const shrink_iovec_t *out, size_t nout, size_t *outlength);
+
+/* De/compress 'count' independent messages, 'in[k]' into 'out[k]', with the
+ * number of bytes written to each put in 'lengths[k]'. This stops at the
+ * first error and returns it, the lengths before it are set. */
+SHRINK_API int shrink_batch(int codec, int encode, size_t count, const shrink_iovec_t *in, const shrink_iovec_t *out, size_t *lengths);
+
+/* Decode an LZSS or LZSSX stream, calling 'checkpoint' with the state of the
+ * decoder whenever at least 'interval' more bytes have been output since the
+ * last call (and at the start). 'checkpoint' should copy what it needs, the
+ * window is only valid for the duration of the call, and can return negative
+ * to stop decoding with an error. 'shrink_seek' decodes from a checkpoint,
+ * 'io->get' must return bytes from the one containing bit 'from->bit'. */
+SHRINK_API int shrink_index(shrink_t *io, int codec, unsigned long long interval, int (*checkpoint)(void *arg, const shrink_checkpoint_t *c), void *arg);
+SHRINK_API int shrink_seek(shrink_t *io, int codec, const shrink_checkpoint_t *from);
+
+/* Decode an LZSS or LZSSX stream without keeping a window, references are
+ * resolved by reading back 'length' bytes of output at 'offset' with 'fetch'
+ * (which is passed 'io->out'), for example with 'pread' on the output file.
+ * Everything given to 'io->put' must be readable with 'fetch' straight away,
+ * 'fetch' should return negative on error. A few hundred bytes are used no
+ * matter how large the window is, see LZSS_RECENT and LZSS_CACHE. */
+SHRINK_API int shrink_readback(shrink_t *io, int codec, int (*fetch)(void *out, unsigned long long offset, unsigned char *b, size_t length));
+
+/* Find repeats of at least a few dozen bytes however far apart they are, a
+ * pre-stage for the other CODECs (the output is meant to be compressed
+ * again) as they can only see as far back as their window. A fixed amount of
+ * memory is used, earlier bytes are read back with 'fetch', which is passed
+ * 'io->in' when encoding and 'io->out' when decoding, and has the same
+ * requirements as for 'shrink_readback'. See 'long_t' in 'shrink.c'. About
+ * 65KiB of stack is used unless the library is built with USE_STATIC, see
+ * LONG_BITS to make that smaller. */
+SHRINK_API int shrink_long(shrink_t *io, int encode, int (*fetch)(void *arg, unsigned long long offset, unsigned char *b, size_t length));
+
+/* Return an embedded asset, decompressing it into 'a->cache' the first time
+ * it is used, or NULL if it could not be (and on every call after). The
+ * assets are made with the '-E' option of the 'shrink' program, which
+ * writes them out as C, the cache is zeroed memory so it does not take up
+ * space in the program. This is not thread safe, each asset has to be used
+ * for the first time with a lock held or before any threads are started. */
+SHRINK_API const unsigned char *shrink_asset(shrink_asset_t *a);
+
+/* A bit stream over memory or a 'shrink_t' for formats of your own, it is
+ * either a writer or a reader. Bits are most significant first within each
+ * byte. Up to SHRINK_BITS_MAX bits are written, read, peeked at or skipped
+ * at a time. Reading past the end is an error, except for 'shrink_bits_peek'
+ * which pretends there are zeros there, so a table driven decoder can look
+ * at more bits than are left. A writer must be finished with
+ * 'shrink_bits_flush', which writes out any partial byte padded with
+ * zeros, 'shrink_bits_align' moves a reader to the start of the next byte.
+ * A memory reader reads ahead, 'used' is only the byte position of the
+ * reader after 'shrink_bits_align'. Data that arrives in chunks is read or
+ * written through a 'shrink_t'. Unary numbers are 'v' one bits then a zero,
+ * gamma numbers are Elias-Gamma codes for 'v' from 1 to 2^56 - 1. All
+ * return negative on error, zero on success. */
+#define SHRINK_BITS_MAX (56u)
+SHRINK_API int shrink_bits_put(shrink_bits_t *s, unsigned long long v, unsigned n);
+SHRINK_API int shrink_bits_get(shrink_bits_t *s, unsigned n, unsigned long long *v);
+SHRINK_API unsigned long long shrink_bits_peek(shrink_bits_t *s, unsigned n);
+SHRINK_API int shrink_bits_skip(shrink_bits_t *s, unsigned n);
+SHRINK_API int shrink_bits_flush(shrink_bits_t *s);
+SHRINK_API int shrink_bits_align(shrink_bits_t *s);
+SHRINK_API int shrink_bits_put_unary(shrink_bits_t *s, unsigned long long v);
+SHRINK_API int shrink_bits_get_unary(shrink_bits_t *s, unsigned long long *v);
+SHRINK_API int shrink_bits_put_gamma(shrink_bits_t *s, unsigned long long v);
+SHRINK_API int shrink_bits_get_gamma(shrink_bits_t *s, unsigned long long *v);
+
+/* LZSS with the parameters given at run time instead of compile time, the
+ * format is the same as CODEC_LZSS. This is implemented in C++ ('lzss.cpp')
+ * and only some parameters are available: EJ = 4 with EI 10 to 12, and
+ * EI = 13 with EJ = 5, both with P = 2. Negative on error or if the
+ * parameters are not available, zero on success. */
+SHRINK_API int shrink_lzss(shrink_t *io, int encode, unsigned ei, unsigned ej, unsigned p);
+/* An asynchronous interface, jobs are submitted to a pool of worker threads
+ * made with 'shrink_pool_create' and are finished with later. This is in
+ * 'pool.c', which, unlike the rest of the library, allocates memory and needs
+ * POSIX threads (the functions fail without them). A job must not be touched
+ * from when it is submitted until it is finished, submitting it again before
+ * then fails. When a job is finished its
+ * 'complete' callback is called, or if it does not have one, it is queued to
+ * be returned by 'shrink_complete', which returns NULL if there is nothing
+ * finished yet. 'shrink_pool_fd' is a file descriptor that is readable when
+ * there is something for 'shrink_complete', for use with 'poll' or 'epoll'.
+ * A library built with USE_STATIC (see SHRINK_VERSION_STATIC) is not thread
+ * safe, a pool made with it has one worker however many are asked for.
+ * 'shrink_cancel' cancels a job that has not been started yet, failing if it
+ * has been, and 'shrink_pool_destroy' cancels any jobs not yet started and
+ * waits for the running ones to finish. A cancelled job is finished as any
+ * other with a 'result' of SHRINK_CANCELLED. Once a pool is destroyed the
+ * jobs it finished that were never collected with 'shrink_complete', and
+ * those it cancelled, are the callers again and can be submitted anew. */
+SHRINK_API shrink_pool_t *shrink_pool_create(int threads);
+SHRINK_API void shrink_pool_destroy(shrink_pool_t *p);
+SHRINK_API int shrink_submit(shrink_pool_t *p, shrink_job_t *job);
+SHRINK_API int shrink_cancel(shrink_pool_t *p, shrink_job_t *job);
+SHRINK_API shrink_job_t *shrink_complete(shrink_pool_t *p);
+SHRINK_API int shrink_pool_fd(shrink_pool_t *p);
+SHRINK_API int shrink_pool_tests(void);
+
 SHRINK_API int shrink_version(unsigned long *version); /* version in x.y.z, z = LSB, MSB = options */
 
+#define SHRINK_VERSION_DEBUG  (1ul << 24) /* set in the version if built with assertions and tests */
+#define SHRINK_VERSION_STATIC (1ul << 25) /* set if built with USE_STATIC, which is not thread safe */
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,293 @@
+/* Project:    Shrink, an LSZZ and RLE compression library
+ * Repository: <https://github.com/howerj/shrink>
+ * Maintainer: Richard James Howe
+ * License:    The Unlicense
+ * Email:      howe.r.j.89@gmail.com
+ *
+ * A C++ version of the LZSS CODEC in 'shrink.c' with the parameters, which
+ * are macros in the C version, given as template parameters instead. The
+ * window, the masks and the bit widths are all compile time constants for
+ * each instantiation, and any number of configurations can be used in the
+ * same program. With the same parameters the output is the same as that of
+ * CODEC_LZSS.
+ *
+ * No exceptions, RTTI, allocation nor anything from the C++ library is
+ * used so that the instantiations in 'lzss.cpp' can be linked into a C
+ * program without the C++ runtime. */
+#ifndef SHRINK_HPP
+#define SHRINK_HPP
+
+#include "shrink.h"
+#include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+/* This is a structure and not a namespace so that it can share the name of
+ * the C function 'shrink', it only holds the templates. */
+struct shrink {
+
+template <unsigned ei, unsigned ej, unsigned p, int ch = ' '>
+class lzss {
+	static_assert(ei <= 15, "1 << EI would be larger than smallest possible INT_MAX");
+	static_assert(ei >= 6, "no point in encoding");
+	static_assert(ej <= ei, "match length needs to be smaller than thing we are matching in");
+	static_assert(p > 1, "minimum match length must be larger than one");
+	static_assert((ei + ej) <= 24, "a reference must fit in the bit accumulator");
+
+public:
+	static constexpr unsigned EI = ei, EJ = ej, P = p;
+	static constexpr unsigned N = 1u << EI;             /* buffer size */
+	static constexpr unsigned F = (1u << EJ) + (P - 1u); /* lookahead buffer size */
+	static constexpr unsigned WIDE = 16u;               /* decoder block copy size */
+
+	int encode(shrink_t *io);
+	int decode(shrink_t *io);
+
+private:
+	enum { REFERENCE, LITERAL };
+
+	struct masks { uint32_t m[25]; };
+
+	static constexpr masks make_masks() {
+		masks t = {};
+		for (unsigned i = 0; i < 25; i++)
+			t.m[i] = (UINT32_C(1) << i) - 1u;
+		return t;
+	}
+
+	static constexpr masks bits = make_masks(); /* 'bits.m[n]' has the lowest 'n' bits set */
+
+	/* Bits are accumulated in a word instead of being dealt with one at
+	 * a time, the most significant bit of each byte comes first. */
+	uint32_t acc = 0;
+	unsigned count = 0;
+	unsigned run = 0; /* encoder, 'buffer[0]' to 'buffer[run - 1]' are still 'ch' */
+	shrink_t *io = nullptr;
+	uint8_t buffer[(N * 2u) + WIDE] = { 0, };
+
+	int get() { /* see 'get' in 'shrink.c' */
+		if (io->progress && (io->read - io->mark) >= io->interval) {
+			if (io->cancelled || io->progress(io->progress_arg, io->read, io->wrote)) {
+				io->cancelled = 1;
+				return SHRINK_CANCELLED;
+			}
+			io->mark = io->read;
+		}
+		const int r = io->get(io->in);
+		io->read += r >= 0;
+		assert(r <= 255);
+		return r;
+	}
+
+	int put(const int c) {
+		if (!io->put) {
+			io->wrote++;
+			return c;
+		}
+		const int r = io->put(c, io->out);
+		io->wrote += r >= 0;
+		assert(r <= 255);
+		return r;
+	}
+
+	int put_bits(const uint32_t v, const unsigned n) {
+		assert(n <= 24);
+		acc = (acc << n) | (v & bits.m[n]);
+		count += n;
+		while (count >= 8) {
+			count -= 8;
+			if (put((acc >> count) & 0xFFu) < 0)
+				return -1;
+		}
+		return 0;
+	}
+
+	long get_bits(const unsigned n) {
+		assert(n <= 24);
+		while (count < n) {
+			const int c = get();
+			if (c < 0)
+				return -1;
+			acc = (acc << 8) | c;
+			count += 8;
+		}
+		count -= n;
+		return (acc >> count) & bits.m[n];
+	}
+
+	int flush() {
+		if (count)
+			if (put((acc << (8u - count)) & 0xFFu) < 0)
+				return -1;
+		count = 0;
+		return 0;
+	}
+
+	unsigned match(const unsigned s, const unsigned r, const unsigned end, unsigned *position) const;
+	void copy(uint8_t *dst, const unsigned distance, const unsigned length);
+	int output(const uint8_t *b, const unsigned length);
+};
+
+};
+
+template <unsigned ei, unsigned ej, unsigned p, int ch>
+constexpr typename shrink::lzss<ei, ej, p, ch>::masks shrink::lzss<ei, ej, p, ch>::bits;
+
+template <unsigned ei, unsigned ej, unsigned p, int ch>
+unsigned shrink::lzss<ei, ej, p, ch>::match(const unsigned s, const unsigned r, const unsigned end, unsigned *position) const {
+	assert(position);
+	assert(r < end);
+	unsigned x = 0, y = 1;
+	const unsigned f1 = (F <= end - r) ? F : end - r;
+	for (unsigned i = s; i < r; i++) { /* search for longest match */
+		const uint8_t *m = static_cast<const uint8_t*>(memchr(&buffer[i], buffer[r], r - i));
+		if (!m)
+			break;
+		i += m - &buffer[i];
+		unsigned j = 1;
+		for (j = 1; j < f1; j++)
+			if (buffer[i + j] != buffer[r + j])
+				break;
+		if (j > y) {
+			x = i;
+			y = j;
+		}
+		if ((y + P - 1) > F) /* maximum length reach, stop search */
+			break;
+		if ((i + j) < run) /* see 'lzss_match' in 'shrink.c' */
+			i = run - j - 1u;
+	}
+	*position = x;
+	return y;
+}
+
+template <unsigned ei, unsigned ej, unsigned p, int ch>
+int shrink::lzss<ei, ej, p, ch>::encode(shrink_t *io) {
+	assert(io);
+	this->io = io;
+	acc = 0;
+	count = 0;
+	memset(buffer, ch, N - F);
+	run = N - F;
+
+	unsigned end = N - F;
+	for (; end < N * 2u; end++) {
+		const int c = get();
+		if (c < 0)
+			break;
+		buffer[end] = c;
+	}
+
+	for (unsigned r = N - F; r < end; ) {
+		unsigned x = 0, y = match(r - (N - F), r, end, &x);
+		if (y <= P) {
+			y = 1;
+			if (put_bits(LITERAL, 1) < 0 || put_bits(buffer[r], 8) < 0)
+				return -1;
+		} else {
+			const uint32_t reference = ((uint32_t)(x & (N - 1u)) << EJ) | (y - P);
+			if (put_bits(REFERENCE, 1) < 0 || put_bits(reference, EI + EJ) < 0)
+				return -1;
+		}
+		r += y;
+		if (r >= ((N * 2u) - F)) { /* move and refill buffer */
+			memmove(buffer, buffer + N, N);
+			run = 0;
+			end -= N;
+			r -= N;
+			while (end < (N * 2u)) {
+				const int c = get();
+				if (c < 0)
+					break;
+				buffer[end++] = c;
+			}
+		}
+	}
+	return flush();
+}
+
+template <unsigned ei, unsigned ej, unsigned p, int ch>
+void shrink::lzss<ei, ej, p, ch>::copy(uint8_t *dst, const unsigned distance, const unsigned length) {
+	assert(dst);
+	assert(distance > 0);
+	const uint8_t *src = dst - distance;
+	if (distance == 1) {
+		memset(dst, *src, length);
+	} else if (distance >= WIDE) {
+		for (unsigned k = 0; k < length; k += WIDE)
+			memcpy(dst + k, src + k, WIDE);
+	} else if (distance >= (WIDE / 2u)) {
+		for (unsigned k = 0; k < length; k += WIDE / 2u)
+			memcpy(dst + k, src + k, WIDE / 2u);
+	} else if (distance >= length) {
+		memcpy(dst, src, length);
+	} else {
+		memcpy(dst, src, distance);
+		for (unsigned k = distance; k < length;) {
+			const unsigned n = (k < (length - k)) ? k : length - k;
+			memcpy(dst + k, dst, n);
+			k += n;
+		}
+	}
+}
+
+template <unsigned ei, unsigned ej, unsigned p, int ch>
+int shrink::lzss<ei, ej, p, ch>::output(const uint8_t *b, const unsigned length) {
+	assert(b);
+	if (!io->put) {
+		io->wrote += length;
+		return 0;
+	}
+	for (unsigned k = 0; k < length; k++)
+		if (put(b[k]) != b[k])
+			return -1;
+	return 0;
+}
+
+/* See 'lzss_decode' in 'shrink.c' for how the window is laid out. */
+template <unsigned ei, unsigned ej, unsigned p, int ch>
+int shrink::lzss<ei, ej, p, ch>::decode(shrink_t *io) {
+	assert(io);
+	this->io = io;
+	acc = 0;
+	count = 0;
+	memset(buffer, 0, F);
+	memset(buffer + F, ch, N - F);
+
+	for (unsigned r = N - F, w = N;;) {
+		const long c = get_bits(1);
+		if (c < 0)
+			break;
+		if (c == LITERAL) {
+			const int b = (int)get_bits(8);
+			if (b < 0)
+				break;
+			if (put(b) != b)
+				return -1;
+			if (w >= (N * 2u)) {
+				memmove(buffer, buffer + w - N, N);
+				w = N;
+			}
+			buffer[w++] = b;
+			r = (r + 1u) & (N - 1u);
+			continue;
+		}
+		const long reference = get_bits(EI + EJ);
+		if (reference < 0)
+			break;
+		const unsigned i = reference >> EJ, length = (reference & bits.m[EJ]) + P;
+		const unsigned distance = ((r - i - 1u) & (N - 1u)) + 1u;
+		r = (r + length) & (N - 1u);
+		if ((w + length) > (N * 2u)) {
+			memmove(buffer, buffer + w - N, N);
+			w = N;
+		}
+		copy(&buffer[w], distance, length);
+		if (output(&buffer[w], length) < 0)
+			return -1;
+		w += length;
+	}
+	return 0;
+}
+
+#endif
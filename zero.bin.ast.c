@@ -0,0 +1,16 @@
+/* generated by 'shrink -E', do not edit */
+#include "shrink.h"
+
+static const unsigned char asset_data[] = {
+	0x80, 0x3f, 0x7f, 0xff, 0xff, 0xf7, 0xff, 0xef,
+};
+
+static unsigned char asset_cache[1048576];
+
+shrink_asset_t asset = {
+	.codec = CODEC_LZSSX,
+	.data = asset_data,
+	.length = 8,
+	.cache = asset_cache,
+	.size = 1048576,
+};